@@ -9,19 +9,46 @@ SMSlib="${devkitSMS}/SMSlib"
 ihx2sms="${devkitSMS}/ihx2sms/Linux/ihx2sms"
 pcmenc="./tools/pcmenc/encoder/pcmenc"
 sneptile="./tools/Sneptile-0.10.0/Sneptile"
+bank_packer="./tools/bank-packer/bank-packer"
+vdp_render="./tools/vdp-render/vdp-render"
+discard_baker="./tools/discard-baker/discard-baker"
+
+# Succeeds if the tool has not been built, or any of the given sources are newer than it
+tool_out_of_date ()
+{
+    tool="$1"
+    shift
+
+    if [ ! -e "$tool" ]
+    then
+        return 0
+    fi
+
+    for source in "$@"
+    do
+        if [ "$source" -nt "$tool" ]
+        then
+            return 0
+        fi
+    done
+
+    return 1
+}
 
 build_pcmenc ()
 {
     # Early return if we've already got an up-to-date build
-    if [ -e $pcmenc -a "./tools/pcmenc/encoder/pcmenc.cpp" -ot $pcmenc ]
+    if ! tool_out_of_date $pcmenc ./tools/pcmenc/encoder/*.cpp ./tools/pcmenc/encoder/*.c \
+                                  ./tools/pcmenc/encoder/*.h ./tools/pcmenc/encoder/*.hpp
     then
         return
     fi
 
+    # The Makefile doesn't track headers, so rebuild everything
     echo "Building pcmenc..."
     (
         cd "tools/pcmenc/encoder"
-        make
+        make -B
         echo ""
     )
 }
@@ -29,7 +56,7 @@ build_pcmenc ()
 build_sneptile ()
 {
     # Early return if we've already got an up-to-date build
-    if [ -e $sneptile -a "./tools/Sneptile-0.10.0/source/main.c" -ot $sneptile ]
+    if ! tool_out_of_date $sneptile ./tools/Sneptile-0.10.0/source/*.c ./tools/Sneptile-0.10.0/source/*.h
     then
         return
     fi
@@ -41,116 +68,110 @@ build_sneptile ()
     )
 }
 
-build_ants_for_master_system ()
+build_bank_packer ()
 {
-    echo "Building Ants for Master System..."
-
-    # Cards use the sprite palette, as they can slide across the screen. However,
-    # the card artwork is large enough to need its own bank which is currently
-    # implemented as a separate call to Sneptile. To keep the palette consistent
-    # for both banks of in-game patterns, the palette is defined here.
-    # Note that the first three entries are shared with the title sprite palette,
-    # so that the same cursor patterns can be used.
-    # The background palette is also fixed, so that a couple of colours can be made
-    # common across both palettes. Eg, to more easily access the purple crystal for
-    # the side-panels.
-    # Sprite palette [0] is black (transparent)
-    # Sprite palette [1] is white (cursor)
-    # Sprite palette [2] is black (cursor)
-    # Sprite palette [3] is red (disabled cursor)
-    # Sprite palette [4] is green (win counter digits)
-    #
-    GAME_BACKGROUND_PALETTE="0x00 0x3f 0x1f 0x3c 0x15 0x2a 0x03 0x2b 0x02 0x00 0x2e 0x19 0x04 0x3a 0x38 0x25"
-    GAME_SPRITE_PALETTE="0x00 0x3f 0x00 0x02 0x08 0x15 0x2a 0x03 0x2b 0x06 0x1b 0x2e 0x34 0x3a 0x21 0x25"
-
+    # Early return if we've already got an up-to-date build
+    if ! tool_out_of_date $bank_packer ./tools/bank-packer/source/*.c
+    then
+        return
+    fi
 
-    echo "  Generating tile data..."
-    mkdir -p title_tile_data
+    echo "Building bank-packer..."
     (
-        # Sprite palette [0] is black (transparent)
-        # Sprite palette [1] is white (cursor)
-        # Sprite palette [2] is black (cursor)
-        # Sprite palette [3] is red (disabled cursor)
-        # Background palette [0] is black (background colour)
-        ${sneptile} --sprites --output-dir title_tile_data \
-            --sprite-palette 0x00 0x3f 0x00 0x02 \
-            --background-palette 0x00 \
-            --panels 2x2,3 tiles/cursor.png \
-            --background tiles/title.png \
-            --background --panels 2x1,4 tiles/widgets.png
+        cd "tools/bank-packer"
+        ./build.sh
     )
-    mkdir -p game_tile_data
+}
+
+build_vdp_render ()
+{
+    # Early return if we've already got an up-to-date build
+    if ! tool_out_of_date $vdp_render ./tools/vdp-render/source/*.c ./tools/vdp-render/source/*.h \
+                                      ./tools/Sneptile-0.10.0/source/manifest.c ./tools/Sneptile-0.10.0/source/manifest.h
+    then
+        return
+    fi
+
+    echo "Building vdp-render..."
     (
-        # Background palette [0] is black (background colour)
-        # Background palette [1] is white (digit printing)
-        # Background palette [2] is yellow (digit printing)
-        ${sneptile} --sprites --output-dir game_tile_data \
-            --sprite-palette ${GAME_SPRITE_PALETTE} \
-            --background-palette ${GAME_BACKGROUND_PALETTE} \
-            --background --panels 4x2,4 tiles/player.png \
-            --background --panels 4x14,2 tiles/panel.png \
-            --background --panels 6x3,2 tiles/castles.png \
-            --background --panels 1x2,2 tiles/fence.png \
-            --background tiles/background.png
+        cd "tools/vdp-render"
+        ./build.sh
     )
-    mkdir -p card_tile_data
+}
+
+build_discard_baker ()
+{
+    # Early return if we've already got an up-to-date build
+    if ! tool_out_of_date $discard_baker ./tools/discard-baker/source/*.c
+    then
+        return
+    fi
+
+    echo "Building discard-baker..."
     (
-        ${sneptile} --sprites --output-dir card_tile_data \
-            --sprite-palette ${GAME_SPRITE_PALETTE} \
-            --panels 4x6,32 tiles/cards.png
+        cd "tools/discard-baker"
+        ./build.sh
     )
+}
+
+build_ants_for_master_system ()
+{
+    echo "Building Ants for Master System..."
+
+    # Discarded cards are composited ahead of time, so that they can be loaded
+    # without any work on the Master System.
+    mkdir -p generated_tiles
+    echo "  Baking discarded cards..."
+    ${discard_baker} tiles/cards.png generated_tiles/cards.png generated_tiles/cards_discarded.png || exit 1
+
+    # The sheets, palettes, and options for each tile data directory are described
+    # in the manifest. Unchanged sheets are re-used from tile_cache, and generated
+    # files are only rewritten if their contents change.
+    echo "  Generating tile data..."
+    ${sneptile} --manifest tiles/tiles.manifest || exit 1
+
+    # Check that the generated tile data still reproduces every sheet
+    echo "  Checking tile data..."
+    ${vdp_render} --manifest tiles/tiles.manifest > /dev/null || exit 1
 
     mkdir -p sound_data
     echo "  Generating sound data..."
-    for sound in card build-castle ruin-castle build-fence ruin-fence \
-                 increase-stocks decrease-stocks increase-power curse
+    # To add a sound, add it to this list. It can then be played with play_sound (SOUND_<NAME>).
+    sounds="card build-castle ruin-castle build-fence ruin-fence increase-stocks decrease-stocks increase-power curse fanfare"
+    for sound in ${sounds}
     do
         # Don't process sounds that are already up to date
-        if [ -e "./sound_data/${sound}.h" -a "./sounds/${sound}.wav" -ot "./sound_data/${sound}.h" ]
+        if [ -e "./sound_data/${sound}.pcmenc" -a "./sounds/${sound}.wav" -ot "./sound_data/${sound}.pcmenc" ]
         then
             continue
         fi
 
-        # Convert with pcmenc, then store the sound data in a C header file.
-        ${pcmenc} -rto 1 -dt1 12 -dt2 12 -dt3 423 "./sounds/${sound}.wav"
-        mv "./sounds/${sound}.wav.pcmenc" "./sound_data/${sound}_sound"
-        (
-            cd "./sound_data/"
-            xxd --include "${sound}_sound" > ${sound}.h
-            sed -e "s/unsigned char/const uint8_t/" \
-                -e "/unsigned int/d" \
-                --in-place ${sound}.h
-        )
-        rm "./sound_data/${sound}_sound"
+        # Convert with pcmenc, splitting sounds that don't fit in a single bank into 16 KiB parts.
+        ${pcmenc} -rto 1 -dt1 12 -dt2 12 -dt3 423 -r 16 "./sounds/${sound}.wav"
+        mv "./sounds/${sound}.wav.pcmenc" "./sound_data/${sound}.pcmenc"
     done
 
-    # Fanfare doesn't fit in a single bank, so split it
-    for sound in fanfare
+    # Place the sounds into ROM banks. The space left over in the pattern banks
+    # is offered to the packer, with new banks being allocated after the last
+    # pattern bank. Sneptile records how much of each pattern bank is used in its header.
+    pattern_reserves=""
+    first_sound_bank=2
+    for header in *_tile_data/bank_*.h
     do
-        # Don't process sounds that are already up to date
-        if [ -e "./sound_data/${sound}_1.h" -a "./sounds/${sound}.wav" -ot "./sound_data/${sound}_1.h" ]
+        bank=$(basename ${header} .h | sed -e "s/bank_//")
+        pattern_reserves="${pattern_reserves} --reserve ${bank}:$(sed -n -e "s/^#define BANK_${bank}_BYTES //p" ${header})"
+        if [ ${bank} -ge ${first_sound_bank} ]
         then
-            continue
+            first_sound_bank=$((bank + 1))
         fi
-
-        # Convert with pcmenc, splitting to 16 KiB of sample data per C header file.
-        ${pcmenc} -rto 1 -dt1 12 -dt2 12 -dt3 423 "./sounds/fanfare.wav" -r 16
-        mv "./sounds/${sound}.wav.pcmenc" "./sound_data/${sound}_sound"
-        (
-            cd "./sound_data/"
-            xxd --include -l 16384 -n "${sound}_sound_1" "${sound}_sound" > ${sound}_1.h
-            xxd --include -s 16384 -n "${sound}_sound_2" "${sound}_sound" > ${sound}_2.h
-            sed -e "s/unsigned char/const uint8_t/" \
-                -e "/unsigned int/d" \
-                --in-place ${sound}_1.h \
-                --in-place ${sound}_2.h
-        )
-        rm "./sound_data/${sound}_sound"
     done
+    rm -f sound_data/sound_bank_*.c
+    ${bank_packer} --output-dir sound_data --first-bank ${first_sound_bank} ${pattern_reserves} \
+        $(for sound in ${sounds}; do echo "sound_data/${sound}.pcmenc"; done) || exit 1
 
     mkdir -p build/code
     echo "  Compiling..."
-    for file in main title game castle panel sound rng save
+    for file in main title game castle panel sound rng save vram_queue
     do
         # Don't recompile files that are already up to date
         if [ -e "./build/code/${file}.rel" -a "./source/${file}.c" -ot "./build/code/${file}.rel" ]
@@ -166,25 +187,38 @@ build_ants_for_master_system ()
     # Libraries
     ${sdcc} -c -mz80 --peep-file ${devkitSMS}/SMSlib/src/peep-rules.txt -I ${SMSlib}/src \
         -o "build/code/fxsample.rel" "libraries/sms-fxsample/fxsample.c" || exit 1
+    ${sdcc} -c -mz80 --peep-file ${devkitSMS}/SMSlib/src/peep-rules.txt -I ${SMSlib}/src \
+        -o "build/code/unpack.rel" "libraries/sms-unpack/unpack.c" || exit 1
+
+    # Pattern banks, as generated by Sneptile
+    bank_flags=""
+    for source in *_tile_data/bank_*.c
+    do
+        bank=$(basename ${source} .c | sed -e "s/bank_//")
+        ${sdcc} -c -mz80 --constseg BANK_${bank} ${source} -o build/$(dirname ${source})_bank_${bank}.rel
+        bank_flags="${bank_flags} -Wl-b_BANK_${bank}=0x8000"
+    done
 
-    # Asset banks
-    for bank in 2 3 4 5 6 7 8 9 10 11
+    # Sound banks, as generated by bank-packer
+    for source in sound_data/sound_bank_*.c
     do
-        ${sdcc} -c -mz80 --constseg BANK_${bank} source/bank_${bank}.c -o build/bank_${bank}.rel
+        bank=$(basename ${source} .c | sed -e "s/sound_bank_//")
+        ${sdcc} -c -mz80 --constseg BANK_${bank} ${source} -o build/sound_bank_${bank}.rel
+        case "${bank_flags}" in
+            *"_BANK_${bank}="*) ;;
+            *) bank_flags="${bank_flags} -Wl-b_BANK_${bank}=0x8000" ;;
+        esac
     done
 
     echo ""
     echo "  Linking..."
     ${sdcc} -o build/Ants.ihx -mz80 --no-std-crt0 --data-loc 0xC000 \
-        -Wl-b_BANK_2=0x8000 -Wl-b_BANK_3=0x8000 -Wl-b_BANK_4=0x8000 -Wl-b_BANK_5=0x8000 \
-        -Wl-b_BANK_6=0x8000 -Wl-b_BANK_7=0x8000 -Wl-b_BANK_8=0x8000 -Wl-b_BANK_9=0x8000 \
-        -Wl-b_BANK_10=0x8000 -Wl-b_BANK_11=0x8000 \
+        ${bank_flags} \
         ${devkitSMS}/crt0/crt0_sms.rel \
         build/code/*.rel \
         ${SMSlib}/SMSlib.lib \
-        build/bank_2.rel build/bank_3.rel build/bank_4.rel build/bank_5.rel \
-        build/bank_6.rel build/bank_7.rel build/bank_8.rel build/bank_9.rel \
-        build/bank_10.rel build/bank_11.rel || exit 1
+        build/*_tile_data_bank_*.rel \
+        build/sound_bank_*.rel || exit 1
 
     echo ""
     echo "  Generating ROM..."
@@ -210,6 +244,8 @@ then
     rm -rf title_tile_data
     rm -rf game_tile_data
     rm -rf card_tile_data
+    rm -rf generated_tiles
+    rm -rf tile_cache
     rm -rf sound_data
     rm -rf build
 elif [ "${1}" != "fast" ]
@@ -219,4 +255,7 @@ fi
 
 build_pcmenc
 build_sneptile
+build_bank_packer
+build_vdp_render
+build_discard_baker
 build_ants_for_master_system
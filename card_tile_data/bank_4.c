@@ -0,0 +1,467 @@
+/*
+ * VDP Pattern data, bank 4
+ */
+
+#include <stdint.h>
+
+const uint32_t cards_patterns [] = {
+    0x00000000, 0x00000000, 0x001f1f1f, 0x1e212120, 0x304f4f40, 0x304f4e41, 0x304f404f, 0x314e404e,
+    0x00000000, 0x00000000, 0x00ffffff, 0x3fc0c000, 0x3fc0c000, 0x3fc000c0, 0x3fc000c0, 0xff000000,
+    0x00000000, 0x00000000, 0x00ffffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0xd8042404, 0x9c026202, 0xdc022202, 0xdc022202, 0x8c027202,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0x98046404, 0xec021202, 0xdc022202, 0xec021202, 0x9c026202,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0x88047404, 0xbc024202, 0x8c027202, 0xec021202, 0x9c026202,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0x98046404, 0xac025202, 0xdc022202, 0xac025202, 0xcc023202,
+    0x00000000, 0x00000000, 0x00ffffff, 0xfd000200, 0xf9000600, 0xfd000200, 0xfd000200, 0xf8000700,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0x98046404, 0xac025202, 0xac025202, 0xac025202, 0xcc023202,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0x98046404, 0xec021202, 0x8c027202, 0xbc024202, 0x8c027202,
+    0x00000000, 0x00000000, 0x00ffffff, 0xf9000600, 0xfe000100, 0xfd000200, 0xfe000100, 0xf9000600,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0x98046404, 0xac025202, 0x8c027202, 0xec021202, 0x9c026202,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0xff000000, 0xbb004444, 0xbb004444, 0xaa005555, 0xaa005555, 0xd6002929, 0xd7002828, 0xff000000,
+    0xff000000, 0xeb001414, 0x2b00d4d4, 0xab005454, 0xab005454, 0xab005454, 0x2b00d4d4, 0xff000000,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202,
+    0xff000000, 0x9f006060, 0xac005353, 0x9a006565, 0xaa005555, 0xaa005555, 0x9c006363, 0xff000000,
+    0xff000000, 0xff000000, 0xdb002424, 0xb5004a4a, 0x91006e6e, 0xd7002828, 0xb9004646, 0xff000000,
+    0x3f404040, 0x27405858, 0x2b405454, 0x2a405555, 0x2a405555, 0x2a405555, 0x27405858, 0x3f404040,
+    0xff000000, 0xf7000808, 0x6e009191, 0xad005252, 0x2400dbdb, 0xed001212, 0x2e00d1d1, 0xff000000,
+    0xff000000, 0xff000000, 0xce003131, 0x5500aaaa, 0x5400abab, 0xd6002929, 0x5500aaaa, 0xff000000,
+    0xfc020202, 0xfc020202, 0xdc022222, 0xac025252, 0x8c027272, 0xbc024242, 0xcc023232, 0xfc020202,
+    0x3f404040, 0x27405858, 0x2b405454, 0x2a405555, 0x26405959, 0x2a405555, 0x2b405454, 0x3f404040,
+    0xff000000, 0xff000000, 0x76008989, 0xad005252, 0x2400dbdb, 0xf5000a0a, 0x2e00d1d1, 0xff000000,
+    0xff000000, 0xff000000, 0xea001515, 0x5a00a5a5, 0x5a00a5a5, 0xda002525, 0x5d00a2a2, 0xff000000,
+    0x3f404040, 0x3c404343, 0x3e404141, 0x3e404141, 0x3e404141, 0x3e404141, 0x3e404141, 0x3f404040,
+    0xff000000, 0x7f008080, 0xdb002424, 0xab005454, 0xaa005555, 0xaa005555, 0xdd002222, 0xff000000,
+    0xff000000, 0xff000000, 0xb7004848, 0xaa005555, 0xa2005d5d, 0xae005151, 0x72008d8d, 0xff000000,
+    0xfc020202, 0xfc020202, 0x7c028282, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202,
+    0x3f404040, 0x3c404343, 0x3b404444, 0x38404747, 0x3e404141, 0x3e404141, 0x39404646, 0x3f404040,
+    0xff000000, 0xfb000404, 0xdb002424, 0xa9005656, 0xba004545, 0xaa005555, 0xda002525, 0xff000000,
+    0xff000000, 0xff000000, 0xdd002222, 0xaa005555, 0xaa005555, 0xaa005555, 0xdd002222, 0xff000000,
+    0xfc020202, 0xbc024242, 0xbc024242, 0xbc024242, 0xbc024242, 0xbc024242, 0xbc024242, 0xfc020202,
+    0xff000000, 0x77008888, 0x76008989, 0x5500aaaa, 0x5500aaaa, 0xad005252, 0xae005151, 0xff000000,
+    0xff000000, 0xdf002020, 0x73008c8c, 0x5500aaaa, 0x5500aaaa, 0x5500aaaa, 0x5500aaaa, 0xff000000,
+    0x3f404040, 0x3e404141, 0x3e404141, 0x3e404141, 0x3e404141, 0x3e404141, 0x3e404141, 0x3f404040,
+    0xff000000, 0x3f00c0c0, 0xec001313, 0x5500aaaa, 0xc5003a3a, 0xdd002222, 0xe5001a1a, 0xff000000,
+    0xff000000, 0xff000000, 0xee001111, 0x5500aaaa, 0x5c00a3a3, 0x5500aaaa, 0x6e009191, 0xff000000,
+    0xfc020202, 0xfc020202, 0xfc020202, 0x7c028282, 0x7c028282, 0xfc020202, 0x7c028282, 0xfc020202,
+    0xff000000, 0xc7003838, 0xdd002222, 0xca003535, 0xda002525, 0xda002525, 0xdd002222, 0xff000000,
+    0xff000000, 0xf7000808, 0xd3002c2c, 0xb7004848, 0xb7004848, 0xb7004848, 0xbb004444, 0xff000000,
+    0x3f404040, 0x27405858, 0x2b405454, 0x26405959, 0x2a405555, 0x2a405555, 0x27405858, 0x3f404040,
+    0xff000000, 0xef001010, 0x2e00d1d1, 0xa6005959, 0xaa005555, 0xaa005555, 0x2700d8d8, 0xff000000,
+    0xff000000, 0xef001010, 0xad005252, 0xaa005555, 0xaa005555, 0xaa005555, 0x2d00d2d2, 0xbf004040,
+    0xfc020202, 0xfc020202, 0x9c026262, 0xac025252, 0xac025252, 0xac025252, 0xac025252, 0xfc020202,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xe01f1f00,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x0ff0f000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xc03f0f0d, 0xc03f1f1d,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x7c828282, 0x3c82c2c2,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xfe010101, 0xfc030303, 0xf8070707, 0xf00f0f0f,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x7f808080, 0x3f40c0c0, 0x1fa0e0e0, 0x0f50f0f0,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404041, 0x3f404041,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff0000ff, 0xff00fe01,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x7c028282,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000001,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff0000ff,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3c404043, 0x3c434342,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x000000ff, 0x00fffff7,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x000000ff, 0x00ffffbd,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x7c020282, 0x3c82c2c2,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3e414140,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x66999900,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x7c828202,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3e404041,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000304, 0xff000205, 0x7f000285,
+    0x7f008080, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff00c020, 0xef009070, 0xef009070,
+    0x3f404040, 0x3f404040, 0x3c434340, 0x3c434343, 0x3c434343, 0x3e404141, 0x3f404040, 0x3f404040,
+    0xff000000, 0xff000000, 0x00ffff00, 0x00ffffde, 0x00ffffde, 0x0000ffff, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0x00ffff00, 0x00fffff7, 0x00fffff7, 0x0000ffff, 0xff000000, 0xff000000,
+    0xfc020202, 0xfc020202, 0x7c828202, 0x3c82c2c2, 0x3c82c2c2, 0x3c02c2c2, 0xfc020202, 0xfc020202,
+    0x3f404040, 0x3f404040, 0x3c434043, 0x3c434340, 0x3c434340, 0x3c434340, 0x3e404141, 0x3f404040,
+    0xff000000, 0xff000000, 0x00ff00ff, 0x00ffde21, 0x00ffde21, 0x00ffde21, 0x0000ffff, 0xff000000,
+    0xff000000, 0xff000000, 0x00ff00ff, 0x00fff708, 0x00fff708, 0x00fff708, 0x0000ffff, 0xff000000,
+    0xfc020202, 0xfc020202, 0x7c820282, 0x3c82c242, 0x3c82c242, 0x3c82c242, 0x3c02c2c2, 0xfc020202,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3c434340, 0x3c434343, 0x3c434343,
+    0xe01f1f1e, 0xe01f1f1e, 0x00ffff00, 0x00fffff7, 0x00fffff7, 0x00ffff00, 0x00ffffde, 0x00ffffde,
+    0x07f0f8f8, 0x07f0f8f8, 0x03fcfc00, 0x01fcfebe, 0x01fcfebe, 0x00ffff00, 0x00fffff7, 0x00fffff7,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x7c828202, 0x3c82c2c2, 0x3c82c2c2,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3c434340, 0x3c434343,
+    0xff000000, 0xff000000, 0xfe010100, 0xf00f0300, 0x00ffcfc7, 0x00ffafa7, 0x00ffff00, 0x00ffffde,
+    0x00ff9f00, 0x00ff5f57, 0x00fffff7, 0x00ffff00, 0x00ffffbd, 0x00ffffbd, 0x00ffff00, 0x00fffff7,
+    0x3c82c242, 0x3c82c2c2, 0x3c82c2c2, 0x3c82c242, 0x3c82c2c2, 0x3c82c2c2, 0x3c82c242, 0x3c82c2c2,
+    0xf00f0f00, 0xf00e0f00, 0xf00e0f00, 0xf00e0f00, 0xf00f0f00, 0xf00f0f00, 0xf00f0f00, 0xf00f0f00,
+    0x07f0e818, 0x0770d828, 0x0770e818, 0x0770d828, 0x07f0e818, 0x07f0d828, 0x07f0e818, 0x07f0d828,
+    0x3f404041, 0x3f404041, 0x3f404041, 0x3f404041, 0x3f404041, 0x3f404041, 0x3f404041, 0x3f404041,
+    0xff00926d, 0xff00fe01, 0xff008a75, 0xff00fe01, 0xff008679, 0xff00fe01, 0xff00827d, 0xff00fe01,
+    0xff008a75, 0xff00fe01, 0xff00926d, 0xff00fe01, 0xff00be41, 0xff00fe01, 0xff00fe01, 0xff00fe01,
+    0x7c028282, 0x7c028282, 0x7c028282, 0x7c028282, 0x7c028282, 0x7c028282, 0x7c028282, 0x7c028282,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404047, 0x3c404343,
+    0xff000102, 0xff000102, 0xff000102, 0xff000102, 0xff00001f, 0xf3000cef, 0x8e007172, 0x7c008380,
+    0xff00ff00, 0xff00ff00, 0xff0055aa, 0xff0055aa, 0xff0000ff, 0xff0000ff, 0xfe0001fe, 0x0000ff7c,
+    0xfc020282, 0xbc0242c2, 0xbc0242c2, 0xbc0242c2, 0xbc0242c2, 0xbc0242c2, 0xbc0242c2, 0x3c02c242,
+    0x3c434342, 0x3c434340, 0x3c434343, 0x3c434343, 0x3c434340, 0x3c434342, 0x3c434342, 0x3c434340,
+    0x00fffff7, 0x00ffff00, 0x00ffffde, 0x00ffffde, 0x00ffff00, 0x00fffff7, 0x00fffff7, 0x00ffff00,
+    0x00ffffbd, 0x00ffff00, 0x00fffff7, 0x00fffff7, 0x00ffff00, 0x00ffffbd, 0x00ffffbd, 0x00ffff00,
+    0x3c82c2c2, 0x3c82c242, 0x3c82c2c2, 0x3c82c2c2, 0x3c82c242, 0x3c82c2c2, 0x3c82c2c2, 0x3c82c242,
+    0x3e414041, 0x3e414140, 0x3e414140, 0x3e414041, 0x3e414140, 0x3e414140, 0x3e414041, 0x3e414140,
+    0x229944dd, 0x00ffdd22, 0x00cefd02, 0x00ce31ce, 0x00ce7788, 0x00ff7788, 0x00ff00ff, 0x00ffdd22,
+    0x229944dd, 0x00ffdd22, 0x0073dd22, 0x00738c73, 0x0073ff00, 0x00ff7788, 0x00ff00ff, 0x00ffdd22,
+    0x3c8242c2, 0x3c82c242, 0x3c82c242, 0x3c8242c2, 0x3c8242c2, 0x3c8242c2, 0x3c8242c2, 0x3c82c242,
+    0x3c404043, 0x3f434043, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0x1f0003e4, 0x3f2001e6, 0xffc001c6, 0xff000304, 0xff000205, 0xff000205, 0xff000304, 0xff000106,
+    0xef00d030, 0xef0050b0, 0xef0050b0, 0xef00d030, 0xee009071, 0xef019071, 0xef00d030, 0xef0050b0,
+    0xfc020202, 0xfc020202, 0xfc020202, 0x9c020262, 0x0c0202f2, 0x3c3202f2, 0xfcc202c2, 0xfc020202,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x3f00c0c0,
+    0x3e404141, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x9f006060,
+    0x3c02c2c2, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202,
+    0x3c434343, 0x3e404141, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0x00ffffde, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xf7000808,
+    0x00fffff7, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xbf004040,
+    0x3c82c2c2, 0x3c02c2c2, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x3c02c2c2,
+    0xf00f0f00, 0xf00f0f00, 0xf00f0f00, 0xf8000707, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0x07f0e818, 0x07f0d828, 0x07f0e818, 0x0700f8f8, 0xff000000, 0xff000000, 0xff000000, 0x1f00e0e0,
+    0x3f404041, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0xff0000ff, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xfb000404,
+    0xff0000ff, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xbf004040, 0x5f00e0a0,
+    0x7c028282, 0x7c028282, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202,
+    0xfe000100, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xef001010,
+    0x3e00c1c0, 0x7f008080, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x7e008181,
+    0x3c02c2c2, 0x7c028282, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0x7c028282,
+    0x3c434343, 0x3c434343, 0x3e404141, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0x00ffffde, 0x00ffffde, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xfc000303,
+    0x00fffff7, 0x00fffff7, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xcf003030,
+    0x3c82c2c2, 0x3c82c2c2, 0x3c02c2c2, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202,
+    0x3e414140, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040,
+    0x00ffdd22, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xfc000303,
+    0x00ffdd22, 0x0000ffff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xcf003030,
+    0x3c82c242, 0x3c02c2c2, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202,
+    0xff000106, 0xff000304, 0xfc000303, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xfc000303,
+    0xef0050b0, 0xef00d030, 0x0f00f0f0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xcf003030,
+    0x3f404040, 0x3f404040, 0x3f404040, 0x3f404040, 0x1f202020, 0x001f1f1f, 0x00000000, 0x00000000,
+    0xfb000404, 0xf1000e0e, 0xfb000404, 0xff000000, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xdf002020, 0xbf004040, 0xdf002020, 0x3f00c0c0, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xfc020202, 0xfc020202, 0xfc020202, 0xfc020202, 0xf8040404, 0x00f8f8f8, 0x00000000, 0x00000000,
+    0xdf002020, 0x1f00e0e0, 0x7f008080, 0x1f00e0e0, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x7f008080, 0x1f00e0e0, 0x5f00a0a0, 0x1f00e0e0, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x3f404040, 0x3c404343, 0x3f404040, 0x3f404040, 0x1f202020, 0x001f1f1f, 0x00000000, 0x00000000,
+    0xe7001818, 0x5700a8a8, 0xc6003939, 0xf6000909, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xbb004444, 0x71008e8e, 0xfb000404, 0xff000000, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x5c02a2a2, 0xbc024242, 0x5c02a2a2, 0x9c026262, 0xf8040404, 0x00f8f8f8, 0x00000000, 0x00000000,
+    0x7f008080, 0x1f00e0e0, 0xdf002020, 0x3f00c0c0, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xf4000f0b, 0xee001f11, 0xf5000e0a, 0xfa000505, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xdf00e020, 0x5f00e0a0, 0x5f00e0a0, 0xef00f010, 0x1f00e0e0, 0x00ffffff, 0x00000000, 0x00000000,
+    0x3f404040, 0x38404747, 0x3f404040, 0x3f404040, 0x1f202020, 0x001f1f1f, 0x00000000, 0x00000000,
+    0xcf003030, 0xae005151, 0x8d007272, 0xed001212, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x76008989, 0xe3001c1c, 0xf6000909, 0xff000000, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xbc024242, 0x7c028282, 0xbc024242, 0x3c02c2c2, 0xf8040404, 0x00f8f8f8, 0x00000000, 0x00000000,
+    0xef001010, 0xc4003b3b, 0xed001212, 0xfc000303, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x77008888, 0x4700b8b8, 0xdf002020, 0x4700b8b8, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x5700a8a8, 0x5700a8a8, 0xd7002828, 0x67009898, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0xef001010, 0xc6003939, 0xef001010, 0xfc000303, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x77008888, 0xc7003838, 0x5f00a0a0, 0xc7003838, 0xff000000, 0x00ffffff, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x001f0000, 0x1f201f1f, 0x3e403e3f, 0x30413d32, 0x39443b3d, 0x3548373d,
+    0x00000000, 0x00000000, 0x00ff0000, 0x7f007fff, 0x7f80ff7f, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0x00000000, 0x00000000, 0x00ff0000, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0x00000000, 0x00000000, 0x00f80000, 0xd804f8d8, 0x9c02fc9c, 0xdc02fcdc, 0xdc02fcdc, 0x8c02fc8c,
+    0x00000000, 0x00000000, 0x00f80000, 0x9804f898, 0xec02fcec, 0x8c02fc8c, 0xbc02fcbc, 0x8c02fc8c,
+    0x00000000, 0x00000000, 0x00f80000, 0xe804f8e8, 0xcc02fccc, 0xac02fcac, 0x8c02fc8c, 0xec02fcec,
+    0x00000000, 0x00000000, 0x00f80000, 0x9804f898, 0xac02fcac, 0xdc02fcdc, 0xac02fcac, 0xcc02fccc,
+    0x00000000, 0x00000000, 0x00ff0000, 0xfd00fffd, 0xf900fff9, 0xfd00fffd, 0xfd00fffd, 0xf800fff8,
+    0x00000000, 0x00000000, 0x00f80000, 0x9804f898, 0xac02fcac, 0xac02fcac, 0xac02fcac, 0xcc02fccc,
+    0x00000000, 0x00000000, 0x00f80000, 0x8804f888, 0xbc02fcbc, 0x8c02fc8c, 0xec02fcec, 0x9c02fc9c,
+    0x00000000, 0x00000000, 0x00ff0000, 0xf900fff9, 0xfe00fffe, 0xf800fff8, 0xfb00fffb, 0xf800fff8,
+    0x3f403f3f, 0x3d403f3f, 0x3a403f3f, 0x38403f3f, 0x3a403f3f, 0x3a403f3f, 0x3a403f3f, 0x3f403f3f,
+    0xff00ffff, 0xff00ffff, 0xdb00ffff, 0xb500ffff, 0xb700ffff, 0xb500ffff, 0xbb00ffff, 0xff00ffff,
+    0xff00ffff, 0x7f00ffff, 0x7b00ffff, 0x3500ffff, 0x5100ffff, 0x5700ffff, 0x5900ffff, 0xff00ffff,
+    0xfc02fcfc, 0xfc02fcfc, 0xbc02fcfc, 0x7c02fcfc, 0x7c02fcfc, 0x7c02fcfc, 0x7c02fcfc, 0xfc02fcfc,
+    0x3f403f3f, 0x3d403f3f, 0x3d403f3f, 0x3c403f3f, 0x3d403f3f, 0x3d403f3f, 0x3d403f3f, 0x3f403f3f,
+    0xff00ffff, 0x7d00ffff, 0x4f00ffff, 0xd500ffff, 0x5500ffff, 0x5500ffff, 0x5500ffff, 0xff00ffff,
+    0xff00ffff, 0xf700ffff, 0x9700ffff, 0x5300ffff, 0x5500ffff, 0x5500ffff, 0x9500ffff, 0xdf00ffff,
+    0xfc02fcfc, 0x7c02fcfc, 0x3c02fcfc, 0x7c02fcfc, 0x7c02fcfc, 0x7c02fcfc, 0xbc02fcfc, 0xfc02fcfc,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f,
+    0xff00ffff, 0x3700ffff, 0x5f00ffff, 0x5600ffff, 0x3500ffff, 0x5500ffff, 0x5600ffff, 0xff00ffff,
+    0xff00ffff, 0x7f00ffff, 0x6e00ffff, 0x5500ffff, 0x4500ffff, 0x5d00ffff, 0x6500ffff, 0xff00ffff,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc,
+    0x3f403f3f, 0x33403f3f, 0x35403f3f, 0x35403f3f, 0x33403f3f, 0x37403f3f, 0x37403f3f, 0x3f403f3f,
+    0xff00ffff, 0x7d00ffff, 0x6400ffff, 0x5500ffff, 0x5500ffff, 0x5500ffff, 0x6600ffff, 0xff00ffff,
+    0xff00ffff, 0xff00ffff, 0xdd00ffff, 0xaa00ffff, 0xaa00ffff, 0xaa00ffff, 0xdd00ffff, 0xff00ffff,
+    0xfc02fcfc, 0xfc02fcfc, 0x9c02fcfc, 0xac02fcfc, 0xac02fcfc, 0xac02fcfc, 0xac02fcfc, 0xfc02fcfc,
+    0x3f403f3f, 0x33403f3f, 0x35403f3f, 0x35403f3f, 0x33403f3f, 0x35403f3f, 0x35403f3f, 0x3f403f3f,
+    0xff00ffff, 0xff00ffff, 0xbb00ffff, 0x5500ffff, 0x1700ffff, 0x7500ffff, 0x9b00ffff, 0xff00ffff,
+    0xff00ffff, 0xfe00ffff, 0xab00ffff, 0x6a00ffff, 0x6a00ffff, 0x6a00ffff, 0x7200ffff, 0xff00ffff,
+    0xfc02fcfc, 0xbc02fcfc, 0x9c02fcfc, 0xbc02fcfc, 0xbc02fcfc, 0xbc02fcfc, 0xdc02fcfc, 0xfc02fcfc,
+    0xff00ffff, 0xb700ffff, 0x9300ffff, 0xb600ffff, 0xb600ffff, 0xb600ffff, 0xdb00ffff, 0xff00ffff,
+    0xff00ffff, 0xfe00ffff, 0x3600ffff, 0xaa00ffff, 0xae00ffff, 0xaa00ffff, 0x3600ffff, 0xff00ffff,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xbc02fcfc, 0x7c02fcfc, 0xbc02fcfc, 0xbc02fcfc, 0xfc02fcfc,
+    0x3f403f3f, 0x27403f3f, 0x1e403f3f, 0x05403f3f, 0x35403f3f, 0x35403f3f, 0x0e403f3f, 0x3f403f3f,
+    0xff00ffff, 0xdf00ffff, 0x5e00ffff, 0x4d00ffff, 0x5500ffff, 0x5500ffff, 0x4e00ffff, 0xff00ffff,
+    0xff00ffff, 0xdf00ffff, 0xcd00ffff, 0x5a00ffff, 0x5800ffff, 0x5b00ffff, 0xec00ffff, 0xff00ffff,
+    0xfc02fcfc, 0xfc02fcfc, 0xac00fefe, 0xa802fcfc, 0xa802fcfc, 0xa802fcfc, 0xc802fcfc, 0xfc02fcfc,
+    0xff00ffff, 0x1700ffff, 0xb700ffff, 0xb300ffff, 0xb500ffff, 0xb500ffff, 0xb500ffff, 0xff00ffff,
+    0xff00ffff, 0x7e00ffff, 0xed00ffff, 0x5400ffff, 0x4500ffff, 0x5d00ffff, 0x6500ffff, 0xff00ffff,
+    0xff00ffff, 0x9f00ffff, 0x7700ffff, 0x1500ffff, 0xd500ffff, 0xda00ffff, 0x3a00ffff, 0xff00ffff,
+    0xff00ffff, 0xfd00ffff, 0x6400ffff, 0x5500ffff, 0x5500ffff, 0xd500ffff, 0xe600ffff, 0xff00ffff,
+    0x3f403f3f, 0x27403f3f, 0x2b403f3f, 0x26403f3f, 0x2a403f3f, 0x2a403f3f, 0x27403f3f, 0x3f403f3f,
+    0xff00ffff, 0xff00ffff, 0x2700ffff, 0xaa00ffff, 0xaa00ffff, 0xab00ffff, 0x2a00ffff, 0xff00ffff,
+    0xff00ffff, 0xdf00ffff, 0x5e00ffff, 0xcd00ffff, 0x5400ffff, 0x5500ffff, 0xd600ffff, 0xff00ffff,
+    0xfc02fcfc, 0xfc02fcfc, 0xec02fcfc, 0x5402fcfc, 0x4402fcfc, 0xdc02fcfc, 0x6402fcfc, 0xfc02fcfc,
+    0xff00ffff, 0xff00ffff, 0xff00f7ff, 0xf700f3ff, 0xf304f1fb, 0xeb04eafb, 0xe708e7f7, 0xe708e7f7,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xf80078ff, 0xb8473fb8,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x7c82fc7c, 0x3cc23cbc,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0xbf00ffff, 0xff00ffff, 0xff00ffff, 0xfc00fcff, 0xf801f9fe, 0xf003f3fc, 0xe007e6f8, 0xc00fccf0,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x7c827c7c, 0x7c827c7c, 0x7c827c7c, 0xfc02fcfc,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00fffe, 0xff00fffc, 0xfc00fffc, 0xfc00fffc, 0xfe00fffe,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ff7f, 0x3e413efe, 0x3d42bd7d, 0x3cc33cfd,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x7c827c7c, 0xbc42bcfc, 0x3cc23cbc, 0x5ca25c5c,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3e, 0x3e403e3f,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ff7f, 0xff00ff3e, 0x1e209e5f,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fc7c, 0xfc02fc3c, 0x1c229c5c,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ff3f,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00fffc,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xef00bfff, 0xc708b7f7, 0xc718a7e7,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff0ffff0, 0xff7fff80,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xffe0ff1f, 0xfffcff03,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x9c02fc9c, 0x0c629c0c,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x803fbfc0, 0x803fbfc0, 0x803fbfc0,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x01fefd03, 0x00fffa04, 0x00fffc02,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xc700ffc7, 0x8300ff83, 0x0100c739, 0x0029aa7c,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xcf30cfff, 0xc33cc3ff,
+    0xd708d7f7, 0xcf10cfef, 0xcf10cfef, 0xcf10cfec, 0xae11aee2, 0xb906b9c9, 0xc708c7f7, 0xe710e7ef,
+    0xfc03bcf3, 0xf807b8ca, 0xe619c626, 0xaf508faf, 0x6f904f6f, 0xff00efff, 0xf708e7f7, 0xf708e7f7,
+    0x3cc23c3c, 0x7c827c7c, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc,
+    0xff00ffff, 0xff00ffff, 0xfe00feff, 0xfc00fcff, 0xd821d9fe, 0x8033c3bc, 0xc01fe6d8, 0xc02fd0ec,
+    0x811e99e1, 0x033c33c3, 0x07786787, 0x0ff0cf0f, 0x1fe09f1f, 0x3fc03f3f, 0x7f807f7f, 0xff00ffff,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3e413e3e, 0x304f3030, 0x38473838, 0x3c433c3e,
+    0xc000ebfc, 0xe11ce3fc, 0xbd40bfbc, 0x9d609f9c, 0x00fe0100, 0x01fe0001, 0x00ff0000, 0x00ff0000,
+    0x0001aa7e, 0x807f8071, 0xb049b077, 0xa059a265, 0x00f90205, 0x807f0080, 0x00ff0001, 0x00ff001f,
+    0xac52acfc, 0x7c827cfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x7c827cfc, 0xfc02fcfc,
+    0x3e403f3e, 0x3f403f3f, 0x2e503f2e, 0x34483f34, 0x38443f38, 0x38423d38, 0x3c423d3c, 0x3e403f3e,
+    0x1e20df1e, 0x1f609f1f, 0x2e10ff2e, 0x7408ff14, 0x6814ef08, 0x6812ed08, 0x0c32cd0c, 0x1ea05f1e,
+    0x1e20df1e, 0x1f609f1f, 0x2e10ff2e, 0x7408ff14, 0x6814ef08, 0x6812ed08, 0x0c32cd0c, 0x3e807f3e,
+    0x1c22dc1c, 0x1c629c1c, 0x3c02fc3c, 0x7c02fc1c, 0x6c12ec0c, 0x6c12ec0c, 0x0c32cc0c, 0x1ca25c1c,
+    0xb840bf8f, 0xec00fcf3, 0xc020e0ff, 0xc830f0ff, 0xc837f7ff, 0xd52aeaff, 0xd52aeaff, 0xe21dddff,
+    0x1e01fef2, 0x310639c9, 0x030007ff, 0x090215fd, 0x890275fd, 0x5502a9fd, 0x5502a9fd, 0x2102ddfd,
+    0x7c827c7c, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc,
+    0xff00ffff, 0xfe00ffff, 0x9c60ff9f, 0x08f1fe0e, 0x8172ed9d, 0xc324dbfb, 0xc708f7f7, 0xff00ff00,
+    0x6f108fef, 0xdf200fdf, 0x97680797, 0xbf4017bf, 0xeb1423eb, 0x9f601b9f, 0xfd0201fd, 0xff00ff00,
+    0x3f403f3f, 0x3f413f3e, 0x3f433f3c, 0x3f433f3c, 0x3f433f3c, 0x3f413f3e, 0x3f403f3f, 0x3f403f3f,
+    0xfdfdfd02, 0xbfbfbf40, 0xf7f7f708, 0xffffff00, 0xdfdfdf20, 0xffffff00, 0xfbfbfb04, 0xff7fff80,
+    0xc7c6c739, 0x8f8f8f70, 0x1b1b1be4, 0x1f1f1fe0, 0x1f1f1fe0, 0x8d8d8d72, 0xc6c7c638, 0xfcfffc00,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc82fc7c, 0xbcc2bc3c, 0xbcc2bc3c, 0x3cc23c3c, 0x7c827c7c, 0xfc02fcfc,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x37403f37, 0x2a443b2a, 0x26483726, 0x30403f30, 0x38473838,
+    0xc000ffc0, 0x8000ff80, 0x0018e700, 0x0830cf08, 0x0000ff00, 0x0000ff00, 0x007e8100, 0x3fc03f3f,
+    0x1c00ff1c, 0x0000ff00, 0x00609f00, 0x3041be30, 0x0001fe00, 0x0003fc00, 0x010ef101, 0x07f80707,
+    0x648a7464, 0x548a7454, 0x6c926c6c, 0x7c827c7c, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc,
+    0x8040ffff, 0x807fffc0, 0x804afff5, 0x8028bfd7, 0x8048fff7, 0x803fbfc0, 0x803fbfc0, 0x803fbfc0,
+    0x0001fefe, 0x00fbfc06, 0x008bfe74, 0x008bfc76, 0x00abfe54, 0x00fffc02, 0x00fffa04, 0x00fffc02,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3e403f3e, 0x3e403f3e, 0x3e403f3e,
+    0x0001827c, 0x0001ba44, 0x0001c638, 0x8003ec90, 0x0100fe01, 0x0100fe01, 0x0000ff00, 0x0000ff00,
+    0xe116a9ef, 0xd8259adb, 0xde205fdf, 0xbe403fbf, 0xbf40bfbf, 0x7f807f7f, 0x7f807f7f, 0x7f807f7f,
+    0xfc02fcfc, 0xfc02fcfc, 0x7c827cfc, 0x3cc23cbc, 0x3c42bcbc, 0x3c42bcbc, 0xbc42bcbc, 0xfc02fcfc,
+    0xf900f9ff, 0xfc02fcfd, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xfe00fffe,
+    0xf708e7f7, 0xf708e7f7, 0x370827f7, 0x974887b7, 0xe718e7e7, 0xff00ffff, 0xff00ffff, 0x7f00ff7f,
+    0x3f403f3f, 0x3f403f3f, 0x3e413e3f, 0x3c423d3e, 0x3e403f3e, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f,
+    0x8146b9c7, 0x008b7480, 0x051ae505, 0x0f30cf0f, 0x1f609f1f, 0x3fc03f3f, 0xff00ffff, 0xfe00fffe,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x7f00ff7f,
+    0x3e413e3e, 0x3d423d3d, 0x3c433c3d, 0x3a453a3b, 0x3d423d3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f,
+    0x00ff00c0, 0x20df20bf, 0x9f609fbf, 0xdf20dfff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0x0ff00f0f, 0x07f80727, 0x13ec1373, 0x39c63939, 0x9c639cff, 0xff00ffff, 0xff00ffff, 0xbf00ffbf,
+    0x3e403f3e, 0x3f403c3f, 0x3e413e3e, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f,
+    0x1ea05f1e, 0x7f801c7f, 0x4eb14e4e, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0x3e807f3e, 0x7f801c7f, 0x4eb14e4e, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x3f00ff3f,
+    0x1ca25c1c, 0x7c821c7c, 0x4cb24c4c, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc,
+    0xe21dedef, 0xf807f8f8, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xfb00fffb,
+    0x210ed1f1, 0x07f80707, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xbf00ffbf, 0x5f00ff1f,
+    0xdf0020df, 0x800ff080, 0xc718e7c7, 0xef10efef, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xfd00fffd,
+    0xfb0004fb, 0x00f10e00, 0xf803fcf8, 0xfd02fdfd, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x9f00ff9f,
+    0x7c827c7c, 0x7c827c7c, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc,
+    0xcf3fcfc0, 0xf807f8f8, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0xe1fee101, 0x0ff00f0f, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xdf00ffdf,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x8f00ff8f,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x7e00ff7e,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x3c02fc3c,
+    0xc03fffc0, 0xe01fffe0, 0xf00ff7f0, 0xfc03fcfc, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xfe00fffe,
+    0x00fff804, 0x01fef901, 0x03fce303, 0x0ff00f0f, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xcf00ffcf,
+    0x0001fe00, 0x8003fc80, 0xc13ec1c1, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xf900fff9,
+    0x7f807f7f, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x9f00ff9f,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x1f201f1f, 0x001f0000, 0x00000000, 0x00000000,
+    0xff00ffff, 0xfe00fffe, 0xfe00fffe, 0xfe00fffe, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xbf00ffbf, 0x3f00ff3f, 0xff00ffff, 0x3f00ff3f, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0xf804f8f8, 0x00f80000, 0x00000000, 0x00000000,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xfe00fffe, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xbf00ffbf, 0x7f00ff7f, 0xbf00ffbf, 0x7f00ff7f, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xff00ffff, 0xfe00fffe, 0xfe00fffe, 0xff00ffff, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0x3f00ff3f, 0xbf00ffbf, 0x3f00ff3f, 0xbf00ffbf, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xfe00fffe, 0xfe00fffe, 0xfe00fffe, 0xfe00fffe, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xff00ffff, 0x3f00ff3f, 0xbf00ffbf, 0x3f00ff3f, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xf400fff0, 0xee00ffe0, 0xf500fff1, 0xfa00fffa, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xdf00ff1f, 0x5f00ff1f, 0x5f00ff1f, 0xef00ff0f, 0x1f00ff1f, 0x00ff0000, 0x00000000, 0x00000000,
+    0xf900fff9, 0xfd00fffd, 0xfd00fffd, 0xf800fff8, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xef00ffef, 0x8f00ff8f, 0xbf00ffbf, 0x8f00ff8f, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xff00ffff, 0xf100fff1, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0x9f00ff9f, 0x5f00ff5f, 0x1f00ff1f, 0xdf00ffdf, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0x3f403f3f, 0x38403f38, 0x3f403f3f, 0x3f403f3f, 0x1f201f1f, 0x001f0000, 0x00000000, 0x00000000,
+    0xbf00ffbf, 0x8e00ff8e, 0xed00ffed, 0x9d00ff9d, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0x7600ff76, 0xe200ffe2, 0xf700fff7, 0xfe00fffe, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xfc02fcfc, 0x3c02fc3c, 0xbc02fcbc, 0x7c02fc7c, 0xf804f8f8, 0x00f80000, 0x00000000, 0x00000000,
+    0xfc00fffc, 0xc600ffc6, 0xfe00fffe, 0xfc00fffc, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xd700ffd7, 0xd700ffd7, 0xd700ffd7, 0x6700ff67, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0xfe00fffe, 0xfd00fffd, 0xfe00fffe, 0xf900fff9, 0xff00ffff, 0x00ff0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x1f1f0000, 0x3737011e, 0x7e7e023d, 0x6d6d053a, 0x7f7f033c, 0x7777013e,
+    0x00000000, 0x00000000, 0xffff0000, 0xdfdf00ff, 0xffff807f, 0xefefc03f, 0xffff807f, 0xdfdf00ff,
+    0x00000000, 0x00000000, 0xffff0000, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff,
+    0x00000000, 0x00000000, 0xf8f80000, 0xecec10e8, 0xcece30cc, 0xaeae50ac, 0x8e8e708c, 0xeeee10ec,
+    0x00000000, 0x00000000, 0xf8f80000, 0x9c9c6098, 0xaeae50ac, 0xdede20dc, 0xaeae50ac, 0xcece30cc,
+    0x00000000, 0x00000000, 0xffff0000, 0xf9f906f9, 0xfefe01fe, 0xf8f807f8, 0xfbfb04fb, 0xf8f807f8,
+    0x00000000, 0x00000000, 0xf8f80000, 0xdcdc20d8, 0x9e9e609c, 0xdede20dc, 0xdede20dc, 0x8e8e708c,
+    0x00000000, 0x00000000, 0xf8f80000, 0x9c9c6098, 0xeeee10ec, 0x8e8e708c, 0xbebe40bc, 0x8e8e708c,
+    0x00000000, 0x00000000, 0xf8f80000, 0x8c8c7088, 0xbebe40bc, 0x8e8e708c, 0xeeee10ec, 0x9e9e609c,
+    0x7f7f003f, 0x7979063f, 0x7777083f, 0x7777083f, 0x7777083f, 0x7777083f, 0x7979063f, 0x7f7f003f,
+    0xffff00ff, 0xffff00ff, 0xb3b34cff, 0x5555aaff, 0x5555aaff, 0x5555aaff, 0xb5b54aff, 0xffff00ff,
+    0xffff00ff, 0x7f7f80ff, 0xd6d629ff, 0x5555aaff, 0x5555aaff, 0x5555aaff, 0x65659aff, 0x7f7f80ff,
+    0xfefe00fc, 0xfefe00fc, 0xdede20fc, 0xaeae50fc, 0x8e8e70fc, 0xbebe40fc, 0xcece30fc, 0xfefe00fc,
+    0x7f7f003f, 0x7f7f003f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7f7f003f, 0x7f7f003f,
+    0xffff00ff, 0x3f3fc0ff, 0xf5f50aff, 0xeded12ff, 0xeded12ff, 0xeded12ff, 0x2e2ed1ff, 0xffff00ff,
+    0xffff00ff, 0xfbfb04ff, 0x6b6b94ff, 0x5959a6ff, 0x4a4ab5ff, 0x6a6a95ff, 0x5a5aa5ff, 0xffff00ff,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc,
+    0x7f7f003f, 0x6767183f, 0x5e5e213f, 0x45453a3f, 0x75750a3f, 0x75750a3f, 0x4e4e313f, 0x7f7f003f,
+    0xffff00ff, 0xffff00ff, 0xeded12ff, 0x5a5aa5ff, 0x5b5ba4ff, 0x5a5aa5ff, 0xdddd22ff, 0xffff00ff,
+    0xffff00ff, 0xffff00ff, 0xdddd22ff, 0xabab54ff, 0x8b8b74ff, 0xbbbb44ff, 0xcbcb34ff, 0xffff00ff,
+    0xfefe00fc, 0xfefe00fc, 0xbaba44fc, 0x5656a8fc, 0x1616e8fc, 0x767688fc, 0x969668fc, 0xfefe00fc,
+    0x7f7f003f, 0x7979063f, 0x7a7a053f, 0x7a7a053f, 0x7a7a053f, 0x7a7a053f, 0x7979063f, 0x7f7f003f,
+    0xffff00ff, 0xffff00ff, 0xd9d926ff, 0xb5b54aff, 0xb5b54aff, 0xb5b54aff, 0xb9b946ff, 0xffff00ff,
+    0xffff00ff, 0xffff00ff, 0x9b9b64ff, 0x5555aaff, 0x5555aaff, 0x5555aaff, 0x9b9b64ff, 0xdfdf20ff,
+    0xfefe00fc, 0xfefe00fc, 0x3e3ec0fc, 0x5e5ea0fc, 0x5e5ea0fc, 0x5e5ea0fc, 0x5e5ea0fc, 0xfefe00fc,
+    0x7f7f003f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7f7f003f,
+    0xffff00ff, 0x6f6f90ff, 0xbaba45ff, 0xaaaa55ff, 0x6d6d92ff, 0xeaea15ff, 0xeaea15ff, 0xffff00ff,
+    0xffff00ff, 0xbfbf40ff, 0xf7f708ff, 0xaaaa55ff, 0xa2a25dff, 0xafaf50ff, 0xb2b24dff, 0xffff00ff,
+    0xfefe00fc, 0xfefe00fc, 0x7e7e80fc, 0xfefe00fc, 0x7e7e80fc, 0x7e7e80fc, 0xfefe00fc, 0xfefe00fc,
+    0xffff00ff, 0x3f3fc0ff, 0xebeb14ff, 0xeaea15ff, 0xeaea15ff, 0xeaea15ff, 0x3232cdff, 0xffff00ff,
+    0xffff00ff, 0xffff00ff, 0x6d6d92ff, 0xdada25ff, 0xc8c837ff, 0xebeb14ff, 0xdcdc23ff, 0xffff00ff,
+    0x7f7f003f, 0x7f7f003f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f, 0x7e7e013f,
+    0xfefe01ff, 0xffff00ff, 0x7d7d82ff, 0xb7b748ff, 0x6d6d92ff, 0xadad52ff, 0xadad52ff, 0x6d6d92ff,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xb7b748ff, 0x5555aaff, 0x73738cff, 0x5555aaff, 0xb5b54aff,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xbebe40fc, 0x7e7e80fc, 0x3e3ec0fc, 0xbebe40fc, 0x7e7e80fc,
+    0xffff00ff, 0xffff00ff, 0x7d7d82ff, 0xb7b748ff, 0x6d6d92ff, 0xadad52ff, 0xadad52ff, 0x6d6d92ff,
+    0x7f7f003f, 0x7f7f003f, 0x5d5d223f, 0x5d5d223f, 0x55552a3f, 0x55552a3f, 0x6b6b143f, 0x6b6b143f,
+    0xfefe01ff, 0xffff00ff, 0xffff00ff, 0xb9b946ff, 0x5555aaff, 0x1515eaff, 0x75758aff, 0x999966ff,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0x3b3bc4ff, 0x5555aaff, 0x5555aaff, 0x5555aaff, 0x3b3bc4ff,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0x3a3ac4fc, 0x5656a8fc, 0x5252acfc, 0x5a5aa4fc, 0x5656a8fc,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xb9b946ff, 0x5555aaff, 0x1515eaff, 0x75758aff, 0x999966ff,
+    0x7f7f003f, 0x7f7f003f, 0x7979063f, 0x7777083f, 0x7777083f, 0x7777083f, 0x7777083f, 0x7979063f,
+    0xfefe01ff, 0xffff00ff, 0xffff00ff, 0xabab54ff, 0x6a6a95ff, 0x6a6a95ff, 0x6b6b94ff, 0x72728dff,
+    0xffff00ff, 0xffff00ff, 0xdfdf20ff, 0x4c4cb3ff, 0xdada25ff, 0x5a5aa5ff, 0x5a5aa5ff, 0xecec13ff,
+    0xfefe00fc, 0xfefe00fc, 0xbebe40fc, 0xb6b648fc, 0xaeae50fc, 0xa6a658fc, 0xb6b648fc, 0xaeae50fc,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xabab54ff, 0x6a6a95ff, 0x6a6a95ff, 0x6b6b94ff, 0x72728dff,
+    0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f,
+    0xffff01fe, 0xffff01fe, 0xffff03fc, 0xffff03fc, 0xffff03fc, 0xffff07f8, 0xfefe06f9, 0xffff0ff0,
+    0xffff00ff, 0xffff80ff, 0xffff807f, 0xffffc07f, 0xffffc03f, 0xffffe03f, 0xffffe01f, 0x7f7f709f,
+    0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x717f0031, 0x707b0430, 0x787d0238,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0x1fff001f,
+    0xbfbf40ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff,
+    0xffff00ff, 0xffff00ff, 0xfeff01ff, 0xfefe01fe, 0xfefe00ff, 0xe6ff00fe, 0xdcef0cfc, 0xdef314fa,
+    0x9fff60ff, 0x2ffff0ff, 0x3fffe8ff, 0xbf3fe03f, 0x3f3f20ff, 0x3f7f20bf, 0x1fff001f, 0x33ef302f,
+    0xffff00ff, 0xffff00ff, 0xfeff01ff, 0xfeff01ff, 0xb6ff49ff, 0xdfff24ff, 0xffff11fe, 0xbffe43fc,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff80ff, 0xdbffa4ff, 0xf7ff9aff, 0xffff847f, 0xfd7fc23f,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xdfdf00ff, 0x777710ff, 0xcfff74ff, 0x8e9f789f, 0x3637f03f,
+    0xffff00ff, 0xffff00ff, 0xfcff00ff, 0xf0ff03fc, 0xc0ff0ff0, 0x00ff3fc0, 0x00ffff00, 0x00ff7c83,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0x7efe00fc, 0x3efe807c, 0x1efec03c, 0x1efe10fc, 0x1efed03c,
+    0xffff00ff, 0xffff00ff, 0xfeff01ff, 0xf8ff06ff, 0xe0ff19fe, 0xc0ff27f8, 0x80ff5fe0, 0x80ff4ff0,
+    0xffff00ff, 0x9fff60ff, 0x0fff90ff, 0x07ff689f, 0x03fff40f, 0x01fffa07, 0x01ffe31f, 0x01ff9b67,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xefef00ff, 0xbbbb08ff, 0xe7ff3aff, 0xc7cf3ccf,
+    0x7f7f80ff, 0x7f7f80ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xfefe00ff, 0xfcfd01fe, 0xf9fb03fd,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0x7e7e00fc, 0x7efec07c, 0xfefec0fc, 0xfefe80fc,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xfeff01ff,
+    0x7f7f80ff, 0x7f7f80ff, 0xffff00ff, 0xefff10ff, 0xc7ef28ff, 0x87df5cef, 0x0fbfbcdf, 0x1f7f78bf,
+    0xfbfb04ff, 0xf7f708ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xefef00ff, 0xbbbb08ff, 0xe7ff3aff,
+    0xffff00ff, 0xffff00ff, 0xfbfb00ff, 0xfbfb02ff, 0x7f7f02ff, 0xbfbf04fb, 0xfbfb2af5, 0xf7f717e8,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xdede00fc, 0xbebe10fc, 0xfefe20fc, 0xfefe00fc,
+    0xfbfb04ff, 0xf7f708ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xfeff01ff, 0xfdff03fe, 0xfafe06fd,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0x7fff80ff, 0xbfffc07f, 0x5f7f60bf, 0xeffff01f,
+    0xffff0ff0, 0xffff0ff0, 0xfefe1ee1, 0xfdfd1de2, 0xf9f919e6, 0xf9f939c6, 0xf9f939c6, 0xdddd5da2,
+    0xfffff00f, 0xfffff80f, 0xfffff80f, 0xfffff807, 0xdfdfdc27, 0xfffffc03, 0xfffffe03, 0xfffffe01,
+    0x7c7f003c, 0x7e7f003e, 0x7e7f003e, 0x7c7f003c, 0x787f0038, 0x707f0030, 0x707f0030, 0x707f0030,
+    0x07ff0007, 0x23df2003, 0x508f7000, 0x508f7000, 0x20df2000, 0x00ff0000, 0x03ff0303, 0x00ff0000,
+    0xffff00ff, 0x0fff000f, 0x0fef180f, 0x0eff090f, 0x3bfc3f3c, 0xfce3ffe3, 0xe798ff98, 0xfce33fe3,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xbefe40fc, 0x5ebee0bc, 0xae5ef05c, 0x5ebef8bc, 0xae5ef05c,
+    0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x737f003f,
+    0xfffb12fe, 0xffff02fe, 0xcfff30fe, 0x97fc78ff, 0x1ffff5ff, 0x5f1ff01f, 0x1f1f10ff, 0x1fbf105f,
+    0xf3f3223f, 0xf3ff223f, 0xfeffa7bf, 0xfc9f83ff, 0xf8ffb7ff, 0xfaf807f8, 0xf8f800ff, 0x98fd00fa,
+    0xfefe00fc, 0xfefe00fc, 0x7efe80fc, 0xbefec0fc, 0xfefea0fc, 0xfefe80fc, 0xfefe80fc, 0xfefe80fc,
+    0x7f7f003f, 0x7f7f003f, 0x7e7f013f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f,
+    0xfffe23fc, 0xfffe0ff0, 0x3ef1dfe1, 0xfef1ffe1, 0xfffe0ff0, 0xbffe47fc, 0xfffe23fc, 0xdffe23fc,
+    0xff7fe13f, 0xff7ff00f, 0x7c8fff87, 0x7f8ffd87, 0xff7ffc0f, 0xfd7ffa3f, 0xff7fe13f, 0xfb7fe43f,
+    0xfefe00fc, 0xfefe00fc, 0x7efe80fc, 0xfefec0fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc,
+    0x7e7e013e, 0x7c7c033c, 0x79790739, 0x73730f33, 0x7f7f063f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f,
+    0x5e5fc47f, 0xfeffd0ff, 0xffff80ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff,
+    0x00ffb34c, 0x00ffcf30, 0x00ff5ca3, 0x83ff13ef, 0xcfff0eff, 0xffff18ff, 0xffff00ff, 0xffffc03f,
+    0x1efed03c, 0x3efe30fc, 0xfefee0fc, 0xfefe80fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc,
+    0x80ff56e9, 0x80ff59e6, 0xc0ff2bf4, 0xe0ff12fd, 0xf0ff09ff, 0xf9ff07ff, 0xffff03ff, 0xffff00ff,
+    0x01ff7b87, 0x03ffe71f, 0x07ff9e7f, 0x1fff7cff, 0x7ffff0ff, 0xffffc0ff, 0xffff00ff, 0xffffc03f,
+    0x7f7f003f, 0x7f7f003f, 0x7e7e013e, 0x7c7c033c, 0x79790739, 0x7f7f033f, 0x7f7f003f, 0x7f7f003f,
+    0x9b9b789f, 0x2f2fe23f, 0x7f7fe87f, 0xffffc0ff, 0xffff80ff, 0xffff00ff, 0xffff00ff, 0xffff00ff,
+    0xf3f707fb, 0x878f6e97, 0xcfef1cef, 0xafef18ef, 0x7fff28ff, 0xffff40ff, 0xffff00ff, 0xffffc03f,
+    0xf0fe0eff, 0xe0f11df2, 0xf0fd0bfd, 0xe0fd17fd, 0xc5ff2fff, 0xefff1dff, 0xffff08ff, 0xffff00ff,
+    0x3ffff07f, 0x7fffe0ff, 0xffffc0ff, 0xffff80ff, 0xffff80ff, 0xffff00ff, 0xffff00ff, 0xffffc03f,
+    0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7e7e013e, 0x7c7c033c, 0x79790739, 0x7f7f033f, 0x7f7f003f,
+    0xc6ce3ccf, 0x9b9b789f, 0x2f2fe23f, 0x7f7fe87f, 0xffffc0ff, 0xffff80ff, 0xffff00ff, 0xffff00ff,
+    0x7f7f3fc0, 0xffffdfe0, 0xffff0ff1, 0xbfbf07fb, 0x7f7f22ff, 0xfbfb40ff, 0xfbfb02ff, 0xffffc23f,
+    0xcece807c, 0xfefed8fc, 0xfefe80fc, 0xbebe00fc, 0xdede00fc, 0xfefe10fc, 0xfefe00fc, 0xfefe00fc,
+    0xf7ff0ff8, 0xfbff07fc, 0xfdff03fe, 0xfeff01ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff,
+    0xf7fff80f, 0xeffffc1f, 0xdffff83f, 0xbffff07f, 0x7fffe0ff, 0xffff40ff, 0xffff00ff, 0xffffc03f,
+    0xfefe7e81, 0xfbfb3bc4, 0xffff1fe0, 0xffff0ff8, 0xffff03ff, 0xffff00ff, 0xffff00ff, 0xffff04fb,
+    0xefefef11, 0xffffff03, 0xfffffe07, 0xfffffc1f, 0xfffff0ff, 0xffff00ff, 0xffff40bf, 0xffbfe01f,
+    0x707f0030, 0x717f0131, 0x737f0333, 0x7f7f063f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f,
+    0x00ff0000, 0xf0fff0f0, 0xfeff06fe, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff06f9,
+    0x3bfc0f3c, 0x0eff030f, 0x0fff080f, 0xfffff8ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff708f,
+    0x5ebef8bc, 0xbefef0fc, 0xfefea0fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc,
+    0x6e77063e, 0x6f790a3d, 0x7f7d093f, 0x7f7f013f, 0x7f7f003f, 0x7f7e003f, 0x7f7f003f, 0x7f7f003f,
+    0x0fff000f, 0x19f71817, 0xf9f9111f, 0xf9ff111f, 0xffff535f, 0xfc4c40fc, 0xffffd8ff, 0xffff03fc,
+    0x70bf30f0, 0x78cf50e8, 0xffef48f8, 0xffff08f8, 0xffff02fa, 0xfff202ff, 0xffff06ff, 0xffff30cf,
+    0x7efe007c, 0xcebec0bc, 0xcece88fc, 0xcefe88fc, 0xfefe98fc, 0xfe7e00fc, 0xfefec0fc, 0xfefe00fc,
+    0xbffe53fc, 0xfffe23fc, 0xffff01fe, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff20df, 0xffdf718e,
+    0xfd7fe23f, 0xff7fe13f, 0xffffe07f, 0xffffc0ff, 0xffff00ff, 0xffff00ff, 0xffff807f, 0xff7fc936,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe807c, 0xfe7ec03c,
+    0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x3f3f001f, 0x1f1f0000, 0x00000000, 0x00000000,
+    0xffff04fb, 0xffff0ef1, 0xffff04fb, 0xffff00ff, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xffffa05f, 0xffff40bf, 0xffffa05f, 0xffff609f, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0xfcfc00f8, 0xf8f80000, 0x00000000, 0x00000000,
+    0xffff00ff, 0xffff0ef1, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xfffb0ff0, 0xfff11fe0, 0xfffb0ef1, 0xffff05fa, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xff3fe01f, 0xffbfe01f, 0xffbfe01f, 0xff1ff00f, 0xffffe01f, 0xffff0000, 0x00000000, 0x00000000,
+    0xffff01fe, 0xffff07f8, 0xffff04fb, 0xffff07f8, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xffff40bf, 0xffff708f, 0xffff10ef, 0xffff609f, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xffff10ef, 0xffff3bc4, 0xffff12ed, 0xffff03fc, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0xffff8877, 0xffffb847, 0xffff20df, 0xffffb847, 0xffff00ff, 0xffff0000, 0x00000000, 0x00000000,
+    0x7f7f0738, 0x7f780f30, 0x7f7f0738, 0x7f7f003f, 0x3f3f001f, 0x1f1f0000, 0x00000000, 0x00000000,
+    0xff9ff10e, 0xffdef30c, 0xffdd7788, 0xff8dff00, 0xffff728d, 0xffff0000, 0x00000000, 0x00000000,
+    0xff76df20, 0xffe3bf40, 0xfff71de2, 0xfffe0bf4, 0xffff01fe, 0xffff0000, 0x00000000, 0x00000000,
+    0xfe7ec03c, 0xfe7ec03c, 0xfe7ec03c, 0xfe3ee01c, 0xfcfcc038, 0xf8f80000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x001f1f1f, 0x1f203f20, 0x3f407f40, 0x3e417f41, 0x3f407f40, 0x3f407f40,
+    0x00000000, 0x00000000, 0x00ffffff, 0xff00ff00, 0x3fc0ffc0, 0xc738ff38, 0x3bc4ffc4, 0xc738ff38,
+    0x00000000, 0x00000000, 0x00ffffff, 0xff00ff00, 0xe718ff18, 0xd926ff26, 0xde21ff21, 0xe11eff1e,
+    0x00000000, 0x00000000, 0x00f8f8f8, 0xf804fc04, 0xfc02fe02, 0xfc02fe02, 0xfc02fe02, 0xfc02fe02,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x3f407f40, 0x3f407f40, 0x3e417f41, 0x3c437f43, 0x3d427f42, 0x3d427f42, 0x3d427f42, 0x3d427f42,
+    0xff00ff00, 0x7f80ff80, 0x3fc0ffc0, 0x1fe0ffe0, 0xdf20ff20, 0x847bff7b, 0xd12eff2e, 0x9f60ff60,
+    0xff00ff00, 0x3ec1ffc1, 0x5ca3ffa3, 0x38c7ffc7, 0x7b84ff84, 0x23dcffdc, 0x8b74ff74, 0xfb04ff04,
+    0xfc02fe02, 0xfc02fe02, 0x7c82fe82, 0x3cc2fec2, 0xbc42fe42, 0x3cc2fec2, 0xbc42fe42, 0x3cc2fec2,
+    0x3d427f42, 0x3d427f42, 0x3d427f42, 0x354a7f4a, 0x3c437f43, 0x37487f48, 0x3d427f42, 0x3f407f40,
+    0xdd22ff22, 0x9d62ff62, 0xdf20ff20, 0x9f60ff60, 0x00ffffff, 0xff00ff00, 0xb649ff49, 0xff00ff00,
+    0xbb44ff44, 0xbb44ff44, 0xfb04ff04, 0xfb04ff04, 0x00ffffff, 0xff00ff00, 0xed12ff12, 0xff00ff00,
+    0xbc42fe42, 0x3cc2fec2, 0xbc42fe42, 0x2cd2fed2, 0x3cc2fec2, 0xec12fe12, 0xbc42fe42, 0xfc02fe02,
+    0x3f407f40, 0x3d427f42, 0x37487f48, 0x3c437f43, 0x344b7f4b, 0x3d427f42, 0x3c437f43, 0x3d427f42,
+    0xff00ff00, 0xb748ff48, 0xff00ff00, 0x00ffffff, 0xdf20ff20, 0xdf20ff20, 0xdd22ff22, 0xdd22ff22,
+    0xff00ff00, 0x6d92ff92, 0xff00ff00, 0x00ffffff, 0xf906ff06, 0xfb04ff04, 0xb946ff46, 0xbb44ff44,
+    0xfc02fe02, 0xbc42fe42, 0xec12fe12, 0x3cc2fec2, 0xac52fe52, 0xbc42fe42, 0xbc42fe42, 0xbc42fe42,
+    0x3c437f43, 0x3d427f42, 0x3c437f43, 0x3d427f42, 0x3c437f43, 0x3e417f41, 0x3f407f40, 0x3f407f40,
+    0xdf20ff20, 0xd12eff2e, 0xc43bff3b, 0xde21ff21, 0x1ce3ffe3, 0x3ac5ffc5, 0x7c83ff83, 0xff00ff00,
+    0xf906ff06, 0x8b74ff74, 0x21deffde, 0xfb04ff04, 0xf807ff07, 0xfc03ff03, 0xfe01ff01, 0xff00ff00,
+    0xbc42fe42, 0xbc42fe42, 0xbc42fe42, 0xbc42fe42, 0x3cc2fec2, 0x7c82fe82, 0xfc02fe02, 0xfc02fe02,
+    0x3f407f40, 0x3f407f40, 0x3f407f40, 0x3f407f40, 0x1f203f20, 0x001f1f1f, 0x00000000, 0x00000000,
+    0x8778ff78, 0x7b84ff84, 0x9b64ff64, 0xe718ff18, 0xff00ff00, 0x00ffffff, 0x00000000, 0x00000000,
+    0xe31cff1c, 0xdc23ff23, 0xe31cff1c, 0xfc03ff03, 0xff00ff00, 0x00ffffff, 0x00000000, 0x00000000,
+    0xfc02fe02, 0xfc02fe02, 0x7c82fe82, 0xfc02fe02, 0xf804fc04, 0x00f8f8f8, 0x00000000, 0x00000000,
+};
@@ -0,0 +1,8 @@
+/*
+ * VDP Pattern data, bank 4
+ */
+
+#define CARDS_PATTERNS_BANK 4
+extern const uint32_t cards_patterns [3672];
+
+#define BANK_4_BYTES 14688
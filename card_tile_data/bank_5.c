@@ -0,0 +1,107 @@
+/*
+ * VDP Pattern data, bank 5
+ */
+
+#include <stdint.h>
+
+const uint32_t cards_discarded_patterns [] = {
+    0x3f404040, 0x3f404040, 0x3f404040, 0x00407f40, 0x00407f40, 0x0c407f40, 0x0a407f40, 0x0a407f40,
+    0xff000000, 0xff000000, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xff000000, 0xff000000, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xfc020202, 0xfc020202, 0xfc020202, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0x3e404141, 0x3f404040, 0x3f404040, 0x00407f40, 0x00407f40, 0x0c407f40, 0x0a407f40, 0x0a407f40,
+    0x0000ffff, 0xff000000, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x0000ffff, 0xff000000, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3c02c2c2, 0xfc020202, 0xfc020202, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0x3c434343, 0x3e404141, 0x3f404040, 0x00407f40, 0x00407f40, 0x0c407f40, 0x0a407f40, 0x0a407f40,
+    0x00ffffde, 0x0000ffff, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x00fffff7, 0x0000ffff, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3c82c2c2, 0x3c02c2c2, 0xfc020202, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0xf00f0f00, 0xf00f0f00, 0xf00f0f00, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x07f0e818, 0x07f0d828, 0x07f0e818, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3f404041, 0x3f404040, 0x3f404040, 0x00407f40, 0x00407f40, 0x0c407f40, 0x0a407f40, 0x0a407f40,
+    0xff0000ff, 0x0000ffff, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xff0000ff, 0x0000ffff, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x7c028282, 0x7c028282, 0xfc020202, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0xfe000100, 0xff000000, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x3e00c1c0, 0x7f008080, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3c02c2c2, 0x7c028282, 0xfc020202, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0x3c434343, 0x3c434343, 0x3e404141, 0x00407f40, 0x00407f40, 0x0c407f40, 0x0a407f40, 0x0a407f40,
+    0x00ffffde, 0x00ffffde, 0x0000ffff, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x00fffff7, 0x00fffff7, 0x0000ffff, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3c82c2c2, 0x3c82c2c2, 0x3c02c2c2, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0x3e414140, 0x3f404040, 0x3f404040, 0x00407f40, 0x00407f40, 0x0c407f40, 0x0a407f40, 0x0a407f40,
+    0x00ffdd22, 0x0000ffff, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x00ffdd22, 0x0000ffff, 0xff000000, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3c82c242, 0x3c02c2c2, 0xfc020202, 0x0002fe02, 0x0002fe02, 0x3002fe02, 0xa802fe02, 0xa802fe02,
+    0xff000106, 0xff000304, 0xfc000303, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xef0050b0, 0xef00d030, 0x0f00f0f0, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x0a407f40, 0x0a407f40, 0x0c407f40, 0x00407f40, 0x00203f20, 0x001f1f1f, 0x00000000, 0x00000000,
+    0x8a00ff00, 0x8a00ff00, 0xb100ff00, 0x0000ff00, 0x0000ff00, 0x00ffffff, 0x00000000, 0x00000000,
+    0x2b00ff00, 0x2a00ff00, 0xaa00ff00, 0x0000ff00, 0x0000ff00, 0x00ffffff, 0x00000000, 0x00000000,
+    0x2802fe02, 0xa802fe02, 0xb002fe02, 0x0002fe02, 0x0004fc04, 0x00f8f8f8, 0x00000000, 0x00000000,
+    0x3f403f3f, 0x3f403f3f, 0x3f403f3f, 0x00403f00, 0x00403f00, 0x0c403f00, 0x0a403f00, 0x0a403f00,
+    0xf900f9ff, 0xfc02fcfd, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xf708e7f7, 0xf708e7f7, 0x370827f7, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xfc02fcfc, 0xfc02fcfc, 0xfc02fcfc, 0x0002fc00, 0x0002fc00, 0x3002fc00, 0xa802fc00, 0xa802fc00,
+    0x3f403f3f, 0x3f403f3f, 0x3e413e3f, 0x00403f00, 0x00403f00, 0x0c403f00, 0x0a403f00, 0x0a403f00,
+    0x8146b9c7, 0x008b7480, 0x051ae505, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3e413e3e, 0x3d423d3d, 0x3c433c3d, 0x00403f00, 0x00403f00, 0x0c403f00, 0x0a403f00, 0x0a403f00,
+    0x00ff00c0, 0x20df20bf, 0x9f609fbf, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x0ff00f0f, 0x07f80727, 0x13ec1373, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x3e403f3e, 0x3f403c3f, 0x3e413e3e, 0x00403f00, 0x00403f00, 0x0c403f00, 0x0a403f00, 0x0a403f00,
+    0x1ea05f1e, 0x7f801c7f, 0x4eb14e4e, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x3e807f3e, 0x7f801c7f, 0x4eb14e4e, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x1ca25c1c, 0x7c821c7c, 0x4cb24c4c, 0x0002fc00, 0x0002fc00, 0x3002fc00, 0xa802fc00, 0xa802fc00,
+    0xe21dedef, 0xf807f8f8, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x210ed1f1, 0x07f80707, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xdf0020df, 0x800ff080, 0xc718e7c7, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xfb0004fb, 0x00f10e00, 0xf803fcf8, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x7c827c7c, 0x7c827c7c, 0xfc02fcfc, 0x0002fc00, 0x0002fc00, 0x3002fc00, 0xa802fc00, 0xa802fc00,
+    0xcf3fcfc0, 0xf807f8f8, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xe1fee101, 0x0ff00f0f, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xc03fffc0, 0xe01fffe0, 0xf00ff7f0, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x00fff804, 0x01fef901, 0x03fce303, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x0001fe00, 0x8003fc80, 0xc13ec1c1, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x7f807f7f, 0xff00ffff, 0xff00ffff, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x0a403f00, 0x0a403f00, 0x0c403f00, 0x00403f00, 0x00201f00, 0x001f0000, 0x00000000, 0x00000000,
+    0x8a00ff00, 0x8a00ff00, 0xb100ff00, 0x0000ff00, 0x0000ff00, 0x00ff0000, 0x00000000, 0x00000000,
+    0x2b00ff00, 0x2a00ff00, 0xaa00ff00, 0x0000ff00, 0x0000ff00, 0x00ff0000, 0x00000000, 0x00000000,
+    0x2802fc00, 0xa802fc00, 0xb002fc00, 0x0002fc00, 0x0004f800, 0x00f80000, 0x00000000, 0x00000000,
+    0x7e7e013e, 0x7c7c033c, 0x79790739, 0x40403f00, 0x40403f00, 0x4c403f00, 0x4a403f00, 0x4a403f00,
+    0x5e5fc47f, 0xfeffd0ff, 0xffff80ff, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x00ffb34c, 0x00ffcf30, 0x00ff5ca3, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x1efed03c, 0x3efe30fc, 0xfefee0fc, 0x0202fc00, 0x0202fc00, 0x3202fc00, 0xaa02fc00, 0xaa02fc00,
+    0x7f7f003f, 0x7f7f003f, 0x7f7f003f, 0x40403f00, 0x40403f00, 0x4c403f00, 0x4a403f00, 0x4a403f00,
+    0x80ff56e9, 0x80ff59e6, 0xc0ff2bf4, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x01ff7b87, 0x03ffe71f, 0x07ff9e7f, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xfefe00fc, 0xfefe00fc, 0xfefe00fc, 0x0202fc00, 0x0202fc00, 0x3202fc00, 0xaa02fc00, 0xaa02fc00,
+    0x7f7f003f, 0x7f7f003f, 0x7e7e013e, 0x40403f00, 0x40403f00, 0x4c403f00, 0x4a403f00, 0x4a403f00,
+    0x9b9b789f, 0x2f2fe23f, 0x7f7fe87f, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xf3f707fb, 0x878f6e97, 0xcfef1cef, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xf0fe0eff, 0xe0f11df2, 0xf0fd0bfd, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x3ffff07f, 0x7fffe0ff, 0xffffc0ff, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xc6ce3ccf, 0x9b9b789f, 0x2f2fe23f, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x7f7f3fc0, 0xffffdfe0, 0xffff0ff1, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xcece807c, 0xfefed8fc, 0xfefe80fc, 0x0202fc00, 0x0202fc00, 0x3202fc00, 0xaa02fc00, 0xaa02fc00,
+    0xf7ff0ff8, 0xfbff07fc, 0xfdff03fe, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xf7fff80f, 0xeffffc1f, 0xdffff83f, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0xfefe7e81, 0xfbfb3bc4, 0xffff1fe0, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xefefef11, 0xffffff03, 0xfffffe07, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x707f0030, 0x717f0131, 0x737f0333, 0x40403f00, 0x40403f00, 0x4c403f00, 0x4a403f00, 0x4a403f00,
+    0x00ff0000, 0xf0fff0f0, 0xfeff06fe, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x3bfc0f3c, 0x0eff030f, 0x0fff080f, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x5ebef8bc, 0xbefef0fc, 0xfefea0fc, 0x0202fc00, 0x0202fc00, 0x3202fc00, 0xaa02fc00, 0xaa02fc00,
+    0x6e77063e, 0x6f790a3d, 0x7f7d093f, 0x40403f00, 0x40403f00, 0x4c403f00, 0x4a403f00, 0x4a403f00,
+    0x0fff000f, 0x19f71817, 0xf9f9111f, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0x70bf30f0, 0x78cf50e8, 0xffef48f8, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x7efe007c, 0xcebec0bc, 0xcece88fc, 0x0202fc00, 0x0202fc00, 0x3202fc00, 0xaa02fc00, 0xaa02fc00,
+    0xbffe53fc, 0xfffe23fc, 0xffff01fe, 0x0000ff00, 0x0000ff00, 0x9900ff00, 0xa200ff00, 0xba00ff00,
+    0xfd7fe23f, 0xff7fe13f, 0xffffe07f, 0x0000ff00, 0x0000ff00, 0x9300ff00, 0x2a00ff00, 0x3a00ff00,
+    0x4a403f00, 0x4a403f00, 0x4c403f00, 0x40403f00, 0x20201f00, 0x1f1f0000, 0x00000000, 0x00000000,
+    0x8a00ff00, 0x8a00ff00, 0xb100ff00, 0x0000ff00, 0x0000ff00, 0xffff0000, 0x00000000, 0x00000000,
+    0x2b00ff00, 0x2a00ff00, 0xaa00ff00, 0x0000ff00, 0x0000ff00, 0xffff0000, 0x00000000, 0x00000000,
+    0x2a02fc00, 0xaa02fc00, 0xb202fc00, 0x0202fc00, 0x0404f800, 0xf8f80000, 0x00000000, 0x00000000,
+};
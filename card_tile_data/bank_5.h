@@ -0,0 +1,8 @@
+/*
+ * VDP Pattern data, bank 5
+ */
+
+#define CARDS_DISCARDED_PATTERNS_BANK 5
+extern const uint32_t cards_discarded_patterns [792];
+
+#define BANK_5_BYTES 3168
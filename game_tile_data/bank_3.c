@@ -0,0 +1,170 @@
+/*
+ * VDP Pattern data, bank 3
+ */
+
+#include <stdint.h>
+
+const uint32_t player_patterns [] = {
+    0xffffff00, 0xc0c0ff3f, 0x80bfc040, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc659, 0x80bfc558,
+    0xffffff00, 0x0000ffff, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff44bb, 0x00ff4a95,
+    0xffffff00, 0x0000ffff, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff6a95, 0x00ff8a40,
+    0xffffff00, 0x0303fffc, 0x01fd0302, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd639a, 0x01fd834a,
+    0x80bfc659, 0x80bfc558, 0x80bfc659, 0x80bfc05c, 0x80bfc05f, 0x80bfc05f, 0x80bfc040, 0xc0c0ff3f,
+    0x00ff4e10, 0x00ff4a90, 0x00ff6a10, 0x00ff00ca, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0x0000ffff,
+    0x00ff8c32, 0x00ff8a31, 0x00ff6a90, 0x00ff00ca, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0x0000ffff,
+    0x01fd43ba, 0x01fd23da, 0x01fdc32a, 0x01fd039a, 0x01fd03fa, 0x01fd03fa, 0x01fd0302, 0x0303fffc,
+    0xffffff00, 0xffffff00, 0xc0ffc000, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f,
+    0xffffff00, 0xffffff00, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffce31, 0x00ffa810,
+    0xffffff00, 0xffffff00, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffc639, 0x00ffa814,
+    0xffffff00, 0xffffff00, 0x03ff0300, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8,
+    0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc000, 0xffffff00,
+    0x00ffcc23, 0x00ffa811, 0x00ffae01, 0x00ff00a8, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0xffffff00,
+    0x00ffa40b, 0x00ffa20d, 0x00ffcc22, 0x00ff0099, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0xffffff00,
+    0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff0300, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xc0ffc000, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc619, 0xc0ffc518,
+    0xffffff00, 0xffffff00, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff44bb, 0x00ff4a95,
+    0xffffff00, 0xffffff00, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff6a95, 0x00ff8a40,
+    0xffffff00, 0xffffff00, 0x03ff0300, 0x03ff03f8, 0x03ff03f8, 0x03ff03f8, 0x03ff6398, 0x03ff8348,
+    0xc0ffc619, 0xc0ffc518, 0xc0ffc619, 0xc0ffc01c, 0xc0ffc01f, 0xc0ffc01f, 0xc0ffc000, 0xffffff00,
+    0x00ff4e10, 0x00ff4a90, 0x00ff6a10, 0x00ff00ca, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0xffffff00,
+    0x00ff8c32, 0x00ff8a31, 0x00ff6a90, 0x00ff00ca, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0xffffff00,
+    0x03ff43b8, 0x03ff23d8, 0x03ffc328, 0x03ff0398, 0x03ff03f8, 0x03ff03f8, 0x03ff0300, 0xffffff00,
+    0xffffff00, 0xc0c0ff3f, 0x80bfc040, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f,
+    0xffffff00, 0x0000ffff, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffce31, 0x00ffa810,
+    0xffffff00, 0x0000ffff, 0x00ff0000, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffc639, 0x00ffa814,
+    0xffffff00, 0x0303fffc, 0x01fd0302, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa,
+    0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc05f, 0x80bfc040, 0xc0c0ff3f,
+    0x00ffcc23, 0x00ffa811, 0x00ffae01, 0x00ff00a8, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0x0000ffff,
+    0x00ffa40b, 0x00ffa20d, 0x00ffcc22, 0x00ff0099, 0x00ff00ff, 0x00ff00ff, 0x00ff0000, 0x0000ffff,
+    0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd03fa, 0x01fd0302, 0x0303fffc,
+};
+
+const uint32_t panel_patterns [] = {
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xc0ffff3f, 0xdfe0e020, 0xdfe0e020, 0xdfe0e020,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x00ffffff, 0xff000000, 0xff000000, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x07fbfbf8, 0xff030304, 0xff030304, 0xff030304,
+    0xdfe0e020, 0xdfe0e020, 0xdfe0e020, 0xdfe0e020, 0xdfe0e020, 0xdfe0e020, 0xdfe0e020, 0xdfe0e020,
+    0xf10e0e0e, 0x807f717f, 0x00ff81ff, 0x00ff81f1, 0x00ff8181, 0x01fe8e8e, 0x8f707070, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff030304, 0xff030304, 0xff030304, 0xff030304, 0xff030304, 0xff030304, 0xff030304, 0xff030304,
+    0xdfe0e020, 0x9fa0e060, 0x9fa0a060, 0x9fa0a060, 0x1f20a0e0, 0x1f2020e0, 0x1f2020e0, 0x1f2020e0,
+    0xff030304, 0xff030304, 0xff030304, 0xff030304, 0xfc000207, 0xfc000007, 0xfc000007, 0xfc000007,
+    0xff000000, 0xff000000, 0xf10e000e, 0x817e007e, 0x817e0070, 0x817e0000, 0x8f700000, 0xff000000,
+    0x1f2020e0, 0x1f2020e0, 0x1f2020e0, 0x1f2020e0, 0x1f2020e0, 0x1f2020e0, 0x1f2020e0, 0x1f2020e0,
+    0xfc000007, 0xfc000007, 0xfc000007, 0xfc000007, 0xfc000007, 0xfc000007, 0xfc000007, 0xfc000007,
+    0xdfe0e020, 0xdfe0e020, 0xdfe0e020, 0xffc0c01f, 0xffc0ff00, 0xffc0ff1f, 0xffc0ff1f, 0xffc0ff1f,
+    0xff000000, 0xff000000, 0xff000000, 0xff0000ff, 0xff00ff00, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0xff030304, 0xff030304, 0xff030304, 0xff0303fc, 0xff03ff04, 0xff07fbf8, 0xff07fbf8, 0xff07fbf8,
+    0x1f2020e0, 0x1f2020e0, 0x1f2020e0, 0x3f0000df, 0x3f003fc0, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf,
+    0xfc000007, 0xfc000007, 0xfc000007, 0xfc0000ff, 0xfc00fc07, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb,
+    0xffc0ff1f, 0xffc0ff1f, 0xffc0ff1f, 0xffc0ff1f, 0xffc0ff1f, 0xffc0ff1f, 0xbf80ff5f, 0xbf80bf5f,
+    0xff00fffd, 0xfd00fdfa, 0xf902f9f6, 0xf304f38d, 0xe708877b, 0xdf20cf97, 0xbf40af17, 0xff00ffaf,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+    0xfc04fafb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb,
+    0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf,
+    0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb,
+    0x3f00bfdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f00bfdf, 0xbf80bf5f,
+    0xff00ffff, 0xfd00fdff, 0xf902f9ff, 0xf304f3ff, 0xe70887ff, 0xdf20cfdf, 0xbf40afbf, 0xff00ffff,
+    0x3f003fdf, 0x3f003fdf, 0x3f003fdf, 0x3f1f20e0, 0x3f3f00ff, 0x3f3f1fff, 0x3f3f1fff, 0x3f3f1fff,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xffff0000, 0xffff00ff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfcfc0003, 0xfcfc04ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff,
+    0xfc04f8fb, 0xfc04f8fb, 0xfc04f8fb, 0xfcfc0203, 0xfcfc07ff, 0xfefafbfd, 0xfefafbfd, 0xfffbfbfc,
+    0x3e3e1eff, 0x3f3f1fff, 0x3f3f1fff, 0x3d3d1dff, 0x3f3f1fff, 0x3f3f1fff, 0x3e3e1eff, 0x3f3f1fff,
+    0xfefeeeff, 0xffffd7ef, 0xefefabd7, 0xdfdf5da3, 0xffffbbc7, 0xffffd7ef, 0xfefeeeff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x7f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff,
+    0x3e3e1eff, 0x3f3f1fff, 0x3f3f1fff, 0x3d3d9dff, 0x3f3fdfff, 0xbfbfdf7f, 0x3e3e9eff, 0x3f3fdfff,
+    0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc,
+    0x3f3f1fff, 0x3f3f1fff, 0x3f3f1fff, 0x3f3f1fff, 0x3e3e1eff, 0x3f3f1fff, 0x3f3f1fff, 0x3f3f1fff,
+    0xffffffff, 0xffffffff, 0x7d7d7def, 0xefefefd7, 0xdededea3, 0xffffffc7, 0x7d7d7def, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffdf3f, 0xffffdf3f, 0xffffdf3f, 0xffffdf3f, 0xfefede3f, 0xffffdf3f, 0xffffdf3f, 0xffffdf3f,
+    0x3f3f1fff, 0x3f3f1fff, 0x3f3f1fff, 0x3f2020ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xff0000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0xfcf8f8ff, 0xfcf8f8ff, 0xfcf8f8ff, 0xfc0000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0xffffdf3f, 0xffffdf3f, 0xffffdf3f, 0xffe0e03f, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xff0000ff, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xfffbfbfc, 0xfffbfbfc, 0xfffbfbfc, 0xff0303fc, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0x0000c0ff, 0xc0c0fc3f, 0xf8f8ff07, 0xfefeff01, 0xc0ffc03f, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020,
+    0x000000ff, 0x000000ff, 0x000000ff, 0x000080ff, 0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000,
+    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000,
+    0x000000ff, 0x000003ff, 0x030307fc, 0x07070ff8, 0x03ff03f8, 0x07fb0304, 0x07fb0304, 0x07fb0304,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xc0ffc03f, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x03ff03f8, 0x07fb0304, 0x07fb0304, 0x07fb0304,
+    0xc0ffc020, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020, 0xc0ffc020,
+    0x00ff00a5, 0x00ff00e7, 0x00ff00ff, 0x00ff00ff, 0x18e700ff, 0x18e700ff, 0x00ff0000, 0x00ff0000,
+    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000,
+    0x07fb0304, 0x07fb0304, 0x07fb0304, 0x07fb0304, 0x07fb0304, 0x07fb0304, 0x07fb0304, 0x07fb0304,
+    0x00ff0000, 0x00ff0000, 0x000000ff, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xc0ffc020, 0xc0ffc020, 0xc0ffc020, 0xdfe0c01f, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0x00ff0000, 0x00ff0000, 0x00ff0000, 0xff0000ff, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0x07fb0304, 0x07fb0304, 0x07fb0304, 0xff0303fc, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+};
+
+const uint32_t castles_patterns [] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00040400, 0x02040400, 0x020c0c00, 0x030c0c00, 0x011e1e00,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x02020202, 0x03030303, 0x03030203, 0x03030203, 0x03030303,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf8f8f8f8, 0xf8f808f8, 0xf8f808f8, 0xf8f8f8f8,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010100,
+    0x00000000, 0x00000000, 0x00000000, 0x00404000, 0x20404000, 0x20c0c000, 0x30c0c000, 0x10e0e000,
+    0x031c1c00, 0x023d3d00, 0x033c3c00, 0x017e7e00, 0x037c7c00, 0x02fdfd00, 0x03fcfc00, 0x01fefe00,
+    0x80000000, 0x80000000, 0xc0000000, 0x40808000, 0xe0000000, 0xa0404000, 0xf0000000, 0x5fafaf0f,
+    0x02020202, 0x02020202, 0x02020202, 0x02020202, 0x02020202, 0x02020202, 0x02020202, 0xffffffff,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff,
+    0x00010100, 0x00030300, 0x00030300, 0x00070700, 0x00070700, 0x000f0f00, 0x000f0f00, 0xf0fffff0,
+    0x38c0c000, 0x28d0d000, 0x3cc0c000, 0x14e8e800, 0x3ec0c000, 0x2ad4d400, 0x3fc0c000, 0x15eaea00,
+    0x6f6f00ff, 0xbfbf01ff, 0x5f5f00ff, 0xbfbf00ff, 0x6f6f00ff, 0xbfbf01ff, 0x5f5f00ff, 0xbfbf00ff,
+    0xffff50ff, 0xffff30ff, 0xffff50ff, 0xffffb0ff, 0xffff50ff, 0xffff30ff, 0xffff50ff, 0xffffb0ff,
+    0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff, 0xffff00ff,
+    0xf6f610ff, 0xfbfb10ff, 0xf5f510ff, 0xfbfb10ff, 0xf6f610ff, 0xfbfb10ff, 0xf5f510ff, 0xfbfb10ff,
+    0xffff05ff, 0xffff13ff, 0xffff05ff, 0xffff0bff, 0xffff05ff, 0xffff13ff, 0xffff05ff, 0xffff0bff,
+    0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x03000000, 0x02010101, 0x02010101, 0x03000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf8000000, 0x08f0f0f0, 0x08f0f0f0, 0xf8000000,
+    0x80000000, 0x80000000, 0xc0000000, 0x40808000, 0xe0000000, 0xa0404000, 0xf0000000, 0x5fa0a000,
+    0x02000000, 0x02000000, 0x02000000, 0x02000000, 0x02000000, 0x02000000, 0x02000000, 0xff000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
+    0x00010100, 0x00030300, 0x00030300, 0x00070700, 0x00070700, 0x000f0f00, 0x000f0f00, 0xf00f0f00,
+    0x006f6fff, 0x01bebefe, 0x005f5fff, 0x00bfbfff, 0x006f6fff, 0x01bebefe, 0x005f5fff, 0x00bfbfff,
+    0x50afafaf, 0x30cfcfcf, 0x50afafaf, 0xb04f4f4f, 0x50afafaf, 0x30cfcfcf, 0x50afafaf, 0xb04f4f4f,
+    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff,
+    0x10e6e6ef, 0x10ebebef, 0x10e5e5ef, 0x10ebebef, 0x10e6e6ef, 0x10ebebef, 0x10e5e5ef, 0x10ebebef,
+    0x05fafafa, 0x13ececec, 0x05fafafa, 0x0bf4f4f4, 0x05fafafa, 0x13ececec, 0x05fafafa, 0x0bf4f4f4,
+};
+
+const uint32_t fence_patterns [] = {
+    0x00000000, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00070007,
+    0x00000000, 0x000000e0, 0x000000e0, 0x000000e0, 0x000000e0, 0x000000e0, 0x000000e0, 0x00e000e0,
+    0xf8ffff00, 0xf8fffc03, 0xf8ffff00, 0xf8fff906, 0xf8ffff00, 0xf8fffc03, 0xf8ffff00, 0xf8fff906,
+    0x1fffff00, 0x1fff3fc0, 0x1fffff00, 0x1fff9f60, 0x1fffff00, 0x1fff3fc0, 0x1fffff00, 0x1fff9f60,
+};
+
+const uint32_t background_patterns [] = {
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0x000080ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000080ff, 0x8080807f,
+    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0x030303fc, 0x030303fc, 0x010101fe, 0x010101fe, 0x010101fe, 0x010101fe, 0x000000ff, 0x000000ff,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x8181c37e, 0x000081ff, 0x000060ff,
+    0xe0e0f01f, 0x8080c07f, 0x8080807f, 0x000080ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0x1f1f3fe0, 0x0f0f1ff0, 0x07070ff8, 0x070707f8, 0x000006ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x3f3f7fc0, 0x0f0f1ff0, 0x07070ff8, 0x070707f8,
+    0x000080ff, 0x8080c07f, 0xc0c0e03f, 0xe0e0f01f, 0xf8f8fc07, 0xf0f0f80f, 0xf0f0f00f, 0xf0f0f00f,
+    0x6060f89f, 0xf8f8fc07, 0xfcfcff03, 0xfefeff01, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0x000070ff, 0x0000fcff, 0x3030fecf, 0xfcfcfe03, 0xfefeff01, 0xfefeff01, 0xffffff00, 0xffffff00,
+    0x000007ff, 0x03031ffc, 0x0f0f3ff0, 0x1f1f3fe0, 0x3f3f7fc0, 0x3f3f7fc0, 0x3f3f7fc0, 0x7f7fff80,
+    0x030387fc, 0x8383e77c, 0xe1e1f31e, 0xf1f1fb0e, 0xf9f9ff06, 0xfdfdff02, 0xfefeff01, 0xfefeff01,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xf0f0f80f, 0xc0c0e03f, 0x8080c07f, 0x8080807f,
+    0xc1c1e13e, 0x8080c07f, 0x8080807f, 0x8080807f, 0x000080ff, 0x000000ff, 0x000000ff, 0x000000ff,
+    0xffffff00, 0x1f1f3fe0, 0x0f0f1ff0, 0x07070ff8, 0x070707f8, 0x070707f8, 0x030307fc, 0x000000ff,
+    0xfcfcfe03, 0xf0f0f80f, 0xf0f0f00f, 0xe0e0f01f, 0xe0e0e01f, 0xe0e0e01f, 0xc0c0e03f, 0x0000c0ff,
+    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000001ff, 0x000003ff, 0x010107fe, 0x010107fe,
+    0x000000ff, 0x000003ff, 0x030307fc, 0x07070ff8, 0x0707cff8, 0xcfcfff30, 0xffffff00, 0xffffff00,
+    0x0000c0ff, 0xc0c0fc3f, 0xf8f8ff07, 0xfefeff01, 0xffffff00, 0xffffff00, 0xffffff00, 0xfefeff01,
+    0x000000ff, 0x000000ff, 0x000000ff, 0x000080ff, 0x0000c0ff, 0x8080c07f, 0x000080ff, 0x0000c0ff,
+    0x010107fe, 0x01013ffe, 0x00007fff, 0x1e1e7fe1, 0x3f3f7fc0, 0x7f7fff80, 0x7f7fff80, 0xffffff00,
+    0xc0c0f03f, 0xf0f0fc0f, 0xf8f8fe07, 0xfcfcfe03, 0xfcfcff03, 0xfefeff01, 0xfefeff01, 0xfefeff01,
+    0x000000ff, 0x000000ff, 0x00001cff, 0x00003eff, 0x1c1c7fe3, 0x3e3e7fc1, 0x7e7eff81, 0x7f7fff80,
+    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000070ff, 0x7070fc8f, 0xfcfcfe03, 0xfefeff01,
+    0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff00ffff,
+};
@@ -0,0 +1,20 @@
+/*
+ * VDP Pattern data, bank 3
+ */
+
+#define PLAYER_PATTERNS_BANK 3
+extern const uint32_t player_patterns [256];
+
+#define PANEL_PATTERNS_BANK 3
+extern const uint32_t panel_patterns [480];
+
+#define CASTLES_PATTERNS_BANK 3
+extern const uint32_t castles_patterns [224];
+
+#define FENCE_PATTERNS_BANK 3
+extern const uint32_t fence_patterns [32];
+
+#define BACKGROUND_PATTERNS_BANK 3
+extern const uint32_t background_patterns [208];
+
+#define BANK_3_BYTES 4800
@@ -0,0 +1,11 @@
+/*
+ * VDP Palette data
+ */
+
+#ifdef TARGET_SMS
+static const uint8_t background_palette [16] = { 0x00, 0x3f, 0x1f, 0x3c, 0x15, 0x2a, 0x03, 0x2b, 0x02, 0x00, 0x2e, 0x19, 0x04, 0x3a, 0x38, 0x25 };
+static const uint8_t sprite_palette [16] = { 0x00, 0x3f, 0x00, 0x02, 0x08, 0x15, 0x2a, 0x03, 0x2b, 0x06, 0x1b, 0x2e, 0x34, 0x3a, 0x21, 0x25 };
+#elif defined (TARGET_GG)
+static const uint16_t background_palette [16] = { 0x0000, 0x0fff, 0x05ff, 0x0ff0, 0x0555, 0x0aaa, 0x000f, 0x0aaf, 0x000a, 0x0000, 0x0afa, 0x05a5, 0x0050, 0x0faa, 0x0fa0, 0x0a55 };
+static const uint16_t sprite_palette [16] = { 0x0000, 0x0fff, 0x0000, 0x000a, 0x00a0, 0x0555, 0x0aaa, 0x000f, 0x0aaf, 0x005a, 0x05af, 0x0afa, 0x0f50, 0x0faa, 0x0a05, 0x0a55 };
+#endif
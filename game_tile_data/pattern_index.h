@@ -0,0 +1,74 @@
+/*
+ * VDP Pattern index data
+ */
+
+const uint16_t player_panels [4] [8] = {
+    { 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007 },
+    { 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f },
+    { 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017 },
+    { 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f }
+};
+
+const uint16_t panel_panels [2] [56] = {
+    { 0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0003, 0x0009, 0x0005, 0x0006,
+      0x000c, 0x000d, 0x000d, 0x000e, 0x0011, 0x0012, 0x0013, 0x0014, 0x0017, 0x0018, 0x0013, 0x0016,
+      0x0019, 0x001a, 0x001a, 0x001b, 0x001d, 0x001e, 0x001f, 0x0020, 0x0023, 0x0024, 0x0025, 0x0020,
+      0x0027, 0x0028, 0x0028, 0x0029, 0x002d, 0x002e, 0x002f, 0x0030, 0x0034, 0x0035, 0x0036, 0x0037,
+      0x0034, 0x0038, 0x0036, 0x0037, 0x0039, 0x003a, 0x003a, 0x003b },
+    { 0x0000, 0x0001, 0x0001, 0x0002, 0x0007, 0x0004, 0x0005, 0x0008, 0x000a, 0x0009, 0x0005, 0x000b,
+      0x000f, 0x000d, 0x000d, 0x0010, 0x0015, 0x0012, 0x0013, 0x0016, 0x0015, 0x0018, 0x0013, 0x0016,
+      0x0019, 0x001a, 0x001a, 0x001c, 0x0021, 0x001e, 0x001f, 0x0022, 0x0026, 0x0024, 0x0025, 0x0022,
+      0x002a, 0x002b, 0x002b, 0x002c, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+      0x0034, 0x0038, 0x0036, 0x0037, 0x0039, 0x003a, 0x003a, 0x003b }
+};
+
+const uint16_t castles_panels [2] [18] = {
+    { 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b,
+      0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010 },
+    { 0x0000, 0x0001, 0x0011, 0x0012, 0x0004, 0x0005, 0x0006, 0x0013, 0x0014, 0x0015, 0x0016, 0x000b,
+      0x0017, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b }
+};
+
+const uint16_t fence_panels [2] [2] = {
+    { 0x0000, 0x0002 },
+    { 0x0001, 0x0003 }
+};
+
+const uint16_t background_indices [432] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0005, 0x0006, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0006, 0x0007,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x000a, 0x000b, 0x000c, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0005, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x000d, 0x000e, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+    0x000f, 0x0010, 0x0006, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+    0x0002, 0x0002, 0x000b, 0x000c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000d,
+    0x0004, 0x0005, 0x0011, 0x0012, 0x0013, 0x0014, 0x0011, 0x0012, 0x0013, 0x0014, 0x0002, 0x0002,
+    0x0011, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+    0x0009, 0x000a, 0x0015, 0x0000, 0x0000, 0x0016, 0x0015, 0x0000, 0x0000, 0x0016, 0x0017, 0x0018,
+    0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000d, 0x000e, 0x000f, 0x0010, 0x0002,
+    0x0006, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+    0x0002, 0x0003, 0x0000, 0x0000, 0x0000, 0x0004, 0x0005, 0x0006, 0x0007, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000d, 0x000e, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+    0x0002, 0x0002, 0x0006, 0x0007, 0x0000, 0x0009, 0x000a, 0x000b, 0x000c, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+    0x0002, 0x0002, 0x0002, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0004, 0x0005, 0x0011, 0x0012, 0x0013, 0x0014, 0x0011, 0x0012, 0x0013,
+    0x0002, 0x0002, 0x0002, 0x0002, 0x000f, 0x0010, 0x0006, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0009, 0x000a, 0x0015, 0x0000, 0x0000, 0x0016, 0x0015, 0x0000, 0x0000,
+    0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x000b, 0x000c, 0x0000, 0x0000, 0x0004, 0x0005,
+    0x0006, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0013, 0x0014, 0x0002, 0x0002, 0x0011, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x000a,
+    0x000b, 0x000c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0016, 0x0017, 0x0018, 0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+   };
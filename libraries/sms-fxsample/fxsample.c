@@ -1,5 +1,9 @@
 #include "fxsample.h"
 
+/* Replayer state (channel counters and pending volume commands), saved
+ * at the end of each segment so that the next segment can continue it. */
+static unsigned char fxsample_state [6];
+
 void initPSG(void *psginit) __naked __z88dk_fastcall {
 
 (void) psginit;
@@ -114,6 +118,10 @@ dec ix ; 10
 LDAIXH ; 8
 ORIXL ; 8
 jp nz,PsgLoop ; 10 -> 36
+;save state for PlaySampleSegment
+ld (_fxsample_state),bc
+ld (_fxsample_state+2),de
+ld (_fxsample_state+4),iy
 ;restore ix
 pop ix
 ;enable interrupts
@@ -150,3 +158,45 @@ ret ; 10
 ; 139
 __endasm;
 }
+
+void PlaySampleSegment (void *segment) __naked __z88dk_fastcall {
+
+(void) segment;
+
+/* ********************************************************************
+Plays one segment of a sample, described by a record of:
+  uint16_t triplets - number of triplets to play
+  void *data        - RLE data, with no length header
+  uint8_t continued - non-zero to continue from the end of the previous segment
+
+This allows a sample to be assembled from segments stored in different
+places, such as data shared between several samples.
+*/
+__asm
+di
+push ix
+ld a, (hl)
+inc hl
+LDIXLA
+ld a, (hl)
+inc hl
+LDIXHA
+ld e, (hl)
+inc hl
+ld d, (hl)
+inc hl
+ld a, (hl)
+ex de,hl
+or a
+jr z,SegmentStart
+ld bc,(_fxsample_state)
+ld de,(_fxsample_state+2)
+ld iy,(_fxsample_state+4)
+jp PsgLoop
+
+SegmentStart:
+ld de,#0x0000
+ld bc,#0x0000
+jp PsgLoop
+__endasm;
+}
@@ -17,5 +17,6 @@
 
 void initPSG(void *psginit) __z88dk_fastcall;
 void PlaySample (void *sample) __z88dk_fastcall;
+void PlaySampleSegment (void *segment) __z88dk_fastcall;
 
 #endif //FX_SAMPLE_H
@@ -0,0 +1,181 @@
+/*
+ * Decompressor for Sneptile's --compress output.
+ * The formats are described in Sneptile's source/compress.c.
+ */
+
+#include <stdint.h>
+#include "SMSlib.h"
+
+#include "unpack.h"
+
+/* The four planes of the pattern being decoded, one after another */
+static uint8_t unpack_planes [32];
+
+
+/*
+ * Decode patterns, writing them to the VDP data port.
+ * The VDP address must already be set. As the planes of each row are
+ * stored together in VRAM, each pattern's planes are decoded into a
+ * small buffer first, then written out a row at a time.
+ *
+ * Timing: Writes are at least 29 cycles apart, so the display may be on.
+ */
+static void unpack_patterns_to_vdp (const uint8_t *src) __naked __z88dk_fastcall
+{
+    (void) src;
+
+__asm
+    ; Pattern count
+    ld c, (hl)
+    inc hl
+    ld b, (hl)
+    inc hl
+
+UnpackPattern:
+    ld a, b
+    or c
+    ret z
+    dec bc
+    push bc
+
+    ; Two bits of mode for each plane, starting with the lowest bits
+    ld c, (hl)
+    inc hl
+    ld de, #_unpack_planes
+    ld b, #4
+
+UnpackPlane:
+    ld a, c
+    and #0x03
+    jr z, UnpackEmpty
+    dec a
+    jr z, UnpackFull
+    dec a
+    jr z, UnpackCopy
+
+    ; Rows, with a bit-mask of which rows repeat the row above
+    push bc
+    ld c, (hl)
+    inc hl
+    ld b, #8
+UnpackRow:
+    srl c
+    jr c, UnpackRepeat
+    ld a, (hl)
+    inc hl
+UnpackRepeat:
+    ld (de), a
+    inc de
+    djnz UnpackRow
+    pop bc
+    jr UnpackNextPlane
+
+UnpackEmpty:
+    xor a
+    jr UnpackFill
+UnpackFull:
+    ld a, #0xff
+UnpackFill:
+    push bc
+    ld b, #8
+UnpackFillRow:
+    ld (de), a
+    inc de
+    djnz UnpackFillRow
+    pop bc
+    jr UnpackNextPlane
+
+    ; Same as the previous plane
+UnpackCopy:
+    push bc
+    push hl
+    ld h, d
+    ld l, e
+    ld bc, #-8
+    add hl, bc
+    ld bc, #8
+    ldir
+    pop hl
+    pop bc
+
+UnpackNextPlane:
+    srl c
+    srl c
+    djnz UnpackPlane
+
+    ; Write the four planes of each row together
+    push hl
+    ld hl, #_unpack_planes
+    ld de, #8
+    ld b, #8
+UnpackWriteRow:
+    push hl
+    ld a, (hl)
+    out (#0xbe), a
+    add hl, de
+    ld a, (hl)
+    out (#0xbe), a
+    add hl, de
+    ld a, (hl)
+    out (#0xbe), a
+    add hl, de
+    ld a, (hl)
+    out (#0xbe), a
+    pop hl
+    inc hl
+    djnz UnpackWriteRow
+    pop hl
+
+    pop bc
+    jr UnpackPattern
+__endasm;
+}
+
+
+/*
+ * Decompress patterns into VRAM, starting at the given pattern.
+ * The VDP address is set once, and the patterns are written
+ * to the data port as they are decoded.
+ */
+void unpack_patterns (const uint8_t *src, uint16_t first_pattern)
+{
+    SMS_setAddr (0x4000 | (first_pattern << 5));
+    unpack_patterns_to_vdp (src);
+}
+
+
+/*
+ * Decompress a table of name-table entries into RAM, adding an offset to each entry.
+ */
+void unpack_indices (const uint8_t *src, uint16_t *dest, uint16_t offset)
+{
+    uint8_t control;
+
+    while ((control = *src++) != 0x00)
+    {
+        uint8_t length = control & 0x3f;
+
+        if (control & 0xc0)
+        {
+            /* Repeated or incrementing entry */
+            uint16_t value = (src [0] | (src [1] << 8)) + offset;
+            uint16_t step = (control & 0x80) ? 1 : 0;
+            src += 2;
+
+            while (length--)
+            {
+                *dest++ = value;
+                value += step;
+            }
+        }
+        else
+        {
+            /* Literal entries */
+            while (length--)
+            {
+                *dest++ = (src [0] | (src [1] << 8)) + offset;
+                src += 2;
+            }
+        }
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef UNPACK_H
+#define UNPACK_H
+
+/* Decompress patterns from Sneptile's --compress output into VRAM, starting at the given pattern */
+void unpack_patterns (const uint8_t *src, uint16_t first_pattern);
+
+/* Decompress a table of name-table entries into RAM, adding an offset to each entry */
+void unpack_indices (const uint8_t *src, uint16_t *dest, uint16_t offset);
+
+#endif /* UNPACK_H */
@@ -0,0 +1,767 @@
+const uint8_t build_castle_sound [] = {
+    0x8a, 0xf4, 0xf0, 0x09, 0x3a, 0x1b, 0x0a, 0xf4, 0xf0, 0x1b, 0x0c, 0x0b,
+    0x1c, 0x0b, 0x0a, 0x0b, 0x0c, 0x0a, 0x1b, 0x09, 0x18, 0xf4, 0xf0, 0x09,
+    0x0a, 0x09, 0x0a, 0x0b, 0x19, 0x0c, 0x0e, 0x0b, 0x0c, 0x0d, 0x0c, 0x0b,
+    0x0c, 0x0e, 0xf4, 0xf0, 0x0c, 0x0a, 0x1c, 0x1a, 0x0b, 0x09, 0x08, 0x0a,
+    0x0b, 0x0c, 0x0a, 0x0c, 0x0d, 0x1a, 0x94, 0xf0, 0x0e, 0x0c, 0x0b, 0x0c,
+    0x1d, 0x0b, 0x0c, 0x0a, 0x05, 0x07, 0x06, 0x16, 0x07, 0x18, 0x07, 0x06,
+    0x19, 0x25, 0xf0, 0x0b, 0x0a, 0x14, 0x0b, 0x1c, 0x15, 0x1b, 0x04, 0x05,
+    0x09, 0x06, 0x28, 0x05, 0x24, 0x09, 0x2a, 0x13, 0x14, 0x08, 0xf0, 0x09,
+    0x13, 0x1a, 0x14, 0x0b, 0x0a, 0x03, 0x0c, 0x14, 0x09, 0x0a, 0x03, 0x0c,
+    0x02, 0x0f, 0x53, 0x1d, 0x1a, 0x0c, 0x0a, 0xf0, 0x02, 0x0b, 0x03, 0x09,
+    0x44, 0x0a, 0x09, 0x08, 0x19, 0x03, 0x08, 0x02, 0x29, 0x53, 0x18, 0x19,
+    0x12, 0x0c, 0xf0, 0x0f, 0x23, 0x0e, 0x0a, 0x0d, 0x14, 0x0b, 0x0d, 0x03,
+    0x0e, 0x14, 0x0b, 0x0e, 0x23, 0x0f, 0x0d, 0x0c, 0x14, 0x09, 0x08, 0x23,
+    0x19, 0xf0, 0x18, 0x72, 0x19, 0x0c, 0x0e, 0x0c, 0x0a, 0x0e, 0x13, 0x0b,
+    0x0c, 0x04, 0x0e, 0x35, 0x0c, 0x0d, 0x0b, 0x1c, 0xf0, 0x06, 0x19, 0x0b,
+    0x6c, 0x0d, 0x0c, 0x09, 0x08, 0x2a, 0x0b, 0x09, 0x0d, 0x06, 0x0e, 0x05,
+    0x1d, 0x34, 0x1a, 0xf0, 0x09, 0x03, 0x08, 0x02, 0x0a, 0x71, 0x0d, 0x0e,
+    0x0b, 0x0c, 0x3f, 0x02, 0x0b, 0x03, 0x1a, 0x14, 0x0b, 0x06, 0x0a, 0xf0,
+    0x07, 0x09, 0x09, 0x1a, 0x0a, 0x08, 0x0b, 0x07, 0x0c, 0x08, 0x0b, 0x07,
+    0x2c, 0x16, 0x05, 0x0b, 0x04, 0x0a, 0x23, 0x09, 0x18, 0x42, 0x0b, 0x0a,
+    0xf0, 0x0c, 0x28, 0x33, 0x09, 0x0a, 0x39, 0x04, 0x25, 0x0d, 0x07, 0x1b,
+    0x06, 0x15, 0x0a, 0x6c, 0x36, 0xf0, 0x17, 0x06, 0x0d, 0x09, 0x0c, 0x0b,
+    0x0d, 0x18, 0x0c, 0x2d, 0x09, 0x28, 0x2e, 0x0a, 0x07, 0x0b, 0xf0, 0x15,
+    0x2a, 0x04, 0x23, 0x0b, 0x09, 0x0a, 0x02, 0x09, 0x41, 0x08, 0x0c, 0x0b,
+    0x07, 0x08, 0x30, 0x0e, 0x0d, 0x0a, 0x0b, 0x90, 0x21, 0x0c, 0x18, 0x32,
+    0x27, 0x09, 0x03, 0x0c, 0x22, 0x0f, 0x08, 0xf1, 0x07, 0x03, 0x08, 0x05,
+    0x0a, 0x03, 0x0b, 0x14, 0x0c, 0x0a, 0x02, 0x0d, 0x03, 0x0b, 0x15, 0x1c,
+    0x06, 0x0a, 0x0e, 0x0b, 0x0a, 0x0c, 0x06, 0x1b, 0x07, 0x09, 0x0c, 0xf1,
+    0x0b, 0x0b, 0x07, 0x49, 0x06, 0x08, 0x04, 0x03, 0x04, 0x0b, 0x05, 0x09,
+    0x03, 0x08, 0x22, 0x09, 0x08, 0x07, 0x11, 0x0a, 0x0c, 0x02, 0x19, 0x03,
+    0xf1, 0x12, 0x18, 0x03, 0x09, 0x12, 0x0c, 0x1f, 0x03, 0x04, 0x0c, 0x33,
+    0x09, 0x0a, 0x0b, 0x0a, 0x02, 0x08, 0x11, 0x09, 0x0c, 0x40, 0x0f, 0x09,
+    0xf1, 0x0d, 0x0e, 0x0a, 0x41, 0x08, 0x09, 0x18, 0x0b, 0x12, 0x0a, 0x0d,
+    0x03, 0x0a, 0x04, 0x0d, 0x18, 0x0b, 0x0a, 0x07, 0x0b, 0x19, 0x1c, 0xf1,
+    0x06, 0x1d, 0x17, 0x0e, 0x06, 0x0d, 0x04, 0x0c, 0x13, 0x0b, 0x18, 0x02,
+    0x21, 0x0a, 0x0c, 0x18, 0xb0, 0x09, 0x08, 0x07, 0xf1, 0x06, 0x08, 0x07,
+    0x15, 0x17, 0x08, 0x11, 0x07, 0x08, 0x12, 0x07, 0x08, 0x03, 0x19, 0x24,
+    0x0a, 0x09, 0x81, 0x05, 0x0a, 0x17, 0x09, 0x0a, 0x08, 0x0d, 0x0d, 0x0c,
+    0x0a, 0x0a, 0x0d, 0x08, 0x0f, 0x07, 0x0d, 0x1e, 0xf0, 0x0e, 0x0b, 0x0d,
+    0x09, 0x1b, 0x05, 0x04, 0x1c, 0x03, 0x42, 0x0b, 0x19, 0x1b, 0x01, 0x1e,
+    0x02, 0x13, 0x0b, 0x1a, 0x06, 0xf0, 0x29, 0x0b, 0x0a, 0x0b, 0x0b, 0x1d,
+    0x2f, 0x0e, 0x2f, 0x0e, 0x0f, 0x09, 0x0d, 0x07, 0x0b, 0x0b, 0x0a, 0x05,
+    0x09, 0x13, 0x28, 0x02, 0xa0, 0x21, 0x1a, 0x08, 0x80, 0x0b, 0x16, 0x27,
+    0x0c, 0x09, 0xf1, 0x08, 0x01, 0x0a, 0x02, 0x1e, 0x03, 0x07, 0x0b, 0x09,
+    0x0c, 0x08, 0x0d, 0x09, 0x1e, 0x07, 0x0b, 0x0d, 0x0a, 0x0e, 0x06, 0x0d,
+    0x17, 0x0e, 0x0d, 0x04, 0x0c, 0x03, 0x0a, 0x21, 0x14, 0x18, 0x03, 0x0f,
+    0xf0, 0x02, 0x0d, 0x03, 0x0a, 0x04, 0x09, 0x02, 0x0b, 0x03, 0x08, 0x06,
+    0x09, 0x04, 0x1b, 0x02, 0x03, 0x0e, 0x25, 0x0d, 0x1a, 0x0a, 0x0b, 0x0f,
+    0x0c, 0x06, 0x0e, 0x05, 0x0c, 0xf0, 0x09, 0x0d, 0x0b, 0x0b, 0x05, 0x0a,
+    0x04, 0x0b, 0x06, 0x0d, 0x04, 0x0c, 0x02, 0x19, 0x03, 0x04, 0x0a, 0x12,
+    0x09, 0x08, 0x13, 0x09, 0x08, 0x02, 0x19, 0x03, 0x04, 0x0a, 0xf0, 0x03,
+    0x09, 0x02, 0x0b, 0x03, 0x0d, 0x05, 0x0a, 0x14, 0x09, 0x08, 0x07, 0x09,
+    0x06, 0x0a, 0x04, 0x0b, 0x05, 0x1d, 0x19, 0x0c, 0x05, 0x1b, 0x06, 0x08,
+    0x0d, 0x06, 0x0c, 0xf0, 0x04, 0x0d, 0x07, 0x0c, 0x06, 0x0e, 0x14, 0x0b,
+    0x0c, 0x05, 0x0d, 0x04, 0x0e, 0x03, 0x0b, 0x04, 0x0a, 0x05, 0x0b, 0x14,
+    0x0c, 0x09, 0x06, 0x0b, 0x07, 0x0a, 0x14, 0x0b, 0x0e, 0xf0, 0x17, 0x0b,
+    0x0c, 0x06, 0x1b, 0x17, 0x0c, 0x04, 0x4b, 0x03, 0x14, 0x23, 0x0e, 0x0a,
+    0x12, 0x08, 0x1a, 0x13, 0x08, 0xf0, 0x22, 0x0b, 0x0e, 0x1c, 0x11, 0x09,
+    0x12, 0x1b, 0x21, 0x09, 0x0b, 0x1c, 0x10, 0x0e, 0x11, 0x0b, 0x08, 0x50,
+    0x0b, 0x0f, 0xa0, 0x0e, 0x0a, 0x0b, 0x0a, 0x11, 0x18, 0x10, 0x0a, 0x0e,
+    0x21, 0x0b, 0x0c, 0x08, 0x61, 0x13, 0x07, 0x08, 0x02, 0x09, 0x03, 0x0a,
+    0x04, 0x0d, 0x06, 0x0b, 0x19, 0x07, 0xe2, 0x08, 0x0d, 0x19, 0x0e, 0x09,
+    0x0a, 0x0d, 0x0e, 0x0f, 0x0f, 0x1b, 0x0e, 0x0b, 0x08, 0x1a, 0x06, 0x09,
+    0x19, 0x0e, 0x07, 0x08, 0x05, 0x07, 0x04, 0x0d, 0xf1, 0x12, 0x0b, 0x09,
+    0x01, 0x0c, 0x00, 0x0f, 0x11, 0x0c, 0x0a, 0x20, 0x1b, 0x1a, 0x01, 0x12,
+    0x0c, 0x0e, 0x05, 0x0a, 0x06, 0x0b, 0x04, 0x0c, 0x03, 0x4b, 0xd1, 0x14,
+    0x03, 0x04, 0x05, 0x0a, 0x08, 0x0b, 0x0c, 0x0a, 0x0a, 0x19, 0x0d, 0x1a,
+    0x08, 0x17, 0x0c, 0x0f, 0x06, 0x09, 0x1c, 0xf0, 0x06, 0x05, 0x0b, 0x03,
+    0x09, 0x42, 0x0b, 0x09, 0x07, 0x09, 0x07, 0x61, 0x08, 0x0c, 0x1a, 0x0e,
+    0x0a, 0x0e, 0x12, 0x1a, 0xf0, 0x03, 0x0c, 0x04, 0x1e, 0x13, 0x0d, 0x25,
+    0x0b, 0x0a, 0x0c, 0x07, 0x0d, 0x15, 0x0b, 0x1d, 0x06, 0x05, 0x0e, 0x07,
+    0x0c, 0x0b, 0x0a, 0x07, 0x09, 0xf0, 0x09, 0x08, 0x0b, 0x57, 0x26, 0x14,
+    0x03, 0x06, 0x02, 0x27, 0x03, 0x22, 0x06, 0x07, 0xa1, 0x09, 0x07, 0x0b,
+    0xf0, 0x0a, 0x08, 0x0c, 0x09, 0x07, 0x0b, 0x09, 0x1a, 0x12, 0x18, 0x03,
+    0x14, 0x2a, 0x06, 0x09, 0x0b, 0x08, 0x0c, 0x00, 0x1f, 0x16, 0xf1, 0x0a,
+    0x07, 0x0f, 0x18, 0x0a, 0x08, 0x29, 0x0d, 0x08, 0x06, 0x0b, 0x07, 0x0d,
+    0x05, 0x1b, 0x14, 0x0e, 0x03, 0x0d, 0x22, 0x0e, 0x0d, 0x0b, 0xf1, 0x21,
+    0x09, 0x18, 0x20, 0x0d, 0x0f, 0x0e, 0x01, 0x09, 0x12, 0x28, 0x03, 0x05,
+    0x17, 0x06, 0x07, 0x48, 0x06, 0x08, 0x0d, 0x61, 0x16, 0x09, 0x0c, 0x0a,
+    0x09, 0x09, 0x06, 0x08, 0x0e, 0x09, 0x0d, 0x2f, 0xf0, 0x07, 0x09, 0x17,
+    0x0d, 0x0c, 0x05, 0x0d, 0x04, 0x1c, 0x06, 0x04, 0x0a, 0x02, 0x08, 0x13,
+    0x0a, 0x1e, 0x01, 0x02, 0x0a, 0x03, 0x09, 0x22, 0x18, 0xf0, 0x06, 0x03,
+    0x05, 0x05, 0x06, 0x12, 0x07, 0x08, 0x16, 0x0b, 0x09, 0x04, 0x0a, 0x08,
+    0x1c, 0x0d, 0x08, 0x0a, 0x0a, 0x0b, 0x0e, 0x0c, 0x0f, 0x0e, 0x0a, 0x1c,
+    0x06, 0xf0, 0x0c, 0x0e, 0x06, 0x0c, 0x02, 0x0e, 0x04, 0x0d, 0x03, 0x0f,
+    0x51, 0x0e, 0x1f, 0x0c, 0x0a, 0x28, 0x12, 0x11, 0x06, 0x08, 0x03, 0x07,
+    0xf0, 0x11, 0x08, 0x0c, 0x23, 0x0d, 0x08, 0x1a, 0x05, 0x06, 0x0b, 0x07,
+    0x0a, 0x16, 0x0b, 0x0d, 0x0d, 0x0e, 0x09, 0x0d, 0x06, 0x0e, 0x1f, 0x1f,
+    0x05, 0x0d, 0xf0, 0x08, 0x0c, 0x0a, 0x0a, 0x16, 0x09, 0x08, 0x24, 0x09,
+    0x08, 0x27, 0x02, 0x14, 0x08, 0x02, 0x3b, 0x14, 0x12, 0x0c, 0x03, 0x0f,
+    0xf0, 0x12, 0x0c, 0x0b, 0x23, 0x39, 0x12, 0x0a, 0x03, 0x0b, 0x12, 0x0c,
+    0x0b, 0x03, 0x0a, 0x02, 0x0d, 0x23, 0x0a, 0x0b, 0x0e, 0x14, 0x2c, 0xf0,
+    0x03, 0x04, 0x09, 0x06, 0x0b, 0x15, 0x09, 0x0a, 0x08, 0x0b, 0x07, 0x1a,
+    0x06, 0x05, 0x0b, 0x06, 0x0d, 0x08, 0x0c, 0x05, 0x0a, 0x06, 0x0b, 0x08,
+    0x0c, 0x06, 0x0b, 0xf0, 0x04, 0x0e, 0x06, 0x1d, 0x08, 0x26, 0x0c, 0x1e,
+    0x07, 0x0d, 0x06, 0x0b, 0x05, 0x1c, 0x08, 0x07, 0x0b, 0x04, 0x0c, 0x05,
+    0x0d, 0x07, 0x0c, 0x06, 0x0b, 0x04, 0x0a, 0xf0, 0x05, 0x0b, 0x06, 0x0a,
+    0x13, 0x0d, 0x1e, 0x14, 0x0d, 0x12, 0x0e, 0x0d, 0x04, 0x0c, 0x23, 0x0b,
+    0x08, 0x0b, 0x04, 0x09, 0x12, 0x0a, 0x19, 0x14, 0xf0, 0x08, 0x02, 0x0a,
+    0x03, 0x19, 0x04, 0x02, 0x0a, 0x01, 0x0c, 0x02, 0x0f, 0x04, 0x0c, 0x02,
+    0x0b, 0x03, 0x0c, 0x04, 0x19, 0x03, 0x02, 0x08, 0x04, 0x09, 0x08, 0x08,
+    0x14, 0x07, 0xf0, 0x09, 0x15, 0x0b, 0x0a, 0x04, 0x1e, 0x06, 0x19, 0x0d,
+    0x0c, 0x06, 0x0b, 0x09, 0x2a, 0x0c, 0x09, 0x07, 0x0c, 0x08, 0x1b, 0x06,
+    0x04, 0x09, 0x03, 0x08, 0x80, 0x02, 0x0a, 0x01, 0x2e, 0x30, 0x0c, 0x09,
+    0x11, 0x0a, 0x0f, 0x00, 0x0a, 0x01, 0x01, 0x07, 0x12, 0x02, 0x08, 0x03,
+    0x06, 0x43, 0x05, 0x17, 0x06, 0x08, 0x08, 0x0f, 0x0a, 0x0d, 0x0e, 0x22,
+    0x07, 0x0b, 0x0c, 0x09, 0x06, 0x0e, 0x21, 0x03, 0x0a, 0x05, 0x07, 0x03,
+    0x0c, 0xf0, 0x11, 0x0b, 0x08, 0x30, 0x09, 0x17, 0x04, 0x11, 0x03, 0x12,
+    0x30, 0x03, 0x02, 0x11, 0x11, 0x02, 0x00, 0x03, 0x01, 0x04, 0x40, 0x12,
+    0x05, 0x06, 0x04, 0x08, 0x05, 0x0d, 0x06, 0x09, 0x11, 0x0d, 0x0e, 0x08,
+    0x0a, 0x02, 0x0b, 0x09, 0x23, 0x0f, 0x0c, 0x08, 0x0f, 0x1f, 0x0d, 0x04,
+    0x1a, 0x75, 0x08, 0x0d, 0x0c, 0x0f, 0x0b, 0x07, 0x09, 0x0b, 0x07, 0x0d,
+    0x05, 0x08, 0x04, 0x06, 0x03, 0x06, 0x05, 0x02, 0x07, 0x03, 0x21, 0x09,
+    0x02, 0x08, 0x21, 0x07, 0xe0, 0x08, 0x07, 0x40, 0x05, 0x06, 0x08, 0x05,
+    0x18, 0x01, 0x00, 0x09, 0x01, 0x28, 0x12, 0x03, 0x0a, 0x06, 0x0b, 0x0a,
+    0x0e, 0x0c, 0xe1, 0x29, 0x09, 0x07, 0x0e, 0x0b, 0x09, 0x0c, 0x08, 0x0e,
+    0x0f, 0x1f, 0x0d, 0x08, 0x1e, 0x0a, 0x06, 0x0d, 0x07, 0x0e, 0x08, 0x0c,
+    0x06, 0x0b, 0x08, 0x09, 0x05, 0x80, 0x0d, 0x12, 0x1a, 0x03, 0x08, 0x01,
+    0x17, 0x12, 0x06, 0x20, 0x08, 0x0c, 0x51, 0x07, 0x01, 0x18, 0x02, 0x01,
+    0x17, 0x02, 0x04, 0x08, 0x02, 0x12, 0x16, 0x05, 0x08, 0x13, 0x65, 0x07,
+    0x05, 0x04, 0x08, 0x05, 0x04, 0x08, 0x1f, 0x0b, 0x0c, 0x05, 0x0e, 0x14,
+    0x0a, 0x0a, 0x04, 0x0d, 0x23, 0x02, 0x0a, 0x07, 0x08, 0x0a, 0x0a, 0x22,
+    0x13, 0x08, 0x07, 0x02, 0x0b, 0x21, 0x10, 0x07, 0x08, 0x02, 0x0e, 0xf0,
+    0x11, 0x0b, 0x07, 0x00, 0x08, 0x01, 0x26, 0x10, 0x02, 0x18, 0x03, 0x01,
+    0x07, 0x00, 0x0a, 0x12, 0x0b, 0x19, 0x01, 0x14, 0x28, 0x02, 0xf0, 0x01,
+    0x19, 0x02, 0x07, 0x0a, 0x04, 0x19, 0x03, 0x15, 0x0b, 0x29, 0x02, 0x03,
+    0x0a, 0x1a, 0x05, 0x01, 0x1f, 0x02, 0x04, 0x0c, 0x03, 0x1a, 0x02, 0xe0,
+    0x06, 0x0b, 0x09, 0x09, 0x02, 0x2a, 0x03, 0x08, 0x0b, 0x09, 0x04, 0x0a,
+    0x05, 0x0d, 0x0e, 0x0c, 0x13, 0x1a, 0x08, 0x0c, 0x09, 0x0d, 0x13, 0x0e,
+    0x09, 0xf1, 0x0f, 0x0d, 0x04, 0x0c, 0x02, 0x0d, 0x06, 0x0b, 0x05, 0x0a,
+    0x01, 0x1b, 0x00, 0x03, 0x0c, 0x04, 0x09, 0x01, 0x07, 0x03, 0x1b, 0x05,
+    0x02, 0x0d, 0x01, 0x0e, 0x05, 0x0f, 0x0d, 0x0e, 0xf1, 0x14, 0x0a, 0x0b,
+    0x06, 0x0c, 0x04, 0x0a, 0x01, 0x09, 0x02, 0x17, 0x05, 0x02, 0x05, 0x00,
+    0x06, 0x11, 0x07, 0x18, 0x10, 0x17, 0x02, 0x01, 0x16, 0x00, 0xf1, 0x21,
+    0x08, 0x09, 0x07, 0x00, 0x1a, 0x01, 0x10, 0x0c, 0x0a, 0x02, 0x09, 0x23,
+    0x1a, 0x0c, 0x05, 0x0b, 0x06, 0x0a, 0x04, 0x09, 0x08, 0x1a, 0x0f, 0x31,
+    0x1a, 0x08, 0x17, 0x0d, 0x0f, 0x0e, 0xf0, 0x08, 0x0c, 0x0a, 0x0d, 0x09,
+    0x0c, 0x05, 0x0a, 0x24, 0x09, 0x08, 0x0a, 0x03, 0x0b, 0x12, 0x08, 0x0a,
+    0x31, 0x0c, 0x09, 0x0b, 0x0e, 0x32, 0x1b, 0xf0, 0x09, 0x0a, 0x03, 0x0b,
+    0x04, 0x0a, 0x03, 0x0e, 0x15, 0x1f, 0x03, 0x0e, 0x04, 0x0f, 0x05, 0x0e,
+    0x04, 0x0c, 0x43, 0x1a, 0x09, 0x27, 0xf0, 0x04, 0x05, 0x06, 0x12, 0x07,
+    0x08, 0x03, 0x09, 0x02, 0x0a, 0x33, 0x39, 0x02, 0x1a, 0x03, 0x05, 0x0c,
+    0x04, 0x3a, 0x05, 0x0c, 0xf0, 0x16, 0x0b, 0x0a, 0x1d, 0x09, 0x08, 0x0c,
+    0x0b, 0x1b, 0x08, 0x09, 0x0d, 0x06, 0x1c, 0x05, 0x09, 0x0d, 0x06, 0x0c,
+    0x03, 0x0e, 0x14, 0x0a, 0x1b, 0x02, 0xf0, 0x33, 0x0c, 0x0d, 0x39, 0x12,
+    0x03, 0x0b, 0x02, 0x0c, 0x03, 0x19, 0x07, 0x14, 0x08, 0x09, 0x16, 0x1b,
+    0x07, 0x0a, 0x08, 0x0b, 0xf0, 0x07, 0x1c, 0x0a, 0x07, 0x0d, 0x04, 0x1e,
+    0x18, 0x0d, 0x04, 0x3e, 0x16, 0x03, 0x04, 0x1b, 0x03, 0x14, 0x19, 0x12,
+    0x1b, 0xf0, 0x04, 0x0a, 0x13, 0x08, 0x0a, 0x06, 0x0b, 0x04, 0x09, 0x03,
+    0x0e, 0x34, 0x0d, 0x0c, 0x0a, 0x0c, 0x02, 0x0d, 0x04, 0x0b, 0x05, 0x19,
+    0x02, 0x13, 0x18, 0xf0, 0x11, 0x09, 0x1a, 0x03, 0x11, 0x0c, 0x0b, 0x02,
+    0x18, 0x11, 0x0c, 0x32, 0x08, 0x0b, 0x0e, 0x0c, 0x01, 0x1f, 0x23, 0x0d,
+    0x0a, 0xf0, 0x08, 0x4c, 0x0b, 0x06, 0x07, 0x0b, 0x09, 0x1d, 0x08, 0x06,
+    0x0c, 0x0b, 0x0d, 0x06, 0x1e, 0x23, 0x0f, 0x0e, 0x42, 0x0a, 0x1b, 0xf0,
+    0x0f, 0x0a, 0x00, 0x0d, 0x01, 0x0e, 0x02, 0x18, 0x11, 0x0b, 0x03, 0x39,
+    0x12, 0x13, 0x2b, 0x07, 0x06, 0x04, 0x0d, 0x0a, 0x1c, 0xf0, 0x08, 0x04,
+    0x1d, 0x0a, 0x0e, 0x0a, 0x07, 0x09, 0x06, 0x1a, 0x07, 0x26, 0x18, 0x17,
+    0x05, 0x0d, 0x29, 0x03, 0x02, 0x03, 0x1b, 0x12, 0xf0, 0x1c, 0x23, 0x09,
+    0x0b, 0x05, 0x0d, 0x03, 0x0f, 0x05, 0x0e, 0x08, 0x0d, 0x09, 0x0c, 0x17,
+    0x1d, 0x06, 0x0e, 0x0f, 0x1c, 0x07, 0x05, 0x0e, 0x09, 0x0d, 0xb0, 0x04,
+    0x0c, 0x23, 0x09, 0x1b, 0x12, 0x19, 0x01, 0x0d, 0x03, 0x09, 0x01, 0x08,
+    0x00, 0x1c, 0x11, 0x07, 0xf1, 0x00, 0x28, 0x01, 0x02, 0x00, 0x1b, 0x11,
+    0x0c, 0x23, 0x1a, 0x0c, 0x05, 0x0d, 0x06, 0x0c, 0x03, 0x09, 0x05, 0x0b,
+    0x0c, 0x0c, 0x05, 0x2d, 0x08, 0xf1, 0x0e, 0x0a, 0x3c, 0x16, 0x04, 0x09,
+    0x0d, 0x14, 0x0b, 0x1e, 0x08, 0x04, 0x1b, 0x02, 0x03, 0x08, 0x02, 0x07,
+    0x01, 0x06, 0x02, 0x18, 0x01, 0xf1, 0x10, 0x07, 0x06, 0x01, 0x15, 0x00,
+    0x01, 0x06, 0x50, 0x07, 0x05, 0x06, 0x05, 0x07, 0x0a, 0x31, 0x0e, 0x0c,
+    0x0f, 0x0c, 0x13, 0x0e, 0x11, 0x0f, 0x02, 0x0b, 0xc2, 0x14, 0x0c, 0x1d,
+    0x03, 0x05, 0x3c, 0x0d, 0x06, 0x05, 0x06, 0x1b, 0x09, 0x07, 0x0a, 0x06,
+    0x0b, 0x0b, 0x09, 0x0a, 0x0f, 0x61, 0x05, 0x0c, 0x17, 0x1d, 0x03, 0x0b,
+    0x04, 0x0a, 0x05, 0x07, 0x12, 0x0e, 0xf0, 0x0b, 0x03, 0x39, 0x12, 0x21,
+    0x0e, 0x1f, 0x10, 0x0e, 0x02, 0x09, 0x01, 0x07, 0x00, 0x0b, 0x51, 0x0c,
+    0x07, 0x08, 0x0a, 0xf0, 0x0c, 0x0f, 0x12, 0x0a, 0x18, 0x14, 0x0a, 0x03,
+    0x08, 0x05, 0x0b, 0x07, 0x0a, 0x03, 0x0b, 0x05, 0x0c, 0x0e, 0x1d, 0x05,
+    0x07, 0x0c, 0x06, 0x0b, 0x04, 0x4f, 0xf0, 0x05, 0x04, 0x02, 0x03, 0x02,
+    0x0c, 0x01, 0x1a, 0x02, 0x00, 0x0f, 0x01, 0x0c, 0x02, 0x0a, 0x10, 0x0e,
+    0x0f, 0x02, 0x0b, 0x00, 0x0a, 0x01, 0x0e, 0x04, 0x0d, 0xf0, 0x13, 0x09,
+    0x1b, 0x06, 0x04, 0x09, 0x07, 0x0d, 0x0f, 0x0e, 0x07, 0x0b, 0x1f, 0x1e,
+    0x05, 0x0c, 0x07, 0x0d, 0x09, 0x1a, 0x05, 0x08, 0x0d, 0x03, 0x0c, 0x02,
+    0x09, 0xb0, 0x03, 0x17, 0x01, 0x00, 0x08, 0x03, 0x15, 0x01, 0x00, 0x06,
+    0x03, 0x04, 0x01, 0x03, 0x00, 0x04, 0x01, 0x06, 0x10, 0x09, 0x27, 0x51,
+    0x01, 0x00, 0x01, 0x08, 0x02, 0x1c, 0x01, 0x03, 0x08, 0x72, 0x08, 0x09,
+    0x03, 0x0a, 0x06, 0x0b, 0x07, 0x1d, 0x05, 0x0b, 0x0e, 0x0a, 0x0f, 0x06,
+    0x1b, 0xf3, 0x0f, 0x16, 0x0c, 0x1d, 0x0d, 0x04, 0x0b, 0x03, 0x19, 0x04,
+    0x02, 0x07, 0x00, 0x0a, 0x01, 0x09, 0x00, 0x08, 0x11, 0x04, 0x13, 0x00,
+    0x21, 0x02, 0x01, 0x04, 0x50, 0x05, 0x02, 0x26, 0x01, 0x00, 0x11, 0x07,
+    0x08, 0x00, 0xf1, 0x16, 0x01, 0x02, 0x17, 0x01, 0x02, 0x08, 0x14, 0x37,
+    0x15, 0x16, 0x08, 0x19, 0x04, 0x05, 0x0b, 0x0e, 0x1d, 0x0a, 0x07, 0x0e,
+    0x0a, 0x62, 0x0b, 0x0f, 0x0c, 0x04, 0x2b, 0x05, 0x08, 0x06, 0x0a, 0x03,
+    0x08, 0x02, 0x43, 0x17, 0x03, 0x12, 0x06, 0x15, 0x03, 0x04, 0x04, 0x04,
+    0x13, 0x06, 0x23, 0x05, 0x04, 0x06, 0x0f, 0x0a, 0x02, 0x08, 0x0e, 0x21,
+    0x06, 0x0a, 0x1d, 0x08, 0x0e, 0xf0, 0x05, 0x0d, 0x06, 0x0e, 0x0f, 0x0d,
+    0x05, 0x0c, 0x13, 0x0b, 0x0d, 0x04, 0x0a, 0x02, 0x08, 0x01, 0x0a, 0x12,
+    0x09, 0x06, 0x10, 0x07, 0x05, 0x11, 0x07, 0x08, 0x10, 0x06, 0xa0, 0x0b,
+    0x01, 0x0a, 0x10, 0x09, 0x2d, 0x01, 0x32, 0x09, 0x07, 0x0a, 0x01, 0x0f,
+    0x00, 0x08, 0xf1, 0x01, 0x09, 0x02, 0x0a, 0x01, 0x1c, 0x02, 0x05, 0x2e,
+    0x03, 0x02, 0x09, 0x0d, 0x0a, 0x0c, 0x05, 0x0d, 0x04, 0x0f, 0x06, 0x1e,
+    0x04, 0x11, 0x0d, 0x08, 0x02, 0x09, 0xf1, 0x01, 0x07, 0x00, 0x06, 0x12,
+    0x05, 0x44, 0x10, 0x02, 0x01, 0x00, 0x05, 0x01, 0x08, 0x12, 0x19, 0x01,
+    0x0c, 0x03, 0x0e, 0x05, 0x0c, 0x13, 0x0a, 0xf1, 0x0d, 0x0b, 0x2e, 0x0a,
+    0x06, 0x07, 0x0b, 0x0b, 0x0c, 0x0a, 0x0b, 0x04, 0x1a, 0x05, 0x09, 0x0b,
+    0x04, 0x0d, 0x01, 0x0e, 0x12, 0x0f, 0x0b, 0x10, 0x08, 0x07, 0xf1, 0x11,
+    0x09, 0x06, 0x10, 0x07, 0x08, 0x11, 0x09, 0x26, 0x00, 0x02, 0x03, 0x08,
+    0x12, 0x07, 0x0a, 0x06, 0x0c, 0x04, 0x4a, 0x03, 0x05, 0x07, 0xf1, 0x05,
+    0x04, 0x09, 0x06, 0x0b, 0x09, 0x19, 0x03, 0x04, 0x0b, 0x0c, 0x0a, 0x05,
+    0x08, 0x03, 0x29, 0x06, 0x07, 0x03, 0x08, 0x14, 0x0a, 0x0b, 0x03, 0x0a,
+    0x02, 0x0d, 0xf1, 0x01, 0x08, 0x12, 0x09, 0x08, 0x00, 0x09, 0x01, 0x0b,
+    0x02, 0x0e, 0x01, 0x0a, 0x00, 0x0d, 0x12, 0x0f, 0x0b, 0x01, 0x0e, 0x03,
+    0x0b, 0x14, 0x0a, 0x1b, 0x02, 0x03, 0x0a, 0xf1, 0x06, 0x0b, 0x12, 0x18,
+    0x04, 0x0a, 0x02, 0x17, 0x21, 0x09, 0x1e, 0x00, 0x02, 0x0a, 0x01, 0x0d,
+    0x02, 0x19, 0x03, 0x00, 0x08, 0x01, 0x17, 0x03, 0x81, 0x10, 0x06, 0x08,
+    0x04, 0x17, 0x01, 0x00, 0x09, 0x03, 0x0a, 0x04, 0x0d, 0x01, 0x0f, 0x13,
+    0x1a, 0x12, 0x04, 0x08, 0x03, 0x07, 0x35, 0x14, 0x01, 0x0d, 0x15, 0x0f,
+    0x00, 0x04, 0x07, 0x1f, 0x0d, 0x08, 0x0e, 0x47, 0x00, 0x04, 0x06, 0x03,
+    0x03, 0x02, 0x01, 0x01, 0x08, 0xa0, 0x08, 0x03, 0x06, 0x00, 0x04, 0x06,
+    0x05, 0x02, 0x16, 0x00, 0x0e, 0x05, 0x01, 0x13, 0x00, 0x04, 0x04, 0x10,
+    0x45, 0xf1, 0x04, 0x01, 0x12, 0x06, 0x00, 0x07, 0x12, 0x08, 0x09, 0x01,
+    0x3a, 0x05, 0x06, 0x02, 0x07, 0x09, 0x0a, 0x18, 0x02, 0x03, 0x19, 0x04,
+    0xf1, 0x02, 0x08, 0x11, 0x09, 0x17, 0x12, 0x08, 0x01, 0x07, 0x02, 0x0a,
+    0x04, 0x0b, 0x02, 0x09, 0x03, 0x28, 0x0f, 0x07, 0x06, 0x1a, 0x0c, 0x05,
+    0x0c, 0x18, 0xa1, 0x0d, 0x1b, 0x05, 0x1f, 0x0c, 0x0b, 0x04, 0x0a, 0x06,
+    0x1c, 0x08, 0x03, 0x0d, 0x06, 0x1a, 0x0e, 0x07, 0xf0, 0x0e, 0x06, 0x0c,
+    0x04, 0x0b, 0x13, 0x29, 0x01, 0x12, 0x0a, 0x0b, 0x10, 0x28, 0x01, 0x10,
+    0x07, 0x16, 0x01, 0x10, 0x15, 0x01, 0xc0, 0x04, 0x00, 0x05, 0x21, 0x06,
+    0x07, 0x16, 0x03, 0x02, 0x17, 0x01, 0x12, 0x0a, 0x0c, 0x00, 0x1d, 0x01,
+    0x02, 0x0b, 0x01, 0x21, 0x09, 0x06, 0x0a, 0x09, 0x0c, 0x08, 0x92, 0x0b,
+    0x0f, 0x0d, 0x07, 0x0e, 0x05, 0x1f, 0x0f, 0x0e, 0x0e, 0x08, 0x0d, 0x0f,
+    0x0c, 0x04, 0x0a, 0x02, 0x09, 0x03, 0x11, 0x0a, 0x01, 0x09, 0x12, 0xf0,
+    0x1c, 0x30, 0x0b, 0x06, 0x25, 0x11, 0x16, 0x30, 0x08, 0x17, 0x11, 0x0a,
+    0x08, 0x00, 0x27, 0x21, 0x50, 0x09, 0x03, 0x0a, 0x04, 0x1c, 0x05, 0x06,
+    0x0e, 0x04, 0x01, 0x2a, 0x06, 0x02, 0x0f, 0x03, 0x0a, 0x04, 0x09, 0x1f,
+    0x06, 0x08, 0x09, 0x07, 0x04, 0x0a, 0x06, 0x05, 0x0c, 0x05, 0x09, 0x0e,
+    0x14, 0x0c, 0x0a, 0x0e, 0x0c, 0x03, 0x04, 0x0d, 0x12, 0x13, 0x09, 0x0d,
+    0x01, 0x12, 0x0e, 0xb0, 0x0c, 0x04, 0x07, 0x02, 0x04, 0x30, 0x03, 0x05,
+    0x06, 0x03, 0x11, 0x14, 0x20, 0x06, 0x05, 0x02, 0x61, 0x02, 0x04, 0x03,
+    0x05, 0x01, 0x09, 0x03, 0x08, 0x05, 0x0b, 0x13, 0x0f, 0x1e, 0x62, 0x1f,
+    0x1c, 0x08, 0x07, 0x0a, 0x06, 0x09, 0x0f, 0x08, 0x07, 0x0c, 0xa1, 0x06,
+    0x0d, 0x0e, 0x0e, 0x04, 0x0c, 0x01, 0x0b, 0x12, 0x0a, 0x08, 0x21, 0x07,
+    0x09, 0x18, 0x10, 0x0e, 0xf0, 0x01, 0x19, 0x02, 0x11, 0x0b, 0x08, 0x02,
+    0x09, 0x11, 0x0a, 0x08, 0x92, 0x19, 0x08, 0x09, 0x08, 0x09, 0x08, 0x0a,
+    0x09, 0xf0, 0x0a, 0x11, 0x0c, 0x09, 0x02, 0x07, 0x41, 0x18, 0x0a, 0x08,
+    0x07, 0x02, 0x16, 0x33, 0x07, 0x08, 0x0a, 0x24, 0x09, 0x0c, 0x20, 0x0d,
+    0x06, 0x0e, 0x05, 0x08, 0xf1, 0x06, 0x09, 0x09, 0x1a, 0x07, 0x0a, 0x1b,
+    0x0f, 0x09, 0x0c, 0x08, 0x1b, 0x1a, 0x0a, 0x06, 0x19, 0x05, 0x06, 0x08,
+    0x04, 0x07, 0x23, 0x26, 0x31, 0x21, 0x27, 0x10, 0x1e, 0xf0, 0x01, 0x08,
+    0x20, 0x0a, 0x08, 0x0b, 0x01, 0x18, 0x12, 0x1a, 0x04, 0x06, 0x0b, 0x05,
+    0x0d, 0x07, 0x6f, 0x0f, 0x0e, 0x0d, 0x1f, 0xf0, 0x08, 0x19, 0x0e, 0x0c,
+    0x08, 0x2b, 0x06, 0x14, 0x09, 0x03, 0x1b, 0x02, 0x03, 0x38, 0x04, 0x23,
+    0x09, 0x42, 0x0b, 0xf0, 0x08, 0x09, 0x0a, 0x1d, 0x11, 0x0a, 0x02, 0x17,
+    0x41, 0x09, 0x0f, 0x0b, 0x0c, 0x02, 0x09, 0x31, 0x0c, 0x1f, 0xf0, 0x0e,
+    0x52, 0x09, 0x0a, 0x08, 0x0b, 0x1c, 0x24, 0x29, 0x05, 0x0b, 0x14, 0x1c,
+    0x06, 0x1a, 0x25, 0x0c, 0xf0, 0x1a, 0x04, 0x23, 0x0b, 0x19, 0x05, 0x07,
+    0x06, 0x26, 0x04, 0x05, 0x04, 0x05, 0x12, 0x06, 0x07, 0x01, 0x08, 0x40,
+    0x1e, 0x0c, 0x10, 0x0f, 0x09, 0x21, 0x11, 0x0a, 0x0e, 0x02, 0x07, 0x52,
+    0x14, 0x08, 0x0a, 0x08, 0x1b, 0x0f, 0x0a, 0x0e, 0x1e, 0x09, 0x33, 0x0a,
+    0x0f, 0x0d, 0x0e, 0x0f, 0x0f, 0x0e, 0x14, 0x0c, 0x0f, 0x0a, 0x0c, 0x15,
+    0x0f, 0x0b, 0x09, 0x06, 0x06, 0x07, 0x04, 0x27, 0x0a, 0x03, 0x07, 0x02,
+    0x08, 0x01, 0x09, 0x0e, 0x90, 0x0d, 0x05, 0x1a, 0x04, 0x03, 0x08, 0x21,
+    0x07, 0x08, 0x07, 0x00, 0x06, 0x11, 0x05, 0x06, 0x00, 0x31, 0x34, 0x01,
+    0x02, 0x03, 0x06, 0x02, 0x03, 0x15, 0x04, 0x52, 0x05, 0x0e, 0x06, 0x18,
+    0x07, 0x09, 0x0f, 0x0b, 0x0a, 0x0f, 0x41, 0x0c, 0x0e, 0x0d, 0x0c, 0x08,
+    0x08, 0x16, 0x07, 0x0b, 0x90, 0x22, 0x0c, 0x08, 0x15, 0x00, 0x11, 0x14,
+    0x30, 0x03, 0x05, 0x04, 0x12, 0x61, 0x01, 0x10, 0x33, 0x21, 0x04, 0x13,
+    0x03, 0xb2, 0x04, 0x04, 0x15, 0x08, 0x07, 0x06, 0x0c, 0x07, 0x0a, 0x09,
+    0x06, 0x0c, 0x0e, 0x0d, 0x09, 0x1c, 0x06, 0x0d, 0x09, 0x07, 0x0c, 0x51,
+    0x06, 0x09, 0x07, 0x28, 0x05, 0x03, 0x04, 0x07, 0x03, 0x0b, 0xf0, 0x12,
+    0x0f, 0x0e, 0x21, 0x0b, 0x0c, 0x07, 0x00, 0x16, 0x11, 0x15, 0x30, 0x19,
+    0x0e, 0x01, 0x0a, 0x02, 0x08, 0x03, 0x17, 0x04, 0xf0, 0x02, 0x08, 0x03,
+    0x09, 0x05, 0x28, 0x12, 0x03, 0x16, 0x02, 0x13, 0x05, 0x36, 0x02, 0x04,
+    0x03, 0x02, 0x08, 0x03, 0x0b, 0x05, 0x1c, 0x04, 0xf0, 0x06, 0x0e, 0x09,
+    0x0c, 0x07, 0x0d, 0x08, 0x0b, 0x07, 0x0c, 0x0e, 0x4d, 0x0f, 0x08, 0x0a,
+    0x0e, 0x09, 0x1b, 0x0a, 0x09, 0x0c, 0x1f, 0x0f, 0x1c, 0x09, 0xf0, 0x1c,
+    0x1d, 0x05, 0x0c, 0x06, 0x0d, 0x08, 0x1c, 0x15, 0x0b, 0x04, 0x1c, 0x16,
+    0x0b, 0x04, 0x2e, 0x15, 0x13, 0x1f, 0x05, 0x0e, 0xf0, 0x04, 0x0d, 0x23,
+    0x1b, 0x0e, 0x22, 0x0b, 0x09, 0x08, 0x01, 0x09, 0x02, 0x0a, 0x01, 0x0b,
+    0x00, 0x0f, 0x11, 0x0d, 0x0b, 0x00, 0x1d, 0x11, 0x0c, 0xf0, 0x00, 0x0d,
+    0x61, 0x0e, 0x0b, 0x08, 0x0c, 0x08, 0x0a, 0x0e, 0x00, 0x0a, 0x01, 0x0e,
+    0x02, 0x1a, 0x01, 0x02, 0x0c, 0x03, 0x0a, 0x02, 0x0d, 0x03, 0x4f, 0x40,
+    0x14, 0x09, 0x06, 0x05, 0x09, 0xf1, 0x08, 0x0b, 0x06, 0x0a, 0x05, 0x1d,
+    0x0d, 0x08, 0x0c, 0x09, 0x2e, 0x0c, 0x07, 0x0d, 0x1d, 0x0e, 0x09, 0x0b,
+    0x1f, 0x0a, 0x18, 0x06, 0x09, 0x07, 0x08, 0x1c, 0xf0, 0x15, 0x2b, 0x04,
+    0x22, 0x0e, 0x19, 0x11, 0x0e, 0x40, 0x0f, 0x0e, 0x0c, 0x07, 0x0a, 0x01,
+    0x07, 0x00, 0x08, 0x01, 0x06, 0xa0, 0x02, 0x05, 0x11, 0x06, 0x19, 0x12,
+    0x0a, 0x03, 0x0c, 0x15, 0x1a, 0x17, 0x0d, 0x0f, 0x06, 0x08, 0xf1, 0x0a,
+    0x09, 0x0d, 0x0a, 0x06, 0x0c, 0x0b, 0x0b, 0x0c, 0x4a, 0x26, 0x14, 0x0b,
+    0x03, 0x0c, 0x12, 0x09, 0x0b, 0x01, 0x0a, 0x50, 0x0d, 0x0f, 0xf1, 0x0b,
+    0x07, 0x0b, 0x07, 0x21, 0x06, 0x09, 0x47, 0x02, 0x03, 0x02, 0x03, 0x05,
+    0x18, 0x03, 0x04, 0x0a, 0x06, 0x0b, 0x05, 0x2c, 0x51, 0x17, 0x04, 0x1e,
+    0x0e, 0x09, 0x0d, 0x05, 0x09, 0x92, 0x0f, 0x1a, 0x08, 0x04, 0x39, 0x15,
+    0x03, 0x04, 0x0a, 0x02, 0x09, 0x14, 0x07, 0x09, 0xf1, 0x01, 0x28, 0x02,
+    0x04, 0x11, 0x0a, 0x0b, 0x04, 0x29, 0x12, 0x11, 0x0a, 0x08, 0x20, 0x07,
+    0x06, 0x08, 0x01, 0x07, 0x10, 0x06, 0x05, 0xf1, 0x02, 0x07, 0x11, 0x08,
+    0x09, 0x02, 0x38, 0x13, 0x12, 0x1a, 0x05, 0x03, 0x09, 0x02, 0x0b, 0x06,
+    0x0e, 0x0f, 0x0f, 0x15, 0x0e, 0x0c, 0x08, 0x0e, 0x41, 0x05, 0x1d, 0x12,
+    0x0b, 0x0a, 0x09, 0x04, 0x0f, 0xf0, 0x01, 0x0e, 0x03, 0x0c, 0x02, 0x0e,
+    0x00, 0x0a, 0x01, 0x07, 0x02, 0x19, 0x01, 0x10, 0x05, 0x08, 0x11, 0x16,
+    0x00, 0x07, 0x01, 0x0a, 0x03, 0x18, 0x00, 0x01, 0x09, 0x30, 0x04, 0x08,
+    0x02, 0x0a, 0x01, 0x0c, 0x02, 0x07, 0xf1, 0x05, 0x18, 0x03, 0x02, 0x07,
+    0x17, 0x09, 0x18, 0x12, 0x1a, 0x08, 0x05, 0x0b, 0x04, 0x09, 0x06, 0x0b,
+    0x08, 0x0e, 0x0f, 0x0f, 0x03, 0x1e, 0x04, 0x0f, 0x0c, 0xd1, 0x04, 0x0d,
+    0x02, 0x0f, 0x06, 0x0e, 0x0f, 0x1c, 0x13, 0x0b, 0x04, 0x0e, 0x05, 0x0b,
+    0x03, 0x07, 0x01, 0x06, 0x06, 0x05, 0x0c, 0x04, 0x00, 0x03, 0x02, 0x02,
+    0x22, 0x06, 0x41, 0x10, 0x03, 0x02, 0x14, 0x10, 0x40, 0x05, 0x01, 0x06,
+    0x00, 0x07, 0x04, 0x08, 0x02, 0x0c, 0x01, 0x01, 0x0d, 0x0e, 0x22, 0x0a,
+    0x05, 0x09, 0x01, 0x0c, 0x0e, 0x23, 0x0b, 0x02, 0x0a, 0x00, 0x08, 0x04,
+    0x62, 0x0b, 0x03, 0x19, 0x01, 0x02, 0x1a, 0x03, 0x07, 0x0b, 0x03, 0x09,
+    0x00, 0x03, 0x08, 0x0f, 0x05, 0x0b, 0x0e, 0x06, 0x1a, 0x01, 0x07, 0x03,
+    0x19, 0x0b, 0x0f, 0x1a, 0x10, 0x04, 0xf1, 0x0c, 0x04, 0x0d, 0x06, 0x0e,
+    0x11, 0x0b, 0x09, 0x02, 0x0b, 0x01, 0x0e, 0x00, 0x09, 0x02, 0x0a, 0x09,
+    0x1b, 0x02, 0x04, 0x1a, 0x05, 0x17, 0x1c, 0x05, 0x0d, 0x06, 0x71, 0x2e,
+    0x09, 0x03, 0x02, 0x0d, 0x05, 0x0a, 0x04, 0x29, 0x01, 0x03, 0x05, 0xf0,
+    0x0c, 0x02, 0x0a, 0x23, 0x1e, 0x0f, 0x11, 0x0d, 0x0e, 0x02, 0x1d, 0x01,
+    0x00, 0x29, 0x12, 0x00, 0x06, 0x03, 0x07, 0x05, 0x18, 0x02, 0x04, 0x70,
+    0x1a, 0x07, 0x05, 0x09, 0x06, 0x0b, 0x04, 0x0c, 0x09, 0x0d, 0x0d, 0x1e,
+    0x05, 0x04, 0x91, 0x0b, 0x0f, 0x0e, 0x05, 0x0a, 0x03, 0x0b, 0x0d, 0x0a,
+    0x06, 0x19, 0x14, 0x0a, 0x07, 0x19, 0x0b, 0x06, 0xf0, 0x0c, 0x05, 0x1a,
+    0x0e, 0x04, 0x09, 0x02, 0x0d, 0x07, 0x0e, 0x08, 0x0c, 0x02, 0x0f, 0x04,
+    0x0e, 0x05, 0x1c, 0x21, 0x0e, 0x0a, 0x12, 0x0b, 0x0a, 0x01, 0x07, 0x02,
+    0xf0, 0x09, 0x04, 0x38, 0x11, 0x03, 0x02, 0x07, 0x01, 0x09, 0x02, 0x07,
+    0x13, 0x16, 0x02, 0x08, 0x03, 0x0a, 0x0a, 0x0b, 0x05, 0x0a, 0x03, 0x0c,
+    0x0e, 0x0d, 0x0f, 0xf0, 0x1b, 0x04, 0x06, 0x0d, 0x0e, 0x0e, 0x05, 0x0c,
+    0x03, 0x0b, 0x14, 0x09, 0x1a, 0x02, 0x00, 0x0d, 0x01, 0x1a, 0x03, 0x02,
+    0x18, 0x01, 0x12, 0x0a, 0x0b, 0x10, 0xd0, 0x0c, 0x0e, 0x02, 0x0a, 0x03,
+    0x09, 0x12, 0x08, 0x09, 0x06, 0x0b, 0x07, 0x0c, 0x04, 0x0e, 0x06, 0x0d,
+    0x09, 0x3f, 0x05, 0x04, 0x08, 0x0c, 0xf1, 0x0b, 0x07, 0x0c, 0x02, 0x0b,
+    0x21, 0x08, 0x19, 0x00, 0x58, 0x01, 0x03, 0x02, 0x30, 0x0b, 0x0e, 0x02,
+    0x0d, 0x03, 0x08, 0x02, 0x21, 0x07, 0x10, 0x08, 0x0c, 0x01, 0x12, 0x1a,
+    0x23, 0x33, 0x29, 0x01, 0x10, 0x0b, 0x02, 0x0e, 0x01, 0x83, 0x0d, 0x07,
+    0x1c, 0x06, 0x02, 0x0e, 0x21, 0x0b, 0x09, 0x28, 0x03, 0x06, 0x0f, 0x02,
+    0x19, 0x04, 0x31, 0x12, 0x28, 0x21, 0xd0, 0x0e, 0x0b, 0x03, 0x09, 0x06,
+    0x0a, 0x02, 0x09, 0x10, 0x1b, 0x02, 0x09, 0x04, 0x0a, 0x0e, 0x0c, 0x0b,
+    0x0a, 0x01, 0x09, 0x10, 0x08, 0x0a, 0x02, 0x11, 0x09, 0x08, 0x0c, 0x07,
+    0x02, 0x0b, 0x04, 0x23, 0x0c, 0x10, 0x1e, 0x04, 0x08, 0x0c, 0x0f, 0x0f,
+    0x0f, 0x08, 0x0e, 0x0c, 0x03, 0x1c, 0x09, 0x05, 0x07, 0x02, 0x08, 0x26,
+    0x21, 0x45, 0x05, 0x00, 0x24, 0x01, 0x03, 0x04, 0x21, 0x25, 0x03, 0x12,
+    0x02, 0x08, 0x01, 0x11, 0x0f, 0xf0, 0x0b, 0x12, 0x0a, 0x07, 0x00, 0x16,
+    0x01, 0x03, 0x05, 0x21, 0x16, 0x07, 0x20, 0x18, 0x0d, 0x11, 0x1c, 0x20,
+    0x0b, 0x08, 0xb0, 0x0c, 0x11, 0x09, 0x08, 0x12, 0x0b, 0x2a, 0x03, 0x04,
+    0x13, 0x09, 0x0b, 0x26, 0x0d, 0x0f, 0x09, 0x61, 0x0f, 0x1a, 0x0a, 0x09,
+    0x09, 0x18, 0x1a, 0x0e, 0x09, 0x09, 0x1f, 0xf0, 0x06, 0x0b, 0x0e, 0x06,
+    0x0c, 0x04, 0x0a, 0x13, 0x0b, 0x18, 0x31, 0x07, 0x08, 0x0a, 0x02, 0x07,
+    0x01, 0x08, 0x02, 0x0a, 0x03, 0x09, 0x02, 0x0c, 0x03, 0x0b, 0xf0, 0x14,
+    0x0a, 0x0b, 0x06, 0x0c, 0x05, 0x0b, 0x06, 0x0c, 0x0a, 0x2d, 0x09, 0x07,
+    0x0e, 0x1e, 0x0b, 0x17, 0x0b, 0x1a, 0x05, 0x04, 0x0b, 0x03, 0x18, 0x02,
+    0x80, 0x03, 0x09, 0x02, 0x08, 0x90, 0x09, 0x0e, 0x08, 0x06, 0x07, 0x0b,
+    0x07, 0xb1, 0x08, 0x07, 0x1a, 0x11, 0x09, 0x02, 0x0d, 0x06, 0x0c, 0x14,
+    0x2d, 0x16, 0x0e, 0x0a, 0x07, 0x52, 0x1e, 0x08, 0x0a, 0x07, 0x0b, 0x15,
+    0x0c, 0x0e, 0x06, 0x09, 0xf3, 0x07, 0x0b, 0x1f, 0x0e, 0x0f, 0x19, 0x0c,
+    0x0d, 0x0c, 0x1e, 0x08, 0x0d, 0x1f, 0x0f, 0x18, 0x08, 0x05, 0x05, 0x03,
+    0x07, 0x12, 0x05, 0x03, 0x11, 0x01, 0x13, 0x02, 0x20, 0x10, 0x02, 0x21,
+    0x31, 0x11, 0x03, 0xe0, 0x04, 0x30, 0x05, 0x08, 0x0a, 0x0b, 0x02, 0x0c,
+    0x01, 0x07, 0x00, 0x28, 0x02, 0x04, 0x05, 0x0a, 0x1e, 0x1d, 0x07, 0x0e,
+    0x09, 0x07, 0xb1, 0x08, 0x08, 0x09, 0x0b, 0x0f, 0x0f, 0x07, 0x0c, 0x16,
+    0x0d, 0x0e, 0x14, 0x0d, 0x0e, 0x03, 0x0a, 0x02, 0x18, 0x21, 0x0c, 0xf0,
+    0x08, 0x03, 0x1a, 0x04, 0x03, 0x08, 0x12, 0x07, 0x09, 0x03, 0x1a, 0x05,
+    0x04, 0x0e, 0x0a, 0x1d, 0x07, 0x02, 0x0b, 0x03, 0x09, 0x06, 0x18, 0x04,
+    0x02, 0x09, 0x70, 0x03, 0x08, 0x01, 0x0a, 0x10, 0x19, 0x01, 0x1a, 0x14,
+    0x0b, 0x01, 0x08, 0xf1, 0x03, 0x0a, 0x02, 0x0b, 0x01, 0x1c, 0x04, 0x06,
+    0x0e, 0x0a, 0x0d, 0x06, 0x0c, 0x04, 0x1d, 0x16, 0x1b, 0x05, 0x09, 0x2c,
+    0x0d, 0x16, 0x0b, 0x0d, 0x0a, 0x61, 0x06, 0x09, 0x04, 0x17, 0x13, 0x08,
+    0x04, 0x17, 0x22, 0x0e, 0xf0, 0x0b, 0x11, 0x0a, 0x08, 0x02, 0x0a, 0x03,
+    0x08, 0x02, 0x09, 0x31, 0x0d, 0x09, 0x0b, 0x0e, 0x02, 0x1a, 0x03, 0x02,
+    0x0d, 0x20, 0x0c, 0x0a, 0x1f, 0xf0, 0x41, 0x0e, 0x0a, 0x0d, 0x19, 0x10,
+    0x0e, 0x22, 0x09, 0x0a, 0x09, 0x03, 0x1a, 0x16, 0x2b, 0x07, 0x0e, 0x09,
+    0x1c, 0xf0, 0x04, 0x06, 0x0b, 0x07, 0x2a, 0x0a, 0x09, 0x0f, 0x09, 0x09,
+    0x07, 0x23, 0x06, 0x35, 0x02, 0x01, 0x12, 0x04, 0x12, 0x01, 0x00, 0x03,
+    0x10, 0x01, 0x04, 0x22, 0x03, 0xf1, 0x04, 0x36, 0x04, 0x13, 0x04, 0x17,
+    0x07, 0x04, 0x09, 0x03, 0x1a, 0x24, 0x0d, 0x0e, 0x06, 0x0b, 0x1f, 0x1f,
+    0x0c, 0x0d, 0xf1, 0x0b, 0x1e, 0x0f, 0x06, 0x0c, 0x05, 0x0b, 0x16, 0x0a,
+    0x19, 0x14, 0x0b, 0x16, 0x0a, 0x0b, 0x14, 0x0c, 0x0b, 0x06, 0x0a, 0x17,
+    0x38, 0x0b, 0x41, 0x0d, 0x0a, 0x27, 0x1e, 0x0d, 0x1e, 0xf0, 0x26, 0x0c,
+    0x0d, 0x05, 0x1e, 0x06, 0x0b, 0x0d, 0x08, 0x2b, 0x07, 0x08, 0x0a, 0x1d,
+    0x07, 0x08, 0x1c, 0x09, 0x0a, 0x0d, 0x0d, 0x0c, 0x07, 0x1d, 0xf0, 0x0a,
+    0x07, 0x0b, 0x05, 0x0c, 0x07, 0x1b, 0x08, 0x16, 0x0c, 0x0b, 0x05, 0x0a,
+    0x04, 0x2e, 0x23, 0x19, 0x14, 0x0a, 0x13, 0x19, 0xf0, 0x42, 0x2a, 0x0c,
+    0x09, 0x51, 0x0f, 0x0c, 0x09, 0x0d, 0x0e, 0x0c, 0x13, 0x09, 0x0a, 0x04,
+    0x09, 0x05, 0x0c, 0x09, 0x0d, 0xf0, 0x0e, 0x0e, 0x09, 0x0d, 0x08, 0x1c,
+    0x09, 0x07, 0x0d, 0x06, 0x0b, 0x07, 0x4a, 0x0a, 0x07, 0x14, 0x13, 0x08,
+    0x07, 0x32, 0x28, 0xf0, 0x55, 0x21, 0x90, 0x06, 0x04, 0x23, 0x06, 0x17,
+    0x11, 0x08, 0x0c, 0x10, 0x00, 0x0f, 0x01, 0x19, 0xf1, 0x12, 0x0c, 0x23,
+    0x0a, 0x09, 0x0d, 0x04, 0x0c, 0x02, 0x2b, 0x03, 0x08, 0x05, 0x0a, 0x07,
+    0x0b, 0x0f, 0x0d, 0x09, 0x0b, 0x06, 0x1d, 0x09, 0x08, 0x0c, 0xf1, 0x0a,
+    0x0d, 0x07, 0x1e, 0x05, 0x07, 0x0c, 0x06, 0x0a, 0x03, 0x09, 0x04, 0x0e,
+    0x05, 0x0d, 0x03, 0x0e, 0x04, 0x0a, 0x06, 0x0c, 0x13, 0x1a, 0x05, 0x28,
+    0x02, 0x06, 0x41, 0x03, 0x09, 0x15, 0x0c, 0x0a, 0x01, 0x0c, 0x03, 0x08,
+    0x92, 0x06, 0x1a, 0x14, 0x0b, 0x1f, 0x0e, 0x1b, 0x07, 0x0a, 0x0d, 0x1f,
+    0x0e, 0x0b, 0x0c, 0x1f, 0x51, 0x06, 0x09, 0x0d, 0x04, 0x0c, 0x03, 0x09,
+    0x06, 0x07, 0x05, 0x0d, 0xf0, 0x24, 0x0a, 0x09, 0x1c, 0x23, 0x0a, 0x0d,
+    0x04, 0x2a, 0x03, 0x01, 0x02, 0x08, 0x03, 0x07, 0x01, 0x08, 0x02, 0x07,
+    0x04, 0x08, 0x12, 0x19, 0xf0, 0x03, 0x1e, 0x25, 0x0d, 0x0c, 0x0a, 0x0d,
+    0x0f, 0x0e, 0x08, 0x0c, 0x07, 0x0b, 0x0f, 0x0f, 0x0d, 0x1e, 0x05, 0x07,
+    0x0d, 0x08, 0x0c, 0x04, 0x0a, 0x12, 0x0d, 0x0c, 0xf0, 0x03, 0x0b, 0x02,
+    0x18, 0x01, 0x12, 0x09, 0x08, 0x11, 0x17, 0x03, 0x36, 0x02, 0x01, 0x12,
+    0x17, 0x01, 0x00, 0x09, 0x11, 0x0c, 0x0f, 0xf0, 0x00, 0x0d, 0x01, 0x08,
+    0x32, 0x0a, 0x0b, 0x09, 0x1e, 0x04, 0x13, 0x0d, 0x2a, 0x06, 0x0e, 0x17,
+    0x19, 0x0f, 0x0a, 0x08, 0x19, 0x05, 0xf0, 0x08, 0x0a, 0x0d, 0x2b, 0x0b,
+    0x08, 0x0e, 0x0e, 0x0f, 0x0f, 0x17, 0x0e, 0x0b, 0x0f, 0x1c, 0x0e, 0x07,
+    0x0b, 0x09, 0x2c, 0x0c, 0x08, 0x05, 0x0d, 0x06, 0x3c, 0xf0, 0x09, 0x05,
+    0x03, 0x04, 0x0f, 0x03, 0x1e, 0x02, 0x03, 0x0b, 0x14, 0x0a, 0x09, 0x23,
+    0x1a, 0x0c, 0x02, 0x0a, 0x01, 0x0c, 0x13, 0x08, 0x17, 0xf0, 0x12, 0x08,
+    0x03, 0x17, 0x42, 0x18, 0x09, 0x0b, 0x01, 0x0f, 0x02, 0x0e, 0x03, 0x0a,
+    0x12, 0x0d, 0x0e, 0x03, 0x49, 0x62, 0xf0, 0x0b, 0x0a, 0x19, 0x23, 0x0a,
+    0x0e, 0x15, 0x0b, 0x1a, 0x16, 0x2b, 0x05, 0x06, 0x07, 0x1c, 0x06, 0xf0,
+    0x08, 0x0e, 0x09, 0x0d, 0x1c, 0x3c, 0x0b, 0x0d, 0x0f, 0x0b, 0x0e, 0x1c,
+    0x1f, 0x0d, 0x08, 0x1c, 0x0a, 0x09, 0x1a, 0x06, 0x07, 0x0c, 0x08, 0x0b,
+    0xf0, 0x06, 0x1e, 0x1a, 0x0d, 0x29, 0x0c, 0x0d, 0x0c, 0x08, 0x2d, 0x07,
+    0x05, 0x06, 0x1c, 0x07, 0x14, 0x0b, 0x0d, 0x05, 0x0c, 0x13, 0x1a, 0xf0,
+    0x04, 0x09, 0x13, 0x0b, 0x0e, 0x02, 0x0f, 0x03, 0x0d, 0x04, 0x0e, 0x13,
+    0x0d, 0x0c, 0x06, 0x1a, 0x05, 0x03, 0x0d, 0x16, 0x0e, 0x0b, 0x04, 0x0a,
+    0x15, 0x28, 0xf0, 0x14, 0x26, 0x03, 0x15, 0x25, 0x03, 0x15, 0x06, 0x12,
+    0x07, 0x08, 0x03, 0x09, 0x42, 0x1a, 0x08, 0x09, 0x0d, 0xf0, 0x11, 0x1b,
+    0x02, 0x1e, 0x11, 0x0d, 0x02, 0x0e, 0x11, 0x0f, 0x0c, 0x22, 0x09, 0x0a,
+    0x0d, 0x03, 0x0e, 0x02, 0x0d, 0x03, 0x0b, 0x05, 0x0a, 0x13, 0x09, 0xf0,
+    0x0c, 0x06, 0x1b, 0x05, 0x06, 0x1c, 0x07, 0x06, 0x0b, 0x07, 0x0d, 0x06,
+    0x0b, 0x08, 0x0d, 0x0f, 0x0b, 0x07, 0x09, 0x06, 0x1a, 0x0e, 0x06, 0x18,
+    0x05, 0x0c, 0x19, 0xf0, 0x05, 0x03, 0x1a, 0x05, 0x04, 0x0b, 0x05, 0x0a,
+    0x04, 0x0b, 0x03, 0x09, 0x04, 0x0c, 0x03, 0x08, 0x01, 0x09, 0x03, 0x0b,
+    0x05, 0x0a, 0x02, 0x0b, 0x03, 0x1a, 0x06, 0x03, 0x0c, 0xf0, 0x05, 0x0e,
+    0x09, 0x0c, 0x06, 0x0d, 0x07, 0x1e, 0x04, 0x05, 0x0c, 0x07, 0x0a, 0x03,
+    0x08, 0x02, 0x0a, 0x06, 0x19, 0x04, 0x02, 0x17, 0x14, 0x06, 0x02, 0x08,
+    0x13, 0x0b, 0xf0, 0x1e, 0x14, 0x0a, 0x02, 0x0d, 0x05, 0x0b, 0x06, 0x18,
+    0x03, 0x06, 0x29, 0x0b, 0x05, 0x06, 0x0b, 0x08, 0x0d, 0x09, 0x1c, 0x0a,
+    0x08, 0x0b, 0x09, 0x06, 0x61, 0x0f, 0x07, 0x04, 0x08, 0x03, 0x0a, 0x07,
+    0x2b, 0x14, 0x18, 0x07, 0x92, 0x08, 0x07, 0x0a, 0x06, 0x0b, 0x07, 0x0e,
+    0x0f, 0x0f, 0x09, 0x0c, 0x06, 0x1b, 0x0f, 0x0a, 0x09, 0x05, 0x0e, 0x61,
+    0x06, 0x0d, 0x05, 0x09, 0x22, 0x07, 0x05, 0x14, 0x11, 0x06, 0xf0, 0x10,
+    0x05, 0x06, 0x01, 0x24, 0x10, 0x01, 0x13, 0x60, 0x02, 0x24, 0x05, 0x26,
+    0x11, 0x02, 0x07, 0x30, 0x04, 0x08, 0x15, 0x09, 0x0b, 0x1d, 0x07, 0x21,
+    0x09, 0x08, 0x0b, 0x0e, 0x07, 0xf2, 0x0f, 0x08, 0x0d, 0x0a, 0x08, 0x0b,
+    0x1e, 0x0d, 0x0e, 0x0d, 0x0d, 0x06, 0x0e, 0x0c, 0x1f, 0x04, 0x03, 0x0e,
+    0x04, 0x1b, 0x02, 0x00, 0x0e, 0x21, 0x09, 0x07, 0x05, 0x52, 0x10, 0x16,
+    0x01, 0x18, 0x10, 0x0e, 0x01, 0x09, 0x23, 0x02, 0x0c, 0x00, 0x0e, 0x02,
+    0x0a, 0x94, 0x04, 0x0b, 0x03, 0x09, 0x02, 0x0c, 0x17, 0x2d, 0x05, 0x03,
+    0x0a, 0x06, 0x0b, 0x0f, 0x0e, 0x03, 0x0c, 0x23, 0x06, 0x0a, 0x0f, 0x09,
+    0x07, 0x0d, 0x22, 0x02, 0x08, 0x07, 0x07, 0x08, 0x09, 0x01, 0x04, 0x0f,
+    0xf0, 0x12, 0x2d, 0x03, 0x01, 0x0b, 0x00, 0x0a, 0x01, 0x0f, 0x02, 0x0b,
+    0x00, 0x09, 0x01, 0x0a, 0x12, 0x0c, 0x08, 0x01, 0x07, 0x02, 0x09, 0x13,
+    0x0a, 0x0b, 0x12, 0x2a, 0xf0, 0x05, 0x03, 0x08, 0x02, 0x09, 0x13, 0x2d,
+    0x22, 0x0a, 0x0e, 0x03, 0x0b, 0x02, 0x0a, 0x01, 0x0e, 0x12, 0x0c, 0x0a,
+    0x11, 0x0b, 0x0c, 0xf0, 0x12, 0x0e, 0x0c, 0x11, 0x0e, 0x0c, 0x12, 0x0b,
+    0x09, 0x01, 0x08, 0x02, 0x09, 0x03, 0x0a, 0x11, 0x0c, 0x09, 0x02, 0x0c,
+    0x03, 0x0e, 0x02, 0x09, 0x01, 0x0d, 0x12, 0x1f, 0xf0, 0x11, 0x1c, 0x12,
+    0x0e, 0x0b, 0x01, 0x18, 0x02, 0x03, 0x09, 0x11, 0x2e, 0x03, 0x04, 0x0d,
+    0x12, 0x0c, 0x0e, 0x05, 0x0b, 0x06, 0x0a, 0xf0, 0x04, 0x1b, 0x06, 0x0e,
+    0x0c, 0x07, 0x0b, 0x04, 0x0c, 0x08, 0x0d, 0x0c, 0x0b, 0x05, 0x0a, 0x07,
+    0x0b, 0x0f, 0x0d, 0x0a, 0x1a, 0x05, 0x07, 0x1e, 0x0f, 0x0a, 0x0c, 0x06,
+    0x3b, 0xf0, 0x09, 0x0f, 0x06, 0x05, 0x0c, 0x08, 0x1d, 0x05, 0x03, 0x0a,
+    0x04, 0x19, 0x07, 0x05, 0x08, 0x13, 0x09, 0x0c, 0x04, 0x1b, 0x12, 0x0a,
+    0x05, 0x1c, 0x90, 0x04, 0x02, 0x0d, 0x04, 0x2a, 0x07, 0x06, 0x08, 0x3c,
+    0x1e, 0x17, 0x07, 0xf1, 0x0c, 0x18, 0x09, 0x07, 0x09, 0x0d, 0x0c, 0x0f,
+    0x1d, 0x15, 0x0e, 0x0a, 0x6f, 0x07, 0x04, 0x05, 0x04, 0x02, 0x01, 0x02,
+    0x0b, 0x03, 0x1a, 0x31, 0x01, 0x00, 0x09, 0x11, 0x07, 0x0c, 0xf0, 0x00,
+    0x0e, 0x01, 0x0b, 0x02, 0x18, 0x01, 0x10, 0x09, 0x2d, 0x11, 0x00, 0x0f,
+    0x01, 0x0e, 0x02, 0x0b, 0x01, 0x1f, 0x02, 0x05, 0x0d, 0x26, 0x1c, 0xf0,
+    0x0e, 0x0a, 0x5d, 0x08, 0x06, 0x0d, 0x0f, 0x08, 0x05, 0x0b, 0x07, 0x0c,
+    0x08, 0x2b, 0x07, 0x0b, 0x0f, 0x1d, 0x0b, 0x07, 0x1e, 0x0d, 0xf0, 0x1f,
+    0x1f, 0x0b, 0x0e, 0x0f, 0x0f, 0x0d, 0x0e, 0x06, 0x0d, 0x18, 0x0c, 0x1e,
+    0x07, 0x16, 0x0d, 0x0e, 0x09, 0x0c, 0x0c, 0x0b, 0x09, 0x0a, 0x0c, 0x0b,
+    0x09, 0x0c, 0xf0, 0x1e, 0x0e, 0x1d, 0x08, 0x0a, 0x0c, 0x06, 0x0a, 0x04,
+    0x0c, 0x03, 0x0e, 0x14, 0x0b, 0x1a, 0x03, 0x22, 0x09, 0x08, 0x07, 0x01,
+    0x16, 0x12, 0x08, 0xf0, 0x11, 0x09, 0x07, 0x00, 0x0b, 0x01, 0x08, 0x10,
+    0x0a, 0x0d, 0x21, 0x09, 0x0a, 0x18, 0x12, 0x09, 0x20, 0x0c, 0x0b, 0x0e,
+    0x21, 0x09, 0x07, 0xf0, 0x08, 0x12, 0x07, 0x16, 0x01, 0x02, 0x07, 0x03,
+    0x06, 0x02, 0x07, 0x01, 0x09, 0x12, 0x08, 0x09, 0x10, 0x0b, 0x0c, 0x01,
+    0x0b, 0x12, 0x09, 0x37, 0x04, 0xf0, 0x08, 0x07, 0x08, 0x08, 0x0d, 0x29,
+    0x0f, 0x07, 0x06, 0x3a, 0x0e, 0x08, 0x24, 0x19, 0x12, 0x3a, 0x03, 0x04,
+    0xf0, 0x13, 0x08, 0x09, 0x05, 0x2b, 0x07, 0x06, 0x08, 0x0c, 0x0a, 0x1b,
+    0x05, 0x04, 0x0d, 0x06, 0x0c, 0x2a, 0x0b, 0x0c, 0x0d, 0x0d, 0x0c, 0x0c,
+    0x1b, 0x16, 0x10, 0x0e, 0x0d, 0x07, 0xf1, 0x0f, 0x08, 0x0d, 0x09, 0x0f,
+    0x1b, 0x0a, 0x05, 0x0a, 0x04, 0x19, 0x06, 0x07, 0x0a, 0x06, 0x09, 0x04,
+    0x0a, 0x03, 0x0c, 0x01, 0x0f, 0x30, 0x0c, 0x0b, 0x0e, 0x0f, 0xf1, 0x41,
+    0x09, 0x0b, 0x0d, 0x09, 0x17, 0x02, 0x03, 0x09, 0x14, 0x08, 0x09, 0x06,
+    0x4a, 0x15, 0x06, 0x0d, 0x0e, 0x2c, 0x09, 0xd1, 0x08, 0x0a, 0x7a, 0x16,
+    0x0a, 0x09, 0x06, 0x07, 0x0c, 0x09, 0x09, 0x28, 0x08, 0x07, 0x06, 0x04,
+    0x0b, 0xc0, 0x03, 0x1a, 0x04, 0x03, 0x0b, 0x21, 0x0f, 0x0e, 0x0b, 0x10,
+    0x0f, 0x0b, 0x11, 0x08, 0x09, 0x40, 0x0d, 0x0c, 0x18, 0xf1, 0x0a, 0x01,
+    0x0e, 0x12, 0x0b, 0x19, 0x03, 0x04, 0x0a, 0x32, 0x0e, 0x0b, 0x1a, 0x01,
+    0x09, 0x40, 0x0b, 0x0f, 0x0d, 0x19, 0x81, 0x21, 0x0c, 0x0b, 0x1a, 0x02,
+    0x23, 0x0e, 0x0d, 0x0f, 0x04, 0x19, 0x92, 0x06, 0x14, 0x0b, 0x0a, 0x0c,
+    0x0c, 0x0a, 0x2d, 0x07, 0x0e, 0x0f, 0x0b, 0x15, 0x09, 0x0f, 0x61, 0x08,
+    0x1c, 0x07, 0x06, 0x2a, 0x25, 0x08, 0x13, 0x0f, 0xf0, 0x0b, 0x04, 0x09,
+    0x13, 0x07, 0x15, 0x02, 0x01, 0x14, 0x50, 0x06, 0x05, 0x07, 0x08, 0x06,
+    0x11, 0x35, 0x00, 0x01, 0xf0, 0x02, 0x06, 0x11, 0x17, 0x02, 0x16, 0x03,
+    0x12, 0x07, 0x38, 0x05, 0x0c, 0x15, 0x1a, 0x08, 0x06, 0x09, 0x04, 0x1b,
+    0x0a, 0x0c, 0x1a, 0xf0, 0x16, 0x1e, 0x08, 0x0a, 0x1c, 0x24, 0x0b, 0x0d,
+    0x02, 0x0c, 0x00, 0x0b, 0x01, 0x0d, 0x02, 0x0b, 0x01, 0x0a, 0x00, 0x0f,
+    0x02, 0x0c, 0x03, 0x0f, 0x02, 0x08, 0x91, 0x03, 0x0a, 0x0c, 0x0b, 0x0d,
+    0x29, 0x04, 0x08, 0x0e, 0x0b, 0x0f, 0x0c, 0x08, 0x09, 0x1c, 0x07, 0x0b,
+    0xf0, 0x04, 0x08, 0x01, 0x07, 0x03, 0x04, 0x04, 0x03, 0x02, 0x02, 0x01,
+    0x01, 0x02, 0x50, 0x01, 0x00, 0x01, 0x02, 0x03, 0x01, 0x21, 0x02, 0x05,
+    0x06, 0x02, 0x00, 0x07, 0x11, 0x01, 0x0a, 0x22, 0x0d, 0x02, 0x07, 0x13,
+    0x08, 0x33, 0x0a, 0x04, 0x1e, 0x05, 0x16, 0x19, 0x24, 0x08, 0x08, 0x0a,
+    0x06, 0x09, 0x05, 0x0a, 0x0a, 0x06, 0x0f, 0x0b, 0x17, 0x0a, 0x0d, 0x08,
+    0x0c, 0x18, 0x1f, 0x1d, 0x07, 0x08, 0x0c, 0x16, 0x09, 0x0a, 0x0c, 0x0c,
+    0x05, 0x07, 0x0e, 0x34, 0x03, 0x1d, 0x04, 0x05, 0x08, 0x02, 0x09, 0x03,
+    0x21, 0x1d, 0x22, 0x0a, 0x10, 0x0c, 0xe1, 0x0b, 0x11, 0x09, 0x07, 0x00,
+    0x19, 0x01, 0x22, 0x0e, 0x0b, 0x1c, 0x06, 0x08, 0x0b, 0x05, 0x0c, 0x06,
+    0x0a, 0x0d, 0x0b, 0x0f, 0x0a, 0x07, 0x1f, 0xf0, 0x08, 0x0c, 0x0e, 0x06,
+    0x0b, 0x03, 0x09, 0x14, 0x18, 0x02, 0x06, 0x01, 0x27, 0x02, 0x01, 0x10,
+    0x08, 0x19, 0x11, 0x17, 0x00, 0x11, 0x06, 0xf0, 0x07, 0x10, 0x08, 0x06,
+    0x11, 0x08, 0x07, 0x10, 0x08, 0x09, 0x11, 0x07, 0x08, 0x00, 0x0a, 0x01,
+    0x07, 0x22, 0x1b, 0x09, 0x04, 0x3b, 0x06, 0xf0, 0x17, 0x0a, 0x0e, 0x0f,
+    0x0f, 0x0c, 0x2e, 0x09, 0x0a, 0x0b, 0x1c, 0x15, 0x0b, 0x14, 0x1c, 0x02,
+    0x0e, 0x21, 0x0a, 0x0b, 0x27, 0xf0, 0x10, 0x01, 0x05, 0x10, 0x16, 0x11,
+    0x05, 0x06, 0x00, 0x07, 0x41, 0x06, 0x07, 0x0a, 0x09, 0x0d, 0x23, 0x0c,
+    0x0d, 0x0c, 0x60, 0x06, 0x0b, 0x07, 0x0d, 0x05, 0x0b, 0x07, 0x0c, 0x0b,
+    0x1b, 0x08, 0x07, 0x16, 0xf1, 0x0e, 0x0a, 0x07, 0x0e, 0x09, 0x09, 0x0a,
+    0x07, 0x0b, 0x0e, 0x2c, 0x0f, 0x09, 0x0e, 0x0e, 0x0f, 0x0d, 0x0a, 0x2e,
+    0x08, 0x04, 0x05, 0x0c, 0x06, 0x1b, 0x14, 0xf1, 0x2a, 0x07, 0x04, 0x03,
+    0x0b, 0x15, 0x0c, 0x0a, 0x14, 0x0c, 0x09, 0x05, 0x1a, 0x06, 0x14, 0x0c,
+    0x09, 0x06, 0x0c, 0x05, 0x0b, 0x03, 0x2a, 0x05, 0xf1, 0x08, 0x16, 0x2b,
+    0x1b, 0x1c, 0x08, 0x06, 0x1e, 0x0a, 0x0f, 0x1c, 0x08, 0x09, 0x0d, 0x0f,
+    0x0e, 0x0d, 0x1c, 0x08, 0x0d, 0x1f, 0x0f, 0xa1, 0x0b, 0x0d, 0x09, 0x0b,
+    0x1e, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x16, 0x0d, 0x0a, 0x05, 0x06, 0x04,
+    0x07, 0x03, 0x0b, 0x04, 0xf0, 0x18, 0x03, 0x12, 0x0b, 0x1f, 0x01, 0xf0,
+    0x0d, 0x0f, 0x0b, 0x07, 0x05, 0x07, 0x04, 0x03, 0x14, 0x13, 0xf0, 0x04,
+    0x05, 0x04, 0x05, 0x60, 0x17, 0x06, 0x18, 0x06, 0x13, 0x11, 0x01, 0x02,
+    0x00, 0x03, 0x11, 0x12, 0xf0, 0xb0, 0x13, 0x24, 0x05, 0x26, 0x09, 0x0e,
+    0x0f, 0x01, 0x0c, 0x02, 0x0d, 0x13, 0x0c, 0x10, 0x0f, 0x04, 0x09, 0x01,
+    0x06, 0x16, 0xf2, 0x18, 0x07, 0x09, 0x09, 0x0d, 0x1a, 0x0b, 0x0a, 0x0b,
+    0x0d, 0x0c, 0x0e, 0x2b, 0x0a, 0x0b, 0x1f, 0x0c, 0x2f, 0x0e, 0x0c, 0x1f,
+    0x0e, 0x0c, 0xf2, 0x0a, 0x0a, 0x08, 0x08, 0x07, 0x17, 0x05, 0x04, 0x26,
+    0x13, 0x02, 0x27, 0x41, 0x18, 0x09, 0x02, 0x08, 0x13, 0x09, 0x0b, 0xc2,
+    0x04, 0x0d, 0x26, 0x1b, 0x1c, 0x09, 0x0c, 0x3b, 0x1e, 0x1f, 0x0a, 0x0b,
+    0x19, 0x0a, 0x0d, 0x2f, 0x71, 0x0c, 0x09, 0x1c, 0x0e, 0x0c, 0x0d, 0x0a,
+    0x0b, 0x08, 0x0d, 0x07, 0x0f, 0x0e, 0xf0, 0x0e, 0x0c, 0x0a, 0x0b, 0x0b,
+    0x1c, 0x09, 0x26, 0x0b, 0x1c, 0x05, 0x0b, 0x24, 0x0a, 0x0d, 0x0a, 0x03,
+    0x0b, 0x02, 0x0e, 0x13, 0x1a, 0x02, 0x0b, 0xf0, 0x03, 0x09, 0x04, 0x1a,
+    0x03, 0x02, 0x0d, 0x53, 0x0e, 0x0b, 0x19, 0x0c, 0x0a, 0x02, 0x0b, 0x01,
+    0x0f, 0x12, 0x0e, 0x0a, 0x71, 0x09, 0x0a, 0xf0, 0x0c, 0x17, 0x08, 0x07,
+    0x06, 0xf0, 0x08, 0x0a, 0x0b, 0x17, 0x0b, 0x08, 0x06, 0x08, 0x17, 0xf0,
+    0x26, 0x15, 0xb0, 0x16, 0x15, 0x06, 0x05, 0x06, 0x27, 0xd0, 0x08, 0x09,
+    0x21, 0x17, 0x0a, 0x12, 0x09, 0x0a, 0x03, 0x09, 0x14, 0x0b, 0x0e, 0x05,
+    0x0c, 0x08, 0x0e, 0x09, 0x0f, 0x1a, 0x08, 0x41, 0x09, 0x0b, 0x0b, 0x0d,
+    0x0c, 0x1a, 0x0d, 0x08, 0xf2, 0x0b, 0x0a, 0x18, 0x1c, 0x0b, 0x5e, 0x0a,
+    0x0b, 0x0e, 0x2f, 0x2c, 0x0d, 0x1f, 0x0b, 0x0b, 0x2a, 0x0d, 0x0a, 0xf2,
+    0x06, 0x1b, 0x05, 0x06, 0x0a, 0x05, 0x19, 0x14, 0x08, 0x13, 0x09, 0x08,
+    0x12, 0x0a, 0x0b, 0x23, 0x09, 0x08, 0x09, 0x24, 0x0b, 0x09, 0x0a, 0xf2,
+    0x05, 0x1c, 0x26, 0x0e, 0x0c, 0x08, 0x1b, 0x0b, 0x1a, 0x0c, 0x4b, 0x0e,
+    0x0d, 0x0e, 0x1f, 0x0c, 0x0d, 0x0d, 0x1f, 0x1e, 0x32, 0x0e, 0x0b, 0x0c,
+    0x09, 0x0b, 0x08, 0x09, 0x0e, 0x91, 0x07, 0x0b, 0x15, 0x09, 0x07, 0x04,
+    0x26, 0x02, 0x21, 0x04, 0x13, 0xf0, 0x15, 0x30, 0x04, 0x03, 0x11, 0x11,
+    0x60, 0x02, 0x11, 0x32, 0x01, 0x01, 0x10, 0x12, 0xe0, 0x01, 0x01, 0x03,
+    0x00, 0x11, 0x11, 0x33, 0xf0, 0x04, 0x15, 0x07, 0x08, 0x09, 0x21, 0x06,
+    0x08, 0x0b, 0x02, 0x18, 0x23, 0x09, 0x0c, 0x50, 0x05, 0x0e, 0x06, 0x0d,
+    0x07, 0x0e, 0x08, 0x1f, 0x0c, 0x0a, 0x08, 0xf1, 0x09, 0x09, 0x0b, 0x1a,
+    0x0e, 0x1b, 0x2b, 0x1f, 0x0c, 0x0b, 0x1d, 0x0c, 0x0f, 0x0c, 0x37, 0x0d,
+    0x1e, 0x0c, 0x26, 0x1b, 0xf1, 0x0c, 0x25, 0x0b, 0x0a, 0x1b, 0x06, 0x15,
+    0x09, 0x1a, 0x06, 0x15, 0x0c, 0x0b, 0x07, 0x0c, 0x08, 0x0b, 0x09, 0x1a,
+    0x08, 0x09, 0x0c, 0x0b, 0x0e, 0xf1, 0x09, 0x0d, 0x0b, 0x1e, 0x1e, 0x2d,
+    0x09, 0x0e, 0x0f, 0x3b, 0x0d, 0x1c, 0x0a, 0x0a, 0x09, 0x09, 0x0b, 0x08,
+    0x0f, 0x27, 0x0c, 0x09, 0x11, 0x0c, 0x08, 0x0b, 0x1f, 0xf0, 0x09, 0x0a,
+    0x1e, 0x0b, 0x07, 0x1c, 0x16, 0x2a, 0x05, 0x04, 0x13, 0x09, 0x08, 0x02,
+    0x0a, 0x61, 0x0d, 0x0a, 0x0c, 0x08, 0x27, 0xf0, 0x50, 0x2d, 0x0e, 0x1b,
+    0x51, 0x17, 0x08, 0x0b, 0x0d, 0x0c, 0x02, 0x08, 0x23, 0x07, 0xf0, 0x09,
+    0x0b, 0x04, 0x2a, 0x05, 0x26, 0x0b, 0x0e, 0x07, 0x0c, 0x26, 0x0d, 0x0e,
+    0x0d, 0x25, 0x0e, 0x0d, 0x0b, 0x04, 0x0c, 0x23, 0x0e, 0xf0, 0x0b, 0x09,
+    0xb2, 0x0b, 0x09, 0x1a, 0x08, 0x19, 0x18, 0x1a, 0x0c, 0x23, 0x0a, 0x0c,
+    0xf0, 0x0e, 0x04, 0x0c, 0x15, 0x1d, 0x06, 0x0c, 0x07, 0x2b, 0x28, 0x5d,
+    0x1b, 0x0a, 0x0b, 0x0c, 0x19, 0x3e, 0xf0, 0x0a, 0x29, 0x0d, 0x0c, 0x18,
+    0x0d, 0x0c, 0x07, 0x0d, 0x18, 0x0c, 0x0d, 0x46, 0x2e, 0x0c, 0x0a, 0x18,
+    0x19, 0xf0, 0x37, 0x2a, 0x0b, 0x06, 0x0e, 0x07, 0x1d, 0x18, 0x0b, 0x07,
+    0x0c, 0x08, 0x2b, 0x07, 0x26, 0x0c, 0x1b, 0x05, 0x04, 0x0d, 0xf0, 0x23,
+    0x0f, 0x0d, 0x0b, 0x52, 0x1f, 0x0d, 0x09, 0x18, 0xc1, 0x1e, 0x0f, 0x0e,
+    0x0c, 0x0b, 0x1c, 0xf0, 0x0b, 0x0c, 0x0d, 0x1b, 0x62, 0x17, 0x08, 0x09,
+    0x0a, 0x1b, 0x03, 0x18, 0x24, 0x09, 0xf0, 0x0a, 0x25, 0x09, 0x1b, 0x06,
+    0x1a, 0x27, 0x0c, 0x0d, 0x28, 0x1c, 0x0b, 0x07, 0x0d, 0x18, 0x0c, 0x1d,
+    0x17, 0x0c, 0xf0, 0x06, 0x1d, 0x25, 0x0b, 0x0a, 0x74, 0x1c, 0x0d, 0x0c,
+    0x1a, 0x0c, 0x0d, 0x15, 0x0a, 0x0c, 0x16, 0x0b, 0x1c, 0x10, 0x07, 0x19,
+    0x06, 0xf1, 0x07, 0x0a, 0x18, 0x0c, 0x0b, 0x09, 0x0a, 0x0a, 0x0c, 0x0b,
+    0x0d, 0x0c, 0xaf, 0x0b, 0x1c, 0x0d, 0x1c, 0x2e, 0x71, 0x0d, 0x1b, 0x2d,
+    0x09, 0x08, 0x0e, 0x17, 0x0a, 0x09, 0x0e, 0xf0, 0x08, 0x0b, 0x06, 0x0a,
+    0x05, 0x09, 0x04, 0x0a, 0x03, 0x0b, 0x12, 0x0e, 0x0a, 0x41, 0x0f, 0x0d,
+    0x1b, 0x0a, 0xf0, 0x0f, 0x0e, 0x0d, 0x0a, 0xf0, 0x09, 0x0a, 0x19, 0x1a,
+    0x19, 0x0a, 0x18, 0x39, 0xf0, 0x0b, 0xf0, 0x0d, 0x1b, 0x0e, 0x1c, 0x0d,
+    0x1e, 0x0d, 0x0c, 0x1e, 0x10, 0x0d, 0xe1, 0x37, 0xf0, 0x38, 0x0a, 0x0c,
+    0x0b, 0x0c, 0x0e, 0x1f, 0x42, 0x0a, 0x0c, 0x0e, 0xe0, 0x1f, 0x03, 0x0e,
+    0x24, 0x0a, 0x0b, 0x0e, 0x05, 0x0c, 0x06, 0x0a, 0x07, 0x2b, 0x08, 0x09,
+    0x3a, 0x0c, 0x0e, 0x0f, 0x08, 0x51, 0x0b, 0x09, 0x0d, 0x0a, 0x3e, 0x1b,
+    0x0c, 0x07, 0x72, 0x0d, 0x08, 0x0c, 0x09, 0x1d, 0x0a, 0x1b, 0x0e, 0x0d,
+    0x0c, 0x0c, 0x0d, 0x0e, 0x08, 0xc3, 0x0d, 0x09, 0x1b, 0x3a, 0x0c, 0x0d,
+    0x1b, 0x1b, 0x0e, 0x1c, 0x0d, 0x0e, 0x0a, 0x1f, 0x08, 0x07, 0x1d, 0x0b,
+    0x32, 0x0a, 0x0e, 0x09, 0x1d, 0x08, 0x0e, 0xc1, 0x09, 0x1d, 0x07, 0x06,
+    0x0b, 0x05, 0x19, 0x04, 0x03, 0x1a, 0x02, 0x11, 0x0c, 0x09, 0xf0, 0x0f,
+    0x0a, 0x08, 0x0f, 0xf0, 0x0d, 0x0b, 0x1a, 0x0b, 0x09, 0x0a, 0x1c, 0x1b,
+    0x1e, 0x20, 0x1f, 0xd1, 0x28, 0xf0, 0x09, 0x0b, 0x1c, 0x0d, 0x0a, 0x09,
+    0x0a, 0x08, 0x17, 0xf0, 0x1f, 0x0e, 0xf0, 0x0d, 0x1e, 0x1f, 0x0e, 0x0d,
+    0x0c, 0x0b, 0x3a, 0xb0, 0x1b, 0x0d, 0x50, 0x0e, 0x0c, 0x0d, 0x1e, 0x07,
+    0xf1, 0x08, 0x0a, 0x0e, 0x21, 0x08, 0x0c, 0x0f, 0x02, 0x0b, 0x13, 0x09,
+    0x0c, 0x04, 0x1a, 0x05, 0x06, 0x1b, 0x07, 0x09, 0x2a, 0x0b, 0x1d, 0xf1,
+    0x0b, 0x0e, 0x1c, 0x2f, 0x0d, 0x0c, 0x0e, 0x0e, 0x1f, 0x0d, 0x1b, 0x1e,
+    0x0c, 0x2b, 0x1d, 0x0e, 0x0a, 0x0d, 0x19, 0x0e, 0x2d, 0xf1, 0x18, 0x17,
+    0x0b, 0x39, 0x06, 0x05, 0x04, 0x03, 0x0b, 0x22, 0x0d, 0x09, 0x08, 0x01,
+    0x09, 0xa0, 0x0f, 0x0c, 0x09, 0x08, 0xf1, 0x37, 0x09, 0x0b, 0x0f, 0x11,
+    0x0a, 0x0d, 0x02, 0x1a, 0x03, 0x04, 0x0c, 0x06, 0x0a, 0x07, 0x0b, 0x09,
+    0x0c, 0x0a, 0x07, 0xf2, 0x1b, 0x08, 0x09, 0x0a, 0x0a, 0x0b, 0x0b, 0x1a,
+    0x1d, 0x1b, 0x2c, 0x19, 0x2b, 0x08, 0x07, 0x05, 0x0e, 0x04, 0x1c, 0x03,
+    0x02, 0x0b, 0x42, 0x41, 0x0c, 0x08, 0x06, 0x04, 0x12, 0x03, 0xf0, 0x04,
+    0x01, 0x05, 0xd0, 0x07, 0x06, 0x85, 0x06, 0x08, 0x0b, 0x20, 0x01, 0x07,
+    0x02, 0x16, 0x13, 0x11, 0x15, 0x04, 0x02, 0x23, 0x16, 0x03, 0x04, 0x07,
+    0x05, 0x04, 0x06, 0x16, 0x05, 0x05, 0x08, 0xf4, 0x07, 0x19, 0x09, 0x0a,
+    0x0a, 0x0d, 0x2c, 0x0e, 0x0d, 0x1e, 0x1d, 0x0f, 0x0c, 0x0e, 0x1d, 0x0d,
+    0x0e, 0x1c, 0x0d, 0x0e, 0x0a, 0x0c, 0x09, 0x0a, 0x0b, 0x13, 0x09, 0x09,
+    0x08, 0x0c, 0x32, 0x06, 0x0b, 0x05, 0x0a, 0x04, 0x08, 0x03, 0x0d, 0x21,
+    0x02, 0x1b, 0x21, 0x0f, 0xf0, 0x09, 0x90, 0x0c, 0x08, 0x05, 0x14, 0x43,
+    0x01, 0x02, 0x80, 0x14, 0x05, 0x06, 0x30, 0x08, 0x0b, 0x0e, 0x08, 0xa1,
+    0x0c, 0x01, 0x08, 0x02, 0x27, 0x03, 0x04, 0x05, 0x18, 0x07, 0x0a, 0x09,
+    0x0e, 0x0a, 0x0d, 0x0d, 0x0c, 0x08, 0xa2, 0x0e, 0x09, 0x8f, 0x0a, 0x0b,
+    0x0c, 0x0e, 0x0f, 0x0d, 0x0c, 0x1a, 0x0b, 0x0f, 0x31, 0x18, 0x0d, 0x0a,
+    0x07, 0x08, 0x06, 0x1e, 0xe0, 0x04, 0x03, 0x1a, 0x02, 0x01, 0x0b, 0xf0,
+    0x0c, 0x07, 0x06, 0x04, 0x13, 0x22, 0x03, 0x12, 0x11, 0x04, 0x90, 0x06,
+    0x08, 0x0a, 0x01, 0x17, 0x02, 0x03, 0x08, 0x04, 0x09, 0x05, 0x0c, 0x06,
+    0x0f, 0x17, 0x08, 0x31, 0x09, 0x08, 0x0c, 0x0a, 0x0f, 0x19, 0x0a, 0x12,
+    0x0c, 0x0a, 0x08, 0x13, 0x0c, 0x09, 0x1d, 0x08, 0x04, 0x07, 0x25, 0x0e,
+    0x09, 0x0f, 0x0b, 0x0e, 0x0a, 0x16, 0x3f, 0x1c, 0x07, 0x0e, 0x26, 0x0b,
+    0x1e, 0x2a, 0x05, 0x0a, 0x14, 0x07, 0x09, 0x06, 0x0a, 0x03, 0x05, 0x0e,
+    0x92, 0x04, 0x09, 0x03, 0x17, 0x02, 0x01, 0x08, 0xc0, 0x0a, 0x07, 0x05,
+    0x04, 0x03, 0x24, 0xf1, 0x15, 0x07, 0x09, 0x0e, 0x11, 0x09, 0x0e, 0x02,
+    0x0c, 0x03, 0x2b, 0x04, 0x05, 0x07, 0x1a, 0x0a, 0x0c, 0x0b, 0xf1, 0x0d,
+    0x1c, 0x1f, 0x0d, 0x1e, 0x1e, 0x0d, 0x1d, 0x0e, 0x1c, 0x0b, 0x19, 0x09,
+    0x08, 0x18, 0x06, 0x05, 0x27, 0x04, 0x03, 0x02, 0x09, 0x61, 0x21, 0x0b,
+    0x09, 0x07, 0xf0, 0x0a, 0x08, 0x07, 0x0e, 0xf0, 0x1c, 0x0b, 0x09, 0x08,
+    0x19, 0x08, 0x29, 0x08, 0x60, 0x09, 0x0a, 0x0b, 0x0e, 0xf0, 0x2f, 0x21,
+    0x09, 0x0b, 0x0d, 0x22, 0x09, 0x0d, 0x0f, 0x03, 0x0e, 0x04, 0x0c, 0x05,
+    0x0b, 0x06, 0x1c, 0x07, 0x08, 0x0d, 0x0a, 0x0c, 0xf0, 0x0d, 0x0d, 0x0f,
+    0x4f, 0x1d, 0x1e, 0x3f, 0x2e, 0x0c, 0x1e, 0x0d, 0x0c, 0x0b, 0x1b, 0x17,
+    0x0a, 0x06, 0x09, 0xf0, 0x05, 0x2a, 0x14, 0x03, 0x0d, 0x52, 0x0f, 0x0e,
+    0x1b, 0x09, 0x08, 0xf1, 0x0c, 0x0b, 0x09, 0x08, 0x17, 0xf0, 0x08, 0x07,
+    0x08, 0x06, 0x28, 0x0a, 0x0c, 0x0e, 0x01, 0x0d, 0x12, 0x09, 0x0b, 0x23,
+    0x08, 0x09, 0x0b, 0xf0, 0x24, 0x09, 0x0b, 0x0e, 0x05, 0x0d, 0x16, 0x0c,
+    0x2e, 0x17, 0x08, 0x0d, 0x09, 0x0c, 0x1a, 0x0d, 0x0e, 0x09, 0x2d, 0x0a,
+    0x09, 0x0a, 0x0c, 0xf0, 0x09, 0x2b, 0x1a, 0x28, 0x2c, 0x07, 0x1e, 0x26,
+    0x0d, 0x0b, 0x45, 0x0d, 0x2a, 0x09, 0x44, 0x0b, 0xf0, 0x0c, 0x1b, 0x0d,
+    0x65, 0x1a, 0x09, 0x0a, 0x0c, 0x0d, 0x0c, 0x16, 0x1a, 0x15, 0x1c, 0x06,
+    0x0b, 0xf0, 0x95, 0x0d, 0x2b, 0x19, 0x2a, 0x1d, 0x26, 0x0c, 0x0d, 0x07,
+    0x0b, 0x19, 0x1a, 0xf0, 0x0a, 0x4b, 0x1d, 0x1e, 0x0c, 0x1c, 0x0a, 0x08,
+    0x2b, 0x07, 0x06, 0x04, 0x1d, 0x03, 0x12, 0x0f, 0x0d, 0x71, 0x2f, 0xf0,
+    0x0d, 0x1e, 0x1f, 0x52, 0x1a, 0x09, 0x08, 0x07, 0x06, 0x31, 0x18, 0x17,
+    0xf0, 0xf0, 0x0b, 0x0a, 0x09, 0x17, 0x26, 0x07, 0x06, 0x65, 0xd0, 0xd0,
+    0x06, 0x55, 0x16, 0x08, 0x0d, 0x0f, 0x08, 0x21, 0x21, 0x07, 0x0a, 0x09,
+    0x42, 0x02, 0x18, 0x03, 0x04, 0x0a, 0x05, 0x0d, 0x06, 0x09, 0x23, 0x07,
+    0x0a, 0x08, 0x0c, 0x0b, 0x08, 0xa4, 0x0e, 0x0a, 0x0c, 0x0b, 0x0a, 0x1d,
+    0x0e, 0x0f, 0x0c, 0x0c, 0x0d, 0x1f, 0x1e, 0x0d, 0x0b, 0x0f, 0x08, 0x0e,
+    0x05, 0x15, 0x0f, 0x04, 0x1a, 0x03, 0x06, 0x02, 0x07, 0x0c, 0x01, 0x08,
+    0x0a, 0xc0, 0x1b, 0x08, 0x05, 0x09, 0x13, 0x0a, 0x28, 0x02, 0x11, 0x07,
+    0x30, 0x08, 0x07, 0x05, 0x04, 0x01, 0x03, 0x90, 0x11, 0x12, 0x60, 0x24,
+    0x16, 0x08, 0x0c, 0x71, 0x18, 0x11, 0x39, 0x02, 0x03, 0x04, 0x06, 0x0a,
+    0x07, 0x0c, 0x08, 0x02, 0x09, 0x0d, 0x03, 0x07, 0x0c, 0x04, 0x36, 0x0d,
+    0x15, 0x1e, 0x06, 0x0f, 0x08, 0x75, 0x0a, 0x0a, 0x1d, 0x0b, 0x0c, 0x1e,
+    0x0d, 0x0c, 0x0c, 0x0b, 0x0f, 0x0a, 0x0d, 0x1e, 0x44, 0x0e, 0x0f, 0x0c,
+    0x0d, 0x0b, 0x0c, 0x09, 0x0a, 0x0d, 0x53, 0x19, 0x0c, 0x0a, 0x07, 0x18,
+    0x05, 0x04, 0x09, 0x03, 0x0c, 0x62, 0x02, 0x1e, 0x21, 0x08, 0x06, 0xf0,
+    0x07, 0x05, 0x06, 0x31, 0x05, 0x04, 0x03, 0x15, 0x20, 0x04, 0xa2, 0xa1,
+    0xc0, 0x04, 0xf0, 0x35, 0x06, 0x08, 0x09, 0x0c, 0x11, 0x08, 0x0a, 0x02,
+    0x37, 0x03, 0x04, 0x15, 0x09, 0x06, 0x0b, 0x20, 0x07, 0x0d, 0x08, 0x0e,
+    0x0b, 0x07, 0xf1, 0x1d, 0x08, 0x09, 0x0c, 0x0a, 0x08, 0x1c, 0x09, 0x0b,
+    0x0b, 0x0a, 0x0c, 0x08, 0x1d, 0x17, 0x0b, 0x05, 0x0d, 0x14, 0x2c, 0x03,
+    0x12, 0x0d, 0x09, 0xf1, 0x51, 0x0e, 0x0b, 0x19, 0x18, 0xe0, 0x0c, 0x09,
+    0x08, 0x27, 0x08, 0x47, 0xf1, 0x09, 0x0b, 0x0f, 0x01, 0x09, 0x12, 0x07,
+    0x08, 0x03, 0x17, 0x04, 0x05, 0x08, 0x06, 0x09, 0x07, 0x0a, 0x0a, 0x0b,
+    0x0b, 0x0d, 0x2c, 0x07, 0x72, 0x08, 0x59, 0x0e, 0x0f, 0x1e, 0x0c, 0x0e,
+    0x1f, 0xf1, 0x0c, 0x0d, 0x0e, 0x0a, 0x2d, 0x09, 0x08, 0x07, 0x0c, 0x16,
+    0x0e, 0x0c, 0x25, 0x0e, 0x0b, 0x0a, 0x14, 0x0b, 0x09, 0x73, 0x0b, 0x09,
+    0x08, 0x01, 0x1f, 0xf0, 0x0e, 0x0c, 0x0b, 0x54, 0x29, 0x0a, 0x1b, 0x15,
+    0x09, 0x3a, 0x76, 0x0c, 0xf0, 0x1d, 0x0c, 0x0e, 0x07, 0x0c, 0x16, 0x0e,
+    0x0d, 0x57, 0x1b, 0x1a, 0x09, 0x08, 0x86, 0x09, 0x2a, 0xf0, 0x0b, 0x0c,
+    0x0d, 0x0c, 0x0e, 0x47, 0x0d, 0x0c, 0x3b, 0x06, 0x25, 0x0e, 0x0c, 0x0b,
+    0x04, 0x0d, 0xf0, 0x23, 0x0f, 0x0e, 0x0a, 0x32, 0x0e, 0x0b, 0x0a, 0x09,
+    0xb1, 0x2f, 0x0e, 0x0c, 0x0d, 0x0c, 0x0b, 0x0c, 0xf0, 0x1e, 0x0b, 0xa2,
+    0x07, 0x28, 0x29, 0x0a, 0x0c, 0x1d, 0x73, 0x19, 0xf0, 0x0a, 0x09, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x14, 0x19, 0x33, 0x0d, 0x2b, 0xf2, 0x1f, 0x0e, 0x0c,
+    0xf0, 0x0b, 0x0d, 0x0c, 0x1a, 0x69, 0xe2, 0x0b, 0x0a, 0x59, 0xf0, 0x0a,
+    0x0b, 0x0c, 0x0b, 0x0c, 0x0d, 0x0e, 0x23, 0x0a, 0x0c, 0x0f, 0x04, 0x0c,
+    0x15, 0x0b, 0x80, 0x0d, 0x06, 0x1b, 0x07, 0x08, 0x1c, 0x0a, 0x0b, 0x0e,
+    0x1c, 0x1f, 0x0b, 0x08, 0xf1, 0x0a, 0x19, 0x0b, 0x0c, 0x1a, 0x0e, 0x0c,
+    0x0c, 0x1e, 0x3d, 0x0d, 0x0e, 0x1f, 0x0c, 0x0b, 0x1e, 0x0c, 0x2b, 0x1c,
+    0x1d, 0x2a, 0x71, 0x2e, 0x09, 0x18, 0x2c, 0x17, 0x2e, 0x0e, 0xf0, 0x0d,
+    0x2b, 0x0b, 0x0a, 0x09, 0x0c, 0x07, 0x1d, 0x16, 0x1b, 0x05, 0x34, 0x0c,
+    0x0a, 0x09, 0x08, 0x13, 0x0a, 0x08, 0xf2, 0x0d, 0xf0, 0x0a, 0x19, 0x48,
+    0x07, 0x78, 0xf2, 0xf0, 0x29, 0x2b, 0x1c, 0x0b, 0x0a, 0x0b, 0x0a, 0x09,
+    0x18, 0x12, 0xf0, 0x07, 0x71, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x27, 0xf0,
+    0x1c, 0x0d, 0x0b, 0x0a, 0x0b, 0x2a, 0xf0, 0x0b, 0x0a, 0x19, 0x0a, 0x09,
+    0x08, 0xa0, 0x39, 0x0a, 0x1d, 0x10, 0x0f, 0x18, 0xf1, 0x0a, 0x21, 0x07,
+    0x08, 0x0b, 0x22, 0x08, 0x0b, 0x0f, 0x03, 0x0d, 0x04, 0x2b, 0x05, 0x06,
+    0x07, 0x0a, 0x08, 0x0b, 0x0a, 0x0a, 0x0b, 0x0b, 0xf1, 0x0d, 0x1c, 0x2e,
+    0x0d, 0x0e, 0x1d, 0x0d, 0x3e, 0x0e, 0x0d, 0x0e, 0x0f, 0x0c, 0x0d, 0x3d,
+    0x1b, 0x09, 0x2a, 0x1b, 0x51, 0x1a, 0x0b, 0x0c, 0x09, 0x0d, 0x18, 0x3c,
+    0x0f, 0xf0, 0x2e, 0x1a, 0x0d, 0x09, 0x2e, 0x08, 0x27, 0x0d, 0x0b, 0x46,
+    0x0c, 0x0d, 0x0b, 0x0a, 0x09, 0x05, 0x0a, 0x14, 0x1c, 0xf0, 0xf3, 0x0f,
+    0x1e, 0x0c, 0x4a, 0x39, 0x0a, 0x1b, 0xf0, 0xf3, 0x0c, 0x1b, 0x7c, 0x0b,
+    0x3a, 0xf0, 0x13, 0x19, 0xf2, 0x0e, 0x0c, 0x0d, 0x0c, 0x0b, 0x2a, 0x19,
+    0x1a, 0x1b, 0xf0, 0x1a, 0xa2, 0x2b, 0x0c, 0x1d, 0x1c, 0x0e, 0x1d, 0x03,
+    0x08, 0x04, 0x06, 0xf0, 0x25, 0x25, 0x66, 0x64, 0x19, 0xc3, 0x08, 0x09,
+    0x2a, 0xf0, 0x2c, 0x2e, 0x29, 0xe4, 0x0a, 0x0c, 0x1b, 0x0a, 0x2b, 0xf0,
+    0x0c, 0x1b, 0x0d, 0x0a, 0xf5, 0x09, 0x0a, 0x0b, 0x0c, 0x2b, 0x1a, 0xf0,
+    0x1c, 0x1b, 0x0c, 0x1d, 0x55, 0x0c, 0x0d, 0x0e, 0x1d, 0x69, 0x76, 0xf0,
+    0x0a, 0x08, 0x17, 0x07, 0x06, 0x08, 0x65, 0x6a, 0x34, 0x0c, 0x0a, 0xf0,
+    0x0b, 0x0c, 0x35, 0x0a, 0x1b, 0x2c, 0x46, 0x2b, 0x15, 0x0e, 0x0d, 0x26,
+    0x0b, 0x0c, 0x0b, 0xf0, 0xb5, 0x1e, 0x0c, 0x1b, 0x1c, 0x1e, 0x2c, 0x46,
+    0x1a, 0x2b, 0xf0, 0x05, 0x0d, 0x16, 0x1a, 0x25, 0x0b, 0x1a, 0x74, 0x0c,
+    0x3b, 0x29, 0x73, 0x2c, 0xf0, 0x0b, 0x0a, 0x19, 0x08, 0xf2, 0x0d, 0x0b,
+    0x0c, 0x0b, 0x1a, 0x09, 0x08, 0x09, 0xf0, 0x28, 0x37, 0x42, 0x18, 0x07,
+    0x18, 0xc1, 0x2e, 0x0b, 0xf0, 0x0d, 0x2c, 0x0b, 0x0d, 0x1e, 0x0d, 0xe2,
+    0x27, 0x58, 0xf0, 0x09, 0x0a, 0x1b, 0x0c, 0x0e, 0x53, 0x08, 0x09, 0x0b,
+    0x0d, 0x0c, 0x0e, 0x24, 0x0a, 0x0c, 0xf0, 0x0e, 0x15, 0x0b, 0x0e, 0x26,
+    0x0b, 0x0c, 0x0d, 0x27, 0x0c, 0x1d, 0x48, 0x4c, 0x09, 0x0b, 0x88, 0x1d,
+    0xf0, 0x3c, 0x0b, 0x1c, 0x09, 0x2b, 0x9a, 0x1c, 0x2b, 0xf0, 0x3c, 0x1c,
+    0x1b, 0x0b, 0x0a, 0x0d, 0x29, 0x1e, 0x0d, 0x0b, 0x0b, 0x2d, 0x0a, 0x29,
+    0x0b, 0x19, 0x1a, 0xf0, 0x08, 0x1b, 0x47, 0x2c, 0x1b, 0x56, 0x1a, 0x09,
+    0x18, 0x35, 0x39, 0xf0, 0x24, 0x0a, 0x09, 0x08, 0x33, 0x0a, 0x09, 0x18,
+    0xf2, 0x0d, 0x0c, 0x1b, 0x0a, 0x19, 0x0a, 0xf0, 0x99, 0xf2, 0x08, 0x09,
+    0x0a, 0x19, 0x2a, 0xf0, 0x0b, 0x1c, 0x0d, 0x1e, 0x43, 0x08, 0x09, 0x0a,
+    0x1b, 0x64, 0x18, 0x09, 0xf0, 0x0a, 0x1b, 0x0c, 0x85, 0x2a, 0x0b, 0x0c,
+    0x1b, 0x0c, 0x0d, 0x64, 0x0e, 0x1d, 0xf0, 0x0b, 0x0a, 0x19, 0xf3, 0x1c,
+    0x0d, 0x0b, 0x3a, 0x09, 0x1a, 0x0c, 0xf0, 0x0b, 0x0c, 0x2e, 0x03, 0x64,
+    0x3a, 0x0c, 0x1d, 0x25, 0x1a, 0x09, 0x04, 0x1a, 0xf0, 0x05, 0x36, 0x18,
+    0x07, 0x06, 0x07, 0x05, 0x09, 0xf4, 0x0b, 0x0d, 0x0b, 0x19, 0x0b, 0x0c,
+    0x09, 0x0b, 0xf0, 0x19, 0x08, 0x0a, 0x0b, 0x0a, 0x0b, 0x24, 0x09, 0x08,
+    0x06, 0xb5, 0x67, 0xf0, 0x08, 0x09, 0x0b, 0x0a, 0x1c, 0xf4, 0x1b, 0x0a,
+    0x19, 0x0a, 0x0c, 0x0b, 0x0a, 0xf0, 0x0b, 0x0c, 0x2e, 0x1a, 0x95, 0x0c,
+    0x0b, 0x4a, 0x0b, 0x0e, 0xf4, 0xf0, 0x1d, 0x2e, 0x0c, 0x0d, 0x0c, 0x1b,
+    0x0a, 0x09, 0x1b, 0x2c, 0xf4, 0xf0, 0x0b, 0x0c, 0x2b, 0x1a, 0x0b, 0x0d,
+    0x0e, 0x1c, 0x1d, 0x2e, 0x24, 0xf0, 0x0a, 0xb5, 0x0b, 0x1a, 0x1b, 0x1a,
+    0x19, 0x18, 0x0b, 0x34, 0x0a, 0xf0, 0x19, 0x1d, 0xf3, 0x0c, 0x1b, 0x0a,
+    0x38, 0x19, 0x18, 0xf0, 0x09, 0x68, 0xf3, 0x19, 0x08, 0x59, 0xf0, 0x3a,
+    0xb3, 0x0b, 0x0a, 0x19, 0x1a, 0x0b, 0x0c, 0x0d, 0x19, 0x84, 0xf0, 0x0a,
+    0x0b, 0x0c, 0x0b, 0x0d, 0x1e, 0x0a, 0x15, 0x0e, 0x2b, 0x46, 0x1a, 0x1d,
+    0xf5, 0xf0, 0x1e, 0x0d, 0x0c, 0x2d, 0x0e, 0x1d, 0x4e, 0x05, 0x2a, 0x66,
+    0xf0, 0x0b, 0x0d, 0x0c, 0x0a, 0x08, 0x07, 0x07, 0x08, 0x56, 0x49, 0x08,
+    0x05, 0x09, 0x34, 0x1b, 0xf0, 0x0a, 0x09, 0x93, 0x0e, 0x0c, 0x0b, 0x1c,
+    0x3b, 0x0c, 0xf4, 0x09, 0x1a, 0xf0, 0x2b, 0x1c, 0x0e, 0x0d, 0x1b, 0x0a,
+    0x39, 0x04, 0xf3, 0x1e, 0xf0, 0x2c, 0x1b, 0x3a, 0x0b, 0x1a, 0x19, 0xf3,
+    0x2a, 0xf0, 0x09, 0x1a, 0x09, 0x2a, 0x0b, 0x0a, 0x0b, 0x1a, 0x3b, 0xe3,
+    0xf0, 0x3a, 0x09, 0x2a, 0x0b, 0x2c, 0x44, 0x09, 0x0a, 0x09, 0xf0, 0x0a,
+    0x0b, 0x25, 0x09, 0x0a, 0x0b, 0x36, 0x5a, 0x17, 0x96, 0x3b, 0x0a, 0xf0,
+    0x1c, 0x2b, 0x45, 0x0d, 0x1c, 0x0b, 0x0a, 0x84, 0x1d, 0x0c, 0x0b, 0x0a,
+    0x09, 0xf0, 0x08, 0x17, 0xf3, 0x19, 0x0a, 0x19, 0x08, 0x09, 0x0a, 0x09,
+    0x0a, 0x0b, 0x19, 0xf0, 0x1b, 0x0a, 0x03, 0x0b, 0x24, 0x19, 0x08, 0x05,
+    0x37, 0x96, 0x08, 0x29, 0x0a, 0xf0, 0x1b, 0x07, 0x39, 0x18, 0x07, 0x18,
+    0x18, 0x07, 0x09, 0x06, 0x0a, 0x35, 0x0d, 0x0c, 0x0b, 0x0a, 0x24, 0x0c,
+    0x0a, 0xf0, 0x09, 0xb3, 0x0d, 0x0b, 0x0a, 0x39, 0x48, 0x64, 0x66, 0xf0,
+    0xf3, 0x29, 0x1a, 0x19, 0x2a, 0x0b, 0x5c, 0xf0, 0x43, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x54, 0x0a, 0x1b, 0x0c, 0x1e, 0xb5, 0x0a, 0xf0, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x0d, 0x0e, 0x0d, 0x1c, 0x0b, 0x0a, 0x54, 0x0d, 0x0c, 0x0b, 0x1a,
+    0xf0, 0x09, 0x53, 0x0d, 0x0c, 0x1b, 0x19, 0x64, 0x66, 0xa3, 0x08, 0x39,
+    0xf0, 0x1a, 0x0c, 0x0e, 0x1f, 0x24, 0x0b, 0x0d, 0x0e, 0xf5, 0x0a, 0x2b,
+    0xf0, 0x1c, 0x2e, 0x0d, 0x3e, 0x2d, 0x55, 0x0e, 0x0d, 0x1e, 0xf0, 0x0d,
+    0x46, 0x3a, 0x0b, 0x85, 0x1e, 0x1d, 0x2b, 0x0a, 0x09, 0xf0, 0xe4, 0x0c,
+    0x0d, 0x0c, 0x0e, 0x0d, 0x0c, 0x1b, 0x3c, 0x0d, 0x1e, 0x55, 0x1a, 0xf0,
+    0x1b, 0x1d, 0x94, 0x3f, 0x1e, 0x0d, 0x1c, 0x0b, 0xf3, 0x0f, 0xf0, 0x0e,
+    0x1d, 0x0c, 0x2b, 0x3a, 0x19, 0x0a, 0x59, 0xf3, 0xf0, 0x1a, 0x09, 0x6a,
+    0x4b, 0x93, 0xf0, 0x0c, 0x1d, 0x2e, 0x14, 0x19, 0xf3, 0x3e, 0x3d, 0xf0,
+    0x2c, 0x0b, 0x0c, 0x0b, 0x0c, 0x2b, 0xa3, 0x0c, 0x0b, 0x0c, 0xf0, 0x2d,
+    0x2e, 0xb4, 0x09, 0x1a, 0x0b, 0x1c, 0x1d, 0x3e, 0xf0, 0x25, 0x2a, 0x06,
+    0x08, 0xc7, 0xc7, 0xf0, 0x18, 0x16, 0x3a, 0x35, 0x1e, 0xf4, 0x0d, 0x0c,
+    0x0b, 0x0a, 0xb9, 0xf0, 0xf4, 0x08, 0xb9, 0xf0, 0x2a, 0x94, 0x0b, 0x1c,
+    0x2d, 0xf0, 0x1e, 0x1a, 0x35, 0x19, 0x0d, 0x44, 0x1c, 0x1b, 0x2f, 0xf3,
+    0x0e, 0xf0, 0x1d, 0x4c, 0x3b, 0x2c, 0xe3, 0x1b, 0xb0, 0x4c, 0x0b, 0x0c,
+    0x0d, 0x2e, 0x1a, 0xf2, 0xf1, 0x1b, 0x3c, 0x1b, 0x9a, 0xf2, 0xf1, 0x0b,
+    0x0a, 0x2b, 0x5c, 0x5b, 0xf2, 0xf1, 0x3a, 0x1b, 0x0a, 0x1b, 0x6c, 0xf2,
+    0xf1, 0x8d, 0x4c, 0xf2, 0xf1, 0x6d, 0x2e, 0x0d, 0xde, 0xf2, 0xf1, 0x1d,
+    0x5e, 0xf2, 0xf1, 0x1d, 0x0e, 0x2d, 0x6c, 0xf2, 0xf1, 0x2d, 0x7e, 0x2d,
+    0x2c, 0xf2, 0xf1, 0x2b, 0xfa, 0xf2, 0xf1, 0xfa, 0xf2, 0xf1, 0x5a, 0xcb,
+    0xf2, 0xf1, 0xfc, 0xf2, 0xf1, 0xfc, 0x72, 0xf1, 0xf7, 0xf3, 0xc1, 0x47,
+    0x43, 0x07, 0x03, 0x01
+};
@@ -0,0 +1,338 @@
+const uint8_t build_fence_sound [] = {
+    0xfa, 0xf3, 0xf0, 0xfa, 0xf3, 0xf0, 0xda, 0xf3, 0xf0, 0x19, 0x0a, 0xf3,
+    0xf0, 0xf9, 0xf3, 0xf0, 0x59, 0x2a, 0x19, 0x2a, 0x19, 0xf3, 0xf0, 0x1a,
+    0xe9, 0xf3, 0xf0, 0x18, 0x99, 0x1a, 0x19, 0xf3, 0xf0, 0x2a, 0x49, 0x68,
+    0x03, 0xf0, 0x46, 0x44, 0x49, 0xf3, 0x1a, 0x19, 0x0a, 0x0b, 0xf0, 0x0c,
+    0x2a, 0x1b, 0xf3, 0x49, 0x18, 0x19, 0x38, 0xf0, 0x09, 0x08, 0x07, 0xf3,
+    0x18, 0x39, 0x1a, 0x19, 0xf0, 0x0a, 0x0b, 0x0a, 0x09, 0x08, 0x09, 0xf3,
+    0x0b, 0x0a, 0x19, 0x0a, 0x2b, 0x0a, 0x2b, 0xf0, 0x4a, 0xf3, 0x19, 0x2a,
+    0x19, 0x1a, 0xf0, 0x69, 0xa3, 0x0a, 0x2c, 0x0b, 0x0c, 0x0d, 0x0b, 0x09,
+    0xf0, 0x06, 0x04, 0x15, 0x15, 0x04, 0x06, 0xd3, 0x28, 0x09, 0x4a, 0x39,
+    0xf0, 0x08, 0xc2, 0x0c, 0x0a, 0x0b, 0x0d, 0x0c, 0x0a, 0x09, 0x0b, 0x0e,
+    0x0f, 0x0e, 0x0d, 0x0f, 0x33, 0x1d, 0xf0, 0x0b, 0x0c, 0x44, 0x0a, 0x0d,
+    0x0c, 0x0b, 0x1d, 0x05, 0x06, 0x0b, 0x05, 0x0c, 0x14, 0x0d, 0x0c, 0x15,
+    0x0a, 0x2b, 0x04, 0xf0, 0xb3, 0x0a, 0x0c, 0x0e, 0x0b, 0x19, 0x0a, 0x0b,
+    0x0a, 0x09, 0x0a, 0x14, 0x19, 0x23, 0x0b, 0x09, 0xf0, 0x0b, 0x14, 0x0a,
+    0x19, 0x03, 0x12, 0x0a, 0x0e, 0x13, 0x1d, 0x42, 0x0e, 0x0b, 0x0d, 0x0f,
+    0x0d, 0x41, 0x0e, 0x0b, 0x1e, 0xf0, 0x0a, 0x10, 0x0e, 0x0f, 0x21, 0x0b,
+    0x0f, 0x0a, 0x10, 0x1f, 0x81, 0x0a, 0x0d, 0x09, 0x07, 0x08, 0x0c, 0x0f,
+    0xf0, 0x1e, 0x02, 0x09, 0x13, 0x18, 0x12, 0x09, 0x08, 0x03, 0x07, 0x04,
+    0x06, 0x03, 0x27, 0x22, 0x0a, 0x13, 0x09, 0x08, 0x12, 0x0c, 0xf0, 0x0d,
+    0x63, 0x09, 0x0b, 0x09, 0x18, 0x19, 0x72, 0x0c, 0x1a, 0x0c, 0x0d, 0x1b,
+    0x0d, 0xf0, 0x33, 0x09, 0x0a, 0x19, 0x64, 0x08, 0x39, 0x0a, 0x0c, 0x65,
+    0x2a, 0x1b, 0xf0, 0x19, 0x16, 0x38, 0x05, 0x04, 0x93, 0x4a, 0x09, 0x1a,
+    0x0b, 0x0e, 0xf0, 0xb4, 0x0a, 0x0c, 0x0b, 0x0a, 0x0b, 0x0c, 0x0e, 0x0d,
+    0x0a, 0x09, 0x0a, 0x0c, 0x05, 0x0a, 0x86, 0x38, 0xc0, 0x09, 0x4a, 0x07,
+    0x08, 0x1b, 0x0a, 0x1c, 0x0c, 0x0e, 0x0b, 0x0f, 0x0c, 0x08, 0xa1, 0x1d,
+    0x09, 0x0a, 0x1b, 0x3b, 0x0c, 0x0b, 0x08, 0x0c, 0x07, 0x0b, 0x09, 0x09,
+    0x0c, 0x08, 0x0b, 0x0f, 0xf0, 0x09, 0x0d, 0x18, 0x0c, 0x0d, 0x09, 0x2c,
+    0x08, 0x06, 0x15, 0x1b, 0x16, 0x3a, 0x85, 0x0b, 0x0a, 0x19, 0xf0, 0x0a,
+    0x0b, 0x09, 0x04, 0x0a, 0x13, 0x0c, 0x0e, 0x24, 0x0c, 0x0d, 0x0a, 0xd3,
+    0x1c, 0x0d, 0x1c, 0x3b, 0xf0, 0x1a, 0x0b, 0x0c, 0x09, 0xf2, 0x0b, 0x0a,
+    0x1b, 0x09, 0x18, 0x09, 0x1a, 0xf0, 0x0b, 0x1e, 0x0d, 0x1c, 0x62, 0x1e,
+    0x0b, 0x19, 0x0a, 0x08, 0x31, 0x0c, 0x0a, 0xf0, 0x0b, 0x0a, 0xa0, 0x0f,
+    0x0e, 0x0c, 0x0b, 0x2a, 0x0b, 0x0d, 0x1e, 0x11, 0x08, 0x0b, 0x42, 0x08,
+    0xf0, 0x2a, 0x0e, 0xa3, 0x0c, 0x0e, 0x1c, 0x1e, 0x0d, 0x0b, 0x0c, 0x0b,
+    0x09, 0x42, 0x0c, 0xf0, 0x1a, 0x1b, 0x21, 0x0f, 0x0b, 0x0d, 0x12, 0x19,
+    0xb1, 0x0e, 0x0c, 0x0d, 0x1f, 0x0d, 0x0c, 0xf0, 0x0e, 0x0f, 0x0e, 0x0c,
+    0x0e, 0x02, 0x09, 0x43, 0x08, 0x29, 0x0d, 0x74, 0x0b, 0x1d, 0x0e, 0x17,
+    0x91, 0x08, 0x2b, 0x05, 0x16, 0x0e, 0x08, 0x0d, 0x0b, 0x0e, 0x0c, 0x0f,
+    0x0e, 0x19, 0x52, 0x0f, 0x1d, 0x1b, 0x0e, 0x0c, 0x0d, 0x0a, 0x0b, 0x0f,
+    0x41, 0x1a, 0x0d, 0x0a, 0x0b, 0x08, 0x1a, 0x07, 0x1d, 0xf0, 0x08, 0x17,
+    0x0c, 0x2b, 0x06, 0x05, 0x94, 0x1e, 0x0c, 0x0b, 0x1a, 0x2b, 0x0c, 0x05,
+    0x1a, 0xf0, 0x46, 0x1b, 0x0c, 0x0e, 0x07, 0x0d, 0x18, 0x0c, 0x0b, 0x17,
+    0x1c, 0x18, 0x0a, 0x09, 0x17, 0x0a, 0x1b, 0x28, 0x0d, 0xf0, 0x1b, 0x07,
+    0x36, 0x1d, 0x0e, 0x1b, 0x05, 0x44, 0x1c, 0x0d, 0x0b, 0x09, 0x13, 0x0b,
+    0x09, 0x52, 0x0b, 0x09, 0xf0, 0x08, 0x07, 0x06, 0x05, 0x71, 0x37, 0x38,
+    0xf0, 0x0d, 0x2a, 0xf0, 0x09, 0x06, 0x05, 0x44, 0x15, 0x06, 0x07, 0x20,
+    0x18, 0x09, 0x31, 0x06, 0xf0, 0x07, 0x08, 0x0c, 0xf2, 0x08, 0x29, 0x1a,
+    0x19, 0x0a, 0x09, 0x08, 0x37, 0xf0, 0x06, 0xa1, 0x18, 0x09, 0x1b, 0x09,
+    0x08, 0x0a, 0x0c, 0x0d, 0x0f, 0x42, 0x0a, 0x2b, 0xe0, 0x0f, 0x13, 0x0c,
+    0x0f, 0x04, 0x0e, 0x25, 0x1a, 0x0b, 0x06, 0x0c, 0x08, 0x0e, 0x0b, 0x0d,
+    0x1e, 0x0e, 0x0f, 0x1c, 0x08, 0xf1, 0x09, 0x2d, 0x0b, 0x1d, 0x0e, 0x0c,
+    0x0c, 0x1b, 0x0b, 0x0c, 0x2c, 0x0d, 0x2e, 0x1d, 0x0c, 0x0c, 0x1a, 0x1d,
+    0x0c, 0x1c, 0x81, 0x2d, 0x0b, 0x0a, 0x1e, 0x09, 0x28, 0x2c, 0x07, 0x0a,
+    0x0e, 0xf0, 0x08, 0x0c, 0x07, 0x1a, 0x06, 0x05, 0x0b, 0x24, 0x0e, 0x0c,
+    0x09, 0x93, 0x3c, 0x1b, 0x0a, 0x19, 0xf0, 0x0c, 0xb4, 0x39, 0x0a, 0x1b,
+    0x1a, 0x0b, 0x0a, 0x09, 0x43, 0x0e, 0x0c, 0x1b, 0xf0, 0x0a, 0x52, 0x0e,
+    0x0b, 0x19, 0x08, 0x07, 0xa1, 0x0b, 0x0a, 0x1b, 0x2a, 0x0b, 0xf0, 0x1c,
+    0x0e, 0x52, 0x08, 0x19, 0x1a, 0x0c, 0x63, 0x18, 0x07, 0x08, 0x1a, 0x09,
+    0xf0, 0xf2, 0x1e, 0x1f, 0x1e, 0x1f, 0x0e, 0x1c, 0x0d, 0x0c, 0x3a, 0xf0,
+    0x22, 0x0b, 0x09, 0xf1, 0x0f, 0x0e, 0x1f, 0x0e, 0x0b, 0x0c, 0x0d, 0x0c,
+    0x0a, 0x0b, 0x0d, 0x3e, 0xf0, 0x81, 0x0f, 0x0e, 0x1c, 0x1f, 0x1e, 0x0f,
+    0xe2, 0x0a, 0x0d, 0x0b, 0x19, 0xf0, 0x0b, 0x0e, 0x0d, 0x1a, 0x0e, 0x1f,
+    0x0e, 0x0f, 0xd3, 0x0b, 0x0c, 0x0a, 0x18, 0xf0, 0x09, 0x0b, 0x0a, 0x09,
+    0x0a, 0x0d, 0x2f, 0x04, 0x0e, 0x36, 0x0b, 0x0d, 0x3c, 0x07, 0x19, 0xf0,
+    0x0d, 0x18, 0x1c, 0x0a, 0x0d, 0x1e, 0x0e, 0x0d, 0x0c, 0x0c, 0x0d, 0x0b,
+    0x1f, 0x3a, 0x0d, 0x1a, 0x2b, 0x0b, 0x0a, 0x18, 0x0c, 0xf0, 0x0b, 0x09,
+    0x5c, 0x1b, 0x09, 0x28, 0x0d, 0x07, 0x0e, 0x16, 0x1d, 0x17, 0x0c, 0x0b,
+    0x16, 0x0c, 0x0b, 0x07, 0x1c, 0xf0, 0x0a, 0x0d, 0x0d, 0x0b, 0x1e, 0x18,
+    0x0c, 0x19, 0x0d, 0x1c, 0x07, 0x05, 0x0d, 0x84, 0x0c, 0x2b, 0x2a, 0xf0,
+    0x0b, 0x1d, 0x05, 0x06, 0x0b, 0x15, 0x0d, 0x0c, 0x06, 0x0a, 0x07, 0x2b,
+    0x08, 0x07, 0x06, 0x19, 0x15, 0x0a, 0x07, 0x09, 0x0b, 0x17, 0x08, 0xf0,
+    0x06, 0x26, 0x15, 0x08, 0x15, 0x09, 0x08, 0x34, 0x05, 0x14, 0x05, 0x03,
+    0x06, 0x02, 0x07, 0x01, 0x0c, 0xf0, 0x0a, 0x18, 0xf0, 0x0a, 0x0f, 0x0e,
+    0x07, 0x15, 0x09, 0x0e, 0x08, 0x05, 0x04, 0x05, 0x46, 0x80, 0xf0, 0x05,
+    0x04, 0x06, 0x0e, 0x08, 0x01, 0x0c, 0x70, 0x17, 0x0c, 0x0f, 0x09, 0x04,
+    0x03, 0x71, 0x71, 0xb0, 0x03, 0x10, 0x04, 0x03, 0x01, 0x01, 0x02, 0xe0,
+    0x03, 0x02, 0x91, 0x03, 0x24, 0x05, 0x06, 0x07, 0x09, 0x0d, 0x0a, 0x12,
+    0x0f, 0x1a, 0x13, 0x01, 0x16, 0x84, 0x03, 0x14, 0x17, 0x13, 0x08, 0x0a,
+    0x04, 0x1c, 0x16, 0x0d, 0x05, 0x0a, 0x35, 0x06, 0x0b, 0x09, 0x0c, 0x0c,
+    0x0e, 0x0b, 0x0b, 0x86, 0x0a, 0x0d, 0x0c, 0x2f, 0x0f, 0x0d, 0x0a, 0x0d,
+    0x09, 0x0c, 0x0b, 0x1b, 0x0e, 0x0d, 0x0e, 0x35, 0x09, 0x0c, 0x08, 0x0b,
+    0x0d, 0x09, 0x0f, 0x0c, 0x04, 0x0b, 0x0f, 0x43, 0x07, 0x0e, 0x26, 0x0d,
+    0x0a, 0x07, 0x05, 0x08, 0x02, 0x14, 0x0e, 0x41, 0x0d, 0x05, 0x0c, 0x06,
+    0x0a, 0x15, 0x09, 0x3f, 0xf0, 0x06, 0x0b, 0x0f, 0x0d, 0x1e, 0x09, 0x0a,
+    0x1d, 0x0d, 0x0b, 0x1c, 0x07, 0x06, 0x0b, 0x25, 0x0e, 0x0d, 0x0b, 0x04,
+    0x0e, 0x05, 0x0d, 0x07, 0x0c, 0xf0, 0x09, 0x0a, 0x08, 0x49, 0x07, 0x08,
+    0x1a, 0x08, 0x08, 0x05, 0x09, 0x24, 0x0a, 0x0b, 0x0a, 0x23, 0x0b, 0x0a,
+    0x0d, 0x14, 0x0b, 0x0a, 0xf0, 0x03, 0x0b, 0x52, 0x0e, 0x1d, 0x0e, 0x0f,
+    0x0d, 0x21, 0x0f, 0x1e, 0x02, 0x0b, 0x13, 0x2a, 0x02, 0x11, 0x1b, 0xf0,
+    0x02, 0x09, 0x13, 0x0a, 0x19, 0x52, 0x07, 0x08, 0x0b, 0x0c, 0x09, 0x21,
+    0x0c, 0x09, 0x08, 0x10, 0x0c, 0x0b, 0x01, 0x1a, 0x12, 0xf0, 0x09, 0x01,
+    0x08, 0x00, 0x0b, 0x01, 0x08, 0x12, 0x09, 0x0a, 0x01, 0x08, 0x10, 0x17,
+    0x71, 0x05, 0x06, 0x05, 0x24, 0x23, 0xf0, 0x02, 0x13, 0x04, 0x05, 0x01,
+    0x06, 0x10, 0x07, 0x08, 0x01, 0x0a, 0x02, 0x07, 0x01, 0x06, 0xa0, 0x35,
+    0x04, 0x05, 0xf0, 0x06, 0x08, 0x05, 0x03, 0x24, 0x21, 0x43, 0x10, 0x01,
+    0x02, 0x01, 0x04, 0x10, 0x05, 0x07, 0x11, 0x08, 0x20, 0x0a, 0x10, 0x0f,
+    0x09, 0x51, 0x01, 0x0c, 0x13, 0x0a, 0x09, 0x12, 0x0a, 0x0f, 0x04, 0x0c,
+    0x42, 0x19, 0x0d, 0x1e, 0x06, 0x05, 0x0f, 0x07, 0x0e, 0x03, 0x0e, 0x0b,
+    0x04, 0x0d, 0x09, 0x25, 0x08, 0x0a, 0x07, 0x0e, 0x0b, 0x2c, 0x06, 0x0f,
+    0x07, 0x0c, 0x18, 0x18, 0x1e, 0x09, 0x0e, 0x0d, 0x1a, 0x0f, 0x0e, 0x0a,
+    0x0b, 0x09, 0x16, 0x0a, 0x08, 0x0c, 0x07, 0x0a, 0x0e, 0x16, 0x0e, 0x0c,
+    0x08, 0x0d, 0x45, 0x15, 0x1b, 0x18, 0x09, 0x08, 0x05, 0x09, 0x04, 0x04,
+    0x0a, 0x23, 0x05, 0x08, 0x17, 0x07, 0x08, 0x02, 0x04, 0x0c, 0x31, 0x03,
+    0x1a, 0x04, 0x08, 0x08, 0x0b, 0x0e, 0xf0, 0x07, 0x0c, 0x15, 0x0b, 0x0c,
+    0x06, 0x1e, 0x17, 0x0c, 0x06, 0x1e, 0x07, 0x09, 0x0c, 0x18, 0x0d, 0x0e,
+    0x0c, 0x1d, 0x0f, 0x0d, 0x1c, 0x07, 0x16, 0x0b, 0xf0, 0x0d, 0x07, 0x0b,
+    0x06, 0x0a, 0x04, 0x0b, 0x23, 0x0d, 0x0c, 0x09, 0x02, 0x0a, 0x31, 0x0d,
+    0x1b, 0x09, 0x20, 0x0e, 0x09, 0x0b, 0x21, 0x17, 0xf0, 0x05, 0xf0, 0x06,
+    0x05, 0x06, 0x07, 0x35, 0x06, 0x15, 0x06, 0x07, 0x28, 0xf0, 0x00, 0x0a,
+    0x41, 0x08, 0x0c, 0x0a, 0x08, 0x09, 0x32, 0x08, 0x0d, 0x0e, 0x0c, 0x03,
+    0x08, 0x04, 0x39, 0x25, 0x90, 0x06, 0x0b, 0x17, 0x3d, 0x16, 0x08, 0x1c,
+    0x0a, 0x29, 0x0d, 0x06, 0xf1, 0x07, 0x0b, 0x08, 0x0c, 0x09, 0x1b, 0x2a,
+    0x1e, 0x0b, 0x2d, 0x4c, 0x1e, 0x0c, 0x0d, 0x1b, 0x0e, 0x0f, 0x1d, 0x19,
+    0xf2, 0x0a, 0x0a, 0x09, 0x0c, 0x0c, 0x3e, 0x0f, 0x0e, 0x1a, 0x1d, 0x0d,
+    0x0f, 0x0b, 0x0e, 0x0a, 0x0c, 0x08, 0x0b, 0x17, 0x0d, 0x0f, 0x06, 0x0c,
+    0x09, 0x31, 0x09, 0x08, 0x0a, 0x07, 0x0e, 0x06, 0x0a, 0x1c, 0xf0, 0x06,
+    0x34, 0x0b, 0x0a, 0x1c, 0x03, 0x0b, 0x12, 0x0d, 0x0f, 0x13, 0x2e, 0x42,
+    0x19, 0x0a, 0x18, 0x01, 0xf0, 0xa0, 0x09, 0x0a, 0x0d, 0x0a, 0x06, 0x05,
+    0x06, 0x0a, 0x0d, 0x0a, 0x0d, 0x01, 0x0a, 0x62, 0x08, 0x09, 0x08, 0x07,
+    0xf0, 0x18, 0x07, 0x71, 0x0a, 0x08, 0x09, 0x0b, 0x09, 0x07, 0x06, 0x07,
+    0x12, 0x05, 0x44, 0x71, 0xf0, 0x03, 0x02, 0x11, 0x02, 0xf0, 0x01, 0x60,
+    0x11, 0xf0, 0x10, 0x41, 0xb0, 0x02, 0x33, 0x04, 0x07, 0x18, 0x50, 0x0e,
+    0x0d, 0x01, 0x0c, 0x02, 0x09, 0x03, 0x07, 0x04, 0x08, 0x03, 0x41, 0x0d,
+    0x04, 0x0e, 0x06, 0x0b, 0x08, 0x08, 0x0e, 0x09, 0x0a, 0x02, 0x0d, 0x09,
+    0x23, 0x0f, 0x0d, 0x0e, 0x0f, 0x1a, 0x0c, 0x04, 0x1a, 0x05, 0x0e, 0x16,
+    0x1f, 0x0e, 0x0b, 0x17, 0x0b, 0x0d, 0x0a, 0x1c, 0x08, 0x0d, 0x09, 0x0f,
+    0x0b, 0x0b, 0x0d, 0x0d, 0x0c, 0x0c, 0x0e, 0x0e, 0x2f, 0x0c, 0x1f, 0x5f,
+    0x1e, 0x1e, 0x0d, 0x2f, 0x1c, 0x0e, 0x0b, 0x0c, 0x0d, 0x0a, 0x08, 0x2c,
+    0x09, 0x07, 0x08, 0x08, 0x07, 0x07, 0x2e, 0x06, 0x36, 0x05, 0x34, 0x0d,
+    0x0b, 0x15, 0x0a, 0x0b, 0x23, 0x06, 0x19, 0x07, 0x08, 0x0d, 0xe2, 0x07,
+    0x0c, 0x06, 0x0d, 0x07, 0x1e, 0x0a, 0x2c, 0x0d, 0x3c, 0x1d, 0x0e, 0x0b,
+    0x0c, 0x2a, 0x09, 0x0a, 0x0d, 0x09, 0x0b, 0x0e, 0xe1, 0x18, 0x3d, 0x0a,
+    0x1b, 0x2c, 0x09, 0x07, 0x06, 0x0b, 0x07, 0x1a, 0x38, 0x09, 0x08, 0x17,
+    0x06, 0x25, 0x0e, 0xf0, 0x1c, 0x04, 0x0b, 0x03, 0x29, 0x02, 0x01, 0xf0,
+    0x0e, 0x0d, 0x0b, 0x09, 0x07, 0x06, 0x34, 0xf0, 0x03, 0x02, 0x51, 0x40,
+    0xf0, 0x41, 0xf0, 0x12, 0x33, 0x04, 0x05, 0x06, 0x90, 0x07, 0x08, 0x09,
+    0x0b, 0x1e, 0x2f, 0xf0, 0x28, 0xb1, 0x09, 0x0c, 0x0d, 0x1e, 0x0d, 0x0b,
+    0x1c, 0x07, 0x32, 0x09, 0xf0, 0x1e, 0x07, 0x23, 0x08, 0x0b, 0x1a, 0x94,
+    0x19, 0x0a, 0x1e, 0x0c, 0x0b, 0x0c, 0x08, 0x05, 0x70, 0x07, 0x16, 0x19,
+    0x08, 0x0c, 0x09, 0x0d, 0x1b, 0x0b, 0x0a, 0x0e, 0x0c, 0x08, 0xf1, 0x1e,
+    0x0a, 0x79, 0x0a, 0x09, 0x0a, 0x1b, 0x08, 0x06, 0x15, 0x0a, 0x09, 0x04,
+    0x0a, 0x23, 0x0b, 0x0a, 0x09, 0x02, 0x0b, 0x51, 0xd1, 0x0d, 0x29, 0x08,
+    0x0e, 0xf0, 0x19, 0x0b, 0x0d, 0x0a, 0x28, 0x20, 0x0e, 0x09, 0x0a, 0x11,
+    0x08, 0x09, 0x20, 0x0e, 0x08, 0x09, 0xf0, 0x01, 0x08, 0x12, 0x17, 0x21,
+    0x08, 0x07, 0x09, 0x62, 0x28, 0x0a, 0x0e, 0x1f, 0x03, 0x0b, 0x04, 0x0c,
+    0x16, 0x0b, 0xf0, 0x0c, 0x05, 0x0e, 0x06, 0x0d, 0x0a, 0x1c, 0x1f, 0x1e,
+    0x0e, 0x0a, 0x1d, 0x09, 0x0b, 0x3e, 0x0c, 0x09, 0x08, 0x1a, 0x3d, 0x07,
+    0xf0, 0x06, 0x17, 0x0b, 0x0c, 0x06, 0x0e, 0x05, 0x0b, 0x33, 0x0d, 0x0a,
+    0x0e, 0x0d, 0x02, 0x0c, 0x81, 0x3f, 0x0e, 0x0a, 0xf0, 0x09, 0x0a, 0x09,
+    0xf0, 0x0e, 0x1b, 0x0a, 0x08, 0x07, 0x08, 0x1c, 0x09, 0x08, 0x09, 0x1f,
+    0xf0, 0x0d, 0x0b, 0x00, 0x0f, 0x41, 0x0a, 0x0b, 0x19, 0x0c, 0x72, 0x09,
+    0x0a, 0x09, 0x0b, 0x0e, 0x0f, 0x0d, 0xf0, 0x0e, 0x23, 0x0a, 0x0e, 0x0c,
+    0x22, 0x0f, 0x0c, 0x0d, 0x03, 0x1b, 0x14, 0x0a, 0x03, 0x09, 0x12, 0x0a,
+    0x0e, 0x03, 0x1f, 0x14, 0x0e, 0xf0, 0x23, 0x0c, 0x08, 0x09, 0x14, 0x08,
+    0x09, 0x03, 0x0b, 0x42, 0x0e, 0x1a, 0x0b, 0x0e, 0x03, 0x0a, 0x14, 0x0b,
+    0x0d, 0x13, 0x0f, 0x0e, 0xf0, 0x04, 0x0b, 0x06, 0x0a, 0x08, 0x19, 0x06,
+    0x14, 0x0a, 0x09, 0x05, 0x0a, 0x17, 0x19, 0x06, 0x0a, 0x25, 0x1b, 0x0c,
+    0x06, 0x1a, 0x27, 0x0b, 0xf0, 0x0a, 0x06, 0x09, 0x45, 0x1a, 0x0b, 0x1c,
+    0x44, 0x0e, 0x3a, 0x13, 0x0c, 0x09, 0x02, 0x0a, 0x91, 0x0e, 0xf0, 0x0c,
+    0x0e, 0x0b, 0x08, 0x16, 0x07, 0x09, 0x08, 0x40, 0x0d, 0x09, 0x17, 0x0b,
+    0x01, 0x0f, 0x02, 0x0a, 0xf0, 0x01, 0x08, 0x00, 0x09, 0x01, 0x27, 0x03,
+    0x05, 0x03, 0x28, 0x01, 0x80, 0x09, 0x0b, 0x09, 0x0a, 0x1f, 0x0c, 0x0f,
+    0x00, 0x01, 0x09, 0x51, 0x03, 0x0a, 0x14, 0x0e, 0x0c, 0x13, 0x0b, 0x0f,
+    0x07, 0x09, 0x62, 0x0f, 0x0b, 0x0e, 0x0a, 0x06, 0x09, 0x15, 0x27, 0x16,
+    0x1b, 0xf1, 0x15, 0x0d, 0x06, 0x0e, 0x05, 0x0d, 0x13, 0x0e, 0x0f, 0x07,
+    0x1e, 0x0f, 0x0d, 0x0c, 0x06, 0x1a, 0x04, 0x06, 0x09, 0x0b, 0x08, 0x08,
+    0x07, 0x04, 0x06, 0x13, 0x05, 0x01, 0x0b, 0xf0, 0x04, 0x19, 0x03, 0x12,
+    0x18, 0x13, 0x27, 0x02, 0x11, 0x09, 0x0e, 0x12, 0x0c, 0x0a, 0x01, 0x08,
+    0x00, 0x0e, 0x01, 0x1a, 0x02, 0x03, 0x17, 0xf0, 0x02, 0x11, 0x09, 0x1c,
+    0x12, 0x0b, 0x11, 0x0a, 0x19, 0x02, 0x03, 0x0a, 0x02, 0x1e, 0x11, 0x0d,
+    0x02, 0x0b, 0x14, 0x28, 0x13, 0xf0, 0x0a, 0x14, 0x1c, 0x13, 0x0a, 0x09,
+    0x04, 0x0b, 0x16, 0x0c, 0x0a, 0x04, 0x29, 0x03, 0x04, 0x16, 0x0a, 0x0b,
+    0x04, 0x0a, 0x33, 0x09, 0x08, 0xf0, 0x09, 0x08, 0x52, 0x1d, 0x1f, 0x0b,
+    0x09, 0x03, 0x18, 0x14, 0x07, 0x03, 0x06, 0xc2, 0x07, 0x09, 0x0e, 0x0f,
+    0xf0, 0x0e, 0x0d, 0x0a, 0x09, 0x07, 0x06, 0x17, 0x06, 0x11, 0x08, 0x09,
+    0x02, 0x18, 0xc3, 0x19, 0x08, 0xf0, 0x09, 0x0a, 0x0c, 0x1b, 0x0e, 0x0f,
+    0x1e, 0x04, 0x0a, 0x05, 0x0c, 0x07, 0x0d, 0x08, 0x0e, 0x09, 0x0d, 0x0a,
+    0x0e, 0x0c, 0x0f, 0x00, 0x0d, 0x09, 0x51, 0x1e, 0x0a, 0x0b, 0x0f, 0x1a,
+    0x0e, 0x0c, 0x08, 0x09, 0x0f, 0xf0, 0x08, 0x1c, 0x07, 0x18, 0x1d, 0x06,
+    0x0b, 0x15, 0x1a, 0x06, 0x0b, 0x17, 0x0d, 0x1e, 0x16, 0x0c, 0x07, 0x0d,
+    0x19, 0x6b, 0x0a, 0xf0, 0x0e, 0x0d, 0x08, 0x16, 0x2a, 0x07, 0x19, 0x09,
+    0x06, 0x18, 0x14, 0x09, 0x06, 0x08, 0x08, 0x09, 0x07, 0x0a, 0x05, 0x0b,
+    0x04, 0x0e, 0xf0, 0x05, 0x0c, 0x06, 0x0d, 0x07, 0x0e, 0x09, 0x0d, 0x0a,
+    0x3e, 0x09, 0x07, 0x06, 0x07, 0x0d, 0x0b, 0x1e, 0x0f, 0x0e, 0x1b, 0x07,
+    0x06, 0x0a, 0x08, 0x0b, 0x0e, 0x1c, 0xf0, 0x0d, 0x09, 0x0b, 0x17, 0x1d,
+    0x08, 0x2c, 0x09, 0x0b, 0x0a, 0x0d, 0x08, 0x0b, 0x06, 0x1a, 0x15, 0x1b,
+    0x26, 0x0c, 0x0b, 0x05, 0x0c, 0xf0, 0x54, 0x0d, 0x2a, 0x09, 0x18, 0x03,
+    0x02, 0x09, 0x91, 0x1e, 0x0f, 0x0c, 0x09, 0x07, 0x06, 0x27, 0xf0, 0xf0,
+    0x09, 0x17, 0x08, 0x07, 0x15, 0x06, 0x07, 0x25, 0x08, 0x0b, 0xf0, 0x08,
+    0x05, 0x00, 0x04, 0x21, 0x03, 0x14, 0x50, 0x15, 0x07, 0x19, 0x0a, 0x01,
+    0x28, 0x02, 0x03, 0x12, 0x0a, 0xf0, 0x18, 0x03, 0x15, 0x0a, 0x0d, 0x04,
+    0x0c, 0x03, 0x0e, 0x04, 0x1b, 0x06, 0x07, 0x2d, 0x06, 0x05, 0x06, 0x0b,
+    0x17, 0x0c, 0x0b, 0x36, 0x1a, 0xe0, 0x0c, 0x0e, 0x05, 0x0c, 0x13, 0x0e,
+    0x1d, 0x04, 0x16, 0x3a, 0x15, 0x06, 0x0d, 0x08, 0x1e, 0x09, 0x17, 0x0f,
+    0x08, 0xf1, 0x08, 0x09, 0x09, 0x0a, 0x07, 0x0b, 0x06, 0x0e, 0x08, 0x0d,
+    0x0c, 0x0c, 0x0a, 0x1d, 0x08, 0x09, 0x0c, 0x0e, 0x0e, 0x1f, 0x1f, 0x0c,
+    0x0e, 0x09, 0x0d, 0x0a, 0x0a, 0x0c, 0x09, 0x41, 0x0d, 0x38, 0x0c, 0x0d,
+    0x0a, 0x18, 0x0f, 0xf0, 0x0e, 0x0a, 0x0c, 0x0d, 0x0a, 0x0e, 0x19, 0x1d,
+    0x08, 0x0c, 0x27, 0x1b, 0x0e, 0x26, 0x0d, 0x0c, 0x0d, 0x05, 0x0a, 0x04,
+    0x0b, 0xb3, 0x0d, 0xf0, 0x1f, 0x0c, 0x0a, 0x09, 0x0a, 0x2b, 0x08, 0x1c,
+    0x62, 0x0d, 0x0b, 0x19, 0xf0, 0x08, 0x0b, 0x01, 0x0f, 0xf0, 0x2e, 0x09,
+    0x06, 0x15, 0x06, 0x07, 0x06, 0x15, 0x26, 0xf0, 0x05, 0xf0, 0x66, 0x07,
+    0x16, 0x35, 0xf0, 0x24, 0xd0, 0x05, 0x06, 0x05, 0x14, 0x15, 0x04, 0x33,
+    0xf0, 0x31, 0x31, 0x40, 0x42, 0x01, 0x01, 0xd0, 0x43, 0x14, 0xf0, 0x15,
+    0x07, 0x09, 0x1b, 0x0e, 0x01, 0x09, 0x32, 0x08, 0x0a, 0x09, 0x0c, 0x03,
+    0x1e, 0x34, 0x0c, 0xa0, 0x09, 0x0b, 0x06, 0x0a, 0x07, 0x0b, 0x06, 0x0c,
+    0x05, 0x0d, 0x06, 0x0e, 0x09, 0x0d, 0x0a, 0x1e, 0x19, 0x16, 0x61, 0x0a,
+    0x0b, 0x07, 0x0c, 0x08, 0x0a, 0x09, 0x08, 0x0a, 0x09, 0x0b, 0x1d, 0x07,
+    0x62, 0x08, 0x09, 0x09, 0x17, 0x0a, 0x0b, 0x08, 0x1d, 0x09, 0x07, 0x19,
+    0x73, 0x16, 0x2a, 0x08, 0x1a, 0x0b, 0x09, 0x0c, 0x0a, 0x0d, 0x0e, 0x09,
+    0xf4, 0x0f, 0x0a, 0x0e, 0x1c, 0x1b, 0x1e, 0x0d, 0x0c, 0x0d, 0x1b, 0x2e,
+    0x1a, 0x0c, 0x09, 0x0d, 0x08, 0x0c, 0x76, 0x0d, 0x0b, 0x0c, 0x3b, 0xb4,
+    0x1c, 0x18, 0x0e, 0x17, 0x0c, 0x0d, 0x09, 0x0e, 0x1e, 0x0d, 0x0b, 0x0a,
+    0x0e, 0x13, 0x08, 0x0a, 0x0a, 0x0d, 0x22, 0x0f, 0x0a, 0x0e, 0x08, 0x07,
+    0x0c, 0x21, 0x15, 0x09, 0x08, 0x07, 0x0c, 0xf0, 0x06, 0x0b, 0x15, 0x09,
+    0x07, 0x06, 0x06, 0x08, 0x05, 0x29, 0x04, 0x33, 0x1c, 0x0f, 0x52, 0x2d,
+    0x0b, 0x08, 0xf0, 0x0a, 0x11, 0x08, 0x0e, 0xf0, 0x09, 0x07, 0x46, 0x07,
+    0x08, 0x19, 0x0b, 0x0e, 0xf0, 0x1f, 0x1e, 0xf0, 0x2f, 0x0c, 0x0a, 0x0e,
+    0x0f, 0x0b, 0x37, 0xf0, 0x06, 0x14, 0xf0, 0x16, 0x15, 0x06, 0x18, 0x06,
+    0x15, 0x07, 0x06, 0x15, 0xf0, 0x09, 0x0b, 0xf0, 0x07, 0x06, 0x08, 0x1f,
+    0x0d, 0x08, 0x09, 0x0c, 0x0b, 0x17, 0x08, 0xf0, 0x0a, 0x0b, 0x0f, 0x00,
+    0x09, 0x01, 0x08, 0xf2, 0x0a, 0x09, 0x08, 0x0a, 0x0e, 0x0b, 0x08, 0x07,
+    0x08, 0x09, 0x08, 0xf0, 0x07, 0x08, 0x1a, 0x08, 0x12, 0x0a, 0x09, 0x53,
+    0x3b, 0x0d, 0x0b, 0x24, 0x0e, 0x0d, 0x0b, 0x05, 0x80, 0x0d, 0x06, 0x0c,
+    0x07, 0x0b, 0x08, 0x0e, 0x09, 0x1f, 0x0b, 0x0d, 0x0e, 0x0e, 0x2a, 0x0f,
+    0x07, 0xf1, 0x08, 0x0d, 0x09, 0x0b, 0x0a, 0x17, 0x0c, 0x0b, 0x08, 0x1d,
+    0x0b, 0x0e, 0x2e, 0x0c, 0x0a, 0x0c, 0x0d, 0x0f, 0x3b, 0x0e, 0x1a, 0x0c,
+    0x0a, 0xb1, 0x0d, 0x39, 0x0c, 0x0b, 0x0c, 0x0d, 0x0a, 0x0e, 0x09, 0x0c,
+    0x38, 0x1b, 0x1a, 0x07, 0x38, 0x0f, 0xf0, 0x0e, 0x1d, 0x19, 0x1c, 0x08,
+    0x1e, 0x07, 0x06, 0x0c, 0x25, 0x0d, 0x0c, 0x0b, 0xb4, 0x0e, 0x0d, 0x0e,
+    0x1c, 0xf0, 0x0d, 0x1c, 0x0e, 0x0d, 0x0c, 0x0d, 0x05, 0x0b, 0x36, 0x0a,
+    0x1b, 0x0c, 0x87, 0x0b, 0x3c, 0xf0, 0x3b, 0x08, 0x19, 0x27, 0x18, 0x46,
+    0x09, 0x38, 0x05, 0x09, 0x64, 0x0b, 0xf0, 0x0a, 0x0b, 0x0a, 0x09, 0x08,
+    0x0a, 0x15, 0x08, 0x07, 0x14, 0x08, 0x07, 0x23, 0x28, 0x02, 0x0a, 0x81,
+    0x1f, 0xf0, 0x0e, 0x0b, 0x09, 0x07, 0x08, 0x09, 0x08, 0x70, 0x0e, 0x1b,
+    0x0c, 0x0e, 0x0c, 0x19, 0x11, 0x07, 0xf0, 0x08, 0x20, 0x0c, 0x09, 0x0b,
+    0x21, 0x08, 0x09, 0x08, 0x50, 0x0b, 0x0a, 0x0e, 0x0f, 0x1a, 0x51, 0x08,
+    0x0b, 0x09, 0xf0, 0x18, 0x0c, 0x12, 0x2a, 0x11, 0x08, 0x02, 0x07, 0x03,
+    0x06, 0x02, 0x07, 0x51, 0x18, 0x0a, 0x0c, 0x09, 0x08, 0xf0, 0x02, 0x27,
+    0x13, 0x12, 0x18, 0x03, 0x17, 0x14, 0x08, 0x03, 0x09, 0x02, 0x0c, 0x03,
+    0x0a, 0x05, 0x19, 0x06, 0x15, 0x2a, 0x06, 0xf0, 0x07, 0x2c, 0x28, 0x1d,
+    0x0b, 0x0e, 0x2e, 0x0a, 0x09, 0x0c, 0x0d, 0x0f, 0x1b, 0x0e, 0x09, 0x0c,
+    0x68, 0x0b, 0x2a, 0xf0, 0x19, 0x5a, 0x07, 0x06, 0x07, 0x08, 0x07, 0x05,
+    0x0b, 0x14, 0x0c, 0x0e, 0x15, 0x0d, 0x0c, 0x14, 0x0a, 0x18, 0x15, 0xf0,
+    0x49, 0x04, 0x13, 0x24, 0x0c, 0x0b, 0x13, 0x1c, 0x05, 0x2a, 0x06, 0x05,
+    0x14, 0x69, 0x05, 0x06, 0xf0, 0x05, 0x14, 0x05, 0x2b, 0x06, 0x15, 0x2a,
+    0x06, 0x27, 0x0b, 0x0a, 0x16, 0x0b, 0x7d, 0x08, 0x09, 0x07, 0xf0, 0x06,
+    0x07, 0x19, 0x07, 0x0b, 0x05, 0x0d, 0x06, 0x0c, 0x08, 0x0b, 0x07, 0x1a,
+    0x05, 0x14, 0x0b, 0x0e, 0x05, 0x0b, 0x04, 0x0c, 0x43, 0x0d, 0x1b, 0xf0,
+    0x09, 0x07, 0xf2, 0x08, 0x09, 0x1d, 0x0a, 0x19, 0x0c, 0x0d, 0x09, 0x07,
+    0x08, 0x0a, 0xf0, 0x0b, 0x09, 0x0a, 0x32, 0x2c, 0x0e, 0x03, 0x0b, 0x14,
+    0x29, 0x43, 0x08, 0x09, 0x0b, 0x0a, 0x82, 0x0d, 0xf0, 0x0b, 0x0c, 0x0e,
+    0x0c, 0x09, 0x08, 0x19, 0x21, 0x0e, 0x0b, 0x0c, 0x22, 0x09, 0x0a, 0x08,
+    0x11, 0x09, 0x0d, 0xf0, 0x12, 0x0b, 0x0a, 0x41, 0x0c, 0x19, 0x0b, 0x0a,
+    0x20, 0x0f, 0x0c, 0x0e, 0x11, 0x08, 0x06, 0x70, 0x08, 0x07, 0x08, 0x09,
+    0xf0, 0x08, 0x06, 0x05, 0x08, 0x11, 0x07, 0x08, 0x20, 0x0c, 0x0a, 0x0e,
+    0x31, 0x09, 0x0b, 0x0a, 0x0b, 0x42, 0x08, 0x0a, 0x0b, 0xf0, 0x0a, 0x0d,
+    0x43, 0x0b, 0x1e, 0x1a, 0x04, 0x09, 0x15, 0x1a, 0x14, 0x0c, 0x1e, 0x05,
+    0x07, 0x1d, 0x09, 0x0b, 0x0c, 0xf0, 0x0a, 0x6d, 0x0b, 0x1c, 0x0e, 0x4f,
+    0x0b, 0x0c, 0x0e, 0x0d, 0x0d, 0x19, 0x0e, 0x0d, 0x1a, 0x0c, 0x0b, 0x09,
+    0x0a, 0xf0, 0x07, 0x0b, 0x06, 0x1d, 0x17, 0x0e, 0x06, 0x0d, 0x15, 0x1e,
+    0x16, 0x0b, 0x0c, 0x05, 0x0d, 0x34, 0x0a, 0x08, 0x29, 0x03, 0x32, 0x1a,
+    0xf0, 0x0b, 0x09, 0x61, 0x0e, 0x0a, 0x0b, 0x1f, 0x0d, 0x0c, 0x02, 0x18,
+    0x23, 0x09, 0x08, 0x12, 0x0c, 0x0d, 0xf0, 0x53, 0x0a, 0x2c, 0x0d, 0x0e,
+    0x14, 0x09, 0x0a, 0x85, 0x29, 0x0a, 0x1b, 0x1a, 0xf0, 0x0d, 0x16, 0x0b,
+    0x0a, 0x15, 0x0c, 0x0e, 0x46, 0x1c, 0x0b, 0x0a, 0x0b, 0x07, 0x0a, 0x06,
+    0x0b, 0x05, 0x0a, 0x34, 0x0c, 0x0b, 0x0c, 0xf0, 0x0a, 0x43, 0x0c, 0x0b,
+    0x0c, 0x0d, 0x0c, 0xb2, 0x0f, 0x1e, 0x1f, 0x0d, 0x09, 0x08, 0x09, 0x0a,
+    0xf0, 0x09, 0x08, 0xf1, 0x0c, 0x0d, 0x0e, 0x0d, 0x0a, 0x09, 0x08, 0x07,
+    0x26, 0x08, 0x09, 0x07, 0xf0, 0x06, 0x07, 0xf1, 0x09, 0x0a, 0x09, 0x28,
+    0x19, 0x48, 0x27, 0xf0, 0x81, 0x08, 0x17, 0x08, 0x0a, 0x0d, 0x0c, 0x1a,
+    0x52, 0x07, 0x09, 0x0a, 0x0d, 0x0e, 0xf0, 0x0f, 0x93, 0x0b, 0x0d, 0x4e,
+    0x2f, 0x34, 0x0c, 0x0e, 0x1c, 0x05, 0x2b, 0xf0, 0x06, 0x07, 0x06, 0x0d,
+    0x25, 0x0e, 0x0b, 0x0d, 0x06, 0x0c, 0x07, 0x1b, 0x06, 0x45, 0x0a, 0x09,
+    0x0a, 0x09, 0x08, 0x04, 0x09, 0x63, 0x1e, 0xf0, 0x1d, 0x0b, 0x0a, 0x09,
+    0x52, 0x0c, 0x18, 0x0b, 0x0c, 0x09, 0xf1, 0x0a, 0x09, 0x0b, 0x0d, 0xf0,
+    0x0a, 0x18, 0x19, 0x08, 0x09, 0x0c, 0x2e, 0x0f, 0x42, 0x0e, 0x3f, 0xf0,
+    0x03, 0x0a, 0x34, 0x09, 0x1b, 0x0c, 0x25, 0x0b, 0x1e, 0x07, 0x0c, 0x1a,
+    0x1d, 0x07, 0x1e, 0x06, 0x07, 0x0d, 0x18, 0x0e, 0xf0, 0x0d, 0x07, 0x1b,
+    0x16, 0x0e, 0x08, 0x0c, 0x09, 0x0b, 0x07, 0x0c, 0x06, 0x0d, 0x07, 0x0e,
+    0x19, 0x0d, 0x0c, 0x08, 0x0b, 0x07, 0x1c, 0x08, 0x09, 0x0b, 0x07, 0x2a,
+    0xf0, 0x15, 0x16, 0x0b, 0x0c, 0x05, 0x0b, 0x14, 0x0c, 0x0e, 0x15, 0x0d,
+    0x1c, 0x04, 0x03, 0x0e, 0x04, 0x1a, 0x15, 0x09, 0x04, 0x0a, 0x13, 0x0d,
+    0xf0, 0x0e, 0x14, 0x0a, 0x0b, 0x13, 0x0d, 0x0b, 0x74, 0x09, 0x0a, 0x09,
+    0x18, 0x09, 0x0a, 0x09, 0x13, 0x0b, 0x0e, 0xb4, 0x1b, 0xf0, 0x19, 0x0b,
+    0x0c, 0x0d, 0x0b, 0x29, 0x0a, 0x83, 0x0d, 0x0b, 0x1a, 0x09, 0xf0, 0x18,
+    0x19, 0xf2, 0x0e, 0x0b, 0x0c, 0x1e, 0x0b, 0x0a, 0x19, 0x1a, 0x19, 0xf0,
+    0x0a, 0x29, 0x52, 0x0a, 0x09, 0x28, 0xf3, 0x07, 0x28, 0x19, 0xf0, 0x0a,
+    0x0c, 0x2d, 0x0c, 0x1a, 0x29, 0xf3, 0x08, 0x17, 0x19, 0xf0, 0x28, 0x0a,
+    0x0b, 0x0a, 0x09, 0x0a, 0x0b, 0x0c, 0x03, 0x0e, 0x04, 0x09, 0x25, 0x08,
+    0x1a, 0x14, 0x1c, 0xf0, 0x25, 0x0b, 0x0e, 0x0c, 0x14, 0x1e, 0x05, 0x1b,
+    0x46, 0x0c, 0x0b, 0x0a, 0x1e, 0x37, 0x0d, 0x2b, 0xf0, 0x18, 0x0c, 0x07,
+    0x0b, 0x16, 0x0c, 0x1e, 0x07, 0x08, 0x0c, 0x17, 0x1d, 0x08, 0x2e, 0x0a,
+    0x0b, 0x1a, 0x0d, 0x2b, 0x0b, 0x0d, 0xf0, 0x0a, 0x1c, 0x18, 0x0b, 0x09,
+    0x2a, 0x1a, 0x08, 0x0b, 0x17, 0x0c, 0x0e, 0x08, 0x2d, 0x07, 0x36, 0x1b,
+    0x0a, 0x05, 0x0b, 0xf0, 0x04, 0x0c, 0xf3, 0x2e, 0x0c, 0x1b, 0x0c, 0x0b,
+    0x0a, 0x49, 0x0a, 0xf0, 0x0c, 0x34, 0x29, 0x0b, 0xb5, 0x1a, 0x09, 0x0a,
+    0x5b, 0x0c, 0xf0, 0x0b, 0x74, 0x2e, 0x0b, 0x0a, 0x09, 0x0a, 0x09, 0x03,
+    0x0b, 0xa2, 0x0e, 0x1c, 0x2b, 0xf0, 0x09, 0x17, 0x18, 0x61, 0x0b, 0x0a,
+    0x0d, 0x2e, 0x0f, 0x42, 0x0a, 0x0c, 0x1b, 0xf0, 0x0c, 0x83, 0x09, 0x0a,
+    0x1b, 0x0a, 0x1b, 0x0c, 0x0d, 0x44, 0x0a, 0x1d, 0x0c, 0x0e, 0x05, 0x0a,
+    0xf0, 0x24, 0x0e, 0x0c, 0x09, 0x23, 0x1b, 0x0a, 0x32, 0x0d, 0x1a, 0x09,
+    0xf1, 0x0e, 0x0d, 0x0b, 0x09, 0x68, 0xf0, 0x09, 0x1a, 0x0b, 0x0d, 0x11,
+    0x1f, 0x32, 0x0a, 0x1d, 0x0e, 0xf0, 0x33, 0x0a, 0x0c, 0x0d, 0x0e, 0x14,
+    0x09, 0x0b, 0x55, 0x1a, 0x19, 0x0a, 0x0b, 0x74, 0x0e, 0x1d, 0x0c, 0xf0,
+    0x0b, 0x09, 0x08, 0x09, 0x05, 0x08, 0x04, 0x0a, 0xc3, 0x0d, 0x1e, 0x0d,
+    0x1c, 0x1d, 0x3c, 0xf0, 0x0e, 0x34, 0x0a, 0x0b, 0x29, 0x15, 0x0a, 0x34,
+    0x0c, 0x0b, 0x0c, 0x0e, 0x35, 0x0b, 0x0c, 0x0d, 0xf0, 0x3e, 0x06, 0x27,
+    0x0d, 0x08, 0x0e, 0x0a, 0x0d, 0x09, 0x0e, 0x08, 0x1d, 0x37, 0x1c, 0x0b,
+    0x06, 0x0c, 0x35, 0x0d, 0x0c, 0xf0, 0x0b, 0x0a, 0x34, 0x0d, 0x0c, 0x0b,
+    0x0a, 0x75, 0x77, 0x26, 0x26, 0xf0, 0x15, 0x17, 0xf4, 0x3a, 0x2b, 0x0c,
+    0x0b, 0x0a, 0x0b, 0x3c, 0xf0, 0x0b, 0x64, 0x0a, 0x0b, 0x0c, 0x0b, 0x0a,
+    0x0b, 0x0e, 0xb5, 0x1b, 0x1a, 0x0b, 0x0c, 0xf0, 0x1e, 0x0b, 0x1a, 0x09,
+    0x04, 0x0a, 0x33, 0x1e, 0x0c, 0x0a, 0xf2, 0x4f, 0xf0, 0x0d, 0x2c, 0x0b,
+    0x1c, 0x1a, 0x09, 0x48, 0xf2, 0x07, 0xf0, 0x18, 0x29, 0x08, 0x29, 0x1a,
+    0x62, 0x19, 0x0a, 0x19, 0xf0, 0x0a, 0x09, 0xf1, 0x0f, 0x1e, 0x0d, 0x1b,
+    0x4a, 0x0b, 0x2a, 0xf0, 0x3b, 0x61, 0x0c, 0x0e, 0x1f, 0xf2, 0x0a, 0x0c,
+    0xae, 0xf0, 0x0d, 0x0c, 0x0e, 0xf3, 0x29, 0x3a, 0xf0, 0x19, 0x1a, 0x19,
+    0x4a, 0x63, 0x0c, 0x3e, 0xf0, 0xb4, 0x59, 0x0a, 0x1b, 0x0a, 0x09, 0x08,
+    0x83, 0x2b, 0x3a, 0xf0, 0x0b, 0x0e, 0xf4, 0x29, 0x2a, 0x0b, 0x1d, 0x0c,
+    0x0b, 0xf0, 0x0a, 0x0b, 0x0c, 0x0b, 0x2a, 0xf4, 0x3b, 0x2c, 0x0b, 0x6a,
+    0xf0, 0xf4, 0x0b, 0x2a, 0x2b, 0x1a, 0x2b, 0xf0, 0x0a, 0x0b, 0x1d, 0x84,
+    0x0c, 0x0d, 0x0c, 0x0b, 0x1a, 0x19, 0xf3, 0x1e, 0xf0, 0x1d, 0x0b, 0x1a,
+    0x09, 0x18, 0x09, 0x0a, 0x09, 0x18, 0x19, 0xf3, 0x1a, 0xf0, 0x6b, 0x3a,
+    0x09, 0x88, 0x73, 0xf0, 0xf2, 0x0e, 0x0d, 0x0c, 0x0b, 0x1a, 0x1b, 0x1c,
+    0xf0, 0x0b, 0x0a, 0x09, 0x0a, 0x0b, 0x2a, 0xf2, 0x0b, 0x3c, 0x0b, 0x2a,
+    0xf0, 0xe9, 0xf2, 0xf0, 0x0a, 0x1b, 0x0c, 0x0b, 0x0c, 0x12, 0x1d, 0xf3,
+    0x28, 0x29, 0x1a, 0xf0, 0x2b, 0x1c, 0x3d, 0x13, 0x0e, 0x24, 0x29, 0x93,
+    0x0e, 0x2c, 0xf0, 0x0d, 0x2e, 0x1d, 0x14, 0x19, 0xf3, 0x0e, 0x0c, 0x0b,
+    0x1c, 0x1b, 0xf0, 0x9a, 0x63, 0x3b, 0x0c, 0x0e, 0xf0, 0x34, 0x39, 0x05,
+    0x07, 0x96, 0x96, 0x45, 0x47, 0xf0, 0x04, 0x09, 0xf3, 0x0d, 0x3e, 0x3c,
+    0x5b, 0xf0, 0x0c, 0xa3, 0x1e, 0x0d, 0x1c, 0x2d, 0x0e, 0x0d, 0x0e, 0xf0,
+    0x34, 0x39, 0xf3, 0x0e, 0x0d, 0x0e, 0x0d, 0x1c, 0x3b, 0x1a, 0xf0, 0x0b,
+    0x5a, 0xf3, 0x19, 0x2a, 0xb9, 0xf0, 0xf3, 0x4a, 0x7b, 0xf0, 0xf3, 0xca,
+    0xf0, 0xf9, 0xf3, 0xf0, 0x79, 0xf3, 0xfa, 0xf0, 0xa3, 0x4a, 0x03, 0x0a,
+    0x00
+};
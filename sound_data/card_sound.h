@@ -0,0 +1,191 @@
+const uint8_t card_sound [] = {
+    0x65, 0xf0, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x06, 0x09, 0x04,
+    0x0b, 0x18, 0x0d, 0x0b, 0x01, 0x3d, 0x05, 0x02, 0x06, 0x0a, 0x0c, 0x08,
+    0xa0, 0x0b, 0x0f, 0x0a, 0x06, 0x19, 0x05, 0x07, 0x0a, 0x09, 0x19, 0x02,
+    0x08, 0x0b, 0x04, 0x0a, 0x03, 0x0b, 0x02, 0x0f, 0x01, 0x51, 0x0c, 0x08,
+    0x2e, 0x06, 0x01, 0x04, 0x0c, 0x00, 0x0a, 0x03, 0x02, 0x0d, 0x0f, 0x03,
+    0x0c, 0x00, 0x01, 0x0b, 0x0f, 0x02, 0x0d, 0x00, 0x01, 0x09, 0x01, 0x22,
+    0x07, 0x09, 0x15, 0x00, 0x0f, 0x05, 0x03, 0x00, 0x04, 0x12, 0x06, 0x05,
+    0x08, 0x07, 0xf1, 0x00, 0x08, 0x04, 0x1c, 0x13, 0x0a, 0x01, 0x0c, 0x02,
+    0x0a, 0x04, 0x09, 0x02, 0x0a, 0x0a, 0x09, 0x03, 0x07, 0x00, 0x06, 0x0c,
+    0x08, 0x05, 0x0d, 0x0e, 0x1f, 0x01, 0x00, 0x1d, 0xf1, 0x01, 0x04, 0x0e,
+    0x05, 0x0d, 0x02, 0x09, 0x01, 0x07, 0x06, 0x09, 0x0f, 0x08, 0x00, 0x04,
+    0x0f, 0x05, 0x07, 0x24, 0x0c, 0x0a, 0x06, 0x15, 0x05, 0x01, 0x26, 0x07,
+    0xf1, 0x03, 0x04, 0x07, 0x0a, 0x06, 0x02, 0x27, 0x08, 0x07, 0x03, 0x26,
+    0x0c, 0x04, 0x0a, 0x07, 0x04, 0x08, 0x12, 0x07, 0x09, 0x04, 0x0b, 0x02,
+    0x0d, 0x05, 0x0b, 0xf1, 0x04, 0x18, 0x01, 0x08, 0x09, 0x02, 0x0d, 0x0f,
+    0x0e, 0x01, 0x08, 0x00, 0x0f, 0x03, 0x0a, 0x00, 0x0b, 0x0c, 0x0d, 0x01,
+    0x0c, 0x02, 0x0f, 0x04, 0x0c, 0x13, 0x19, 0x00, 0x0a, 0xf1, 0x04, 0x19,
+    0x03, 0x04, 0x1a, 0x05, 0x01, 0x0b, 0x03, 0x0e, 0x12, 0x0f, 0x0e, 0x0d,
+    0x0b, 0x02, 0x08, 0x03, 0x17, 0x06, 0x02, 0x09, 0x08, 0x08, 0x02, 0x07,
+    0x03, 0x19, 0xf1, 0x00, 0x0f, 0x0a, 0x0c, 0x05, 0x00, 0x04, 0x0f, 0x0f,
+    0x08, 0x0e, 0x02, 0x09, 0x11, 0x0a, 0x0c, 0x02, 0x0b, 0x05, 0x0d, 0x03,
+    0x0e, 0x04, 0x0a, 0x00, 0x0c, 0x04, 0x1b, 0x05, 0x41, 0x0a, 0x09, 0x03,
+    0x08, 0x06, 0x17, 0x00, 0x03, 0x18, 0x32, 0x0c, 0x00, 0x0b, 0x0f, 0x0f,
+    0x00, 0x03, 0xf1, 0x07, 0x04, 0x02, 0x15, 0x07, 0x05, 0x06, 0x0c, 0x08,
+    0x04, 0x17, 0x03, 0x06, 0x06, 0x02, 0x05, 0x0c, 0x17, 0x17, 0x16, 0x00,
+    0x16, 0x07, 0x18, 0x01, 0xa1, 0x00, 0x0a, 0x0f, 0x0d, 0x02, 0x0c, 0x05,
+    0x0d, 0x22, 0x0a, 0x0e, 0x0d, 0x05, 0x2b, 0x04, 0x00, 0x05, 0x07, 0x62,
+    0x01, 0x08, 0x02, 0x1a, 0x00, 0x15, 0x09, 0x08, 0x00, 0x06, 0x02, 0x05,
+    0x03, 0x0f, 0x03, 0x14, 0x03, 0x02, 0x00, 0x01, 0x16, 0x0f, 0x02, 0x07,
+    0x41, 0x07, 0x03, 0x08, 0x04, 0x0a, 0x01, 0x0e, 0x0f, 0x0f, 0x00, 0x90,
+    0x0e, 0x05, 0x0c, 0x03, 0x38, 0x0e, 0x04, 0x03, 0x0f, 0x19, 0x03, 0x0f,
+    0x18, 0x00, 0x0f, 0x32, 0x0b, 0x01, 0x0a, 0x00, 0x0b, 0x07, 0x0a, 0x04,
+    0x21, 0x1d, 0x01, 0x0f, 0x0e, 0x01, 0x10, 0x1f, 0x00, 0x0f, 0x05, 0x0c,
+    0x00, 0x03, 0x09, 0x02, 0x02, 0x0b, 0x0c, 0x01, 0x09, 0x00, 0x40, 0x0b,
+    0x0b, 0x0d, 0x07, 0x1c, 0x08, 0x05, 0x0b, 0x02, 0x11, 0x0a, 0x0f, 0x0c,
+    0x00, 0x80, 0x2f, 0x0c, 0x02, 0x05, 0x0e, 0x03, 0x0d, 0x01, 0x1f, 0x0d,
+    0x03, 0x0d, 0x00, 0x0b, 0x02, 0x02, 0x0c, 0x0f, 0x04, 0x09, 0x10, 0x02,
+    0x08, 0x13, 0x07, 0x13, 0x05, 0x04, 0x04, 0x05, 0x05, 0x43, 0x03, 0x14,
+    0x04, 0x00, 0x03, 0x09, 0x04, 0x05, 0x07, 0x12, 0x00, 0x09, 0x0f, 0x0e,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x0c, 0x31, 0x02, 0x0e, 0x0f, 0x0f, 0x0e,
+    0x04, 0x00, 0x00, 0x03, 0x0f, 0x0d, 0x15, 0x20, 0x06, 0x13, 0x36, 0x0f,
+    0x09, 0x00, 0x51, 0x13, 0x17, 0x04, 0x08, 0x0a, 0x29, 0x00, 0x03, 0x02,
+    0x07, 0x13, 0x27, 0x0f, 0x00, 0x41, 0x01, 0x08, 0x09, 0x09, 0x0b, 0x08,
+    0x00, 0x1b, 0x0f, 0x04, 0x01, 0x02, 0x08, 0x00, 0x01, 0x07, 0x0f, 0x04,
+    0x36, 0x03, 0x01, 0x00, 0x00, 0x02, 0x02, 0x0f, 0x03, 0x07, 0x04, 0x02,
+    0x06, 0x0c, 0x01, 0x05, 0x00, 0x00, 0x04, 0x0f, 0x02, 0x05, 0x02, 0x04,
+    0x03, 0x04, 0x08, 0x02, 0x0f, 0x09, 0x11, 0x00, 0x00, 0x0f, 0x0d, 0x62,
+    0x06, 0x0b, 0x02, 0x0a, 0x10, 0x08, 0x09, 0x02, 0x0b, 0x0f, 0x0e, 0x10,
+    0x08, 0x81, 0x06, 0x0f, 0x08, 0x02, 0x17, 0x0d, 0x05, 0x16, 0x00, 0x06,
+    0x0a, 0x05, 0x0c, 0x00, 0x09, 0x12, 0x0f, 0x0c, 0x00, 0x01, 0x23, 0x02,
+    0x05, 0x0f, 0x08, 0x00, 0x00, 0x04, 0x01, 0x04, 0x25, 0x0f, 0x0e, 0x00,
+    0x41, 0x0c, 0x16, 0x04, 0x00, 0x09, 0x0e, 0x0a, 0x09, 0xa0, 0x0f, 0x0f,
+    0x1d, 0x02, 0x0a, 0x0a, 0x03, 0x18, 0x1f, 0x06, 0x08, 0x05, 0x04, 0x04,
+    0x0e, 0x03, 0x00, 0x02, 0x0f, 0x0f, 0x0e, 0x09, 0x05, 0x0b, 0x20, 0x03,
+    0x08, 0x11, 0x07, 0x0b, 0x0f, 0x0b, 0x07, 0x00, 0x04, 0x06, 0x0f, 0x02,
+    0x05, 0x00, 0x00, 0x04, 0x0f, 0x03, 0x06, 0x00, 0x01, 0x07, 0x01, 0x12,
+    0x06, 0x0a, 0x17, 0x00, 0x03, 0x0f, 0x0c, 0x05, 0x05, 0x02, 0x03, 0x00,
+    0x00, 0x02, 0x03, 0x03, 0x05, 0x0f, 0x0f, 0x17, 0x01, 0x06, 0x02, 0x02,
+    0x08, 0x10, 0x00, 0x07, 0x01, 0x0a, 0x1f, 0x06, 0x09, 0x0f, 0x06, 0x10,
+    0x10, 0x02, 0x04, 0x04, 0x03, 0x13, 0x1f, 0x0b, 0x0d, 0x92, 0x10, 0x03,
+    0x04, 0x02, 0x07, 0x0f, 0x09, 0x06, 0x04, 0x04, 0x02, 0x00, 0x01, 0x1f,
+    0x0e, 0x0c, 0x00, 0x06, 0xf1, 0x0f, 0x07, 0x00, 0x05, 0x06, 0x09, 0x0d,
+    0x1c, 0x01, 0x00, 0x1d, 0x01, 0x04, 0x0e, 0x07, 0x0c, 0x03, 0x0a, 0x01,
+    0x08, 0x04, 0x0a, 0x00, 0x09, 0x15, 0x0a, 0x0d, 0x03, 0x09, 0x22, 0x0f,
+    0x08, 0x00, 0x02, 0x0f, 0x05, 0x13, 0x0b, 0x03, 0x00, 0x22, 0x04, 0x06,
+    0x05, 0x00, 0x16, 0x12, 0x03, 0x04, 0x07, 0x0f, 0x03, 0x08, 0x00, 0x00,
+    0x0a, 0x1f, 0x02, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x05, 0x0f, 0x02, 0x06,
+    0x03, 0x01, 0x05, 0x00, 0x00, 0x07, 0x0f, 0x02, 0x09, 0x02, 0x21, 0x0d,
+    0x01, 0x0c, 0x00, 0x08, 0x01, 0x32, 0x0a, 0x0f, 0x0b, 0x00, 0x09, 0x0f,
+    0x1b, 0x00, 0x21, 0x05, 0x0d, 0x03, 0x0e, 0x00, 0x22, 0x1a, 0x03, 0x02,
+    0x0b, 0x20, 0x03, 0x09, 0x04, 0x18, 0x13, 0x02, 0x09, 0x04, 0x32, 0x0c,
+    0x00, 0x0e, 0x0e, 0x0c, 0x10, 0x08, 0x03, 0x07, 0x0b, 0x02, 0x28, 0x0c,
+    0x01, 0x05, 0x20, 0x07, 0x05, 0x00, 0x04, 0x0f, 0x0f, 0x25, 0x0a, 0x03,
+    0x00, 0x10, 0x06, 0x07, 0x0f, 0x31, 0x16, 0x04, 0x00, 0x17, 0x06, 0x02,
+    0x32, 0x25, 0x07, 0x06, 0x0f, 0x04, 0x00, 0x00, 0x03, 0x09, 0x01, 0x04,
+    0x0e, 0x12, 0x05, 0x03, 0x06, 0x05, 0x21, 0x08, 0x00, 0x07, 0x11, 0x0a,
+    0x02, 0x0b, 0x0f, 0x03, 0x29, 0x01, 0x02, 0x00, 0x61, 0x0e, 0x0a, 0x07,
+    0x18, 0x24, 0x07, 0x18, 0x0c, 0x14, 0x50, 0x2a, 0x02, 0x0d, 0x0c, 0x05,
+    0x09, 0x00, 0x28, 0x05, 0x21, 0x07, 0x01, 0x39, 0x05, 0x12, 0x0f, 0x02,
+    0xf1, 0x00, 0x1c, 0x0e, 0x06, 0x19, 0x01, 0x02, 0x07, 0x01, 0x1a, 0x04,
+    0x03, 0x0d, 0x01, 0x0a, 0x00, 0x0c, 0x0f, 0x0d, 0x04, 0x0b, 0x10, 0x08,
+    0x0b, 0x0f, 0x0e, 0x0c, 0x21, 0x1c, 0x00, 0x01, 0x0d, 0x04, 0x12, 0x0b,
+    0x0f, 0x19, 0x00, 0x00, 0x02, 0x01, 0x08, 0x0f, 0x02, 0x07, 0x00, 0x01,
+    0x06, 0x0f, 0x02, 0x17, 0x09, 0x01, 0x00, 0x00, 0x18, 0x02, 0x01, 0x0f,
+    0x12, 0x06, 0x12, 0x05, 0x04, 0x04, 0x0f, 0x06, 0x33, 0x10, 0x04, 0x26,
+    0x08, 0x0f, 0x02, 0x00, 0x00, 0x03, 0x02, 0x02, 0x04, 0x0f, 0x04, 0x05,
+    0x04, 0x03, 0x06, 0x00, 0x42, 0x19, 0x02, 0x03, 0x08, 0x02, 0x17, 0x00,
+    0x03, 0x51, 0x0c, 0x08, 0x1b, 0x05, 0x0e, 0x29, 0x01, 0x0c, 0x03, 0xf0,
+    0x1c, 0x05, 0x12, 0x0b, 0x1e, 0x06, 0x0a, 0x0b, 0x13, 0x1a, 0x05, 0x0b,
+    0x01, 0x0a, 0x09, 0x1c, 0x06, 0x07, 0x0e, 0x0e, 0x1d, 0x03, 0x04, 0x0c,
+    0x03, 0x00, 0x0d, 0x02, 0x01, 0x19, 0x07, 0x22, 0x04, 0x1a, 0x10, 0x03,
+    0x0f, 0x0f, 0x0f, 0x0c, 0x10, 0x10, 0x04, 0x16, 0x0f, 0x11, 0x05, 0x07,
+    0x01, 0x03, 0x15, 0x02, 0x06, 0x0f, 0x08, 0x14, 0x00, 0x61, 0x0d, 0x05,
+    0x04, 0x16, 0x07, 0x03, 0x27, 0x0b, 0x01, 0x03, 0x12, 0x06, 0x0f, 0x15,
+    0x00, 0x00, 0x03, 0x02, 0x04, 0x0f, 0x15, 0x03, 0x0b, 0x02, 0x00, 0x06,
+    0xf1, 0x05, 0x09, 0x02, 0x0b, 0x0a, 0x0d, 0x03, 0x0b, 0x32, 0x0f, 0x0e,
+    0x0a, 0x0e, 0x01, 0x0d, 0x02, 0x0c, 0x01, 0x08, 0x14, 0x1a, 0x0a, 0x0c,
+    0x04, 0x1d, 0x0f, 0x91, 0x05, 0x1a, 0x01, 0x05, 0x09, 0x00, 0x0a, 0x07,
+    0x0b, 0x02, 0x0e, 0x03, 0x1f, 0x04, 0x01, 0x0c, 0x00, 0x07, 0x22, 0x0f,
+    0x0a, 0x05, 0x02, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x0b, 0x00, 0x07, 0x0c,
+    0x02, 0x04, 0x2a, 0x00, 0x02, 0x04, 0x11, 0x00, 0x18, 0x0f, 0x02, 0x06,
+    0x11, 0x36, 0x00, 0x13, 0x12, 0x02, 0x03, 0x45, 0x00, 0x04, 0x0f, 0x06,
+    0x00, 0x00, 0x0f, 0x01, 0x04, 0xa0, 0x09, 0x0f, 0x0a, 0x14, 0x09, 0x0a,
+    0x05, 0x0b, 0x0f, 0x0e, 0x05, 0x1c, 0x00, 0x0c, 0x0b, 0x06, 0x19, 0x12,
+    0x31, 0x07, 0x0b, 0x08, 0x04, 0x0a, 0x0d, 0x09, 0x00, 0x00, 0x0b, 0x0f,
+    0x81, 0x0f, 0x01, 0x0d, 0x03, 0x0b, 0x04, 0x1a, 0x12, 0x0c, 0x01, 0x0f,
+    0x05, 0x1e, 0x00, 0x0f, 0x04, 0x1b, 0x10, 0x02, 0x01, 0x0d, 0x0f, 0x02,
+    0x0c, 0x04, 0xf1, 0x0b, 0x00, 0x09, 0x0f, 0x0a, 0x02, 0x08, 0x01, 0x07,
+    0x05, 0x1a, 0x08, 0x01, 0x0b, 0x04, 0x0a, 0x06, 0x09, 0x00, 0x08, 0x06,
+    0x09, 0x08, 0x1a, 0x10, 0x09, 0x04, 0x2b, 0x02, 0x71, 0x0f, 0x01, 0x29,
+    0x09, 0x05, 0x0d, 0x08, 0x02, 0x17, 0x04, 0x0d, 0x50, 0x09, 0x02, 0x08,
+    0x04, 0x1a, 0x08, 0x05, 0x08, 0x00, 0x07, 0x0f, 0x02, 0x08, 0x03, 0xa1,
+    0x0a, 0x32, 0x1d, 0x3b, 0x0b, 0x00, 0x02, 0x0d, 0x08, 0x1c, 0x03, 0x04,
+    0x09, 0x00, 0x42, 0x06, 0x01, 0x15, 0x04, 0x06, 0x24, 0x00, 0x0f, 0x23,
+    0x07, 0x13, 0x03, 0x06, 0x04, 0x42, 0x00, 0x05, 0x0f, 0x09, 0x05, 0x07,
+    0x17, 0x15, 0xf1, 0x00, 0x04, 0x07, 0x05, 0x02, 0x07, 0x0f, 0x2a, 0x04,
+    0x01, 0x13, 0x18, 0x05, 0x19, 0x06, 0x15, 0x17, 0x03, 0x18, 0x04, 0x06,
+    0x19, 0x02, 0xf1, 0x03, 0x0c, 0x00, 0x0e, 0x03, 0x0f, 0x07, 0x0d, 0x05,
+    0x1a, 0x02, 0x01, 0x08, 0x04, 0x0a, 0x12, 0x09, 0x08, 0x03, 0x1a, 0x04,
+    0x13, 0x0e, 0x2c, 0x04, 0x01, 0x81, 0x03, 0x0b, 0x04, 0x09, 0x03, 0x08,
+    0x12, 0x09, 0x07, 0x00, 0x08, 0x06, 0x09, 0x04, 0x0a, 0x01, 0x08, 0xa2,
+    0x0f, 0x0b, 0x01, 0x0a, 0x02, 0x0d, 0x13, 0x0c, 0x0e, 0x01, 0x0a, 0x00,
+    0x0b, 0x01, 0x0f, 0x00, 0x0d, 0x01, 0x0b, 0x03, 0x0e, 0xf1, 0x01, 0x0b,
+    0x14, 0x0e, 0x0c, 0x02, 0x0e, 0x03, 0x1f, 0x02, 0x04, 0x0d, 0x12, 0x0c,
+    0x1e, 0x11, 0x0b, 0x04, 0x0a, 0x03, 0x0c, 0x02, 0x0a, 0x04, 0x0c, 0x07,
+    0x1b, 0xf1, 0x03, 0x04, 0x0a, 0x06, 0x0b, 0x03, 0x0a, 0x00, 0x0e, 0x02,
+    0x0a, 0x04, 0x0c, 0x02, 0x0e, 0x06, 0x1b, 0x00, 0x09, 0x1c, 0x04, 0x01,
+    0x0b, 0x04, 0x19, 0x01, 0x05, 0x0a, 0xf1, 0x04, 0x09, 0x13, 0x1b, 0x05,
+    0x19, 0x02, 0x03, 0x0a, 0x24, 0x1c, 0x09, 0x05, 0x0a, 0x02, 0x08, 0x03,
+    0x2d, 0x01, 0x02, 0x03, 0x0c, 0x02, 0x1a, 0xf1, 0x03, 0x02, 0x08, 0x04,
+    0x0a, 0x23, 0x0d, 0x0b, 0x1a, 0x06, 0x03, 0x18, 0x05, 0x02, 0x09, 0x11,
+    0x08, 0x17, 0x03, 0x04, 0x08, 0x05, 0x19, 0x01, 0xf1, 0x04, 0x0d, 0x0a,
+    0x0e, 0x04, 0x0c, 0x02, 0x09, 0x00, 0x1e, 0x03, 0x00, 0x28, 0x0f, 0x05,
+    0x0a, 0x07, 0x05, 0x06, 0x02, 0x35, 0x08, 0x06, 0x0e, 0x04, 0x09, 0xf0,
+    0x12, 0x0a, 0x1f, 0x06, 0x05, 0x0d, 0x07, 0x1b, 0x03, 0x04, 0x1e, 0x07,
+    0x0f, 0x0c, 0x04, 0x1b, 0x07, 0x0c, 0x19, 0x04, 0x07, 0x28, 0x06, 0x07,
+    0xf0, 0x02, 0x09, 0x0f, 0x2a, 0x06, 0x15, 0x0b, 0x02, 0x2e, 0x08, 0x07,
+    0x03, 0x0c, 0x04, 0x0b, 0x08, 0x09, 0x15, 0x37, 0x0e, 0x16, 0x08, 0xf0,
+    0x07, 0x39, 0x03, 0x0d, 0x0b, 0x07, 0x0a, 0x05, 0x1c, 0x09, 0x12, 0x0a,
+    0x0c, 0x07, 0x19, 0x04, 0x05, 0x08, 0x03, 0x09, 0x16, 0x2a, 0x07, 0xf0,
+    0x02, 0x0c, 0x05, 0x09, 0x03, 0x08, 0x17, 0x0a, 0x09, 0x03, 0x1a, 0x08,
+    0x05, 0x09, 0x06, 0x1b, 0x04, 0x0f, 0x0f, 0x06, 0x0e, 0x03, 0x09, 0x06,
+    0x0b, 0x0e, 0x2c, 0x0c, 0xf0, 0x08, 0x05, 0x0a, 0x03, 0x0e, 0x08, 0x0d,
+    0x05, 0x19, 0x01, 0x0a, 0x0c, 0x0c, 0x0a, 0x02, 0x1b, 0x14, 0x09, 0x0a,
+    0x0a, 0x14, 0x09, 0x28, 0x05, 0x07, 0xf0, 0x0c, 0x29, 0x08, 0x05, 0x08,
+    0x0b, 0x04, 0x0a, 0x02, 0x2f, 0x0f, 0x02, 0x05, 0x0e, 0x08, 0x0b, 0x02,
+    0x1c, 0x05, 0x07, 0x0a, 0x04, 0x09, 0x06, 0x0c, 0x05, 0x0b, 0xf0, 0x04,
+    0x0e, 0x06, 0x1b, 0x07, 0x04, 0x0c, 0x05, 0x0b, 0x07, 0x2c, 0x01, 0x08,
+    0x04, 0x0a, 0x05, 0x0c, 0x06, 0x0a, 0x03, 0x09, 0x04, 0x0b, 0x06, 0x0d,
+    0x09, 0x1b, 0x03, 0xf0, 0x15, 0x0d, 0x0c, 0x07, 0x1e, 0x04, 0x03, 0x0b,
+    0x14, 0x0a, 0x0c, 0x05, 0x1a, 0x16, 0x2b, 0x14, 0x0e, 0x0d, 0x06, 0x0e,
+    0x0e, 0x0c, 0x03, 0x09, 0xf0, 0x04, 0x0b, 0x0e, 0x0d, 0x02, 0x0b, 0x03,
+    0x0e, 0x06, 0x0d, 0x04, 0x3a, 0x05, 0x09, 0x03, 0x0f, 0x0f, 0x12, 0x0e,
+    0x1c, 0x0a, 0x07, 0x0b, 0x15, 0x0a, 0x09, 0xf0, 0x04, 0x0a, 0x09, 0x3c,
+    0x06, 0x02, 0x07, 0x0f, 0x0e, 0x02, 0x39, 0x03, 0x0b, 0x03, 0x14, 0x0a,
+    0x0e, 0x0c, 0x0c, 0x05, 0x0b, 0x06, 0x0c, 0x03, 0x0d, 0xf0, 0x09, 0x1e,
+    0x03, 0x04, 0x1d, 0x05, 0x06, 0x0b, 0x09, 0x0d, 0x02, 0x3f, 0x04, 0x03,
+    0x14, 0x0e, 0x03, 0x0b, 0x04, 0x0e, 0x0f, 0x0a, 0x03, 0x08, 0x07, 0x09,
+    0xf0, 0x15, 0x0a, 0x09, 0x0a, 0x0a, 0x05, 0x08, 0x02, 0x09, 0x0e, 0x0b,
+    0x06, 0x18, 0x02, 0x0d, 0x09, 0x07, 0x0a, 0x0d, 0x0c, 0x03, 0x0a, 0x08,
+    0x0c, 0x0f, 0x0f, 0x13, 0x0d, 0x1a, 0xf0, 0x26, 0x09, 0x1b, 0x07, 0x04,
+    0x09, 0x03, 0x08, 0x08, 0x1a, 0x05, 0x02, 0x09, 0x06, 0x0b, 0x09, 0x1a,
+    0x15, 0x0d, 0x06, 0x0b, 0x03, 0x0c, 0x09, 0x0d, 0xf0, 0x06, 0x1e, 0x04,
+    0x12, 0x0d, 0x0f, 0x04, 0x0e, 0x05, 0x0d, 0x06, 0x0b, 0x05, 0x0d, 0x08,
+    0x0c, 0x05, 0x0b, 0x04, 0x09, 0x03, 0x0b, 0x06, 0x0a, 0x07, 0x0b, 0x0a,
+    0x1d, 0x04, 0xf0, 0x02, 0x0e, 0x05, 0x0d, 0x07, 0x0a, 0x08, 0x09, 0x04,
+    0x08, 0x03, 0x0a, 0x07, 0x0b, 0x05, 0x09, 0x04, 0x1a, 0x05, 0x0b, 0x2b,
+    0x02, 0x03, 0x0e, 0x0c, 0x06, 0x1d, 0x08, 0xf0, 0x03, 0x0e, 0x06, 0x0b,
+    0x14, 0x1a, 0x15, 0x0b, 0x1a, 0x07, 0x06, 0x0c, 0x14, 0x0d, 0x0e, 0x08,
+    0x0c, 0x07, 0x0b, 0x03, 0x0a, 0x05, 0x1b, 0x0a, 0x24, 0x0a, 0xf0, 0x0b,
+    0x4a, 0x09, 0x14, 0x08, 0x03, 0x0b, 0x05, 0x0c, 0x16, 0x1a, 0x07, 0x1b,
+    0x08, 0x13, 0x0c, 0x0d, 0x04, 0x1f, 0x05, 0xf0, 0x13, 0x0e, 0x0c, 0x06,
+    0x0b, 0x15, 0x0c, 0x2b, 0x04, 0x0a, 0x04, 0x0c, 0x05, 0x2a, 0x04, 0x05,
+    0x04, 0x0b, 0x05, 0x0c, 0x06, 0x0b, 0x05, 0x0a, 0x16, 0x09, 0xf0, 0x0b,
+    0x09, 0x19, 0x03, 0x07, 0x0a, 0x16, 0x19, 0x05, 0x1a, 0x16, 0x09, 0x03,
+    0x1a, 0x05, 0x0c, 0x19, 0x04, 0x05, 0x0c, 0x03, 0x0d, 0x04, 0x1e, 0xf0,
+    0x08, 0x03, 0x0d, 0x05, 0x0e, 0x04, 0x0c, 0x06, 0x0a, 0x35, 0x19, 0x0a,
+    0x0c, 0x04, 0x0e, 0x07, 0x0d, 0x06, 0x1b, 0x07, 0x05, 0x0a, 0x03, 0x0d,
+    0x09, 0x0c, 0xf0, 0x03, 0x0e, 0x04, 0x29, 0x15, 0x07, 0x1a, 0x35, 0x0b,
+    0x0a, 0x0d, 0x07, 0x0e, 0x14, 0x0c, 0x0e, 0x05, 0x0c, 0x06, 0x0b, 0x03,
+    0x0e, 0x04, 0x1c, 0xf0, 0x15, 0x0a, 0x04, 0x2c, 0x05, 0x04, 0x03, 0x0d,
+    0x06, 0x0b, 0x04, 0x0c, 0x07, 0x1d, 0x06, 0x25, 0x0b, 0x0a, 0x1c, 0x14,
+    0x1e, 0x05, 0xf0, 0x04, 0x3b, 0x35, 0x0c, 0x06, 0x1b, 0x04, 0x25, 0x0a,
+    0x1b, 0x06, 0x0d, 0x05, 0x0c, 0x04, 0x0b, 0x05, 0x0d, 0x06, 0x3a, 0x04,
+    0xf0, 0x26, 0x2b, 0x05, 0x04, 0x05, 0x0d, 0x04, 0x0b, 0x05, 0x0c, 0x08,
+    0x1b, 0x14, 0x0d, 0x05, 0x2a, 0x16, 0x04, 0x1b, 0x05, 0xf0, 0x06, 0x0c,
+    0x05, 0x0a, 0x04, 0x0b, 0x15, 0x0a, 0x0c, 0x06, 0x0b, 0x04, 0x0c, 0x05,
+    0x1e, 0x14, 0x1c, 0x65, 0x0a, 0x0c, 0x0a, 0x0b, 0x0a, 0x10, 0x0b, 0x05,
+    0x0a, 0x00
+};
@@ -0,0 +1,1352 @@
+const uint8_t curse_sound [] = {
+    0xf5, 0x5c, 0xf0, 0x2d, 0x2c, 0x7b, 0xf5, 0xf0, 0x1c, 0x2b, 0x2a, 0x3b,
+    0xa5, 0x1a, 0xf0, 0x19, 0x0a, 0x1b, 0x0c, 0x2d, 0x66, 0x1a, 0x0b, 0x1c,
+    0x0e, 0xf0, 0x0d, 0x77, 0x0b, 0x1c, 0x0d, 0x1b, 0x0a, 0x09, 0x16, 0x0b,
+    0x0a, 0x15, 0x0c, 0x0d, 0xf4, 0x0f, 0x0e, 0x0f, 0xf0, 0x0e, 0x0d, 0x0b,
+    0x0a, 0x29, 0x0b, 0x0a, 0x1b, 0x19, 0x44, 0x28, 0xf0, 0x09, 0x0c, 0x05,
+    0x0a, 0x46, 0x09, 0x0a, 0x0d, 0x0e, 0x0c, 0x07, 0x0b, 0x16, 0x0e, 0x0d,
+    0x37, 0x1b, 0x0c, 0x0d, 0x08, 0x0b, 0xf0, 0x07, 0x0c, 0x56, 0x1e, 0x0d,
+    0x0c, 0x1e, 0x27, 0x0d, 0x0e, 0x0d, 0x08, 0x0c, 0x07, 0x1b, 0x48, 0x1c,
+    0x1d, 0xf0, 0x07, 0x1e, 0x16, 0x0d, 0x25, 0x0b, 0x1a, 0x14, 0x0b, 0x09,
+    0x33, 0x0c, 0x0b, 0x49, 0x24, 0xf0, 0x35, 0x0b, 0x0a, 0x09, 0x0b, 0x34,
+    0x2c, 0x0d, 0x15, 0x0b, 0x2c, 0x18, 0x07, 0x0e, 0x09, 0x0d, 0x07, 0x1b,
+    0x06, 0xf0, 0x05, 0x0a, 0x14, 0x1b, 0x13, 0x0e, 0x0f, 0x04, 0x0d, 0x05,
+    0x0b, 0x06, 0x0a, 0x27, 0x0c, 0x0b, 0x3c, 0x08, 0x07, 0x08, 0x07, 0x0d,
+    0x16, 0x0e, 0xf0, 0x0b, 0x14, 0x0c, 0x0a, 0x43, 0x0b, 0x0a, 0x0d, 0x0c,
+    0x0d, 0x74, 0x19, 0x0a, 0x0b, 0x1d, 0x2a, 0xf0, 0x03, 0x32, 0x0d, 0x0b,
+    0x09, 0x0b, 0xb3, 0x09, 0x0a, 0x0d, 0x0e, 0x0d, 0x0c, 0x0a, 0x19, 0x0c,
+    0x0b, 0xd0, 0x0e, 0x04, 0x0c, 0x05, 0x0a, 0x06, 0x2b, 0x19, 0x08, 0x0c,
+    0x07, 0x2d, 0x06, 0x15, 0x1c, 0x07, 0x08, 0x0d, 0x07, 0x17, 0x61, 0x0a,
+    0x07, 0x08, 0x05, 0x1a, 0x16, 0x0c, 0x17, 0x0e, 0x0a, 0x92, 0x0c, 0x0b,
+    0x1d, 0x0c, 0x1e, 0x0f, 0x0d, 0x0d, 0x0e, 0x1c, 0x1d, 0x0b, 0x0e, 0x09,
+    0x0c, 0x0f, 0xf1, 0x0a, 0x0e, 0x08, 0x0d, 0x07, 0x0b, 0x14, 0x1d, 0x03,
+    0x1e, 0x22, 0x0c, 0x18, 0x31, 0x09, 0x0a, 0x19, 0x22, 0x0d, 0x0f, 0xf1,
+    0x03, 0x0b, 0x04, 0x09, 0x03, 0x0a, 0x22, 0x1c, 0x09, 0x31, 0x0b, 0x1e,
+    0x0d, 0x52, 0x0b, 0x0d, 0x2f, 0x1b, 0xf1, 0x31, 0x1d, 0x0c, 0x12, 0x0a,
+    0x1e, 0x03, 0x04, 0x0b, 0x05, 0x0e, 0x19, 0x0c, 0x0b, 0x0e, 0x1d, 0x0f,
+    0x0b, 0x0c, 0x06, 0x0b, 0x05, 0x0a, 0xf1, 0x03, 0x09, 0x11, 0x0b, 0x07,
+    0x60, 0x08, 0x26, 0x07, 0x08, 0x09, 0x51, 0x07, 0x08, 0x0b, 0x09, 0x08,
+    0x0a, 0xf1, 0x10, 0x09, 0x0c, 0x01, 0x07, 0x00, 0x18, 0x31, 0x0a, 0x08,
+    0x0b, 0x22, 0x19, 0x08, 0x04, 0x17, 0x02, 0x01, 0x08, 0x12, 0x09, 0x07,
+    0x31, 0x01, 0x08, 0x03, 0x0a, 0x04, 0x0d, 0x03, 0x0a, 0x12, 0x07, 0x0b,
+    0x0a, 0x08, 0xb3, 0x09, 0x0a, 0x0e, 0x0d, 0x0f, 0x0f, 0x0b, 0x0d, 0x0a,
+    0x1e, 0x07, 0x04, 0x0d, 0x03, 0x19, 0x02, 0x11, 0x0d, 0x0b, 0x12, 0x08,
+    0x34, 0x0c, 0x03, 0x0b, 0x04, 0x0d, 0x05, 0x0a, 0x05, 0x06, 0x18, 0x06,
+    0x08, 0x37, 0x0a, 0x09, 0x0e, 0x0a, 0x0f, 0x0b, 0x0b, 0x0c, 0x06, 0x0f,
+    0x0d, 0x15, 0x09, 0x0a, 0x16, 0x0c, 0x14, 0x0b, 0x04, 0x0f, 0x23, 0x53,
+    0x0e, 0x0a, 0x0f, 0x52, 0x1e, 0x0c, 0x44, 0x08, 0x07, 0x0b, 0x51, 0x09,
+    0x18, 0x13, 0x17, 0x12, 0x2c, 0xf0, 0x11, 0x12, 0x0a, 0x07, 0x03, 0x05,
+    0x05, 0x03, 0x04, 0x12, 0x03, 0x04, 0x31, 0x02, 0x11, 0x10, 0x22, 0x01,
+    0x02, 0x23, 0xf0, 0x05, 0x06, 0x0a, 0x14, 0x0e, 0x07, 0x05, 0x0b, 0x07,
+    0x0d, 0x08, 0x09, 0x0b, 0x1f, 0x0d, 0x2b, 0x09, 0x08, 0x25, 0x0a, 0x09,
+    0x08, 0x04, 0x09, 0xf0, 0x13, 0x1b, 0x04, 0x18, 0x12, 0x09, 0x11, 0x0d,
+    0x0b, 0x13, 0x09, 0x08, 0x04, 0x09, 0x15, 0x0b, 0x0a, 0x23, 0x0c, 0x0d,
+    0x0a, 0x02, 0x0b, 0xd0, 0x44, 0x0c, 0x09, 0x0a, 0x0d, 0x0b, 0x25, 0x1a,
+    0x09, 0x08, 0x0b, 0x16, 0x0a, 0x0c, 0x0c, 0x0d, 0x09, 0x0e, 0x0c, 0x07,
+    0xf1, 0x0f, 0x19, 0x0c, 0x0e, 0x2a, 0x0f, 0x28, 0x39, 0x0d, 0x09, 0x07,
+    0x0b, 0x0c, 0x0c, 0x16, 0x0e, 0x0c, 0x04, 0x0e, 0x03, 0x1f, 0x14, 0xf1,
+    0x1d, 0x0a, 0x08, 0x0c, 0x07, 0x0b, 0x09, 0x2a, 0x0c, 0x08, 0x04, 0x09,
+    0x07, 0x1a, 0x14, 0x09, 0x22, 0x0c, 0x0f, 0x0c, 0x01, 0x09, 0x02, 0x0a,
+    0x61, 0x01, 0x0c, 0x02, 0x0b, 0x11, 0x0c, 0x1d, 0x03, 0x12, 0x0f, 0x09,
+    0x22, 0x14, 0x0e, 0x0f, 0x03, 0x0b, 0x03, 0x05, 0x09, 0x74, 0x16, 0x0b,
+    0x2e, 0x08, 0x1f, 0x0c, 0x0e, 0x1b, 0x0f, 0x08, 0x0d, 0x13, 0x09, 0x0a,
+    0x0b, 0x0e, 0x12, 0x15, 0x09, 0x1f, 0x81, 0x04, 0x03, 0x0e, 0x01, 0x0d,
+    0x03, 0x0a, 0x02, 0x17, 0x01, 0x05, 0x06, 0x03, 0x05, 0x04, 0x2a, 0xf0,
+    0x13, 0x02, 0x0b, 0x01, 0x09, 0x02, 0x28, 0x21, 0x07, 0x00, 0x0c, 0x01,
+    0x09, 0x50, 0x08, 0x16, 0x04, 0x35, 0xf0, 0x01, 0x02, 0x21, 0x07, 0x28,
+    0x22, 0x1a, 0x05, 0x1b, 0x03, 0x04, 0x0c, 0x06, 0x1a, 0x05, 0x0c, 0x09,
+    0x06, 0x0a, 0x0f, 0x0b, 0xf0, 0x18, 0x0c, 0x0d, 0x0d, 0x0b, 0x06, 0x0a,
+    0x09, 0x0b, 0x07, 0x1a, 0x06, 0x04, 0x0b, 0x06, 0x0a, 0x09, 0x09, 0x03,
+    0x0a, 0x08, 0x0b, 0x06, 0x0c, 0x05, 0x0a, 0x0d, 0x0b, 0x05, 0x0c, 0xf0,
+    0x0f, 0x0e, 0x18, 0x0c, 0x0e, 0x0b, 0x0c, 0x04, 0x1b, 0x0f, 0x04, 0x29,
+    0x06, 0x0e, 0x02, 0x0a, 0x05, 0x0e, 0x09, 0x0d, 0x05, 0x0b, 0x2f, 0x0c,
+    0x1d, 0xd0, 0x05, 0x0c, 0x08, 0x0a, 0x09, 0x18, 0x02, 0x0a, 0x29, 0x04,
+    0x03, 0x15, 0x08, 0x09, 0x06, 0x0a, 0x03, 0x0c, 0x0f, 0x0f, 0x07, 0x0d,
+    0x05, 0x06, 0x81, 0x0f, 0x37, 0x05, 0x0a, 0x09, 0x05, 0x08, 0x0c, 0x0a,
+    0x15, 0x0e, 0x0f, 0x08, 0x09, 0x52, 0x06, 0x1a, 0x08, 0x09, 0x0b, 0x18,
+    0x1d, 0x06, 0x09, 0xf3, 0x0b, 0x0b, 0x05, 0x0c, 0x06, 0x0e, 0x0a, 0x0d,
+    0x04, 0x1c, 0x07, 0x06, 0x0a, 0x07, 0x1b, 0x05, 0x16, 0x2a, 0x05, 0x18,
+    0x0d, 0x0e, 0x09, 0x0d, 0x0f, 0x0c, 0x23, 0x07, 0x0a, 0x14, 0x08, 0x0b,
+    0x32, 0x21, 0x0a, 0x08, 0x06, 0x02, 0x08, 0x21, 0x11, 0x17, 0x02, 0x0c,
+    0xf0, 0x11, 0x08, 0x06, 0x50, 0x07, 0x05, 0x03, 0x02, 0x01, 0x30, 0x01,
+    0x00, 0x12, 0x01, 0x00, 0x02, 0x01, 0x14, 0x20, 0x16, 0xb0, 0x01, 0x15,
+    0x03, 0x02, 0x04, 0x05, 0x05, 0x14, 0x07, 0x08, 0x02, 0x09, 0x03, 0x0a,
+    0x07, 0x0c, 0x01, 0x0e, 0x03, 0x08, 0x21, 0x05, 0x1d, 0x01, 0x02, 0x08,
+    0x02, 0x05, 0x07, 0x13, 0x04, 0x0a, 0x02, 0x08, 0x14, 0x06, 0x0a, 0x09,
+    0x09, 0x85, 0x13, 0x0a, 0x0d, 0x0f, 0x1e, 0x03, 0x02, 0x1b, 0x09, 0x11,
+    0x0c, 0x0a, 0x22, 0x09, 0x34, 0x07, 0x06, 0x01, 0x07, 0x02, 0x0b, 0x53,
+    0x00, 0x0e, 0x11, 0x09, 0x0c, 0x00, 0x09, 0x01, 0x0b, 0x22, 0x0c, 0xf2,
+    0x0a, 0x0e, 0x14, 0x0d, 0x0c, 0x03, 0x1b, 0x04, 0x03, 0x0e, 0x02, 0x0a,
+    0x23, 0x0d, 0x0a, 0x0d, 0x02, 0x0c, 0x03, 0x0a, 0x04, 0x1d, 0x02, 0x06,
+    0x0e, 0xf2, 0x09, 0x0d, 0x07, 0x1e, 0x0c, 0x0f, 0x0c, 0x06, 0x2a, 0x05,
+    0x13, 0x0e, 0x02, 0x0a, 0x03, 0x0b, 0x14, 0x0d, 0x0c, 0x05, 0x0b, 0x16,
+    0x1a, 0x04, 0x09, 0xf2, 0x05, 0x0a, 0x01, 0x18, 0x03, 0x10, 0x07, 0x0a,
+    0x04, 0x08, 0x00, 0x07, 0x04, 0x08, 0x06, 0x19, 0x03, 0x06, 0x0b, 0x03,
+    0x0c, 0x09, 0x0d, 0x04, 0x0a, 0x03, 0x0b, 0x0e, 0x09, 0x02, 0x05, 0x0a,
+    0x21, 0x06, 0x09, 0x0b, 0x08, 0x08, 0x0e, 0xf0, 0x02, 0x1a, 0x06, 0x03,
+    0x08, 0x01, 0x19, 0x03, 0x02, 0x07, 0x01, 0x09, 0x00, 0x0f, 0x11, 0x1d,
+    0x00, 0x0f, 0x02, 0x0b, 0x04, 0x08, 0x02, 0x09, 0x04, 0x0c, 0x23, 0x0b,
+    0xf0, 0x08, 0x1a, 0x02, 0x03, 0x08, 0x04, 0x1a, 0x02, 0x04, 0x1b, 0x05,
+    0x01, 0x0c, 0x12, 0x09, 0x07, 0x30, 0x06, 0x04, 0x05, 0x03, 0x12, 0x22,
+    0x91, 0x04, 0x06, 0x03, 0x03, 0x04, 0x07, 0x06, 0x15, 0x07, 0x0a, 0x0a,
+    0x0e, 0x16, 0x0f, 0x0b, 0xf2, 0x0f, 0x0e, 0x0a, 0x0b, 0x05, 0x0a, 0x0f,
+    0x0b, 0x05, 0x0c, 0x14, 0x0b, 0x0a, 0x02, 0x0b, 0x03, 0x09, 0x00, 0x0a,
+    0x11, 0x08, 0x0a, 0x00, 0x09, 0x01, 0x0a, 0x02, 0x0d, 0x11, 0x0a, 0xf2,
+    0x29, 0x03, 0x01, 0x12, 0x28, 0x11, 0x07, 0x00, 0x29, 0x12, 0x01, 0x1e,
+    0x05, 0x03, 0x0b, 0x01, 0x0c, 0x03, 0x08, 0x11, 0x0a, 0x52, 0x08, 0x12,
+    0x07, 0x09, 0x05, 0x0b, 0x04, 0x0c, 0x05, 0x0a, 0x93, 0x0f, 0x2e, 0x03,
+    0x1a, 0x0d, 0x04, 0x1e, 0x05, 0x04, 0x09, 0x03, 0x18, 0x12, 0x1f, 0xf2,
+    0x01, 0x03, 0x1d, 0x14, 0x0c, 0x06, 0x1b, 0x07, 0x08, 0x0c, 0x0b, 0x0e,
+    0x05, 0x1d, 0x0b, 0x07, 0x2b, 0x06, 0x0a, 0x04, 0x1d, 0x0f, 0x09, 0x0b,
+    0x22, 0x05, 0x0d, 0x0f, 0x0b, 0x06, 0x0f, 0xb1, 0x05, 0x0e, 0x06, 0x0b,
+    0x13, 0x08, 0x07, 0x01, 0x08, 0x02, 0x27, 0x01, 0x00, 0x02, 0x09, 0x10,
+    0x08, 0x07, 0x02, 0x0a, 0xf0, 0x00, 0x0c, 0x11, 0x2f, 0x02, 0x04, 0x0b,
+    0x02, 0x0f, 0x05, 0x0d, 0x04, 0x0b, 0x03, 0x0c, 0x14, 0x0b, 0x19, 0x22,
+    0x08, 0x0a, 0x21, 0x0b, 0x0c, 0xf0, 0x0e, 0x02, 0x18, 0x01, 0x02, 0x0a,
+    0x10, 0x0e, 0x0f, 0x11, 0x0c, 0x0a, 0x02, 0x0c, 0x03, 0x0a, 0x15, 0x0d,
+    0x0c, 0x07, 0x0b, 0x05, 0x0c, 0x0a, 0x0a, 0x05, 0x09, 0xd0, 0x06, 0x0b,
+    0x07, 0x1d, 0x13, 0x1a, 0x04, 0x13, 0x0c, 0x0d, 0x25, 0x0c, 0x0a, 0x0b,
+    0x04, 0x0a, 0x25, 0x0d, 0x0c, 0x06, 0xf1, 0x08, 0x17, 0x07, 0x1c, 0x18,
+    0x05, 0x09, 0x08, 0x1a, 0x05, 0x04, 0x0b, 0x0a, 0x4a, 0x05, 0x17, 0x02,
+    0x03, 0x08, 0x01, 0x07, 0x00, 0x1b, 0x81, 0x01, 0x00, 0x07, 0x01, 0x0a,
+    0x02, 0x0d, 0x01, 0x1c, 0x02, 0x03, 0x0b, 0x14, 0x0f, 0x0a, 0xf2, 0x07,
+    0x0c, 0x0a, 0x0d, 0x06, 0x1c, 0x0c, 0x08, 0x0d, 0x16, 0x0c, 0x0b, 0x0b,
+    0x1d, 0x05, 0x04, 0x1e, 0x05, 0x02, 0x0b, 0x04, 0x29, 0x03, 0x05, 0x09,
+    0x0a, 0x32, 0x05, 0x0d, 0x0a, 0x0e, 0x06, 0x0c, 0x03, 0x28, 0x63, 0x0b,
+    0x06, 0x07, 0x0b, 0x0f, 0x0f, 0x05, 0x0a, 0x06, 0x09, 0x03, 0x0d, 0x12,
+    0x12, 0x0a, 0x0f, 0x71, 0x03, 0x0c, 0x05, 0x0b, 0x24, 0x19, 0x28, 0x01,
+    0x02, 0x11, 0x0f, 0xf0, 0x1d, 0x03, 0x04, 0x0a, 0x05, 0x1c, 0x06, 0x0a,
+    0x0b, 0x05, 0x0e, 0x0f, 0x0b, 0x05, 0x1a, 0x16, 0x0b, 0x03, 0x08, 0x04,
+    0x27, 0x22, 0x18, 0xf0, 0x51, 0x0b, 0x0a, 0x08, 0x09, 0x27, 0x02, 0x01,
+    0x12, 0x0a, 0x08, 0x03, 0x09, 0x04, 0x0a, 0x03, 0x0b, 0x05, 0x0d, 0x06,
+    0x0b, 0x05, 0x0a, 0xf0, 0x08, 0x18, 0x06, 0x13, 0x09, 0x08, 0x21, 0x07,
+    0x08, 0x09, 0x02, 0x18, 0x01, 0x03, 0x0a, 0x05, 0x08, 0x01, 0x19, 0x04,
+    0x01, 0x0c, 0x02, 0x0e, 0x05, 0x3a, 0x80, 0x03, 0x07, 0x04, 0x06, 0x0b,
+    0x04, 0x0a, 0x03, 0x09, 0x05, 0x0d, 0x03, 0x0e, 0x05, 0x08, 0xf1, 0x17,
+    0x09, 0x0a, 0x1f, 0x0b, 0x0a, 0x06, 0x0b, 0x05, 0x0d, 0x03, 0x0a, 0x12,
+    0x29, 0x11, 0x07, 0x22, 0x06, 0x05, 0x24, 0x06, 0x03, 0xd1, 0x07, 0x15,
+    0x0a, 0x04, 0x46, 0x08, 0x04, 0x05, 0x04, 0x03, 0x08, 0x14, 0x09, 0x0b,
+    0x05, 0x0c, 0x0b, 0x1d, 0x06, 0x0a, 0x07, 0x42, 0x0b, 0x08, 0x04, 0x19,
+    0x07, 0x03, 0x0a, 0x04, 0x08, 0x23, 0x07, 0x0a, 0x05, 0x0b, 0x0a, 0x1a,
+    0x04, 0x0f, 0xa5, 0x18, 0x0b, 0x0c, 0x0f, 0x0e, 0x07, 0x0b, 0x05, 0x09,
+    0x06, 0x2a, 0x05, 0x14, 0x19, 0x0d, 0x07, 0x0a, 0x24, 0x03, 0x0b, 0x0f,
+    0x19, 0x13, 0x03, 0x0b, 0x12, 0x0e, 0x09, 0x04, 0x0d, 0x61, 0x06, 0x0b,
+    0x0e, 0x0a, 0x16, 0x09, 0x08, 0x08, 0x17, 0x17, 0x1e, 0xf0, 0x05, 0x0b,
+    0x0d, 0x03, 0x1c, 0x02, 0x03, 0x0a, 0x40, 0x0c, 0x0b, 0x0f, 0x1e, 0x02,
+    0x09, 0x11, 0x06, 0x09, 0x03, 0x08, 0x00, 0x05, 0x11, 0x07, 0xf0, 0x05,
+    0x00, 0x06, 0x01, 0x07, 0x00, 0x0a, 0x04, 0x18, 0x01, 0x06, 0x0a, 0x05,
+    0x09, 0x02, 0x1a, 0x06, 0x21, 0x0b, 0x0c, 0x0a, 0x00, 0x0c, 0x01, 0x08,
+    0x02, 0x0a, 0x10, 0x01, 0x0f, 0x06, 0x18, 0xf1, 0x05, 0x04, 0x0c, 0x0f,
+    0x0e, 0x07, 0x0b, 0x04, 0x0d, 0x0f, 0x0e, 0x06, 0x0b, 0x04, 0x0d, 0x03,
+    0x0a, 0x12, 0x0e, 0x0b, 0x00, 0x09, 0x15, 0x0a, 0x09, 0x02, 0x0b, 0x05,
+    0x0a, 0xf1, 0x06, 0x09, 0x01, 0x07, 0x06, 0x08, 0x03, 0x07, 0x05, 0x39,
+    0x06, 0x05, 0x07, 0x03, 0x0a, 0x08, 0x0b, 0x02, 0x09, 0x03, 0x0a, 0x12,
+    0x18, 0x01, 0x09, 0x04, 0x17, 0xf1, 0x12, 0x09, 0x03, 0x18, 0x21, 0x0a,
+    0x0d, 0x00, 0x0a, 0x01, 0x08, 0x03, 0x0b, 0x02, 0x0a, 0x14, 0x0b, 0x0a,
+    0x09, 0x19, 0x03, 0x08, 0x1b, 0x06, 0x71, 0x05, 0x0d, 0x08, 0x0c, 0x0a,
+    0x0b, 0x13, 0x19, 0x04, 0x0d, 0x00, 0x0f, 0x04, 0x09, 0x12, 0x02, 0x0d,
+    0x03, 0x0b, 0x13, 0x06, 0x0d, 0x09, 0x0a, 0x04, 0x0f, 0x28, 0x45, 0x0e,
+    0x15, 0x07, 0x02, 0x26, 0x11, 0x06, 0x07, 0x02, 0x04, 0x08, 0x04, 0x23,
+    0x0a, 0x02, 0x0d, 0x0f, 0x1e, 0x03, 0x12, 0x05, 0x0d, 0x06, 0x71, 0x0e,
+    0x02, 0x0a, 0x03, 0x09, 0x11, 0x08, 0x09, 0x30, 0x27, 0xf0, 0x09, 0x02,
+    0x08, 0x03, 0x17, 0x02, 0x0f, 0x08, 0x05, 0x29, 0x0e, 0x09, 0x14, 0x0a,
+    0x0e, 0x01, 0x0d, 0x02, 0x0a, 0x01, 0x09, 0x04, 0x0d, 0x05, 0x0c, 0x03,
+    0x1e, 0x08, 0xc0, 0x05, 0x3c, 0x03, 0x07, 0x05, 0x09, 0x0b, 0x03, 0x0a,
+    0x0a, 0x0b, 0x09, 0x3a, 0x02, 0x0d, 0x11, 0x0f, 0x02, 0x71, 0x0c, 0x01,
+    0x0b, 0x02, 0x0e, 0x15, 0x0c, 0x0d, 0x0f, 0x0e, 0x08, 0x0b, 0x07, 0x0c,
+    0x0f, 0xf0, 0x0f, 0x01, 0x0e, 0x04, 0x2c, 0x13, 0x0c, 0x0b, 0x05, 0x1a,
+    0x16, 0x09, 0x05, 0x1a, 0x06, 0x0a, 0x0c, 0x0e, 0x0e, 0x1d, 0x0d, 0x1c,
+    0x07, 0x06, 0xf0, 0x0a, 0x03, 0x19, 0x05, 0x01, 0x08, 0x02, 0x19, 0x08,
+    0x02, 0x0a, 0x0f, 0x0c, 0x14, 0x0b, 0x09, 0x06, 0x18, 0x13, 0x09, 0x02,
+    0x0b, 0x04, 0x0c, 0x13, 0x0f, 0x11, 0x0b, 0x06, 0x0c, 0x0b, 0x02, 0x09,
+    0x04, 0x13, 0x17, 0x05, 0x0d, 0x14, 0x36, 0x15, 0x35, 0x0f, 0x03, 0x15,
+    0x04, 0x02, 0x06, 0x14, 0x01, 0x07, 0x03, 0x1c, 0xf3, 0x00, 0x03, 0x0b,
+    0x02, 0x09, 0x00, 0x0e, 0x01, 0x0b, 0x00, 0x09, 0x01, 0x07, 0x10, 0x0c,
+    0x0f, 0x04, 0x1e, 0x01, 0x04, 0x0d, 0x0f, 0x0e, 0x02, 0x08, 0x0d, 0x09,
+    0x0f, 0x0d, 0x32, 0x04, 0x0b, 0x0f, 0x09, 0x0e, 0x07, 0x06, 0x0b, 0x21,
+    0x24, 0x19, 0x0f, 0xf0, 0x01, 0x0e, 0x03, 0x08, 0x02, 0x07, 0x00, 0x06,
+    0x01, 0x05, 0x02, 0x04, 0x00, 0x15, 0x04, 0x09, 0x06, 0x01, 0x08, 0x0c,
+    0x09, 0x04, 0x08, 0x01, 0x0a, 0x03, 0x09, 0x02, 0x1a, 0x13, 0xf0, 0x18,
+    0x0f, 0x04, 0x07, 0x03, 0x08, 0x09, 0x09, 0x03, 0x08, 0x02, 0x09, 0x08,
+    0x1d, 0x07, 0x04, 0x0e, 0x0f, 0x0f, 0x09, 0x0a, 0x02, 0x09, 0x03, 0x0e,
+    0x02, 0x0b, 0x03, 0x1a, 0xf0, 0x14, 0x0b, 0x09, 0x1a, 0x03, 0x08, 0x2c,
+    0x05, 0x09, 0x0f, 0x0f, 0x08, 0x0d, 0x0d, 0x0c, 0x09, 0x0a, 0x04, 0x29,
+    0x13, 0x02, 0x17, 0x04, 0x50, 0x03, 0x18, 0x04, 0x03, 0x1b, 0x08, 0x03,
+    0x0c, 0x05, 0x0a, 0xf1, 0x0f, 0x0f, 0x04, 0x0d, 0x0f, 0x0f, 0x06, 0x0b,
+    0x04, 0x09, 0x02, 0x18, 0x03, 0x02, 0x09, 0x01, 0x0e, 0x0a, 0x1d, 0x02,
+    0x03, 0x0e, 0x08, 0x0b, 0x00, 0x0a, 0x03, 0x19, 0x02, 0xf1, 0x00, 0x18,
+    0x02, 0x00, 0x16, 0x11, 0x23, 0x00, 0x03, 0x02, 0x04, 0x05, 0x15, 0x0f,
+    0x06, 0x06, 0x0f, 0x09, 0x05, 0x08, 0x04, 0x0b, 0x05, 0x0d, 0x03, 0x0e,
+    0xf1, 0x0f, 0x0f, 0x0a, 0x0d, 0x0d, 0x0c, 0x1b, 0x0b, 0x0a, 0x08, 0x19,
+    0x04, 0x06, 0x0b, 0x04, 0x0e, 0x03, 0x0c, 0x04, 0x1b, 0x05, 0x03, 0x0a,
+    0x04, 0x1d, 0x09, 0x05, 0x0a, 0xd1, 0x07, 0x2b, 0x0d, 0x04, 0x13, 0x0a,
+    0x08, 0x01, 0x07, 0x02, 0x16, 0x04, 0x01, 0x08, 0x03, 0x0e, 0x02, 0x0c,
+    0x00, 0x0e, 0x01, 0x0f, 0x00, 0x0a, 0x82, 0x11, 0x1b, 0x04, 0x0a, 0x05,
+    0x2b, 0x03, 0x05, 0x07, 0x1a, 0x04, 0x0e, 0x16, 0x13, 0x1f, 0x14, 0x14,
+    0x09, 0x06, 0x03, 0x05, 0x0b, 0x02, 0x06, 0x01, 0x11, 0x17, 0x05, 0x03,
+    0xf0, 0x08, 0x01, 0x1b, 0x06, 0x02, 0x09, 0x05, 0x08, 0x04, 0x09, 0x03,
+    0x0b, 0x05, 0x0c, 0x01, 0x0e, 0x14, 0x0d, 0x0c, 0x01, 0x0d, 0x06, 0x0b,
+    0x05, 0x09, 0x03, 0x0a, 0x06, 0x1c, 0x05, 0x50, 0x03, 0x0a, 0x02, 0x08,
+    0x13, 0x17, 0x01, 0x09, 0x09, 0xf1, 0x27, 0x03, 0x01, 0x03, 0x09, 0x20,
+    0x08, 0x07, 0x0a, 0x01, 0x0b, 0x02, 0x3a, 0x03, 0x15, 0x04, 0x0b, 0x05,
+    0x1a, 0x08, 0x06, 0x0d, 0x05, 0x02, 0x0a, 0x17, 0x03, 0x09, 0x04, 0x18,
+    0x06, 0x15, 0x09, 0x1b, 0x0e, 0x06, 0x0c, 0x07, 0x1c, 0x0f, 0x09, 0x0a,
+    0x08, 0x3d, 0x09, 0x07, 0x08, 0x06, 0x03, 0x05, 0x04, 0x04, 0x1e, 0x03,
+    0x13, 0x01, 0x2b, 0x12, 0x12, 0x01, 0x61, 0x0f, 0x00, 0x0b, 0x02, 0x0d,
+    0x10, 0x0c, 0x19, 0x02, 0x00, 0x0a, 0x01, 0xf0, 0x0c, 0x30, 0x08, 0x1d,
+    0x1e, 0x13, 0x09, 0x04, 0x08, 0x08, 0x39, 0x04, 0x03, 0x05, 0x02, 0x0b,
+    0x04, 0x0e, 0x16, 0x0d, 0x1c, 0x17, 0xf0, 0x0b, 0x06, 0x1a, 0x01, 0x23,
+    0x0b, 0x0d, 0x0c, 0x05, 0x0e, 0x09, 0x3f, 0x0e, 0x08, 0x0f, 0x08, 0x0c,
+    0x04, 0x0d, 0x06, 0x0c, 0x05, 0x0e, 0x03, 0xf0, 0x0d, 0x22, 0x0e, 0x1c,
+    0x01, 0x0a, 0x03, 0x09, 0x02, 0x0b, 0x03, 0x0e, 0x04, 0x0c, 0x13, 0x0d,
+    0x0c, 0x01, 0x0e, 0x03, 0x0d, 0x02, 0x0c, 0x03, 0x0b, 0x12, 0x09, 0xe0,
+    0x0c, 0x03, 0x19, 0x01, 0x04, 0x0a, 0x03, 0x0c, 0x02, 0x0d, 0x04, 0x0c,
+    0x12, 0x0b, 0x09, 0x03, 0x2b, 0x02, 0x04, 0x05, 0x0e, 0x06, 0x1d, 0x08,
+    0x04, 0x21, 0x09, 0x03, 0x0b, 0x11, 0x0c, 0x32, 0x1a, 0x02, 0x03, 0x0b,
+    0x06, 0x0e, 0x09, 0x03, 0x0d, 0x0f, 0x14, 0x0b, 0x04, 0x0a, 0x03, 0x03,
+    0x0c, 0x02, 0x32, 0x0e, 0x00, 0x0b, 0x11, 0x19, 0x23, 0xf1, 0x0c, 0x09,
+    0x0a, 0x07, 0x09, 0x02, 0x08, 0x04, 0x19, 0x07, 0x04, 0x0a, 0x07, 0x69,
+    0x15, 0x02, 0x01, 0x12, 0x03, 0x08, 0x05, 0x21, 0x09, 0x06, 0x0a, 0x14,
+    0x0c, 0xf2, 0x0a, 0x06, 0x0b, 0x04, 0x1e, 0x07, 0x0f, 0x0f, 0x09, 0x0e,
+    0x0c, 0x0c, 0x07, 0x2b, 0x05, 0x06, 0x05, 0x1c, 0x0c, 0x0a, 0x1b, 0x08,
+    0x0e, 0x0a, 0x06, 0x09, 0x0f, 0x01, 0x0d, 0x0d, 0xf0, 0x0f, 0x06, 0x1e,
+    0x0f, 0x05, 0x19, 0x13, 0x28, 0x01, 0x00, 0x01, 0x07, 0x10, 0x09, 0x0b,
+    0x02, 0x09, 0x01, 0x17, 0x02, 0x01, 0x08, 0x00, 0x0b, 0x01, 0x70, 0x08,
+    0x00, 0x19, 0x22, 0x08, 0x0a, 0x06, 0x0b, 0x14, 0x09, 0x0d, 0x06, 0x11,
+    0x1a, 0x08, 0x06, 0xf2, 0x08, 0x0c, 0x39, 0x17, 0x06, 0x04, 0x3a, 0x06,
+    0x07, 0x09, 0x0e, 0x0b, 0x0f, 0x2a, 0x04, 0x15, 0x0b, 0x04, 0x19, 0x05,
+    0x14, 0x42, 0x0a, 0x2b, 0x13, 0x02, 0x0c, 0x01, 0x03, 0x09, 0x02, 0x22,
+    0x0a, 0x01, 0x19, 0x40, 0x81, 0x0f, 0x0d, 0x0e, 0x0b, 0x01, 0x1d, 0x02,
+    0x40, 0x1e, 0x0c, 0xf0, 0x0f, 0x0d, 0x01, 0x0e, 0x12, 0x0b, 0x0d, 0x03,
+    0x0a, 0x05, 0x0b, 0x02, 0x1e, 0x01, 0x02, 0x1f, 0x01, 0x02, 0x0b, 0x03,
+    0x0a, 0x05, 0x0b, 0x03, 0x0d, 0x07, 0x0c, 0x05, 0xf0, 0x1b, 0x04, 0x06,
+    0x1e, 0x07, 0x0b, 0x2d, 0x08, 0x0e, 0x06, 0x2b, 0x05, 0x07, 0x06, 0x0a,
+    0x05, 0x1c, 0x0f, 0x04, 0x0b, 0x05, 0x09, 0x03, 0x0a, 0x00, 0xd0, 0x0e,
+    0x01, 0x1f, 0x00, 0x22, 0x0e, 0x2f, 0x04, 0x02, 0x0d, 0x03, 0x1a, 0x06,
+    0x13, 0x0c, 0x0b, 0x04, 0x0a, 0x12, 0x0e, 0x21, 0x09, 0x03, 0x0a, 0x05,
+    0x0c, 0x08, 0xf2, 0x0a, 0x0b, 0x0c, 0x0f, 0x0e, 0x08, 0x0c, 0x16, 0x0a,
+    0x19, 0x03, 0x05, 0x1b, 0x06, 0x05, 0x0a, 0x0d, 0x89, 0x0a, 0x07, 0x0a,
+    0x0f, 0x07, 0x08, 0x42, 0x0c, 0x07, 0x08, 0x18, 0x0e, 0x0f, 0x21, 0x0a,
+    0x08, 0x09, 0x0b, 0x08, 0x06, 0xf0, 0x0c, 0x03, 0x1b, 0x04, 0x03, 0x0c,
+    0x05, 0x0b, 0x04, 0x0e, 0x08, 0x0d, 0x0f, 0x1c, 0x06, 0x09, 0x1b, 0x06,
+    0x04, 0x0d, 0x02, 0x1c, 0x04, 0x03, 0x0b, 0x02, 0x0c, 0x07, 0xf0, 0x0e,
+    0x04, 0x0c, 0x16, 0x0b, 0x2a, 0x07, 0x18, 0x19, 0x0f, 0x0e, 0x28, 0x05,
+    0x12, 0x26, 0x20, 0x07, 0x01, 0x16, 0x22, 0xf0, 0x07, 0x18, 0x01, 0x30,
+    0x0b, 0x09, 0x0d, 0x09, 0x01, 0x0c, 0x12, 0x0b, 0x1a, 0x04, 0x03, 0x09,
+    0x12, 0x0b, 0x18, 0x21, 0xf0, 0x09, 0x0c, 0x02, 0x0d, 0x04, 0x1e, 0x0b,
+    0x18, 0x1d, 0x09, 0x1e, 0x04, 0x23, 0x0f, 0x0e, 0x1c, 0x24, 0x1a, 0x05,
+    0x29, 0x04, 0xa0, 0x07, 0x05, 0x1a, 0x04, 0x06, 0x1c, 0x07, 0x08, 0x0b,
+    0x0c, 0x0c, 0x07, 0x1b, 0x06, 0x08, 0x0e, 0x03, 0x01, 0x0a, 0x04, 0x02,
+    0x09, 0x07, 0x03, 0x07, 0x09, 0x04, 0x06, 0x0f, 0x06, 0x05, 0x0d, 0x07,
+    0x04, 0x0e, 0x09, 0x03, 0x0a, 0x0d, 0xf2, 0x05, 0x0c, 0x17, 0x0b, 0x0c,
+    0x08, 0x1f, 0x0f, 0x0c, 0x0d, 0x09, 0x0a, 0x05, 0x38, 0x02, 0x01, 0x10,
+    0x0a, 0x12, 0x19, 0x04, 0x0c, 0x06, 0x1d, 0xa2, 0x04, 0x06, 0x1b, 0x04,
+    0x03, 0x0e, 0x14, 0x0b, 0x09, 0x05, 0x0d, 0x0c, 0x0b, 0x08, 0x09, 0x0a,
+    0x08, 0x08, 0x0e, 0xf1, 0x06, 0x0d, 0x08, 0x1b, 0x05, 0x07, 0x0c, 0x26,
+    0x0b, 0x1a, 0x22, 0x0d, 0x0e, 0x19, 0x01, 0x02, 0x18, 0x03, 0x15, 0x09,
+    0x0a, 0x0a, 0x19, 0x21, 0x1f, 0x08, 0x09, 0x0d, 0xf0, 0x06, 0x0b, 0x04,
+    0x0d, 0x02, 0x0a, 0x44, 0x08, 0x19, 0x0c, 0x0b, 0x02, 0x0a, 0x13, 0x1d,
+    0x02, 0x1e, 0x04, 0x02, 0x1d, 0x41, 0x0a, 0xf0, 0x09, 0x0e, 0x0d, 0x02,
+    0x0a, 0x03, 0x09, 0x32, 0x1a, 0x08, 0x0a, 0x03, 0x18, 0x02, 0x01, 0x09,
+    0x02, 0x08, 0x10, 0x0c, 0x08, 0x01, 0x06, 0xf0, 0x00, 0x07, 0x11, 0x08,
+    0x0a, 0x02, 0x09, 0x33, 0x08, 0x0b, 0x0a, 0x0e, 0x04, 0x0b, 0x27, 0x0c,
+    0x0b, 0x1c, 0x0f, 0x04, 0x0a, 0x25, 0x0b, 0x0d, 0x10, 0x0b, 0x07, 0x07,
+    0x91, 0x0f, 0x08, 0x0e, 0x09, 0x09, 0x2a, 0x07, 0x05, 0x08, 0x0b, 0x04,
+    0x0a, 0x06, 0x0d, 0x05, 0x0e, 0x04, 0x08, 0xd2, 0x05, 0x09, 0x03, 0x1b,
+    0x15, 0x09, 0x06, 0x0a, 0x0f, 0x0b, 0x08, 0x1a, 0x06, 0x08, 0x1b, 0x03,
+    0x12, 0x09, 0x0a, 0x11, 0x09, 0x0e, 0xf1, 0x02, 0x0d, 0x30, 0x0f, 0x0b,
+    0x0e, 0x0b, 0x02, 0x0c, 0x03, 0x0e, 0x07, 0x1b, 0x06, 0x05, 0x0a, 0x03,
+    0x09, 0x01, 0x0d, 0x02, 0x1e, 0x03, 0x05, 0x0d, 0x06, 0x0c, 0xf1, 0x0f,
+    0x0e, 0x04, 0x0c, 0x03, 0x1f, 0x06, 0x02, 0x0e, 0x07, 0x2f, 0x0f, 0x06,
+    0x0a, 0x0d, 0x06, 0x0c, 0x03, 0x1e, 0x02, 0x03, 0x0a, 0x14, 0x19, 0x05,
+    0x08, 0x01, 0x04, 0x0d, 0xf0, 0x12, 0x3f, 0x13, 0x0a, 0x0e, 0x1b, 0x0c,
+    0x1b, 0x07, 0x04, 0x0a, 0x03, 0x0b, 0x02, 0x1c, 0x14, 0x0a, 0x26, 0x1b,
+    0x0d, 0xf0, 0x04, 0x0b, 0x15, 0x0a, 0x0c, 0x03, 0x1b, 0x07, 0x05, 0x0a,
+    0x12, 0x0d, 0x0c, 0x11, 0x09, 0x07, 0x02, 0x09, 0x04, 0x2b, 0x0a, 0x17,
+    0x0a, 0x04, 0x19, 0xf0, 0x31, 0x08, 0x1c, 0x03, 0x0a, 0x04, 0x18, 0x12,
+    0x07, 0x21, 0x18, 0x0a, 0x22, 0x0c, 0x0e, 0x09, 0x11, 0x0c, 0x17, 0x70,
+    0x10, 0x0b, 0x11, 0x0a, 0x09, 0x04, 0x1a, 0x06, 0x09, 0x0d, 0x0c, 0x07,
+    0x61, 0x0e, 0x18, 0x08, 0x06, 0x09, 0x0d, 0x0b, 0x08, 0x0d, 0x09, 0x0f,
+    0x1f, 0x0a, 0xf2, 0x39, 0x26, 0x05, 0x1a, 0x06, 0x0d, 0x0b, 0x09, 0x0a,
+    0x17, 0x0c, 0x0d, 0x05, 0x0c, 0x08, 0x0e, 0x05, 0x0d, 0x14, 0x1a, 0x03,
+    0x09, 0xf2, 0x11, 0x0a, 0x29, 0x22, 0x1a, 0x06, 0x0c, 0x09, 0x05, 0x2a,
+    0x08, 0x0d, 0x03, 0x0b, 0x14, 0x0c, 0x0a, 0x02, 0x0c, 0x13, 0x0a, 0x08,
+    0xf2, 0x12, 0x0d, 0x0a, 0x23, 0x0d, 0x0c, 0x1e, 0x14, 0x0b, 0x02, 0x0d,
+    0x31, 0x0e, 0x0a, 0x07, 0x1a, 0x02, 0x04, 0x0b, 0x08, 0x1d, 0x06, 0x42,
+    0x17, 0x0e, 0x1d, 0x06, 0x07, 0x0e, 0x05, 0x08, 0x63, 0x07, 0x1a, 0x0f,
+    0x16, 0x18, 0x04, 0x06, 0x02, 0x05, 0x01, 0x08, 0x02, 0x00, 0x0e, 0x81,
+    0x12, 0x0a, 0x09, 0x01, 0x0b, 0x02, 0x0f, 0x03, 0x0c, 0x01, 0x0d, 0x02,
+    0x0b, 0x01, 0x09, 0x02, 0x1e, 0xf0, 0x11, 0x0a, 0x02, 0x0d, 0x00, 0x0f,
+    0x21, 0x0b, 0x19, 0x10, 0x05, 0x19, 0x01, 0x00, 0x07, 0x01, 0x08, 0x02,
+    0x07, 0x31, 0x08, 0x07, 0x09, 0xf0, 0x0b, 0x10, 0x0a, 0x0e, 0x01, 0x0a,
+    0x00, 0x0c, 0x01, 0x0d, 0x02, 0x08, 0x03, 0x19, 0x22, 0x07, 0x18, 0x01,
+    0x02, 0x17, 0x13, 0x08, 0x05, 0x0a, 0x60, 0x08, 0x0b, 0x03, 0x1a, 0x25,
+    0x0b, 0x0c, 0x06, 0x0e, 0x07, 0x08, 0xf1, 0x0f, 0x0c, 0x07, 0x0b, 0x0d,
+    0x0d, 0x0e, 0x0e, 0x06, 0x0d, 0x07, 0x0e, 0x15, 0x0d, 0x0e, 0x04, 0x0d,
+    0x06, 0x0c, 0x07, 0x0d, 0x04, 0x0b, 0x0a, 0x0a, 0x04, 0x09, 0x03, 0x0d,
+    0x07, 0x0b, 0xf1, 0x03, 0x09, 0x05, 0x0a, 0x08, 0x0c, 0x0c, 0x0d, 0x0e,
+    0x0e, 0x0b, 0x0d, 0x0e, 0x1e, 0x04, 0x06, 0x0c, 0x04, 0x0e, 0x07, 0x0b,
+    0x0f, 0x0d, 0x09, 0x1b, 0x0f, 0x08, 0x2a, 0x07, 0xf1, 0x25, 0x0b, 0x1a,
+    0x02, 0x23, 0x08, 0x07, 0x08, 0x05, 0x1b, 0x06, 0x08, 0x19, 0x14, 0x08,
+    0x02, 0x07, 0x11, 0x08, 0x06, 0x00, 0x08, 0x61, 0x22, 0x09, 0x0b, 0x0f,
+    0x03, 0x0e, 0x04, 0x0d, 0x12, 0x0e, 0x18, 0x92, 0x05, 0x04, 0x1a, 0x06,
+    0x0f, 0x1b, 0x06, 0x03, 0x0a, 0x07, 0x19, 0x02, 0x03, 0x0a, 0x08, 0x07,
+    0x13, 0x05, 0x08, 0x0e, 0x07, 0x04, 0x0d, 0x06, 0x05, 0x0f, 0x05, 0x36,
+    0x05, 0x14, 0x03, 0x05, 0x23, 0x13, 0x05, 0x06, 0x06, 0x22, 0x07, 0x02,
+    0x06, 0x11, 0x07, 0x11, 0x09, 0x00, 0x0a, 0x02, 0xf0, 0x0f, 0x11, 0x1d,
+    0x02, 0x1a, 0x10, 0x09, 0x01, 0x07, 0x10, 0x06, 0x07, 0x01, 0x09, 0x10,
+    0x08, 0x0d, 0x02, 0x0c, 0x00, 0x0a, 0x11, 0x07, 0x08, 0x10, 0xd0, 0x0a,
+    0x0d, 0x31, 0x0a, 0x09, 0x0a, 0x0d, 0x02, 0x1a, 0x13, 0x1e, 0x14, 0x0a,
+    0x13, 0x09, 0x1b, 0x14, 0x11, 0x09, 0x07, 0x0c, 0x05, 0x32, 0x0a, 0x0f,
+    0x1c, 0x07, 0x0a, 0x0e, 0x17, 0x23, 0x0a, 0x0c, 0x0e, 0x0d, 0x08, 0x04,
+    0x0b, 0x0f, 0x05, 0x0a, 0x09, 0x84, 0x0c, 0x0c, 0x1d, 0x06, 0x05, 0x1c,
+    0x13, 0x19, 0x12, 0x08, 0x03, 0x07, 0x02, 0xa3, 0x18, 0x05, 0x03, 0x09,
+    0x08, 0x1a, 0x0d, 0x0c, 0x1b, 0x0f, 0x07, 0x0a, 0x08, 0x09, 0x03, 0x28,
+    0x22, 0x02, 0x11, 0x1a, 0x11, 0xc0, 0x0e, 0x20, 0x08, 0x06, 0x24, 0x01,
+    0x00, 0x01, 0x16, 0x02, 0x00, 0x27, 0x12, 0x03, 0x08, 0x01, 0x0a, 0x08,
+    0x01, 0x08, 0x13, 0x02, 0x17, 0x13, 0x0f, 0x09, 0x05, 0x02, 0x0a, 0x03,
+    0x51, 0x0b, 0x04, 0x09, 0x03, 0x28, 0x00, 0x03, 0x01, 0x0b, 0x20, 0x02,
+    0x19, 0x03, 0x22, 0x0c, 0x11, 0x0b, 0x0a, 0x02, 0x43, 0x08, 0x03, 0x09,
+    0x02, 0x38, 0x15, 0x04, 0x04, 0x08, 0x05, 0x07, 0x09, 0x06, 0x16, 0x0a,
+    0x07, 0x0f, 0x0a, 0x05, 0x18, 0x1d, 0x14, 0x0c, 0x0f, 0x43, 0x03, 0x1b,
+    0x04, 0x03, 0x07, 0x01, 0x06, 0x25, 0x08, 0x02, 0x0c, 0x21, 0x08, 0x0b,
+    0x07, 0x07, 0x0b, 0xf0, 0x05, 0x09, 0x03, 0x17, 0x02, 0x01, 0x08, 0x40,
+    0x0b, 0x0c, 0x0e, 0x09, 0x16, 0x02, 0x10, 0x08, 0x09, 0x01, 0x08, 0x00,
+    0x26, 0x01, 0x10, 0xa0, 0x07, 0x01, 0x04, 0x40, 0x03, 0x05, 0x04, 0x06,
+    0x08, 0x01, 0x07, 0x03, 0x09, 0x01, 0x0b, 0x03, 0x27, 0x81, 0x0b, 0x01,
+    0x03, 0x09, 0x04, 0x0b, 0x00, 0x1a, 0x01, 0x04, 0x1b, 0x02, 0x03, 0x08,
+    0x12, 0x06, 0x0a, 0x03, 0x08, 0x23, 0x07, 0x09, 0x05, 0x0d, 0x07, 0x09,
+    0x64, 0x0d, 0x0b, 0x09, 0x0c, 0x0f, 0x1e, 0x08, 0x09, 0x0d, 0x07, 0x0b,
+    0x03, 0x0a, 0x05, 0x05, 0x08, 0x06, 0x03, 0x09, 0x07, 0x07, 0x08, 0x08,
+    0x0a, 0x37, 0x39, 0x09, 0x0f, 0x08, 0x0a, 0x06, 0x0a, 0x06, 0x15, 0x1c,
+    0x0b, 0x08, 0x24, 0x1e, 0x03, 0x06, 0x0b, 0x03, 0x03, 0x0d, 0x12, 0x32,
+    0x0e, 0x0a, 0x01, 0x09, 0x12, 0x08, 0x41, 0x09, 0x03, 0x1a, 0x15, 0x19,
+    0x0c, 0x0f, 0xf0, 0x0e, 0x0a, 0x0d, 0x07, 0x0e, 0x05, 0x0d, 0x03, 0x0a,
+    0x11, 0x1e, 0x30, 0x0a, 0x0e, 0x09, 0x0e, 0x01, 0x0b, 0x00, 0x08, 0x01,
+    0x0c, 0x10, 0x0f, 0x1d, 0x22, 0x80, 0x0a, 0x19, 0x03, 0x02, 0x0a, 0x04,
+    0x0b, 0x02, 0x0a, 0x01, 0x0d, 0x03, 0x0f, 0x01, 0x01, 0x0c, 0x03, 0x02,
+    0x18, 0x05, 0x03, 0x07, 0x04, 0x17, 0x0f, 0x05, 0x0e, 0x16, 0x16, 0x0d,
+    0x09, 0x08, 0x05, 0x0a, 0x0d, 0xb4, 0x28, 0x0c, 0x0e, 0x1c, 0x34, 0x0e,
+    0x0b, 0x2d, 0x08, 0x0f, 0x09, 0x0a, 0x0e, 0x09, 0x0f, 0x0b, 0x23, 0x06,
+    0x0a, 0x0f, 0x19, 0x0a, 0x02, 0x03, 0x0b, 0x11, 0x06, 0x0a, 0x03, 0x0f,
+    0xf0, 0x12, 0x0e, 0x0c, 0x11, 0x09, 0x08, 0x00, 0x06, 0x01, 0x14, 0x40,
+    0x23, 0x01, 0x01, 0x50, 0x02, 0x00, 0x11, 0x80, 0x02, 0x11, 0x01, 0x23,
+    0x00, 0x11, 0x05, 0x02, 0x06, 0x03, 0x07, 0x04, 0x06, 0x91, 0x0d, 0x19,
+    0x06, 0x0a, 0x0a, 0x08, 0x1c, 0x05, 0x04, 0x0e, 0x05, 0x0d, 0x04, 0x1f,
+    0x06, 0x05, 0x0a, 0xf2, 0x0d, 0x0c, 0x0b, 0x1b, 0x07, 0x0f, 0x0e, 0x07,
+    0x0b, 0x0e, 0x0c, 0x0f, 0x0b, 0x08, 0x0a, 0x0f, 0x2b, 0x05, 0x04, 0x0d,
+    0x1a, 0x02, 0x06, 0x0c, 0x07, 0x0b, 0x03, 0x0a, 0x62, 0x04, 0x0c, 0x02,
+    0x0e, 0x11, 0x09, 0x07, 0x02, 0x06, 0x03, 0x07, 0x05, 0x0a, 0xf1, 0x07,
+    0x29, 0x06, 0x04, 0x03, 0x0a, 0x02, 0x0c, 0x04, 0x0a, 0x02, 0x09, 0x05,
+    0x08, 0x02, 0x07, 0x03, 0x08, 0x02, 0x1a, 0x01, 0x0a, 0x09, 0x03, 0x08,
+    0x07, 0x0a, 0x06, 0x0b, 0xf1, 0x12, 0x1c, 0x01, 0x0a, 0x02, 0x09, 0x03,
+    0x08, 0x02, 0x0b, 0x06, 0x0c, 0x13, 0x0e, 0x1b, 0x07, 0x14, 0x2e, 0x0f,
+    0x0b, 0x0d, 0x06, 0x0c, 0x09, 0x0b, 0xf1, 0x04, 0x0c, 0x02, 0x0f, 0x01,
+    0x0e, 0x02, 0x0d, 0x01, 0x0a, 0x32, 0x0d, 0x09, 0x1a, 0x21, 0x09, 0x0c,
+    0x08, 0x03, 0x0a, 0x02, 0x09, 0x44, 0x0d, 0x0e, 0xd1, 0x0b, 0x0c, 0x0b,
+    0x0d, 0x0a, 0x09, 0x09, 0x0f, 0x08, 0x0c, 0x07, 0x0a, 0x56, 0x05, 0x04,
+    0x0d, 0x04, 0x07, 0x06, 0x0c, 0xf0, 0x01, 0x0a, 0x02, 0x0b, 0x00, 0x0d,
+    0x01, 0x0a, 0x12, 0x08, 0x0b, 0x03, 0x0a, 0x42, 0x0b, 0x0d, 0x09, 0x08,
+    0x09, 0x06, 0x08, 0x22, 0x19, 0x18, 0x70, 0x11, 0x07, 0x20, 0x09, 0x0e,
+    0x1f, 0x31, 0x0b, 0x17, 0x81, 0x20, 0x09, 0x0a, 0x0b, 0x12, 0x19, 0x03,
+    0x0c, 0x04, 0x0d, 0x01, 0x09, 0x02, 0x04, 0x17, 0x13, 0x02, 0x03, 0x16,
+    0x04, 0x08, 0x25, 0x05, 0x07, 0x0a, 0x19, 0x08, 0x06, 0x0e, 0x0a, 0x17,
+    0x08, 0x0b, 0x0b, 0x0c, 0x08, 0x09, 0x1d, 0x09, 0x08, 0x1b, 0x0f, 0x0f,
+    0x1e, 0x1e, 0x1c, 0x0f, 0x0d, 0x0b, 0x09, 0x0c, 0x09, 0x08, 0x1d, 0x08,
+    0x0b, 0x07, 0x06, 0x0e, 0x16, 0x0e, 0x0b, 0x0b, 0x0d, 0x15, 0x0c, 0x0a,
+    0x09, 0x0d, 0x24, 0x07, 0x0c, 0x0d, 0x0b, 0x25, 0x0d, 0x13, 0x0a, 0x0b,
+    0x02, 0x02, 0x0f, 0x51, 0x03, 0x0d, 0x02, 0x0c, 0x00, 0x0e, 0x01, 0x0a,
+    0x10, 0x08, 0x0f, 0xf0, 0x01, 0x0a, 0x00, 0x0d, 0x31, 0x0b, 0x07, 0x06,
+    0x17, 0x40, 0x06, 0x05, 0x08, 0x0b, 0x01, 0x08, 0x12, 0x09, 0x0d, 0x13,
+    0x0a, 0x08, 0xf0, 0x04, 0x1a, 0x13, 0x0b, 0x05, 0x0c, 0x24, 0x0a, 0x0b,
+    0x0c, 0x06, 0x0a, 0x15, 0x09, 0x0b, 0x07, 0x0d, 0x03, 0x0c, 0x02, 0x0d,
+    0x23, 0x0e, 0x19, 0xf0, 0x09, 0x0a, 0x06, 0x0c, 0x07, 0x0d, 0x06, 0x0a,
+    0x14, 0x09, 0x1a, 0x02, 0x31, 0x09, 0x0a, 0x09, 0x08, 0x02, 0x17, 0x23,
+    0x09, 0x0a, 0x04, 0x2c, 0xf0, 0x03, 0x07, 0x05, 0x0d, 0x13, 0x1e, 0x02,
+    0x0a, 0x03, 0x09, 0x02, 0x07, 0x04, 0x09, 0x05, 0x1a, 0x02, 0x04, 0x08,
+    0x43, 0x09, 0x0b, 0x0c, 0x2a, 0xf0, 0x22, 0x0b, 0x0a, 0x13, 0x07, 0x08,
+    0x04, 0x09, 0x02, 0x0b, 0x04, 0x09, 0x06, 0x08, 0x03, 0x09, 0x05, 0x1b,
+    0x06, 0x07, 0x0c, 0x15, 0x0d, 0x1e, 0x40, 0x06, 0x03, 0x0f, 0x22, 0x0e,
+    0x0c, 0x08, 0x41, 0x11, 0x09, 0x0c, 0x03, 0x0b, 0x02, 0x0d, 0x04, 0x08,
+    0x12, 0x18, 0x0a, 0x08, 0x23, 0x0f, 0x0b, 0x0a, 0x0c, 0x0d, 0x09, 0x24,
+    0x0e, 0x0d, 0x18, 0x0e, 0x0b, 0x45, 0x07, 0x0d, 0x06, 0x0e, 0x0f, 0x0f,
+    0x06, 0x0d, 0x07, 0x0b, 0x86, 0x0d, 0x1a, 0x05, 0x0f, 0x0c, 0x04, 0x0d,
+    0x0f, 0x0e, 0x06, 0x1b, 0x03, 0x08, 0x0a, 0x03, 0x07, 0x37, 0x07, 0x06,
+    0x04, 0x25, 0x03, 0x02, 0x06, 0x41, 0x14, 0x37, 0x23, 0x06, 0x13, 0x02,
+    0x07, 0x01, 0x09, 0x04, 0xf0, 0x0c, 0x05, 0x19, 0x03, 0x22, 0x0a, 0x0c,
+    0x0b, 0x01, 0x0c, 0x03, 0x0e, 0x04, 0x0b, 0x03, 0x0c, 0x07, 0x0a, 0x16,
+    0x3b, 0x07, 0x0d, 0x04, 0x0c, 0x03, 0xf0, 0x0e, 0x02, 0x0c, 0x01, 0x09,
+    0x12, 0x07, 0x28, 0x04, 0x25, 0x0a, 0x09, 0x04, 0x0a, 0x03, 0x09, 0x06,
+    0x2a, 0x04, 0x17, 0x0c, 0x18, 0x0d, 0xf0, 0x0c, 0x04, 0x0b, 0x09, 0x1a,
+    0x05, 0x06, 0x0b, 0x05, 0x0c, 0x04, 0x0b, 0x07, 0x2a, 0x14, 0x23, 0x0b,
+    0x0a, 0x09, 0x05, 0x08, 0x02, 0x27, 0x01, 0x03, 0xf0, 0x00, 0x08, 0x01,
+    0x06, 0x00, 0x17, 0x01, 0x00, 0x1a, 0x11, 0x0b, 0x00, 0x08, 0x02, 0x19,
+    0x01, 0x12, 0x08, 0x09, 0x21, 0x1a, 0x09, 0x00, 0x11, 0x06, 0x01, 0x08,
+    0x10, 0xf2, 0x07, 0x19, 0x02, 0x23, 0x08, 0x09, 0x2b, 0x06, 0x03, 0x02,
+    0x1f, 0x0e, 0x1a, 0x0e, 0x2f, 0x0f, 0x0c, 0x06, 0x2e, 0x07, 0x09, 0xc2,
+    0x04, 0x1c, 0x06, 0x07, 0x0b, 0x04, 0x0c, 0x15, 0x0b, 0x2a, 0x04, 0x0a,
+    0x07, 0x0b, 0x09, 0x0d, 0x0b, 0x1e, 0x0a, 0x07, 0x13, 0x1a, 0x06, 0x08,
+    0x64, 0x28, 0x05, 0x03, 0x06, 0x39, 0x03, 0x04, 0x0f, 0x25, 0x13, 0x0a,
+    0x19, 0x02, 0x02, 0x01, 0x0d, 0x01, 0xf0, 0x0f, 0x13, 0x0d, 0x0a, 0x01,
+    0x1c, 0x02, 0x04, 0x0b, 0x02, 0x37, 0x01, 0x05, 0x02, 0x01, 0x09, 0x07,
+    0x0b, 0x03, 0x0c, 0x02, 0x1e, 0x07, 0x02, 0x1b, 0x01, 0xf0, 0x03, 0x0d,
+    0x02, 0x09, 0x01, 0x0b, 0x14, 0x09, 0x08, 0x03, 0x1a, 0x06, 0x08, 0x0b,
+    0x06, 0x39, 0x08, 0x0a, 0x04, 0x09, 0x1a, 0x07, 0x04, 0x0b, 0x0f, 0xf0,
+    0x0c, 0x04, 0x19, 0x06, 0x05, 0x0a, 0x03, 0x28, 0x05, 0x12, 0x06, 0x21,
+    0x07, 0x08, 0x07, 0x02, 0x09, 0x03, 0x0a, 0x04, 0x09, 0x16, 0x18, 0x04,
+    0xf0, 0x37, 0x05, 0x03, 0x01, 0x02, 0x26, 0x01, 0x10, 0x14, 0x02, 0x01,
+    0x06, 0x02, 0x17, 0x05, 0x13, 0x08, 0x09, 0x12, 0x18, 0x11, 0x60, 0x19,
+    0x03, 0x0b, 0x02, 0x0d, 0x03, 0x0c, 0x17, 0x1e, 0x04, 0x41, 0x08, 0x08,
+    0x09, 0x05, 0x0a, 0x04, 0x0b, 0x06, 0x0e, 0x05, 0x02, 0x1c, 0x04, 0x03,
+    0x06, 0x04, 0x0d, 0x0f, 0x55, 0x0b, 0x05, 0x0a, 0x08, 0x1c, 0x06, 0x12,
+    0x0b, 0x0c, 0x20, 0x06, 0x0b, 0x07, 0x09, 0x05, 0x2a, 0x11, 0x04, 0x05,
+    0x02, 0x16, 0x0c, 0x05, 0x0b, 0x04, 0x17, 0x0c, 0x0f, 0x0e, 0x14, 0x06,
+    0x1d, 0x05, 0x06, 0x04, 0x1e, 0x14, 0xa3, 0x1b, 0x06, 0x0a, 0x0a, 0x04,
+    0x29, 0x0f, 0x17, 0x1a, 0x0e, 0x06, 0x09, 0x0c, 0x08, 0x06, 0x12, 0x09,
+    0x03, 0x08, 0x05, 0x01, 0x0a, 0x02, 0xe0, 0x0e, 0x03, 0x2c, 0x08, 0x05,
+    0x17, 0x0b, 0x0a, 0x04, 0x0b, 0x13, 0x19, 0x01, 0x0b, 0x00, 0x0d, 0x01,
+    0x0a, 0x23, 0x09, 0x0a, 0x0c, 0x09, 0x41, 0x19, 0x07, 0x03, 0x0a, 0x04,
+    0x0b, 0x01, 0x0f, 0x02, 0x02, 0x0b, 0x01, 0x03, 0x09, 0x02, 0x14, 0x18,
+    0x08, 0x02, 0x05, 0x17, 0x08, 0x07, 0x0f, 0x1a, 0x06, 0x04, 0x15, 0x07,
+    0x0c, 0x0f, 0x0e, 0x24, 0x04, 0x09, 0x0f, 0x08, 0x0c, 0x0a, 0x03, 0x02,
+    0x0f, 0x22, 0x06, 0x0e, 0x14, 0x0a, 0x0c, 0x51, 0x05, 0x0a, 0x04, 0x28,
+    0x02, 0x00, 0x11, 0x09, 0x0b, 0xf0, 0x00, 0x08, 0x02, 0x09, 0x01, 0x07,
+    0x00, 0x05, 0x02, 0x04, 0x03, 0x03, 0x12, 0x04, 0x15, 0x03, 0x01, 0x04,
+    0x00, 0x03, 0x01, 0x01, 0x00, 0x70, 0x01, 0x10, 0x30, 0x02, 0x01, 0x05,
+    0x02, 0x11, 0x01, 0x01, 0x05, 0x80, 0x12, 0x02, 0x06, 0x03, 0x07, 0x04,
+    0x09, 0x06, 0x0f, 0x17, 0x03, 0x08, 0x09, 0x02, 0x0b, 0x00, 0x21, 0x09,
+    0x02, 0x2e, 0x01, 0x05, 0x02, 0x07, 0x03, 0x0d, 0x08, 0x04, 0x1e, 0x0f,
+    0x25, 0x02, 0x0c, 0x06, 0x1a, 0x02, 0x04, 0x00, 0x13, 0x09, 0x02, 0x07,
+    0x40, 0x02, 0x08, 0x03, 0x09, 0x04, 0x08, 0x03, 0x09, 0xb2, 0x0c, 0x02,
+    0x0b, 0x03, 0x1e, 0x01, 0x05, 0x0f, 0x04, 0x0e, 0x01, 0x1d, 0x03, 0x41,
+    0x1f, 0x0c, 0x0b, 0x53, 0x18, 0x00, 0x02, 0x2a, 0x00, 0x01, 0x03, 0x0c,
+    0x01, 0x05, 0x1a, 0x12, 0x07, 0x0a, 0x1b, 0x0a, 0x1d, 0x05, 0x1c, 0x06,
+    0x1f, 0x0f, 0x1d, 0x03, 0x0b, 0x06, 0x07, 0x0e, 0x02, 0x26, 0x0c, 0x13,
+    0x0b, 0x0a, 0x01, 0x05, 0x0c, 0x06, 0x04, 0x0d, 0x02, 0x13, 0x0f, 0x06,
+    0x0e, 0x04, 0x42, 0x1f, 0x02, 0x07, 0x0c, 0x11, 0x1b, 0x02, 0x13, 0x18,
+    0x00, 0x01, 0x12, 0x0a, 0x23, 0x0b, 0x03, 0x0a, 0x34, 0x09, 0x05, 0x0b,
+    0x09, 0x0c, 0x01, 0x0e, 0x06, 0x15, 0x0b, 0x05, 0x1a, 0x03, 0x26, 0x08,
+    0x1b, 0x05, 0x0f, 0x17, 0x09, 0x03, 0x08, 0x06, 0x06, 0x0a, 0x0c, 0x05,
+    0x09, 0x02, 0x14, 0x0a, 0x0f, 0x09, 0x15, 0x03, 0x08, 0x12, 0x0a, 0x0a,
+    0x09, 0x02, 0x11, 0x0d, 0x05, 0x0c, 0x04, 0xb0, 0x0f, 0x15, 0x1b, 0x08,
+    0x0a, 0x15, 0x08, 0x07, 0x07, 0x06, 0x04, 0x05, 0x13, 0x04, 0x03, 0x04,
+    0x12, 0x02, 0x07, 0x71, 0x71, 0x06, 0x14, 0x07, 0x02, 0x01, 0x03, 0x11,
+    0x02, 0xf0, 0x11, 0x23, 0xb0, 0x0a, 0x04, 0x0f, 0x0e, 0x06, 0x08, 0x04,
+    0x06, 0x07, 0x06, 0x0c, 0x11, 0x07, 0x90, 0x04, 0x12, 0x09, 0x06, 0x03,
+    0x08, 0x04, 0x0c, 0x05, 0x08, 0x06, 0x17, 0x08, 0x0a, 0x01, 0x0d, 0x08,
+    0x08, 0x11, 0x04, 0x2c, 0x03, 0x02, 0x0f, 0x13, 0x05, 0x1d, 0x0f, 0x04,
+    0x05, 0x0f, 0xf3, 0x08, 0x0e, 0x06, 0x0b, 0x03, 0x19, 0x04, 0x06, 0x07,
+    0x03, 0x06, 0x12, 0x15, 0x01, 0x14, 0x10, 0x06, 0x01, 0x07, 0x00, 0x08,
+    0x01, 0x0c, 0x02, 0x0a, 0x01, 0x08, 0x33, 0x00, 0x0a, 0x03, 0x0c, 0x02,
+    0x0d, 0x01, 0x0c, 0x64, 0x05, 0x1e, 0x07, 0x06, 0x1b, 0x0f, 0x0b, 0x08,
+    0x06, 0x09, 0x0f, 0x0d, 0xf3, 0x05, 0x0c, 0x18, 0x0d, 0x0c, 0x06, 0x0d,
+    0x04, 0x1e, 0x01, 0x02, 0x0b, 0x11, 0x0e, 0x1d, 0x04, 0x05, 0x0a, 0x13,
+    0x0c, 0x0d, 0x05, 0x0b, 0x03, 0x09, 0x04, 0x0a, 0x73, 0x0e, 0x2d, 0x05,
+    0x0f, 0x0e, 0x0b, 0x03, 0x0a, 0x04, 0x0c, 0x11, 0x0b, 0x09, 0x34, 0x02,
+    0x08, 0x03, 0x09, 0x04, 0x0d, 0x07, 0x1a, 0x35, 0x0d, 0x06, 0x0b, 0x0f,
+    0x1d, 0x07, 0x14, 0x04, 0x09, 0x05, 0x0c, 0x03, 0x03, 0x0f, 0x32, 0x01,
+    0x1a, 0x02, 0x01, 0x07, 0x00, 0x0e, 0x71, 0x11, 0x07, 0x15, 0x30, 0x06,
+    0x05, 0x04, 0x02, 0x43, 0x00, 0xf0, 0x02, 0x04, 0x00, 0x11, 0x05, 0x04,
+    0x00, 0x05, 0x11, 0x04, 0x05, 0x02, 0x13, 0x00, 0x01, 0x04, 0x20, 0x05,
+    0x04, 0x17, 0x02, 0x11, 0x0a, 0x80, 0x08, 0x06, 0x09, 0x02, 0x08, 0x11,
+    0x07, 0x0a, 0x10, 0x0f, 0x0c, 0x01, 0x0a, 0x05, 0x07, 0xf1, 0x04, 0x08,
+    0x03, 0x0a, 0x0f, 0x0d, 0x03, 0x0a, 0x05, 0x0c, 0x0a, 0x09, 0x01, 0x08,
+    0x02, 0x1a, 0x01, 0x00, 0x0d, 0x01, 0x08, 0x02, 0x09, 0x01, 0x0d, 0x03,
+    0x0b, 0x06, 0x0a, 0x02, 0x09, 0xf1, 0x03, 0x0d, 0x04, 0x0e, 0x11, 0x0b,
+    0x0f, 0x04, 0x0d, 0x01, 0x1c, 0x03, 0x05, 0x09, 0x03, 0x08, 0x14, 0x09,
+    0x0b, 0x15, 0x0c, 0x0b, 0x06, 0x1a, 0x04, 0x05, 0x0c, 0x11, 0x03, 0x0e,
+    0x04, 0x09, 0x12, 0x05, 0x0a, 0x04, 0x09, 0x23, 0x0e, 0x0b, 0x05, 0x0c,
+    0x0b, 0x08, 0x44, 0x15, 0x09, 0x0b, 0x06, 0x1e, 0x01, 0x03, 0x19, 0x15,
+    0x05, 0x14, 0x08, 0x36, 0x0a, 0x1f, 0x1d, 0x04, 0x1c, 0x07, 0x0d, 0x28,
+    0x08, 0x0a, 0x03, 0x08, 0x04, 0x07, 0x09, 0x05, 0x15, 0x0b, 0x03, 0x0a,
+    0x01, 0x14, 0x1c, 0x07, 0x03, 0x23, 0x0e, 0x01, 0x0d, 0x07, 0x1c, 0x02,
+    0x52, 0x01, 0x0a, 0x06, 0x19, 0x02, 0x01, 0x1a, 0x14, 0x81, 0x0e, 0x06,
+    0x1c, 0x02, 0x03, 0x0f, 0x04, 0x0e, 0x03, 0x0d, 0x05, 0x0a, 0x06, 0x0c,
+    0x0c, 0x0a, 0x03, 0xf0, 0x0e, 0x05, 0x1b, 0x13, 0x0a, 0x06, 0x19, 0x05,
+    0x0c, 0x0a, 0x05, 0x0b, 0x07, 0x0a, 0x14, 0x0b, 0x09, 0x06, 0x48, 0x03,
+    0x14, 0x03, 0x02, 0xf0, 0x09, 0x03, 0x0c, 0x11, 0x1b, 0x02, 0x19, 0x01,
+    0x02, 0x38, 0x11, 0x00, 0x11, 0x16, 0x00, 0x25, 0x03, 0x02, 0x00, 0x16,
+    0x03, 0xf0, 0x01, 0x07, 0x00, 0x0a, 0x06, 0x09, 0x12, 0x08, 0x0b, 0x05,
+    0x29, 0x03, 0x04, 0x01, 0x28, 0x14, 0x02, 0x09, 0x08, 0x1c, 0x04, 0x13,
+    0x0a, 0xf0, 0x09, 0x12, 0x18, 0x01, 0x09, 0x03, 0x18, 0x07, 0x04, 0x2a,
+    0x0b, 0x02, 0x04, 0x09, 0x07, 0x08, 0x02, 0x07, 0x09, 0x09, 0x05, 0x1a,
+    0x03, 0x06, 0x0e, 0x04, 0x30, 0x0c, 0x02, 0x0d, 0x0b, 0x1e, 0x0d, 0x05,
+    0x51, 0x0a, 0x0d, 0x1c, 0x05, 0x02, 0x0b, 0x15, 0x1e, 0x03, 0x02, 0x0d,
+    0x09, 0x23, 0x0c, 0x0f, 0x0d, 0x08, 0x0e, 0x06, 0x84, 0x0d, 0x0b, 0x1c,
+    0x06, 0x09, 0x0d, 0x0f, 0x0e, 0x07, 0x0b, 0x0c, 0x0a, 0x06, 0x19, 0x02,
+    0x06, 0x13, 0x0c, 0x03, 0x1a, 0x02, 0x14, 0x0f, 0x0b, 0x05, 0x63, 0x1d,
+    0x04, 0x16, 0x1c, 0x03, 0x2b, 0x02, 0x06, 0x14, 0x22, 0x0c, 0x09, 0x0f,
+    0x08, 0x07, 0x01, 0x09, 0x05, 0xf0, 0x1c, 0x08, 0x05, 0x0b, 0x03, 0x0d,
+    0x04, 0x2a, 0x08, 0x04, 0x02, 0x1b, 0x04, 0x03, 0x3a, 0x02, 0x03, 0x05,
+    0x11, 0x1f, 0x02, 0x0b, 0x10, 0xf0, 0x09, 0x07, 0x01, 0x18, 0x02, 0x00,
+    0x0b, 0x13, 0x0d, 0x0c, 0x01, 0x0b, 0x00, 0x0e, 0x11, 0x0f, 0x1b, 0x00,
+    0x08, 0x0c, 0x12, 0x0a, 0x09, 0x05, 0x18, 0x03, 0xa0, 0x02, 0x07, 0x05,
+    0x29, 0x07, 0x04, 0x08, 0x0b, 0x06, 0x09, 0x13, 0x1a, 0x04, 0x0e, 0x03,
+    0x0f, 0x02, 0xf1, 0x2c, 0x08, 0x06, 0x04, 0x2e, 0x0b, 0x02, 0x06, 0x1c,
+    0x04, 0x02, 0x1d, 0x0e, 0x02, 0x0c, 0x04, 0x0a, 0x06, 0x09, 0x02, 0x07,
+    0x04, 0x08, 0x02, 0x09, 0x00, 0x41, 0x1c, 0x01, 0x02, 0x0d, 0x01, 0x0c,
+    0x00, 0x0f, 0x01, 0x82, 0x09, 0x02, 0x08, 0x03, 0x29, 0x04, 0x09, 0x0f,
+    0x0a, 0x03, 0x0b, 0x12, 0x0a, 0x09, 0x00, 0x51, 0x0b, 0x01, 0x18, 0x02,
+    0x00, 0x09, 0x01, 0x0c, 0x00, 0x0d, 0x01, 0x20, 0x2f, 0x10, 0x11, 0x01,
+    0x0a, 0xb2, 0x18, 0x12, 0x19, 0x08, 0x04, 0x0a, 0x08, 0x0c, 0x0e, 0x2b,
+    0x05, 0x07, 0x15, 0x0a, 0x0b, 0x03, 0x0a, 0x02, 0xb3, 0x28, 0x08, 0x12,
+    0x0a, 0x04, 0x29, 0x01, 0x03, 0x02, 0x1c, 0x01, 0x02, 0x2e, 0x10, 0x01,
+    0x02, 0x0f, 0x00, 0x43, 0x0c, 0x03, 0x2b, 0x02, 0x0e, 0x06, 0x1c, 0x07,
+    0x54, 0x0f, 0x0d, 0x03, 0x0b, 0x06, 0x0a, 0x03, 0x0b, 0x02, 0x0c, 0x00,
+    0x05, 0x2b, 0x01, 0x16, 0x10, 0x15, 0x0c, 0x11, 0x0a, 0x04, 0x19, 0x10,
+    0x13, 0x2a, 0x01, 0x72, 0x00, 0x03, 0x0c, 0x04, 0x0e, 0x06, 0x1b, 0x0e,
+    0x07, 0x09, 0x0b, 0x0a, 0x0f, 0x31, 0x1d, 0x03, 0x06, 0x0b, 0x04, 0x09,
+    0x22, 0xa0, 0x0c, 0x0a, 0x09, 0x00, 0x18, 0x11, 0x15, 0x10, 0x08, 0x01,
+    0x0b, 0x03, 0x0a, 0x02, 0x0c, 0x1f, 0x11, 0x09, 0x17, 0x04, 0xf0, 0x0f,
+    0x06, 0x07, 0x14, 0x00, 0x03, 0x05, 0x02, 0x07, 0x00, 0x18, 0x03, 0x05,
+    0x09, 0x04, 0x08, 0x03, 0x09, 0x07, 0x2a, 0x03, 0x01, 0x05, 0x0d, 0x14,
+    0x0a, 0x20, 0x0b, 0x19, 0x1c, 0x06, 0x21, 0x09, 0x05, 0x0a, 0x04, 0x0c,
+    0x03, 0x22, 0x2e, 0x0f, 0x15, 0x13, 0x0a, 0x0f, 0x0c, 0x03, 0x12, 0x0e,
+    0x14, 0x0a, 0x61, 0x0d, 0x06, 0x0c, 0x02, 0x0e, 0x04, 0x3b, 0x0a, 0x02,
+    0x0f, 0x09, 0xf0, 0x1f, 0x03, 0x04, 0x0d, 0x02, 0x0b, 0x01, 0x0c, 0x03,
+    0x0a, 0x00, 0x0b, 0x04, 0x0f, 0x05, 0x0d, 0x01, 0x1f, 0x04, 0x02, 0x0b,
+    0x11, 0x19, 0x02, 0x07, 0x01, 0x18, 0x02, 0x00, 0x03, 0x51, 0x07, 0x05,
+    0x08, 0x00, 0x07, 0x03, 0x09, 0x04, 0x0b, 0x01, 0x0c, 0x03, 0x72, 0x0e,
+    0x0c, 0x0d, 0x01, 0x0c, 0x06, 0x0e, 0x05, 0x0d, 0x00, 0x0c, 0x04, 0x0b,
+    0x12, 0x1c, 0x73, 0x03, 0x1f, 0x0f, 0x06, 0x1e, 0x14, 0x0f, 0x03, 0x0e,
+    0x00, 0x2c, 0x11, 0x24, 0x00, 0x0a, 0x02, 0x53, 0x0e, 0x01, 0x1b, 0x12,
+    0x2a, 0x10, 0x01, 0x02, 0x0b, 0x00, 0x51, 0x1e, 0x01, 0x24, 0x1a, 0x1b,
+    0x25, 0xf0, 0x0f, 0x1e, 0x16, 0x0d, 0x03, 0x0a, 0x02, 0x0b, 0x03, 0x0c,
+    0x00, 0x0e, 0x01, 0x0f, 0x02, 0x0e, 0x11, 0x0c, 0x0f, 0x12, 0x0d, 0x0e,
+    0x03, 0x0b, 0x04, 0x3a, 0x08, 0x60, 0x06, 0x05, 0x0a, 0x0b, 0x03, 0x0d,
+    0x04, 0x0e, 0x03, 0x0f, 0x0f, 0xf1, 0x1b, 0x04, 0x08, 0x0a, 0x0f, 0x08,
+    0x12, 0x07, 0x08, 0x11, 0x07, 0x16, 0x00, 0x03, 0x07, 0x11, 0x19, 0x05,
+    0x1c, 0x04, 0x02, 0x1b, 0x08, 0x05, 0x21, 0x0a, 0x09, 0x1b, 0x0a, 0x0b,
+    0x72, 0x18, 0x0f, 0x04, 0x09, 0x0e, 0x0a, 0x04, 0x09, 0x19, 0x1c, 0x03,
+    0x0d, 0x0a, 0x63, 0x0a, 0x09, 0x19, 0x02, 0x05, 0x2a, 0x04, 0x02, 0x03,
+    0x0c, 0x08, 0x14, 0x0b, 0x03, 0x0a, 0x01, 0x15, 0x0b, 0x0f, 0x0a, 0x12,
+    0x03, 0x0c, 0x42, 0x0e, 0x09, 0x0d, 0x03, 0x0a, 0x01, 0x09, 0x04, 0x18,
+    0x13, 0x61, 0x07, 0x06, 0x06, 0x08, 0x05, 0x0f, 0x04, 0x02, 0x03, 0x06,
+    0x12, 0x03, 0x00, 0x00, 0x11, 0xf1, 0x03, 0x02, 0x02, 0x11, 0x04, 0x06,
+    0x04, 0x08, 0x11, 0x19, 0x03, 0x08, 0x21, 0x09, 0x0d, 0x0b, 0x04, 0x0a,
+    0x03, 0x1d, 0x02, 0x23, 0x0c, 0x0e, 0xf1, 0x0a, 0x02, 0x0b, 0x09, 0x0a,
+    0x02, 0x09, 0x03, 0x0c, 0x08, 0x0e, 0x12, 0x0b, 0x0d, 0x14, 0x0e, 0x0a,
+    0x13, 0x1b, 0x06, 0x0c, 0x07, 0x09, 0x13, 0x08, 0x0b, 0xd1, 0x01, 0x0c,
+    0x02, 0x0b, 0x01, 0x0e, 0x04, 0x0b, 0x08, 0x19, 0x03, 0x16, 0x1d, 0x14,
+    0x0c, 0x1b, 0x08, 0x06, 0x0a, 0x04, 0x0c, 0x05, 0x07, 0x72, 0x08, 0x08,
+    0x0e, 0x19, 0x03, 0x06, 0x0c, 0x0f, 0x0a, 0x02, 0x19, 0x05, 0x08, 0x0b,
+    0xb1, 0x01, 0x09, 0x02, 0x0c, 0x03, 0x1a, 0x00, 0x01, 0x09, 0x02, 0x08,
+    0x05, 0x05, 0x03, 0x13, 0x05, 0x09, 0x02, 0x00, 0x01, 0x03, 0x00, 0x02,
+    0x01, 0x01, 0xf1, 0x00, 0x00, 0x02, 0x01, 0x05, 0x12, 0x18, 0x03, 0x0f,
+    0x14, 0x08, 0x0a, 0x15, 0x13, 0x16, 0x22, 0x18, 0x00, 0x1c, 0x07, 0x12,
+    0x0a, 0x81, 0x1e, 0x0f, 0x13, 0x0a, 0x0b, 0x05, 0x09, 0x21, 0x08, 0x0b,
+    0x0f, 0x02, 0x08, 0xc2, 0x05, 0x19, 0x03, 0x08, 0x0b, 0x03, 0x0a, 0x02,
+    0x1c, 0x09, 0x15, 0x0a, 0x0c, 0x0a, 0x1d, 0x06, 0x05, 0x0e, 0x03, 0x0f,
+    0x05, 0x09, 0x23, 0x0f, 0x1b, 0x04, 0x0b, 0x06, 0x14, 0x08, 0x05, 0x05,
+    0x33, 0x35, 0x03, 0x21, 0x12, 0x06, 0x00, 0x07, 0x05, 0x51, 0x0a, 0x03,
+    0x09, 0x04, 0x0a, 0x0e, 0x1b, 0x02, 0x03, 0x0c, 0x20, 0x70, 0x0f, 0x1d,
+    0x11, 0x0a, 0x08, 0x03, 0x09, 0x0a, 0x0a, 0x03, 0x0e, 0x0e, 0x21, 0x1b,
+    0x0f, 0x06, 0x0c, 0x0f, 0x02, 0x09, 0x05, 0xf1, 0x0e, 0x02, 0x3f, 0x04,
+    0x03, 0x16, 0x3e, 0x0b, 0x0e, 0x03, 0x08, 0x1c, 0x06, 0x02, 0x0a, 0x05,
+    0x19, 0x04, 0x13, 0x0b, 0x0d, 0x01, 0xe1, 0x0e, 0x03, 0x0a, 0x01, 0x09,
+    0x04, 0x18, 0x03, 0x04, 0x27, 0x0a, 0x01, 0x06, 0x09, 0x13, 0x2b, 0x0f,
+    0x07, 0x0a, 0x03, 0x19, 0x09, 0x07, 0xf0, 0x1b, 0x02, 0x04, 0x0d, 0x02,
+    0x0e, 0x03, 0x6a, 0x02, 0x04, 0x03, 0x04, 0x08, 0x02, 0x18, 0x0b, 0x0a,
+    0x03, 0x2b, 0x06, 0x14, 0xf0, 0x0d, 0x32, 0x0f, 0x1c, 0x0a, 0x23, 0x08,
+    0x27, 0x04, 0x13, 0x18, 0x02, 0x09, 0x03, 0x1a, 0x05, 0x01, 0x0c, 0x07,
+    0x0b, 0x03, 0x00, 0x0a, 0x00, 0x71, 0x27, 0x05, 0x02, 0x08, 0x08, 0x0b,
+    0x09, 0x06, 0x0b, 0x0f, 0x0d, 0x02, 0x0b, 0x14, 0x22, 0x08, 0x0a, 0x02,
+    0x0d, 0x06, 0x63, 0x0a, 0x08, 0x19, 0x05, 0x0a, 0x0a, 0x06, 0x1b, 0x07,
+    0x04, 0x0c, 0x07, 0x14, 0x0d, 0x06, 0x0e, 0x00, 0x25, 0x0b, 0x0d, 0x0c,
+    0x04, 0x0a, 0x01, 0x04, 0x0c, 0x04, 0x13, 0x0d, 0x03, 0x1a, 0x11, 0x02,
+    0x31, 0x0c, 0x02, 0x08, 0x01, 0x19, 0x14, 0xf0, 0x3e, 0x07, 0x0e, 0x04,
+    0x07, 0x0d, 0x03, 0x0a, 0x02, 0x0c, 0x03, 0x0e, 0x02, 0x0a, 0x04, 0x1b,
+    0x03, 0x22, 0x0e, 0x0b, 0x0a, 0x01, 0x0c, 0x00, 0x19, 0x02, 0xa0, 0x01,
+    0x08, 0x00, 0x09, 0x02, 0x07, 0x01, 0x05, 0x00, 0x07, 0x11, 0x09, 0x08,
+    0x00, 0x0c, 0x05, 0x1e, 0x07, 0x06, 0x01, 0x09, 0x0f, 0x82, 0x08, 0x17,
+    0x17, 0x02, 0x18, 0x03, 0x0c, 0x09, 0x03, 0x1a, 0x06, 0x0f, 0x09, 0x08,
+    0xf1, 0x1b, 0x09, 0x04, 0x09, 0x06, 0x0a, 0x0a, 0x39, 0x03, 0x0c, 0x06,
+    0x04, 0x08, 0x05, 0x17, 0x01, 0x02, 0x28, 0x30, 0x07, 0x06, 0x02, 0xf0,
+    0x19, 0x03, 0x02, 0x1b, 0x01, 0x02, 0x0a, 0x01, 0x09, 0x13, 0x07, 0x18,
+    0x06, 0x0c, 0x09, 0x08, 0x0b, 0x1f, 0x0c, 0x0e, 0x06, 0x0c, 0x0b, 0x0b,
+    0x05, 0x0a, 0x03, 0x70, 0x1b, 0x05, 0x04, 0x09, 0x05, 0x08, 0x04, 0x09,
+    0x06, 0x0b, 0x12, 0x0e, 0x0f, 0x10, 0xf1, 0x18, 0x11, 0x0a, 0x09, 0x14,
+    0x0a, 0x0b, 0x06, 0x2a, 0x04, 0x22, 0x08, 0x07, 0x04, 0x19, 0x06, 0x05,
+    0x0b, 0x0f, 0x0c, 0x04, 0x0d, 0x03, 0x51, 0x1b, 0x06, 0x03, 0x0d, 0x15,
+    0x0b, 0x0e, 0x0d, 0x0f, 0x0f, 0x32, 0x0a, 0x05, 0x0b, 0x0e, 0x0d, 0x07,
+    0x0c, 0x15, 0x63, 0x19, 0x02, 0x18, 0x06, 0x05, 0x09, 0x0c, 0x0a, 0x07,
+    0x1b, 0x05, 0x04, 0x0f, 0x05, 0x1a, 0x03, 0x34, 0x02, 0x0c, 0x03, 0x0d,
+    0x02, 0x0c, 0x13, 0x43, 0x0d, 0x0b, 0x04, 0x09, 0x03, 0x18, 0x01, 0x02,
+    0x42, 0x09, 0x03, 0x08, 0x14, 0x09, 0x18, 0x0c, 0x07, 0x11, 0x0b, 0x03,
+    0x0d, 0x05, 0xf0, 0x1f, 0x01, 0x12, 0x0d, 0x0c, 0x03, 0x0b, 0x04, 0x0a,
+    0x03, 0x0b, 0x05, 0x19, 0x03, 0x02, 0x0a, 0x04, 0x0b, 0x03, 0x0a, 0x02,
+    0x4e, 0x03, 0x02, 0x04, 0x13, 0x70, 0x1f, 0x07, 0x05, 0x1e, 0x08, 0x0f,
+    0x2d, 0x07, 0x06, 0x09, 0x11, 0x09, 0x04, 0x0a, 0x09, 0x12, 0x09, 0x0f,
+    0x0a, 0x05, 0x21, 0x1c, 0x0e, 0x07, 0x0b, 0x08, 0xf0, 0x0f, 0x05, 0x0d,
+    0x06, 0x1b, 0x0c, 0x03, 0x1a, 0x04, 0x03, 0x0d, 0x01, 0x0c, 0x13, 0x0a,
+    0x0b, 0x02, 0x09, 0x03, 0x0c, 0x04, 0x0a, 0x02, 0x09, 0x01, 0x0a, 0x30,
+    0x09, 0xf0, 0x0b, 0x08, 0x06, 0x01, 0x07, 0x60, 0x0a, 0x08, 0x26, 0x07,
+    0x08, 0x21, 0x07, 0x06, 0x18, 0x03, 0x02, 0x29, 0x04, 0xa0, 0x06, 0x09,
+    0x0a, 0x06, 0x2b, 0x23, 0x0a, 0x02, 0x0e, 0x05, 0x0b, 0x07, 0x0c, 0x15,
+    0x0e, 0x31, 0x09, 0x03, 0x08, 0x31, 0x09, 0x0d, 0x12, 0x09, 0x0d, 0x02,
+    0x13, 0x19, 0x03, 0x04, 0x14, 0x08, 0x01, 0x09, 0x02, 0x05, 0x08, 0x03,
+    0x06, 0x06, 0x01, 0x17, 0x85, 0x02, 0x03, 0x29, 0x0b, 0x08, 0x1f, 0x0c,
+    0x0d, 0x08, 0x0b, 0x07, 0x0a, 0x09, 0x2e, 0x34, 0x06, 0x07, 0x06, 0x1c,
+    0x02, 0x23, 0x31, 0x19, 0x0e, 0xf2, 0x0a, 0x04, 0x19, 0x13, 0x08, 0x21,
+    0x26, 0x00, 0x07, 0x02, 0x09, 0x01, 0x08, 0x12, 0x17, 0x01, 0x09, 0x02,
+    0x08, 0x13, 0x09, 0x0c, 0xf2, 0x06, 0x0e, 0x0f, 0x2c, 0x07, 0x04, 0x02,
+    0x0e, 0x11, 0x0c, 0x0a, 0x02, 0x19, 0x03, 0x14, 0x18, 0x03, 0x19, 0x21,
+    0x0a, 0x09, 0x02, 0x0c, 0x42, 0x06, 0x0e, 0x17, 0x0b, 0x0a, 0x0f, 0x09,
+    0x09, 0x0e, 0x81, 0x04, 0x0b, 0x05, 0x1a, 0x04, 0x06, 0x18, 0x17, 0x07,
+    0x04, 0x06, 0x03, 0x05, 0x04, 0x0a, 0xf0, 0x12, 0x0c, 0x0f, 0x07, 0x0c,
+    0x08, 0x1d, 0x09, 0x17, 0x0c, 0x2a, 0x02, 0x01, 0x30, 0x0f, 0x0c, 0x0a,
+    0x0e, 0x04, 0x0a, 0x01, 0x07, 0x02, 0x09, 0xa0, 0x03, 0x0a, 0x01, 0x09,
+    0x10, 0x0b, 0x08, 0x01, 0x09, 0x00, 0x0e, 0x02, 0x19, 0x03, 0x24, 0x0c,
+    0x0b, 0x27, 0xf1, 0x0b, 0x05, 0x07, 0x09, 0x0f, 0x0a, 0x07, 0x09, 0x19,
+    0x2a, 0x05, 0x04, 0x09, 0x03, 0x08, 0x14, 0x0a, 0x0b, 0x03, 0x1e, 0x15,
+    0x0c, 0x03, 0x2b, 0xf1, 0x04, 0x05, 0x14, 0x09, 0x0a, 0x06, 0x0c, 0x05,
+    0x0a, 0x06, 0x0d, 0x0c, 0x0e, 0x0f, 0x0f, 0x0d, 0x0e, 0x05, 0x1b, 0x04,
+    0x02, 0x0c, 0x01, 0x0b, 0x02, 0x0a, 0x03, 0x2c, 0xb1, 0x02, 0x13, 0x09,
+    0x02, 0x0a, 0x01, 0x0d, 0x02, 0x0e, 0x14, 0x0b, 0x09, 0x07, 0x0c, 0x06,
+    0x0e, 0x05, 0x0d, 0x16, 0x08, 0x82, 0x19, 0x04, 0x07, 0x1a, 0x0a, 0x08,
+    0x0d, 0x1f, 0x0f, 0x0c, 0x0c, 0x09, 0x0b, 0x0d, 0x11, 0x05, 0x09, 0x06,
+    0x0e, 0xf0, 0x03, 0x1a, 0x02, 0x03, 0x0b, 0x04, 0x0a, 0x06, 0x1b, 0x07,
+    0x0f, 0x3a, 0x09, 0x07, 0x05, 0x14, 0x09, 0x08, 0x05, 0x29, 0x09, 0x04,
+    0x07, 0x1b, 0xf0, 0x08, 0x05, 0x0a, 0x07, 0x09, 0x04, 0x1a, 0x05, 0x04,
+    0x09, 0x02, 0x0d, 0x04, 0x1c, 0x03, 0x02, 0x0b, 0x03, 0x0d, 0x11, 0x0f,
+    0x0e, 0x03, 0x0b, 0x15, 0x0a, 0x0c, 0xf0, 0x03, 0x0b, 0x05, 0x09, 0x03,
+    0x08, 0x01, 0x0c, 0x12, 0x0f, 0x0b, 0x03, 0x0d, 0x05, 0x1e, 0x08, 0x07,
+    0x0b, 0x04, 0x0a, 0x06, 0x0b, 0x03, 0x0a, 0x12, 0x0c, 0x08, 0x01, 0x0a,
+    0xf0, 0x10, 0x09, 0x08, 0x01, 0x04, 0x00, 0x13, 0x12, 0x04, 0x11, 0x06,
+    0x09, 0x04, 0x0e, 0x12, 0x0d, 0x0b, 0x05, 0x0a, 0x31, 0x0e, 0x0c, 0x0f,
+    0x0d, 0xf0, 0x02, 0x0a, 0x03, 0x0c, 0x07, 0x0b, 0x06, 0x0c, 0x19, 0x0a,
+    0x09, 0x06, 0x08, 0x15, 0x19, 0x06, 0x18, 0x05, 0x0c, 0x09, 0x06, 0x1a,
+    0x17, 0x0d, 0x1f, 0x0e, 0xf0, 0x0d, 0x08, 0x2e, 0x0f, 0x08, 0x16, 0x0d,
+    0x0b, 0x08, 0x0c, 0x1f, 0x0d, 0x0e, 0x05, 0x0a, 0x0c, 0x09, 0x06, 0x18,
+    0x03, 0x04, 0x0a, 0x13, 0x0b, 0x1a, 0x60, 0x14, 0x0b, 0x03, 0x0c, 0x06,
+    0x0d, 0x05, 0x1e, 0x0a, 0x09, 0x08, 0x61, 0x07, 0x0a, 0x0f, 0x0c, 0x19,
+    0x2b, 0x0d, 0x07, 0x0c, 0x09, 0x07, 0x72, 0x0d, 0x08, 0x0f, 0x0a, 0x08,
+    0x0c, 0x04, 0x0e, 0x09, 0x1c, 0x04, 0x03, 0x0f, 0x07, 0x0b, 0x63, 0x06,
+    0x0c, 0x03, 0x0e, 0x05, 0x0c, 0x02, 0x2e, 0x01, 0x03, 0x02, 0x0b, 0xa4,
+    0x06, 0x2e, 0x09, 0x0f, 0x08, 0x0c, 0x07, 0x0b, 0x06, 0x0c, 0x03, 0x0a,
+    0x16, 0x0d, 0x0f, 0x0f, 0x1e, 0x06, 0x13, 0x09, 0x0a, 0x07, 0x0c, 0x22,
+    0x01, 0x0a, 0x03, 0x09, 0x02, 0x0c, 0x21, 0x03, 0x09, 0x0b, 0x07, 0x16,
+    0x1d, 0xf0, 0x09, 0x0e, 0x03, 0x0d, 0x04, 0x1c, 0x07, 0x05, 0x0b, 0x06,
+    0x1a, 0x05, 0x04, 0x0d, 0x03, 0x0b, 0x02, 0x0e, 0x05, 0x0a, 0x04, 0x09,
+    0x0d, 0x08, 0x0b, 0x17, 0x16, 0xf0, 0x08, 0x02, 0x07, 0x01, 0x08, 0x00,
+    0x0a, 0x02, 0x29, 0x01, 0x02, 0x01, 0x0c, 0x00, 0x0a, 0x01, 0x07, 0x00,
+    0x35, 0x01, 0x00, 0x12, 0x14, 0x00, 0xf0, 0x01, 0x45, 0x10, 0x01, 0x12,
+    0x08, 0x11, 0x09, 0x0a, 0x02, 0x07, 0x10, 0x08, 0x17, 0x11, 0x19, 0x04,
+    0x06, 0x0a, 0x0a, 0x0b, 0x40, 0x07, 0x0c, 0x06, 0x1e, 0x0e, 0x16, 0x0d,
+    0x08, 0xf1, 0x0b, 0x19, 0x05, 0x03, 0x0a, 0x05, 0x0b, 0x13, 0x0c, 0x0d,
+    0x0f, 0x0e, 0x0a, 0x0c, 0x08, 0x0b, 0x1e, 0x0d, 0x0b, 0x06, 0x1a, 0x04,
+    0x0d, 0x09, 0x04, 0x08, 0x03, 0x0a, 0xc1, 0x04, 0x09, 0x02, 0x0b, 0x13,
+    0x09, 0x0a, 0x12, 0x0b, 0x0d, 0x06, 0x0b, 0x15, 0x1a, 0x07, 0x1d, 0x05,
+    0x03, 0x0a, 0x02, 0x05, 0xa2, 0x01, 0x04, 0x30, 0x05, 0x08, 0x07, 0x1b,
+    0x11, 0x0e, 0x10, 0x0b, 0x08, 0x01, 0x0b, 0x00, 0x08, 0xe3, 0x01, 0x09,
+    0x04, 0x0c, 0x05, 0x19, 0x04, 0x0a, 0x0a, 0x06, 0x09, 0x04, 0x08, 0x05,
+    0x2a, 0x06, 0x09, 0x0d, 0x0c, 0x0f, 0x0a, 0x05, 0x09, 0x0d, 0x08, 0x0a,
+    0x0b, 0x52, 0x06, 0x1a, 0x0b, 0x08, 0x09, 0x0a, 0x08, 0x0d, 0x07, 0x04,
+    0x0e, 0xf1, 0x07, 0x0d, 0x06, 0x0b, 0x14, 0x08, 0x29, 0x06, 0x05, 0x04,
+    0x08, 0x05, 0x09, 0x14, 0x28, 0x13, 0x09, 0x32, 0x0b, 0x0a, 0x0b, 0x19,
+    0x51, 0x00, 0x11, 0x0c, 0x09, 0x00, 0x0b, 0x02, 0x09, 0x00, 0x0f, 0xf0,
+    0x02, 0x0c, 0x03, 0x29, 0x02, 0x04, 0x03, 0x0a, 0x06, 0x0c, 0x05, 0x49,
+    0x02, 0x03, 0x21, 0x0e, 0x03, 0x0f, 0x07, 0x0d, 0x05, 0x0e, 0x0f, 0x0c,
+    0xf0, 0x04, 0x0b, 0x03, 0x0d, 0x04, 0x2e, 0x23, 0x0a, 0x05, 0x0d, 0x03,
+    0x0b, 0x01, 0x0f, 0x22, 0x0d, 0x09, 0x0e, 0x03, 0x0c, 0x04, 0x0b, 0x07,
+    0x0c, 0x05, 0x0d, 0xf0, 0x0e, 0x0e, 0x0b, 0x3c, 0x09, 0x0d, 0x08, 0x17,
+    0x1b, 0x0a, 0x0d, 0x07, 0x0c, 0x05, 0x0b, 0x06, 0x0c, 0x04, 0x0b, 0x01,
+    0x1e, 0x04, 0x12, 0x0d, 0x0b, 0x30, 0x05, 0x0a, 0x0b, 0x0d, 0x0a, 0x0f,
+    0x07, 0x09, 0xf1, 0x0f, 0x0d, 0x14, 0x0c, 0x09, 0x05, 0x28, 0x12, 0x03,
+    0x0a, 0x01, 0x0f, 0x02, 0x0d, 0x03, 0x0a, 0x11, 0x0b, 0x0e, 0x12, 0x0a,
+    0x08, 0x01, 0x0a, 0x23, 0x08, 0xf1, 0x0b, 0x0a, 0x05, 0x09, 0x14, 0x0b,
+    0x0c, 0x06, 0x0e, 0x07, 0x0c, 0x0a, 0x3b, 0x08, 0x07, 0x0d, 0x35, 0x0a,
+    0x1c, 0x0e, 0x06, 0x09, 0x12, 0x09, 0x0c, 0x0a, 0x09, 0xc3, 0x0f, 0x1e,
+    0x0e, 0x09, 0x0c, 0x0c, 0x2a, 0x06, 0x0d, 0x06, 0x29, 0x07, 0x0d, 0x07,
+    0x08, 0x05, 0x09, 0x0e, 0x08, 0x06, 0x1a, 0x52, 0x04, 0x0f, 0x0b, 0x07,
+    0x08, 0x05, 0x06, 0x06, 0x05, 0x04, 0x27, 0x21, 0x12, 0x04, 0x0b, 0xf0,
+    0x12, 0x19, 0x07, 0x07, 0x13, 0x16, 0x09, 0x05, 0x14, 0x04, 0x03, 0x05,
+    0x12, 0x02, 0x20, 0x13, 0x02, 0x01, 0x11, 0x02, 0x03, 0x30, 0x21, 0x05,
+    0x13, 0x42, 0x12, 0x21, 0x01, 0x13, 0x02, 0xc1, 0x33, 0x02, 0x13, 0x02,
+    0x04, 0x03, 0x05, 0x04, 0x16, 0x22, 0x17, 0x01, 0x08, 0x02, 0x1b, 0x04,
+    0x05, 0x02, 0x09, 0x09, 0x03, 0x18, 0x08, 0x44, 0x1f, 0x0a, 0x0b, 0x07,
+    0x0a, 0x04, 0x09, 0x08, 0x13, 0x1b, 0x12, 0xb2, 0x0e, 0x03, 0x0b, 0x04,
+    0x09, 0x03, 0x0b, 0x02, 0x0d, 0x06, 0x0b, 0x02, 0x0a, 0x13, 0x39, 0x02,
+    0x00, 0x01, 0x0a, 0x02, 0xf1, 0x0e, 0x01, 0x0f, 0x04, 0x0e, 0x26, 0x0d,
+    0x0c, 0x0e, 0x07, 0x0c, 0x13, 0x0a, 0x1c, 0x11, 0x09, 0x10, 0x08, 0x0b,
+    0x02, 0x19, 0x00, 0x12, 0x1a, 0x71, 0x01, 0x18, 0x05, 0x02, 0x09, 0x01,
+    0x1c, 0x03, 0x01, 0x0e, 0x13, 0x0f, 0x12, 0x0b, 0x05, 0x0d, 0x06, 0x23,
+    0x0b, 0x0c, 0x1c, 0x06, 0x03, 0x04, 0x0b, 0x04, 0x25, 0x1a, 0x02, 0x13,
+    0x0b, 0x46, 0x0e, 0x0f, 0x0d, 0x03, 0x0c, 0x0e, 0x0e, 0x0d, 0x0a, 0x01,
+    0x05, 0x0b, 0x07, 0x04, 0x0c, 0x05, 0x03, 0x0e, 0x02, 0x42, 0x1d, 0x04,
+    0x05, 0x0a, 0x01, 0x19, 0x22, 0x11, 0x0a, 0x08, 0x05, 0x90, 0x1b, 0x17,
+    0x09, 0x23, 0x27, 0x00, 0x06, 0x04, 0x07, 0x0a, 0x08, 0x03, 0x0a, 0x0d,
+    0x61, 0x09, 0x07, 0x18, 0x03, 0x04, 0x19, 0x02, 0x01, 0x18, 0x05, 0x03,
+    0xf0, 0x09, 0x02, 0x08, 0x03, 0x16, 0x00, 0x01, 0x25, 0x00, 0x01, 0x02,
+    0x77, 0x03, 0x06, 0x04, 0x03, 0x02, 0x00, 0x03, 0x05, 0x08, 0x04, 0x60,
+    0x6b, 0x0e, 0x08, 0x06, 0x05, 0x07, 0x04, 0x08, 0x51, 0x19, 0x0e, 0x06,
+    0x0a, 0x0f, 0x0b, 0x0c, 0x0c, 0x07, 0x0e, 0x0a, 0x22, 0x1a, 0x0c, 0x0a,
+    0x0b, 0x1f, 0x03, 0x0a, 0x34, 0x09, 0x04, 0x0a, 0x05, 0x0b, 0x0f, 0x0e,
+    0x11, 0x03, 0x0d, 0x14, 0x0b, 0x02, 0x09, 0x10, 0x13, 0x0a, 0x09, 0x02,
+    0x32, 0x08, 0x00, 0x07, 0x01, 0x16, 0x04, 0x02, 0xf1, 0x08, 0x05, 0x09,
+    0x04, 0x18, 0x03, 0x02, 0x09, 0x11, 0x0b, 0x0c, 0x12, 0x1a, 0x04, 0x09,
+    0x03, 0x0b, 0x16, 0x0a, 0x1c, 0x07, 0x0e, 0x0b, 0x05, 0x1a, 0x06, 0x41,
+    0x04, 0x38, 0x02, 0x00, 0x01, 0x50, 0x30, 0x09, 0x07, 0x0a, 0x0d, 0x01,
+    0x08, 0xa2, 0x07, 0x01, 0x26, 0x00, 0x11, 0x07, 0x03, 0x08, 0x02, 0x0b,
+    0x06, 0x0e, 0x0a, 0x2c, 0x07, 0x0f, 0x09, 0x01, 0x0d, 0x07, 0xf0, 0x0f,
+    0x14, 0x2e, 0x02, 0x14, 0x1c, 0x06, 0x1e, 0x0f, 0x04, 0x2c, 0x09, 0x04,
+    0x02, 0x0a, 0x05, 0x0b, 0x04, 0x0c, 0x26, 0x2b, 0xf0, 0x07, 0x0d, 0x04,
+    0x0e, 0x07, 0x0d, 0x15, 0x1e, 0x0c, 0x2d, 0x08, 0x0b, 0x0c, 0x1c, 0x05,
+    0x04, 0x0a, 0x02, 0x09, 0x14, 0x0b, 0x09, 0x02, 0x0c, 0x04, 0xa0, 0x0e,
+    0x01, 0x0f, 0x20, 0x0e, 0x09, 0x0e, 0x01, 0x0c, 0x12, 0x0b, 0x0c, 0x03,
+    0x0e, 0x02, 0x0a, 0x21, 0x0d, 0x81, 0x08, 0x27, 0x00, 0x01, 0x02, 0x08,
+    0x01, 0x19, 0x02, 0x11, 0x0a, 0x29, 0x00, 0x22, 0x02, 0x21, 0x1a, 0x03,
+    0x04, 0x0d, 0x00, 0x15, 0x0c, 0x01, 0x0b, 0x02, 0x07, 0x1c, 0x03, 0x0a,
+    0x04, 0x0d, 0x0e, 0x0f, 0x0f, 0x4f, 0x06, 0x0d, 0x0e, 0x0b, 0x08, 0x09,
+    0x05, 0x08, 0x04, 0x09, 0x0e, 0x01, 0x18, 0x0c, 0x02, 0x0b, 0x04, 0x06,
+    0x0d, 0x06, 0x05, 0x1c, 0x07, 0x04, 0x09, 0x23, 0x0d, 0x05, 0x1b, 0x0d,
+    0x0a, 0x62, 0x0d, 0x05, 0x0b, 0x06, 0x1a, 0x04, 0x07, 0x09, 0x02, 0x18,
+    0x04, 0x09, 0x01, 0x0b, 0x0b, 0xf0, 0x0f, 0x0d, 0x1e, 0x0a, 0x08, 0x0c,
+    0x07, 0x0b, 0x05, 0x18, 0x03, 0x07, 0x07, 0x03, 0x06, 0x02, 0x07, 0x01,
+    0x06, 0x30, 0x05, 0x14, 0x03, 0x01, 0x04, 0x04, 0xf0, 0x15, 0x11, 0x17,
+    0x04, 0x13, 0x08, 0x0b, 0x2c, 0x0a, 0x09, 0x07, 0x09, 0x36, 0x06, 0x04,
+    0x02, 0x04, 0x05, 0x10, 0x04, 0x05, 0x03, 0x30, 0x06, 0x00, 0x09, 0x03,
+    0x1e, 0x01, 0x02, 0x71, 0x09, 0x08, 0x0a, 0x03, 0x0c, 0x0a, 0x0d, 0x06,
+    0x0c, 0x0e, 0x1e, 0x0f, 0x05, 0x0d, 0x0f, 0x42, 0x2b, 0x06, 0x05, 0x09,
+    0x09, 0x02, 0x08, 0x03, 0x51, 0x0d, 0x06, 0x0b, 0x04, 0x0c, 0x12, 0x0b,
+    0x19, 0x03, 0x12, 0xf0, 0x0e, 0x0a, 0x04, 0x0b, 0x02, 0x0a, 0x04, 0x09,
+    0x08, 0x0a, 0x04, 0x0c, 0x0a, 0x0e, 0x1f, 0x0f, 0x0e, 0x15, 0x0b, 0x0a,
+    0x14, 0x0d, 0x4e, 0x09, 0x06, 0x03, 0xb0, 0x01, 0x02, 0x0c, 0x11, 0x09,
+    0x08, 0x23, 0x09, 0x08, 0x17, 0x01, 0x02, 0x08, 0x04, 0x07, 0x00, 0x08,
+    0x22, 0x71, 0x06, 0x07, 0x08, 0x04, 0x19, 0x03, 0x08, 0x0b, 0x07, 0x1d,
+    0x09, 0x07, 0x62, 0x1a, 0x0e, 0x08, 0x2b, 0x07, 0x06, 0x07, 0x0c, 0x05,
+    0x0b, 0x03, 0x23, 0x09, 0x08, 0x0b, 0x04, 0x2c, 0x08, 0x14, 0x09, 0x08,
+    0x05, 0x1a, 0x0e, 0x06, 0x0f, 0x37, 0x1b, 0x09, 0x04, 0x0d, 0x0f, 0x0e,
+    0x05, 0x16, 0x1c, 0x03, 0x04, 0x04, 0x2e, 0x02, 0x03, 0x04, 0x52, 0x03,
+    0x0c, 0x04, 0x39, 0x02, 0x01, 0x05, 0x01, 0x91, 0x0b, 0x02, 0x3a, 0x04,
+    0x01, 0x03, 0x04, 0x0b, 0x03, 0x0d, 0x01, 0x0a, 0x02, 0x09, 0x01, 0x07,
+    0x00, 0xf0, 0x0a, 0x21, 0x08, 0x0a, 0x08, 0x02, 0x07, 0x10, 0x06, 0x24,
+    0x22, 0x15, 0x31, 0x06, 0x15, 0x02, 0x04, 0x00, 0x05, 0x01, 0x50, 0x06,
+    0x05, 0x07, 0x01, 0x09, 0x03, 0x0b, 0x0e, 0x0c, 0x07, 0x0d, 0x0f, 0x01,
+    0x08, 0x0d, 0xf0, 0x0d, 0x0f, 0x1e, 0x0a, 0x08, 0x0d, 0x09, 0x0c, 0x15,
+    0x1a, 0x09, 0x2b, 0x08, 0x04, 0x13, 0x09, 0x0a, 0x02, 0x0d, 0x03, 0x0a,
+    0x15, 0x09, 0x0a, 0x14, 0x30, 0x0b, 0x1c, 0x06, 0x14, 0x0d, 0x81, 0x19,
+    0x08, 0x0f, 0x0a, 0x19, 0x29, 0x0b, 0x15, 0x28, 0x06, 0x05, 0xf0, 0x1e,
+    0x04, 0x06, 0x0d, 0x04, 0x0c, 0x01, 0x1f, 0x14, 0x0e, 0x02, 0x0b, 0x03,
+    0x09, 0x12, 0x0b, 0x0d, 0x23, 0x0c, 0x09, 0x0a, 0x04, 0x69, 0x03, 0x07,
+    0x80, 0x06, 0x05, 0x04, 0x03, 0x11, 0x0c, 0x0f, 0x02, 0x0c, 0x11, 0x0b,
+    0x01, 0x28, 0x00, 0x22, 0x11, 0x0a, 0x02, 0x23, 0x19, 0x04, 0x03, 0x0b,
+    0x05, 0xe4, 0x0a, 0x07, 0x0d, 0x0f, 0x0e, 0x0e, 0x1d, 0x0b, 0x0f, 0x0c,
+    0x0e, 0x0d, 0x08, 0x0c, 0x06, 0x1e, 0x0f, 0x05, 0x0d, 0x06, 0x0c, 0x04,
+    0x0a, 0x02, 0x0b, 0x07, 0x0a, 0x03, 0x73, 0x0c, 0x02, 0x0f, 0x04, 0x0e,
+    0x03, 0x1f, 0x05, 0x07, 0x0e, 0x0f, 0x0c, 0x0e, 0x0b, 0x16, 0x52, 0x0d,
+    0x0b, 0x0c, 0x1c, 0x16, 0x1b, 0x0f, 0x08, 0x21, 0x0c, 0x05, 0x09, 0x03,
+    0x27, 0x02, 0xf0, 0x01, 0x60, 0x26, 0x04, 0x05, 0x16, 0x01, 0x08, 0x02,
+    0x1b, 0x01, 0x03, 0x1e, 0x12, 0x0b, 0x11, 0x08, 0xf0, 0x07, 0x04, 0x16,
+    0x00, 0x02, 0x08, 0x03, 0x0a, 0x01, 0x0c, 0x02, 0x0d, 0x04, 0x0b, 0x13,
+    0x0c, 0x1e, 0x18, 0x1c, 0x0a, 0x06, 0x0b, 0x09, 0x1a, 0x0c, 0x07, 0x30,
+    0x0b, 0x0c, 0x1c, 0x18, 0x0d, 0x0b, 0x41, 0x28, 0x09, 0x07, 0x08, 0x09,
+    0x0e, 0x0a, 0x0a, 0xe0, 0x0e, 0x07, 0x1c, 0x09, 0x07, 0x0b, 0x03, 0x0a,
+    0x11, 0x09, 0x07, 0x10, 0x35, 0x01, 0x12, 0x07, 0x05, 0x08, 0x14, 0x19,
+    0x02, 0x91, 0x06, 0x01, 0x07, 0x03, 0x08, 0x02, 0x17, 0x04, 0x0b, 0x08,
+    0x09, 0x09, 0x05, 0x0b, 0x09, 0x1d, 0x01, 0x00, 0x92, 0x09, 0x01, 0x08,
+    0x00, 0x0a, 0x13, 0x09, 0x0a, 0x06, 0x0b, 0x0f, 0x0e, 0x04, 0x0a, 0x06,
+    0x09, 0x03, 0x08, 0x02, 0x71, 0x0a, 0x03, 0x09, 0x14, 0x0a, 0x08, 0x03,
+    0x0a, 0x06, 0x0c, 0x04, 0x0d, 0x05, 0x0e, 0x03, 0x62, 0x0a, 0x08, 0x0b,
+    0x04, 0x2d, 0x08, 0x0d, 0x06, 0x1e, 0x1b, 0x13, 0x1a, 0x0f, 0x0e, 0x72,
+    0x1e, 0x08, 0x0c, 0x0d, 0x09, 0x0b, 0x04, 0x3a, 0x09, 0x04, 0x03, 0x05,
+    0xb1, 0x0f, 0x13, 0x0e, 0x0d, 0x04, 0x0e, 0x09, 0x0c, 0x08, 0x0a, 0x05,
+    0x08, 0x0d, 0x07, 0x05, 0x06, 0x03, 0x25, 0x02, 0x01, 0x00, 0x12, 0x14,
+    0x01, 0x12, 0x01, 0x05, 0xf0, 0x26, 0x04, 0x21, 0x18, 0x00, 0x06, 0x02,
+    0x27, 0x03, 0x02, 0x04, 0x26, 0x05, 0x06, 0x03, 0x17, 0x04, 0x0c, 0x18,
+    0x04, 0x05, 0x00, 0x09, 0x0e, 0x31, 0x17, 0x03, 0x05, 0x18, 0x0f, 0x19,
+    0xf0, 0x1c, 0x07, 0x1b, 0x04, 0x02, 0x09, 0x13, 0x08, 0x17, 0x01, 0x02,
+    0x28, 0x06, 0x03, 0x04, 0x0a, 0x09, 0x1b, 0x06, 0x0d, 0x0c, 0x1f, 0x0d,
+    0xf0, 0x0c, 0x0a, 0x0b, 0x09, 0x0a, 0x03, 0x08, 0x00, 0x0a, 0x01, 0x08,
+    0x10, 0x06, 0x07, 0x13, 0x28, 0x02, 0x03, 0x09, 0x11, 0x0b, 0x09, 0x13,
+    0x0a, 0x0e, 0x04, 0x70, 0x1f, 0x0f, 0x09, 0x0e, 0x05, 0x2d, 0x0e, 0x03,
+    0x06, 0x1f, 0x0b, 0x05, 0x21, 0x0b, 0x09, 0x0d, 0x05, 0x0e, 0x13, 0x12,
+    0x0b, 0x0c, 0x02, 0x03, 0x1a, 0x03, 0x34, 0x07, 0x0b, 0x1e, 0x0d, 0x0b,
+    0x08, 0x33, 0x0e, 0x06, 0x0d, 0x03, 0x0c, 0x02, 0x0e, 0x01, 0x14, 0x0d,
+    0x12, 0x0e, 0x05, 0x0a, 0x03, 0x04, 0x0c, 0x01, 0x45, 0x0a, 0x00, 0x1b,
+    0x01, 0x20, 0x09, 0x0a, 0x04, 0x0b, 0x11, 0x43, 0x0d, 0x0a, 0x00, 0x0b,
+    0x02, 0x18, 0x01, 0x03, 0x42, 0x0b, 0x05, 0x0c, 0x04, 0x0a, 0x09, 0x19,
+    0x0d, 0x0f, 0xf1, 0x1b, 0x05, 0x06, 0x0c, 0x04, 0x0b, 0x01, 0x0a, 0x03,
+    0x19, 0x05, 0x04, 0x08, 0x05, 0x19, 0x0b, 0x06, 0x68, 0x0a, 0x07, 0x09,
+    0x0e, 0x15, 0x21, 0x04, 0x19, 0x0f, 0x08, 0xf0, 0x0c, 0x0e, 0x0e, 0x0d,
+    0x1b, 0x02, 0x07, 0x0d, 0x02, 0x0b, 0x01, 0x1a, 0x04, 0x03, 0x18, 0x02,
+    0x01, 0x0b, 0x02, 0x09, 0x00, 0x0b, 0x01, 0x08, 0x02, 0x07, 0x01, 0x18,
+    0x12, 0x90, 0x19, 0x03, 0x07, 0x08, 0x13, 0x09, 0x0b, 0x07, 0x1d, 0x03,
+    0x09, 0x0c, 0x0d, 0x0d, 0x09, 0xf1, 0x09, 0x0f, 0x0a, 0x18, 0x09, 0x18,
+    0x05, 0x04, 0x19, 0x03, 0x01, 0x08, 0x02, 0x0a, 0x04, 0x0d, 0x03, 0x2f,
+    0x04, 0x0f, 0x05, 0x0b, 0x03, 0x0a, 0x06, 0x08, 0x05, 0xf0, 0x1a, 0x03,
+    0x02, 0x0b, 0x03, 0x19, 0x10, 0x06, 0x02, 0x07, 0x11, 0x08, 0x17, 0x05,
+    0x02, 0x06, 0x01, 0x08, 0x03, 0x09, 0x00, 0x0a, 0x01, 0x08, 0x02, 0x19,
+    0x40, 0xb0, 0x0b, 0x0e, 0x1b, 0x11, 0x17, 0x00, 0x06, 0x11, 0x07, 0x08,
+    0x00, 0x0d, 0x31, 0x0f, 0x11, 0x0c, 0x0d, 0x22, 0x0b, 0x13, 0x0c, 0x0e,
+    0x02, 0x03, 0x0d, 0x04, 0x04, 0x0b, 0x03, 0x25, 0x1a, 0x08, 0x07, 0x0b,
+    0x06, 0x06, 0x0c, 0x0f, 0x07, 0x0b, 0x04, 0x09, 0x6a, 0x09, 0x1a, 0x06,
+    0x04, 0x0e, 0x0c, 0x5d, 0x06, 0x1f, 0x29, 0x0b, 0x0f, 0x02, 0x0a, 0x08,
+    0x04, 0x08, 0x07, 0x03, 0x16, 0x05, 0x00, 0x04, 0x03, 0x08, 0x03, 0x02,
+    0x0d, 0x32, 0x01, 0x0e, 0x02, 0x0f, 0x03, 0x0b, 0x02, 0x1f, 0xf1, 0x01,
+    0x12, 0x1b, 0x21, 0x09, 0x0d, 0x0b, 0x00, 0x0a, 0x01, 0x0b, 0x02, 0x07,
+    0x01, 0x08, 0x02, 0x0a, 0x04, 0x19, 0x01, 0x13, 0x1b, 0x00, 0x0e, 0xf1,
+    0x05, 0x0a, 0x44, 0x1b, 0x1a, 0x0d, 0x22, 0x0c, 0x0e, 0x0c, 0x01, 0x1a,
+    0x03, 0x05, 0x19, 0x04, 0x06, 0x0c, 0x0f, 0x0e, 0x08, 0x2b, 0x71, 0x06,
+    0x0f, 0x05, 0x09, 0x0f, 0x0a, 0x06, 0x09, 0x04, 0x0a, 0x08, 0x08, 0x03,
+    0x0e, 0xf0, 0x08, 0x0c, 0x12, 0x0a, 0x0c, 0x03, 0x0e, 0x01, 0x0a, 0x05,
+    0x0c, 0x01, 0x0a, 0x00, 0x07, 0x03, 0x08, 0x10, 0x0b, 0x0e, 0x13, 0x0c,
+    0x08, 0x02, 0x0a, 0x01, 0x1d, 0x02, 0xb0, 0x00, 0x0a, 0x01, 0x07, 0x05,
+    0x08, 0x03, 0x07, 0x04, 0x08, 0x05, 0x19, 0x06, 0x13, 0x08, 0x0a, 0x06,
+    0x0b, 0x00, 0x0e, 0x01, 0x19, 0x31, 0x04, 0x00, 0x0a, 0x03, 0x0d, 0x11,
+    0x09, 0xf2, 0x0e, 0x14, 0x0c, 0x0b, 0x05, 0x0d, 0x0d, 0x0c, 0x0b, 0x0a,
+    0x04, 0x19, 0x03, 0x02, 0x48, 0x01, 0x00, 0x03, 0x11, 0x0e, 0x03, 0x0d,
+    0x12, 0x0b, 0xf2, 0x0c, 0x08, 0x1d, 0x0e, 0x07, 0x0c, 0x0f, 0x0f, 0x0e,
+    0x0d, 0x05, 0x1a, 0x04, 0x08, 0x0b, 0x04, 0x0a, 0x09, 0x1b, 0x07, 0x0e,
+    0x0e, 0x0f, 0x0f, 0x14, 0x0b, 0x1e, 0xb2, 0x03, 0x04, 0x0c, 0x05, 0x0a,
+    0x06, 0x0c, 0x1f, 0x0e, 0x0b, 0x06, 0x0a, 0x0a, 0x09, 0x09, 0x17, 0x07,
+    0x0e, 0x06, 0x09, 0x19, 0x21, 0x06, 0x0e, 0x07, 0x06, 0x0d, 0xf0, 0x07,
+    0x1c, 0x0e, 0x14, 0x0d, 0x0e, 0x12, 0x0d, 0x18, 0x50, 0x06, 0x05, 0x12,
+    0x03, 0x01, 0x04, 0x42, 0x33, 0x80, 0x04, 0x03, 0x05, 0x01, 0x06, 0x22,
+    0x08, 0x0b, 0x09, 0x00, 0x0f, 0x01, 0x08, 0xf1, 0x04, 0x17, 0x01, 0x03,
+    0x0c, 0x04, 0x2e, 0x02, 0x01, 0x13, 0x0c, 0x0d, 0x04, 0x0b, 0x06, 0x2a,
+    0x05, 0x0a, 0x26, 0x09, 0x0a, 0x1b, 0x04, 0x21, 0x05, 0x0d, 0x13, 0x0f,
+    0x0a, 0x02, 0x07, 0x07, 0x13, 0x16, 0x28, 0x04, 0x0f, 0x05, 0x08, 0x06,
+    0x06, 0x05, 0x05, 0x27, 0x04, 0x06, 0x01, 0x05, 0x00, 0x03, 0x19, 0x01,
+    0x02, 0x00, 0x21, 0x2b, 0x02, 0x03, 0x02, 0xf0, 0x0f, 0x05, 0x0e, 0x03,
+    0x0b, 0x22, 0x09, 0x0c, 0x0e, 0x01, 0x0a, 0x13, 0x09, 0x18, 0x01, 0x02,
+    0x07, 0x04, 0x08, 0x13, 0x07, 0x08, 0x04, 0x07, 0x01, 0x09, 0x12, 0x20,
+    0x1a, 0x11, 0x0c, 0xe1, 0x08, 0x02, 0x09, 0x01, 0x1b, 0x03, 0x11, 0x0d,
+    0x0c, 0x06, 0x0a, 0x02, 0x19, 0x03, 0x08, 0x0a, 0x05, 0x1b, 0x06, 0x04,
+    0x0a, 0x05, 0x0c, 0x03, 0x0e, 0x02, 0x62, 0x0c, 0x07, 0x0e, 0x09, 0x0d,
+    0x0f, 0x2e, 0x0c, 0x0f, 0x04, 0x0b, 0x03, 0x33, 0x19, 0x06, 0x04, 0x0b,
+    0x06, 0x0e, 0x1d, 0x54, 0x1b, 0x0a, 0x1c, 0x0e, 0x08, 0x2b, 0x13, 0x35,
+    0x06, 0x3a, 0x03, 0x0d, 0x05, 0x14, 0x04, 0x19, 0x09, 0x03, 0x13, 0x52,
+    0x0a, 0x39, 0x06, 0x04, 0x03, 0x0f, 0x08, 0x14, 0x21, 0x0b, 0x19, 0x08,
+    0x05, 0xf0, 0x2d, 0x02, 0x13, 0x0b, 0x01, 0x0c, 0x12, 0x09, 0x0a, 0x03,
+    0x09, 0x02, 0x08, 0x11, 0x07, 0x06, 0x02, 0x05, 0x10, 0x06, 0x05, 0x21,
+    0x06, 0x27, 0xa0, 0x02, 0x03, 0x08, 0x01, 0x09, 0x02, 0x0c, 0x13, 0x09,
+    0x08, 0x08, 0x09, 0x03, 0x0a, 0x06, 0x0c, 0x0f, 0x0e, 0x0b, 0x21, 0x19,
+    0x06, 0x05, 0x0c, 0x0f, 0x02, 0x0b, 0x04, 0x21, 0x0c, 0x05, 0x09, 0x0c,
+    0x08, 0x0a, 0xf0, 0x2b, 0x05, 0x06, 0x09, 0x1a, 0x06, 0x18, 0x29, 0x04,
+    0x18, 0x18, 0x03, 0x09, 0x08, 0x0b, 0x05, 0x0a, 0x02, 0x0d, 0x03, 0x0a,
+    0x04, 0x3b, 0x07, 0xf0, 0x04, 0x06, 0x0e, 0x1c, 0x26, 0x1e, 0x08, 0x0d,
+    0x05, 0x1c, 0x06, 0x08, 0x1b, 0x03, 0x04, 0x0c, 0x03, 0x09, 0x02, 0x07,
+    0x21, 0x06, 0xf0, 0x07, 0x09, 0x00, 0x0e, 0x02, 0x19, 0x40, 0x08, 0x07,
+    0x15, 0x01, 0x16, 0x03, 0x02, 0x08, 0x15, 0x0a, 0x0c, 0x04, 0x0a, 0x05,
+    0x09, 0x07, 0x20, 0x1b, 0x16, 0x0f, 0x0f, 0x11, 0x0b, 0x06, 0x0c, 0x04,
+    0x82, 0x09, 0x0f, 0x0a, 0x04, 0x29, 0x06, 0x0b, 0x04, 0x0a, 0x07, 0x0b,
+    0x04, 0x0c, 0x02, 0x0f, 0x13, 0x13, 0x0e, 0x0c, 0x04, 0x64, 0x0a, 0x0a,
+    0x0c, 0x06, 0x0d, 0x0f, 0x0e, 0x18, 0x0b, 0x0d, 0x0f, 0x0e, 0x07, 0x13,
+    0x0c, 0x09, 0x0a, 0x07, 0x02, 0x0c, 0x08, 0x31, 0x0f, 0x09, 0x0d, 0x05,
+    0x0b, 0x0a, 0x0a, 0x09, 0xf0, 0x0e, 0x05, 0x0c, 0x06, 0x1d, 0x01, 0x12,
+    0x0a, 0x17, 0x01, 0x03, 0x08, 0x01, 0x07, 0x02, 0x08, 0x03, 0x09, 0x40,
+    0x0a, 0x07, 0x06, 0x13, 0x01, 0x70, 0x04, 0x00, 0x15, 0x11, 0x06, 0x40,
+    0x05, 0x06, 0x07, 0x0a, 0x21, 0x07, 0x01, 0x09, 0x33, 0x0d, 0x12, 0x0c,
+    0x0f, 0x13, 0x0d, 0x02, 0x0f, 0x03, 0x05, 0x0e, 0x02, 0x07, 0x0b, 0x04,
+    0x08, 0x1c, 0x0f, 0x09, 0x04, 0x07, 0x0b, 0x0c, 0x06, 0x0c, 0x0f, 0x05,
+    0x0d, 0x04, 0x24, 0x0e, 0x05, 0x0c, 0x07, 0x0b, 0x0c, 0x23, 0x0e, 0x05,
+    0x0c, 0x06, 0x0b, 0x09, 0x62, 0x1d, 0x03, 0x05, 0x1e, 0x08, 0x07, 0x1c,
+    0x0c, 0x0f, 0x0b, 0x0c, 0xa1, 0x1e, 0x05, 0x08, 0x0b, 0x07, 0x0a, 0x03,
+    0x09, 0x15, 0x0b, 0x09, 0x04, 0x0a, 0x03, 0x09, 0x01, 0x1b, 0x03, 0x01,
+    0xf0, 0x0e, 0x02, 0x0d, 0x04, 0x0a, 0x02, 0x08, 0x04, 0x29, 0x03, 0x01,
+    0x40, 0x0a, 0x0c, 0x0d, 0x09, 0x08, 0x02, 0x06, 0x10, 0x07, 0x0b, 0x01,
+    0x09, 0x00, 0x41, 0x07, 0x02, 0x28, 0x03, 0x04, 0x03, 0x0a, 0x04, 0x12,
+    0x08, 0x02, 0x07, 0x01, 0x13, 0x45, 0x02, 0x11, 0x04, 0x05, 0x02, 0x26,
+    0x04, 0x14, 0x12, 0x39, 0xf3, 0x03, 0x02, 0x04, 0x08, 0x18, 0x06, 0x0f,
+    0x2b, 0x07, 0x04, 0x0f, 0x1c, 0x07, 0x0b, 0x0e, 0x0f, 0x0f, 0x09, 0x0d,
+    0x0d, 0x0c, 0x0c, 0x08, 0x05, 0x0b, 0x12, 0x06, 0x0a, 0x08, 0x0f, 0x51,
+    0x05, 0x0e, 0x17, 0x0d, 0x0c, 0x1c, 0x09, 0x06, 0x09, 0x08, 0xf0, 0x0d,
+    0x06, 0x0a, 0x05, 0x17, 0x14, 0x18, 0x03, 0x62, 0x0f, 0x0a, 0x0d, 0x0f,
+    0x06, 0x09, 0x18, 0x51, 0x09, 0x0e, 0xf0, 0x0d, 0x08, 0x07, 0x50, 0x02,
+    0x03, 0x11, 0x14, 0x01, 0x06, 0x02, 0x03, 0x03, 0x04, 0x04, 0x09, 0x15,
+    0x03, 0x06, 0x06, 0x07, 0x07, 0x00, 0x04, 0x05, 0x01, 0x0b, 0x04, 0x12,
+    0x05, 0x15, 0x0d, 0x23, 0x0f, 0x06, 0x03, 0x18, 0x0b, 0x14, 0x08, 0x0b,
+    0x05, 0x0d, 0x65, 0x0f, 0x0e, 0x05, 0x0d, 0x0d, 0x09, 0x05, 0x17, 0x08,
+    0x06, 0x06, 0x07, 0x15, 0x26, 0x0d, 0x04, 0x14, 0x02, 0x05, 0x00, 0x03,
+    0x06, 0x02, 0x02, 0x17, 0x01, 0x11, 0x02, 0x08, 0x15, 0x70, 0x0c, 0x09,
+    0x03, 0x08, 0x02, 0x19, 0x01, 0x40, 0x0c, 0x1f, 0x01, 0x09, 0xc0, 0x0e,
+    0x01, 0x09, 0x02, 0x07, 0x11, 0x08, 0x09, 0x04, 0x0c, 0x05, 0x2a, 0x04,
+    0x03, 0x02, 0x0b, 0x10, 0x29, 0x01, 0x00, 0x71, 0x06, 0x02, 0x08, 0x05,
+    0x0a, 0x13, 0x0c, 0x0b, 0x0c, 0x1d, 0x06, 0x05, 0x1f, 0x0f, 0xf2, 0x09,
+    0x0d, 0x05, 0x0c, 0x08, 0x0e, 0x06, 0x0c, 0x04, 0x0b, 0x06, 0x0d, 0x08,
+    0x0b, 0x05, 0x0a, 0x06, 0x1c, 0x0a, 0x07, 0x0b, 0x05, 0x1c, 0x06, 0x07,
+    0x0d, 0x06, 0x1c, 0x05, 0x42, 0x0d, 0x1d, 0x08, 0x26, 0x1e, 0x13, 0x0c,
+    0x0f, 0x2a, 0x06, 0x12, 0x09, 0x0d, 0x91, 0x0e, 0x24, 0x0d, 0x0b, 0x0a,
+    0x05, 0x1b, 0x06, 0x0e, 0x0a, 0x0f, 0x09, 0x07, 0x18, 0x09, 0x06, 0xf0,
+    0x0b, 0x03, 0x0c, 0x04, 0x1a, 0x03, 0x04, 0x0b, 0x05, 0x09, 0x03, 0x1b,
+    0x09, 0x04, 0x2a, 0x03, 0x06, 0x04, 0x08, 0x03, 0x07, 0x02, 0x16, 0x01,
+    0x10, 0x05, 0x60, 0x04, 0x01, 0x16, 0x02, 0x00, 0x08, 0x01, 0x0e, 0x02,
+    0x0c, 0x00, 0x0e, 0x01, 0xf1, 0x29, 0x05, 0x02, 0x08, 0x1a, 0x05, 0x01,
+    0x0b, 0x02, 0x0a, 0x11, 0x19, 0x02, 0x0c, 0x04, 0x0e, 0x16, 0x1b, 0x05,
+    0x0e, 0x0e, 0x0d, 0x04, 0x1c, 0x06, 0x71, 0x08, 0x0b, 0x06, 0x2a, 0x07,
+    0x05, 0x04, 0x19, 0x03, 0x11, 0x0a, 0xf0, 0x1f, 0x02, 0x03, 0x0e, 0x25,
+    0x0a, 0x09, 0x0a, 0x04, 0x09, 0x03, 0x1b, 0x32, 0x0c, 0x0b, 0x0c, 0x04,
+    0x1a, 0x05, 0x04, 0x09, 0x02, 0x0b, 0x01, 0xe0, 0x09, 0x20, 0x08, 0x27,
+    0x01, 0x13, 0x09, 0x0a, 0x02, 0x0e, 0x03, 0x0c, 0x05, 0x0b, 0x33, 0x09,
+    0x1c, 0x0b, 0x01, 0x0e, 0x13, 0xe1, 0x09, 0x0d, 0x04, 0x0e, 0x0f, 0x1f,
+    0x05, 0x27, 0x0e, 0x2b, 0x04, 0x1b, 0x1c, 0x05, 0x0e, 0x0c, 0x2f, 0x0d,
+    0x06, 0x0f, 0x12, 0x0e, 0x0c, 0x0f, 0x0d, 0x23, 0x0c, 0x0f, 0x0b, 0x08,
+    0x0d, 0x0f, 0x04, 0x0b, 0x0b, 0xc3, 0x1d, 0x0f, 0x18, 0x2c, 0x0a, 0x04,
+    0x0b, 0x05, 0x0c, 0x0b, 0x0b, 0x03, 0x0a, 0x05, 0x09, 0x04, 0x18, 0x12,
+    0x07, 0x11, 0x32, 0x09, 0x0a, 0x00, 0x19, 0x12, 0x01, 0x0a, 0x01, 0xf0,
+    0x0f, 0x03, 0x0e, 0x01, 0x09, 0x00, 0x18, 0x11, 0x07, 0x02, 0x0a, 0x03,
+    0x09, 0x12, 0x0b, 0x0d, 0x30, 0x08, 0x06, 0x15, 0x11, 0x06, 0x0a, 0x03,
+    0xf0, 0x1e, 0x02, 0x04, 0x2c, 0x09, 0x04, 0x06, 0x0e, 0x09, 0x1c, 0x0e,
+    0x0a, 0x0d, 0x0e, 0x1e, 0x0f, 0x05, 0x0d, 0x04, 0x0b, 0x03, 0x0d, 0x04,
+    0x09, 0x03, 0x08, 0x0a, 0xf0, 0x09, 0x08, 0x0a, 0x03, 0x19, 0x05, 0x02,
+    0x48, 0x01, 0x02, 0x03, 0x05, 0x04, 0x09, 0x05, 0x0a, 0x0e, 0x3b, 0x13,
+    0x04, 0x12, 0x0d, 0x80, 0x1c, 0x03, 0x04, 0x0a, 0x03, 0x08, 0x02, 0x0a,
+    0x04, 0x0b, 0x02, 0x0d, 0x00, 0x0f, 0x01, 0x0c, 0x30, 0x31, 0x08, 0x0b,
+    0x1a, 0x03, 0x02, 0x09, 0x02, 0x43, 0x08, 0x00, 0x0a, 0x05, 0x0e, 0x02,
+    0x0d, 0x01, 0x0e, 0x04, 0x74, 0x0b, 0x02, 0x0a, 0x01, 0x0c, 0x02, 0x0d,
+    0x01, 0x0e, 0x10, 0x0d, 0x0c, 0x02, 0x0d, 0x01, 0x35, 0x09, 0x00, 0x0a,
+    0x07, 0x0c, 0x01, 0x1a, 0x00, 0x27, 0x03, 0x0c, 0x10, 0x1d, 0x08, 0x11,
+    0x07, 0x0e, 0x19, 0x3d, 0x03, 0x15, 0x28, 0x09, 0x2e, 0x03, 0x07, 0x12,
+    0x16, 0x0d, 0x01, 0x45, 0x1c, 0x03, 0x02, 0x0a, 0x03, 0x1b, 0x06, 0x01,
+    0x16, 0x09, 0x14, 0x0a, 0x15, 0x2b, 0x01, 0x04, 0x16, 0x01, 0x09, 0x00,
+    0x05, 0x0a, 0x02, 0x54, 0x1b, 0x01, 0x02, 0x0d, 0x06, 0x0b, 0x05, 0x0c,
+    0x0f, 0x0e, 0x06, 0x13, 0x0b, 0x04, 0x09, 0x0e, 0x02, 0x0a, 0x04, 0x31,
+    0x0b, 0x13, 0x0e, 0x0c, 0x02, 0x2a, 0x03, 0xf0, 0x01, 0x02, 0x0d, 0x01,
+    0x0b, 0x00, 0x0a, 0x23, 0x0c, 0x0a, 0x09, 0x04, 0x18, 0x03, 0x02, 0x07,
+    0x11, 0x08, 0x0c, 0x03, 0x0b, 0x01, 0x0e, 0x13, 0x0d, 0xf0, 0x0b, 0x00,
+    0x1f, 0x31, 0x0e, 0x0b, 0x0a, 0x04, 0x29, 0x01, 0x02, 0x03, 0x0b, 0x01,
+    0x1e, 0x03, 0x11, 0x0c, 0x09, 0x02, 0x18, 0x00, 0x21, 0xf0, 0x06, 0x07,
+    0x08, 0x12, 0x09, 0x0b, 0x08, 0x0a, 0x07, 0x48, 0x05, 0x09, 0x04, 0x02,
+    0x43, 0x09, 0x08, 0x09, 0x18, 0x04, 0xf0, 0x0a, 0x03, 0x09, 0x05, 0x0d,
+    0x03, 0x0e, 0x09, 0x0d, 0x0e, 0x0e, 0x05, 0x1f, 0x0f, 0x07, 0x0e, 0x0a,
+    0x0d, 0x0b, 0x0c, 0x06, 0x2a, 0x03, 0x05, 0x03, 0x0d, 0x02, 0x0c, 0x04,
+    0xa0, 0x0e, 0x03, 0x0c, 0x12, 0x0e, 0x0d, 0x13, 0x39, 0x05, 0x03, 0x02,
+    0x0a, 0x07, 0x0b, 0x03, 0x0d, 0x02, 0x21, 0x09, 0x03, 0x0b, 0x02, 0x0e,
+    0x03, 0xd2, 0x0a, 0x04, 0x3b, 0x05, 0x08, 0x0c, 0x18, 0x0c, 0x0b, 0x04,
+    0x0a, 0x08, 0x0b, 0x0a, 0x1c, 0x09, 0x0e, 0x0d, 0x07, 0x0b, 0x05, 0x0d,
+    0x03, 0x23, 0x19, 0x06, 0x15, 0x1b, 0x04, 0x0f, 0x55, 0x3a, 0x07, 0x0f,
+    0x0c, 0x05, 0x1b, 0x0e, 0x04, 0x34, 0x0e, 0x17, 0x0d, 0x0a, 0x03, 0x09,
+    0x02, 0x23, 0x2c, 0x01, 0x10, 0x32, 0x0e, 0x11, 0x0b, 0x0c, 0x00, 0x0e,
+    0x13, 0x61, 0x0f, 0x1e, 0x00, 0x08, 0x0b, 0x03, 0x18, 0x01, 0x03, 0x07,
+    0x01, 0xf0, 0x0b, 0x20, 0x0f, 0x0b, 0x0f, 0x01, 0x0e, 0x12, 0x0a, 0x08,
+    0x13, 0x0a, 0x0b, 0x01, 0x09, 0x32, 0x27, 0x08, 0x11, 0x0a, 0x0d, 0x20,
+    0x11, 0x09, 0x08, 0xd2, 0x07, 0x01, 0x29, 0x04, 0x06, 0x09, 0x0a, 0x06,
+    0x0b, 0x03, 0x0a, 0x05, 0x0c, 0x12, 0x1a, 0x09, 0x1c, 0x04, 0x03, 0x1b,
+    0x0f, 0x05, 0x01, 0x09, 0x03, 0xf0, 0x0c, 0x04, 0x0d, 0x22, 0x0b, 0x0c,
+    0x0b, 0x04, 0x09, 0x06, 0x0b, 0x15, 0x0d, 0x0e, 0x04, 0x0d, 0x13, 0x0a,
+    0x09, 0x01, 0x08, 0x02, 0x07, 0x03, 0x06, 0x02, 0x07, 0x13, 0xf0, 0x09,
+    0x1a, 0x04, 0x15, 0x0e, 0x0d, 0x06, 0x0e, 0x07, 0x2c, 0x05, 0x34, 0x1d,
+    0x0c, 0x03, 0x39, 0x02, 0x06, 0x05, 0x08, 0x00, 0x0a, 0x1f, 0x01, 0x08,
+    0xc0, 0x0e, 0x0c, 0x0d, 0x08, 0x1c, 0x06, 0x04, 0x0e, 0x03, 0x0f, 0x04,
+    0x0e, 0x02, 0x0d, 0x03, 0x0c, 0x04, 0x09, 0x02, 0x1b, 0x03, 0x01, 0x0f,
+    0x02, 0x21, 0x1a, 0x03, 0x24, 0x0e, 0x32, 0x1a, 0x0c, 0x0b, 0x05, 0x0c,
+    0x16, 0x83, 0x29, 0x05, 0x0e, 0x0a, 0x19, 0x19, 0x0f, 0x2a, 0x0b, 0x0e,
+    0x1a, 0x02, 0x0c, 0x31, 0x0f, 0x09, 0x0c, 0x24, 0x0b, 0x0a, 0xf0, 0x0e,
+    0x08, 0x0c, 0x07, 0x0a, 0x06, 0x2b, 0x07, 0x13, 0x0d, 0x12, 0x0e, 0x0f,
+    0x15, 0x2e, 0x16, 0x1c, 0x04, 0x03, 0x0b, 0x02, 0x08, 0x24, 0xf0, 0x1a,
+    0x0b, 0x19, 0x0a, 0x19, 0x07, 0x04, 0x18, 0x13, 0x09, 0x24, 0x0a, 0x49,
+    0x0a, 0x07, 0x16, 0x2a, 0x05, 0xf0, 0x06, 0x04, 0x09, 0x05, 0x0b, 0x14,
+    0x0c, 0x0b, 0x08, 0x4a, 0x05, 0x08, 0x0d, 0x08, 0x0f, 0x1b, 0x0d, 0x0c,
+    0x0c, 0x0f, 0x0b, 0x08, 0x1a, 0x0a, 0xf0, 0x08, 0x09, 0x04, 0x0a, 0x06,
+    0x0d, 0x07, 0x1c, 0x44, 0x0a, 0x09, 0x08, 0x07, 0x03, 0x08, 0x02, 0x0a,
+    0x04, 0x08, 0x22, 0x07, 0x16, 0x11, 0xf0, 0x27, 0x00, 0x11, 0x06, 0x14,
+    0x00, 0x11, 0x25, 0x02, 0x14, 0x07, 0x08, 0x07, 0x09, 0x0b, 0x1a, 0x08,
+    0x35, 0x0b, 0x0a, 0x20, 0x0b, 0x0a, 0x08, 0x0b, 0x0e, 0xf1, 0x18, 0x2f,
+    0x19, 0x1c, 0x48, 0x08, 0x06, 0x15, 0x09, 0x13, 0x0a, 0x29, 0x15, 0x07,
+    0x2a, 0x0a, 0x0c, 0x11, 0x08, 0x09, 0x07, 0xf0, 0x0e, 0x08, 0x0c, 0x07,
+    0x3a, 0x04, 0x0a, 0x0f, 0x08, 0x3b, 0x0a, 0x06, 0x33, 0x0e, 0x2f, 0x06,
+    0x0e, 0x0e, 0x0a, 0x0b, 0x05, 0xf0, 0x0a, 0x0d, 0x1b, 0x0b, 0x09, 0x0c,
+    0x0c, 0x1d, 0x0b, 0x06, 0x0c, 0x04, 0x19, 0x03, 0x22, 0x18, 0x0a, 0x03,
+    0x08, 0x02, 0x0a, 0x03, 0x09, 0x12, 0x0c, 0xf0, 0x0b, 0x03, 0x0d, 0x04,
+    0x0a, 0x03, 0x0c, 0x05, 0x0d, 0x17, 0x0b, 0x3a, 0x0b, 0x16, 0x04, 0x1c,
+    0x15, 0x0a, 0x03, 0x0d, 0x06, 0x2b, 0x14, 0xa0, 0x07, 0x0a, 0x06, 0x0b,
+    0x05, 0x0c, 0x07, 0x1d, 0x08, 0x07, 0x0b, 0x09, 0x0d, 0x0c, 0x2e, 0x0f,
+    0x0a, 0x17, 0xf1, 0x09, 0x0a, 0x14, 0x1b, 0x05, 0x0c, 0x06, 0x1e, 0x1f,
+    0x0c, 0x0c, 0x1e, 0x0f, 0x07, 0x0b, 0x15, 0x0d, 0x0c, 0x04, 0x2b, 0x08,
+    0x0f, 0x0b, 0x11, 0x0a, 0x0f, 0x09, 0x0c, 0xf0, 0x0c, 0x07, 0x0a, 0x05,
+    0x49, 0x04, 0x05, 0x03, 0x22, 0x07, 0x06, 0x01, 0x17, 0x02, 0x04, 0x06,
+    0x12, 0x07, 0x08, 0x01, 0x0b, 0x10, 0x0d, 0xf0, 0x08, 0x01, 0x29, 0x13,
+    0x05, 0x1d, 0x0c, 0x0a, 0x1c, 0x08, 0x06, 0x0b, 0x04, 0x0c, 0x03, 0x0b,
+    0x04, 0x09, 0x05, 0x08, 0x06, 0x17, 0x14, 0x28, 0x06, 0x60, 0x03, 0x05,
+    0x09, 0x07, 0x0a, 0x05, 0x0d, 0x08, 0x0e, 0x0a, 0x0f, 0x08, 0xa1, 0x0c,
+    0x0f, 0x0d, 0x0b, 0x0e, 0x0f, 0x0f, 0x0d, 0x1e, 0x05, 0x07, 0x0d, 0x06,
+    0x2c, 0x15, 0x06, 0x0a, 0x07, 0xf0, 0x1f, 0x15, 0x0e, 0x04, 0x0c, 0x05,
+    0x0b, 0x04, 0x0a, 0x15, 0x0b, 0x0c, 0x03, 0x0e, 0x06, 0x0b, 0x04, 0x0c,
+    0x32, 0x0e, 0x0b, 0x0c, 0x0d, 0x13, 0x0b, 0xf0, 0x0a, 0x04, 0x09, 0x02,
+    0x1b, 0x03, 0x02, 0x1c, 0x01, 0x04, 0x0a, 0x13, 0x09, 0x0a, 0x06, 0x09,
+    0x04, 0x0a, 0x03, 0x1c, 0x08, 0x06, 0x2d, 0x08, 0x0d, 0x0b, 0x90, 0x1c,
+    0x09, 0x08, 0x1d, 0x06, 0x05, 0x1b, 0x13, 0x2d, 0x05, 0x06, 0x0d, 0x0e,
+    0x08, 0xf1, 0x09, 0x0e, 0x0a, 0x2f, 0x0c, 0x0e, 0x0d, 0x0e, 0x0e, 0x08,
+    0x0c, 0x06, 0x0e, 0x07, 0x1b, 0x05, 0x08, 0x0c, 0x05, 0x1e, 0x04, 0x06,
+    0x0d, 0x23, 0x0b, 0x0d, 0x81, 0x0c, 0x02, 0x1d, 0x03, 0x22, 0x0f, 0x0c,
+    0x0a, 0x11, 0x09, 0x08, 0x00, 0x07, 0x11, 0xb0, 0x1a, 0x00, 0x0c, 0x31,
+    0x0f, 0x0d, 0x0a, 0x07, 0x20, 0x09, 0x0b, 0x0c, 0x11, 0x0a, 0x0e, 0x40,
+    0x91, 0x08, 0x39, 0x01, 0x0a, 0x02, 0x0b, 0x04, 0x1e, 0x18, 0x0f, 0x1f,
+    0x42, 0x1d, 0x09, 0x0b, 0x08, 0x0a, 0x0f, 0x09, 0x09, 0xf1, 0x0d, 0x08,
+    0x0c, 0x09, 0x1b, 0x06, 0x07, 0x0c, 0x06, 0x0e, 0x05, 0x0d, 0x06, 0x0e,
+    0x08, 0x7f, 0x0c, 0x19, 0x0d, 0x0f, 0x0d, 0x0c, 0x08, 0x91, 0x0e, 0x17,
+    0x0d, 0x0c, 0x05, 0x0a, 0x08, 0x29, 0x05, 0x04, 0x03, 0x18, 0x11, 0x07,
+    0x53, 0xf0, 0x0b, 0x1a, 0x08, 0x09, 0x0a, 0x02, 0x0b, 0x05, 0x0c, 0x24,
+    0x0d, 0x0b, 0x1d, 0x03, 0x02, 0x0e, 0x13, 0x0c, 0x0d, 0x02, 0x1a, 0x03,
+    0xf0, 0x32, 0x0b, 0x08, 0x07, 0x08, 0x11, 0x1a, 0x23, 0x08, 0x0a, 0x0d,
+    0x06, 0x1a, 0x04, 0x06, 0x0b, 0x08, 0x1a, 0x05, 0x0f, 0x0d, 0x07, 0xc0,
+    0x0b, 0x05, 0x0d, 0x07, 0x0e, 0x04, 0x0d, 0x03, 0x0a, 0x25, 0x1b, 0x0a,
+    0x09, 0x0b, 0x06, 0x1c, 0x09, 0x0b, 0x0e, 0x19, 0x0f, 0x01, 0x0e, 0x0e,
+    0xf2, 0x0b, 0x0f, 0x1c, 0x0a, 0x2d, 0x1d, 0x1e, 0x07, 0x0a, 0x3d, 0x0e,
+    0x06, 0x0b, 0x05, 0x0e, 0x12, 0x0d, 0x09, 0x11, 0x0a, 0x0b, 0x22, 0x02,
+    0x0c, 0x51, 0x0e, 0x0f, 0x01, 0x0c, 0x20, 0x1a, 0x09, 0x02, 0xf0, 0x0d,
+    0x03, 0x2a, 0x04, 0x03, 0x11, 0x1b, 0x10, 0x0a, 0x07, 0x21, 0x19, 0x0b,
+    0x02, 0x0a, 0x04, 0x09, 0x03, 0x1a, 0x04, 0x05, 0x1c, 0x04, 0xe0, 0x06,
+    0x1e, 0x07, 0x08, 0x1d, 0x14, 0x0e, 0x06, 0x0c, 0x04, 0x1d, 0x06, 0x07,
+    0x0b, 0x06, 0x1a, 0x05, 0x07, 0x0b, 0x0e, 0x0d, 0x06, 0x0e, 0x07, 0x51,
+    0x0b, 0x0d, 0x0c, 0x05, 0x1b, 0x08, 0x0e, 0x0d, 0x07, 0x0e, 0x09, 0xc2,
+    0x0a, 0x1d, 0x0c, 0x0b, 0x19, 0x1a, 0x07, 0x19, 0x03, 0x12, 0x08, 0x09,
+    0x01, 0x07, 0x00, 0x09, 0x31, 0x0b, 0x08, 0x51, 0x0a, 0x1c, 0x30, 0x08,
+    0x09, 0x08, 0x01, 0xf0, 0x0f, 0x00, 0x0e, 0x11, 0x0c, 0x0a, 0x00, 0x09,
+    0x61, 0x07, 0x06, 0x07, 0x16, 0x48, 0x02, 0x04, 0x05, 0x06, 0x09, 0x07,
+    0x60, 0x28, 0x08, 0x06, 0x07, 0x19, 0x09, 0x05, 0x0a, 0x07, 0x0e, 0x06,
+    0x21, 0x09, 0x17, 0x0c, 0x0e, 0x06, 0x02, 0x0c, 0x0f, 0x13, 0x0a, 0x07,
+    0x19, 0x06, 0xe4, 0x0f, 0x0a, 0x06, 0x1b, 0x15, 0x1d, 0x03, 0x04, 0x0e,
+    0x05, 0x0c, 0x07, 0x1b, 0x08, 0x07, 0x0c, 0x0f, 0x1d, 0x05, 0x04, 0x0c,
+    0x03, 0x29, 0x01, 0x03, 0x22, 0x02, 0x31, 0x0a, 0x09, 0x23, 0x08, 0x07,
+    0xf0, 0x0a, 0x02, 0x09, 0x10, 0x0e, 0x1f, 0x11, 0x0e, 0x14, 0x0c, 0x0b,
+    0x12, 0x0e, 0x09, 0x01, 0x17, 0x12, 0x06, 0x01, 0x19, 0x03, 0x14, 0x08,
+    0xd0, 0x09, 0x0a, 0x0a, 0x06, 0x0b, 0x07, 0x0d, 0x0b, 0x1b, 0x06, 0x0e,
+    0x0a, 0x06, 0x09, 0x05, 0x0a, 0x08, 0x09, 0x05, 0x0a, 0x0d, 0x1b, 0x09,
+    0x06, 0x0e, 0x08, 0x41, 0x39, 0x09, 0x0c, 0x07, 0x0a, 0x0b, 0x0f, 0x02,
+    0x09, 0x2a, 0xf1, 0x2d, 0x05, 0x2e, 0x04, 0x05, 0x14, 0x0c, 0x0d, 0x0b,
+    0x0e, 0x08, 0x0b, 0x07, 0x2c, 0x1a, 0x09, 0x3d, 0x05, 0x18, 0x21, 0x05,
+    0x0b, 0x07, 0x0a, 0x06, 0xf0, 0x0f, 0x04, 0x0e, 0x03, 0x0b, 0x02, 0x0d,
+    0x03, 0x0c, 0x02, 0x2d, 0x03, 0x05, 0x03, 0x0a, 0x04, 0x09, 0x22, 0x07,
+    0x06, 0x08, 0x01, 0x09, 0x02, 0x07, 0x21, 0x08, 0xf0, 0x0a, 0x09, 0x02,
+    0x08, 0x01, 0x0b, 0x00, 0x0c, 0x21, 0x0b, 0x08, 0x17, 0x22, 0x06, 0x07,
+    0x31, 0x08, 0x07, 0x16, 0x22, 0x07, 0x70, 0x08, 0x09, 0x15, 0x0b, 0x0c,
+    0x04, 0x1b, 0x05, 0x07, 0x0e, 0x0f, 0x0f, 0x07, 0xc1, 0x0b, 0x0d, 0x0c,
+    0x0b, 0x1d, 0x06, 0x1f, 0x5e, 0x09, 0x0f, 0x0e, 0x0f, 0x0e, 0x0d, 0x0a,
+    0x0c, 0x09, 0x0d, 0x0c, 0x32, 0x09, 0x2e, 0x2a, 0x0c, 0x81, 0x0d, 0x0f,
+    0x0c, 0x0b, 0x0a, 0x16, 0x19, 0x05, 0x18, 0x02, 0x01, 0x0a, 0x10, 0x08,
+    0xf0, 0x0e, 0x31, 0x0b, 0x0a, 0x0b, 0x0f, 0x20, 0x0e, 0x09, 0x0c, 0x01,
+    0x18, 0x12, 0x09, 0x04, 0x08, 0x13, 0x09, 0x0b, 0x05, 0x1a, 0x04, 0x05,
+    0xe0, 0x0b, 0x07, 0x1a, 0x25, 0x0b, 0x0d, 0x03, 0x0b, 0x04, 0x1a, 0x06,
+    0x07, 0x1d, 0x0e, 0x0d, 0x1c, 0x0a, 0x07, 0x0d, 0x08, 0x0e, 0x07, 0x0f,
+    0x09, 0x01, 0x0d, 0x0e, 0x42, 0x0a, 0x0c, 0x0b, 0x0f, 0x0d, 0x0e, 0x0c,
+    0x19, 0x0a, 0x91, 0x0c, 0x15, 0x0a, 0x0c, 0x08, 0x1b, 0x07, 0x09, 0x19,
+    0x0f, 0x0b, 0x28, 0x08, 0x0c, 0x08, 0xf0, 0x1c, 0x07, 0x0a, 0x0b, 0x05,
+    0x0a, 0x06, 0x49, 0x07, 0x04, 0x05, 0x04, 0x07, 0x1a, 0x08, 0x05, 0x09,
+    0x06, 0x08, 0x03, 0x07, 0x11, 0x08, 0x07, 0x10, 0xf0, 0x0b, 0x07, 0x21,
+    0x06, 0x17, 0x00, 0x09, 0x01, 0x0b, 0x12, 0x09, 0x0a, 0x04, 0x09, 0x03,
+    0x0a, 0x02, 0x18, 0x21, 0x0b, 0x09, 0x02, 0x0a, 0x05, 0xc0, 0x2c, 0x06,
+    0x08, 0x07, 0x0b, 0x08, 0x1a, 0x05, 0x03, 0x2b, 0x05, 0x16, 0x0c, 0x08,
+    0x1d, 0x0a, 0x09, 0x0f, 0x06, 0x21, 0x0c, 0x0f, 0x0d, 0x08, 0x0e, 0x06,
+    0xd2, 0x0b, 0x0d, 0x0c, 0x07, 0x0d, 0x0a, 0x1c, 0x07, 0x08, 0x0e, 0x05,
+    0x0d, 0x0a, 0x0e, 0x0f, 0x1d, 0x08, 0x09, 0x0e, 0x06, 0x0c, 0x05, 0x0b,
+    0x06, 0x09, 0x07, 0xa1, 0x1b, 0x05, 0x06, 0x0a, 0x03, 0x0b, 0x14, 0x0e,
+    0x2d, 0x12, 0x31, 0x0e, 0x0a, 0x08, 0xf0, 0x0b, 0x02, 0x18, 0x05, 0x04,
+    0x0a, 0x05, 0x0b, 0x0d, 0x0c, 0x08, 0x1d, 0x0e, 0x0b, 0x1c, 0x08, 0x05,
+    0x2b, 0x13, 0x42, 0x0c, 0x0e, 0x0d, 0xb0, 0x1a, 0x03, 0x0c, 0x05, 0x0b,
+    0x06, 0x1a, 0x07, 0x06, 0x0b, 0x05, 0x0d, 0x03, 0x1c, 0x05, 0x0b, 0x1b,
+    0x06, 0x0c, 0x11, 0x19, 0x0f, 0x07, 0xf0, 0x1b, 0x06, 0x05, 0x09, 0x03,
+    0x0a, 0x04, 0x0b, 0x08, 0x0c, 0x29, 0x0d, 0x0e, 0x0d, 0x06, 0x0b, 0x04,
+    0x0c, 0x13, 0x0b, 0x0a, 0x04, 0x09, 0x07, 0x0b, 0x06, 0x0a, 0x05, 0xf0,
+    0x0b, 0x0f, 0x0a, 0x18, 0x09, 0x1a, 0x0e, 0x07, 0x68, 0x16, 0x23, 0x12,
+    0x09, 0x61, 0x0b, 0x0c, 0x0d, 0xf0, 0x0b, 0x0e, 0x0d, 0x1e, 0x10, 0x0f,
+    0x11, 0x0e, 0x0a, 0x32, 0x0b, 0x0a, 0x18, 0x11, 0x0c, 0x0e, 0x00, 0x0f,
+    0x21, 0x0e, 0x10, 0x1f, 0x12, 0x31, 0x0a, 0x1d, 0x14, 0x0e, 0x43, 0x02,
+    0x09, 0x03, 0x06, 0x04, 0x05, 0x06, 0x04, 0x08, 0x63, 0x05, 0x09, 0x06,
+    0x0a, 0x07, 0x0c, 0x0f, 0x0d, 0x19, 0x0b, 0x09, 0x0b, 0x0e, 0xa2, 0x05,
+    0x0d, 0x06, 0x1b, 0x05, 0x16, 0x1e, 0x05, 0x0c, 0x06, 0x0e, 0x23, 0x0c,
+    0x0a, 0x09, 0x01, 0x0f, 0xf1, 0x22, 0x0d, 0x0f, 0x0c, 0x03, 0x19, 0x02,
+    0x03, 0x07, 0x02, 0x08, 0x01, 0x0b, 0x12, 0x08, 0x09, 0x04, 0x08, 0x17,
+    0x07, 0x18, 0x08, 0x05, 0x19, 0x33, 0xf1, 0x0a, 0x09, 0x0b, 0x14, 0x1c,
+    0x03, 0x0b, 0x14, 0x09, 0x18, 0x33, 0x0b, 0x1a, 0x04, 0x0b, 0x05, 0x0a,
+    0x04, 0x0d, 0x16, 0x0e, 0xf1, 0x1c, 0x05, 0x24, 0x0e, 0x0c, 0x0e, 0x07,
+    0x0d, 0x08, 0x0c, 0x37, 0x2b, 0x1a, 0x14, 0x09, 0x13, 0x08, 0x09, 0x05,
+    0x1c, 0x81, 0x06, 0x05, 0x1d, 0x0d, 0x09, 0x0b, 0x05, 0x0a, 0x17, 0x19,
+    0x06, 0x08, 0x05, 0x0e, 0xf0, 0x04, 0x0d, 0x05, 0x0e, 0x06, 0x0b, 0x05,
+    0x2e, 0x06, 0x14, 0x0c, 0x05, 0x0e, 0x06, 0x1c, 0x15, 0x0e, 0x06, 0x0c,
+    0x04, 0x09, 0x33, 0x08, 0x0b, 0x0a, 0xf0, 0x0b, 0x05, 0x0c, 0x24, 0x0e,
+    0x0b, 0x0a, 0x12, 0x0b, 0x0e, 0x01, 0x0d, 0x02, 0x0a, 0x03, 0x09, 0x02,
+    0x08, 0x03, 0x17, 0x02, 0x11, 0x18, 0x12, 0x07, 0xf0, 0x09, 0x11, 0x0a,
+    0x19, 0x02, 0x01, 0x0b, 0x02, 0x0e, 0x03, 0x1f, 0x04, 0x07, 0x0d, 0x04,
+    0x0c, 0x05, 0x1a, 0x13, 0x0e, 0x04, 0x0a, 0x02, 0x1e, 0x04, 0xf0, 0x05,
+    0x0b, 0x07, 0x2d, 0x08, 0x05, 0x0a, 0x1c, 0x0c, 0x0b, 0x0d, 0x08, 0x1c,
+    0x07, 0x0c, 0x0b, 0x04, 0x0a, 0x05, 0x0b, 0x08, 0x0a, 0x03, 0x08, 0x15,
+    0x19, 0x70, 0x03, 0x0a, 0x14, 0x1e, 0x03, 0x0b, 0x02, 0x1d, 0x13, 0x0f,
+    0x02, 0x08, 0xf1, 0x23, 0x17, 0x06, 0x32, 0x07, 0x08, 0x07, 0x09, 0x03,
+    0x08, 0x02, 0x19, 0x03, 0x12, 0x0d, 0x0e, 0x03, 0x0d, 0x04, 0x1c, 0x07,
+    0x06, 0x0d, 0x31, 0x0b, 0x0e, 0x0a, 0x0d, 0x05, 0x0e, 0x0e, 0x08, 0xf2,
+    0x07, 0x09, 0x08, 0x0a, 0x09, 0x0c, 0x08, 0x0e, 0x0f, 0x0f, 0x07, 0x0d,
+    0x06, 0x0e, 0x07, 0x2d, 0x06, 0x09, 0x07, 0x0c, 0x45, 0x0b, 0x0a, 0x19,
+    0x18, 0x42, 0x18, 0x07, 0x04, 0x16, 0x05, 0x06, 0x1b, 0x61, 0x23, 0x0a,
+    0x1c, 0x02, 0x31, 0x0a, 0x08, 0x0b, 0xf0, 0x18, 0x02, 0x51, 0x09, 0x07,
+    0x0b, 0x0a, 0x08, 0x27, 0x12, 0x03, 0x26, 0x05, 0x04, 0x07, 0x17, 0x06,
+    0x04, 0x18, 0xf0, 0x07, 0x04, 0x0a, 0x05, 0x09, 0x16, 0x0a, 0x0c, 0x0a,
+    0x1d, 0x09, 0x0e, 0x0e, 0x09, 0x0c, 0x05, 0x0a, 0x14, 0x0d, 0x0b, 0x05,
+    0x1a, 0x06, 0x04, 0x0c, 0x08, 0x0e, 0xf0, 0x0a, 0x1c, 0x17, 0x2b, 0x04,
+    0x25, 0x0a, 0x09, 0x06, 0x0a, 0x25, 0x1c, 0x0b, 0x14, 0x0a, 0x0b, 0x03,
+    0x0e, 0x05, 0x2a, 0x06, 0xf0, 0x04, 0x16, 0x1d, 0x34, 0x0b, 0x0e, 0x0d,
+    0x1a, 0x15, 0x08, 0x03, 0x19, 0x04, 0x05, 0x3a, 0x16, 0x07, 0x09, 0x1c,
+    0xf0, 0x08, 0x0b, 0x1d, 0x0a, 0x1c, 0x0e, 0x1c, 0x07, 0x08, 0x0b, 0x09,
+    0x0a, 0x07, 0x1b, 0x08, 0x07, 0x0c, 0x1b, 0x1d, 0x0e, 0x0e, 0x0f, 0x0c,
+    0x05, 0x0d, 0xf0, 0x03, 0x1f, 0x02, 0x13, 0x0c, 0x09, 0x05, 0x2b, 0x17,
+    0x0b, 0x1a, 0x09, 0x0a, 0x0b, 0x0f, 0x1c, 0x0a, 0x09, 0x0e, 0x08, 0x0d,
+    0x07, 0x0c, 0x06, 0x0e, 0xf0, 0x07, 0x0b, 0x18, 0x0a, 0x0c, 0x0f, 0x0b,
+    0x0c, 0x0a, 0x0d, 0x29, 0x0b, 0x3d, 0x48, 0x0a, 0x0e, 0x07, 0x39, 0x08,
+    0x0c, 0xf0, 0x06, 0x15, 0x0a, 0x19, 0x03, 0x42, 0x0a, 0x1d, 0x09, 0x0b,
+    0x33, 0x0a, 0x0c, 0x0a, 0x18, 0x12, 0x09, 0x23, 0x0d, 0xf0, 0x0b, 0x09,
+    0x04, 0x0a, 0x13, 0x19, 0x05, 0x2a, 0x06, 0x14, 0x0c, 0x03, 0x0e, 0x22,
+    0x0b, 0x0e, 0x0f, 0x03, 0x0e, 0x04, 0x0a, 0x03, 0x0c, 0xf0, 0x74, 0x29,
+    0x08, 0x27, 0x18, 0x25, 0x27, 0x06, 0x03, 0x08, 0x14, 0x1c, 0x03, 0x0e,
+    0xf0, 0x05, 0x0a, 0x03, 0x0b, 0x02, 0x0e, 0x13, 0x0a, 0x0c, 0x05, 0x0a,
+    0x16, 0x1b, 0x0a, 0x0c, 0x07, 0x1d, 0x13, 0x0e, 0x02, 0x0b, 0x01, 0x0d,
+    0x12, 0x0c, 0x2a, 0xf0, 0x04, 0x08, 0x06, 0x0c, 0x07, 0x1b, 0x06, 0x05,
+    0x1c, 0x09, 0x0b, 0x1b, 0x0a, 0x0f, 0x0d, 0x0b, 0x1e, 0x16, 0x0c, 0x29,
+    0x2d, 0x30, 0x0f, 0x2f, 0x0a, 0x08, 0x0c, 0x17, 0xf1, 0x0f, 0x0b, 0x08,
+    0x0e, 0x09, 0x0b, 0x0b, 0x1d, 0x2c, 0x0c, 0x0e, 0x0b, 0x07, 0x0a, 0x06,
+    0x29, 0x04, 0x05, 0x06, 0x1a, 0x07, 0x09, 0x09, 0x08, 0x1b, 0x61, 0x0e,
+    0x0a, 0x1a, 0x0c, 0x0d, 0x19, 0x0e, 0x0f, 0x0a, 0x0b, 0x3f, 0xf0, 0x0c,
+    0x0a, 0x0c, 0x08, 0x1e, 0x0b, 0x0e, 0x0b, 0x0a, 0x1a, 0x0b, 0x09, 0x29,
+    0x06, 0x53, 0x1c, 0x0b, 0x2a, 0xf0, 0x02, 0x03, 0x08, 0x02, 0x0b, 0x03,
+    0x1c, 0x05, 0x04, 0x1d, 0x03, 0x12, 0x0c, 0x08, 0x01, 0x0b, 0x02, 0x08,
+    0x24, 0x16, 0x07, 0x06, 0x16, 0x05, 0xf0, 0x04, 0x07, 0x03, 0x18, 0x12,
+    0x0b, 0x03, 0x19, 0x02, 0x04, 0x0b, 0x15, 0x0d, 0x0c, 0x07, 0x0a, 0x05,
+    0x0b, 0x04, 0x0e, 0x07, 0x0d, 0x06, 0x0a, 0x14, 0x0c, 0x1a, 0xf0, 0x13,
+    0x08, 0x02, 0x09, 0x24, 0x1b, 0x1c, 0x16, 0x0b, 0x15, 0x1a, 0x04, 0x0d,
+    0x23, 0x0e, 0x0c, 0x0e, 0x14, 0x09, 0x2a, 0xf0, 0x06, 0x05, 0x04, 0x0c,
+    0x07, 0x4a, 0x09, 0x08, 0x07, 0x09, 0x05, 0x09, 0x04, 0x0a, 0x05, 0x1b,
+    0x03, 0x15, 0x09, 0x18, 0x13, 0x09, 0xf0, 0x04, 0x0a, 0x06, 0x0c, 0x0b,
+    0x0d, 0x0f, 0x0e, 0x0c, 0x1d, 0x07, 0x08, 0x0e, 0x17, 0x1b, 0x0e, 0x1a,
+    0x08, 0x0a, 0x2b, 0x0d, 0x06, 0x05, 0x0e, 0x26, 0x0d, 0xf0, 0x1b, 0x05,
+    0x0c, 0x06, 0x1d, 0x15, 0x0b, 0x07, 0x0c, 0x08, 0x0b, 0x16, 0x0c, 0x1a,
+    0x17, 0x09, 0x36, 0x08, 0x19, 0x4b, 0xe0, 0x07, 0x05, 0x06, 0x15, 0x0a,
+    0x04, 0x1d, 0x05, 0x0e, 0x0e, 0x0a, 0x0c, 0x17, 0x3b, 0x0b, 0x07, 0x05,
+    0x0f, 0x1d, 0x09, 0x31, 0x0a, 0x1f, 0x19, 0x08, 0x1f, 0xf0, 0x05, 0x04,
+    0x0c, 0x22, 0x0b, 0x17, 0x11, 0x08, 0x0d, 0x52, 0x0e, 0x0a, 0x0b, 0x0c,
+    0x0a, 0x0d, 0x03, 0x1b, 0x22, 0x09, 0xf0, 0x18, 0x11, 0x19, 0x12, 0x0c,
+    0x03, 0x0e, 0x16, 0x0c, 0x0d, 0x08, 0x0e, 0x0b, 0x0c, 0x07, 0x5b, 0x08,
+    0x47, 0xf0, 0x0d, 0x08, 0x0c, 0x0f, 0x0f, 0x09, 0x1c, 0x08, 0x15, 0x0d,
+    0x1b, 0x07, 0x06, 0x1a, 0x08, 0x0a, 0x2c, 0x0c, 0x17, 0x0b, 0x18, 0x0a,
+    0x09, 0xf0, 0x06, 0x2a, 0x18, 0x35, 0x1b, 0x0a, 0x09, 0x06, 0x08, 0x08,
+    0x09, 0x06, 0x0a, 0x05, 0x0b, 0x06, 0x0d, 0x14, 0x0e, 0x0b, 0x15, 0x0c,
+    0x0b, 0xf0, 0x04, 0x0d, 0x06, 0x1c, 0x07, 0x04, 0x0e, 0x08, 0x1c, 0x0d,
+    0x08, 0x2d, 0x1c, 0x0b, 0x0e, 0x0c, 0x0d, 0x1f, 0x0c, 0x3b, 0x0e, 0x08,
+    0x05, 0xf0, 0x16, 0x3a, 0x18, 0x0a, 0x1b, 0x0f, 0x0b, 0x2a, 0x1d, 0x27,
+    0x0b, 0x0c, 0x0d, 0x04, 0x0e, 0x03, 0x1f, 0x04, 0x03, 0x1e, 0xf0, 0x04,
+    0x25, 0x0d, 0x1c, 0x03, 0x1e, 0x05, 0x14, 0x0b, 0x0c, 0x05, 0x0a, 0x03,
+    0x09, 0x24, 0x08, 0x1a, 0x05, 0x1c, 0x06, 0x08, 0x1e, 0xf0, 0x05, 0x03,
+    0x0f, 0x04, 0x0e, 0x32, 0x0c, 0x0b, 0x0a, 0x08, 0x13, 0x07, 0x36, 0x14,
+    0x05, 0x09, 0x07, 0x15, 0x18, 0x04, 0x1a, 0xe0, 0x23, 0x2c, 0x24, 0x0d,
+    0x2f, 0x03, 0x02, 0x03, 0x1e, 0x02, 0x03, 0x1d, 0x04, 0x33, 0x0c, 0x0f,
+    0x08, 0xf1, 0x0b, 0x05, 0x0c, 0x09, 0x1d, 0x1f, 0x1c, 0x0e, 0x07, 0x1a,
+    0x04, 0x03, 0x0d, 0x04, 0x0a, 0x16, 0x0c, 0x0a, 0x0a, 0x0c, 0x0f, 0x1b,
+    0x09, 0x0a, 0x09, 0x21, 0x05, 0x18, 0x04, 0x13, 0x0f, 0xf0, 0x0e, 0x04,
+    0x0d, 0x03, 0x0b, 0x04, 0x0d, 0x05, 0x1a, 0x03, 0x14, 0x1b, 0x05, 0x0c,
+    0x07, 0x1b, 0x06, 0x04, 0x0a, 0x13, 0x0b, 0x0c, 0x02, 0x0d, 0x03, 0x0a,
+    0xf0, 0x04, 0x0c, 0x25, 0x1b, 0x19, 0x04, 0x03, 0x08, 0x04, 0x09, 0x06,
+    0x08, 0x05, 0x0a, 0x0b, 0x0b, 0x0a, 0x4a, 0x05, 0x06, 0x14, 0x15, 0x0d,
+    0xf0, 0x0c, 0x16, 0x1b, 0x04, 0x0e, 0x03, 0x0c, 0x04, 0x0d, 0x05, 0x0b,
+    0x07, 0x1d, 0x1a, 0x0b, 0x06, 0x0a, 0x04, 0x09, 0x15, 0x0d, 0x0c, 0x07,
+    0x7e, 0x3f, 0xf0, 0x08, 0x04, 0x03, 0x04, 0x09, 0x03, 0x0b, 0x04, 0x09,
+    0x05, 0x18, 0x06, 0x0a, 0x57, 0x08, 0x0a, 0x0c, 0x06, 0xf0, 0x07, 0x06,
+    0x26, 0x04, 0x05, 0x04, 0x07, 0x25, 0x19, 0x0a, 0x06, 0x09, 0x23, 0x0b,
+    0x0d, 0x0c, 0x02, 0x1e, 0x03, 0x04, 0x0c, 0x02, 0x0f, 0xb0, 0x13, 0x0d,
+    0x0e, 0x22, 0x0a, 0x08, 0x0a, 0x13, 0x08, 0x0b, 0x15, 0x0c, 0x1b, 0x24,
+    0x0d, 0x17, 0x61, 0x15, 0x19, 0x06, 0x07, 0x0b, 0x05, 0x0d, 0x04, 0x0f,
+    0x03, 0x19, 0xb2, 0x04, 0x06, 0x1a, 0x08, 0x0f, 0x0b, 0x06, 0x0c, 0x07,
+    0x0d, 0x05, 0x0c, 0x02, 0x1d, 0x13, 0x1a, 0x22, 0x0f, 0xf1, 0x0d, 0x23,
+    0x3a, 0x05, 0x26, 0x09, 0x18, 0x24, 0x29, 0x03, 0x08, 0x04, 0x0b, 0x03,
+    0x0c, 0x12, 0x0d, 0x0a, 0xf1, 0x01, 0x0b, 0x30, 0x0f, 0x1e, 0x0a, 0x31,
+    0x08, 0x09, 0x07, 0x0a, 0x12, 0x09, 0x0d, 0x03, 0x0c, 0x24, 0x0e, 0x0b,
+    0x09, 0x45, 0x1a, 0xf1, 0x1d, 0x0b, 0x06, 0x0c, 0x17, 0x1b, 0x0a, 0x1d,
+    0x06, 0x05, 0x0c, 0x07, 0x0d, 0x14, 0x0b, 0x0c, 0x07, 0x0b, 0x06, 0x0d,
+    0x07, 0x0c, 0xf1, 0x06, 0x0d, 0x14, 0x0e, 0x0d, 0x35, 0x0c, 0x1d, 0x0b,
+    0x04, 0x0a, 0x03, 0x08, 0xc2, 0x0a, 0x38, 0x0b, 0x0a, 0xf1, 0x0b, 0x0a,
+    0x08, 0x09, 0x1c, 0x03, 0x0a, 0x04, 0x0c, 0x05, 0x0a, 0x14, 0x1d, 0x02,
+    0x0f, 0x11, 0x0d, 0x1c, 0x00, 0x11, 0x09, 0xf1, 0x0a, 0x00, 0x0e, 0x11,
+    0x0c, 0x0a, 0x40, 0x0c, 0x09, 0x0c, 0x0d, 0x1f, 0x21, 0x0e, 0x0d, 0x02,
+    0x3a, 0x11, 0x03, 0xf1, 0x14, 0x09, 0x0a, 0x05, 0x09, 0x04, 0x0a, 0x05,
+    0x19, 0x04, 0x03, 0x0a, 0x45, 0x0b, 0x0a, 0x09, 0x1a, 0x14, 0x0d, 0x0c,
+    0x15, 0x0a, 0x0d, 0xf1, 0x16, 0x0b, 0x0e, 0x0c, 0x0d, 0x0a, 0x1e, 0x0e,
+    0x09, 0x0c, 0x27, 0x0b, 0x0c, 0x0b, 0x05, 0x0c, 0x16, 0x1b, 0x14, 0x0c,
+    0x0b, 0x23, 0x0c, 0x0a, 0x01, 0x0f, 0xf0, 0x02, 0x0d, 0x23, 0x0c, 0x0e,
+    0x0c, 0x06, 0x0b, 0x04, 0x0c, 0x05, 0x0a, 0x04, 0x09, 0x03, 0x0b, 0x04,
+    0x0a, 0x32, 0x0c, 0x0e, 0x0f, 0x0e, 0x23, 0x0d, 0x0a, 0xf0, 0x0d, 0x04,
+    0x1a, 0x25, 0x0b, 0x0c, 0x0c, 0x0e, 0x17, 0x0d, 0x0c, 0x08, 0x2b, 0x05,
+    0x16, 0x0d, 0x09, 0x0c, 0x0d, 0x1f, 0x0f, 0x0c, 0x3d, 0xf0, 0x0d, 0x0e,
+    0x0d, 0x2f, 0x1e, 0x2f, 0x08, 0x0c, 0x08, 0x0e, 0x07, 0x0c, 0x0a, 0x0d,
+    0x08, 0x0b, 0x06, 0x0c, 0x05, 0x0d, 0x04, 0x19, 0x13, 0xf0, 0x0b, 0x04,
+    0x0a, 0x05, 0x09, 0x04, 0x0b, 0x05, 0x1a, 0x04, 0x13, 0x0b, 0x09, 0x02,
+    0x0b, 0x33, 0x09, 0x18, 0x0a, 0x12, 0x19, 0x11, 0x0c, 0xf0, 0x1a, 0x02,
+    0x03, 0x09, 0x04, 0x38, 0x13, 0x02, 0x01, 0x0b, 0x12, 0x08, 0x29, 0x03,
+    0x06, 0x05, 0x0a, 0x04, 0x0c, 0x05, 0x0b, 0x04, 0x0d, 0x80, 0x15, 0x0b,
+    0x0a, 0x06, 0x0c, 0x07, 0x0d, 0x06, 0x1b, 0x19, 0x1a, 0x06, 0x09, 0x06,
+    0xf1, 0x2e, 0x07, 0x08, 0x3a, 0x0d, 0x08, 0x26, 0x1b, 0x08, 0x0e, 0x1f,
+    0x1f, 0x0e, 0x0e, 0x09, 0x0a, 0x07, 0x08, 0x08, 0x07, 0x07, 0x1c, 0xf0,
+    0x25, 0x0d, 0x0b, 0x23, 0x2e, 0x02, 0x0c, 0x13, 0x1b, 0x12, 0x09, 0x1a,
+    0x04, 0x05, 0x0d, 0x06, 0x1b, 0x0a, 0x0f, 0x2d, 0xf0, 0x19, 0x08, 0x0c,
+    0x15, 0x3b, 0x07, 0x0a, 0x06, 0x0e, 0x07, 0x0d, 0x06, 0x0b, 0x13, 0x2c,
+    0x14, 0x2e, 0x15, 0xf0, 0x04, 0x0d, 0x13, 0x1c, 0x05, 0x1b, 0x07, 0x09,
+    0x0c, 0x0f, 0x2e, 0x0b, 0x06, 0x05, 0x0d, 0x04, 0x0c, 0x13, 0x1e, 0x25,
+    0x0d, 0x0b, 0x0d, 0xf0, 0x07, 0x2b, 0x05, 0x14, 0x0c, 0x05, 0x0b, 0x08,
+    0x0c, 0x0c, 0x2f, 0x1f, 0x0d, 0x1e, 0x0b, 0x08, 0x0c, 0x19, 0x0b, 0x0a,
+    0x16, 0x0b, 0x0c, 0xf0, 0x05, 0x1a, 0x14, 0x0b, 0x15, 0x0a, 0x0b, 0x06,
+    0x0a, 0x04, 0x0d, 0x33, 0x0c, 0x1f, 0x0d, 0x02, 0x0c, 0x13, 0x0b, 0x19,
+    0x22, 0x1a, 0xb0, 0x31, 0x0e, 0x0d, 0x0b, 0x19, 0x02, 0x01, 0x1b, 0x50,
+    0x0c, 0x09, 0x0b, 0x07, 0xf1, 0x19, 0x11, 0x08, 0x02, 0x07, 0x13, 0x0a,
+    0x0e, 0x05, 0x0a, 0x17, 0x2b, 0x0a, 0x08, 0x0c, 0x09, 0x0d, 0x0c, 0x0e,
+    0x1f, 0x0d, 0x0e, 0x08, 0x0c, 0xf1, 0x0b, 0x0d, 0x0c, 0x0c, 0x09, 0x2d,
+    0x0c, 0x0e, 0x0a, 0x1c, 0x07, 0x06, 0x0a, 0x05, 0x09, 0x23, 0x0a, 0x0e,
+    0x0b, 0x14, 0x09, 0x0a, 0x13, 0x19, 0xf1, 0x02, 0x0b, 0x11, 0x0d, 0x0f,
+    0x42, 0x0b, 0x1e, 0x2b, 0x01, 0x22, 0x09, 0x08, 0x09, 0x33, 0x0b, 0x0d,
+    0x09, 0x08, 0xf1, 0x04, 0x09, 0x03, 0x0b, 0x04, 0x0a, 0x15, 0x0b, 0x1e,
+    0x04, 0x06, 0x0c, 0x07, 0x1d, 0x05, 0x18, 0x2c, 0x07, 0x08, 0x0d, 0x07,
+    0x0c, 0x09, 0x0d, 0x18, 0x0c, 0x61, 0x0b, 0x0d, 0x0a, 0x1e, 0x09, 0x18,
+    0x0d, 0x0f, 0x07, 0x07, 0x1d, 0xf0, 0x05, 0x04, 0x0c, 0x03, 0x0b, 0x04,
+    0x0a, 0x05, 0x0c, 0x04, 0x0e, 0x05, 0x0a, 0x06, 0x0b, 0x05, 0x0a, 0x24,
+    0x09, 0x0c, 0x0d, 0x32, 0x0e, 0x0c, 0x0e, 0x0b, 0xf0, 0x03, 0x18, 0x04,
+    0x53, 0x0b, 0x0a, 0x1e, 0x0c, 0x1e, 0x24, 0x0d, 0x2b, 0x15, 0x24, 0x1c,
+    0x0e, 0xf0, 0x07, 0x1c, 0x05, 0x14, 0x0b, 0x1e, 0x02, 0x01, 0x0f, 0x02,
+    0x1b, 0x03, 0x04, 0x0a, 0x17, 0x0b, 0x0c, 0x15, 0x0a, 0x0b, 0x03, 0x0c,
+    0x02, 0x0f, 0x03, 0x0d, 0xf0, 0x04, 0x0b, 0x05, 0x0d, 0x14, 0x0e, 0x2b,
+    0x15, 0x04, 0x0c, 0x15, 0x0b, 0x0c, 0x03, 0x1b, 0x14, 0x1a, 0x13, 0x0c,
+    0x05, 0x0a, 0x06, 0x0c, 0xf0, 0x05, 0x2d, 0x09, 0x0b, 0x18, 0x0e, 0x0d,
+    0x0f, 0x0f, 0x0b, 0x0e, 0x0e, 0x1f, 0x0f, 0x0b, 0x2e, 0x0c, 0x07, 0x09,
+    0x0c, 0x08, 0x2e, 0x0c, 0x0d, 0xf0, 0x09, 0x1d, 0x17, 0x3a, 0x06, 0x15,
+    0x06, 0x0b, 0x07, 0x0d, 0x05, 0x0c, 0x06, 0x0b, 0x0a, 0x0d, 0x05, 0x0c,
+    0x04, 0x0e, 0x06, 0x1c, 0x14, 0x1d, 0xf0, 0x16, 0x0a, 0x04, 0x0b, 0x05,
+    0x0c, 0x06, 0x0b, 0x05, 0x0d, 0x26, 0x0b, 0x0d, 0x0b, 0x15, 0x0c, 0x0a,
+    0x14, 0x39, 0x05, 0x14, 0x1a, 0xf0, 0x05, 0x04, 0x08, 0x05, 0x17, 0x04,
+    0x03, 0x28, 0x05, 0x04, 0x06, 0x09, 0x08, 0x2b, 0x07, 0x09, 0x56, 0x0c,
+    0x0a, 0x0c, 0x0b, 0x0c, 0xf0, 0x1d, 0x15, 0x0b, 0x04, 0x0a, 0x25, 0x09,
+    0x0b, 0x0a, 0x06, 0x18, 0x07, 0x05, 0x09, 0x14, 0x0b, 0x0c, 0x23, 0x0d,
+    0x0b, 0x0a, 0x04, 0x08, 0xf0, 0x13, 0x09, 0x0b, 0x24, 0x09, 0x0b, 0x0a,
+    0x13, 0x19, 0x14, 0x08, 0x07, 0x33, 0x08, 0x1a, 0x19, 0x04, 0x05, 0x07,
+    0x03, 0x08, 0xf0, 0x15, 0x09, 0x0a, 0x03, 0x1e, 0x16, 0x0c, 0x04, 0x0e,
+    0x15, 0x0b, 0x0d, 0x14, 0x0b, 0x1d, 0x06, 0x08, 0x0c, 0x19, 0x1d, 0x0f,
+    0x0c, 0x09, 0x1e, 0xf0, 0x17, 0x0c, 0x08, 0x0b, 0x09, 0x1d, 0x0d, 0x1f,
+    0x0f, 0x0e, 0x0a, 0x0d, 0x08, 0x0c, 0x07, 0x1a, 0x04, 0x05, 0x0b, 0x09,
+    0x0c, 0x18, 0x0d, 0x0e, 0x0c, 0x1c, 0xf0, 0x09, 0x06, 0x0b, 0x07, 0x0a,
+    0x08, 0x1b, 0x06, 0x08, 0x0a, 0x0f, 0x0b, 0x08, 0x0c, 0x07, 0x0d, 0x09,
+    0x0e, 0x07, 0x0c, 0x05, 0x0d, 0x06, 0x0c, 0x08, 0x0d, 0x06, 0x0e, 0x07,
+    0x1d, 0xf0, 0x09, 0x07, 0x2b, 0x25, 0x1a, 0x14, 0x0b, 0x05, 0x0a, 0x07,
+    0x09, 0x06, 0x0a, 0x05, 0x0b, 0x07, 0x0c, 0x06, 0x0e, 0x15, 0x1d, 0x06,
+    0x0e, 0xf0, 0x07, 0x0d, 0x08, 0x0c, 0x1a, 0x0e, 0x0d, 0x07, 0x2b, 0x06,
+    0x05, 0x03, 0x1a, 0x14, 0x0b, 0x03, 0x1d, 0x04, 0x15, 0x0c, 0x0b, 0x03,
+    0x1e, 0x14, 0xf0, 0x0a, 0x03, 0x09, 0x15, 0x1a, 0x04, 0x1b, 0x05, 0x06,
+    0x0c, 0x05, 0x0b, 0x74, 0x09, 0x0a, 0x18, 0x09, 0x0a, 0x09, 0x0c, 0xf0,
+    0x13, 0x2e, 0x24, 0x0a, 0x0b, 0x05, 0x0c, 0x24, 0x0d, 0x0c, 0x0a, 0x03,
+    0x0d, 0x54, 0x0b, 0x19, 0x0b, 0x0c, 0x2a, 0xf0, 0x23, 0x09, 0x22, 0x0b,
+    0x0a, 0x1e, 0x13, 0x0d, 0x04, 0x1b, 0x06, 0x07, 0x1d, 0x16, 0x0b, 0x05,
+    0x0c, 0x13, 0x0d, 0x0b, 0xf0, 0x04, 0x09, 0x05, 0x08, 0x06, 0x19, 0x45,
+    0x0b, 0x19, 0x0a, 0x04, 0x0c, 0x08, 0x0d, 0x17, 0x0b, 0x1c, 0x08, 0x07,
+    0x0d, 0x16, 0x2b, 0xf0, 0x08, 0x06, 0x2c, 0x08, 0x09, 0x06, 0x2d, 0x17,
+    0x06, 0x1c, 0x08, 0x0c, 0x0d, 0x0f, 0x0e, 0x1c, 0x1d, 0x09, 0x0e, 0x06,
+    0x1d, 0x0b, 0xf0, 0x3f, 0x0e, 0x0c, 0x0d, 0x0e, 0x0a, 0x1c, 0x06, 0x34,
+    0x0b, 0x09, 0x08, 0x37, 0x05, 0x14, 0x03, 0x08, 0x04, 0x17, 0x15, 0xf0,
+    0x08, 0x07, 0x19, 0x08, 0x15, 0x0b, 0x0e, 0x07, 0x1c, 0x05, 0x06, 0x0d,
+    0x09, 0x2b, 0x08, 0x07, 0x45, 0x0d, 0x0b, 0x09, 0x0a, 0x2c, 0xf0, 0x07,
+    0x06, 0x05, 0x1d, 0x06, 0x05, 0x1b, 0x06, 0x15, 0x0d, 0x0a, 0x24, 0x1c,
+    0x0d, 0x03, 0x0e, 0x04, 0x1d, 0x35, 0x1a, 0xf0, 0x0d, 0x54, 0x0c, 0x09,
+    0x0b, 0x0c, 0x09, 0x0a, 0x05, 0x19, 0x14, 0x0c, 0x15, 0x1e, 0x26, 0x0c,
+    0x0b, 0x1c, 0x05, 0xf0, 0x04, 0x0a, 0x33, 0x0b, 0x09, 0x1c, 0x04, 0x0b,
+    0x15, 0x0d, 0x2c, 0x09, 0x0c, 0x09, 0x0d, 0x1f, 0x0e, 0x1c, 0x08, 0x17,
+    0x1b, 0xf0, 0x04, 0x2e, 0x03, 0x04, 0x15, 0x0b, 0x0a, 0x04, 0x1b, 0x13,
+    0x08, 0x32, 0x0a, 0x09, 0x0a, 0x0c, 0x03, 0x0a, 0x04, 0x0b, 0x25, 0x0a,
+    0x0c, 0xf0, 0x0b, 0x04, 0x0d, 0x05, 0x0b, 0x16, 0x1c, 0x07, 0x0d, 0x18,
+    0x0e, 0x0d, 0x0e, 0x0e, 0x1a, 0x0d, 0x0c, 0x0b, 0x1b, 0x07, 0x06, 0x2c,
+    0x07, 0x18, 0xf0, 0x6f, 0x3f, 0x0c, 0x2f, 0x3e, 0x0b, 0x08, 0x06, 0x0c,
+    0x04, 0x0b, 0x05, 0x2c, 0x17, 0xf0, 0x0a, 0x2e, 0x0e, 0x0a, 0x07, 0x1d,
+    0x34, 0x0b, 0x0a, 0x19, 0x35, 0x0a, 0x09, 0x1a, 0x04, 0x43, 0x2b, 0xf0,
+    0x09, 0x0a, 0x24, 0x1b, 0x09, 0x15, 0x0a, 0x0b, 0x34, 0x2a, 0x0d, 0x05,
+    0x0b, 0x07, 0x0c, 0x09, 0x0b, 0x07, 0x1c, 0x09, 0xf0, 0x07, 0x0a, 0x06,
+    0x29, 0x05, 0x14, 0x08, 0x13, 0x09, 0x0a, 0x22, 0x1e, 0x0b, 0x01, 0x0e,
+    0x12, 0x0a, 0x39, 0x03, 0x25, 0xf0, 0x08, 0x04, 0x09, 0x02, 0x0c, 0x11,
+    0x0d, 0x0e, 0x02, 0x1c, 0x13, 0x1f, 0x14, 0x0d, 0x33, 0x0c, 0x0b, 0x0a,
+    0x0b, 0x04, 0x29, 0x06, 0xf0, 0x37, 0x38, 0x06, 0x05, 0x1a, 0x06, 0x25,
+    0x0b, 0x0a, 0x0b, 0x14, 0x0e, 0x0c, 0x05, 0x0d, 0x07, 0x0c, 0x08, 0x0b,
+    0x07, 0x2c, 0xf0, 0x18, 0x07, 0x0b, 0x19, 0x0a, 0x09, 0x08, 0x08, 0x07,
+    0x29, 0x09, 0x17, 0x0b, 0x09, 0x0e, 0x07, 0x0d, 0x06, 0x0e, 0x05, 0x2c,
+    0x14, 0xf0, 0x05, 0x0a, 0x16, 0x0b, 0x2c, 0x08, 0x0b, 0x0e, 0x0e, 0x1c,
+    0xaf, 0x0f, 0x0e, 0x0c, 0x0e, 0x1f, 0x0e, 0x1f, 0xf0, 0x0c, 0x0e, 0x0d,
+    0x1d, 0x0c, 0x0e, 0x0e, 0x0f, 0x0c, 0x3e, 0x0d, 0x3e, 0x1f, 0x0d, 0x0e,
+    0x0e, 0x0b, 0x0d, 0x08, 0x1e, 0x26, 0xf0, 0x0d, 0x0a, 0x35, 0x1b, 0x2c,
+    0x04, 0x03, 0x0e, 0x42, 0x0f, 0x0e, 0x0d, 0x0b, 0x0c, 0x13, 0x18, 0x04,
+    0x17, 0xf0, 0x35, 0x18, 0x19, 0x04, 0x83, 0x08, 0x09, 0x0b, 0x0a, 0x1e,
+    0x0c, 0x0b, 0x0a, 0x74, 0x29, 0xf0, 0x0a, 0x19, 0x18, 0x05, 0x07, 0x34,
+    0x08, 0x19, 0x0a, 0x15, 0x09, 0x0a, 0x24, 0x0b, 0x0c, 0x1b, 0xf0, 0x23,
+    0x0a, 0x0c, 0x04, 0x0a, 0x03, 0x0c, 0x24, 0x0b, 0x0e, 0x0c, 0x15, 0x1a,
+    0x44, 0x0c, 0x0d, 0x0b, 0x0a, 0x09, 0x33, 0x0c, 0xf0, 0x0d, 0x1a, 0x24,
+    0x09, 0x0a, 0x0b, 0x15, 0x0a, 0x0d, 0x16, 0x0b, 0x0a, 0x07, 0x09, 0x06,
+    0x0a, 0x14, 0x0c, 0x0d, 0x15, 0x1b, 0xf0, 0x06, 0x0c, 0x07, 0x0b, 0x06,
+    0x0e, 0x07, 0x0c, 0x08, 0x0e, 0x0b, 0x1d, 0x0c, 0x0d, 0x2c, 0x0f, 0x0e,
+    0x09, 0x0d, 0x0a, 0x1e, 0x0d, 0x1c, 0x5f, 0x0d, 0xf0, 0x0e, 0x0c, 0x0e,
+    0x2f, 0x0e, 0x1c, 0x0e, 0x0e, 0x0a, 0x2d, 0x08, 0x0a, 0x09, 0x5e, 0x08,
+    0x09, 0x08, 0x17, 0xf0, 0x26, 0x1d, 0x0c, 0x07, 0x0b, 0x08, 0x1c, 0x17,
+    0x0b, 0x06, 0x0c, 0x05, 0x0e, 0x14, 0x0d, 0x0c, 0x45, 0x1b, 0x0a, 0x0b,
+    0x09, 0xf0, 0x24, 0x0a, 0x0c, 0x09, 0x43, 0x2a, 0x0c, 0x0d, 0x54, 0x1a,
+    0x09, 0x1a, 0x0c, 0x05, 0x0b, 0x06, 0x28, 0xf0, 0x25, 0x07, 0x24, 0x36,
+    0x63, 0x07, 0x18, 0x1a, 0x09, 0x32, 0x0b, 0x0c, 0x0e, 0xf0, 0x0b, 0x33,
+    0x09, 0x0b, 0x0a, 0x0e, 0x24, 0x1b, 0x0c, 0x05, 0x0d, 0x16, 0x0a, 0x1c,
+    0x07, 0x38, 0x3b, 0xf0, 0x07, 0x0c, 0x08, 0x1d, 0x19, 0x0e, 0x08, 0x0d,
+    0x16, 0x0e, 0x0c, 0x05, 0x0d, 0x16, 0x2b, 0x28, 0x0e, 0x0c, 0x07, 0x1b,
+    0x16, 0x0a, 0xf0, 0x45, 0x0c, 0x0a, 0x09, 0x0b, 0x0c, 0x26, 0x0b, 0x1a,
+    0x08, 0x19, 0x07, 0x08, 0x38, 0x09, 0x38, 0x09, 0x1a, 0x60, 0x17, 0x0c,
+    0x08, 0x0d, 0x07, 0x0e, 0x08, 0x0c, 0x0a, 0x0d, 0x0c, 0x07, 0xa1, 0x0e,
+    0x18, 0x0f, 0x0e, 0x09, 0x0b, 0x18, 0x09, 0x0a, 0x27, 0x09, 0x0b, 0x0d,
+    0x08, 0x0e, 0x07, 0x0c, 0x1e, 0xf0, 0x0a, 0x09, 0x1c, 0x07, 0x09, 0x1a,
+    0x0a, 0x07, 0x0b, 0x16, 0x1c, 0x05, 0x09, 0x24, 0x0a, 0x1b, 0x15, 0x0a,
+    0x0b, 0x24, 0x0e, 0x0d, 0xf0, 0x1b, 0x03, 0x32, 0x1e, 0x0c, 0x0a, 0x53,
+    0x09, 0x08, 0x07, 0x09, 0x18, 0x32, 0x1d, 0x0e, 0x0b, 0xf0, 0x23, 0x09,
+    0x2a, 0x04, 0x43, 0x0e, 0x0b, 0x0e, 0x1c, 0x24, 0x0a, 0x0b, 0x09, 0x15,
+    0x08, 0x09, 0x84, 0x0a, 0x0d, 0xf0, 0x0b, 0x0a, 0x0c, 0x0b, 0x09, 0x0a,
+    0x0b, 0x03, 0x0e, 0x24, 0x0b, 0x0c, 0x0e, 0x15, 0x0c, 0x0a, 0x34, 0x0c,
+    0x2e, 0xf0, 0x25, 0x0c, 0x0d, 0x0c, 0x46, 0x0a, 0x0b, 0x2a, 0x35, 0x0d,
+    0x1e, 0x1d, 0x46, 0x1e, 0xf0, 0x0c, 0x0b, 0x67, 0x0a, 0x19, 0x0a, 0x0b,
+    0x1c, 0x16, 0x2d, 0x07, 0x16, 0x1e, 0x07, 0x2b, 0x08, 0xf0, 0x2b, 0x0c,
+    0x1d, 0x0e, 0x0f, 0x0c, 0x0e, 0x3b, 0x0d, 0x0e, 0x19, 0x0c, 0x0a, 0x1b,
+    0x38, 0x0c, 0x1e, 0x37, 0x0d, 0xf0, 0x0e, 0x0c, 0x0d, 0x08, 0x0c, 0x27,
+    0x0d, 0x1b, 0x26, 0x1e, 0x0c, 0x05, 0x0d, 0x26, 0x1e, 0x1d, 0x18, 0x0e,
+    0xf0, 0x17, 0x0d, 0x2c, 0x06, 0x35, 0x1d, 0x0a, 0x64, 0x0c, 0x2b, 0x0a,
+    0x19, 0x43, 0x0e, 0x1d, 0xf0, 0x0c, 0x0d, 0x74, 0x39, 0x0a, 0x29, 0x43,
+    0x1b, 0x0c, 0x0e, 0x0f, 0xf0, 0x04, 0x0c, 0x65, 0x0a, 0x09, 0x0a, 0x0b,
+    0x09, 0x1a, 0x24, 0x1e, 0x0c, 0x05, 0x0a, 0x74, 0x2b, 0x19, 0xf0, 0x0a,
+    0x1c, 0x65, 0x0a, 0x0b, 0x2a, 0x09, 0x0a, 0xd4, 0x1e, 0x0f, 0x1e, 0xf0,
+    0x0c, 0x0b, 0x0c, 0x1d, 0x0b, 0x3c, 0x25, 0x2b, 0x26, 0x0a, 0x0b, 0x17,
+    0x0c, 0xf0, 0x2d, 0x18, 0x09, 0x2c, 0x0a, 0x0b, 0x0a, 0x0d, 0x0c, 0x1c,
+    0x0d, 0x1b, 0x0b, 0x0a, 0x0c, 0x69, 0x1a, 0x0c, 0x2b, 0xf0, 0x09, 0x1a,
+    0x38, 0x29, 0x27, 0x0a, 0x0c, 0x5b, 0x26, 0x45, 0x0e, 0xf0, 0x1d, 0x56,
+    0x0b, 0x0a, 0x0b, 0x1c, 0x0b, 0x85, 0x1c, 0x0e, 0x0c, 0x0d, 0x1e, 0x0c,
+    0xf0, 0x0b, 0x44, 0x0e, 0x0d, 0x0e, 0x0c, 0x0b, 0x15, 0x0a, 0x09, 0x04,
+    0x0b, 0xa3, 0x0f, 0x0e, 0x0d, 0x0b, 0x1c, 0x1a, 0xf0, 0x1d, 0x0f, 0x04,
+    0x0e, 0x35, 0x2b, 0x0a, 0xb4, 0x3b, 0x0a, 0x0c, 0x0b, 0xf0, 0x19, 0x0a,
+    0x0c, 0x0e, 0x05, 0x0d, 0x86, 0x0b, 0x1c, 0x0d, 0x2b, 0x1a, 0xd5, 0x0b,
+    0xf0, 0x1a, 0x09, 0x0a, 0x0b, 0x0a, 0x1b, 0x09, 0x0a, 0x1b, 0x0d, 0xe6,
+    0x1a, 0x0b, 0xf0, 0x2a, 0x09, 0x0a, 0x2c, 0x0b, 0x0c, 0x1b, 0x47, 0x0a,
+    0x09, 0x1a, 0xf0, 0x0b, 0x08, 0x0c, 0x0a, 0x2b, 0x29, 0x1a, 0x38, 0x39,
+    0x07, 0x16, 0x1b, 0x45, 0x0d, 0x0c, 0x2d, 0xf0, 0x26, 0x1b, 0x0a, 0x17,
+    0x19, 0x16, 0x0a, 0x0c, 0x47, 0x1b, 0x2a, 0x26, 0x2b, 0xf0, 0x25, 0x0d,
+    0x1b, 0xa4, 0x0d, 0x0b, 0x0d, 0x0c, 0x0e, 0x2d, 0x0b, 0x1c, 0x35, 0x09,
+    0xf0, 0x0a, 0x09, 0x0a, 0x44, 0x1e, 0x1d, 0x0e, 0xa5, 0x1a, 0x0b, 0x0d,
+    0x0b, 0x1a, 0x0b, 0xf0, 0x2a, 0x74, 0x0d, 0x0b, 0x1c, 0x0a, 0x0d, 0x0e,
+    0x0d, 0x15, 0x1a, 0x84, 0x0d, 0x1b, 0xf0, 0x1a, 0x1b, 0x0c, 0x0d, 0x95,
+    0x6a, 0x0b, 0x1d, 0xf0, 0x96, 0x6a, 0x0b, 0x0c, 0x1b, 0x17, 0x0c, 0x76,
+    0x1e, 0x0d, 0x0a, 0xf0, 0x09, 0x1b, 0x0e, 0x77, 0x0c, 0x0b, 0x5c, 0x26,
+    0x0e, 0x0c, 0x0b, 0x95, 0x0e, 0xf0, 0x0d, 0x0b, 0x0d, 0x0e, 0x1d, 0x0e,
+    0x0c, 0x1d, 0x06, 0x37, 0x1b, 0x0c, 0x0d, 0x26, 0x0e, 0x0d, 0xf0, 0x0b,
+    0xc5, 0x0e, 0x0d, 0x0e, 0x1c, 0x0e, 0x0d, 0x0b, 0x1a, 0x29, 0x16, 0x18,
+    0xf0, 0x17, 0x17, 0x06, 0x08, 0x55, 0x19, 0x3a, 0x44, 0x0e, 0x1c, 0x0b,
+    0x0c, 0x55, 0x0a, 0x0b, 0xf0, 0x0a, 0x0b, 0x0c, 0x0a, 0xf4, 0x1e, 0x1d,
+    0x1e, 0x0d, 0x0c, 0x1d, 0x0c, 0x0d, 0xf0, 0x1e, 0x4f, 0x44, 0x0e, 0x0c,
+    0xd5, 0x0a, 0x19, 0x2b, 0x0c, 0xf0, 0x0e, 0x2d, 0x2c, 0xe6, 0x2a, 0x0b,
+    0x1c, 0x0e, 0x0d, 0x0c, 0xf0, 0x0d, 0x0c, 0x2b, 0x0c, 0x37, 0x0a, 0x2b,
+    0x96, 0x1c, 0x0d, 0x0b, 0x0c, 0x1e, 0xf0, 0x0d, 0x0c, 0x0b, 0xf5, 0x2e,
+    0x3d, 0x0c, 0x1d, 0x0c, 0x0d, 0xf0, 0x0e, 0x0c, 0x1b, 0xf5, 0x0a, 0x09,
+    0x0a, 0x2b, 0x0a, 0x29, 0x1a, 0xf0, 0x2b, 0x0c, 0x46, 0x2a, 0x1b, 0x55,
+    0x0e, 0x0d, 0x0e, 0x0c, 0x0b, 0x0d, 0x46, 0x2a, 0xf0, 0x0b, 0x0a, 0x95,
+    0x1d, 0x0e, 0x0c, 0x2b, 0x2a, 0xe4, 0x1e, 0xf0, 0x0d, 0x1b, 0x0c, 0x0b,
+    0x0a, 0x0b, 0x0a, 0x1b, 0x0d, 0x1e, 0x75, 0x0a, 0x09, 0x3a, 0xf0, 0x1b,
+    0x06, 0x09, 0x07, 0x08, 0x28, 0x27, 0x1a, 0xf6, 0x1b, 0x0c, 0x1b, 0xf0,
+    0x2c, 0x1b, 0x0c, 0x1b, 0x0a, 0x0d, 0xf5, 0x0e, 0x0c, 0x0d, 0x4e, 0xf0,
+    0x4d, 0x1c, 0x4d, 0xf5, 0x3c, 0xf0, 0x0e, 0x3d, 0x2c, 0xf5, 0x1b, 0x1d,
+    0x2c, 0xf0, 0x0b, 0x0c, 0x1d, 0x1c, 0x5b, 0xf5, 0x2c, 0xf0, 0x0d, 0x2c,
+    0x0d, 0x2e, 0x0d, 0x1c, 0x55, 0x0d, 0x0c, 0x1b, 0xf0, 0x78, 0x76, 0x0a,
+    0xf5, 0x9b, 0xf0, 0x0c, 0x4d, 0xf5, 0x0c, 0x2d, 0x2e, 0xf0, 0x0d, 0x4e,
+    0x2d, 0xf5, 0x4c, 0x0d, 0x2e, 0xf0, 0x1d, 0x0e, 0x0d, 0x1e, 0x0d, 0xf5,
+    0x1e, 0x3d, 0x0c, 0xf0, 0x0d, 0xdc, 0xf5, 0x7b, 0xf0, 0x0a, 0x6b, 0xf5,
+    0x1c, 0xf0, 0x0b, 0x7c, 0xf5, 0x0d, 0x1e, 0x1d, 0x3c, 0xf0, 0x0d, 0x1c,
+    0x9b, 0xf5, 0xf0, 0xfc, 0xf5, 0xf0, 0x0c, 0x0d, 0x5c, 0x1d, 0xf5, 0xcc,
+    0xf0, 0x3d, 0xf5, 0x0e, 0xfd, 0xf0, 0xf5, 0x2d, 0x3c, 0xf0, 0x0b, 0x1c,
+    0x7b, 0xf5, 0xfc, 0xf0, 0xf5, 0xfc, 0xf0, 0xf5, 0xfc, 0xf0, 0xf5, 0xfc,
+    0xf0, 0xa5, 0x4c, 0x30, 0x0c, 0x05, 0x00
+};
@@ -0,0 +1,526 @@
+const uint8_t decrease_stocks_sound [] = {
+    0xf9, 0xf2, 0xf0, 0x89, 0xf2, 0xf0, 0x1a, 0x0b, 0x09, 0x0c, 0x08, 0x07,
+    0x0a, 0xf2, 0xf0, 0x09, 0x07, 0x09, 0x0e, 0x0c, 0x09, 0x06, 0x07, 0x0c,
+    0x0f, 0x07, 0x09, 0x0d, 0x08, 0x06, 0x0c, 0xb2, 0xf0, 0x09, 0x07, 0x0e,
+    0x0f, 0x0a, 0x05, 0x18, 0x0f, 0x0a, 0x09, 0x06, 0x03, 0x05, 0x04, 0x03,
+    0x05, 0x02, 0x17, 0x03, 0xf0, 0x12, 0x08, 0x09, 0x13, 0x08, 0x0a, 0x11,
+    0x09, 0x0a, 0x02, 0x08, 0x03, 0x07, 0x02, 0x18, 0x03, 0x52, 0x29, 0x07,
+    0x38, 0xf0, 0x03, 0x02, 0x03, 0x0b, 0x02, 0x0a, 0x11, 0x19, 0x12, 0x0c,
+    0x0a, 0x01, 0x0c, 0x12, 0x0e, 0x0d, 0x11, 0x0f, 0x0e, 0x03, 0x2a, 0x22,
+    0xf0, 0x0c, 0x03, 0x0b, 0x02, 0x0d, 0x11, 0x0f, 0x0a, 0x02, 0x38, 0x03,
+    0x22, 0x07, 0x03, 0x06, 0x01, 0x07, 0x12, 0x09, 0x08, 0x11, 0x0b, 0x0e,
+    0xf0, 0x13, 0x2f, 0x01, 0x02, 0x0c, 0x13, 0x08, 0x09, 0x02, 0x0b, 0x03,
+    0x18, 0x72, 0x0b, 0x19, 0x08, 0x07, 0x06, 0x18, 0xf0, 0x03, 0x01, 0x09,
+    0x10, 0x0b, 0x0f, 0x01, 0x0e, 0x00, 0x0b, 0x31, 0x07, 0x0a, 0x08, 0x07,
+    0x12, 0x06, 0x27, 0x01, 0x03, 0x04, 0x18, 0x05, 0xf0, 0x03, 0x19, 0x02,
+    0x11, 0x0a, 0x0d, 0x02, 0x08, 0x01, 0x19, 0x02, 0x03, 0x0a, 0x14, 0x08,
+    0x09, 0x17, 0x0a, 0x09, 0x05, 0x0b, 0x09, 0x0c, 0x0f, 0x0b, 0x05, 0x0a,
+    0xf0, 0x22, 0x0d, 0x0c, 0x1a, 0x21, 0x0b, 0x0a, 0x40, 0x0e, 0x0f, 0x2c,
+    0x01, 0x08, 0x02, 0x07, 0x13, 0x08, 0x29, 0x41, 0xf0, 0x0e, 0x0b, 0x18,
+    0x12, 0x0a, 0x01, 0x0c, 0x02, 0x0e, 0x03, 0x1c, 0x02, 0x01, 0x0e, 0x13,
+    0x1a, 0x01, 0x0b, 0x30, 0x0f, 0x0c, 0xf0, 0x1f, 0x11, 0x0d, 0x0f, 0x22,
+    0x09, 0x0a, 0x0b, 0x13, 0x18, 0x02, 0x09, 0x03, 0x1a, 0x06, 0x03, 0x0c,
+    0x21, 0x0e, 0x0b, 0x0f, 0xf0, 0x10, 0x0b, 0x0d, 0x21, 0x19, 0x08, 0x02,
+    0x0a, 0x04, 0x1b, 0x03, 0x04, 0x09, 0x05, 0x0c, 0x0a, 0x0d, 0x05, 0x0c,
+    0x03, 0x1b, 0x02, 0x03, 0x0a, 0x32, 0x0b, 0xf0, 0x09, 0x0b, 0x09, 0x01,
+    0x08, 0x00, 0x09, 0x01, 0x18, 0x10, 0x16, 0x01, 0x14, 0x08, 0x2a, 0x03,
+    0x04, 0x07, 0x1b, 0x06, 0x04, 0x0a, 0xf0, 0x05, 0x49, 0x04, 0x03, 0x02,
+    0x03, 0x02, 0x08, 0x11, 0x19, 0x13, 0x08, 0x06, 0x01, 0x05, 0x10, 0x06,
+    0x08, 0x01, 0x25, 0x20, 0xf0, 0x06, 0x01, 0x24, 0x00, 0x11, 0x05, 0x00,
+    0x17, 0x01, 0x05, 0x18, 0x0b, 0x34, 0x19, 0x2b, 0x01, 0x30, 0x0f, 0x0a,
+    0x00, 0x06, 0x31, 0x19, 0x01, 0x12, 0x1f, 0x02, 0x04, 0x1c, 0x03, 0x08,
+    0x24, 0x0f, 0x0f, 0x07, 0x09, 0x04, 0x0a, 0x33, 0x03, 0x09, 0x05, 0x05,
+    0x02, 0x14, 0x11, 0x12, 0x03, 0x40, 0x05, 0x01, 0x06, 0x20, 0x15, 0x11,
+    0x11, 0x01, 0x02, 0x04, 0xf0, 0x03, 0x06, 0x02, 0x07, 0x21, 0x1c, 0x0f,
+    0x02, 0x0b, 0x20, 0x0f, 0x0a, 0x0b, 0x11, 0x0d, 0x0c, 0x02, 0x0b, 0x13,
+    0x09, 0x0b, 0x04, 0x0c, 0x05, 0x0e, 0xf0, 0x03, 0x0b, 0x60, 0x0a, 0x16,
+    0x09, 0x06, 0x07, 0x09, 0x01, 0x0d, 0x12, 0x0b, 0x0a, 0x03, 0x09, 0x04,
+    0x1b, 0x06, 0x07, 0x1e, 0x0f, 0xf0, 0x04, 0x0c, 0x12, 0x09, 0x18, 0x03,
+    0x01, 0x07, 0x30, 0x04, 0x15, 0x08, 0x01, 0x07, 0x02, 0x09, 0x03, 0x0a,
+    0x07, 0x0c, 0x0c, 0x1f, 0x0f, 0x09, 0x1c, 0xf0, 0x14, 0x0a, 0x06, 0x0c,
+    0x09, 0x0b, 0x03, 0x09, 0x02, 0x0a, 0x03, 0x08, 0x02, 0x17, 0x40, 0x06,
+    0x15, 0x27, 0x02, 0x03, 0x02, 0x0a, 0x00, 0x04, 0x07, 0x51, 0x07, 0x09,
+    0x0f, 0x0e, 0x06, 0x0b, 0x13, 0x0c, 0x09, 0x04, 0x1f, 0xf0, 0x02, 0x01,
+    0x0c, 0x03, 0x08, 0x14, 0x05, 0x03, 0x05, 0x02, 0x0a, 0x01, 0x04, 0x50,
+    0x02, 0x04, 0x07, 0x03, 0x02, 0x11, 0x21, 0x10, 0x10, 0x02, 0x01, 0x21,
+    0x01, 0x02, 0x62, 0x05, 0x06, 0x02, 0x1e, 0x34, 0x08, 0x07, 0x0b, 0x03,
+    0x13, 0x05, 0x02, 0x40, 0x01, 0x04, 0x30, 0x05, 0x04, 0x03, 0x04, 0x03,
+    0x01, 0x16, 0x05, 0x03, 0x06, 0x04, 0x09, 0x09, 0x07, 0x0d, 0x1f, 0x1f,
+    0x0f, 0x0b, 0x09, 0x0c, 0x07, 0x1f, 0x0a, 0x05, 0x0d, 0x03, 0x0b, 0x0a,
+    0x02, 0x03, 0x09, 0x01, 0x01, 0x0c, 0xf0, 0x60, 0x07, 0x03, 0x11, 0x23,
+    0x02, 0x04, 0x03, 0x16, 0x11, 0x08, 0x12, 0x0c, 0x0e, 0x30, 0x0b, 0x18,
+    0xf0, 0x07, 0x01, 0x06, 0x04, 0x07, 0x09, 0x18, 0x18, 0x27, 0x06, 0x05,
+    0x01, 0x06, 0x10, 0x23, 0x11, 0x12, 0x00, 0x01, 0x13, 0x02, 0x10, 0x01,
+    0x05, 0x03, 0x04, 0x31, 0x0c, 0x06, 0x0a, 0x08, 0x06, 0x0c, 0x0c, 0x09,
+    0x22, 0x0f, 0x0d, 0x04, 0x18, 0x02, 0x61, 0x03, 0x05, 0x04, 0x03, 0x02,
+    0x02, 0x01, 0x11, 0x20, 0x10, 0x02, 0x01, 0x11, 0xf1, 0x07, 0x0a, 0x02,
+    0x09, 0x03, 0x07, 0x05, 0x0f, 0x28, 0x0a, 0x04, 0x05, 0x3a, 0x0e, 0x0d,
+    0x15, 0x08, 0x02, 0x07, 0x10, 0x06, 0x24, 0x01, 0xf1, 0x20, 0x02, 0x03,
+    0x21, 0x04, 0x05, 0x06, 0x02, 0x08, 0x05, 0x09, 0x0e, 0x0a, 0x0b, 0x09,
+    0x07, 0x08, 0x04, 0x07, 0x03, 0x06, 0x02, 0x05, 0x08, 0x03, 0x0f, 0x02,
+    0x41, 0x06, 0x41, 0x03, 0x05, 0x04, 0x01, 0x70, 0x02, 0x80, 0x03, 0x04,
+    0x13, 0x01, 0x10, 0xf1, 0x02, 0x23, 0x01, 0x02, 0x04, 0x07, 0x07, 0x0f,
+    0x0f, 0x0e, 0x0b, 0x08, 0x08, 0x0a, 0x06, 0x0e, 0x05, 0x05, 0x03, 0x02,
+    0x02, 0x01, 0x01, 0x10, 0x20, 0x01, 0x03, 0x03, 0x01, 0x04, 0x12, 0x02,
+    0x05, 0x04, 0x06, 0x06, 0x07, 0x08, 0x0f, 0x0f, 0x0b, 0x0a, 0x3e, 0x09,
+    0x09, 0x07, 0x0e, 0x06, 0x0f, 0x05, 0x09, 0x08, 0x04, 0x04, 0x06, 0x03,
+    0x02, 0x05, 0x02, 0x01, 0x03, 0x31, 0x10, 0x21, 0x11, 0x12, 0xf0, 0x10,
+    0x04, 0x03, 0x15, 0x02, 0x00, 0x08, 0x01, 0x07, 0x02, 0x09, 0x01, 0x07,
+    0x30, 0x09, 0x0b, 0x07, 0x16, 0x02, 0x0c, 0x27, 0x0b, 0x05, 0xc0, 0x04,
+    0x08, 0x0b, 0x07, 0x07, 0x05, 0x01, 0x14, 0x00, 0x11, 0x03, 0x12, 0x10,
+    0x13, 0x01, 0x10, 0x04, 0x08, 0x05, 0x07, 0x11, 0x0d, 0x0c, 0x04, 0x0a,
+    0x02, 0x03, 0x0c, 0x23, 0x1f, 0x0f, 0x0d, 0x03, 0x0f, 0x12, 0x01, 0x09,
+    0x02, 0x08, 0x01, 0x01, 0x0b, 0x90, 0x40, 0x05, 0x03, 0x02, 0x11, 0x02,
+    0x02, 0x06, 0x03, 0x03, 0x04, 0x01, 0x18, 0x04, 0x31, 0x0f, 0x0d, 0x05,
+    0x1e, 0x03, 0x08, 0x09, 0x42, 0x0f, 0x0d, 0x19, 0x07, 0x05, 0x0d, 0x14,
+    0x05, 0x51, 0x02, 0x03, 0x03, 0x02, 0x06, 0x21, 0x02, 0x00, 0x01, 0x03,
+    0xf0, 0x03, 0x04, 0x02, 0x05, 0x00, 0x08, 0x01, 0x0a, 0x05, 0x0c, 0x06,
+    0x0d, 0x05, 0x0b, 0x17, 0x0c, 0x1d, 0x13, 0x0b, 0x07, 0x0a, 0x05, 0x07,
+    0x11, 0x06, 0x17, 0x03, 0x20, 0x02, 0x05, 0x10, 0x03, 0x51, 0x51, 0x11,
+    0x40, 0x20, 0x52, 0x02, 0x05, 0x01, 0x13, 0x02, 0x04, 0x0b, 0x07, 0x13,
+    0x0f, 0x0d, 0x05, 0x0b, 0x02, 0x02, 0x0f, 0x51, 0x05, 0x0a, 0x04, 0x07,
+    0x01, 0x04, 0x00, 0x03, 0x01, 0x01, 0x20, 0x10, 0x02, 0x01, 0x01, 0x02,
+    0x21, 0x12, 0x03, 0x05, 0x03, 0x06, 0x05, 0x06, 0x08, 0x0f, 0x2f, 0x0c,
+    0x09, 0x0b, 0x03, 0x2a, 0x06, 0x0e, 0x0f, 0x0d, 0x06, 0x06, 0x09, 0x02,
+    0x04, 0x07, 0x03, 0x02, 0x06, 0x02, 0x01, 0x15, 0x10, 0x80, 0x14, 0x11,
+    0x03, 0x00, 0x42, 0x02, 0x08, 0x05, 0x11, 0x01, 0x31, 0x12, 0x12, 0x10,
+    0x03, 0x08, 0xf0, 0x22, 0x17, 0x09, 0x05, 0x0a, 0x09, 0x09, 0x14, 0x18,
+    0x0f, 0x06, 0x0a, 0x04, 0x02, 0x02, 0x01, 0x41, 0x12, 0x11, 0x02, 0x02,
+    0x00, 0x01, 0x13, 0x01, 0x02, 0x42, 0x05, 0x04, 0x0b, 0x06, 0x08, 0x08,
+    0x07, 0x1d, 0x1f, 0x63, 0x0f, 0x03, 0x07, 0x00, 0x04, 0x01, 0x02, 0x02,
+    0x01, 0x01, 0x10, 0x40, 0x02, 0x21, 0x31, 0x03, 0x01, 0x02, 0x32, 0x00,
+    0x14, 0x01, 0x04, 0x05, 0x0f, 0x14, 0x53, 0x0e, 0x04, 0x05, 0x05, 0x07,
+    0x0e, 0x09, 0x0f, 0x0b, 0x05, 0x0d, 0x12, 0x04, 0x08, 0x03, 0x0b, 0x21,
+    0x01, 0x09, 0x30, 0x07, 0x0c, 0xf0, 0x06, 0x03, 0x02, 0x22, 0x05, 0x04,
+    0x10, 0x03, 0x26, 0x03, 0x0b, 0x0c, 0x35, 0x09, 0x0a, 0x1d, 0x24, 0x0a,
+    0x07, 0xe0, 0x04, 0x23, 0x05, 0x0a, 0x0e, 0x12, 0x01, 0x00, 0x01, 0x11,
+    0x02, 0x14, 0x40, 0x23, 0x06, 0x01, 0x08, 0x03, 0x05, 0x21, 0x02, 0x08,
+    0x05, 0x0c, 0x0d, 0x0b, 0x42, 0x0f, 0x0f, 0x03, 0x0c, 0x00, 0x07, 0x01,
+    0x04, 0x04, 0x01, 0x23, 0x03, 0x30, 0x40, 0x12, 0x01, 0x21, 0x02, 0x01,
+    0x04, 0x00, 0x17, 0x02, 0x01, 0x04, 0x05, 0x0a, 0x06, 0x0f, 0x0f, 0x19,
+    0x09, 0x0e, 0x03, 0x0c, 0x18, 0x04, 0x0b, 0x0a, 0x08, 0x19, 0x0f, 0x06,
+    0x03, 0x04, 0x0a, 0x01, 0x03, 0x28, 0x20, 0x02, 0x01, 0x10, 0x06, 0x11,
+    0x04, 0x31, 0x42, 0x00, 0x01, 0x03, 0x04, 0x70, 0x10, 0xf1, 0x03, 0x08,
+    0x05, 0x08, 0x0e, 0x0b, 0x01, 0x08, 0x02, 0x0c, 0x13, 0x0f, 0x18, 0x32,
+    0x0d, 0x09, 0x01, 0x01, 0x00, 0x10, 0x71, 0x01, 0x02, 0x01, 0x10, 0x12,
+    0x11, 0x03, 0x05, 0x02, 0x07, 0x05, 0x06, 0x02, 0x0f, 0x25, 0x63, 0x17,
+    0x0e, 0x16, 0x0f, 0x03, 0x03, 0x10, 0x02, 0x01, 0x04, 0x02, 0x50, 0x05,
+    0x01, 0x04, 0x40, 0xe3, 0x01, 0x02, 0x12, 0x01, 0x00, 0x04, 0x02, 0x06,
+    0x0d, 0x18, 0x06, 0x02, 0x0a, 0x04, 0x0c, 0x1f, 0x1e, 0x06, 0x0b, 0x02,
+    0x05, 0x0c, 0x01, 0x03, 0x0b, 0xf0, 0x01, 0x18, 0x00, 0x11, 0x07, 0x04,
+    0x00, 0x02, 0x01, 0x21, 0x06, 0x05, 0x10, 0x02, 0x03, 0x05, 0x04, 0x0f,
+    0x05, 0x08, 0x26, 0x0b, 0x09, 0x14, 0x07, 0xa0, 0x18, 0x0e, 0x0a, 0x07,
+    0x03, 0x06, 0x02, 0x07, 0x16, 0x06, 0x05, 0x01, 0x03, 0x00, 0x01, 0x01,
+    0x02, 0x03, 0x21, 0x21, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x11,
+    0x00, 0x33, 0x03, 0x72, 0x0d, 0x06, 0x03, 0x04, 0x09, 0x05, 0x0e, 0x06,
+    0x05, 0x02, 0x01, 0x01, 0x02, 0x10, 0x13, 0x03, 0x01, 0x01, 0x02, 0x30,
+    0x40, 0x13, 0x12, 0x01, 0x14, 0x04, 0x01, 0x03, 0x02, 0x05, 0x01, 0x04,
+    0x56, 0x04, 0x08, 0x0f, 0x0f, 0x0c, 0x0d, 0x03, 0x2b, 0x05, 0x0f, 0x05,
+    0x0d, 0x09, 0x04, 0x05, 0x08, 0x13, 0x04, 0x15, 0x02, 0x12, 0x10, 0x03,
+    0x04, 0x11, 0x12, 0x03, 0x04, 0xf0, 0x10, 0x23, 0x12, 0x02, 0x10, 0x01,
+    0x22, 0x03, 0x05, 0x04, 0x23, 0x06, 0x0c, 0x04, 0x04, 0x05, 0x05, 0x0e,
+    0x07, 0x0f, 0x09, 0x03, 0x08, 0xc0, 0x02, 0x07, 0x04, 0x05, 0x05, 0x03,
+    0x01, 0x12, 0x40, 0x04, 0x05, 0x07, 0x1b, 0x02, 0x01, 0x1f, 0x02, 0x06,
+    0x0d, 0x41, 0x0f, 0x0f, 0x06, 0x0c, 0x03, 0x0b, 0x05, 0x0a, 0x06, 0x0e,
+    0x70, 0x02, 0x0a, 0x80, 0x08, 0x0e, 0x0b, 0x09, 0x05, 0x06, 0x12, 0x61,
+    0x05, 0x12, 0x06, 0x07, 0x01, 0x08, 0x03, 0x0d, 0x07, 0x08, 0x22, 0x0a,
+    0x09, 0x04, 0x0a, 0x09, 0x07, 0x73, 0x1f, 0x18, 0x06, 0x06, 0x04, 0x04,
+    0x01, 0x03, 0x10, 0x21, 0x01, 0x22, 0x02, 0x10, 0x20, 0x01, 0x01, 0x13,
+    0xf0, 0x11, 0x02, 0x02, 0x03, 0x05, 0x04, 0x0b, 0x45, 0x0f, 0x0e, 0x0a,
+    0x05, 0x07, 0x06, 0x0d, 0x07, 0x0f, 0x09, 0x06, 0x16, 0x05, 0x13, 0x07,
+    0x06, 0xf0, 0x01, 0x15, 0x20, 0x06, 0x08, 0x01, 0x07, 0x20, 0x09, 0x08,
+    0x07, 0x02, 0x26, 0x04, 0x0b, 0x08, 0x05, 0x17, 0x14, 0x09, 0x53, 0x04,
+    0x80, 0x31, 0x30, 0x04, 0x03, 0x02, 0x04, 0x02, 0x03, 0x11, 0x05, 0x14,
+    0x06, 0x22, 0x07, 0x06, 0x1e, 0x19, 0x53, 0x0f, 0x2e, 0x19, 0x0a, 0x0d,
+    0x0f, 0x0b, 0x0a, 0x0a, 0x02, 0x04, 0x0c, 0x01, 0x01, 0x0f, 0xf0, 0x00,
+    0x0a, 0x21, 0x16, 0x15, 0x30, 0x04, 0x13, 0x11, 0x22, 0x02, 0x05, 0x03,
+    0x0a, 0x04, 0x05, 0x05, 0x12, 0x17, 0x80, 0x04, 0x08, 0x06, 0x19, 0x07,
+    0x04, 0x07, 0x02, 0x18, 0x01, 0x30, 0x09, 0x05, 0x02, 0x01, 0x14, 0xf0,
+    0x01, 0x14, 0x05, 0x17, 0x03, 0x02, 0x18, 0x06, 0x1f, 0x0a, 0x0b, 0x08,
+    0x2a, 0x04, 0x03, 0x02, 0x09, 0x01, 0x0c, 0x20, 0x0a, 0x09, 0x0c, 0x00,
+    0x01, 0x05, 0xf1, 0x02, 0x03, 0x01, 0x02, 0x00, 0x21, 0x01, 0x07, 0x09,
+    0x12, 0x0b, 0x08, 0x03, 0x0c, 0x04, 0x0a, 0x05, 0x0f, 0x07, 0x0e, 0x09,
+    0x0b, 0x0b, 0x0c, 0x0d, 0x0f, 0x0f, 0x0c, 0x0a, 0x51, 0x02, 0x07, 0x10,
+    0x04, 0x21, 0x01, 0x12, 0x00, 0x02, 0x40, 0x11, 0x21, 0x02, 0x05, 0xf0,
+    0x17, 0x01, 0x03, 0x08, 0x06, 0x0c, 0x0f, 0x0f, 0x07, 0x0c, 0x02, 0x0b,
+    0x01, 0x0f, 0x04, 0x0d, 0x09, 0x1e, 0x0f, 0x07, 0x0b, 0x04, 0x19, 0x13,
+    0x17, 0x01, 0xf0, 0x00, 0x26, 0x01, 0x02, 0x05, 0x15, 0x04, 0x02, 0x04,
+    0x00, 0x05, 0x01, 0x06, 0x06, 0x05, 0x0e, 0x04, 0x0a, 0x03, 0x06, 0x32,
+    0x05, 0x03, 0x02, 0x11, 0x31, 0x70, 0x03, 0x05, 0x02, 0x02, 0x20, 0x03,
+    0x02, 0x03, 0x02, 0x14, 0x01, 0x0a, 0x22, 0x0e, 0x05, 0x06, 0x17, 0x0a,
+    0x63, 0x1f, 0x0a, 0x0b, 0x07, 0x1a, 0x09, 0x0b, 0x0b, 0x0f, 0x0c, 0x0d,
+    0x29, 0x02, 0x03, 0x01, 0x01, 0x60, 0x00, 0x07, 0x01, 0x05, 0x03, 0x04,
+    0x05, 0x23, 0x01, 0x00, 0x01, 0x11, 0x11, 0x02, 0x10, 0x13, 0xf0, 0x02,
+    0x34, 0x05, 0x08, 0x07, 0x02, 0x05, 0x01, 0x14, 0x03, 0x07, 0x15, 0x0d,
+    0x09, 0x03, 0x07, 0x52, 0x04, 0x05, 0x03, 0x01, 0xf0, 0x02, 0x07, 0x03,
+    0x0f, 0x04, 0x07, 0x05, 0x05, 0x06, 0x13, 0x07, 0x0a, 0x07, 0x1c, 0x0f,
+    0x05, 0x0b, 0x22, 0x09, 0x08, 0x36, 0x01, 0x10, 0xb0, 0x02, 0x34, 0x06,
+    0x04, 0x01, 0x10, 0x05, 0x28, 0x01, 0x05, 0x08, 0x09, 0x15, 0x0a, 0x0c,
+    0x0b, 0x07, 0x91, 0x0f, 0x09, 0x16, 0x28, 0x08, 0x0f, 0x07, 0x0e, 0x04,
+    0x05, 0x02, 0x01, 0x11, 0x00, 0x21, 0x02, 0xf0, 0x03, 0x04, 0x20, 0x05,
+    0x03, 0x04, 0x11, 0x06, 0x07, 0x00, 0x1c, 0x02, 0x0b, 0x1e, 0x0f, 0x07,
+    0x0a, 0x03, 0x09, 0x02, 0x08, 0x03, 0x09, 0x06, 0x1b, 0xf0, 0x0a, 0x07,
+    0x1a, 0x05, 0x13, 0x0c, 0x1a, 0x02, 0x11, 0x18, 0x03, 0x1b, 0x06, 0x03,
+    0x09, 0x01, 0x07, 0x10, 0x09, 0x0d, 0x01, 0x18, 0x12, 0xc0, 0x07, 0x50,
+    0x08, 0x15, 0x03, 0x12, 0x01, 0x13, 0x03, 0x02, 0x04, 0x10, 0x05, 0x03,
+    0x01, 0x22, 0x01, 0x02, 0x02, 0x05, 0x93, 0x0e, 0x03, 0x0f, 0x05, 0x0c,
+    0x06, 0x1f, 0x09, 0x0f, 0x08, 0x0d, 0x05, 0x0e, 0x08, 0x0d, 0x0f, 0x0b,
+    0x08, 0x0a, 0x02, 0x03, 0x09, 0x21, 0x01, 0x05, 0x10, 0x04, 0x17, 0xf0,
+    0x21, 0x0a, 0x09, 0x50, 0x08, 0x06, 0x07, 0x05, 0x04, 0x08, 0x02, 0x0c,
+    0x03, 0x0a, 0x01, 0x0b, 0x20, 0x09, 0x07, 0x06, 0x01, 0x07, 0xf0, 0x02,
+    0x1a, 0x03, 0x02, 0x0b, 0x11, 0x0d, 0x0c, 0x10, 0x0e, 0x19, 0x01, 0x05,
+    0x28, 0x0a, 0x07, 0x05, 0x17, 0x04, 0x03, 0x18, 0x04, 0x06, 0x09, 0xf0,
+    0x07, 0x07, 0x05, 0x26, 0x02, 0x11, 0x14, 0x00, 0x01, 0x23, 0x03, 0x06,
+    0x04, 0x04, 0x02, 0x05, 0x01, 0x07, 0x10, 0x0b, 0x0c, 0x02, 0x0a, 0x05,
+    0x1b, 0xf0, 0x17, 0x0a, 0x0b, 0x09, 0x0c, 0x38, 0x18, 0x0b, 0x0d, 0x07,
+    0x07, 0x06, 0x03, 0x05, 0x01, 0x04, 0x20, 0x05, 0x03, 0x15, 0x11, 0x06,
+    0xf0, 0x10, 0x18, 0x21, 0x07, 0x06, 0x08, 0x04, 0x09, 0x09, 0x0c, 0x07,
+    0x0b, 0x06, 0x0a, 0x05, 0x0b, 0x03, 0x69, 0x02, 0x03, 0x35, 0xf0, 0x04,
+    0x28, 0x13, 0x04, 0x09, 0x07, 0x0b, 0x06, 0x0a, 0x03, 0x1b, 0x02, 0x01,
+    0x0a, 0x10, 0x07, 0x05, 0x11, 0x06, 0x05, 0x40, 0x14, 0x90, 0x03, 0x11,
+    0x01, 0x12, 0x02, 0x01, 0x04, 0x40, 0x08, 0x0c, 0x0b, 0x05, 0x01, 0x04,
+    0x32, 0x01, 0x05, 0x04, 0x06, 0x05, 0x19, 0x07, 0x13, 0x0f, 0x0e, 0x0c,
+    0x19, 0x34, 0x06, 0x07, 0x0b, 0x0f, 0x0c, 0x07, 0x1d, 0x03, 0x13, 0x12,
+    0x08, 0x02, 0x07, 0x01, 0x10, 0x0e, 0xf0, 0x09, 0x21, 0x08, 0x09, 0x0a,
+    0x12, 0x07, 0x06, 0x01, 0x07, 0x10, 0x06, 0x27, 0x01, 0x02, 0x01, 0x06,
+    0x00, 0x07, 0x01, 0x16, 0x20, 0x04, 0xf0, 0x06, 0x21, 0x17, 0x28, 0x04,
+    0x03, 0x01, 0x29, 0x02, 0x05, 0x06, 0x0c, 0x15, 0x0d, 0x2e, 0x04, 0x03,
+    0x02, 0x0d, 0x03, 0x09, 0xf0, 0x16, 0x07, 0x06, 0x04, 0x15, 0x03, 0x04,
+    0x14, 0x01, 0x00, 0x13, 0x02, 0x03, 0x04, 0x11, 0x06, 0x07, 0x02, 0x09,
+    0x01, 0x0b, 0x00, 0x29, 0x01, 0x12, 0xf0, 0x0d, 0x03, 0x0b, 0x05, 0x1c,
+    0x08, 0x06, 0x0b, 0x14, 0x0c, 0x0b, 0x08, 0x0c, 0x05, 0x0e, 0x22, 0x0d,
+    0x08, 0x06, 0x10, 0x05, 0x03, 0x02, 0x14, 0x03, 0xf0, 0x11, 0x06, 0x08,
+    0x02, 0x0b, 0x01, 0x0a, 0x00, 0x0c, 0x01, 0x1d, 0x03, 0x04, 0x1b, 0x15,
+    0x0a, 0x06, 0x08, 0x04, 0x07, 0x12, 0x08, 0x0a, 0x14, 0x09, 0x08, 0xf0,
+    0x02, 0x09, 0x04, 0x0b, 0x05, 0x0c, 0x13, 0x0b, 0x09, 0x0d, 0x0b, 0x0f,
+    0x0c, 0x25, 0x0b, 0x08, 0x06, 0x02, 0x05, 0x00, 0x04, 0x01, 0x13, 0x12,
+    0x02, 0x11, 0x11, 0xc0, 0x03, 0x10, 0x02, 0x00, 0x31, 0x01, 0x14, 0x02,
+    0x02, 0x13, 0x03, 0x04, 0x10, 0x05, 0x09, 0x03, 0x06, 0x21, 0x04, 0x08,
+    0x02, 0x0b, 0x05, 0x0a, 0x02, 0x0f, 0x0b, 0x23, 0x0c, 0x0d, 0x06, 0x0f,
+    0x08, 0x0d, 0x14, 0x0f, 0x0f, 0x07, 0x0c, 0x13, 0x05, 0x07, 0x04, 0x08,
+    0x02, 0x03, 0x09, 0x01, 0x10, 0x0d, 0xf0, 0x06, 0x03, 0x05, 0x0b, 0x04,
+    0x06, 0x33, 0x04, 0x0b, 0x08, 0x03, 0x12, 0x02, 0x09, 0x01, 0x0c, 0x60,
+    0x05, 0x07, 0x0c, 0x03, 0x01, 0xf0, 0x04, 0x08, 0x01, 0x04, 0x02, 0x02,
+    0x03, 0x05, 0x14, 0x08, 0x05, 0x05, 0x03, 0x07, 0x08, 0x09, 0x0e, 0x0b,
+    0x06, 0x1a, 0x05, 0x07, 0x0c, 0x03, 0x0e, 0x00, 0x0b, 0x01, 0x0d, 0xf0,
+    0x05, 0x2f, 0x04, 0x01, 0x02, 0x0d, 0x03, 0x08, 0x01, 0x05, 0x00, 0x04,
+    0x11, 0x05, 0x07, 0x10, 0x09, 0x0c, 0x12, 0x09, 0x07, 0x10, 0x06, 0x07,
+    0x02, 0x0a, 0xf0, 0x04, 0x0b, 0x02, 0x0a, 0x03, 0x0d, 0x08, 0x0c, 0x05,
+    0x1d, 0x02, 0x04, 0x1c, 0x0b, 0x04, 0x2b, 0x02, 0x13, 0x06, 0x10, 0x24,
+    0x03, 0x05, 0x05, 0xf0, 0x13, 0x46, 0x05, 0x03, 0x11, 0x08, 0x13, 0x09,
+    0x0b, 0x02, 0x09, 0x04, 0x0a, 0x06, 0x0b, 0x02, 0x0d, 0x00, 0x0c, 0x02,
+    0x0a, 0x05, 0x0d, 0x03, 0x0b, 0xf0, 0x02, 0x1c, 0x15, 0x0b, 0x02, 0x0e,
+    0x04, 0x0c, 0x1f, 0x0e, 0x0a, 0x06, 0x08, 0x07, 0x07, 0x08, 0x15, 0x02,
+    0x00, 0x03, 0x01, 0x02, 0x14, 0x61, 0x22, 0xc0, 0x20, 0x03, 0x01, 0x14,
+    0x10, 0x15, 0x12, 0x04, 0x10, 0x05, 0x08, 0x22, 0x07, 0x11, 0x0d, 0x0a,
+    0x12, 0x04, 0x0e, 0x06, 0x0b, 0x13, 0x14, 0x0e, 0x0c, 0x04, 0x08, 0x0a,
+    0x15, 0x0f, 0x0e, 0x08, 0x0b, 0x04, 0x04, 0x0c, 0x03, 0x05, 0x09, 0x02,
+    0x04, 0x0a, 0x01, 0x01, 0x0b, 0xf0, 0x00, 0x0a, 0x02, 0x0c, 0x24, 0x0b,
+    0x0a, 0x29, 0x05, 0x01, 0x00, 0x06, 0x01, 0x15, 0x02, 0x01, 0x04, 0x00,
+    0x05, 0x21, 0x04, 0x03, 0x11, 0x00, 0xf0, 0x01, 0x02, 0x02, 0x13, 0x13,
+    0x04, 0x14, 0x25, 0x03, 0x04, 0x07, 0x0f, 0x09, 0x0e, 0x1b, 0x05, 0x16,
+    0x0d, 0x0b, 0x02, 0x0a, 0x00, 0x08, 0x01, 0x0b, 0xf0, 0x03, 0x18, 0x24,
+    0x19, 0x02, 0x08, 0x20, 0x17, 0x0b, 0x01, 0x18, 0x00, 0x01, 0x16, 0x12,
+    0x15, 0x10, 0x09, 0x02, 0x0a, 0xf0, 0x13, 0x08, 0x09, 0x05, 0x0b, 0x06,
+    0x0a, 0x03, 0x18, 0x04, 0x08, 0x2a, 0x0b, 0x14, 0x09, 0x03, 0x0b, 0x02,
+    0x08, 0x10, 0x07, 0x36, 0x02, 0x04, 0xf0, 0x05, 0x14, 0x07, 0x08, 0x01,
+    0x09, 0x00, 0x0c, 0x01, 0x08, 0x02, 0x0d, 0x11, 0x1c, 0x13, 0x0b, 0x19,
+    0x11, 0x17, 0x04, 0x25, 0x18, 0xf0, 0x0a, 0x08, 0x09, 0x04, 0x0a, 0x03,
+    0x1b, 0x05, 0x1f, 0x0d, 0x08, 0x08, 0x06, 0x0d, 0x05, 0x0e, 0x03, 0x05,
+    0x11, 0x01, 0x05, 0x80, 0x08, 0x06, 0x04, 0x20, 0x07, 0x03, 0x10, 0x31,
+    0x02, 0x01, 0x01, 0x00, 0x03, 0x10, 0x01, 0x04, 0x02, 0x22, 0x31, 0x01,
+    0x00, 0x01, 0x03, 0x04, 0x12, 0x02, 0x05, 0x33, 0x04, 0x03, 0x08, 0x04,
+    0x0a, 0x15, 0x14, 0x34, 0x07, 0x0a, 0x0a, 0x0f, 0x0d, 0x26, 0x0e, 0x23,
+    0x0b, 0x19, 0x03, 0x22, 0x10, 0x08, 0x09, 0x02, 0x0c, 0x31, 0x33, 0x0a,
+    0x08, 0x07, 0x0e, 0xf0, 0x01, 0x17, 0x10, 0x08, 0x01, 0x16, 0x10, 0x05,
+    0x02, 0x03, 0x04, 0x11, 0x01, 0x00, 0x12, 0x02, 0x03, 0x03, 0x12, 0x05,
+    0x06, 0x03, 0x07, 0x12, 0x18, 0xf0, 0x04, 0x09, 0x07, 0x0a, 0x06, 0x0c,
+    0x05, 0x1b, 0x06, 0x05, 0x09, 0x02, 0x37, 0x00, 0x01, 0x13, 0x18, 0x22,
+    0x0a, 0x08, 0x10, 0x09, 0xf0, 0x08, 0x11, 0x07, 0x08, 0x00, 0x0b, 0x01,
+    0x09, 0x02, 0x07, 0x01, 0x06, 0x10, 0x05, 0x0b, 0x02, 0x1e, 0x13, 0x0a,
+    0x04, 0x09, 0x07, 0x08, 0x15, 0x09, 0x0a, 0xf0, 0x08, 0x0c, 0x0e, 0x0d,
+    0x05, 0x0e, 0x04, 0x0c, 0x05, 0x09, 0x03, 0x17, 0x10, 0x08, 0x03, 0x07,
+    0x05, 0x06, 0x04, 0x15, 0x13, 0x06, 0x02, 0x05, 0x11, 0x06, 0x07, 0xf0,
+    0x02, 0x08, 0x11, 0x0c, 0x0b, 0x12, 0x0c, 0x0b, 0x10, 0x0f, 0x0e, 0x03,
+    0x0c, 0x06, 0x1d, 0x05, 0x04, 0x1c, 0x26, 0x0b, 0x09, 0x08, 0x18, 0x0f,
+    0x60, 0x0e, 0x07, 0x1b, 0x05, 0x04, 0x06, 0x23, 0x02, 0x00, 0x01, 0x31,
+    0x61, 0x13, 0x01, 0x40, 0x12, 0x01, 0x02, 0x80, 0x03, 0x11, 0x52, 0x02,
+    0x03, 0x02, 0x01, 0x02, 0x03, 0x06, 0x02, 0x61, 0x0a, 0x03, 0x18, 0x04,
+    0x05, 0x0c, 0x07, 0x0e, 0x0a, 0x0f, 0x0c, 0x0e, 0x08, 0x42, 0x0f, 0x0a,
+    0x0e, 0x08, 0x0f, 0x07, 0x0e, 0x06, 0x08, 0x07, 0x01, 0x13, 0x0c, 0xf0,
+    0x09, 0x06, 0x08, 0x0b, 0x27, 0x06, 0x13, 0x16, 0x02, 0x01, 0x17, 0x30,
+    0x16, 0x08, 0x11, 0x26, 0x10, 0x04, 0xf0, 0x01, 0x05, 0x12, 0x27, 0x11,
+    0x0c, 0x02, 0x0a, 0x03, 0x09, 0x02, 0x0e, 0x23, 0x0b, 0x0a, 0x09, 0x04,
+    0x08, 0x03, 0x09, 0x01, 0x0a, 0x00, 0x08, 0x01, 0x17, 0xf0, 0x12, 0x08,
+    0x20, 0x0c, 0x0a, 0x0e, 0x41, 0x09, 0x08, 0x07, 0x08, 0x17, 0x12, 0x09,
+    0x01, 0x0c, 0x00, 0x0a, 0x01, 0x18, 0x03, 0xf0, 0x04, 0x09, 0x12, 0x1d,
+    0x04, 0x0b, 0x07, 0x3e, 0x0e, 0x1d, 0x07, 0x0d, 0x06, 0x0c, 0x05, 0x0a,
+    0x03, 0x0b, 0x01, 0x08, 0x00, 0x0c, 0x01, 0x0a, 0x02, 0x19, 0xf0, 0x01,
+    0x10, 0x08, 0x0a, 0x51, 0x07, 0x18, 0x0b, 0x0a, 0x1e, 0x02, 0x03, 0x0a,
+    0x02, 0x07, 0x01, 0x08, 0x02, 0x1d, 0x15, 0x0c, 0xf0, 0x04, 0x19, 0x06,
+    0x09, 0x1a, 0x0d, 0x0c, 0x09, 0x0d, 0x08, 0x07, 0x06, 0x05, 0x05, 0x06,
+    0x04, 0x07, 0x03, 0x03, 0x02, 0x01, 0x11, 0x02, 0x08, 0xc0, 0x09, 0x14,
+    0xf0, 0x35, 0x13, 0x05, 0x0b, 0x08, 0x12, 0x01, 0x02, 0x05, 0x04, 0x09,
+    0x05, 0x15, 0x08, 0x0b, 0x00, 0x08, 0x08, 0x11, 0x2f, 0x0c, 0x09, 0x52,
+    0x0e, 0x09, 0x0c, 0x05, 0x19, 0x06, 0x0d, 0x08, 0x07, 0x0e, 0x41, 0x12,
+    0x0a, 0x07, 0x05, 0x16, 0x06, 0x03, 0x0a, 0xf0, 0x51, 0x0b, 0x09, 0x0b,
+    0x09, 0x07, 0x15, 0x10, 0x07, 0x02, 0x38, 0x03, 0x01, 0x00, 0x01, 0x0b,
+    0x03, 0x08, 0x02, 0x17, 0x11, 0xf0, 0x08, 0x02, 0x17, 0x13, 0x09, 0x02,
+    0x0b, 0x10, 0x0f, 0x0b, 0x02, 0x09, 0x03, 0x18, 0x01, 0x10, 0x06, 0x09,
+    0x11, 0x0c, 0x08, 0x20, 0x07, 0x05, 0xe0, 0x48, 0x01, 0x12, 0x01, 0x00,
+    0x0e, 0x02, 0x0b, 0x04, 0x0c, 0x03, 0x19, 0x11, 0x1a, 0x13, 0x0c, 0x02,
+    0x0e, 0x01, 0x1a, 0x81, 0x02, 0x05, 0x0b, 0x1f, 0x0e, 0x0f, 0x07, 0x0e,
+    0x04, 0x0b, 0x05, 0x09, 0x08, 0x07, 0x04, 0x0b, 0x40, 0x01, 0x0a, 0x00,
+    0x09, 0x01, 0x06, 0x02, 0x04, 0x01, 0x22, 0x21, 0x10, 0x01, 0x14, 0xf0,
+    0x13, 0x06, 0x02, 0x07, 0x01, 0x09, 0x02, 0x0a, 0x14, 0x0e, 0x1b, 0x02,
+    0x01, 0x0c, 0x03, 0x18, 0x06, 0x07, 0x07, 0x14, 0x18, 0x06, 0x0a, 0x0e,
+    0x0d, 0xf0, 0x0f, 0x1e, 0x06, 0x03, 0x0b, 0x02, 0x0a, 0x03, 0x07, 0x02,
+    0x06, 0x01, 0x04, 0x10, 0x03, 0x14, 0x01, 0x02, 0x13, 0x01, 0x10, 0x04,
+    0x25, 0x01, 0x02, 0x20, 0x01, 0x14, 0x10, 0x12, 0x11, 0x21, 0x04, 0x50,
+    0x03, 0x10, 0x04, 0x07, 0x01, 0x09, 0x13, 0x0a, 0x07, 0x11, 0x02, 0x0a,
+    0x03, 0x18, 0x02, 0x07, 0x23, 0x0f, 0x0c, 0x0a, 0x09, 0x06, 0x0c, 0x32,
+    0x05, 0x0a, 0x07, 0x09, 0x08, 0x07, 0x06, 0x0a, 0x11, 0x03, 0x08, 0x02,
+    0x0f, 0xf0, 0x03, 0x0c, 0x04, 0x0b, 0x03, 0x09, 0x01, 0x08, 0x00, 0x0c,
+    0x01, 0x09, 0x02, 0x0b, 0x01, 0x4e, 0x10, 0x01, 0x02, 0x13, 0x09, 0x17,
+    0x12, 0x38, 0xf0, 0x13, 0x01, 0x00, 0x09, 0x01, 0x08, 0x12, 0x0a, 0x08,
+    0x01, 0x07, 0x10, 0x08, 0x0c, 0x11, 0x08, 0x07, 0x20, 0x09, 0x16, 0x01,
+    0x35, 0xf0, 0x02, 0x01, 0x10, 0x17, 0x02, 0x03, 0x06, 0x12, 0x17, 0x03,
+    0x18, 0x14, 0x29, 0x03, 0x22, 0x08, 0x0d, 0x13, 0x0c, 0x20, 0x0d, 0x12,
+    0x0f, 0x09, 0xf1, 0x06, 0x0b, 0x0f, 0x0c, 0x0d, 0x0b, 0x07, 0x1c, 0x09,
+    0x0a, 0x0b, 0x05, 0x09, 0x03, 0x06, 0x01, 0x05, 0x20, 0x04, 0x13, 0x01,
+    0x21, 0x10, 0x01, 0x12, 0x11, 0x13, 0x05, 0xf0, 0x02, 0x06, 0x03, 0x07,
+    0x16, 0x08, 0x0a, 0x04, 0x1c, 0x03, 0x12, 0x0e, 0x0a, 0x03, 0x1d, 0x14,
+    0x19, 0x03, 0x06, 0x1a, 0x0d, 0x0b, 0x08, 0x07, 0x06, 0xf0, 0x05, 0x05,
+    0x06, 0x04, 0x07, 0x03, 0x05, 0x32, 0x02, 0x31, 0x03, 0x04, 0x02, 0x13,
+    0x31, 0x04, 0x08, 0x09, 0x70, 0x08, 0x06, 0xa0, 0x18, 0x07, 0x05, 0x04,
+    0x05, 0x01, 0x08, 0x12, 0x09, 0x1f, 0x03, 0x04, 0x0a, 0xf1, 0x08, 0x0c,
+    0x0f, 0x4f, 0x0d, 0x06, 0x07, 0x0e, 0x0a, 0x0e, 0x04, 0x0c, 0x02, 0x0b,
+    0x31, 0x0a, 0x0c, 0x0f, 0x0a, 0x10, 0x09, 0x08, 0x31, 0x0e, 0xf0, 0x1f,
+    0x0c, 0x02, 0x09, 0x03, 0x0b, 0x06, 0x1a, 0x04, 0x42, 0x0b, 0x09, 0x0a,
+    0x0d, 0x09, 0x01, 0x1a, 0x10, 0x0e, 0x11, 0x08, 0xf0, 0x06, 0x20, 0x07,
+    0x08, 0x0a, 0x11, 0x07, 0x16, 0x20, 0x04, 0x05, 0x11, 0x16, 0x10, 0x18,
+    0x11, 0x07, 0x1a, 0x22, 0xf0, 0x19, 0x03, 0x1a, 0x05, 0x06, 0x19, 0x03,
+    0x02, 0x08, 0x01, 0x0c, 0x03, 0x2a, 0x04, 0x13, 0x08, 0x06, 0x09, 0x0d,
+    0x0b, 0x1f, 0x0d, 0x3f, 0xf0, 0x0d, 0x0c, 0x0d, 0x0f, 0x0e, 0x05, 0x09,
+    0x01, 0x07, 0x10, 0x05, 0x06, 0x11, 0x03, 0x22, 0x00, 0x01, 0x02, 0x13,
+    0x23, 0x04, 0x25, 0xf0, 0x05, 0x07, 0x1f, 0x16, 0x06, 0x35, 0x03, 0x05,
+    0x0a, 0x08, 0x24, 0x06, 0x08, 0x2f, 0x25, 0x0a, 0x04, 0x09, 0x03, 0xf0,
+    0x0b, 0x32, 0x0c, 0x08, 0x03, 0x12, 0x21, 0x04, 0x03, 0x32, 0x12, 0x04,
+    0x13, 0x23, 0x02, 0x01, 0x04, 0x10, 0x06, 0xa0, 0x07, 0x01, 0x16, 0x20,
+    0x04, 0x05, 0x01, 0x18, 0x02, 0x13, 0x07, 0x08, 0x06, 0x0a, 0x0b, 0x07,
+    0x71, 0x0d, 0x49, 0x0c, 0x09, 0x0b, 0x0c, 0x0f, 0x0a, 0x0b, 0x07, 0x05,
+    0x0c, 0xf0, 0x02, 0x0d, 0x13, 0x1a, 0x02, 0x09, 0x11, 0x08, 0x0a, 0x42,
+    0x18, 0x0a, 0x08, 0x0a, 0x03, 0x08, 0x15, 0x0b, 0x0c, 0x04, 0x09, 0x32,
+    0x18, 0xf0, 0x09, 0x07, 0x01, 0x06, 0x60, 0x08, 0x1e, 0x0d, 0x19, 0x07,
+    0x01, 0x06, 0x02, 0x05, 0x01, 0x06, 0x50, 0x15, 0xf0, 0x09, 0x0a, 0x09,
+    0x18, 0x11, 0x0e, 0x32, 0x0d, 0x0a, 0x1b, 0x03, 0x0c, 0x14, 0x1e, 0x02,
+    0x1c, 0x01, 0x02, 0x1e, 0xf0, 0x13, 0x0c, 0x02, 0x0e, 0x05, 0x2a, 0x08,
+    0x1f, 0x0b, 0x0d, 0x0c, 0x18, 0x2b, 0x0a, 0x05, 0x0c, 0x02, 0x09, 0x60,
+    0x08, 0x07, 0x06, 0xf0, 0x05, 0x03, 0x04, 0x08, 0x11, 0x07, 0x08, 0x22,
+    0x07, 0x0a, 0x0c, 0x05, 0x0a, 0x07, 0x1b, 0x05, 0x02, 0x0d, 0x03, 0x0b,
+    0x14, 0x0a, 0x09, 0xf0, 0x13, 0x0a, 0x0b, 0x04, 0x0c, 0x15, 0x0b, 0x0c,
+    0x04, 0x09, 0x03, 0x0c, 0x32, 0x0a, 0x19, 0x07, 0xf0, 0x08, 0x05, 0x08,
+    0x09, 0x06, 0xd0, 0x07, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x07, 0x0a,
+    0x0d, 0x09, 0x10, 0x08, 0x0f, 0x21, 0x07, 0xd1, 0x1a, 0x03, 0x09, 0x04,
+    0x0b, 0x05, 0x1a, 0x06, 0x09, 0x29, 0x08, 0x07, 0x1e, 0x1a, 0x06, 0x19,
+    0x23, 0x0f, 0xf0, 0x0b, 0x02, 0x0c, 0x41, 0x0f, 0x1c, 0x1b, 0x22, 0x08,
+    0x3a, 0x03, 0x06, 0x05, 0x19, 0x22, 0x07, 0x19, 0xf0, 0x01, 0x70, 0x0b,
+    0x0d, 0x0c, 0x08, 0x0b, 0x0f, 0x0e, 0x0c, 0x01, 0x17, 0x12, 0x16, 0x01,
+    0x40, 0x07, 0x0a, 0x0d, 0xf0, 0x08, 0x0a, 0x21, 0x19, 0x08, 0x02, 0x09,
+    0x03, 0x08, 0x12, 0x09, 0x0c, 0x14, 0x0e, 0x1d, 0x12, 0x09, 0x03, 0x08,
+    0x24, 0x07, 0x08, 0xf0, 0x2a, 0x05, 0x06, 0x05, 0x0b, 0x06, 0x1c, 0x08,
+    0x07, 0x1d, 0x04, 0x06, 0x0a, 0x08, 0x18, 0x03, 0x21, 0x27, 0x40, 0x16,
+    0xf0, 0x07, 0x08, 0x07, 0x01, 0x16, 0x22, 0x07, 0x09, 0x03, 0x0b, 0x06,
+    0x2a, 0x05, 0x13, 0x0b, 0x05, 0x0d, 0x04, 0x0e, 0x03, 0x0c, 0x04, 0x1a,
+    0xf0, 0x05, 0x13, 0x09, 0x0a, 0x05, 0x19, 0x04, 0x12, 0x0a, 0x0c, 0x04,
+    0x1a, 0x02, 0x11, 0x07, 0x05, 0x42, 0x04, 0x03, 0x22, 0x00, 0x01, 0x01,
+    0x61, 0x10, 0x02, 0x03, 0x21, 0x02, 0x21, 0x14, 0x53, 0x90, 0x12, 0x05,
+    0x07, 0x06, 0x08, 0x04, 0x0b, 0x15, 0x09, 0x06, 0x07, 0x0a, 0x05, 0x91,
+    0x0b, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0d, 0x0b, 0x0f, 0x0f, 0x06, 0x0d,
+    0x13, 0x0b, 0x0c, 0x04, 0x0a, 0x02, 0x0f, 0xf0, 0x21, 0x0e, 0x0f, 0x0b,
+    0x00, 0x09, 0x01, 0x07, 0x03, 0x16, 0x12, 0x05, 0x04, 0x06, 0x0d, 0x15,
+    0x05, 0x12, 0x06, 0x17, 0x03, 0x02, 0x16, 0x21, 0xf0, 0x17, 0x10, 0x18,
+    0x11, 0x0b, 0x0c, 0x00, 0x0f, 0x01, 0x0c, 0x04, 0x0b, 0x03, 0x08, 0x10,
+    0x0b, 0x09, 0x11, 0x0b, 0x07, 0x00, 0x06, 0x11, 0x05, 0xf0, 0x07, 0x10,
+    0x09, 0x18, 0x02, 0x03, 0x17, 0x12, 0x09, 0x15, 0x0b, 0x0c, 0x11, 0x0e,
+    0x0b, 0x03, 0x0c, 0x04, 0x1f, 0x02, 0x03, 0x0e, 0x06, 0x0b, 0xf0, 0x04,
+    0x0c, 0x02, 0x0d, 0x04, 0x0e, 0x07, 0x1c, 0x03, 0x02, 0x0e, 0x06, 0x1c,
+    0x08, 0x02, 0x0a, 0x01, 0x18, 0x02, 0x03, 0x07, 0x01, 0x06, 0x00, 0x08,
+    0x01, 0x06, 0x20, 0x08, 0xf0, 0x05, 0x08, 0x12, 0x07, 0x06, 0x01, 0x07,
+    0x03, 0x38, 0x0a, 0x04, 0x02, 0x04, 0x0b, 0x09, 0x0c, 0x05, 0x0b, 0x03,
+    0x0c, 0x05, 0x1e, 0x04, 0x12, 0x1b, 0xf0, 0x05, 0x1a, 0x04, 0x03, 0x07,
+    0x05, 0x16, 0x0e, 0x08, 0x04, 0x03, 0x03, 0x04, 0x02, 0x0c, 0x21, 0x06,
+    0x02, 0x04, 0x10, 0x05, 0x01, 0x01, 0x00, 0x02, 0xf0, 0x11, 0x03, 0x14,
+    0x10, 0x26, 0x12, 0x10, 0x07, 0x0c, 0x02, 0x1b, 0x03, 0x02, 0x0a, 0x03,
+    0x0c, 0x05, 0x0b, 0x04, 0x1a, 0x03, 0x05, 0x0c, 0x00, 0x08, 0x07, 0x71,
+    0x15, 0x08, 0x09, 0x0a, 0x1d, 0x0f, 0x05, 0x09, 0x04, 0x08, 0x18, 0x07,
+    0x0c, 0xf0, 0x03, 0x2a, 0x12, 0x01, 0x08, 0x10, 0x07, 0x0a, 0x21, 0x0c,
+    0x0a, 0x19, 0x02, 0x04, 0x37, 0x02, 0x01, 0x02, 0x03, 0x08, 0x01, 0x0c,
+    0xf0, 0x00, 0x0e, 0x11, 0x0b, 0x08, 0x10, 0x07, 0x18, 0x02, 0x13, 0x06,
+    0x35, 0x06, 0x0b, 0x05, 0x12, 0x06, 0x07, 0x03, 0x05, 0x02, 0x14, 0x21,
+    0xf0, 0x15, 0x10, 0x16, 0x01, 0x0a, 0x22, 0x0b, 0x08, 0x0b, 0x04, 0x1a,
+    0x03, 0x01, 0x0b, 0x02, 0x09, 0x13, 0x0e, 0x0d, 0x02, 0x0e, 0x03, 0x0f,
+    0xf0, 0x04, 0x0c, 0x03, 0x09, 0x02, 0x0b, 0x03, 0x1a, 0x04, 0x13, 0x0d,
+    0x0e, 0x14, 0x0d, 0x0b, 0x02, 0x0c, 0x01, 0x0f, 0x12, 0x1e, 0x11, 0x09,
+    0x07, 0x02, 0x25, 0xf0, 0x01, 0x10, 0x08, 0x11, 0x19, 0x02, 0x07, 0x13,
+    0x09, 0x1b, 0x02, 0x03, 0x0a, 0x05, 0x09, 0x06, 0x0a, 0x15, 0x0b, 0x1a,
+    0x06, 0x04, 0x0b, 0xf0, 0x12, 0x0c, 0x0a, 0x04, 0x19, 0x05, 0x04, 0x0c,
+    0x15, 0x0b, 0x0d, 0x03, 0x09, 0x12, 0x17, 0x01, 0x08, 0x50, 0x06, 0x15,
+    0x03, 0x22, 0xf0, 0x11, 0x43, 0x12, 0x13, 0x02, 0x14, 0x03, 0x14, 0x05,
+    0x06, 0x03, 0x38, 0x05, 0x06, 0x04, 0x03, 0x09, 0xf0, 0x05, 0x0a, 0x17,
+    0x1b, 0x0a, 0x0c, 0x0f, 0x2b, 0x0a, 0x07, 0x09, 0x0a, 0x08, 0x0b, 0x06,
+    0x1a, 0x04, 0x03, 0x0b, 0x02, 0x0a, 0x01, 0x08, 0x10, 0x07, 0x09, 0xf0,
+    0x31, 0x08, 0x19, 0x0c, 0x02, 0x07, 0x11, 0x08, 0x0a, 0x12, 0x19, 0x01,
+    0x0c, 0x12, 0x08, 0x1a, 0x01, 0x10, 0x0d, 0x2f, 0x01, 0xf0, 0x02, 0x03,
+    0x0d, 0x14, 0x0a, 0x09, 0x03, 0x38, 0x22, 0x01, 0x07, 0x40, 0x09, 0x0c,
+    0x0b, 0x05, 0x06, 0x01, 0x17, 0x32, 0xf0, 0x09, 0x0d, 0x1f, 0x11, 0x0e,
+    0x02, 0x1b, 0x23, 0x1a, 0x14, 0x09, 0x0b, 0x02, 0x1e, 0x01, 0x02, 0x1c,
+    0x23, 0x1b, 0xf0, 0x04, 0x28, 0x03, 0x02, 0x03, 0x16, 0x14, 0x15, 0x13,
+    0x06, 0x02, 0x07, 0x01, 0x16, 0x10, 0x08, 0x01, 0x07, 0x12, 0x06, 0x08,
+    0xf0, 0x03, 0x07, 0x04, 0x06, 0x03, 0x07, 0x04, 0x06, 0x08, 0x25, 0x0d,
+    0x2b, 0x06, 0x27, 0x07, 0x14, 0x06, 0x07, 0x35, 0x09, 0x0d, 0x0e, 0xf0,
+    0x0c, 0x04, 0x07, 0x03, 0x06, 0x32, 0x05, 0x04, 0x23, 0x31, 0x02, 0x01,
+    0x10, 0x02, 0x23, 0x01, 0x22, 0x04, 0x05, 0xf0, 0x21, 0x07, 0x06, 0x19,
+    0x02, 0x13, 0x08, 0x0b, 0x14, 0x0a, 0x0c, 0x13, 0x0e, 0x0a, 0x04, 0x09,
+    0x06, 0x0a, 0x07, 0x3c, 0x18, 0x06, 0xf0, 0x14, 0x0d, 0x0b, 0x05, 0x0c,
+    0x06, 0x2a, 0x05, 0x04, 0x03, 0x09, 0x01, 0x0c, 0x10, 0x0e, 0x0b, 0x71,
+    0x07, 0x08, 0x0a, 0x0c, 0x0a, 0x08, 0xf0, 0x07, 0x0a, 0x32, 0x09, 0x0b,
+    0x0a, 0x09, 0x21, 0x0c, 0x09, 0x0a, 0x02, 0x09, 0x03, 0x0b, 0x14, 0x0a,
+    0x0c, 0x03, 0x0e, 0x02, 0x1d, 0x51, 0xf0, 0x0b, 0x0d, 0x0e, 0x0a, 0x08,
+    0x30, 0x0b, 0x18, 0x1e, 0x01, 0x62, 0x0b, 0x0d, 0x0b, 0x09, 0x17, 0xf0,
+    0x19, 0x23, 0x0b, 0x09, 0x02, 0x0b, 0x11, 0x0d, 0x0a, 0x02, 0x07, 0x04,
+    0x16, 0x05, 0x14, 0x07, 0x06, 0x03, 0x17, 0x22, 0x06, 0x07, 0xf0, 0x03,
+    0x18, 0x04, 0x03, 0x09, 0x02, 0x1a, 0x01, 0x10, 0x1f, 0x01, 0x0c, 0x62,
+    0x0a, 0x0d, 0x0c, 0x0f, 0x0e, 0x0a, 0x0d, 0x03, 0x0e, 0xf0, 0x15, 0x1d,
+    0x04, 0x0e, 0x23, 0x0b, 0x18, 0x04, 0x1a, 0x15, 0x0d, 0x04, 0x1e, 0x03,
+    0x02, 0x0c, 0x01, 0x09, 0x10, 0x0a, 0x09, 0x11, 0x07, 0xf0, 0x06, 0x30,
+    0x08, 0x05, 0x04, 0x13, 0x81, 0x05, 0x26, 0x08, 0x17, 0x0a, 0x02, 0x0c,
+    0x13, 0x1b, 0xf0, 0x22, 0x0e, 0x1a, 0x03, 0x0b, 0x05, 0x0d, 0x06, 0x0c,
+    0x15, 0x0d, 0x0a, 0x06, 0x09, 0x25, 0x07, 0x06, 0x07, 0x07, 0x28, 0x08,
+    0x07, 0xf0, 0x04, 0x19, 0x02, 0x91, 0x0b, 0x0a, 0x0f, 0x0d, 0x0b, 0x28,
+    0x07, 0x18, 0x32, 0x0a, 0x18, 0xf0, 0x21, 0x09, 0x07, 0x19, 0x53, 0x0d,
+    0x2e, 0x18, 0x52, 0x07, 0x08, 0x09, 0x07, 0x16, 0x01, 0xf0, 0x10, 0x08,
+    0x17, 0x01, 0x62, 0x28, 0x19, 0x07, 0x08, 0x33, 0x07, 0x08, 0x47, 0x02,
+    0x11, 0xf0, 0x02, 0x08, 0x33, 0x0a, 0x0c, 0x0a, 0x08, 0x02, 0x0b, 0x11,
+    0x0d, 0x0b, 0x02, 0x28, 0x23, 0x09, 0x02, 0x0d, 0x01, 0x0b, 0x00, 0x0f,
+    0xf0, 0x01, 0x0b, 0x62, 0x1c, 0x0a, 0x0b, 0x0a, 0x08, 0x09, 0x03, 0x18,
+    0x34, 0x0a, 0x0b, 0x0a, 0x03, 0x0b, 0x02, 0x0c, 0x03, 0x0a, 0xf0, 0x05,
+    0x0c, 0x07, 0x1b, 0x06, 0x05, 0x0c, 0x04, 0x0b, 0x02, 0x0d, 0x61, 0x0c,
+    0x09, 0x08, 0x07, 0x06, 0x05, 0x13, 0x00, 0x11, 0x02, 0x23, 0xf0, 0x12,
+    0x31, 0x25, 0x06, 0x02, 0x15, 0x13, 0x16, 0x04, 0x05, 0x25, 0x04, 0x13,
+    0x46, 0x05, 0x08, 0xf0, 0x1b, 0x09, 0x05, 0x06, 0x06, 0x35, 0x17, 0x08,
+    0x09, 0x06, 0x0b, 0x05, 0x0d, 0x04, 0x0b, 0x02, 0x0d, 0xa1, 0x3f, 0xf0,
+    0x0b, 0x08, 0x06, 0x07, 0x08, 0x0b, 0x0d, 0x22, 0x0a, 0x09, 0x07, 0x21,
+    0x09, 0x08, 0x1c, 0x02, 0x24, 0x09, 0x0a, 0xf0, 0x09, 0x13, 0x0a, 0x0b,
+    0x42, 0x0f, 0x0d, 0x09, 0x0a, 0x19, 0x01, 0x30, 0x0b, 0x17, 0x19, 0x31,
+    0x1a, 0xf0, 0x09, 0x02, 0x07, 0x03, 0x26, 0x34, 0x47, 0x03, 0x02, 0x21,
+    0x09, 0x0c, 0x02, 0x0e, 0x13, 0x1a, 0x52, 0x29, 0xf0, 0x18, 0x0b, 0x03,
+    0x0a, 0x12, 0x0c, 0x0a, 0x21, 0x0e, 0x1c, 0x42, 0x0b, 0x0d, 0x0a, 0x17,
+    0xf0, 0x13, 0x06, 0x07, 0x14, 0x06, 0x07, 0x15, 0x08, 0x07, 0x04, 0x18,
+    0x23, 0x09, 0x3b, 0x05, 0x17, 0x05, 0x0d, 0x13, 0x0f, 0x0c, 0xf0, 0x12,
+    0x0b, 0x19, 0x31, 0x08, 0x07, 0x15, 0x70, 0x14, 0x05, 0x36, 0x01, 0x05,
+    0x02, 0x14, 0xf0, 0x23, 0x05, 0x47, 0x14, 0x03, 0x12, 0x1a, 0x03, 0x24,
+    0x0d, 0x2e, 0x33, 0x0c, 0x1e, 0xf0, 0x04, 0x29, 0x05, 0x17, 0x08, 0x06,
+    0x37, 0x04, 0x23, 0x08, 0x02, 0x0a, 0x61, 0x0b, 0x07, 0x06, 0x07, 0x09,
+    0x1d, 0xf0, 0x22, 0x09, 0x0b, 0x28, 0x21, 0x0d, 0x02, 0x1c, 0x63, 0x0d,
+    0x0b, 0x09, 0x0b, 0x0a, 0x08, 0x22, 0x0a, 0xf0, 0x19, 0x01, 0x1b, 0x70,
+    0x07, 0x08, 0x0b, 0x3f, 0x01, 0x0c, 0x02, 0x0e, 0x13, 0x1b, 0x04, 0x19,
+    0xf0, 0x05, 0x04, 0x08, 0x02, 0x2a, 0x21, 0x0e, 0x22, 0x0d, 0x0c, 0x09,
+    0x51, 0x0e, 0x0c, 0x0e, 0x3f, 0x02, 0xf0, 0x03, 0x1a, 0x02, 0x11, 0x0b,
+    0x0c, 0x02, 0x08, 0x13, 0x07, 0x08, 0x02, 0x09, 0x11, 0x1c, 0x02, 0x0a,
+    0x23, 0x08, 0x09, 0x0b, 0x04, 0x0c, 0x05, 0x1a, 0xf0, 0x04, 0x12, 0x0c,
+    0x0a, 0x03, 0x0d, 0x05, 0x0c, 0x07, 0x0b, 0x06, 0x0e, 0x05, 0x0b, 0x14,
+    0x09, 0x0a, 0x03, 0x0c, 0x02, 0x0b, 0x31, 0x1c, 0x0a, 0x15, 0xf0, 0x80,
+    0x13, 0x04, 0x06, 0x25, 0x18, 0x01, 0x12, 0x07, 0x18, 0x03, 0x04, 0x0a,
+    0x03, 0x0e, 0x22, 0x0a, 0xf0, 0x07, 0x09, 0x03, 0x18, 0x15, 0x0a, 0x03,
+    0x0d, 0x02, 0x0e, 0x03, 0x0b, 0x04, 0x0a, 0x13, 0x1d, 0x04, 0x0c, 0x16,
+    0x0b, 0x0c, 0x05, 0x0a, 0x43, 0x09, 0xf0, 0x08, 0x0a, 0x0e, 0x0b, 0x02,
+    0x09, 0x51, 0x17, 0x1c, 0x08, 0x0a, 0x22, 0x19, 0x07, 0x21, 0x08, 0x06,
+    0xf0, 0x08, 0x02, 0x0d, 0x04, 0x09, 0x03, 0x0a, 0x12, 0x1c, 0x23, 0x0b,
+    0x0a, 0x07, 0x22, 0x08, 0x0a, 0x0b, 0x01, 0x1d, 0x30, 0x17, 0xf0, 0x0b,
+    0x11, 0x0a, 0x08, 0x10, 0x0a, 0x0c, 0x02, 0x08, 0x23, 0x09, 0x0a, 0x0c,
+    0x04, 0x0d, 0x15, 0x0c, 0x0a, 0x03, 0x09, 0x21, 0x0d, 0x09, 0x1e, 0xf0,
+    0x12, 0x0b, 0x01, 0x0a, 0x00, 0x0d, 0x01, 0x09, 0x02, 0x08, 0x11, 0x0c,
+    0x09, 0x02, 0x08, 0x23, 0x19, 0x18, 0x02, 0x01, 0x09, 0x02, 0x07, 0x13,
+    0x1a, 0xf0, 0x02, 0x08, 0x01, 0x09, 0x02, 0x08, 0x13, 0x09, 0x0b, 0x12,
+    0x1e, 0x04, 0x2b, 0x05, 0x04, 0x03, 0x09, 0x12, 0x0a, 0x0c, 0x04, 0x0e,
+    0x07, 0x0d, 0xf0, 0x05, 0x0c, 0x03, 0x0d, 0x04, 0x0b, 0x05, 0x0d, 0x04,
+    0x0b, 0x02, 0x1e, 0x31, 0x1b, 0x07, 0x70, 0x06, 0x13, 0x04, 0x16, 0xf0,
+    0x04, 0x05, 0x31, 0x06, 0x1c, 0x0d, 0x02, 0x1b, 0x03, 0x04, 0x09, 0x03,
+    0x08, 0x11, 0x0b, 0x09, 0x02, 0x0c, 0x14, 0x0a, 0x19, 0x03, 0xf0, 0x02,
+    0x0c, 0x03, 0x0a, 0x14, 0x1c, 0x13, 0x0b, 0x0d, 0x06, 0x0b, 0x07, 0x0c,
+    0x05, 0x0b, 0x03, 0x0c, 0x02, 0x0d, 0x03, 0x0a, 0x14, 0x1c, 0x02, 0x0d,
+    0x61, 0x0c, 0xf0, 0x0d, 0x0f, 0x0e, 0x08, 0x07, 0x1a, 0x02, 0x01, 0x1e,
+    0x10, 0x0a, 0x01, 0x07, 0x02, 0x09, 0x13, 0x0b, 0x0a, 0x12, 0x19, 0xf0,
+    0x13, 0x0a, 0x09, 0x42, 0x08, 0x07, 0x08, 0x0a, 0x08, 0x01, 0x17, 0x20,
+    0x08, 0x0e, 0x31, 0x09, 0x0a, 0x28, 0x02, 0xf0, 0x23, 0x0b, 0x0a, 0x08,
+    0x04, 0x3a, 0x06, 0x05, 0x03, 0x02, 0x08, 0x11, 0x0b, 0x0e, 0x12, 0x0b,
+    0x19, 0x21, 0x07, 0x08, 0x12, 0x17, 0xf0, 0x11, 0x0a, 0x0c, 0x02, 0x0f,
+    0x03, 0x0c, 0x02, 0x0d, 0x21, 0x2f, 0x02, 0x0b, 0x03, 0x0a, 0x02, 0x1c,
+    0x01, 0x02, 0x08, 0x13, 0x2a, 0xf0, 0x12, 0x0b, 0x03, 0x0c, 0x14, 0x0b,
+    0x09, 0x23, 0x08, 0x07, 0x09, 0x04, 0x0a, 0x15, 0x1b, 0x04, 0x0a, 0x03,
+    0x0e, 0x15, 0x0b, 0x0a, 0x03, 0x08, 0xf0, 0x22, 0x07, 0x08, 0x07, 0x01,
+    0x16, 0x70, 0x04, 0x03, 0x04, 0x16, 0x05, 0x06, 0x31, 0x07, 0x0c, 0x0b,
+    0x0a, 0xf0, 0x02, 0x08, 0x13, 0x09, 0x18, 0x02, 0x21, 0x1d, 0x0f, 0x02,
+    0x0e, 0x23, 0x0b, 0x08, 0x07, 0x04, 0x08, 0x15, 0x09, 0x08, 0x04, 0x19,
+    0x05, 0xf0, 0x16, 0x1b, 0x05, 0x1a, 0x04, 0x13, 0x0d, 0x0c, 0x14, 0x0a,
+    0x0c, 0x03, 0x0b, 0x22, 0x0a, 0x09, 0x0a, 0x01, 0x0e, 0x10, 0x0f, 0x0e,
+    0x51, 0x19, 0xf0, 0x27, 0x08, 0x02, 0x07, 0x13, 0x18, 0x12, 0x0a, 0x0b,
+    0x13, 0x0a, 0x09, 0x32, 0x08, 0x07, 0x18, 0xf0, 0x01, 0x0a, 0x30, 0x0f,
+    0x0c, 0x0b, 0x0f, 0x31, 0x0a, 0x0d, 0x0a, 0x0e, 0x02, 0x0d, 0x03, 0x0a,
+    0x12, 0x0d, 0x1c, 0x03, 0x14, 0x0a, 0x08, 0xf0, 0x13, 0x09, 0x27, 0x32,
+    0x09, 0x08, 0x51, 0x09, 0x08, 0x0b, 0x0e, 0x0c, 0x0b, 0x02, 0x09, 0x13,
+    0x18, 0x42, 0x0c, 0xf0, 0x0a, 0x18, 0x0b, 0x13, 0x09, 0x07, 0x02, 0x08,
+    0x13, 0x07, 0x08, 0x22, 0x0a, 0x08, 0x0b, 0x53, 0x09, 0x2a, 0xf0, 0x08,
+    0x2a, 0x04, 0x05, 0x04, 0x0c, 0x03, 0x0e, 0x04, 0x19, 0x05, 0x04, 0x0a,
+    0x22, 0x0c, 0x1a, 0x01, 0x0d, 0x80, 0x0e, 0x09, 0x06, 0xf0, 0x04, 0x05,
+    0x17, 0x06, 0x08, 0x31, 0x07, 0x08, 0x07, 0x08, 0x62, 0x07, 0x09, 0x28,
+    0x07, 0xf0, 0x08, 0x03, 0x09, 0x04, 0x18, 0x13, 0x09, 0x04, 0x1b, 0x05,
+    0x14, 0x0a, 0x0d, 0x16, 0x2b, 0x15, 0x0a, 0x04, 0x0b, 0x13, 0x29, 0xf0,
+    0x14, 0x0b, 0x03, 0x09, 0x12, 0x1a, 0x03, 0x07, 0x02, 0x16, 0x71, 0x07,
+    0x08, 0x17, 0x08, 0x16, 0x02, 0x07, 0xf0, 0x03, 0x08, 0x02, 0x0a, 0x01,
+    0x0f, 0x02, 0x0b, 0x13, 0x09, 0x07, 0x32, 0x08, 0x09, 0x0a, 0x09, 0x41,
+    0x0b, 0x0a, 0x08, 0x06, 0x07, 0x12, 0x08, 0xf0, 0x0a, 0x11, 0x0d, 0x0f,
+    0x12, 0x0e, 0x0d, 0x01, 0x0f, 0x02, 0x09, 0x13, 0x18, 0x62, 0x0d, 0x0e,
+    0x09, 0x07, 0x08, 0x0c, 0x0e, 0xf0, 0x21, 0x0f, 0x0c, 0x0f, 0x02, 0x09,
+    0x11, 0x0d, 0x0c, 0x02, 0x0b, 0x03, 0x08, 0x22, 0x0b, 0x1a, 0x11, 0x0e,
+    0x1c, 0x02, 0x03, 0x0b, 0x32, 0x0d, 0xf0, 0x09, 0x0a, 0x0b, 0x11, 0x0f,
+    0x0d, 0x02, 0x09, 0x53, 0x08, 0x19, 0x0b, 0x0c, 0x0a, 0x04, 0x09, 0x06,
+    0x0a, 0x05, 0x1b, 0x13, 0xf0, 0x0a, 0x04, 0x19, 0x03, 0x12, 0x08, 0x0a,
+    0x03, 0x27, 0x02, 0x21, 0x06, 0x05, 0x90, 0x16, 0x09, 0x0b, 0x08, 0x07,
+    0xf0, 0x0a, 0x0e, 0x0a, 0x0d, 0x31, 0x0b, 0x0e, 0x0c, 0x0e, 0x22, 0x0b,
+    0x19, 0x03, 0x0a, 0x04, 0x0b, 0x13, 0x0c, 0x1a, 0x24, 0xf0, 0x0d, 0x0c,
+    0x05, 0x0b, 0x16, 0x0d, 0x1e, 0x05, 0x14, 0x0c, 0x1a, 0x03, 0x12, 0x0d,
+    0x0e, 0x03, 0x0c, 0x02, 0x1f, 0xc1, 0x1d, 0xf0, 0x09, 0x07, 0x09, 0x0a,
+    0x08, 0x07, 0x18, 0x09, 0x0e, 0x92, 0x0b, 0x0c, 0x09, 0x08, 0x09, 0x0a,
+    0xf0, 0x08, 0x09, 0x0c, 0x0b, 0x41, 0x0c, 0x19, 0x27, 0xf2, 0x0a, 0x38,
+    0x07, 0xf0, 0x08, 0x0b, 0x0a, 0x09, 0x28, 0x09, 0x1b, 0x13, 0x09, 0x42,
+    0x0a, 0x0b, 0x0d, 0x0a, 0x0b, 0xf0, 0x13, 0x1a, 0x22, 0x0c, 0x1a, 0x21,
+    0x0f, 0x0e, 0x0f, 0x12, 0x0c, 0x0b, 0x41, 0x0f, 0x1e, 0x0d, 0x0b, 0x32,
+    0x08, 0xf0, 0x0b, 0x0a, 0x19, 0x33, 0x0b, 0x0a, 0x0d, 0x14, 0x0e, 0x0d,
+    0x03, 0x0c, 0x62, 0x0f, 0x0e, 0x0b, 0x29, 0xf0, 0x08, 0x61, 0x09, 0x08,
+    0x07, 0x06, 0x05, 0x06, 0x08, 0x50, 0x0e, 0x0a, 0x0b, 0x0f, 0x0d, 0x0f,
+    0x31, 0x0a, 0x0b, 0xf0, 0x0a, 0x0e, 0x22, 0x0a, 0x0b, 0x0c, 0x03, 0x0a,
+    0x14, 0x09, 0x08, 0x13, 0x1a, 0x24, 0x09, 0x2a, 0x15, 0x0c, 0x04, 0x0b,
+    0xf0, 0x23, 0x0e, 0x0f, 0x1c, 0x32, 0x0a, 0x0d, 0x09, 0x81, 0x0b, 0x0a,
+    0x0b, 0x0a, 0x09, 0x0d, 0x0e, 0x0c, 0x0a, 0xf0, 0x02, 0x07, 0x03, 0x06,
+    0x14, 0x44, 0x15, 0x04, 0x05, 0xa3, 0x16, 0x05, 0x06, 0x07, 0x06, 0x25,
+    0xf0, 0x04, 0x05, 0xf2, 0x06, 0x07, 0x16, 0x07, 0x08, 0x07, 0x08, 0x0a,
+    0x09, 0x18, 0x0b, 0xf0, 0x09, 0x08, 0x0d, 0x02, 0x0a, 0x93, 0x08, 0x07,
+    0x08, 0x09, 0x18, 0x19, 0x07, 0x05, 0x04, 0x04, 0x05, 0x03, 0x06, 0xf0,
+    0x32, 0x17, 0x09, 0x08, 0x81, 0x0b, 0x0d, 0x1f, 0x0d, 0x3f, 0x22, 0x0c,
+    0x0e, 0x0c, 0xf0, 0x03, 0x48, 0x14, 0x33, 0x09, 0x08, 0x22, 0x29, 0xf1,
+    0x0f, 0x0c, 0x0e, 0x0d, 0x09, 0x08, 0xf0, 0x1a, 0x17, 0x09, 0x0a, 0x19,
+    0x0b, 0x1c, 0x11, 0x0f, 0x22, 0x2a, 0x13, 0x08, 0xf0, 0x0b, 0x12, 0x0f,
+    0x0d, 0x93, 0x09, 0x0b, 0x1a, 0x1c, 0x0b, 0x1c, 0x09, 0x22, 0x0c, 0x1b,
+    0xf0, 0x91, 0x0f, 0x1c, 0x1e, 0x0b, 0x0d, 0x2e, 0xf2, 0x09, 0x08, 0x07,
+    0x08, 0x0a, 0x09, 0xf0, 0x18, 0x09, 0x0a, 0x59, 0x02, 0x08, 0x51, 0x0d,
+    0x0b, 0x1d, 0x0b, 0xf0, 0x0c, 0xf2, 0x28, 0x29, 0x1a, 0x0b, 0x1a, 0x0b,
+    0x0c, 0x1b, 0xf0, 0x0c, 0xf2, 0x0e, 0x0d, 0x2c, 0x1b, 0x0a, 0x09, 0x28,
+    0x17, 0x78, 0xf0, 0xf2, 0x19, 0x1a, 0x0b, 0x0c, 0x0d, 0x1e, 0xf0, 0x0c,
+    0x52, 0x0b, 0x0a, 0x19, 0x18, 0xc1, 0x0f, 0x0e, 0x0d, 0x0c, 0x1b, 0x0c,
+    0x3d, 0xf0, 0x1e, 0xf2, 0x18, 0x09, 0x0a, 0x2b, 0x0c, 0x1d, 0x1c, 0xf0,
+    0x3d, 0xf2, 0x1e, 0x0d, 0x0b, 0x0a, 0x19, 0xe8, 0xf0, 0xf2, 0xb9, 0xf0,
+    0xf2, 0x68, 0x39, 0x10, 0xf5, 0xf1, 0xf2, 0x25, 0x21, 0xf2, 0xf3, 0xf2,
+    0xf2, 0xf3, 0xf2, 0xf2, 0xf3, 0xf2, 0x02, 0x03, 0x02
+};
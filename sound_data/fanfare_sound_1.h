@@ -0,0 +1,1365 @@
+const uint8_t fanfare_sound_1 [] = {
+    0xfb, 0xf2, 0xf1, 0xfb, 0xf2, 0xf1, 0x0b, 0xf2, 0xf1, 0x1c, 0x0b, 0x0c,
+    0xfb, 0xf2, 0xf1, 0x1b, 0x0a, 0x19, 0x0c, 0x1e, 0x0c, 0x1b, 0x5c, 0xf2,
+    0xf1, 0x2b, 0x2c, 0x0b, 0x0c, 0x0b, 0x0a, 0x28, 0x72, 0x71, 0x0a, 0x0d,
+    0x1e, 0x0c, 0x9a, 0xf4, 0xf0, 0x1b, 0x5a, 0xf4, 0xf0, 0x2b, 0x09, 0x08,
+    0x17, 0x08, 0x0a, 0x0c, 0x0d, 0x0c, 0x0b, 0x3a, 0xf4, 0xf0, 0x1b, 0x3a,
+    0x3b, 0x1a, 0x0b, 0x0c, 0x44, 0xf0, 0x0d, 0x0c, 0x0a, 0x07, 0x04, 0x05,
+    0x03, 0x16, 0x04, 0x05, 0x08, 0x16, 0x19, 0x05, 0x0a, 0xf4, 0x0c, 0x3a,
+    0xf0, 0x0c, 0x0b, 0x1a, 0x0b, 0x1c, 0x3b, 0x44, 0x0c, 0x1e, 0x0c, 0x19,
+    0xf0, 0x03, 0x02, 0x08, 0x01, 0x0a, 0x02, 0x09, 0x04, 0x0b, 0x06, 0x0c,
+    0x07, 0x2a, 0x06, 0x05, 0xf4, 0x0b, 0x29, 0x1b, 0x0a, 0xf0, 0x0b, 0x0c,
+    0x1d, 0x2c, 0x1b, 0x34, 0x0c, 0x0b, 0x0a, 0x38, 0x03, 0x12, 0xf0, 0x03,
+    0x0b, 0x14, 0x1e, 0x13, 0x2f, 0x04, 0x05, 0x1e, 0x54, 0x1a, 0x29, 0x25,
+    0x08, 0x1a, 0xf0, 0xa4, 0x0e, 0x0c, 0x1b, 0x0a, 0x0b, 0x0c, 0x0d, 0x0c,
+    0x0a, 0x18, 0x03, 0x12, 0x1a, 0x03, 0x0b, 0x04, 0x0d, 0xf0, 0x05, 0x0a,
+    0x03, 0x1c, 0x02, 0x03, 0x0e, 0x16, 0x1b, 0x05, 0x0a, 0xf4, 0x0b, 0x2a,
+    0x0b, 0x0c, 0x2e, 0xf0, 0x0c, 0x0b, 0x1a, 0x09, 0x2a, 0x34, 0x0b, 0x0c,
+    0x0b, 0x03, 0x0c, 0x02, 0x0a, 0x11, 0x0b, 0x0e, 0x03, 0x0b, 0xf0, 0x45,
+    0x0c, 0x0b, 0x09, 0x1a, 0xc4, 0x0c, 0x0a, 0x0b, 0x1c, 0x0d, 0x0e, 0x0d,
+    0x0e, 0x0d, 0x0c, 0xf0, 0x0b, 0x0a, 0x33, 0x0e, 0x0d, 0x0c, 0x0e, 0x04,
+    0x1a, 0x35, 0x0c, 0x0b, 0x28, 0x03, 0x01, 0x00, 0x1c, 0x02, 0x07, 0x0d,
+    0xf0, 0x08, 0x0e, 0x05, 0x0c, 0xe4, 0x0e, 0x0b, 0x19, 0x0b, 0x0e, 0x1f,
+    0x0e, 0x0b, 0x0a, 0x0b, 0x0c, 0x0b, 0xf0, 0x0a, 0x33, 0x0e, 0x1b, 0x0e,
+    0x04, 0x0b, 0x06, 0x18, 0x17, 0x27, 0x05, 0x03, 0x11, 0x08, 0x16, 0x04,
+    0x1b, 0x17, 0xf0, 0x16, 0x19, 0x05, 0x1a, 0x34, 0x19, 0x0c, 0x25, 0x0b,
+    0x0c, 0x1a, 0x54, 0x09, 0x0b, 0x0c, 0x0b, 0x0a, 0xf0, 0x43, 0x0d, 0x1b,
+    0x0d, 0x0f, 0x04, 0x0e, 0x05, 0x0d, 0x06, 0x0a, 0x05, 0x09, 0x03, 0x08,
+    0x01, 0x07, 0x00, 0x08, 0x02, 0x09, 0x09, 0x2a, 0x0e, 0x07, 0xf0, 0x06,
+    0x29, 0x05, 0x04, 0x13, 0x0d, 0x0e, 0x04, 0x1c, 0x05, 0x06, 0x39, 0x05,
+    0x64, 0x0a, 0x1c, 0x0b, 0x0a, 0xf0, 0x33, 0x0d, 0x1c, 0x0e, 0x04, 0x1c,
+    0x05, 0x06, 0x0a, 0x05, 0x29, 0x03, 0x01, 0x00, 0x08, 0x02, 0x07, 0x0a,
+    0x08, 0x0f, 0x39, 0x0a, 0x07, 0xf0, 0x05, 0x04, 0x08, 0x13, 0x0a, 0x0b,
+    0x04, 0x1c, 0x15, 0x1e, 0x34, 0x09, 0x08, 0x0a, 0x25, 0x09, 0x0a, 0x09,
+    0x04, 0x0a, 0x33, 0x0d, 0xf0, 0x1b, 0x1c, 0x04, 0x05, 0x0d, 0x06, 0x0a,
+    0x05, 0x19, 0x03, 0x01, 0x08, 0x00, 0x07, 0x02, 0x08, 0x09, 0x09, 0x0e,
+    0x0a, 0x0d, 0x29, 0x08, 0x05, 0xf0, 0x04, 0x08, 0x13, 0x09, 0x1a, 0x04,
+    0x05, 0x0b, 0x16, 0x0a, 0x08, 0x05, 0x07, 0x44, 0x08, 0x09, 0x0c, 0x0e,
+    0x0d, 0x43, 0x0f, 0x0e, 0x1b, 0xf0, 0x0c, 0x04, 0x1b, 0x05, 0x06, 0x1a,
+    0x05, 0x03, 0x09, 0x01, 0x17, 0x00, 0x02, 0x09, 0x09, 0x0b, 0x0d, 0x0c,
+    0x09, 0x0e, 0x06, 0x1d, 0x04, 0x23, 0x0b, 0xf0, 0x08, 0x1a, 0x04, 0x05,
+    0x0c, 0x06, 0x1b, 0x05, 0x64, 0x0a, 0x09, 0x0a, 0x0c, 0x0d, 0x0b, 0x09,
+    0x33, 0x0e, 0x1c, 0xf0, 0x0e, 0x04, 0x1b, 0x15, 0x0c, 0x04, 0x0b, 0x02,
+    0x1e, 0x10, 0x18, 0x03, 0x0b, 0x0a, 0x0e, 0x0d, 0x0a, 0x2c, 0x06, 0x04,
+    0x23, 0x0a, 0x08, 0xf0, 0x09, 0x04, 0x0a, 0x05, 0x0d, 0x06, 0x2b, 0x05,
+    0x64, 0x19, 0x0b, 0x0c, 0x0b, 0x09, 0x33, 0x0e, 0x1c, 0x0e, 0xf0, 0x04,
+    0x0c, 0x15, 0x1b, 0x04, 0x09, 0x02, 0x08, 0x10, 0x09, 0x0d, 0x03, 0x0f,
+    0x0a, 0x0e, 0x0f, 0x0c, 0x0a, 0x2b, 0x06, 0x04, 0x23, 0x0a, 0x08, 0x09,
+    0xf0, 0x04, 0x0a, 0x06, 0x0b, 0x07, 0x0a, 0x06, 0x09, 0x05, 0x08, 0x54,
+    0x19, 0x0a, 0x0b, 0x0a, 0x09, 0x23, 0x2c, 0x04, 0x39, 0x05, 0xf0, 0x06,
+    0x05, 0x03, 0x0a, 0x01, 0x0b, 0x00, 0x09, 0x01, 0x0a, 0x04, 0x1e, 0x0b,
+    0x0f, 0x0c, 0x0a, 0x1a, 0x06, 0x04, 0x19, 0x23, 0x08, 0x0a, 0x04, 0x0c,
+    0xf0, 0x16, 0x1b, 0x05, 0x0a, 0x54, 0x0b, 0x09, 0x2a, 0x09, 0x33, 0x0e,
+    0x1c, 0x0e, 0x04, 0x3b, 0x15, 0xf0, 0x04, 0x03, 0x18, 0x01, 0x00, 0x0a,
+    0x02, 0x08, 0x07, 0x0a, 0x0f, 0x2c, 0x0e, 0x07, 0x05, 0x0a, 0x03, 0x0d,
+    0x12, 0x1f, 0x03, 0x0c, 0x04, 0x1e, 0x25, 0xf0, 0x0d, 0x0a, 0x54, 0x0c,
+    0x0a, 0x39, 0x33, 0x0e, 0x0d, 0x0c, 0x0e, 0x04, 0x0c, 0x15, 0x0b, 0x0c,
+    0x04, 0x0a, 0xf0, 0x02, 0x0b, 0x10, 0x0f, 0x0b, 0x02, 0x0d, 0x08, 0x1e,
+    0x0f, 0x0a, 0x1c, 0x06, 0x04, 0x0d, 0x23, 0x0c, 0x09, 0x0a, 0x04, 0x09,
+    0x35, 0x0a, 0x0d, 0x0b, 0xf0, 0x09, 0x64, 0x0a, 0x59, 0x23, 0x0d, 0x0b,
+    0x1e, 0x04, 0x15, 0x1c, 0x04, 0x19, 0x02, 0xf0, 0x10, 0x0a, 0x1c, 0x03,
+    0x0d, 0x0d, 0x0f, 0x0e, 0x09, 0x0d, 0x06, 0x0c, 0x04, 0x1b, 0x23, 0x09,
+    0x1a, 0x04, 0x15, 0x0b, 0x0c, 0x74, 0x0e, 0x0b, 0xf0, 0x3a, 0x19, 0x23,
+    0x0d, 0x0b, 0x0c, 0x04, 0x09, 0x05, 0x1a, 0x06, 0x05, 0x2b, 0x03, 0x01,
+    0x00, 0x09, 0xf0, 0x01, 0x08, 0x05, 0x0a, 0x1f, 0x0d, 0x0b, 0x09, 0x0a,
+    0x06, 0x09, 0x04, 0x0a, 0x23, 0x0b, 0x09, 0x1b, 0x04, 0x15, 0x0a, 0x0b,
+    0x54, 0x0c, 0x3b, 0xf0, 0x0a, 0x43, 0x0e, 0x1d, 0x1c, 0x04, 0x3a, 0x05,
+    0x06, 0x05, 0x03, 0x09, 0x01, 0x18, 0x00, 0x01, 0x0c, 0xf0, 0x06, 0x1f,
+    0x0f, 0x0c, 0x0e, 0x07, 0x0c, 0x05, 0x0a, 0x33, 0x0e, 0x19, 0x2c, 0x04,
+    0x15, 0x0b, 0xb4, 0x0c, 0x2b, 0xf0, 0x0a, 0x09, 0x38, 0x09, 0x1a, 0x15,
+    0x0d, 0x04, 0x0c, 0x02, 0x0d, 0x01, 0x07, 0x00, 0x08, 0x02, 0x0a, 0x0b,
+    0x0e, 0xf0, 0x0f, 0x0f, 0x0a, 0x0e, 0x06, 0x0c, 0x04, 0x1b, 0x23, 0x08,
+    0x39, 0x04, 0x05, 0x06, 0x05, 0x0a, 0x54, 0x2b, 0x1a, 0xf0, 0x09, 0x43,
+    0x0d, 0x3e, 0x04, 0x0a, 0x15, 0x0b, 0x0c, 0x04, 0x0a, 0x02, 0x09, 0x10,
+    0x0b, 0x0d, 0x03, 0x1f, 0x1d, 0x1e, 0xf0, 0x07, 0x05, 0x0c, 0x04, 0x0a,
+    0x23, 0x0b, 0x0a, 0x0b, 0x04, 0x1a, 0x05, 0x06, 0x19, 0x05, 0x54, 0x4a,
+    0x09, 0xf0, 0x33, 0x3e, 0x14, 0x09, 0x0c, 0x15, 0x0b, 0x0a, 0x03, 0x0e,
+    0x01, 0x0f, 0x00, 0x0e, 0x01, 0x2a, 0x06, 0x0f, 0x0b, 0x29, 0x07, 0xf0,
+    0x05, 0x04, 0x0a, 0x23, 0x0c, 0x0b, 0x0e, 0xe4, 0x0b, 0x1e, 0x0b, 0x1a,
+    0x0b, 0x1a, 0x09, 0x18, 0xf0, 0x09, 0x1a, 0x05, 0x09, 0x16, 0x08, 0x27,
+    0x04, 0x02, 0x01, 0x08, 0x02, 0x0c, 0x07, 0x1d, 0x09, 0x06, 0x0e, 0x05,
+    0x1c, 0x14, 0xf0, 0x09, 0x13, 0x0b, 0x0c, 0x94, 0x09, 0x0b, 0x0e, 0x0c,
+    0x2b, 0x1a, 0x09, 0x23, 0x0e, 0x0d, 0x0e, 0xf0, 0x44, 0x09, 0x0a, 0x0c,
+    0x0d, 0x0e, 0x03, 0x1f, 0x02, 0x11, 0x0e, 0x0c, 0x04, 0x29, 0x0a, 0x09,
+    0x06, 0x1a, 0x05, 0x04, 0x0b, 0x23, 0x0e, 0xf0, 0x0d, 0x0e, 0xf4, 0x09,
+    0x0c, 0x0d, 0x0c, 0x0a, 0x1b, 0x0a, 0x59, 0xf0, 0x0a, 0x0b, 0x14, 0x0d,
+    0x0c, 0x03, 0x2e, 0x02, 0x01, 0x02, 0x1a, 0x05, 0x07, 0x0d, 0x06, 0x0c,
+    0x05, 0x0b, 0x04, 0x0c, 0x23, 0x0f, 0x0e, 0x0d, 0xf0, 0xf4, 0x09, 0x0a,
+    0x1c, 0x0b, 0x0a, 0x1b, 0x1a, 0x49, 0x0a, 0xf0, 0x34, 0x0b, 0x0c, 0x0a,
+    0x18, 0x03, 0x02, 0x19, 0x03, 0x16, 0x0a, 0x1d, 0x05, 0x24, 0x0e, 0x0a,
+    0x09, 0x13, 0x1e, 0xf4, 0x1a, 0xf0, 0x1b, 0x2a, 0x0b, 0x1a, 0x39, 0x1a,
+    0x24, 0x1c, 0xf0, 0x0a, 0x03, 0x0b, 0x12, 0x0c, 0x0b, 0x04, 0x0a, 0x16,
+    0x0b, 0x0a, 0x05, 0x0b, 0xf4, 0x0c, 0x0a, 0x29, 0x0a, 0x1b, 0xf0, 0x5a,
+    0x49, 0x74, 0x0a, 0x0b, 0x0c, 0x0b, 0xf0, 0x09, 0x03, 0x0a, 0x12, 0x0e,
+    0x0f, 0x04, 0x1e, 0x15, 0x0b, 0xf4, 0x0e, 0x0b, 0x39, 0x0a, 0x1b, 0xf0,
+    0x5a, 0x39, 0x74, 0x1a, 0x0b, 0x0c, 0x0a, 0x23, 0x0d, 0xf0, 0x0a, 0x28,
+    0x04, 0x16, 0x09, 0x05, 0x0a, 0xf4, 0x0c, 0x1a, 0x29, 0x0a, 0x1b, 0x6a,
+    0xf0, 0x84, 0x19, 0x2a, 0x1b, 0x0a, 0x08, 0x13, 0x19, 0xf0, 0x04, 0x0a,
+    0x15, 0x0b, 0x0a, 0x94, 0x0d, 0x0b, 0x0a, 0x29, 0x0a, 0x1b, 0x0a, 0x05,
+    0x07, 0x36, 0x36, 0xf0, 0x47, 0x45, 0x1a, 0xf4, 0x0b, 0x0a, 0x09, 0x08,
+    0x07, 0x08, 0xf0, 0x0d, 0x0f, 0x0e, 0x0c, 0x1a, 0x19, 0x1a, 0x84, 0x1b,
+    0x4a, 0xf0, 0x57, 0x55, 0x1a, 0xc4, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x09,
+    0x1e, 0xf0, 0x0c, 0x0b, 0x0a, 0x27, 0x25, 0x46, 0x46, 0x15, 0x17, 0x14,
+    0x09, 0x08, 0xf0, 0x35, 0x07, 0x28, 0x64, 0x2a, 0x1b, 0x0a, 0x09, 0x13,
+    0x1c, 0x84, 0x0b, 0x0e, 0x0d, 0xf0, 0x0c, 0x0b, 0x2a, 0x09, 0x33, 0x0c,
+    0x0b, 0x0c, 0x0e, 0xf4, 0x0a, 0x1c, 0x0b, 0x7a, 0xf0, 0x0b, 0x1a, 0x09,
+    0x04, 0x08, 0x25, 0x07, 0x19, 0x54, 0x0c, 0x3b, 0xf0, 0x0a, 0x33, 0x0d,
+    0x0b, 0x0a, 0x0b, 0xf4, 0x09, 0x0b, 0x1d, 0x0b, 0x0a, 0x19, 0xf0, 0x1a,
+    0x3b, 0x1a, 0x94, 0x19, 0x0b, 0x0e, 0x0d, 0x1c, 0x0d, 0xf0, 0x0c, 0x0a,
+    0x03, 0x0b, 0x12, 0x0c, 0x09, 0x03, 0x57, 0x05, 0x07, 0x08, 0x07, 0x06,
+    0x15, 0x08, 0x07, 0xc4, 0x09, 0x0a, 0x2b, 0xf0, 0x0a, 0x2b, 0x0a, 0x09,
+    0x0a, 0x0c, 0x35, 0x09, 0x1a, 0x09, 0x04, 0x2a, 0x03, 0xf0, 0x02, 0x11,
+    0x0b, 0x0e, 0x03, 0x0c, 0x06, 0x3b, 0x07, 0x06, 0x05, 0xf4, 0x0c, 0x09,
+    0x08, 0x09, 0x0a, 0x0b, 0x1a, 0xf0, 0x0c, 0x1d, 0x0c, 0x0b, 0x1a, 0x0c,
+    0x34, 0x1e, 0x0c, 0x29, 0x03, 0x02, 0x01, 0x1e, 0x02, 0xf0, 0x04, 0x0c,
+    0x05, 0x0a, 0x14, 0x0b, 0x19, 0x05, 0x06, 0x0a, 0x05, 0x1b, 0x54, 0x0a,
+    0x29, 0x0a, 0x25, 0x09, 0x1a, 0xf0, 0x94, 0x0c, 0x1b, 0x0a, 0x09, 0x0b,
+    0x1e, 0x0b, 0x19, 0x03, 0x12, 0x0a, 0x19, 0x03, 0x04, 0x1b, 0x05, 0xf0,
+    0x04, 0x0a, 0x02, 0x0c, 0x03, 0x09, 0x05, 0x3c, 0x06, 0x05, 0xf4, 0x1a,
+    0x09, 0x0a, 0x0c, 0x2e, 0x0d, 0xf0, 0x0b, 0x0a, 0x19, 0x0a, 0x2b, 0x34,
+    0x1c, 0x03, 0x0e, 0x02, 0x1c, 0x11, 0x0b, 0x03, 0x28, 0x06, 0xf0, 0x07,
+    0x25, 0x09, 0x1a, 0xf4, 0x0d, 0x1b, 0x1c, 0x2d, 0x1e, 0x0d, 0x0b, 0xf0,
+    0x09, 0x28, 0x14, 0x09, 0x0a, 0x35, 0x09, 0x0b, 0x0c, 0x09, 0x03, 0x0a,
+    0x01, 0x1b, 0x00, 0x01, 0x2e, 0x05, 0x09, 0xf0, 0x06, 0x0b, 0x44, 0x0e,
+    0x0c, 0x0a, 0x09, 0x0a, 0x35, 0x09, 0x0a, 0x0b, 0x0a, 0x54, 0x0c, 0x0a,
+    0x0b, 0x0c, 0x0b, 0x09, 0xf0, 0x33, 0x0d, 0x0c, 0x0b, 0x0e, 0x04, 0x1a,
+    0x25, 0x1d, 0x04, 0x0b, 0x03, 0x09, 0x01, 0x0a, 0x00, 0x0d, 0x01, 0x0f,
+    0x05, 0x0e, 0x07, 0x1d, 0x25, 0xf0, 0x2c, 0x34, 0x0a, 0x09, 0x0b, 0x25,
+    0x0a, 0x0c, 0x0a, 0x44, 0x0b, 0x09, 0x0a, 0x1c, 0x43, 0x0f, 0x0e, 0xf0,
+    0x2c, 0x14, 0x09, 0x1c, 0x05, 0x06, 0x2a, 0x05, 0x03, 0x01, 0x0b, 0x00,
+    0x08, 0x01, 0x09, 0x06, 0x0a, 0x0e, 0x0b, 0x08, 0x0a, 0x15, 0x0c, 0xf0,
+    0x0b, 0x04, 0x0a, 0x13, 0x1d, 0x04, 0x0b, 0x05, 0x0a, 0x06, 0x09, 0x05,
+    0x1a, 0x64, 0x09, 0x0a, 0x0b, 0x1c, 0x0b, 0x33, 0x0e, 0xf0, 0x1c, 0x0d,
+    0x04, 0x0a, 0x05, 0x0b, 0x06, 0x1a, 0x05, 0x03, 0x0c, 0x01, 0x0e, 0x00,
+    0x09, 0x01, 0x07, 0x05, 0x1b, 0x0e, 0x0a, 0x0a, 0x08, 0x09, 0x06, 0x08,
+    0xf0, 0x04, 0x09, 0x13, 0x2a, 0x04, 0x25, 0x0b, 0x0d, 0x1a, 0x64, 0x08,
+    0x09, 0x0c, 0x1e, 0x0b, 0x33, 0x0e, 0x0c, 0xf0, 0x1b, 0x04, 0x0a, 0x05,
+    0x2b, 0x06, 0x05, 0x04, 0x08, 0x02, 0x07, 0x00, 0x08, 0x01, 0x07, 0x06,
+    0x09, 0x0e, 0x1a, 0x0c, 0x08, 0x0b, 0x06, 0x49, 0x04, 0xf0, 0x13, 0x04,
+    0x05, 0x1a, 0x06, 0x05, 0x0c, 0x04, 0x0b, 0x13, 0x1e, 0x44, 0x0b, 0x1d,
+    0x0b, 0x09, 0x23, 0x0c, 0x1b, 0xf0, 0x04, 0x09, 0x25, 0x0a, 0x0d, 0x0c,
+    0x03, 0x0e, 0x01, 0x0c, 0x00, 0x07, 0x01, 0x08, 0x07, 0x09, 0x0d, 0x1c,
+    0x0b, 0x07, 0x0d, 0x05, 0x0b, 0x04, 0x39, 0x13, 0xf0, 0x04, 0x05, 0x0a,
+    0x06, 0x0b, 0x05, 0x0d, 0x64, 0x0c, 0x19, 0x0b, 0x0c, 0x0b, 0x0a, 0x33,
+    0x0e, 0x0d, 0x1c, 0xf0, 0x04, 0x1a, 0x05, 0x06, 0x09, 0x05, 0x1a, 0x03,
+    0x01, 0x09, 0x00, 0x07, 0x01, 0x0c, 0x06, 0x1e, 0x0c, 0x0b, 0x0d, 0x07,
+    0x0c, 0x05, 0x0a, 0x04, 0x18, 0x23, 0x09, 0xf0, 0x0e, 0x04, 0x1f, 0x15,
+    0x0d, 0x54, 0x0c, 0x19, 0x0a, 0x1b, 0x43, 0x0f, 0x0e, 0x0d, 0x1c, 0x04,
+    0x1a, 0xf0, 0x15, 0x1c, 0x04, 0x02, 0x0d, 0x10, 0x0e, 0x08, 0x02, 0x2c,
+    0x08, 0x0f, 0x0b, 0x0d, 0x06, 0x1e, 0x04, 0x03, 0x0b, 0x12, 0x2e, 0x03,
+    0xf0, 0x05, 0x0c, 0x16, 0x0d, 0x0a, 0x05, 0x29, 0x54, 0x0a, 0x1b, 0x09,
+    0x33, 0x0e, 0x1c, 0x0e, 0x04, 0x1b, 0x15, 0xf0, 0x0a, 0x04, 0x19, 0x02,
+    0x10, 0x0c, 0x0f, 0x03, 0x0b, 0x09, 0x0c, 0x0f, 0x0d, 0x0b, 0x0c, 0x06,
+    0x0d, 0x04, 0x0c, 0x23, 0x0a, 0x08, 0x09, 0x04, 0x0a, 0x05, 0x0d, 0xf0,
+    0x06, 0x1b, 0x05, 0x64, 0x0c, 0x19, 0x2a, 0x09, 0x33, 0x0d, 0x0c, 0x0d,
+    0x0f, 0x04, 0x0e, 0x05, 0x0b, 0x04, 0x0e, 0xf0, 0x03, 0x1b, 0x01, 0x00,
+    0x0a, 0x01, 0x09, 0x04, 0x0e, 0x0c, 0x0d, 0x0f, 0x0c, 0x08, 0x1d, 0x05,
+    0x04, 0x19, 0x23, 0x08, 0x0a, 0x04, 0x0c, 0x25, 0x1d, 0xf0, 0x0b, 0x64,
+    0x0d, 0x1a, 0x39, 0x23, 0x0d, 0x0c, 0x0d, 0x04, 0x1a, 0x05, 0x06, 0x49,
+    0x05, 0x03, 0xf0, 0x01, 0x00, 0x01, 0x0d, 0x06, 0x0b, 0x0f, 0x0d, 0x0e,
+    0x1c, 0x07, 0x05, 0x0a, 0x04, 0x09, 0x13, 0x0a, 0x09, 0x04, 0x08, 0x05,
+    0x39, 0x16, 0x05, 0xf0, 0x64, 0x0b, 0x0a, 0x49, 0x23, 0x0d, 0x0b, 0x0d,
+    0x04, 0x1b, 0x15, 0x0e, 0x04, 0x1d, 0x02, 0x10, 0x0f, 0xf0, 0x19, 0x02,
+    0x08, 0x0e, 0x0f, 0x0f, 0x0a, 0x0e, 0x07, 0x0b, 0x05, 0x0a, 0x04, 0x08,
+    0x13, 0x29, 0x04, 0x05, 0x0a, 0x06, 0x09, 0x05, 0x0a, 0x64, 0x0b, 0x4a,
+    0xf0, 0x09, 0x33, 0x0e, 0x0c, 0x0b, 0x0e, 0x04, 0x2d, 0x15, 0x03, 0x1f,
+    0x01, 0x10, 0x0b, 0x0c, 0xf0, 0x03, 0x0b, 0x0c, 0x0d, 0x0f, 0x0e, 0x09,
+    0x0c, 0x06, 0x0b, 0x04, 0x0c, 0x23, 0x0b, 0x09, 0x2a, 0x04, 0x15, 0x0b,
+    0xb4, 0x0e, 0x3b, 0xf0, 0x0a, 0x09, 0x38, 0x19, 0x05, 0x06, 0x0a, 0x05,
+    0x1d, 0x03, 0x01, 0x0c, 0x10, 0x08, 0x0f, 0x04, 0x0e, 0xf0, 0x1f, 0x0f,
+    0x2d, 0x08, 0x05, 0x04, 0x1a, 0x23, 0x09, 0x1a, 0x04, 0x15, 0x1b, 0x54,
+    0x0d, 0x2b, 0x0a, 0xf0, 0x09, 0x53, 0x3d, 0x0e, 0x0f, 0x04, 0x0e, 0x15,
+    0x0d, 0x2a, 0x03, 0x01, 0x00, 0x08, 0x01, 0x09, 0x07, 0x0c, 0x0f, 0x2f,
+    0xf0, 0x0a, 0x06, 0x04, 0x1e, 0x03, 0x12, 0x1f, 0x03, 0x2c, 0x04, 0x15,
+    0x1b, 0x54, 0x0a, 0x1b, 0x0a, 0x09, 0xf0, 0x43, 0x0e, 0x0d, 0x2e, 0x04,
+    0x09, 0x05, 0x1a, 0x06, 0x05, 0x09, 0x03, 0x08, 0x01, 0x07, 0x00, 0x08,
+    0x02, 0x0b, 0x0c, 0x0d, 0x0f, 0x0f, 0x09, 0x0d, 0xf0, 0x06, 0x2c, 0x04,
+    0x23, 0x09, 0x0a, 0x04, 0x29, 0x05, 0x06, 0x05, 0x0b, 0x54, 0x5a, 0x43,
+    0x0e, 0xf0, 0x0d, 0x2e, 0x04, 0x0a, 0x15, 0x0b, 0x0c, 0x04, 0x0a, 0x02,
+    0x0b, 0x10, 0x0d, 0x0b, 0x04, 0x09, 0x0f, 0x2d, 0x0d, 0x07, 0x05, 0x0c,
+    0xf0, 0x04, 0x0b, 0x23, 0x0c, 0x0a, 0x0b, 0x04, 0x1a, 0x15, 0x0b, 0xc4,
+    0x0d, 0x1a, 0x1b, 0x0a, 0x09, 0x28, 0xf0, 0x09, 0x0a, 0x0c, 0x15, 0x1b,
+    0x03, 0x0d, 0x01, 0x0f, 0x00, 0x0e, 0x01, 0x0a, 0x06, 0x0b, 0x0f, 0x0a,
+    0x0b, 0x19, 0x07, 0x05, 0x1a, 0x04, 0xf0, 0x23, 0x0c, 0x0b, 0x0d, 0x04,
+    0x0a, 0x15, 0x09, 0x0a, 0x54, 0x0c, 0x0a, 0x1b, 0x0a, 0x09, 0x43, 0x0e,
+    0x1d, 0x0e, 0xf0, 0x0f, 0x04, 0x0b, 0x25, 0x09, 0x0a, 0x08, 0x04, 0x17,
+    0x02, 0x01, 0x08, 0x02, 0x0c, 0x08, 0x2b, 0x0b, 0x07, 0x05, 0x1c, 0xf4,
+    0x09, 0x18, 0xf0, 0x09, 0x0b, 0x0e, 0x0d, 0x2b, 0x0a, 0x59, 0x54, 0x0a,
+    0xf0, 0x0b, 0x0e, 0x0d, 0x03, 0x1f, 0x02, 0x11, 0x0e, 0x0c, 0x03, 0x0f,
+    0x18, 0x0d, 0x1b, 0x06, 0x04, 0x0e, 0x43, 0x0f, 0x0e, 0x0c, 0x0e, 0xf0,
+    0x0f, 0xf4, 0x0b, 0x0d, 0x0b, 0x0a, 0x1b, 0x1a, 0x49, 0x0a, 0x0b, 0xf0,
+    0x0c, 0x14, 0x0b, 0x09, 0x03, 0x18, 0x12, 0x0a, 0x05, 0x0b, 0x07, 0x0d,
+    0x06, 0x0c, 0x05, 0x1b, 0xf4, 0x0a, 0x18, 0x09, 0x0a, 0xf0, 0x0c, 0x0b,
+    0x2a, 0x1b, 0x0a, 0x49, 0x64, 0x0a, 0x1c, 0xf0, 0x0b, 0x03, 0x1c, 0x12,
+    0x08, 0x03, 0x0a, 0x16, 0x0b, 0x0e, 0x05, 0x0d, 0xf4, 0x0e, 0x0a, 0x09,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0xf0, 0x0b, 0x4a, 0x49, 0x74, 0x0a, 0x0b,
+    0x0c, 0x0b, 0x0a, 0xf0, 0x03, 0x0b, 0x12, 0x0c, 0x0b, 0x04, 0x0a, 0x07,
+    0x09, 0x06, 0x1a, 0x05, 0xf4, 0x0c, 0x0a, 0x29, 0x0a, 0x0b, 0x0c, 0x0b,
+    0xf0, 0x09, 0x3a, 0x39, 0x74, 0x1a, 0x0b, 0x0c, 0x0b, 0x09, 0x03, 0x0a,
+    0xf0, 0x12, 0x0d, 0x0f, 0x04, 0x1e, 0x15, 0x0b, 0xf4, 0x0e, 0x0b, 0x0a,
+    0x29, 0x0a, 0x1b, 0x5a, 0xf0, 0x39, 0x74, 0x1a, 0x1b, 0x0a, 0x03, 0x0e,
+    0x12, 0x0f, 0x1e, 0xe0, 0x03, 0x35, 0x0b, 0x0c, 0x0a, 0x08, 0x06, 0x06,
+    0x07, 0x05, 0x29, 0x64, 0x0a, 0x1b, 0x0a, 0x1b, 0xf2, 0xf1, 0x0c, 0x2b,
+    0x1a, 0x1b, 0x2c, 0x0b, 0x09, 0x17, 0x12, 0xf1, 0x0d, 0x0a, 0x23, 0x09,
+    0x08, 0x0c, 0xf2, 0x0b, 0x1a, 0x1b, 0x0c, 0x0d, 0x0c, 0x1b, 0x1c, 0xf1,
+    0x6b, 0xf2, 0x2c, 0x0a, 0x09, 0x07, 0x08, 0x0e, 0xf1, 0x1f, 0x0d, 0x1b,
+    0xf2, 0x1a, 0x0b, 0x0c, 0x0d, 0x0c, 0x2b, 0x0c, 0x6b, 0xf1, 0xf2, 0x2c,
+    0x0b, 0x0a, 0x18, 0x0b, 0x1f, 0xf1, 0x0e, 0x0c, 0x4b, 0xf2, 0x2c, 0x2b,
+    0x0c, 0x0a, 0x19, 0xc1, 0x0b, 0x1e, 0x0c, 0x72, 0x0b, 0x0c, 0x0d, 0x0b,
+    0x09, 0x08, 0x09, 0x0c, 0xf4, 0xf0, 0x0e, 0x0c, 0x2b, 0x0a, 0x09, 0x1a,
+    0x09, 0x08, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0xf4, 0xf0, 0x0b, 0x4a, 0x1b,
+    0x1a, 0x09, 0x18, 0x0a, 0x0e, 0x0d, 0xf4, 0xf0, 0x0c, 0x0b, 0x2a, 0x1b,
+    0x09, 0x08, 0x17, 0x08, 0x0a, 0x0c, 0x0d, 0x0c, 0xf4, 0xf0, 0x0b, 0x0a,
+    0x19, 0x0a, 0x2b, 0x0a, 0x09, 0x08, 0x09, 0x0c, 0x1d, 0x0c, 0x74, 0xf0,
+    0x1b, 0x0c, 0x0d, 0x0c, 0x0a, 0x07, 0x04, 0x05, 0x03, 0x16, 0x04, 0x05,
+    0x18, 0x07, 0x06, 0x19, 0x05, 0xf4, 0x0b, 0x0a, 0xf0, 0x19, 0x0a, 0x0b,
+    0x0c, 0x0b, 0x3a, 0x0b, 0x0e, 0x0d, 0x0c, 0x44, 0x1d, 0xf0, 0x0e, 0x0b,
+    0x19, 0x03, 0x02, 0x08, 0x01, 0x0b, 0x02, 0x09, 0x04, 0x0b, 0x06, 0x0c,
+    0x07, 0x3a, 0x06, 0x05, 0xf4, 0x19, 0x0a, 0xf0, 0x1b, 0x0a, 0x0b, 0x0d,
+    0x0c, 0x0b, 0x1a, 0x3d, 0x24, 0x0c, 0x0a, 0x03, 0x0c, 0xf0, 0x02, 0x0e,
+    0x11, 0x1f, 0x03, 0x0b, 0x15, 0x0a, 0x09, 0x14, 0x1a, 0x15, 0x0b, 0x0d,
+    0x64, 0x0e, 0x0a, 0x29, 0x0a, 0xf0, 0x0b, 0x25, 0x1a, 0x09, 0x84, 0x0b,
+    0x0a, 0x09, 0x0a, 0x0c, 0x1e, 0x0c, 0x0a, 0x03, 0x0c, 0x22, 0x0e, 0x0a,
+    0xf0, 0x1b, 0x03, 0x15, 0x09, 0x0a, 0x03, 0x1b, 0x02, 0x04, 0x09, 0x16,
+    0x1b, 0x05, 0x0a, 0x44, 0x0b, 0x2a, 0x0b, 0x35, 0x09, 0xf0, 0x1a, 0x09,
+    0x74, 0x0b, 0x0a, 0x09, 0x0a, 0x1b, 0x1a, 0x05, 0x08, 0x06, 0x07, 0x05,
+    0x18, 0x04, 0x03, 0x16, 0xf0, 0x02, 0x03, 0x55, 0x06, 0x0d, 0x0b, 0x09,
+    0x0a, 0x0e, 0xa4, 0x0b, 0x0a, 0x0b, 0x0c, 0x1d, 0x2e, 0xf0, 0x0d, 0x08,
+    0x05, 0x06, 0x06, 0x15, 0x17, 0x34, 0x18, 0x09, 0x1a, 0x25, 0x0c, 0x0b,
+    0x04, 0x0a, 0x03, 0x07, 0x01, 0x08, 0xf0, 0x00, 0x0c, 0x02, 0x1e, 0x07,
+    0x08, 0x0d, 0x05, 0x0c, 0x44, 0x0e, 0x0b, 0x19, 0x1a, 0x25, 0x1b, 0x74,
+    0x0e, 0x0b, 0x0a, 0xf0, 0x1b, 0x1a, 0x09, 0x23, 0x1b, 0x0e, 0x04, 0x0b,
+    0x06, 0x18, 0x17, 0x47, 0x05, 0x03, 0x11, 0xf0, 0x03, 0x09, 0x17, 0x0c,
+    0x0b, 0x25, 0x0c, 0x0d, 0x1a, 0x34, 0x19, 0x0c, 0x15, 0x0b, 0x0c, 0x64,
+    0x0e, 0x0a, 0x09, 0x0a, 0xf0, 0x1b, 0x0a, 0x43, 0x0e, 0x1b, 0x0d, 0x0f,
+    0x04, 0x1e, 0x05, 0x06, 0x0a, 0x05, 0x09, 0x03, 0x08, 0x01, 0x07, 0x00,
+    0x09, 0x02, 0x0b, 0xf0, 0x08, 0x1d, 0x0a, 0x06, 0x0c, 0x15, 0x0b, 0x19,
+    0x24, 0x08, 0x79, 0x05, 0x16, 0x05, 0x54, 0x0b, 0xf0, 0x1d, 0x43, 0x0f,
+    0x0d, 0x1c, 0x0e, 0x04, 0x0c, 0x15, 0x0d, 0x0e, 0x04, 0x0c, 0x03, 0x19,
+    0x01, 0x00, 0x18, 0x02, 0x08, 0x2b, 0xf0, 0x0d, 0x08, 0x06, 0x0c, 0x04,
+    0x0e, 0x23, 0x0c, 0x09, 0x2c, 0x04, 0x25, 0x0d, 0x19, 0x24, 0x08, 0x19,
+    0x25, 0x0a, 0xf0, 0x09, 0x04, 0x0a, 0x33, 0x0d, 0x0b, 0x0a, 0x0c, 0x04,
+    0x0b, 0x05, 0x0d, 0x06, 0x0b, 0x05, 0x19, 0x03, 0x01, 0x08, 0x00, 0x07,
+    0x02, 0x09, 0x08, 0x0b, 0x0b, 0x1c, 0xf0, 0x09, 0x06, 0x1e, 0x04, 0x23,
+    0x0c, 0x09, 0x0a, 0x04, 0x0b, 0x05, 0x0c, 0x06, 0x1a, 0x05, 0x64, 0x09,
+    0x08, 0x09, 0x0d, 0x0e, 0x0c, 0xf0, 0x0a, 0x33, 0x0e, 0x0c, 0x3b, 0x04,
+    0x05, 0x06, 0x0a, 0x05, 0x19, 0x03, 0x01, 0x17, 0x00, 0x02, 0x0a, 0x09,
+    0x0c, 0x0b, 0x0e, 0x09, 0x0d, 0xf0, 0x06, 0x0c, 0x04, 0x0d, 0x23, 0x0b,
+    0x08, 0x0a, 0x04, 0x0b, 0x05, 0x0d, 0x06, 0x1b, 0x05, 0x04, 0x0a, 0x13,
+    0x0e, 0x0f, 0x34, 0x0c, 0x0d, 0x0a, 0x09, 0xf0, 0x33, 0x0e, 0x0d, 0x0c,
+    0x0d, 0x04, 0x0c, 0x05, 0x0b, 0x06, 0x09, 0x05, 0x08, 0x03, 0x07, 0x01,
+    0x06, 0x00, 0x08, 0x03, 0x09, 0x0b, 0x1a, 0x0f, 0x0e, 0x19, 0x07, 0xf0,
+    0x05, 0x08, 0x04, 0x07, 0x13, 0x08, 0x09, 0x04, 0x0b, 0x05, 0x0d, 0x06,
+    0x1c, 0x05, 0x64, 0x0b, 0x19, 0x0b, 0x0c, 0x0a, 0x09, 0x33, 0x0e, 0xf0,
+    0x0d, 0x0c, 0x0e, 0x04, 0x0d, 0x15, 0x0c, 0x0b, 0x04, 0x09, 0x02, 0x08,
+    0x10, 0x09, 0x0e, 0x03, 0x2f, 0x09, 0x0c, 0x09, 0x0c, 0x06, 0x0a, 0x04,
+    0x0b, 0xf0, 0x23, 0x09, 0x08, 0x09, 0x04, 0x1b, 0x06, 0x07, 0x0a, 0x06,
+    0x09, 0x05, 0x08, 0x94, 0x19, 0x0a, 0x0b, 0x0a, 0x09, 0x28, 0xf0, 0x39,
+    0x05, 0x06, 0x05, 0x03, 0x4a, 0x01, 0x00, 0x01, 0x05, 0x0d, 0x1c, 0x0f,
+    0x09, 0x0b, 0x06, 0x0a, 0x04, 0x19, 0x23, 0xf0, 0x08, 0x0a, 0x04, 0x0d,
+    0x16, 0x0b, 0x2a, 0x05, 0x54, 0x09, 0x3a, 0x33, 0x0e, 0x1c, 0x0e, 0xf0,
+    0x04, 0x0b, 0x15, 0x0a, 0x1b, 0x04, 0x02, 0x0d, 0x01, 0x08, 0x00, 0x0a,
+    0x02, 0x09, 0x07, 0x0a, 0x0f, 0x2c, 0x0d, 0x07, 0x05, 0x0a, 0x03, 0x0c,
+    0x12, 0x1f, 0xf0, 0x03, 0x0d, 0x04, 0x1e, 0x25, 0x0c, 0x0a, 0xa4, 0x0b,
+    0x0a, 0x49, 0x18, 0x09, 0x0c, 0xf0, 0x15, 0x0b, 0x0c, 0x04, 0x0a, 0x02,
+    0x0b, 0x10, 0x0e, 0x0b, 0x02, 0x0e, 0x09, 0x0d, 0x0f, 0x1e, 0x09, 0x06,
+    0x0b, 0x04, 0x0c, 0x23, 0x0b, 0x09, 0x0a, 0x04, 0x09, 0xf0, 0x16, 0x08,
+    0x09, 0x05, 0x0b, 0x74, 0x0c, 0x1a, 0x49, 0x13, 0x0d, 0x0b, 0x04, 0x49,
+    0x05, 0x16, 0xf0, 0x04, 0x02, 0x08, 0x10, 0x0a, 0x0d, 0x03, 0x2e, 0x0e,
+    0x0f, 0x0a, 0x3b, 0x06, 0x04, 0x23, 0x09, 0x1a, 0x04, 0x15, 0x0b, 0xf0,
+    0x0c, 0x64, 0x0e, 0x0b, 0x4a, 0x33, 0x0e, 0x0c, 0x1b, 0x04, 0x2a, 0x05,
+    0x06, 0x05, 0x0b, 0xf0, 0x03, 0x1a, 0x01, 0x00, 0x19, 0x01, 0x05, 0x0c,
+    0x1f, 0x0e, 0x1b, 0x08, 0x05, 0x0c, 0x04, 0x1a, 0x23, 0x09, 0x0c, 0x04,
+    0x0b, 0x15, 0x1a, 0xf0, 0x54, 0x0c, 0x2b, 0x1a, 0x43, 0x0e, 0x1d, 0x1c,
+    0x04, 0x1a, 0x05, 0x06, 0x0b, 0x05, 0x0a, 0x03, 0x09, 0xf0, 0x01, 0x07,
+    0x00, 0x08, 0x01, 0x0e, 0x08, 0x0c, 0x0f, 0x0f, 0x0c, 0x0d, 0x07, 0x0c,
+    0x04, 0x1e, 0x33, 0x19, 0x2c, 0x04, 0x15, 0x0a, 0xb4, 0x1b, 0xf0, 0x0c,
+    0x0b, 0x0a, 0x09, 0x38, 0x09, 0x0b, 0x05, 0x0a, 0x06, 0x09, 0x05, 0x08,
+    0x03, 0x17, 0x01, 0xf0, 0x00, 0x09, 0x02, 0x0c, 0x0a, 0x1f, 0x0f, 0x09,
+    0x0e, 0x06, 0x0c, 0x04, 0x1b, 0x23, 0x09, 0x0a, 0x04, 0x29, 0x05, 0x06,
+    0x05, 0x0a, 0x54, 0x2b, 0xf0, 0x1a, 0x09, 0x43, 0x1d, 0x2e, 0x04, 0x0b,
+    0x15, 0x1c, 0x04, 0x0a, 0x02, 0x08, 0x10, 0x0a, 0x1b, 0xf0, 0x04, 0x0f,
+    0x1f, 0x0c, 0x08, 0x1c, 0x05, 0x04, 0x0a, 0x23, 0x0b, 0x09, 0x0b, 0x04,
+    0x1a, 0x05, 0x06, 0x19, 0x05, 0x54, 0x4a, 0xf0, 0x09, 0x33, 0x1d, 0x1e,
+    0x14, 0x09, 0x0d, 0x15, 0x0c, 0x0b, 0x03, 0x1d, 0x01, 0x00, 0x19, 0x01,
+    0x06, 0x1e, 0xf0, 0x0f, 0x0a, 0x0d, 0x07, 0x0b, 0x05, 0x1a, 0x04, 0x23,
+    0x0b, 0x0a, 0x0e, 0x04, 0x0b, 0x15, 0x1a, 0x64, 0x0b, 0x1a, 0x1b, 0xf0,
+    0x0a, 0x09, 0x23, 0x1c, 0x0e, 0x24, 0x0a, 0x0b, 0x0e, 0x15, 0x0b, 0x19,
+    0x03, 0x01, 0x0a, 0x00, 0x0d, 0x02, 0x0a, 0x09, 0x1c, 0x0e, 0xf0, 0x08,
+    0x0b, 0x06, 0x0a, 0x05, 0x19, 0x04, 0x23, 0x1b, 0x0e, 0x04, 0x0b, 0x15,
+    0x0a, 0x09, 0xd4, 0x0b, 0x0a, 0x0b, 0x1a, 0x09, 0xf0, 0x28, 0x09, 0x0a,
+    0x0c, 0x1e, 0x03, 0x0f, 0x02, 0x0e, 0x11, 0x0a, 0x39, 0x04, 0x0d, 0x0b,
+    0x07, 0x2a, 0xf0, 0x05, 0x04, 0x33, 0x0e, 0x0c, 0x0e, 0x0f, 0xf4, 0x0c,
+    0x0e, 0x0c, 0x2b, 0x0a, 0x59, 0xf0, 0x0a, 0x0c, 0x0e, 0x04, 0x0c, 0x03,
+    0x0d, 0x02, 0x1b, 0x01, 0x02, 0x08, 0x06, 0x09, 0x0a, 0x0a, 0x07, 0x0b,
+    0x05, 0x0d, 0xf4, 0x0c, 0xf0, 0x09, 0x18, 0x09, 0x0b, 0x1c, 0x0b, 0x0a,
+    0x1b, 0x0a, 0x49, 0x64, 0xf0, 0x1a, 0x0b, 0x0c, 0x0b, 0x03, 0x0c, 0x02,
+    0x0b, 0x01, 0x0e, 0x02, 0x0f, 0x06, 0x0c, 0x08, 0x3a, 0x06, 0x05, 0x14,
+    0x09, 0xf0, 0x23, 0x0d, 0x0e, 0x0f, 0xf4, 0x0b, 0x0c, 0x0b, 0x1a, 0x1b,
+    0x1a, 0x39, 0xf0, 0x1a, 0x1c, 0x14, 0x09, 0x03, 0x1a, 0x12, 0x09, 0x04,
+    0x1a, 0x07, 0x06, 0x1c, 0x05, 0x04, 0x0d, 0x23, 0x0f, 0x0e, 0x0d, 0xf0,
+    0xf4, 0x09, 0x0a, 0x2b, 0x1a, 0x0b, 0x1a, 0x49, 0x0a, 0xf0, 0x34, 0x0b,
+    0x0c, 0x0b, 0x09, 0x03, 0x1a, 0x02, 0x03, 0x18, 0x06, 0x07, 0x19, 0x06,
+    0x05, 0x0a, 0xc4, 0x0b, 0x0a, 0x29, 0xf0, 0x0a, 0x1b, 0x4a, 0x95, 0x67,
+    0x38, 0xf0, 0x04, 0x03, 0x09, 0x02, 0x2c, 0x03, 0x25, 0x0d, 0x0a, 0xf4,
+    0x0c, 0x0a, 0x29, 0x0a, 0x1b, 0xf0, 0x6a, 0x29, 0x14, 0x15, 0x17, 0x06,
+    0x06, 0x18, 0x15, 0xf0, 0x06, 0x26, 0x05, 0x04, 0x05, 0x25, 0x08, 0x0d,
+    0x0f, 0xe4, 0x0e, 0x0b, 0x0a, 0x29, 0x1a, 0x1b, 0xf0, 0x3a, 0x57, 0x55,
+    0x0a, 0x44, 0x2b, 0x09, 0x70, 0x06, 0x45, 0x05, 0x06, 0x09, 0x0b, 0x0e,
+    0x14, 0x1c, 0xf2, 0xf1, 0x0b, 0x1a, 0x1b, 0x0c, 0x0d, 0x0c, 0x1b, 0x1c,
+    0x6b, 0xf2, 0xf1, 0x2c, 0x0a, 0x08, 0x07, 0x0a, 0x1f, 0x0e, 0x0c, 0x1b,
+    0xf2, 0xf1, 0x0a, 0x1b, 0x2c, 0x1b, 0x1c, 0x6b, 0xf2, 0xf1, 0x2c, 0x0b,
+    0x09, 0x18, 0x0e, 0x1f, 0x0e, 0x1b, 0x1a, 0xf2, 0xf1, 0x1b, 0x1c, 0x0a,
+    0x09, 0x0b, 0x1e, 0x0b, 0x19, 0x0b, 0x0e, 0x0f, 0x0e, 0xf2, 0xf1, 0x1c,
+    0x0d, 0x0c, 0x0a, 0x08, 0x0b, 0x0e, 0x0a, 0x09, 0x0a, 0x0d, 0x0e, 0x0d,
+    0x2c, 0xf2, 0xf1, 0x0b, 0x09, 0x18, 0x0a, 0x0d, 0x1e, 0x0c, 0x0b, 0x0c,
+    0x1d, 0x0e, 0x0b, 0x72, 0x71, 0x08, 0x07, 0x08, 0x09, 0x0b, 0x1f, 0x0c,
+    0x84, 0xf0, 0x0b, 0x0a, 0x3b, 0x0c, 0x0b, 0x07, 0x05, 0x05, 0x06, 0x14,
+    0x07, 0x18, 0x25, 0x1a, 0x04, 0x09, 0xf0, 0x12, 0x0d, 0x09, 0x03, 0x1a,
+    0x05, 0x06, 0x09, 0x15, 0x0a, 0x09, 0x44, 0x0b, 0x29, 0x0a, 0x25, 0x09,
+    0x1a, 0x34, 0x0d, 0xf0, 0x1c, 0x0e, 0x15, 0x0b, 0x1c, 0x04, 0x03, 0x29,
+    0x01, 0x00, 0x01, 0x0a, 0x05, 0x0b, 0x09, 0x1c, 0x08, 0x06, 0x0b, 0xb4,
+    0x0c, 0x19, 0xf0, 0x0a, 0x0b, 0x0d, 0x1e, 0x0c, 0x1b, 0x0c, 0x15, 0x1a,
+    0x04, 0x1c, 0x03, 0x12, 0x0b, 0x1a, 0xf0, 0x04, 0x06, 0x09, 0x04, 0x0a,
+    0x13, 0x0b, 0x0a, 0x12, 0x09, 0x08, 0x03, 0x0b, 0x05, 0x1d, 0x26, 0x1c,
+    0x05, 0x1b, 0x74, 0x1a, 0xf0, 0x0c, 0x1e, 0x0d, 0x0a, 0x03, 0x1b, 0x12,
+    0x0c, 0x04, 0x1a, 0x06, 0x04, 0x39, 0x03, 0x06, 0x08, 0x06, 0x08, 0x04,
+    0x29, 0xf0, 0x03, 0x12, 0x08, 0x03, 0x0b, 0x05, 0x0c, 0x06, 0x0a, 0x05,
+    0x09, 0x14, 0x0a, 0x0e, 0x15, 0x0d, 0x0b, 0x34, 0x0c, 0x1b, 0x09, 0x03,
+    0x08, 0xf0, 0x12, 0x07, 0x19, 0x05, 0x07, 0x2a, 0x15, 0x74, 0x0e, 0x0c,
+    0x0e, 0x2f, 0x0e, 0x1b, 0x03, 0x12, 0x0c, 0xf0, 0x0a, 0x03, 0x08, 0x04,
+    0x19, 0x05, 0x04, 0x0b, 0x03, 0x1a, 0x04, 0x06, 0x1b, 0x04, 0x11, 0x4a,
+    0x06, 0x09, 0x05, 0x24, 0x0e, 0x1d, 0xf0, 0x05, 0x0b, 0x06, 0x0a, 0x05,
+    0x0d, 0x54, 0x0e, 0x0b, 0x0c, 0x0d, 0x0c, 0x09, 0x13, 0x0b, 0x0c, 0x04,
+    0x3b, 0x15, 0x03, 0xf0, 0x01, 0x0a, 0x10, 0x08, 0x07, 0x03, 0x2b, 0x0d,
+    0x27, 0x1a, 0x15, 0x09, 0x17, 0x06, 0x1a, 0x36, 0x08, 0x07, 0x0a, 0x95,
+    0xf0, 0x0b, 0x09, 0x07, 0x16, 0x07, 0x08, 0x0a, 0x09, 0x05, 0x16, 0x02,
+    0x01, 0x07, 0x06, 0x09, 0x0f, 0x0b, 0x05, 0x0a, 0x02, 0x09, 0xf0, 0x00,
+    0x0e, 0x01, 0x0b, 0x05, 0x0c, 0x0c, 0x0e, 0x08, 0x1d, 0x05, 0x04, 0x0c,
+    0x03, 0x0e, 0x04, 0x0a, 0x25, 0x09, 0x1a, 0x24, 0x0d, 0x1b, 0x15, 0x0a,
+    0xf0, 0x1e, 0x04, 0x02, 0x2f, 0x10, 0x05, 0x1c, 0x08, 0x06, 0x0b, 0x05,
+    0x1c, 0x14, 0x1b, 0x15, 0x0d, 0x03, 0x0f, 0x01, 0x0e, 0x00, 0x0a, 0xf0,
+    0x02, 0x08, 0x08, 0x19, 0x0d, 0x06, 0x1a, 0x05, 0x04, 0x0c, 0x03, 0x0e,
+    0x04, 0x09, 0x05, 0x1a, 0x06, 0x05, 0x0b, 0x02, 0x0d, 0x00, 0x1c, 0x02,
+    0x18, 0x2e, 0xf0, 0x07, 0x05, 0x0b, 0x03, 0x0c, 0x02, 0x0f, 0x03, 0x1d,
+    0x14, 0x0e, 0x13, 0x1f, 0x05, 0x0e, 0x07, 0x0b, 0x06, 0x0a, 0x03, 0x0b,
+    0x01, 0x09, 0x00, 0x06, 0x01, 0x08, 0xf0, 0x06, 0x0c, 0x0f, 0x0f, 0x09,
+    0x0e, 0x04, 0x0d, 0x01, 0x09, 0x00, 0x0b, 0x04, 0x0e, 0x0a, 0x1c, 0x09,
+    0x08, 0x0b, 0x05, 0x0c, 0x13, 0x0d, 0x0a, 0x04, 0x0b, 0x15, 0x0c, 0x0d,
+    0xe0, 0x34, 0x1c, 0x0d, 0x0b, 0x23, 0x0c, 0x1a, 0x04, 0x18, 0x06, 0x0b,
+    0x07, 0x0d, 0x06, 0x08, 0x04, 0x03, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+    0x1f, 0x04, 0x22, 0x09, 0x08, 0x08, 0x04, 0x0e, 0xf1, 0x02, 0x0c, 0x11,
+    0x0b, 0x0c, 0x02, 0x2e, 0x93, 0x0b, 0x09, 0x07, 0x16, 0x07, 0x18, 0x04,
+    0x06, 0x05, 0x35, 0xe1, 0x04, 0x02, 0x10, 0x07, 0x05, 0x19, 0x0f, 0x0b,
+    0x07, 0x05, 0x05, 0x02, 0x04, 0x10, 0x03, 0x05, 0x05, 0x07, 0x0f, 0x18,
+    0x0d, 0x08, 0x0c, 0xf0, 0x05, 0x0a, 0x04, 0x09, 0x23, 0x0a, 0x09, 0x0d,
+    0x04, 0x0c, 0x25, 0x1b, 0x0a, 0x04, 0x0b, 0x03, 0x0a, 0x01, 0x0c, 0x00,
+    0x0f, 0x03, 0x0b, 0x0a, 0x1e, 0x0b, 0xf0, 0x06, 0x0d, 0x03, 0x0e, 0x12,
+    0x0d, 0x0e, 0x04, 0x0c, 0x18, 0x1b, 0x04, 0x0a, 0x01, 0x0b, 0x00, 0x07,
+    0x01, 0x09, 0x06, 0x0c, 0x0a, 0x1e, 0x08, 0x06, 0x0c, 0x05, 0x0a, 0xf0,
+    0x04, 0x0b, 0x13, 0x0e, 0x19, 0x02, 0x01, 0x08, 0x02, 0x1c, 0x0a, 0x0f,
+    0x0d, 0x08, 0x1b, 0x05, 0x04, 0x09, 0x13, 0x0b, 0x0d, 0x04, 0x0c, 0x05,
+    0x0b, 0x04, 0x0d, 0xf0, 0x23, 0x0f, 0x0e, 0x0f, 0x04, 0x0e, 0x15, 0x0b,
+    0x09, 0x03, 0x28, 0x01, 0x00, 0x02, 0x09, 0x19, 0x1c, 0x03, 0x0b, 0x01,
+    0x1e, 0x04, 0x0b, 0x0d, 0xf0, 0x06, 0x0e, 0x34, 0x0c, 0x0a, 0x0b, 0x0e,
+    0x25, 0x0d, 0x0e, 0x0b, 0x74, 0x0c, 0x1b, 0x0a, 0x09, 0x08, 0x07, 0x56,
+    0x80, 0x05, 0x08, 0x0e, 0x0a, 0x03, 0x10, 0x05, 0x04, 0x03, 0x15, 0x0a,
+    0x31, 0x1f, 0x18, 0x07, 0x07, 0x44, 0x0e, 0xf0, 0x19, 0x08, 0x17, 0x05,
+    0x06, 0x09, 0x07, 0x1a, 0x06, 0x04, 0x0b, 0x23, 0x0c, 0x0a, 0x0d, 0x04,
+    0x2e, 0x05, 0x04, 0x02, 0x0c, 0xf0, 0x10, 0x1b, 0x04, 0x0e, 0x0f, 0x2f,
+    0x0d, 0x06, 0x03, 0x0e, 0x01, 0x0a, 0x00, 0x17, 0x01, 0x04, 0x0c, 0x0c,
+    0x0d, 0x0f, 0x0e, 0x0c, 0x0d, 0x06, 0x0e, 0x04, 0x0c, 0xf0, 0x03, 0x09,
+    0x12, 0x0b, 0x2d, 0x03, 0x05, 0x17, 0x0e, 0x0c, 0x04, 0x1b, 0x01, 0x00,
+    0x08, 0x02, 0x1c, 0x1f, 0x0b, 0x07, 0x0a, 0x05, 0x08, 0x03, 0x09, 0xf0,
+    0x02, 0x1c, 0x03, 0x06, 0x0a, 0x07, 0x1b, 0x05, 0x03, 0x0c, 0x01, 0x0d,
+    0x00, 0x0a, 0x01, 0x09, 0x04, 0x0b, 0x0a, 0x1d, 0x0c, 0x08, 0x0c, 0x06,
+    0x0b, 0x05, 0x0a, 0x04, 0x08, 0x20, 0x02, 0x07, 0x10, 0x18, 0xf1, 0x07,
+    0x09, 0x0f, 0x1c, 0x06, 0x03, 0x0e, 0x02, 0x0a, 0x11, 0x1e, 0x02, 0x0b,
+    0x13, 0x09, 0x08, 0x62, 0x0a, 0x19, 0x0c, 0x0e, 0x0f, 0xa1, 0x1c, 0x01,
+    0x10, 0x09, 0x06, 0x01, 0x09, 0x03, 0x0c, 0x02, 0x0d, 0x01, 0x08, 0x04,
+    0x0b, 0x0f, 0x09, 0x07, 0x0f, 0xf0, 0x04, 0x0e, 0x23, 0x0a, 0x09, 0x0d,
+    0x05, 0x0b, 0x07, 0x0a, 0x06, 0x0b, 0x34, 0x0c, 0x1a, 0x09, 0x43, 0x0e,
+    0x1c, 0x0b, 0x0a, 0xf0, 0x04, 0x09, 0x16, 0x1a, 0x03, 0x1b, 0x10, 0x0e,
+    0x12, 0x0f, 0x0b, 0x04, 0x09, 0x0d, 0x0c, 0x0f, 0x0d, 0x08, 0x0b, 0x06,
+    0x0a, 0x05, 0x0c, 0x04, 0x0d, 0x13, 0x0b, 0xf0, 0x09, 0x04, 0x1a, 0x15,
+    0x1c, 0x04, 0x13, 0x0e, 0x0d, 0x14, 0x0a, 0x0b, 0x15, 0x1a, 0x03, 0x09,
+    0x10, 0x0c, 0x09, 0x05, 0x0b, 0x0f, 0x0e, 0xf0, 0x09, 0x0d, 0x08, 0x0b,
+    0x06, 0x3a, 0x03, 0x01, 0x00, 0x01, 0x08, 0x04, 0x0a, 0x0d, 0x0e, 0x0f,
+    0x0f, 0x0a, 0x0c, 0x06, 0x0a, 0x04, 0x19, 0x03, 0x02, 0x0c, 0x03, 0x09,
+    0xf0, 0x04, 0x0c, 0x06, 0x0a, 0x08, 0x18, 0x05, 0x02, 0x07, 0x00, 0x09,
+    0x03, 0x0b, 0x0f, 0x0f, 0x0a, 0x0e, 0x05, 0x0d, 0x04, 0x1a, 0x23, 0x08,
+    0x0a, 0x04, 0x0c, 0x26, 0x0a, 0xe0, 0x0c, 0x0a, 0x04, 0x09, 0x01, 0x0c,
+    0x10, 0x07, 0x0d, 0x04, 0x0c, 0x1f, 0x1d, 0x0a, 0x0c, 0x07, 0x1b, 0x04,
+    0x02, 0x08, 0x00, 0x06, 0x01, 0x04, 0xf1, 0x09, 0x07, 0x0e, 0x0a, 0x05,
+    0x0d, 0x03, 0x0c, 0x22, 0x0a, 0x19, 0x13, 0x08, 0x09, 0x62, 0x0c, 0x09,
+    0x0b, 0x0a, 0x19, 0x0c, 0x71, 0x13, 0x19, 0x02, 0x08, 0x01, 0x06, 0x10,
+    0x05, 0x07, 0x11, 0x0a, 0x09, 0x32, 0x06, 0x0b, 0x0d, 0x0c, 0x04, 0x0a,
+    0x02, 0x0f, 0x21, 0x11, 0x0d, 0x09, 0x02, 0x0e, 0xf0, 0x04, 0x1c, 0x16,
+    0x0b, 0x34, 0x1c, 0x0e, 0x0c, 0x33, 0x0e, 0x0b, 0x09, 0x0a, 0x04, 0x09,
+    0x15, 0x08, 0x19, 0x04, 0x02, 0x0a, 0xf0, 0x01, 0x07, 0x03, 0x1b, 0x0a,
+    0x03, 0x09, 0x01, 0x18, 0x03, 0x0d, 0x09, 0x0e, 0x2b, 0x09, 0x07, 0x06,
+    0x19, 0x04, 0x13, 0x0a, 0x0c, 0x34, 0x0a, 0x0d, 0xf0, 0x0e, 0x0b, 0x13,
+    0x0e, 0x0f, 0x04, 0x0c, 0x05, 0x2b, 0x04, 0x02, 0x00, 0x09, 0x01, 0x08,
+    0x0b, 0x0a, 0x0f, 0x0b, 0x07, 0x0a, 0x15, 0x0b, 0x0a, 0x04, 0x0b, 0xf0,
+    0x03, 0x1c, 0x02, 0x10, 0x0f, 0x0d, 0x03, 0x1f, 0x1f, 0x0e, 0x08, 0x0c,
+    0x05, 0x0a, 0x03, 0x0d, 0x12, 0x1f, 0x03, 0x0b, 0x05, 0x0a, 0x06, 0x1b,
+    0x04, 0xf0, 0x01, 0x0a, 0x00, 0x0c, 0x05, 0x0e, 0x0f, 0x0f, 0x09, 0x0d,
+    0x05, 0x1e, 0x03, 0x12, 0x0f, 0x0d, 0x03, 0x0c, 0x15, 0x0a, 0x0b, 0x04,
+    0x0d, 0x15, 0x0c, 0x0e, 0x03, 0x0d, 0xf0, 0x01, 0x0a, 0x10, 0x07, 0x0e,
+    0x05, 0x2f, 0x0f, 0x0c, 0x09, 0x0e, 0x05, 0x09, 0x02, 0x17, 0x00, 0x02,
+    0x0b, 0x0e, 0x0e, 0x0d, 0x0c, 0x08, 0x0b, 0x06, 0x09, 0x15, 0x07, 0xf0,
+    0x06, 0x07, 0x25, 0x0a, 0x0b, 0x0a, 0x74, 0x08, 0x09, 0x28, 0x09, 0x0d,
+    0x0c, 0x35, 0x0a, 0x06, 0x02, 0x20, 0x10, 0x04, 0x05, 0x03, 0x08, 0x01,
+    0x0f, 0x0f, 0x32, 0x0d, 0x0d, 0x04, 0x0b, 0x02, 0x09, 0x21, 0x0f, 0x51,
+    0x0a, 0x0c, 0x02, 0x0a, 0x03, 0x0b, 0x24, 0x08, 0x1e, 0xf0, 0x05, 0x0a,
+    0x04, 0x0b, 0x43, 0x0e, 0x0b, 0x0a, 0x0c, 0x0e, 0x14, 0x0c, 0x0b, 0x03,
+    0x0a, 0x11, 0x09, 0x08, 0x08, 0x0b, 0x0f, 0x0f, 0x04, 0x0c, 0xf0, 0x01,
+    0x08, 0x00, 0x09, 0x03, 0x0a, 0x1f, 0x0b, 0x0d, 0x0c, 0x0c, 0x07, 0x1a,
+    0x84, 0x38, 0x0a, 0x2b, 0xf0, 0x15, 0x0a, 0x0b, 0x04, 0x09, 0x01, 0x0c,
+    0x00, 0x08, 0x03, 0x0b, 0x0f, 0x0e, 0x08, 0x1d, 0x05, 0x44, 0x0b, 0x09,
+    0x0a, 0x0c, 0x1a, 0x02, 0x10, 0x05, 0xb1, 0x07, 0x05, 0x09, 0x0d, 0x1a,
+    0x06, 0x04, 0x09, 0x03, 0x07, 0x22, 0x18, 0x09, 0x13, 0x08, 0x07, 0x02,
+    0x0e, 0xf0, 0x00, 0x0d, 0x02, 0x0b, 0x1f, 0x0e, 0x0c, 0x08, 0x1a, 0x05,
+    0x04, 0x18, 0x13, 0x19, 0x34, 0x0c, 0x0b, 0x0a, 0x06, 0x09, 0x07, 0x18,
+    0x05, 0x40, 0x03, 0x17, 0x01, 0x00, 0x06, 0x02, 0x09, 0x0e, 0x07, 0xf1,
+    0x0f, 0x0a, 0x07, 0x09, 0x03, 0x07, 0x10, 0x06, 0x17, 0x06, 0x08, 0x08,
+    0x04, 0x0a, 0x13, 0x0b, 0x08, 0x12, 0x0a, 0x28, 0x03, 0x04, 0x03, 0x0a,
+    0x42, 0x2b, 0xa1, 0x09, 0x07, 0x03, 0x05, 0x04, 0x04, 0x07, 0x23, 0x0b,
+    0x0e, 0x0d, 0x02, 0x04, 0x01, 0x02, 0x10, 0x10, 0x03, 0x02, 0x06, 0x03,
+    0x73, 0x0f, 0x0f, 0x07, 0x0c, 0x03, 0x0a, 0x01, 0x09, 0x20, 0x0b, 0x08,
+    0x0a, 0x01, 0x0c, 0x02, 0x12, 0x1f, 0xf1, 0x13, 0x0b, 0x09, 0x82, 0x0b,
+    0x3a, 0x0b, 0x0c, 0x0b, 0x07, 0x01, 0x15, 0x00, 0x03, 0x08, 0x0f, 0x0b,
+    0x91, 0x09, 0x08, 0x04, 0x16, 0x01, 0x10, 0x04, 0x06, 0x05, 0x08, 0x0f,
+    0x19, 0x0a, 0x05, 0x08, 0x14, 0x0e, 0xf0, 0x0c, 0x23, 0x0b, 0x09, 0x0a,
+    0x04, 0x19, 0x35, 0x0b, 0x19, 0x04, 0x2a, 0x02, 0x00, 0x02, 0x0b, 0x0f,
+    0x0d, 0x0b, 0x0a, 0x06, 0x08, 0xf0, 0x04, 0x09, 0x13, 0x1b, 0x04, 0x0d,
+    0x16, 0x0c, 0x0a, 0x03, 0x08, 0x01, 0x07, 0x00, 0x09, 0x03, 0x08, 0x1f,
+    0x4b, 0x08, 0x05, 0x24, 0x1a, 0xf0, 0x03, 0x0c, 0x02, 0x0b, 0x00, 0x0e,
+    0x01, 0x2f, 0x1e, 0x06, 0x0e, 0x05, 0x0b, 0x04, 0x0a, 0x23, 0x0b, 0x0a,
+    0x0e, 0x14, 0x0b, 0x0a, 0x03, 0x0d, 0x80, 0x04, 0x0b, 0x15, 0x0a, 0x0b,
+    0x04, 0x0c, 0x03, 0x0a, 0x01, 0x0d, 0x10, 0x0b, 0x0e, 0x05, 0x07, 0x61,
+    0x0f, 0x09, 0x06, 0x38, 0x01, 0x00, 0x05, 0x0b, 0x07, 0x06, 0x0b, 0xf0,
+    0x34, 0x0c, 0x09, 0x0a, 0x0b, 0x25, 0x09, 0x1a, 0x54, 0x0c, 0x0e, 0x0c,
+    0x09, 0x07, 0x06, 0x05, 0x45, 0x06, 0x08, 0x50, 0x0d, 0x0f, 0x0a, 0x04,
+    0x03, 0x23, 0x00, 0x01, 0xf1, 0x05, 0x06, 0x1f, 0x1d, 0x06, 0x0a, 0x03,
+    0x0b, 0x52, 0x19, 0x0b, 0x0c, 0x09, 0x0d, 0x13, 0x0c, 0x1a, 0x12, 0x08,
+    0x03, 0x06, 0x01, 0x34, 0x0a, 0xe0, 0x0b, 0x1c, 0x03, 0x0a, 0x01, 0x0c,
+    0x00, 0x08, 0x02, 0x0e, 0x1f, 0x0f, 0x0e, 0x08, 0x0c, 0x04, 0x0b, 0x02,
+    0x09, 0x10, 0x0a, 0x17, 0x03, 0x31, 0x0f, 0x0a, 0x0a, 0x09, 0x06, 0x08,
+    0x05, 0x0e, 0xf0, 0x04, 0x0c, 0x33, 0x0a, 0x08, 0x09, 0x0c, 0x04, 0x1e,
+    0x05, 0x06, 0x1a, 0x04, 0x02, 0x0b, 0x00, 0x0d, 0x01, 0x0f, 0x0b, 0x0e,
+    0x0e, 0x0d, 0x06, 0x0b, 0x04, 0x2a, 0xf0, 0x23, 0x0c, 0x05, 0x0b, 0x06,
+    0x0e, 0x05, 0x0d, 0x03, 0x0a, 0x02, 0x08, 0x00, 0x0a, 0x01, 0x08, 0x07,
+    0x0b, 0x0f, 0x0e, 0x09, 0x0c, 0x06, 0x0d, 0x14, 0x0e, 0x1d, 0x40, 0x03,
+    0x02, 0x0b, 0x10, 0x0d, 0x0f, 0x06, 0x0a, 0x81, 0x0d, 0x0c, 0x05, 0x0a,
+    0x03, 0x09, 0x32, 0x0b, 0x0a, 0x09, 0x0a, 0x23, 0x08, 0x0f, 0xf0, 0x0b,
+    0x44, 0x09, 0x1b, 0x0c, 0x0d, 0x03, 0x0e, 0x02, 0x0a, 0x01, 0x08, 0x00,
+    0x0b, 0x03, 0x0d, 0x0e, 0x0e, 0x04, 0x0d, 0x01, 0x2f, 0x05, 0x0f, 0xf0,
+    0x07, 0x0d, 0x04, 0x0c, 0x13, 0x0b, 0x0a, 0x04, 0x09, 0x05, 0x0b, 0x06,
+    0x2a, 0x05, 0x14, 0x0c, 0x05, 0x1a, 0x04, 0x33, 0x0b, 0x0a, 0x09, 0x0a,
+    0xf0, 0x04, 0x19, 0x05, 0x07, 0x18, 0x06, 0x03, 0x17, 0x00, 0x01, 0x08,
+    0x13, 0x09, 0x0a, 0x0d, 0x0e, 0x0f, 0x0f, 0x09, 0x0e, 0x05, 0x0d, 0x24,
+    0x0a, 0x0c, 0x0b, 0xf0, 0x13, 0x1d, 0x04, 0x0e, 0x05, 0x0c, 0x04, 0x1e,
+    0x23, 0x0b, 0x1d, 0x24, 0x2e, 0x03, 0x02, 0x09, 0x00, 0x08, 0x01, 0x0a,
+    0x0d, 0x0c, 0xf0, 0x0f, 0x0d, 0x09, 0x1b, 0x06, 0x04, 0x19, 0x02, 0x01,
+    0x07, 0x00, 0x09, 0x03, 0x0c, 0x1f, 0x0f, 0x0e, 0x0b, 0x0c, 0x06, 0x0b,
+    0x04, 0x0a, 0x23, 0x09, 0x08, 0x19, 0xf0, 0x04, 0x05, 0x1a, 0x07, 0x06,
+    0x19, 0x03, 0x11, 0x06, 0x08, 0x09, 0x0d, 0x0f, 0x0f, 0x06, 0x0e, 0x04,
+    0x0b, 0x23, 0x0a, 0x08, 0x2a, 0x04, 0x06, 0xf0, 0x07, 0x09, 0x05, 0x0a,
+    0x04, 0x19, 0x02, 0x10, 0x0a, 0x0c, 0x05, 0x0d, 0x0f, 0x1e, 0x0b, 0x07,
+    0x0d, 0x05, 0x1c, 0x04, 0x03, 0x08, 0x01, 0x07, 0x00, 0x08, 0x04, 0x07,
+    0x31, 0x0f, 0x1a, 0x07, 0x04, 0x08, 0x23, 0x0e, 0xf0, 0x0c, 0x0e, 0x24,
+    0x0b, 0x0d, 0x2c, 0x13, 0x54, 0x1a, 0x09, 0x0b, 0x0c, 0x0a, 0x03, 0x08,
+    0x01, 0x1b, 0x00, 0x30, 0x02, 0x09, 0x05, 0x0d, 0x02, 0x0f, 0x04, 0x0b,
+    0xf1, 0x0f, 0x1c, 0x06, 0x03, 0x0a, 0x02, 0x08, 0x11, 0x0d, 0x0e, 0x02,
+    0x0c, 0x13, 0x0d, 0x0e, 0x12, 0x0d, 0x0b, 0x13, 0x19, 0x52, 0x0a, 0x08,
+    0x17, 0x51, 0x09, 0x0c, 0x13, 0x09, 0x08, 0x02, 0x1f, 0xf0, 0x00, 0x01,
+    0x1d, 0x05, 0x02, 0x0f, 0x01, 0x0e, 0x05, 0x0f, 0x0f, 0x1e, 0x09, 0x06,
+    0x0d, 0x05, 0x0b, 0x04, 0x1e, 0x13, 0x0a, 0x04, 0x19, 0x15, 0x0a, 0xf0,
+    0x04, 0x0d, 0x13, 0x0e, 0x0b, 0x04, 0x1a, 0x15, 0x0c, 0x04, 0x0b, 0x02,
+    0x0c, 0x10, 0x0b, 0x6e, 0x06, 0x0f, 0x07, 0x05, 0x04, 0x03, 0xf0, 0x02,
+    0x0b, 0x01, 0x0a, 0x00, 0x1c, 0x02, 0x0d, 0x0e, 0x0f, 0x0f, 0x0b, 0x0e,
+    0x06, 0x0b, 0x04, 0x19, 0x23, 0x08, 0x0a, 0x04, 0x19, 0x16, 0x0b, 0x04,
+    0x0a, 0x20, 0x01, 0x09, 0x00, 0x0b, 0x05, 0x06, 0x21, 0x0f, 0x08, 0x09,
+    0x06, 0x05, 0x0a, 0xf0, 0x23, 0x0c, 0x18, 0x04, 0x29, 0x05, 0x06, 0x15,
+    0x2b, 0x04, 0x02, 0x1a, 0x10, 0x09, 0x04, 0x0b, 0x1f, 0x0e, 0x0c, 0x09,
+    0x0d, 0xf0, 0x06, 0x0b, 0x03, 0x0c, 0x01, 0x0a, 0x00, 0x07, 0x03, 0x08,
+    0x0f, 0x1f, 0x0d, 0x07, 0x1e, 0x04, 0x13, 0x3b, 0x04, 0x15, 0x0a, 0x04,
+    0x09, 0x03, 0x0b, 0xa0, 0x64, 0x19, 0x18, 0x0a, 0x1d, 0x03, 0x0c, 0x02,
+    0x18, 0x10, 0x06, 0x21, 0x01, 0x09, 0x04, 0x0b, 0x0f, 0x0a, 0x02, 0x0b,
+    0x0e, 0x61, 0x04, 0x1b, 0x02, 0x11, 0x0d, 0x0b, 0x02, 0x08, 0x03, 0x09,
+    0x15, 0x0f, 0xf0, 0x0c, 0x34, 0x0a, 0x0b, 0x0e, 0x0c, 0x43, 0x0e, 0x1a,
+    0x0b, 0x0e, 0x14, 0x0d, 0x0b, 0x03, 0x19, 0x11, 0x0c, 0x18, 0x0b, 0xf0,
+    0x0a, 0x02, 0x08, 0x01, 0x07, 0x04, 0x09, 0x0f, 0x2b, 0x0d, 0x09, 0x06,
+    0x0c, 0x04, 0x0d, 0x13, 0x0b, 0x0c, 0x44, 0x1a, 0x0b, 0x0c, 0x09, 0xf0,
+    0x03, 0x0e, 0x04, 0x0b, 0x15, 0x0c, 0x0b, 0x03, 0x0a, 0x01, 0x08, 0x00,
+    0x0a, 0x04, 0x0c, 0x0f, 0x1b, 0x08, 0x05, 0x0c, 0x24, 0x0d, 0x0b, 0x09,
+    0x03, 0x0a, 0x02, 0x09, 0xf0, 0x00, 0x0e, 0x01, 0x0b, 0x07, 0x1f, 0x0f,
+    0x0b, 0x0d, 0x06, 0x0a, 0x04, 0x09, 0x23, 0x0a, 0x09, 0x0c, 0x04, 0x1b,
+    0x15, 0x09, 0x02, 0x0a, 0x00, 0x0b, 0x03, 0x0a, 0xf0, 0x0f, 0x0f, 0x0d,
+    0x0e, 0x06, 0x0c, 0x04, 0x19, 0x23, 0x08, 0x0a, 0x24, 0x0b, 0x0e, 0x0c,
+    0x15, 0x0a, 0x0e, 0x04, 0x0b, 0x02, 0x0a, 0x10, 0x0c, 0x08, 0xf0, 0x03,
+    0x0a, 0x1f, 0x0e, 0x0f, 0x0b, 0x0d, 0x05, 0x0b, 0x02, 0x0a, 0x00, 0x09,
+    0x01, 0x0d, 0x09, 0x0e, 0x0d, 0x0d, 0x08, 0x0c, 0x06, 0x2a, 0x04, 0x03,
+    0x04, 0x48, 0x06, 0xf0, 0x07, 0x05, 0x14, 0x09, 0x33, 0x0e, 0x0c, 0x0b,
+    0x0c, 0x04, 0x0a, 0x06, 0x08, 0x07, 0x07, 0x06, 0x06, 0x03, 0x05, 0x01,
+    0x03, 0x00, 0x04, 0x02, 0x07, 0x01, 0x1f, 0x0b, 0x42, 0x0d, 0x05, 0x1a,
+    0x02, 0x21, 0x09, 0x0b, 0x71, 0x0c, 0x02, 0x0a, 0xa3, 0x0b, 0x0c, 0x09,
+    0x18, 0x1f, 0xf0, 0x0e, 0x1b, 0x0d, 0x14, 0x2a, 0x03, 0x11, 0x19, 0x07,
+    0x0c, 0x0f, 0x1f, 0x04, 0x01, 0x0b, 0x00, 0x09, 0x02, 0x0e, 0xf0, 0x0b,
+    0x1d, 0x0f, 0x0e, 0x0b, 0x07, 0x1a, 0x04, 0x33, 0x0d, 0x0e, 0x0d, 0x0c,
+    0x54, 0x0a, 0x0c, 0x0b, 0x0a, 0x0d, 0x1f, 0x03, 0xf0, 0x01, 0x0e, 0x00,
+    0x1a, 0x03, 0x0d, 0x2c, 0x08, 0x05, 0x24, 0x0a, 0x09, 0x0a, 0x05, 0x09,
+    0x04, 0x1a, 0x02, 0x00, 0x0b, 0x01, 0x09, 0x07, 0x0e, 0x0f, 0x0f, 0xf0,
+    0x0a, 0x0d, 0x06, 0x0a, 0x04, 0x09, 0x13, 0x0c, 0x0b, 0x04, 0x09, 0x15,
+    0x38, 0x03, 0x01, 0x02, 0x0b, 0x0c, 0x1d, 0x0e, 0x07, 0x0c, 0x04, 0x0e,
+    0x23, 0x0b, 0xf0, 0x09, 0x0a, 0x34, 0x09, 0x0c, 0x1a, 0x15, 0x0c, 0x0d,
+    0x04, 0x0b, 0x02, 0x0a, 0x01, 0x06, 0x00, 0x08, 0x02, 0x2f, 0x0e, 0x0f,
+    0x09, 0x2e, 0xf0, 0x03, 0x00, 0x01, 0x08, 0x08, 0x59, 0x0f, 0x08, 0x06,
+    0x05, 0x14, 0x18, 0x05, 0x06, 0x09, 0x07, 0x17, 0x05, 0x16, 0x26, 0xa0,
+    0x05, 0x14, 0x17, 0x05, 0x06, 0x08, 0x25, 0x0b, 0x0e, 0x0a, 0x04, 0x04,
+    0x13, 0x10, 0x02, 0x01, 0x07, 0x05, 0x02, 0x0f, 0x0e, 0x03, 0x07, 0x0f,
+    0x22, 0x03, 0x1d, 0x31, 0x0e, 0xf1, 0x0c, 0x0f, 0x02, 0x0d, 0x33, 0x19,
+    0x0a, 0x09, 0x82, 0x0b, 0x1a, 0x19, 0x0a, 0x0c, 0x0b, 0x08, 0x51, 0x01,
+    0x16, 0x00, 0x03, 0x18, 0x0f, 0x0b, 0x06, 0x04, 0x19, 0xf0, 0x01, 0x00,
+    0x07, 0x02, 0x09, 0x0c, 0x0d, 0x0f, 0x0f, 0x0d, 0x0d, 0x06, 0x2a, 0x14,
+    0x23, 0x0c, 0x0a, 0x0b, 0x04, 0x19, 0x15, 0x0a, 0x24, 0x0c, 0xf0, 0x0e,
+    0x1b, 0x02, 0x00, 0x0d, 0x02, 0x1a, 0x1d, 0x19, 0x06, 0x04, 0x0a, 0x13,
+    0x0c, 0x2d, 0x04, 0x05, 0x04, 0x0c, 0x02, 0x09, 0x00, 0x0b, 0xf0, 0x01,
+    0x08, 0x06, 0x0b, 0x0f, 0x0e, 0x0a, 0x0c, 0x06, 0x0b, 0x44, 0x0a, 0x19,
+    0x0a, 0x09, 0x03, 0x18, 0x01, 0x02, 0x09, 0x0d, 0x0a, 0x0f, 0x2b, 0x07,
+    0xf0, 0x05, 0x04, 0x2a, 0x13, 0x24, 0x09, 0x0c, 0x0a, 0x03, 0x0e, 0x04,
+    0x2b, 0x15, 0x04, 0x0a, 0x02, 0x0b, 0x01, 0x08, 0x00, 0x09, 0x02, 0x0b,
+    0xf0, 0x0e, 0x1f, 0x0f, 0x07, 0x0b, 0x02, 0x18, 0x01, 0x06, 0x09, 0x0e,
+    0x0b, 0x07, 0x1a, 0x05, 0x34, 0x1b, 0x1a, 0x15, 0x09, 0x0b, 0x24, 0x0c,
+    0xc0, 0x1b, 0x33, 0x0d, 0x0a, 0x09, 0x0a, 0x04, 0x08, 0x06, 0x07, 0x0a,
+    0x06, 0x0e, 0x05, 0x07, 0x04, 0x02, 0x03, 0x00, 0x01, 0x11, 0x01, 0x04,
+    0x0c, 0x06, 0x12, 0x0f, 0x0c, 0x08, 0x0f, 0xf1, 0x04, 0x0c, 0x02, 0x0b,
+    0x11, 0x1f, 0x22, 0x0b, 0x0d, 0x0c, 0x03, 0x09, 0x04, 0x18, 0x03, 0x72,
+    0x19, 0x0a, 0x1b, 0x1c, 0x21, 0x08, 0x01, 0x0e, 0x80, 0x00, 0x0b, 0x02,
+    0x0e, 0x0e, 0x1f, 0x0f, 0x07, 0x0b, 0x03, 0x0a, 0x01, 0x08, 0x00, 0x17,
+    0x01, 0x51, 0x07, 0x1a, 0x0e, 0x08, 0x07, 0x05, 0x16, 0x14, 0x09, 0xf0,
+    0x23, 0x0a, 0x09, 0x2a, 0x04, 0x25, 0x0b, 0x1a, 0x04, 0x03, 0x18, 0x01,
+    0x02, 0x07, 0x0c, 0x08, 0x0f, 0x09, 0x06, 0x0b, 0x04, 0x0a, 0x13, 0x0b,
+    0xf0, 0x0a, 0x04, 0x09, 0x05, 0x2c, 0x06, 0x04, 0x02, 0x09, 0x11, 0x17,
+    0x04, 0x0c, 0x0e, 0x2d, 0x0a, 0x06, 0x24, 0x0e, 0x1a, 0x03, 0x0e, 0xf0,
+    0x02, 0x0d, 0x11, 0x08, 0x0b, 0x08, 0x0c, 0x0f, 0x0f, 0x07, 0x0d, 0x05,
+    0x0a, 0x04, 0x0b, 0x13, 0x0e, 0x0b, 0x74, 0x09, 0x0b, 0x0a, 0x08, 0x09,
+    0x0c, 0xf0, 0x0e, 0x0d, 0x03, 0x0f, 0x02, 0x0e, 0x01, 0x1b, 0x00, 0x02,
+    0x09, 0x0d, 0x0b, 0x0f, 0x0a, 0x04, 0x09, 0x01, 0x0c, 0x04, 0x1d, 0x0d,
+    0x07, 0x0c, 0x04, 0x2e, 0x13, 0xf0, 0x04, 0x0a, 0x25, 0x09, 0x1a, 0x34,
+    0x1c, 0x0d, 0x0a, 0x33, 0x0b, 0x19, 0x0b, 0x04, 0x09, 0x05, 0x2a, 0x06,
+    0x50, 0x05, 0x02, 0x08, 0x10, 0x06, 0x09, 0x02, 0x0f, 0x07, 0x09, 0x71,
+    0x0f, 0x0b, 0x08, 0x0a, 0x04, 0x0b, 0x22, 0x0c, 0x09, 0x0a, 0x23, 0x07,
+    0x0e, 0xf0, 0x1f, 0x04, 0x05, 0x0d, 0x04, 0x0b, 0x13, 0x1c, 0x34, 0x09,
+    0x1b, 0x0c, 0x03, 0x0d, 0x02, 0x09, 0x00, 0x0c, 0x01, 0x0e, 0x09, 0x0c,
+    0x0f, 0x0e, 0xf0, 0x09, 0x1c, 0x05, 0x03, 0x29, 0x01, 0x00, 0x01, 0x1e,
+    0x0a, 0x0f, 0x0f, 0x0a, 0x1d, 0x06, 0x04, 0x0e, 0x33, 0x0d, 0x19, 0x1a,
+    0x04, 0xf0, 0x05, 0x0b, 0x06, 0x0a, 0x05, 0x19, 0x03, 0x11, 0x08, 0x0a,
+    0x07, 0x4b, 0x0f, 0x07, 0x04, 0x23, 0x0a, 0x0b, 0x04, 0x0c, 0x16, 0x2a,
+    0xf0, 0x04, 0x02, 0x0d, 0x01, 0x09, 0x00, 0x0d, 0x03, 0x0a, 0x1d, 0x1b,
+    0x08, 0x0a, 0x15, 0x0b, 0x09, 0x04, 0x0a, 0x03, 0x08, 0x01, 0x09, 0x00,
+    0x2f, 0x04, 0x0f, 0xf0, 0x0a, 0x0e, 0x05, 0x0c, 0x54, 0x0a, 0x29, 0x1b,
+    0x13, 0x0d, 0x0e, 0x34, 0x0a, 0x2b, 0x03, 0x4f, 0x02, 0xf0, 0x01, 0x00,
+    0x01, 0x16, 0x0e, 0x0c, 0x02, 0x1e, 0x04, 0x0f, 0x0d, 0x0a, 0x0b, 0x05,
+    0x0a, 0x23, 0x0c, 0x0a, 0x0d, 0x04, 0x0e, 0x15, 0x0d, 0x0b, 0xf0, 0x14,
+    0x0a, 0x0b, 0x05, 0x0a, 0x04, 0x0d, 0x43, 0x0e, 0x0a, 0x09, 0x0a, 0x0e,
+    0x04, 0x1b, 0x15, 0x1a, 0x03, 0x11, 0x07, 0x08, 0x13, 0x09, 0xf0, 0x08,
+    0x06, 0x09, 0x0f, 0x0e, 0x0c, 0x2d, 0x06, 0x24, 0x0c, 0x0b, 0x13, 0x0d,
+    0x2b, 0x04, 0x15, 0x1a, 0x04, 0x13, 0x1c, 0xf0, 0x04, 0x0a, 0x15, 0x09,
+    0x1a, 0x04, 0x03, 0x07, 0x11, 0x06, 0x08, 0x06, 0x0c, 0x0f, 0x2b, 0x09,
+    0x06, 0x04, 0x0c, 0x02, 0x0e, 0x01, 0x0b, 0x00, 0x0e, 0x01, 0x0f, 0xf0,
+    0x07, 0x2e, 0x0f, 0x0b, 0x07, 0x0c, 0x04, 0x0d, 0x03, 0x0c, 0x12, 0x1f,
+    0x03, 0x0b, 0x04, 0x0c, 0x15, 0x0e, 0x0d, 0x03, 0x0c, 0x11, 0x0a, 0x08,
+    0x05, 0x0d, 0xf0, 0x0f, 0x2e, 0x07, 0x04, 0x23, 0x0b, 0x09, 0x0a, 0x04,
+    0x09, 0x06, 0x38, 0x07, 0x06, 0x05, 0x03, 0x19, 0x01, 0x00, 0x0b, 0x02,
+    0x0e, 0x0a, 0x2d, 0xf0, 0x0d, 0x08, 0x06, 0x0a, 0x05, 0x09, 0x03, 0x0a,
+    0x01, 0x1b, 0x00, 0x03, 0x0a, 0x1f, 0x0e, 0x0c, 0x07, 0x0a, 0x04, 0x0b,
+    0x13, 0x0c, 0x0d, 0x24, 0x0b, 0x2e, 0xf0, 0x13, 0x0c, 0x54, 0x09, 0x0a,
+    0x09, 0x0a, 0x1b, 0x03, 0x0c, 0x02, 0x09, 0x11, 0x08, 0x09, 0x13, 0x0e,
+    0x0d, 0x04, 0x18, 0x21, 0x0f, 0x0b, 0x07, 0x05, 0x1e, 0xf0, 0x23, 0x69,
+    0x04, 0x06, 0x07, 0x05, 0x34, 0x0c, 0x0e, 0x0b, 0x33, 0x0c, 0x1a, 0x0c,
+    0x04, 0x19, 0xf0, 0x05, 0x04, 0x0c, 0x03, 0x1b, 0x11, 0x0e, 0x04, 0x1f,
+    0x03, 0x01, 0x0e, 0x03, 0x0b, 0x0a, 0x0d, 0x0b, 0x1c, 0x07, 0x06, 0x3a,
+    0x05, 0x04, 0x13, 0xf0, 0x0e, 0x64, 0x0b, 0x1d, 0x0a, 0x08, 0x09, 0x0c,
+    0x15, 0x0b, 0x19, 0x03, 0x01, 0x08, 0x00, 0x0e, 0x04, 0x0d, 0x0c, 0x3e,
+    0x07, 0xf0, 0x05, 0x14, 0x0a, 0x03, 0x19, 0x02, 0x11, 0x08, 0x0b, 0x05,
+    0x0d, 0x0f, 0x0e, 0x0e, 0x0d, 0x07, 0x2b, 0x04, 0x33, 0x09, 0x0a, 0x1e,
+    0xf0, 0x04, 0x05, 0x0d, 0x04, 0x0b, 0x02, 0x08, 0x01, 0x07, 0x04, 0x09,
+    0x0f, 0x0d, 0x0d, 0x0a, 0x06, 0x39, 0x04, 0x23, 0x1c, 0x04, 0x35, 0x2a,
+    0xf0, 0x39, 0x03, 0x01, 0x00, 0x02, 0x0a, 0x0a, 0x1b, 0x0f, 0x0c, 0x2a,
+    0x07, 0x04, 0x02, 0x08, 0x00, 0x0b, 0x02, 0x09, 0x0c, 0x0a, 0x0f, 0x1b,
+    0xf0, 0x08, 0x05, 0x0a, 0x14, 0x08, 0x17, 0x05, 0x16, 0x18, 0x04, 0x0a,
+    0x43, 0x0d, 0x2e, 0x0c, 0x14, 0x09, 0x0c, 0x05, 0x1a, 0x50, 0x04, 0x03,
+    0x17, 0x01, 0x00, 0x09, 0x01, 0x0c, 0x03, 0x0b, 0x51, 0x0f, 0x0c, 0x0e,
+    0x0d, 0x05, 0x0a, 0x03, 0x08, 0x12, 0x07, 0x0e, 0xf0, 0x03, 0x0a, 0x04,
+    0x1b, 0x06, 0x05, 0x0e, 0x44, 0x0b, 0x0a, 0x1c, 0x09, 0x33, 0x0c, 0x0a,
+    0x0b, 0x0e, 0x14, 0x1b, 0x03, 0x0a, 0xf0, 0x11, 0x0d, 0x0e, 0x06, 0x0c,
+    0x09, 0x0b, 0x03, 0x09, 0x01, 0x08, 0x02, 0x5a, 0x09, 0x0e, 0x0a, 0x07,
+    0x05, 0x13, 0x0d, 0x0c, 0x64, 0x19, 0xf0, 0x0b, 0x0c, 0x0a, 0x09, 0x1a,
+    0x15, 0x0b, 0x03, 0x0d, 0x01, 0x0c, 0x00, 0x0e, 0x03, 0x0d, 0x0b, 0x0c,
+    0x08, 0x0b, 0x05, 0x1c, 0x24, 0x0b, 0xf0, 0x0a, 0x03, 0x1d, 0x02, 0x11,
+    0x09, 0x08, 0x05, 0x0b, 0x0f, 0x0f, 0x0c, 0x0e, 0x06, 0x0c, 0x04, 0x0a,
+    0x23, 0x0b, 0x09, 0x0b, 0x04, 0x1a, 0x15, 0x09, 0xf0, 0x03, 0x28, 0x01,
+    0x03, 0x1f, 0x09, 0x3a, 0x07, 0x04, 0x23, 0x09, 0x1a, 0x04, 0x25, 0x09,
+    0x08, 0x39, 0x06, 0x05, 0xf0, 0x03, 0x01, 0x1a, 0x00, 0x02, 0x08, 0x0a,
+    0x0b, 0x0f, 0x0e, 0x0b, 0x0d, 0x05, 0x2e, 0x02, 0x00, 0x01, 0x0c, 0x07,
+    0x1b, 0x0c, 0x08, 0x1a, 0x06, 0x04, 0x0b, 0xf0, 0x13, 0x0c, 0x1d, 0x04,
+    0x05, 0x1c, 0x34, 0x29, 0x23, 0x0c, 0x0b, 0x0c, 0x04, 0x19, 0x05, 0x16,
+    0x08, 0x17, 0x03, 0x20, 0x01, 0x05, 0x00, 0x14, 0x02, 0x01, 0x1f, 0x06,
+    0x12, 0x0b, 0x06, 0x0f, 0x51, 0x03, 0x0c, 0x02, 0x09, 0x11, 0x1c, 0x02,
+    0x09, 0x04, 0x0e, 0xf0, 0x15, 0x0d, 0x0a, 0x44, 0x0d, 0x0b, 0x1a, 0x09,
+    0x23, 0x1c, 0x0d, 0x14, 0x0a, 0x1b, 0x03, 0x11, 0x0d, 0x0a, 0x05, 0x1d,
+    0xf0, 0x0f, 0x06, 0x0b, 0x02, 0x0a, 0x00, 0x1e, 0x01, 0x07, 0x0b, 0x0e,
+    0x1d, 0x0b, 0x06, 0x0e, 0x04, 0x0b, 0x33, 0x1e, 0x0d, 0x0c, 0x44, 0x09,
+    0x0b, 0xf0, 0x0c, 0x0b, 0x0c, 0x05, 0x0a, 0x04, 0x0b, 0x02, 0x09, 0x00,
+    0x1f, 0x02, 0x09, 0x0d, 0x08, 0x1c, 0x05, 0x44, 0x0a, 0x09, 0x0a, 0x0c,
+    0x0b, 0xf0, 0x03, 0x19, 0x11, 0x07, 0x05, 0x09, 0x0f, 0x2c, 0x0b, 0x06,
+    0x04, 0x0b, 0x23, 0x0d, 0x0c, 0x0e, 0x14, 0x1a, 0x03, 0x09, 0x01, 0x0a,
+    0x02, 0x0c, 0xf0, 0x08, 0x4e, 0x0a, 0x06, 0x04, 0x23, 0x1a, 0x34, 0x09,
+    0x1b, 0x1a, 0x15, 0x0b, 0x04, 0x0c, 0x02, 0x0f, 0x01, 0x1b, 0xf0, 0x00,
+    0x01, 0x2f, 0x07, 0x0f, 0x0a, 0x0d, 0x04, 0x0c, 0x11, 0x1a, 0x05, 0x1d,
+    0x09, 0x06, 0x0c, 0x15, 0x0b, 0x09, 0x04, 0x0a, 0x03, 0x0d, 0x04, 0x0a,
+    0xf0, 0x15, 0x1b, 0x54, 0x0a, 0x19, 0x08, 0x17, 0x05, 0x26, 0x06, 0x08,
+    0x0d, 0x05, 0x0c, 0x04, 0x06, 0x13, 0x01, 0x00, 0x02, 0x01, 0x04, 0x04,
+    0x42, 0x0f, 0x0d, 0x09, 0x0b, 0x04, 0x09, 0x02, 0x08, 0x11, 0x0f, 0x21,
+    0x0d, 0x02, 0x08, 0x03, 0x0f, 0xf0, 0xb4, 0x1e, 0x0f, 0x0e, 0x0a, 0x49,
+    0x1a, 0x03, 0x0b, 0x02, 0x17, 0x01, 0x04, 0x0a, 0xf0, 0x0f, 0x1f, 0x09,
+    0x04, 0x0d, 0x01, 0x0f, 0x00, 0x0b, 0x01, 0x0a, 0x07, 0x0b, 0x0f, 0x0f,
+    0x0c, 0x0e, 0x06, 0x1b, 0x24, 0x09, 0x08, 0x13, 0x1b, 0x54, 0x09, 0xf0,
+    0x0c, 0x0e, 0x0d, 0x0e, 0x0a, 0x03, 0x18, 0x01, 0x02, 0x0a, 0x09, 0x0b,
+    0x0a, 0x0a, 0x06, 0x19, 0x04, 0x13, 0x0c, 0x0d, 0x04, 0x1c, 0x15, 0xf0,
+    0x0a, 0x03, 0x18, 0x11, 0x07, 0x04, 0x0a, 0x0d, 0x3c, 0x0a, 0x06, 0x44,
+    0x0a, 0x09, 0x0a, 0x09, 0x03, 0x08, 0x01, 0x0a, 0x02, 0x09, 0xf0, 0x09,
+    0x3b, 0x0e, 0x07, 0x05, 0x04, 0x0a, 0x13, 0x0c, 0x0b, 0x24, 0x09, 0x0b,
+    0x0a, 0x03, 0x0e, 0x04, 0x0b, 0x15, 0x0a, 0x0b, 0x04, 0x0a, 0x03, 0x09,
+    0xf0, 0x01, 0x0c, 0x00, 0x0d, 0x01, 0x0e, 0x08, 0x0d, 0x0f, 0x0f, 0x07,
+    0x0c, 0x02, 0x0b, 0x01, 0x1a, 0x05, 0x0d, 0x09, 0x08, 0x08, 0x05, 0x09,
+    0x34, 0x3a, 0xf0, 0x15, 0x09, 0x0a, 0x34, 0x0c, 0x0b, 0x0a, 0x09, 0x33,
+    0x2a, 0x0e, 0x04, 0x1c, 0x05, 0x06, 0x0a, 0x04, 0x09, 0x01, 0x07, 0x00,
+    0x04, 0x10, 0x01, 0x06, 0x08, 0x07, 0xf1, 0x0f, 0x0f, 0x09, 0x0d, 0x05,
+    0x09, 0x03, 0x28, 0x42, 0x0a, 0x0c, 0x0b, 0x23, 0x08, 0x0b, 0x09, 0x72,
+    0x0a, 0x09, 0x0a, 0x0b, 0x51, 0x2c, 0x08, 0x01, 0x07, 0x00, 0x0e, 0xf0,
+    0x02, 0x0d, 0x0c, 0x0e, 0x0f, 0x1c, 0x07, 0x03, 0x1e, 0x01, 0x00, 0x1a,
+    0x01, 0x06, 0x1f, 0x0f, 0x0b, 0x0d, 0x06, 0x0b, 0x05, 0x09, 0x04, 0x1a,
+    0x23, 0x09, 0xf0, 0x0a, 0x04, 0x09, 0x25, 0x0a, 0x0b, 0x1a, 0x04, 0x03,
+    0x08, 0x01, 0x09, 0x02, 0x08, 0x09, 0x09, 0x0d, 0x2a, 0x06, 0x04, 0x23,
+    0x1b, 0x0e, 0xf0, 0x04, 0x1f, 0x05, 0x04, 0x1e, 0x02, 0x11, 0x0a, 0x07,
+    0x03, 0x2a, 0x0c, 0x0d, 0x08, 0x09, 0x05, 0x0a, 0x14, 0x0b, 0x0a, 0x03,
+    0x0d, 0x02, 0x0e, 0x11, 0x09, 0xf0, 0x1c, 0x07, 0x0f, 0x0d, 0x08, 0x2a,
+    0x05, 0x14, 0x09, 0x03, 0x0b, 0x84, 0x09, 0x0b, 0x0a, 0x08, 0x09, 0x0c,
+    0x0e, 0x0d, 0xf0, 0x0a, 0x03, 0x09, 0x02, 0x08, 0x01, 0x17, 0x02, 0x0a,
+    0x08, 0x0f, 0x09, 0x05, 0x18, 0x02, 0x05, 0x09, 0x0d, 0x1b, 0x07, 0x04,
+    0x1d, 0x13, 0x0e, 0x04, 0x0a, 0xf0, 0x25, 0x09, 0x0a, 0x09, 0x34, 0x0b,
+    0x0d, 0x0e, 0x0a, 0x43, 0x0c, 0x0a, 0x09, 0x0b, 0x0f, 0x04, 0x2e, 0x05,
+    0x04, 0x02, 0x0a, 0xf0, 0x10, 0x08, 0x2e, 0x02, 0x06, 0x1f, 0x0f, 0x0c,
+    0x07, 0x0b, 0x04, 0x0c, 0x33, 0x0e, 0x1f, 0x0e, 0x04, 0x09, 0x15, 0x0a,
+    0x1c, 0x04, 0xf0, 0x13, 0x0d, 0x0c, 0x34, 0x09, 0x2c, 0x03, 0x0e, 0x02,
+    0x0a, 0x00, 0x0e, 0x01, 0x1f, 0x07, 0x0e, 0x0e, 0x08, 0x1c, 0x05, 0x03,
+    0x0b, 0x01, 0x0d, 0xf0, 0x00, 0x0c, 0x01, 0x0b, 0x07, 0x0c, 0x0f, 0x0e,
+    0x0b, 0x1b, 0x07, 0x05, 0x0a, 0x04, 0x29, 0x23, 0x1a, 0x04, 0x05, 0x0b,
+    0x06, 0x0a, 0x05, 0x29, 0x03, 0xf0, 0x11, 0x0d, 0x07, 0x0b, 0x0d, 0x1c,
+    0x06, 0x04, 0x1b, 0x23, 0x0a, 0x1b, 0x04, 0x16, 0x1a, 0x04, 0x0c, 0x02,
+    0x0f, 0x01, 0x0d, 0x00, 0x0e, 0xf0, 0x02, 0x0c, 0x08, 0x1e, 0x0a, 0x07,
+    0x1d, 0x15, 0x1a, 0x04, 0x03, 0x08, 0x11, 0x09, 0x07, 0x05, 0x0b, 0x0f,
+    0x0f, 0x09, 0x0e, 0x05, 0x0b, 0x54, 0x29, 0xf0, 0x0a, 0x1b, 0x13, 0x1d,
+    0x44, 0x2a, 0x1c, 0x03, 0x0b, 0x02, 0x09, 0x11, 0x08, 0x0c, 0x05, 0x0b,
+    0xf0, 0x06, 0x0a, 0x03, 0x09, 0x05, 0x0b, 0x0f, 0x1c, 0x09, 0x05, 0x0a,
+    0x23, 0x0c, 0x0a, 0x1c, 0x04, 0x15, 0x0d, 0x0b, 0x14, 0x2a, 0x05, 0x04,
+    0x0d, 0xf0, 0x43, 0x0e, 0x0b, 0x1a, 0x0d, 0x04, 0x0b, 0x15, 0x0a, 0x09,
+    0x03, 0x0a, 0x11, 0x08, 0x0b, 0x03, 0x0d, 0x02, 0x0e, 0x03, 0x2f, 0x19,
+    0xf0, 0x06, 0x0e, 0x05, 0x0a, 0x14, 0x0d, 0x0c, 0x13, 0x0e, 0x0c, 0x04,
+    0x2a, 0x15, 0x04, 0x0b, 0x13, 0x0d, 0x0c, 0x34, 0x0b, 0x1e, 0x0a, 0xf0,
+    0x03, 0x17, 0x11, 0x09, 0x06, 0x0c, 0x0c, 0x1d, 0x07, 0x05, 0x0e, 0x04,
+    0x0c, 0x03, 0x0a, 0x02, 0x18, 0x11, 0x0b, 0x05, 0x2e, 0x0e, 0x0b, 0x07,
+    0x0d, 0xf0, 0x04, 0x0e, 0x33, 0x0c, 0x19, 0x0c, 0x04, 0x0b, 0x15, 0x2d,
+    0x03, 0x11, 0x0b, 0x08, 0x06, 0x09, 0x0f, 0x0c, 0x07, 0x1e, 0x04, 0x23,
+    0x0c, 0xf0, 0x49, 0x04, 0x05, 0x06, 0x05, 0x0a, 0x04, 0x0c, 0x03, 0x0b,
+    0x01, 0x0d, 0x00, 0x0c, 0x02, 0x09, 0x08, 0x0b, 0x0e, 0x2c, 0x09, 0x06,
+    0x05, 0x0a, 0xf0, 0x03, 0x1b, 0x01, 0x00, 0x0c, 0x03, 0x0a, 0x0f, 0x0b,
+    0x0e, 0x0c, 0x07, 0x1a, 0x04, 0x13, 0x0c, 0x0d, 0x04, 0x0b, 0x15, 0x29,
+    0x74, 0x08, 0x29, 0xf0, 0x0a, 0x1c, 0x03, 0x0e, 0x02, 0x0d, 0x11, 0x0a,
+    0x08, 0x03, 0x09, 0x04, 0x08, 0x06, 0x0b, 0x0f, 0x0f, 0x0d, 0x2e, 0x05,
+    0x23, 0xf0, 0x29, 0x04, 0x05, 0x1a, 0x06, 0x05, 0x19, 0x34, 0x0b, 0x0d,
+    0x0a, 0x33, 0x0d, 0x1b, 0x0c, 0x04, 0x09, 0x15, 0x38, 0xf0, 0x04, 0x12,
+    0x0a, 0x05, 0x1c, 0x04, 0x02, 0x09, 0x03, 0x08, 0x08, 0x19, 0x0b, 0x07,
+    0x0a, 0x06, 0x09, 0x05, 0x1a, 0x04, 0x13, 0x0c, 0x0e, 0xf0, 0x84, 0x0a,
+    0x0b, 0x0c, 0x0b, 0x19, 0x0b, 0x0e, 0x0c, 0x03, 0x0b, 0x11, 0x0e, 0x0c,
+    0x04, 0x0d, 0x08, 0x1c, 0x06, 0x05, 0x0a, 0xf0, 0x24, 0x0c, 0x0a, 0x38,
+    0x03, 0x12, 0x04, 0x0b, 0x18, 0x0d, 0x0c, 0x06, 0x1b, 0x04, 0x33, 0x0e,
+    0x0b, 0x0c, 0x0e, 0x04, 0x0c, 0xf0, 0x05, 0x0a, 0x04, 0x0b, 0x02, 0x0d,
+    0x01, 0x0e, 0x04, 0x29, 0x0a, 0x08, 0x05, 0x0a, 0x04, 0x09, 0x23, 0x0c,
+    0x0b, 0x0e, 0x44, 0x0b, 0x0d, 0x0c, 0x2d, 0xf0, 0x03, 0x02, 0x0b, 0x01,
+    0x0d, 0x02, 0x0c, 0x05, 0x1d, 0x07, 0x06, 0x0e, 0x05, 0x0d, 0x04, 0x0a,
+    0x03, 0x08, 0x02, 0x07, 0x03, 0x09, 0x06, 0x0c, 0x07, 0x0b, 0x05, 0x0d,
+    0xf0, 0x24, 0x0c, 0x09, 0x08, 0x05, 0x27, 0x26, 0x06, 0x25, 0x27, 0x54,
+    0x29, 0x0b, 0x0c, 0x0a, 0xf0, 0x03, 0x0c, 0x02, 0x0b, 0x01, 0x0e, 0x02,
+    0x0a, 0x04, 0x1d, 0x09, 0x08, 0x0e, 0x05, 0x0d, 0x04, 0x0b, 0x23, 0x0d,
+    0x0c, 0x0e, 0x04, 0x0a, 0x15, 0x19, 0xb4, 0x1a, 0xf0, 0x1b, 0x0a, 0x39,
+    0x1a, 0x18, 0x13, 0x09, 0x05, 0x0a, 0x06, 0x19, 0x04, 0xf0, 0x13, 0x07,
+    0x09, 0x05, 0x1a, 0x26, 0x09, 0x18, 0x05, 0xa4, 0x19, 0x6a, 0xf0, 0x0b,
+    0x0c, 0x03, 0x1f, 0x12, 0x0c, 0x04, 0x19, 0x16, 0x18, 0x05, 0x44, 0x2a,
+    0x09, 0x08, 0x03, 0x09, 0x02, 0x0d, 0xf0, 0x03, 0x0f, 0x15, 0x2e, 0x74,
+    0x0a, 0x29, 0x0a, 0x1b, 0x03, 0x0d, 0x02, 0x0f, 0x03, 0x0d, 0x15, 0x0b,
+    0x0c, 0xf0, 0x04, 0x0e, 0x33, 0x0f, 0x2e, 0x64, 0x0a, 0x0b, 0x0a, 0x2b,
+    0x09, 0x23, 0x0a, 0x08, 0x19, 0x05, 0xf0, 0x07, 0x08, 0x06, 0x19, 0x05,
+    0x04, 0x18, 0x13, 0x0a, 0x74, 0x0e, 0x0f, 0x0e, 0x0b, 0x0a, 0x19, 0x0a,
+    0xb5, 0x18, 0xf0, 0x67, 0x28, 0x04, 0x19, 0x03, 0x02, 0x1a, 0x03, 0x05,
+    0x0e, 0x06, 0x2c, 0xf0, 0x05, 0xf4, 0x0a, 0x19, 0x1a, 0x2b, 0x3a, 0x09,
+    0x3a, 0xf0, 0x24, 0x09, 0x13, 0x3b, 0x04, 0x05, 0x04, 0x0c, 0x23, 0x0e,
+    0x0a, 0x1b, 0x04, 0x05, 0x0a, 0x36, 0x08, 0x07, 0xf0, 0x16, 0x37, 0x35,
+    0x3a, 0xf4, 0x0b, 0x0a, 0x08, 0x07, 0x09, 0x0e, 0xf0, 0x0c, 0x0b, 0x3a,
+    0x0b, 0xf4, 0x09, 0x08, 0x07, 0x0a, 0x1e, 0x0c, 0x0a, 0x09, 0xf0, 0x3a,
+    0x09, 0x08, 0x09, 0xf4, 0x0d, 0x0e, 0x0c, 0x1a, 0x19, 0x4a, 0xf0, 0x0b,
+    0x0a, 0x09, 0x08, 0xf4, 0x07, 0x08, 0x0b, 0x0e, 0x0d, 0x0a, 0x18, 0x0b,
+    0xf0, 0x0c, 0x0b, 0x5a, 0xf4, 0x0b, 0x5a, 0x09, 0xf0, 0x0a, 0x1b, 0x0a,
+    0x09, 0x07, 0x05, 0x05, 0x06, 0xd6, 0x18, 0x07, 0x96, 0xf0, 0x75, 0x77,
+    0x04, 0x08, 0x03, 0x2a, 0x04, 0xf0, 0x15, 0x09, 0x04, 0x0a, 0x23, 0x0c,
+    0x0b, 0x1e, 0x04, 0x15, 0x0b, 0x0a, 0x64, 0x0b, 0x0a, 0x1b, 0x2a, 0xf0,
+    0x23, 0x0e, 0x0b, 0x0c, 0x24, 0x0a, 0x0d, 0x0c, 0x13, 0x1f, 0x24, 0x0c,
+    0x0b, 0x09, 0x23, 0x0b, 0x0a, 0x0c, 0x94, 0x0a, 0x1d, 0xf0, 0x0b, 0x19,
+    0x0a, 0x0d, 0x0e, 0x0b, 0x23, 0x0e, 0x1a, 0x04, 0x09, 0x15, 0x08, 0x09,
+    0xa4, 0x0b, 0x0a, 0xf0, 0x0b, 0x2c, 0x2b, 0x0c, 0x0a, 0x33, 0x0d, 0x1b,
+    0x0e, 0x04, 0x0d, 0x05, 0x0a, 0x04, 0x0c, 0xf0, 0x03, 0x0b, 0x12, 0x29,
+    0x04, 0x06, 0x0a, 0x05, 0x1d, 0xc4, 0x0b, 0x0a, 0x0b, 0x0d, 0x0c, 0x1b,
+    0x0c, 0x3d, 0xf0, 0x05, 0x0a, 0x16, 0x09, 0x08, 0x04, 0x09, 0x02, 0x0a,
+    0x10, 0x0d, 0x09, 0x02, 0x1b, 0x07, 0x0c, 0x2a, 0x08, 0x05, 0x13, 0x0e,
+    0xf0, 0x0d, 0xc4, 0x0a, 0x1d, 0x1e, 0x0d, 0x0c, 0x1d, 0x1e, 0x0d, 0x0a,
+    0x03, 0x19, 0x12, 0xf0, 0x0e, 0x14, 0x1f, 0x23, 0x0e, 0x0a, 0x08, 0x12,
+    0x07, 0x08, 0x04, 0x0a, 0x36, 0x0c, 0x0e, 0x0d, 0x0b, 0x05, 0x29, 0x14,
+    0xf0, 0x45, 0x08, 0x09, 0x0a, 0x09, 0x08, 0x04, 0x09, 0x03, 0x0a, 0x02,
+    0x0c, 0x03, 0x19, 0x15, 0x0b, 0x13, 0x0a, 0x0b, 0x17, 0x0a, 0x19, 0x05,
+    0xf0, 0x04, 0x28, 0x03, 0x12, 0x09, 0x04, 0x1a, 0x06, 0x05, 0x0c, 0x14,
+    0x2b, 0x15, 0x1e, 0x44, 0x2a, 0x09, 0xf0, 0x02, 0x0c, 0x01, 0x0d, 0x02,
+    0x1e, 0x05, 0x06, 0x0b, 0x15, 0x0a, 0x0b, 0x24, 0x0d, 0x0b, 0x0e, 0x35,
+    0x1b, 0x0a, 0x09, 0x04, 0x1a, 0x03, 0xf0, 0x12, 0x0b, 0x0a, 0x03, 0x09,
+    0x14, 0x0a, 0x0d, 0x13, 0x0e, 0x1a, 0x05, 0x06, 0x0b, 0x03, 0x0a, 0x01,
+    0x07, 0x02, 0x09, 0x18, 0x0b, 0x09, 0x15, 0x1a, 0xf0, 0x14, 0x0c, 0x1e,
+    0x05, 0x06, 0x0b, 0x05, 0x0d, 0x44, 0x0e, 0x1b, 0x0c, 0x0b, 0x23, 0x0e,
+    0x0b, 0x1e, 0x04, 0x15, 0x0c, 0x09, 0xf0, 0x03, 0x17, 0x01, 0x00, 0x16,
+    0x01, 0x07, 0x08, 0x0e, 0x0a, 0x17, 0x09, 0x0a, 0x06, 0x09, 0x14, 0x2a,
+    0x05, 0x06, 0x0b, 0x05, 0x1e, 0x14, 0x0c, 0xf0, 0x25, 0x0a, 0x0b, 0x19,
+    0x24, 0x18, 0x05, 0x17, 0x16, 0x28, 0x05, 0x03, 0x01, 0x17, 0x02, 0x0c,
+    0x19, 0x0e, 0x04, 0x08, 0xf0, 0x02, 0x16, 0x01, 0x03, 0x07, 0x0c, 0x08,
+    0x0f, 0x0a, 0x07, 0x0b, 0x05, 0x0a, 0x24, 0x09, 0x08, 0x1a, 0x15, 0x0b,
+    0x34, 0x0e, 0x0c, 0x0b, 0x1c, 0xf0, 0x15, 0x0e, 0x04, 0x0c, 0x02, 0x09,
+    0x00, 0x0a, 0x01, 0x1f, 0x16, 0x0e, 0x15, 0x0d, 0x0a, 0x14, 0x0c, 0x0d,
+    0x15, 0x0c, 0x0b, 0x03, 0x0a, 0x11, 0x07, 0xf0, 0x06, 0x04, 0x07, 0x0e,
+    0x18, 0x0d, 0x06, 0x09, 0x05, 0x1a, 0x04, 0x03, 0x0c, 0x04, 0x0a, 0x16,
+    0x09, 0x0b, 0x04, 0x1d, 0x01, 0x00, 0x0e, 0x04, 0x0c, 0x0a, 0x1d, 0xf0,
+    0x08, 0x06, 0x0e, 0x04, 0x0c, 0x13, 0x0a, 0x39, 0x04, 0x15, 0x14, 0x0a,
+    0x0c, 0x06, 0x1b, 0x07, 0x05, 0x0a, 0x03, 0x07, 0x01, 0x06, 0x00, 0x07,
+    0xf0, 0x02, 0x0a, 0x0b, 0x0c, 0x0f, 0x0e, 0x07, 0x0c, 0x03, 0x2a, 0x00,
+    0x01, 0x07, 0x1c, 0x1a, 0x0a, 0x08, 0x19, 0x05, 0x13, 0x0b, 0x0c, 0x04,
+    0x1e, 0x15, 0xd0, 0x1b, 0x34, 0x1c, 0x0a, 0x23, 0x0b, 0x2a, 0x04, 0x07,
+    0x08, 0x1c, 0x07, 0x05, 0x05, 0x04, 0x01, 0x01, 0x61, 0x00, 0x00, 0x03,
+    0x03, 0x1f, 0x0d, 0x0e, 0x09, 0x09, 0x05, 0x07, 0x03, 0x0b, 0xf0, 0x02,
+    0x0c, 0x03, 0x1b, 0x05, 0x07, 0x0a, 0x06, 0x0b, 0x05, 0x0c, 0x04, 0x0e,
+    0x13, 0x0f, 0x0e, 0x54, 0x09, 0x0a, 0x0b, 0x0c, 0x0e, 0x0d, 0x03, 0x1c,
+    0x30, 0x01, 0x00, 0x08, 0x02, 0x09, 0x0c, 0x07, 0x11, 0x0f, 0x08, 0x09,
+    0x0c, 0x30, 0x04, 0x08, 0x01, 0x06, 0x00, 0x05, 0x02, 0x04, 0x21, 0x0a,
+    0x06, 0x0f, 0x08, 0x0b, 0x0f, 0xf0, 0x06, 0x0e, 0x04, 0x1c, 0x23, 0x1a,
+    0x04, 0x29, 0x05, 0x06, 0x15, 0x0b, 0x1a, 0x04, 0x03, 0x18, 0x11, 0x0a,
+    0x05, 0x0c, 0x0d, 0x1d, 0xf0, 0x09, 0x05, 0x0c, 0x03, 0x0b, 0x02, 0x0c,
+    0x03, 0x19, 0x06, 0x0e, 0x08, 0x0a, 0x47, 0x04, 0x01, 0x00, 0x03, 0x0d,
+    0x38, 0x0f, 0x0b, 0x07, 0xf0, 0x05, 0x09, 0x04, 0x0b, 0x03, 0x0c, 0x02,
+    0x0f, 0x11, 0x0c, 0x08, 0x04, 0x0b, 0x0f, 0x0c, 0x0d, 0x0d, 0x06, 0x0e,
+    0x04, 0x1d, 0x23, 0x0a, 0x1e, 0x04, 0x05, 0x0b, 0xf0, 0x04, 0x0c, 0x23,
+    0x0f, 0x0e, 0x0f, 0x04, 0x0e, 0x05, 0x0b, 0x04, 0x0a, 0x02, 0x09, 0x10,
+    0x0b, 0x0a, 0x03, 0x2e, 0x0a, 0x06, 0x12, 0x0b, 0x09, 0x07, 0x1b, 0xf0,
+    0x0b, 0x06, 0x0a, 0x24, 0x0b, 0x0a, 0x0b, 0x05, 0x3a, 0x16, 0x05, 0x24,
+    0x0c, 0x1b, 0x43, 0x0f, 0x0e, 0x0c, 0x0a, 0x90, 0x19, 0x04, 0x07, 0x08,
+    0x0b, 0x07, 0x07, 0x06, 0x02, 0x05, 0x10, 0x04, 0x07, 0x03, 0x0a, 0x0a,
+    0x07, 0x21, 0x0f, 0x09, 0x0e, 0x07, 0x06, 0x0d, 0xf0, 0x24, 0x0b, 0x1a,
+    0x13, 0x0c, 0x2b, 0x04, 0x06, 0x07, 0x0a, 0x06, 0x09, 0x05, 0x37, 0x14,
+    0x05, 0x16, 0x08, 0x09, 0x04, 0x0a, 0xf0, 0x02, 0x07, 0x00, 0x08, 0x01,
+    0x0a, 0x08, 0x0c, 0x0f, 0x0f, 0x0b, 0x0e, 0x06, 0x0b, 0x03, 0x08, 0x01,
+    0x27, 0x00, 0x02, 0x07, 0x0a, 0x1f, 0x1d, 0x0a, 0x0b, 0x06, 0x0a, 0xf0,
+    0x04, 0x09, 0x13, 0x08, 0x07, 0x04, 0x16, 0x06, 0x09, 0x07, 0x0b, 0x18,
+    0x08, 0x04, 0x17, 0x01, 0x00, 0x0b, 0x04, 0x0e, 0x0f, 0x0f, 0x09, 0x0e,
+    0x05, 0x1d, 0x03, 0xf0, 0x12, 0x1e, 0x04, 0x2a, 0x17, 0x05, 0x09, 0x03,
+    0x18, 0x01, 0x00, 0x0b, 0x02, 0x08, 0x07, 0x09, 0x0f, 0x1a, 0x0d, 0x08,
+    0x49, 0x06, 0x05, 0x30, 0x03, 0x01, 0x00, 0x08, 0x02, 0x06, 0x21, 0x1f,
+    0x09, 0x08, 0x07, 0x1f, 0xf0, 0x04, 0x23, 0x0b, 0x08, 0x0a, 0x04, 0x0c,
+    0x05, 0x0b, 0x04, 0x0c, 0x23, 0x2e, 0x24, 0x0b, 0x0d, 0x1e, 0x03, 0x02,
+    0x09, 0x11, 0x07, 0xf0, 0x08, 0x03, 0x0c, 0x06, 0x0b, 0x03, 0x0a, 0x02,
+    0x0d, 0x0b, 0x1f, 0x0f, 0x06, 0x0e, 0x04, 0x0a, 0x13, 0x19, 0x04, 0x1a,
+    0x06, 0x08, 0x09, 0x06, 0x0a, 0x34, 0x0b, 0xf0, 0x1a, 0x09, 0x43, 0x0d,
+    0x0c, 0x2b, 0x04, 0x0c, 0x06, 0x0b, 0x05, 0x0a, 0x02, 0x09, 0x00, 0x08,
+    0x01, 0x0d, 0x03, 0x09, 0x02, 0x0b, 0xf0, 0x05, 0x0d, 0x0f, 0x1e, 0x0c,
+    0x06, 0x1d, 0x15, 0x1b, 0x04, 0x13, 0x1a, 0x04, 0x0c, 0x15, 0x1b, 0x04,
+    0x0a, 0x13, 0x0d, 0x0e, 0x14, 0x0a, 0xf0, 0x0d, 0x05, 0x0c, 0x04, 0x0b,
+    0x02, 0x09, 0x00, 0x07, 0x01, 0x09, 0x0a, 0x0b, 0x0f, 0x1c, 0x09, 0x08,
+    0x0a, 0x05, 0x09, 0x03, 0x07, 0x01, 0x08, 0x00, 0x0a, 0x01, 0x0e, 0x05,
+    0x1f, 0xf0, 0x1f, 0x0d, 0x08, 0x1b, 0x05, 0x03, 0x0c, 0x12, 0x0e, 0x0d,
+    0x03, 0x0c, 0x05, 0x2a, 0x07, 0x06, 0x04, 0x08, 0x01, 0x07, 0x00, 0x0e,
+    0x05, 0x1f, 0x0f, 0xf0, 0x08, 0x0c, 0x05, 0x0a, 0x04, 0x08, 0x13, 0x09,
+    0x18, 0x04, 0x05, 0x0a, 0x16, 0x0b, 0x0c, 0x05, 0x0b, 0x03, 0x09, 0x01,
+    0x17, 0x00, 0x01, 0x0a, 0x07, 0x0b, 0x0f, 0x0f, 0xf0, 0x0d, 0x0e, 0x09,
+    0x0c, 0x06, 0x1b, 0x03, 0x01, 0x08, 0x00, 0x06, 0x02, 0x0e, 0x1f, 0x1f,
+    0x08, 0x0c, 0x04, 0x0e, 0x13, 0x0d, 0x0c, 0x04, 0x0a, 0x15, 0x39, 0xe0,
+    0x24, 0x0a, 0x23, 0x0e, 0x0d, 0x0e, 0x04, 0x0b, 0x15, 0x0a, 0x18, 0x03,
+    0x01, 0x19, 0x00, 0x01, 0x0b, 0x02, 0x0e, 0x03, 0x0b, 0x91, 0x0f, 0x1f,
+    0x0c, 0x04, 0x0d, 0x02, 0x0c, 0x11, 0x0a, 0x09, 0x02, 0x08, 0x04, 0x07,
+    0x06, 0x06, 0x05, 0x0c, 0xf0, 0x34, 0x0b, 0x1e, 0x0b, 0x43, 0x0d, 0x0a,
+    0x09, 0x0c, 0x0f, 0x14, 0x0e, 0x0c, 0x03, 0x0b, 0x02, 0x07, 0x01, 0x08,
+    0x06, 0x09, 0x09, 0x18, 0xf0, 0x02, 0x01, 0x09, 0x04, 0x1c, 0x0c, 0x0a,
+    0x2b, 0x08, 0x06, 0x04, 0x0d, 0x23, 0x1b, 0x0e, 0x24, 0x0b, 0x0d, 0x0e,
+    0x13, 0x0f, 0x0e, 0xf0, 0x04, 0x0a, 0x15, 0x09, 0x0a, 0x04, 0x18, 0x02,
+    0x00, 0x0b, 0x02, 0x1e, 0x0b, 0x08, 0x1c, 0x25, 0x0a, 0x19, 0x04, 0x03,
+    0x0b, 0x02, 0x0a, 0x11, 0x08, 0xf0, 0x0d, 0x06, 0x2c, 0x0f, 0x09, 0x06,
+    0x2b, 0x04, 0x23, 0x09, 0x0a, 0x04, 0x09, 0x15, 0x1b, 0x03, 0x0c, 0x01,
+    0x09, 0x02, 0x08, 0x0a, 0x09, 0xf0, 0x0e, 0x0a, 0x07, 0x19, 0x05, 0x04,
+    0x08, 0x13, 0x09, 0x1a, 0x34, 0x0e, 0x1d, 0x15, 0x0b, 0x1a, 0x03, 0x01,
+    0x0b, 0x00, 0x0f, 0x02, 0x2b, 0xf0, 0x08, 0x0b, 0x09, 0x0a, 0x06, 0x0b,
+    0x03, 0x0e, 0x11, 0x0d, 0x39, 0x05, 0x0c, 0x08, 0x06, 0x0a, 0x04, 0x0c,
+    0x13, 0x0e, 0x0d, 0x04, 0x0a, 0x15, 0x59, 0xf0, 0x74, 0x08, 0x09, 0x0a,
+    0x0c, 0x05, 0x0a, 0x04, 0x0b, 0x03, 0x0a, 0x01, 0x0c, 0x00, 0x0d, 0x01,
+    0x0c, 0x06, 0x1f, 0xf0, 0x0f, 0x0a, 0x0d, 0x06, 0x0a, 0x04, 0x0b, 0x23,
+    0x0c, 0x0a, 0x0c, 0x04, 0x0b, 0x45, 0x0a, 0x09, 0x28, 0x74, 0x0a, 0x09,
+    0x18, 0xf0, 0x09, 0x0a, 0x0b, 0x1a, 0x03, 0x02, 0x19, 0x03, 0x08, 0x0a,
+    0x07, 0x09, 0x04, 0x18, 0x12, 0x09, 0x05, 0x0a, 0x17, 0x0b, 0x1a, 0xf0,
+    0x06, 0x05, 0x59, 0xa4, 0x3a, 0x0d, 0x0c, 0x03, 0x0e, 0x12, 0x2a, 0xf0,
+    0x05, 0x07, 0x09, 0x06, 0x18, 0x05, 0x44, 0x1a, 0x0b, 0x0a, 0x09, 0x03,
+    0x18, 0x02, 0x03, 0x0a, 0x16, 0x0c, 0x0d, 0x05, 0x0b, 0x14, 0x0c, 0xf0,
+    0x09, 0x13, 0x1e, 0x24, 0x0a, 0x0b, 0x0a, 0x03, 0x09, 0x02, 0x0b, 0x04,
+    0x0c, 0x06, 0x0d, 0x05, 0x0c, 0x04, 0x0e, 0x33, 0x0f, 0x0e, 0x0d, 0x0e,
+    0xf0, 0x64, 0x0a, 0x0b, 0x0a, 0x0b, 0x0d, 0x0c, 0x09, 0x03, 0x0a, 0x12,
+    0x0b, 0x0a, 0x04, 0x0b, 0x16, 0x0d, 0x0c, 0x05, 0x0a, 0x03, 0x1b, 0x02,
+    0xf0, 0x03, 0x0c, 0x15, 0x0d, 0x0b, 0x74, 0x0d, 0x0b, 0x0a, 0x19, 0x0b,
+    0x0d, 0x0b, 0x43, 0x2f, 0x1e, 0xf0, 0x44, 0x19, 0x0a, 0x1c, 0x03, 0x1e,
+    0x02, 0x01, 0x0c, 0x02, 0x0b, 0x06, 0x0d, 0x08, 0x1b, 0x06, 0x05, 0x1a,
+    0x04, 0x13, 0x1e, 0xf0, 0x44, 0x09, 0x0a, 0x1b, 0x0c, 0x93, 0x8f, 0x0e,
+    0x12, 0x2f, 0xf0, 0x04, 0x15, 0x0e, 0x0a, 0x04, 0x19, 0x03, 0x02, 0x0d,
+    0x03, 0x0c, 0x25, 0x0b, 0x0d, 0x0a, 0xb4, 0x0b, 0x1a, 0x09, 0x08, 0xf0,
+    0x09, 0x0a, 0x2b, 0x0a, 0x09, 0x13, 0x0a, 0x09, 0x04, 0x1b, 0x05, 0x74,
+    0x0c, 0x1a, 0x19, 0xf0, 0x0b, 0x0c, 0x0a, 0x23, 0x0c, 0x09, 0x0a, 0x04,
+    0x0b, 0x15, 0x1a, 0x54, 0x0c, 0x1a, 0x09, 0x0a, 0x09, 0x13, 0x0c, 0xf0,
+    0x1a, 0x04, 0x05, 0x0b, 0xd4, 0x0e, 0x0b, 0x1a, 0x19, 0x4a, 0x0b, 0x1a,
+    0xf0, 0x33, 0x0e, 0x0b, 0x0a, 0x0d, 0x15, 0x1a, 0x04, 0x1b, 0x13, 0x1e,
+    0xf4, 0x0d, 0x5a, 0xf0, 0x0b, 0x3a, 0x39, 0x54, 0x1a, 0x1b, 0x09, 0xf0,
+    0x23, 0x0a, 0x09, 0x1d, 0xf4, 0x0f, 0x0e, 0x0b, 0x6a, 0x0b, 0x7a, 0xf0,
+    0x44, 0x09, 0x13, 0x0c, 0x1b, 0x54, 0x0e, 0x0d, 0x0b, 0x09, 0x08, 0xf0,
+    0x13, 0x0b, 0x1c, 0xf4, 0x0e, 0x0d, 0x0b, 0x1a, 0x29, 0x2a, 0x09, 0x18,
+    0xf0, 0x09, 0x05, 0x08, 0x06, 0x17, 0x05, 0xc4, 0x09, 0x0a, 0x0c, 0x0d,
+    0x0c, 0x2b, 0x0a, 0x09, 0x08, 0xf0, 0x0a, 0x0b, 0x13, 0x0e, 0x0c, 0x04,
+    0x09, 0x35, 0x08, 0x09, 0x08, 0x07, 0x34, 0x08, 0x0a, 0x0c, 0x0a, 0x13,
+    0x1b, 0xa4, 0x09, 0xf0, 0x0b, 0x0d, 0x0c, 0x1b, 0x0a, 0x2b, 0x09, 0x23,
+    0x0b, 0x09, 0x0a, 0x14, 0x09, 0x0b, 0x15, 0x0a, 0xf0, 0x09, 0x14, 0x0a,
+    0x29, 0x15, 0x54, 0x0c, 0x1b, 0x0c, 0x0b, 0x09, 0x23, 0x0c, 0x0b, 0x0c,
+    0x04, 0x0b, 0x15, 0x1a, 0xf0, 0x04, 0x09, 0x12, 0x0d, 0x09, 0x03, 0x1a,
+    0x05, 0x26, 0x09, 0x08, 0x17, 0x05, 0xa4, 0x08, 0x0a, 0x0b, 0x0c, 0x2e,
+    0xf0, 0x1c, 0x0d, 0x0e, 0x15, 0x0b, 0x1c, 0x04, 0x03, 0x19, 0x01, 0x00,
+    0x08, 0x01, 0x0a, 0x05, 0x1b, 0x0a, 0x08, 0x0c, 0x06, 0x0b, 0xf0, 0x04,
+    0x0c, 0x13, 0x0e, 0x0c, 0x24, 0x0a, 0x0d, 0x0e, 0x15, 0x1a, 0x34, 0x0c,
+    0x1b, 0x0c, 0x15, 0x1a, 0x04, 0x0c, 0x03, 0x0d, 0xf0, 0x12, 0x0b, 0x09,
+    0x04, 0x0a, 0x06, 0x09, 0x05, 0x27, 0x14, 0x13, 0x06, 0x05, 0x04, 0x17,
+    0x07, 0x18, 0x08, 0x09, 0x07, 0x0a, 0x05, 0x0c, 0x34, 0x0b, 0xf0, 0x1a,
+    0x0b, 0x25, 0x09, 0x0a, 0x09, 0x04, 0x0a, 0x03, 0x0b, 0x12, 0x1c, 0x03,
+    0x0f, 0x05, 0x0d, 0x04, 0x39, 0x03, 0x06, 0x08, 0xf0, 0x06, 0x08, 0x05,
+    0x07, 0x03, 0x28, 0x12, 0x03, 0x0b, 0x05, 0x0d, 0x06, 0x0a, 0x05, 0x09,
+    0x14, 0x0a, 0x0e, 0x15, 0x0d, 0x0b, 0x34, 0x0c, 0x1b, 0xf0, 0x0a, 0x03,
+    0x08, 0x12, 0x07, 0x09, 0x05, 0x4a, 0x07, 0x25, 0x24, 0x1c, 0x0e, 0x15,
+    0x1c, 0x14, 0x0e, 0x0b, 0xf0, 0x03, 0x1c, 0x12, 0x09, 0x03, 0x08, 0x04,
+    0x19, 0x05, 0x04, 0x2a, 0x03, 0x04, 0x06, 0x1b, 0x04, 0x11, 0x5a, 0x06,
+    0x09, 0x15, 0xf0, 0x14, 0x0d, 0x0c, 0x05, 0x3a, 0x16, 0x05, 0x44, 0x0b,
+    0x0c, 0x0d, 0x0c, 0x09, 0x13, 0x0b, 0x0c, 0x04, 0x0a, 0x15, 0x2b, 0xf0,
+    0x03, 0x01, 0x0a, 0x10, 0x08, 0x07, 0x03, 0x0a, 0x0d, 0x1b, 0x07, 0x16,
+    0x0d, 0x0c, 0x04, 0x0d, 0x03, 0x0e, 0x04, 0x0b, 0x16, 0x0a, 0x1b, 0x05,
+    0xf0, 0x34, 0x0d, 0x0e, 0x0f, 0x0e, 0x23, 0x0f, 0x1c, 0x04, 0x09, 0x05,
+    0x18, 0x16, 0x07, 0x05, 0x16, 0x02, 0x01, 0x07, 0x06, 0x09, 0x0f, 0x0b,
+    0xf0, 0x05, 0x0a, 0x02, 0x09, 0x00, 0x0e, 0x01, 0x0a, 0x05, 0x0c, 0x0d,
+    0x2e, 0x08, 0x05, 0x04, 0x0c, 0x13, 0x0e, 0x0f, 0x04, 0x0d, 0x15, 0x1a,
+    0x24, 0x0d, 0x1b, 0xf0, 0x05, 0x1a, 0x06, 0x04, 0x0e, 0x02, 0x0f, 0x10,
+    0x0e, 0x0f, 0x05, 0x1c, 0x08, 0x06, 0x0b, 0x05, 0x0c, 0x14, 0x2b, 0x15,
+    0x0e, 0x03, 0x0f, 0xf0, 0x01, 0x0d, 0x00, 0x0a, 0x02, 0x08, 0x07, 0x0a,
+    0x0d, 0x09, 0x06, 0x1a, 0x05, 0x04, 0x0c, 0x03, 0x0d, 0x04, 0x09, 0x05,
+    0x1a, 0x06, 0x05, 0x0b, 0x02, 0x0d, 0x00, 0x0c, 0x02, 0x0d, 0xf0, 0x19,
+    0x1c, 0x07, 0x0d, 0x05, 0x0b, 0x03, 0x0c, 0x02, 0x0f, 0x03, 0x1d, 0x14,
+    0x0e, 0x13, 0x1f, 0x05, 0x0d, 0x07, 0x0b, 0x06, 0x0a, 0x03, 0x0b, 0x01,
+    0x09, 0xf0, 0x00, 0x06, 0x01, 0x08, 0x06, 0x0c, 0x0f, 0x0f, 0x09, 0x0e,
+    0x04, 0x0d, 0x01, 0x08, 0x00, 0x0b, 0x04, 0x0e, 0x0a, 0x0d, 0x08, 0x0e,
+    0x07, 0x0d, 0x05, 0x0b, 0x13, 0x0d, 0x0b, 0x04, 0x0c, 0xf0, 0x15, 0x2d,
+    0x34, 0x1c, 0x0a, 0x23, 0x0c, 0x1a, 0x04, 0x18, 0x06, 0x0b, 0x07, 0x0f,
+    0x05, 0x08, 0x04, 0x03, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x1f,
+    0x04, 0x22, 0x09, 0x09, 0x07, 0x04, 0x0d, 0xf1, 0x02, 0x0c, 0x11, 0x0a,
+    0x1d, 0x02, 0x33, 0x1e, 0x0b, 0x09, 0x52, 0x0d, 0x0a, 0x09, 0x0b, 0x1d,
+    0x03, 0x08, 0x14, 0x06, 0x81, 0x25, 0x02, 0x10, 0x07, 0x05, 0x19, 0x0f,
+    0x0b, 0x07, 0x05, 0x05, 0x02, 0x06, 0x20, 0x10, 0x05, 0x0a, 0x05, 0x07,
+    0x21, 0x0f, 0x18, 0x0c, 0x07, 0x2e, 0xf0, 0x04, 0x23, 0x0a, 0x09, 0x04,
+    0x18, 0x35, 0x1b, 0x0a, 0x04, 0x0c, 0x03, 0x0b, 0x01, 0x0c, 0x00, 0x0f,
+    0x03, 0x0b, 0x0b, 0x0c, 0x0d, 0x0b, 0xf0, 0x07, 0x19, 0x04, 0x13, 0x18,
+    0x05, 0x29, 0x1a, 0x05, 0x08, 0x02, 0x06, 0x00, 0x07, 0x01, 0x09, 0x06,
+    0x0c, 0x0d, 0x1b, 0x09, 0x06, 0x0c, 0x14, 0x0e, 0xf0, 0x0b, 0x13, 0x0d,
+    0x19, 0x02, 0x01, 0x08, 0x02, 0x0d, 0x09, 0x0e, 0x0f, 0x0d, 0x08, 0x1b,
+    0x05, 0x04, 0x0a, 0x13, 0x0b, 0x0c, 0x04, 0x0b, 0x15, 0x0a, 0x09, 0xf0,
+    0x24, 0x0a, 0x09, 0x0a, 0x05, 0x29, 0x06, 0x05, 0x03, 0x08, 0x01, 0x07,
+    0x00, 0x08, 0x02, 0x0a, 0x19, 0x1c, 0x03, 0x0b, 0x01, 0x0e, 0x04, 0x0d,
+    0x0a, 0x1e, 0xf0, 0x06, 0x34, 0x0b, 0x0a, 0x0b, 0x0e, 0x05, 0x0d, 0x06,
+    0x0a, 0x05, 0x0b, 0x34, 0x0c, 0x1b, 0x0a, 0x43, 0x0e, 0x0d, 0x0b, 0x09,
+    0x70, 0x0b, 0x05, 0x0a, 0x09, 0x08, 0x08, 0x07, 0x03, 0x06, 0x10, 0x15,
+    0x02, 0x04, 0x31, 0x09, 0x05, 0x1f, 0x18, 0x09, 0x0c, 0xf0, 0x05, 0x0a,
+    0x24, 0x19, 0x08, 0x03, 0x0a, 0x04, 0x19, 0x06, 0x07, 0x1a, 0x06, 0x04,
+    0x0b, 0x23, 0x0c, 0x0a, 0x1d, 0x04, 0x05, 0x1e, 0x04, 0xf0, 0x02, 0x0c,
+    0x10, 0x1b, 0x04, 0x0e, 0x1f, 0x0f, 0x0c, 0x09, 0x09, 0x05, 0x07, 0x02,
+    0x06, 0x00, 0x17, 0x01, 0x05, 0x08, 0x0d, 0x0c, 0x0f, 0x0e, 0x0e, 0x2c,
+    0x07, 0xf0, 0x04, 0x03, 0x09, 0x12, 0x0b, 0x1d, 0x03, 0x05, 0x2c, 0x17,
+    0x04, 0x1b, 0x01, 0x00, 0x09, 0x02, 0x0d, 0x0d, 0x4f, 0x0b, 0x05, 0x03,
+    0xf0, 0x12, 0x0c, 0x03, 0x0b, 0x06, 0x0a, 0x07, 0x1b, 0x05, 0x03, 0x0c,
+    0x01, 0x0e, 0x00, 0x0b, 0x01, 0x09, 0x04, 0x0b, 0x0a, 0x0d, 0x0d, 0x0c,
+    0x08, 0x1b, 0x06, 0x05, 0x0a, 0x30, 0x04, 0x08, 0x02, 0x07, 0x10, 0x09,
+    0x08, 0xf1, 0x06, 0x0b, 0x0f, 0x0c, 0x06, 0x0b, 0x03, 0x0e, 0x02, 0x0a,
+    0x11, 0x1d, 0x02, 0x0b, 0x13, 0x19, 0x62, 0x2a, 0x0c, 0x0e, 0x0f, 0xa1,
+    0x0d, 0x01, 0x0b, 0x10, 0x09, 0x06, 0x01, 0x09, 0x13, 0x0b, 0x08, 0x01,
+    0x09, 0x04, 0x0a, 0x0f, 0x09, 0x07, 0x0f, 0xf0, 0x04, 0x0e, 0x23, 0x0a,
+    0x09, 0x0c, 0x05, 0x0b, 0x17, 0x0a, 0x19, 0x05, 0x34, 0x1a, 0x19, 0x33,
+    0x1c, 0x0b, 0x0a, 0xf0, 0x04, 0x09, 0x06, 0x0a, 0x05, 0x0d, 0x03, 0x1b,
+    0x10, 0x1f, 0x12, 0x0b, 0x04, 0x09, 0x0d, 0x0c, 0x0f, 0x0e, 0x07, 0x0d,
+    0x15, 0x0e, 0x0c, 0x04, 0x0e, 0x13, 0x0b, 0xf0, 0x19, 0x04, 0x15, 0x0a,
+    0x0d, 0x04, 0x0c, 0x13, 0x0e, 0x0d, 0x14, 0x0a, 0x1b, 0x15, 0x0a, 0x03,
+    0x09, 0x10, 0x0c, 0x09, 0x05, 0x0b, 0x0f, 0x1e, 0xf0, 0x09, 0x08, 0x0c,
+    0x06, 0x3a, 0x03, 0x01, 0x00, 0x01, 0x08, 0x04, 0x0b, 0x0e, 0x0e, 0x0f,
+    0x0f, 0x09, 0x0e, 0x06, 0x0b, 0x06, 0x0b, 0xf0, 0x07, 0x1a, 0x06, 0x04,
+    0x09, 0x01, 0x0c, 0x10, 0x08, 0x0c, 0x04, 0x0b, 0x1f, 0x0d, 0x0e, 0x0a,
+    0x0c, 0x07, 0x0b, 0x04, 0x0a, 0x02, 0x08, 0x00, 0x06, 0x01, 0x08, 0x0a,
+    0x07, 0xf1, 0x0e, 0x1a, 0x06, 0x03, 0x0b, 0x22, 0x0a, 0x08, 0x09, 0x13,
+    0x08, 0x09, 0x62, 0x0d, 0x0a, 0x0b, 0x0a, 0x19, 0x0b, 0x13, 0x19, 0x61,
+    0x02, 0x08, 0x01, 0x06, 0x10, 0x05, 0x07, 0x11, 0x0a, 0x09, 0x42, 0x06,
+    0x0b, 0x0d, 0x0c, 0x04, 0x0a, 0x02, 0x08, 0x11, 0x0d, 0x11, 0x08, 0x02,
+    0x0e, 0xf0, 0x04, 0x1d, 0x16, 0x0b, 0x14, 0x1c, 0x05, 0x0a, 0x04, 0x0c,
+    0x33, 0x0e, 0x0a, 0x09, 0x0b, 0x24, 0x09, 0x0b, 0x1e, 0x03, 0x02, 0x0a,
+    0xf0, 0x01, 0x17, 0x04, 0x0c, 0x19, 0x03, 0x01, 0x08, 0x02, 0x0e, 0x09,
+    0x1d, 0x0c, 0x08, 0x0e, 0x07, 0x0c, 0x05, 0x0b, 0x23, 0x0e, 0x0a, 0x0c,
+    0x04, 0x0a, 0x15, 0x09, 0xf0, 0x0a, 0x04, 0x0c, 0x13, 0x0d, 0x0f, 0x04,
+    0x0c, 0x05, 0x1b, 0x04, 0x02, 0x0c, 0x00, 0x0a, 0x01, 0x08, 0x0b, 0x0a,
+    0x0f, 0x0b, 0x07, 0x0a, 0x05, 0x0b, 0x14, 0x0e, 0x0b, 0xf0, 0x03, 0x0c,
+    0x02, 0x0b, 0x01, 0x08, 0x00, 0x0e, 0x03, 0x1f, 0x1f, 0x0c, 0x08, 0x0b,
+    0x05, 0x0a, 0x03, 0x0e, 0x12, 0x1f, 0x03, 0x0b, 0x05, 0x1a, 0x06, 0x04,
+    0x0b, 0xf0, 0x01, 0x0c, 0x00, 0x1f, 0x04, 0x0f, 0x0d, 0x09, 0x0a, 0x06,
+    0x29, 0x04, 0x13, 0x18, 0x04, 0x15, 0x09, 0x0a, 0x04, 0x0c, 0x15, 0x0b,
+    0x0d, 0x03, 0x1e, 0xf0, 0x01, 0x00, 0x0a, 0x01, 0x08, 0x06, 0x0a, 0x0f,
+    0x0b, 0x0b, 0x0c, 0x07, 0x0d, 0x04, 0x0c, 0x02, 0x09, 0x00, 0x0c, 0x02,
+    0x1e, 0x19, 0x0b, 0x07, 0x0a, 0x05, 0x0b, 0x24, 0x0a, 0xf0, 0x08, 0x19,
+    0x15, 0x1a, 0x74, 0x08, 0x19, 0x18, 0x09, 0x0b, 0x05, 0x0a, 0x04, 0x1e,
+    0x03, 0x01, 0x0f, 0x20, 0x10, 0x0a, 0x0b, 0x03, 0x08, 0x31, 0x0f, 0x0a,
+    0x0d, 0x09, 0x06, 0x07, 0x04, 0x0e, 0xf0, 0x23, 0x0d, 0x09, 0x2a, 0x04,
+    0x15, 0x0b, 0xa4, 0x2c, 0x0a, 0x09, 0x28, 0x09, 0x0b, 0xf0, 0x0a, 0x03,
+    0x0c, 0x12, 0x09, 0x08, 0x06, 0x2b, 0x09, 0x04, 0x02, 0x09, 0x01, 0x0b,
+    0x03, 0x0e, 0x17, 0x0d, 0x1e, 0x06, 0x05, 0x0b, 0xb4, 0x0a, 0x39, 0xf0,
+    0x0a, 0x0b, 0x0a, 0x0b, 0x1d, 0x09, 0x02, 0x0c, 0x01, 0x0d, 0x03, 0x0e,
+    0x07, 0x0c, 0x06, 0x0a, 0x05, 0x09, 0xf0, 0x44, 0x2a, 0x0b, 0x0a, 0x03,
+    0x09, 0x12, 0x08, 0x0a, 0x05, 0x0d, 0x08, 0x1b, 0x06, 0x05, 0x1a, 0x54,
+    0x09, 0x08, 0x09, 0xf0, 0x0b, 0x0a, 0x03, 0x0b, 0x02, 0x09, 0x03, 0x0a,
+    0x16, 0x0e, 0x0c, 0x05, 0x0b, 0x04, 0x0c, 0x23, 0x0e, 0x0c, 0x0d, 0x64,
+    0x0a, 0x0b, 0x1a, 0xf0, 0x0d, 0x0e, 0x1a, 0x03, 0x12, 0x0b, 0x08, 0x03,
+    0x0a, 0x06, 0x1c, 0x07, 0x06, 0x1a, 0x04, 0x12, 0x0b, 0x0d, 0x05, 0x0b,
+    0x06, 0x1a, 0x05, 0xf0, 0x64, 0x0c, 0x0b, 0x19, 0x0b, 0x0d, 0x0c, 0x63,
+    0x2f, 0x3e, 0x34, 0x0a, 0x0c, 0xf0, 0x0e, 0x0a, 0x03, 0x09, 0x11, 0x0c,
+    0x1a, 0x05, 0x0b, 0x0b, 0x07, 0x1c, 0x05, 0xa4, 0x0b, 0x09, 0x08, 0x09,
+    0x0a, 0x1b, 0xf0, 0x0c, 0x0b, 0x0a, 0x09, 0x25, 0x27, 0x34, 0x2a, 0x19,
+    0x03, 0x02, 0x0c, 0x04, 0x0b, 0x06, 0x1c, 0x05, 0xf0, 0x04, 0x0b, 0x03,
+    0x0a, 0x02, 0x0b, 0x03, 0x08, 0x05, 0x0a, 0x06, 0x0b, 0x05, 0x1d, 0xb4,
+    0x0b, 0x0a, 0x29, 0x0a, 0x3b, 0xf0, 0x0a, 0x03, 0x0c, 0x02, 0x1e, 0x03,
+    0x15, 0x0c, 0x0a, 0x64, 0x0b, 0x0a, 0x19, 0x0a, 0x1c, 0x23, 0x0e, 0xf0,
+    0x09, 0x08, 0x04, 0x09, 0x15, 0x1b, 0x64, 0x0d, 0x0b, 0x2a, 0x09, 0x08,
+    0x13, 0x09, 0x0d, 0x15, 0x1b, 0xf0, 0xd4, 0x0c, 0x0b, 0x0a, 0x19, 0x3a,
+    0x2b, 0x0a, 0x09, 0x23, 0x0b, 0x09, 0xf0, 0x0a, 0x04, 0x0d, 0x05, 0x0c,
+    0x04, 0x0e, 0x13, 0x0d, 0x0a, 0x04, 0x0c, 0x05, 0x0a, 0xf4, 0x0b, 0x0a,
+    0x09, 0x2a, 0x0b, 0x4a, 0xf0, 0x39, 0x34, 0x0a, 0x0b, 0x0c, 0x1a, 0x03,
+    0x02, 0x0d, 0x03, 0x0a, 0x04, 0x2b, 0xf0, 0x25, 0x09, 0xf4, 0x0a, 0x09,
+    0x4a, 0x1b, 0x6a, 0xf0, 0x14, 0x09, 0x08, 0x03, 0x0a, 0x04, 0x09, 0x15,
+    0x1a, 0x44, 0x0c, 0x0a, 0x08, 0x17, 0x06, 0x16, 0x08, 0xf0, 0x09, 0x05,
+    0x0c, 0xf4, 0x0b, 0x0a, 0x39, 0x1a, 0x19, 0x0a, 0x19, 0x0b, 0xf0, 0x1a,
+    0xf4, 0x0b, 0x1c, 0x0b, 0x0a, 0x0b, 0x0c, 0x0b, 0x09, 0x18, 0x29, 0xf0,
+    0x0c, 0x1e, 0xf4, 0x0b, 0x09, 0x18, 0x0a, 0x09, 0x18, 0x0a, 0x0d, 0x0c,
+    0x4b, 0xf0, 0xf4, 0x0c, 0x0a, 0x08, 0x17, 0x09, 0x1a, 0x0c, 0x0e, 0x0a,
+    0x09, 0x0c, 0xf0, 0x0e, 0x0d, 0x54, 0x0c, 0x1b, 0x09, 0x08, 0x06, 0x05,
+    0x15, 0x06, 0x17, 0x16, 0x18, 0x05, 0x03, 0x19, 0x12, 0x0d, 0xf0, 0x04,
+    0x0b, 0x15, 0x0c, 0x0b, 0x64, 0x0e, 0x0b, 0x09, 0x08, 0x0a, 0x1b, 0x25,
+    0x2a, 0x24, 0x0d, 0x0c, 0x0e, 0xf0, 0x15, 0x0b, 0x0c, 0x04, 0x0e, 0x03,
+    0x0c, 0x01, 0x0f, 0x10, 0x0a, 0x0d, 0x03, 0x0b, 0x07, 0x0d, 0x09, 0x0c,
+    0x07, 0x0b, 0x05, 0x1a, 0x34, 0x09, 0x08, 0x19, 0xf0, 0x25, 0x0b, 0x0a,
+    0x44, 0x0e, 0x1c, 0x1b, 0x15, 0x29, 0x04, 0x03, 0x08, 0x02, 0x09, 0x03,
+    0x0b, 0x05, 0x1d, 0x04, 0xf0, 0x13, 0x1c, 0x02, 0x1e, 0x01, 0x02, 0x0b,
+    0x04, 0x0c, 0x16, 0x0a, 0x0b, 0x08, 0x29, 0x07, 0x05, 0x64, 0x1a, 0x0b,
+    0x0c, 0x1e, 0xf0, 0x0b, 0x03, 0x1e, 0x12, 0x0b, 0x03, 0x0a, 0x15, 0x29,
+    0x03, 0x04, 0x1c, 0x07, 0x05, 0x0e, 0x04, 0x0d, 0x03, 0x0b, 0x02, 0x0a,
+    0x01, 0x0d, 0xf0, 0x02, 0x0b, 0x04, 0x0e, 0x06, 0x1b, 0x05, 0x14, 0x0a,
+    0x0b, 0x15, 0x0c, 0x1e, 0x34, 0x1b, 0x1a, 0x03, 0x12, 0x08, 0x07, 0x04,
+    0x09, 0xf0, 0x17, 0x0a, 0x48, 0x16, 0x65, 0x09, 0x0a, 0x0c, 0x0b, 0x39,
+    0x04, 0x03, 0x12, 0x1a, 0x03, 0xf0, 0x14, 0x0c, 0x0e, 0x13, 0x0d, 0x1b,
+    0x15, 0x0c, 0x02, 0x09, 0x01, 0x07, 0x04, 0x09, 0x0a, 0x0b, 0x05, 0x2d,
+    0x24, 0x0c, 0x05, 0x0a, 0x16, 0x09, 0xf0, 0x0a, 0x05, 0x1c, 0x44, 0x0a,
+    0x1d, 0x0a, 0x13, 0x0d, 0x0b, 0x04, 0x09, 0x05, 0x0a, 0x06, 0x09, 0x05,
+    0x08, 0x03, 0x06, 0x01, 0x05, 0x00, 0x16, 0xf0, 0x02, 0x1f, 0x37, 0x09,
+    0x0b, 0x08, 0x16, 0x06, 0x05, 0x07, 0x06, 0x08, 0x07, 0x39, 0x06, 0x35,
+    0x0b, 0x0a, 0x04, 0x0b, 0xf0, 0x23, 0x0d, 0x0b, 0x0d, 0x04, 0x2a, 0x15,
+    0x04, 0x09, 0x02, 0x08, 0x00, 0x0e, 0x02, 0x1f, 0x0c, 0x07, 0x0c, 0x03,
+    0x19, 0x01, 0x00, 0x0d, 0x02, 0x0f, 0xf0, 0x09, 0x0d, 0x0d, 0x0c, 0x07,
+    0x0b, 0x05, 0x1a, 0x84, 0x09, 0x0c, 0x1e, 0x0d, 0x1b, 0x1e, 0x15, 0x0c,
+    0x03, 0x0d, 0xf0, 0x01, 0x1a, 0x00, 0x03, 0x0d, 0x09, 0x0b, 0x07, 0x19,
+    0x26, 0x07, 0x56, 0x07, 0x0a, 0x08, 0x04, 0x11, 0x07, 0x04, 0x5a, 0x0c,
+    0xf0, 0x08, 0x15, 0x14, 0x09, 0x06, 0x07, 0x0a, 0x26, 0x09, 0x05, 0x11,
+    0x07, 0x1b, 0x07, 0x0c, 0x2a, 0x09, 0x06, 0x04, 0x19, 0xf0, 0x13, 0x0b,
+    0x04, 0x0c, 0x05, 0x0a, 0x14, 0x0b, 0x09, 0x05, 0x2a, 0x17, 0x04, 0x0b,
+    0x02, 0x19, 0x10, 0x08, 0x03, 0x0a, 0x1f, 0x0c, 0x0d, 0xf0, 0x06, 0x0b,
+    0x02, 0x19, 0x00, 0x03, 0x08, 0x1c, 0x19, 0x09, 0x4a, 0x06, 0x04, 0x03,
+    0x04, 0x15, 0x0c, 0x0e, 0x74, 0x0d, 0x0b, 0x0d, 0x90, 0x0b, 0x09, 0x27,
+    0x05, 0x08, 0x09, 0x07, 0x0f, 0x06, 0x09, 0x05, 0x04, 0x02, 0x71, 0x10,
+    0x11, 0x06, 0x04, 0x0f, 0x0f, 0x0e, 0x0e, 0x06, 0x0b, 0x03, 0x0a, 0x12,
+    0x0f, 0xf0, 0x1e, 0x03, 0x05, 0x0c, 0x06, 0x0b, 0x15, 0x0d, 0x0c, 0x04,
+    0x0d, 0x33, 0x0f, 0x0d, 0x0e, 0x0f, 0x04, 0x0b, 0x05, 0x09, 0x06, 0x18,
+    0x05, 0x04, 0x06, 0xf0, 0x01, 0x07, 0x00, 0x08, 0x04, 0x0a, 0x1f, 0x1f,
+    0x07, 0x0b, 0x03, 0x18, 0x10, 0x05, 0x03, 0x08, 0x1f, 0x0e, 0x0f, 0x0b,
+    0x0d, 0x06, 0x1b, 0x04, 0x23, 0x0c, 0xf0, 0x09, 0x2a, 0x04, 0x25, 0x0c,
+    0x0b, 0x04, 0x1e, 0x03, 0x01, 0x0f, 0x00, 0x0e, 0x02, 0x09, 0x08, 0x0c,
+    0x0f, 0x1b, 0x08, 0x04, 0x0c, 0x12, 0x0f, 0xf0, 0x0b, 0x03, 0x4e, 0x06,
+    0x08, 0x05, 0x02, 0x10, 0x0b, 0x08, 0x03, 0x0b, 0x19, 0x1d, 0x07, 0x0c,
+    0x05, 0x0d, 0x14, 0x0e, 0x0a, 0x03, 0x0b, 0xf0, 0x02, 0x0a, 0x11, 0x08,
+    0x0d, 0x06, 0x0e, 0x0f, 0x0f, 0x09, 0x0e, 0x05, 0x0d, 0x04, 0x0a, 0x13,
+    0x3b, 0x04, 0x15, 0x0a, 0x04, 0x0b, 0x13, 0x1e, 0xf0, 0x04, 0x0b, 0x05,
+    0x0a, 0x06, 0x28, 0x04, 0x02, 0x10, 0x0a, 0x0f, 0x04, 0x0e, 0x0a, 0x0c,
+    0x05, 0x09, 0x02, 0x08, 0x03, 0x1b, 0x0c, 0x0a, 0x0a, 0x05, 0x29, 0x24,
+    0xf0, 0x1c, 0x05, 0x06, 0x0b, 0x05, 0x1d, 0x64, 0x0b, 0x1a, 0x19, 0x08,
+    0x13, 0x19, 0x05, 0x18, 0x08, 0x60, 0x0c, 0x16, 0x05, 0x01, 0x05, 0x00,
+    0x04, 0x01, 0x07, 0x04, 0x0b, 0x0c, 0x07, 0x11, 0x0f, 0x08, 0x0d, 0x0e,
+    0xf0, 0x06, 0x1b, 0x24, 0x0a, 0x09, 0x13, 0x0b, 0x0c, 0x04, 0x0d, 0x16,
+    0x1c, 0x05, 0x0a, 0x23, 0x0e, 0x0a, 0x0b, 0x04, 0x0c, 0x15, 0x0d, 0x0c,
+    0xf0, 0x03, 0x0a, 0x01, 0x07, 0x00, 0x08, 0x02, 0x2e, 0x0e, 0x0f, 0x09,
+    0x0d, 0x05, 0x1a, 0x02, 0x10, 0x0b, 0x08, 0x02, 0x0b, 0x07, 0x1e, 0x1f,
+    0x1d, 0x08, 0xf0, 0x05, 0x0b, 0x03, 0x0c, 0x12, 0x0d, 0x0c, 0x03, 0x19,
+    0x05, 0x07, 0x0b, 0x08, 0x1c, 0x05, 0x02, 0x0a, 0x00, 0x19, 0x01, 0x08,
+    0x0e, 0x0f, 0x0f, 0x07, 0x1e, 0x04, 0xf0, 0x03, 0x0a, 0x12, 0x0c, 0x0f,
+    0x04, 0x0e, 0x07, 0x0b, 0x06, 0x0c, 0x04, 0x0b, 0x02, 0x0c, 0x10, 0x0e,
+    0x1b, 0x02, 0x07, 0x0c, 0x0e, 0x0d, 0x09, 0x1e, 0x06, 0x05, 0x0d, 0x40,
+    0x04, 0x1a, 0x02, 0x10, 0x0c, 0x09, 0x04, 0x07, 0xf1, 0x0f, 0x0d, 0x08,
+    0x1c, 0x04, 0x02, 0x0e, 0x11, 0x0f, 0x0d, 0x02, 0x29, 0x13, 0x42, 0x0b,
+    0x0a, 0x09, 0x0b, 0x0c, 0x13, 0x08, 0x09, 0xf1, 0x02, 0x08, 0x01, 0x07,
+    0x10, 0x06, 0x1a, 0x02, 0x03, 0x09, 0x01, 0x0a, 0x02, 0x0e, 0x0b, 0x0d,
+    0x07, 0x1b, 0x03, 0x02, 0x09, 0x01, 0x0c, 0x02, 0x07, 0x03, 0x08, 0x05,
+    0x07, 0x11, 0x06, 0x06, 0x05, 0x0a, 0xf0, 0x34, 0x0b, 0x0a, 0x19, 0x43,
+    0x2c, 0x0b, 0x0c, 0x05, 0x1a, 0x06, 0x04, 0x0b, 0x01, 0x09, 0x00, 0x0a,
+    0x13, 0x18, 0xf0, 0x02, 0x0c, 0x06, 0x0d, 0x0f, 0x0e, 0x0a, 0x0d, 0x26,
+    0x0c, 0x0a, 0x08, 0x05, 0x07, 0x04, 0x46, 0x05, 0x07, 0x09, 0x08, 0x05,
+    0x07, 0x24, 0x08, 0x09, 0xf0, 0x0a, 0x05, 0x29, 0x06, 0x04, 0x01, 0x0a,
+    0x00, 0x07, 0x03, 0x08, 0x0f, 0x0b, 0x0e, 0x3a, 0x09, 0x07, 0x04, 0x02,
+    0x09, 0x01, 0x07, 0x00, 0x0c, 0x02, 0x0a, 0xf0, 0x07, 0x0c, 0x0f, 0x0f,
+    0x0e, 0x0e, 0x07, 0x0c, 0x05, 0x09, 0x03, 0x0a, 0x12, 0x2e, 0x03, 0x05,
+    0x0b, 0x06, 0x0d, 0x05, 0x0b, 0x02, 0x0c, 0x00, 0x0a, 0x01, 0x0d, 0x0d,
+    0x0e, 0xf0, 0x0f, 0x2d, 0x06, 0x04, 0x23, 0x0b, 0x08, 0x39, 0x04, 0x06,
+    0x07, 0x08, 0x18, 0x06, 0x03, 0x07, 0x01, 0x06, 0x00, 0x07, 0x02, 0x09,
+    0x09, 0x0c, 0x70, 0x0f, 0x0f, 0x0c, 0x1d, 0x08, 0x05, 0x0c, 0x02, 0x0e,
+    0x10, 0x09, 0x07, 0x05, 0x06, 0xf1, 0x0f, 0x09, 0x07, 0x1a, 0x04, 0x32,
+    0x0c, 0x19, 0x0c, 0x13, 0x09, 0x08, 0x52, 0x1a, 0x0b, 0x19, 0x0a, 0x23,
+    0x08, 0x71, 0x09, 0x07, 0x02, 0x06, 0x01, 0x04, 0x10, 0x05, 0x1b, 0x01,
+    0x04, 0x09, 0x22, 0x0f, 0x0d, 0x06, 0x0a, 0x03, 0x0e, 0x61, 0x02, 0x39,
+    0x11, 0x02, 0x04, 0x08, 0x06, 0x06, 0x05, 0x0a, 0xf0, 0x24, 0x0b, 0x0e,
+    0x0d, 0x43, 0x0f, 0x0c, 0x1a, 0x0e, 0x04, 0x0a, 0x05, 0x09, 0x04, 0x0a,
+    0x03, 0x28, 0x01, 0x02, 0x0e, 0x39, 0x06, 0xf0, 0x11, 0x05, 0x0b, 0x0d,
+    0x0d, 0x0a, 0x1c, 0x08, 0x06, 0x1b, 0x04, 0x23, 0x0a, 0x0b, 0x0e, 0x04,
+    0x0b, 0x15, 0x39, 0x14, 0xf0, 0x05, 0x18, 0x06, 0x05, 0x09, 0x03, 0x0a,
+    0x01, 0x08, 0x00, 0x1a, 0x05, 0x0f, 0x0e, 0x07, 0x0d, 0x05, 0x0b, 0x24,
+    0x0e, 0x0c, 0x09, 0x03, 0x0a, 0x01, 0x0f, 0x00, 0x0d, 0xf0, 0x01, 0x0e,
+    0x09, 0x0d, 0x0f, 0x0f, 0x09, 0x0e, 0x06, 0x0b, 0x04, 0x1a, 0x23, 0x09,
+    0x1a, 0x04, 0x06, 0x09, 0x05, 0x0a, 0x02, 0x0b, 0x00, 0x0e, 0x02, 0x1f,
+    0x0c, 0xf0, 0x0a, 0x0d, 0x06, 0x0b, 0x04, 0x0c, 0x23, 0x0a, 0x08, 0x0a,
+    0x04, 0x0b, 0x05, 0x0a, 0x14, 0x0c, 0x0e, 0x05, 0x0d, 0x04, 0x0e, 0x02,
+    0x0d, 0x10, 0x0f, 0x0a, 0x02, 0x0f, 0xf0, 0x0a, 0x1e, 0x0c, 0x09, 0x1d,
+    0x05, 0x02, 0x1f, 0x00, 0x01, 0x0c, 0x07, 0x2b, 0x0a, 0x07, 0x05, 0x0d,
+    0x04, 0x0b, 0x13, 0x0d, 0x0e, 0x04, 0x0c, 0x05, 0x0a, 0xe0, 0x04, 0x0b,
+    0x53, 0x0d, 0x2e, 0x0d, 0x0e, 0x04, 0x0a, 0x05, 0x09, 0x06, 0x18, 0x05,
+    0x03, 0x37, 0x01, 0x00, 0x01, 0x31, 0x0a, 0x09, 0x0f, 0x0b, 0x07, 0x08,
+    0x05, 0x0c, 0xf0, 0x04, 0x09, 0x23, 0x0a, 0x09, 0x1d, 0x04, 0x05, 0x0b,
+    0x34, 0x0e, 0x0c, 0x0d, 0x0b, 0x43, 0x0f, 0x0e, 0x0c, 0x0d, 0x0e, 0x24,
+    0x0a, 0xf0, 0x0b, 0x09, 0x03, 0x17, 0x02, 0x05, 0x18, 0x0f, 0x08, 0x07,
+    0x04, 0x26, 0x02, 0x03, 0x08, 0x07, 0x0c, 0x18, 0x0a, 0x07, 0x09, 0x05,
+    0x08, 0xa4, 0x49, 0xf0, 0x0b, 0x1a, 0x0c, 0x0e, 0x0b, 0x03, 0x09, 0x01,
+    0x1e, 0x02, 0x16, 0x0d, 0x0c, 0x05, 0x1a, 0xf0, 0x44, 0x09, 0x0a, 0x1b,
+    0x03, 0x0e, 0x02, 0x0a, 0x01, 0x1e, 0x03, 0x17, 0x0d, 0x0b, 0x05, 0x1c,
+    0x14, 0x09, 0x13, 0x0e, 0x0d, 0xf0, 0x14, 0x1b, 0x03, 0x0e, 0x12, 0x0b,
+    0x0d, 0x05, 0x0e, 0x07, 0x0b, 0x05, 0x1c, 0xb4, 0x09, 0x18, 0x09, 0x0b,
+    0x1a, 0xf0, 0x0c, 0x0e, 0x0c, 0x28, 0x03, 0x12, 0x0a, 0x04, 0x0e, 0x07,
+    0x0d, 0x06, 0x0c, 0x05, 0x09, 0x03, 0x08, 0x02, 0x0a, 0x04, 0x1b, 0x06,
+    0x05, 0x0a, 0xf0, 0xa4, 0x0d, 0x0b, 0x0a, 0x09, 0x0a, 0x0c, 0x0d, 0x2a,
+    0x09, 0x33, 0x2e, 0x0f, 0x24, 0x0c, 0xf0, 0x0d, 0x1c, 0x03, 0x02, 0x09,
+    0x01, 0x08, 0x03, 0x39, 0x1b, 0x07, 0x05, 0x1a, 0x04, 0x13, 0x0e, 0x0d,
+    0xd4, 0x0a, 0x1b, 0xf0, 0x1c, 0x0b, 0x09, 0x1a, 0x09, 0x2a, 0x09, 0x03,
+    0x0a, 0x02, 0x0b, 0x03, 0x0c, 0x16, 0x0b, 0x0a, 0xf0, 0x05, 0x09, 0x04,
+    0x18, 0x13, 0x07, 0x04, 0x09, 0x16, 0x0a, 0x1b, 0x05, 0xb4, 0x0c, 0x0b,
+    0x0a, 0x29, 0x0a, 0x2b, 0xf0, 0x0a, 0x19, 0x13, 0x1a, 0x15, 0x0b, 0x74,
+    0x0c, 0x0a, 0x19, 0x0a, 0x0b, 0x0c, 0x1a, 0xf0, 0x23, 0x09, 0x0a, 0x05,
+    0x19, 0x06, 0x05, 0x0a, 0x54, 0x0c, 0x2a, 0x09, 0x08, 0x13, 0x1a, 0x04,
+    0x0e, 0x05, 0x0c, 0xf0, 0xd4, 0x0d, 0x0b, 0x0a, 0x19, 0x5a, 0x0b, 0x1a,
+    0x23, 0x0d, 0x0a, 0xf0, 0x19, 0x04, 0x15, 0x0b, 0x0a, 0x04, 0x09, 0x03,
+    0x1a, 0x04, 0x05, 0x0b, 0xf4, 0x0d, 0x4a, 0x0b, 0x4a, 0xf0, 0x39, 0x14,
+    0x1a, 0x15, 0x38, 0x04, 0x13, 0x39, 0x04, 0xf0, 0x05, 0x06, 0x05, 0x0a,
+    0xf4, 0x0c, 0x5a, 0x1b, 0x0a, 0x09, 0x5a, 0xf0, 0x04, 0x23, 0x0e, 0x0a,
+    0x0c, 0x34, 0x0d, 0x0e, 0x0b, 0x0a, 0x23, 0x0e, 0x0b, 0x09, 0x04, 0x08,
+    0x15, 0x0a, 0xf0, 0x0b, 0x94, 0x0e, 0x0c, 0x1a, 0x29, 0x1a, 0x0b, 0x33,
+    0x0e, 0x0c, 0x0d, 0x0e, 0x14, 0x0c, 0xf0, 0x0b, 0x13, 0x1d, 0x04, 0x19,
+    0x25, 0x0a, 0x09, 0x34, 0x1c, 0x0b, 0x0a, 0x13, 0x0e, 0x0d, 0x54, 0x0b,
+    0x0c, 0x09, 0xf0, 0x0b, 0x0d, 0x1e, 0x03, 0x12, 0x0d, 0x29, 0x03, 0x16,
+    0x0a, 0x04, 0x0c, 0x13, 0x1e, 0x64, 0x0a, 0x0c, 0x2e, 0xf0, 0x1c, 0x15,
+    0x0a, 0x1b, 0x04, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x07, 0x02, 0x06, 0x07,
+    0x57, 0x0f, 0x0c, 0x07, 0x75, 0xf0, 0x09, 0x3a, 0x09, 0x24, 0x0a, 0x19,
+    0x23, 0x0b, 0x09, 0x08, 0x12, 0x0a, 0x0e, 0x14, 0x0b, 0x09, 0xf0, 0x03,
+    0x0b, 0x04, 0x0c, 0x05, 0x0d, 0x06, 0x1a, 0x15, 0x09, 0x14, 0x1b, 0x05,
+    0x0a, 0x14, 0x0c, 0x0a, 0x25, 0x09, 0x0a, 0x09, 0x04, 0x2b, 0x03, 0xf0,
+    0x12, 0x0d, 0x04, 0x0e, 0x07, 0x0c, 0x06, 0x1a, 0x03, 0x01, 0x08, 0x00,
+    0x0a, 0x02, 0x1c, 0x07, 0x0b, 0x1d, 0x09, 0x06, 0x0c, 0x04, 0x0b, 0x13,
+    0x0a, 0x09, 0xf0, 0x04, 0x0a, 0x25, 0x0b, 0x0d, 0x0c, 0x03, 0x0e, 0x02,
+    0x0c, 0x01, 0x0d, 0x02, 0x0b, 0x06, 0x0c, 0x0c, 0x0d, 0x08, 0x0e, 0x05,
+    0x0c, 0x03, 0x0b, 0x12, 0x09, 0x0e, 0x05, 0x0c, 0xf0, 0x06, 0x2a, 0x04,
+    0x03, 0x02, 0x1b, 0x11, 0x0f, 0x04, 0x1d, 0x07, 0x08, 0x0c, 0x05, 0x0d,
+    0x03, 0x0b, 0x01, 0x09, 0x02, 0x2a, 0x0d, 0x0e, 0x07, 0x0b, 0xf0, 0x05,
+    0x0d, 0x04, 0x0e, 0x23, 0x0f, 0x0e, 0x0a, 0x02, 0x0d, 0x03, 0x0a, 0x14,
+    0x0c, 0x0e, 0x02, 0x0d, 0x03, 0x0b, 0x08, 0x0e, 0x09, 0x0c, 0x04, 0x0d,
+    0x02, 0x0a, 0x10, 0x08, 0xf0, 0x07, 0x04, 0x09, 0x0f, 0x0a, 0x0e, 0x0b,
+    0x07, 0x0d, 0x24, 0x0c, 0x0a, 0x1d, 0x25, 0x0b, 0x0a, 0x04, 0x0e, 0x03,
+    0x3f, 0x02, 0x11, 0xf0, 0x03, 0x1e, 0x06, 0x05, 0x1a, 0x02, 0x01, 0x08,
+    0x03, 0x0b, 0x0e, 0x2e, 0x0a, 0x07, 0x06, 0x0d, 0x05, 0x1b, 0x04, 0x13,
+    0x0e, 0x0a, 0x12, 0x0e, 0x0f, 0xa0, 0x03, 0x0b, 0x24, 0x09, 0x18, 0x05,
+    0x27, 0x09, 0x08, 0x03, 0x06, 0x10, 0x04, 0x06, 0x0d, 0x08, 0xb1, 0x0f,
+    0x0f, 0x05, 0x0c, 0x03, 0x0f, 0x22, 0x0e, 0x0b, 0x0e, 0x73, 0x0c, 0x0d,
+    0x0c, 0x0a, 0x09, 0x0f, 0xf0, 0x0c, 0x0e, 0x24, 0x09, 0x0a, 0x19, 0x03,
+    0x11, 0x07, 0x09, 0x03, 0x1d, 0x11, 0x0b, 0x06, 0x1e, 0x09, 0x25, 0x0c,
+    0x0e, 0x0c, 0xf0, 0x04, 0x0d, 0x05, 0x0b, 0x16, 0x0a, 0x0b, 0x14, 0x0d,
+    0x1b, 0x05, 0x07, 0x09, 0x05, 0x0a, 0x03, 0x0b, 0x01, 0x08, 0x00, 0x0a,
+    0x05, 0x0e, 0x0f, 0x0f, 0x08, 0x1d, 0x06, 0xf0, 0x04, 0x0b, 0x02, 0x0c,
+    0x00, 0x0b, 0x01, 0x0a, 0x08, 0x3e, 0x0e, 0x04, 0x01, 0x00, 0x0a, 0x01,
+    0x2e, 0x07, 0x0f, 0x08, 0x0c, 0x04, 0x0b, 0x02, 0x08, 0x00, 0x09, 0x00,
+    0x02, 0x08, 0x11, 0x0f, 0x0a, 0x0b, 0x0f, 0xf0, 0x06, 0x0e, 0x05, 0x1a,
+    0x14, 0x09, 0x05, 0x18, 0x16, 0x07, 0x04, 0x36, 0x01, 0x03, 0x0c, 0x0a,
+    0x07, 0x08, 0x28, 0x07, 0x04, 0x03, 0x09, 0xf0, 0x11, 0x0a, 0x0e, 0x09,
+    0x0d, 0x04, 0x0a, 0x01, 0x0b, 0x04, 0x39, 0x0b, 0x0a, 0x25, 0x08, 0x17,
+    0x16, 0x08, 0x07, 0x09, 0x05, 0x0b, 0x03, 0x0e, 0xf0, 0x01, 0x0c, 0x00,
+    0x0f, 0x04, 0x1b, 0x07, 0x03, 0x0e, 0x01, 0x0c, 0x04, 0x0d, 0x0f, 0x1b,
+    0x06, 0x15, 0x0c, 0x0a, 0x04, 0x0c, 0x03, 0x0d, 0x04, 0x0a, 0x06, 0x09,
+    0x0a, 0x08, 0xa0, 0x09, 0x17, 0x04, 0x01, 0x16, 0x00, 0x02, 0x09, 0x0c,
+    0x0d, 0x0f, 0x0f, 0x0a, 0x06, 0x05, 0x03, 0x10, 0x02, 0x04, 0x01, 0x1f,
+    0x08, 0x12, 0x09, 0x06, 0x0f, 0x71, 0x04, 0x0c, 0x02, 0x0e, 0x11, 0x1f,
+    0x02, 0x0d, 0x03, 0x0b, 0x34, 0x09, 0x1f, 0xd0, 0x0b, 0x23, 0x0e, 0x0b,
+    0x0a, 0x32, 0x1d, 0x08, 0x0a, 0x1f, 0x0b, 0x08, 0x01, 0x04, 0x00, 0x02,
+    0x03, 0x03, 0xf1, 0x1f, 0x0c, 0x0e, 0x07, 0x0b, 0x03, 0x0c, 0x02, 0x0a,
+    0x01, 0x0e, 0x02, 0x1a, 0x33, 0x0d, 0x3c, 0x02, 0x11, 0x06, 0x00, 0x05,
+    0x03, 0x08, 0x71, 0x0f, 0x0b, 0x06, 0x19, 0x04, 0x03, 0x18, 0x02, 0x01,
+    0x05, 0x00, 0x04, 0x02, 0x03, 0x32, 0x0a, 0x05, 0x0f, 0x06, 0x0a, 0x04,
+    0x04, 0x02, 0x13, 0x01, 0x01, 0x00, 0xf0, 0x05, 0x02, 0x07, 0x1f, 0x08,
+    0x1a, 0x07, 0x12, 0x07, 0x0a, 0x0f, 0x1c, 0x09, 0x24, 0x0e, 0x0b, 0x0d,
+    0x25, 0x0c, 0x0a, 0x29, 0x04, 0x03, 0x90, 0x11, 0x0a, 0x2c, 0x05, 0x0e,
+    0x09, 0x0d, 0x05, 0x0c, 0x02, 0x0d, 0x01, 0x0a, 0x10, 0x1c, 0x01, 0x08,
+    0x12, 0x0b, 0x0f, 0x0a, 0x04, 0x01, 0x08, 0x01, 0xb0, 0x09, 0x00, 0x06,
+    0x03, 0x07, 0x0c, 0x08, 0x0d, 0x09, 0x07, 0x1a, 0x06, 0x05, 0x0b, 0x04,
+    0x0e, 0x03, 0x0c, 0x02, 0x0e, 0x01, 0x0d, 0x00, 0x61, 0x09, 0x02, 0x0a,
+    0x04, 0x0e, 0x02, 0x0d, 0x00, 0x2a, 0x03, 0x0e, 0x06, 0xf0, 0x1f, 0x64,
+    0x0e, 0x0d, 0x0b, 0x0a, 0x08, 0x09, 0x05, 0x0b, 0x06, 0x1a, 0x04, 0x02,
+    0x09, 0x10, 0x0d, 0x0b, 0x03, 0x0e, 0x08, 0x09, 0x04, 0x10, 0x07, 0x10,
+    0x05, 0x01, 0x08, 0x1f, 0x13, 0x17, 0x04, 0x12, 0x08, 0x22, 0x07, 0x51,
+    0x09, 0x0b, 0x33, 0x0a, 0x0d, 0x0a, 0x09, 0x14, 0x90, 0x1e, 0x33, 0x2f,
+    0x0d, 0x02, 0x0a, 0x01, 0x1c, 0x00, 0x01, 0x0f, 0x0e, 0x11, 0x0d, 0x0f,
+    0x0a, 0x03, 0x40, 0x07, 0x10, 0x05, 0x06, 0x03, 0x09, 0x0d, 0x0d, 0x0f,
+    0x11, 0x0a, 0x09, 0x09, 0x06, 0xf0, 0x0e, 0x24, 0x0d, 0x0c, 0x09, 0x13,
+    0x0b, 0x0c, 0x14, 0x0e, 0x1f, 0x03, 0x01, 0x0e, 0x00, 0x0a, 0x04, 0x0e,
+    0x0f, 0x1f, 0x08, 0x07, 0x0e, 0x05, 0x2c, 0x03, 0xa0, 0x01, 0x00, 0x09,
+    0x01, 0x0a, 0x08, 0x0c, 0x0f, 0x0f, 0x0e, 0x0c, 0x07, 0x09, 0x03, 0x08,
+    0x01, 0x07, 0x00, 0x08, 0x01, 0x31, 0x06, 0x13, 0x08, 0x09, 0x01, 0x0a,
+    0x03, 0x32, 0x19, 0x0f, 0x05, 0x08, 0x02, 0x07, 0x11, 0xb1, 0x0a, 0x29,
+    0x02, 0x04, 0x05, 0x0a, 0x04, 0x09, 0x02, 0x17, 0x10, 0x16, 0x04, 0x0f,
+    0x07, 0x0b, 0x06, 0x09, 0x40, 0x07, 0x04, 0x26, 0x02, 0x00, 0x01, 0x0b,
+    0x1f, 0x41, 0x0d, 0x0f, 0x05, 0x0b, 0x02, 0x0a, 0x10, 0x08, 0xf0, 0x09,
+    0x02, 0x08, 0x07, 0x09, 0x0f, 0x1a, 0x0d, 0x08, 0x09, 0x07, 0x28, 0x05,
+    0x03, 0x01, 0x19, 0x00, 0x02, 0x1b, 0x0e, 0x05, 0x09, 0x02, 0x0a, 0x0a,
+    0x1e, 0x0f, 0xf0, 0x06, 0x0b, 0x25, 0x0a, 0x09, 0x0a, 0x64, 0x39, 0x0a,
+    0x0d, 0x0e, 0x03, 0x0b, 0x02, 0x09, 0x11, 0x08, 0x47, 0x13, 0x20, 0x00,
+    0x01, 0x02, 0x0f, 0x04, 0x0a, 0x0d, 0x03, 0x0c, 0x04, 0x02, 0x0d, 0x02,
+    0xe1, 0x0e, 0x11, 0x0c, 0x1b, 0x02, 0x03, 0x0e, 0x04, 0x1b, 0x03, 0x62,
+    0x0c, 0x0d, 0x2a, 0x08, 0x16, 0x01, 0x00, 0x10, 0x07, 0x02, 0x0c, 0x0f,
+    0x21, 0x0e, 0x09, 0x0c, 0x02, 0x0a, 0x00, 0xf0, 0x1b, 0x01, 0x03, 0x08,
+    0x02, 0x0a, 0x05, 0x2e, 0x0f, 0x0e, 0x16, 0x0c, 0x1a, 0x05, 0x04, 0x09,
+    0x33, 0x0a, 0x0d, 0x0e, 0x0b, 0x11, 0x18, 0xf0, 0x0a, 0x0b, 0x0f, 0x0e,
+    0x08, 0x0d, 0x06, 0x1c, 0x05, 0x04, 0x0a, 0x02, 0x18, 0x00, 0x01, 0x09,
+    0x0c, 0x0a, 0x0f, 0x2b, 0x09, 0x07, 0x04, 0x1c, 0x02, 0x01, 0x10, 0x19,
+    0x10, 0x11, 0x17, 0x11, 0x42, 0x08, 0x0a, 0x0a, 0x0f, 0x0d, 0x04, 0x0b,
+    0x02, 0x09, 0x11, 0xd1, 0x0c, 0x09, 0x02, 0x08, 0x03, 0x0a, 0x14, 0x09,
+    0x18, 0x02, 0x10, 0x07, 0x06, 0x05, 0x17, 0x0f, 0x08, 0x06, 0x05, 0x05,
+    0x03, 0x04, 0x02, 0x10, 0x05, 0x00, 0x06, 0x02, 0x21, 0x07, 0x0f, 0x0a,
+    0x0e, 0x09, 0x0c, 0xf0, 0x0c, 0x06, 0x0a, 0x03, 0x08, 0x01, 0x17, 0x00,
+    0x01, 0x0b, 0x07, 0x0c, 0x0f, 0x0f, 0x0d, 0x0e, 0x08, 0x0d, 0x05, 0x0c,
+    0x03, 0x0a, 0x01, 0x08, 0x00, 0x06, 0x02, 0x09, 0x0b, 0x0a, 0x13, 0xf0,
+    0x0b, 0x0c, 0x0f, 0x0f, 0x0c, 0x0e, 0x06, 0x1a, 0x05, 0x74, 0x1c, 0x09,
+    0x1a, 0x09, 0x28, 0x25, 0x09, 0x50, 0x08, 0x04, 0x17, 0x01, 0x20, 0x15,
+    0x07, 0x04, 0x02, 0x0b, 0x0f, 0x08, 0x0a, 0x08, 0x05, 0x09, 0x03, 0x03,
+    0x0a, 0x01, 0x32, 0x0c, 0x10, 0x0b, 0x0a, 0x01, 0x08, 0x03, 0x11, 0x1b,
+    0x04, 0x05, 0xa0, 0x0d, 0x44, 0x0b, 0x0e, 0x0c, 0x0a, 0x29, 0x03, 0x02,
+    0x01, 0x0b, 0x00, 0x0a, 0x03, 0x0f, 0x0f, 0x11, 0x0a, 0x05, 0x09, 0x02,
+    0xf0, 0x0e, 0x01, 0x29, 0x06, 0x08, 0x02, 0x08, 0x01, 0x09, 0x04, 0x0c,
+    0x0f, 0x0b, 0x0c, 0x1a, 0x09, 0x07, 0x19, 0x05, 0x14, 0x28, 0x13, 0x17,
+    0x01, 0xf0, 0x02, 0x08, 0x1f, 0x0c, 0x0b, 0x07, 0x1c, 0x06, 0x04, 0x0e,
+    0x03, 0x1c, 0x01, 0x00, 0x08, 0x02, 0x4e, 0x0f, 0x09, 0x05, 0x34, 0x0c,
+    0x40, 0x09, 0x08, 0x02, 0x07, 0x10, 0x06, 0x05, 0x01, 0x02, 0x24, 0x0d,
+    0x05, 0x0f, 0x08, 0x04, 0x0a, 0x03, 0x02, 0x0e, 0x22, 0x21, 0x08, 0x06,
+    0x0c, 0x41, 0x02, 0x0b, 0x13, 0x1d, 0x02, 0x08, 0x00, 0x0d, 0x80, 0x01,
+    0x0a, 0x0a, 0x0c, 0x0f, 0x0d, 0x08, 0x0c, 0x05, 0x1a, 0x02, 0x01, 0x08,
+    0x00, 0x06, 0x02, 0x07, 0x41, 0x0f, 0x0c, 0x09, 0x09, 0x16, 0x07, 0x06,
+    0x05, 0x0a, 0xf0, 0x03, 0x08, 0x01, 0x06, 0x00, 0x17, 0x02, 0x0d, 0x0b,
+    0x0f, 0x0f, 0x0e, 0x0e, 0x07, 0x0c, 0x04, 0x08, 0x01, 0x07, 0x00, 0x29,
+    0x04, 0x09, 0x03, 0x08, 0x02, 0x0b, 0x1f, 0x0c, 0xf0, 0x0d, 0x16, 0x0b,
+    0x1a, 0x15, 0x09, 0x24, 0x08, 0x09, 0x0a, 0x13, 0x0e, 0x0b, 0x04, 0x08,
+    0x05, 0x07, 0x07, 0x06, 0x0c, 0x05, 0x0f, 0x04, 0x0c, 0x02, 0x10, 0x03,
+    0x01, 0x10, 0x10, 0x01, 0x02, 0x08, 0x03, 0x05, 0x0f, 0x0f, 0x0f, 0x04,
+    0x0a, 0x0d, 0x01, 0x07, 0x0c, 0x20, 0x05, 0x19, 0x03, 0x02, 0x0a, 0x01,
+    0xa1, 0x0e, 0x02, 0x0f, 0x13, 0x0e, 0x0c, 0x52, 0x1f, 0x0e, 0x0b, 0x0a,
+    0x08, 0x11, 0x09, 0xf0, 0x0e, 0x00, 0x0b, 0x02, 0x0c, 0x0f, 0x0f, 0x07,
+    0x0c, 0x01, 0x1e, 0x02, 0x0d, 0x2f, 0x08, 0x02, 0x10, 0x0e, 0x0f, 0x05,
+    0x1e, 0x0f, 0x0e, 0x0d, 0x09, 0x1b, 0x05, 0x40, 0x14, 0x09, 0x0a, 0x03,
+    0x19, 0x02, 0x10, 0x31, 0x17, 0x06, 0x18, 0x0f, 0x09, 0xf0, 0x0c, 0x07,
+    0x1e, 0x04, 0x02, 0x0f, 0x10, 0x3e, 0x06, 0x0f, 0x07, 0x1a, 0x05, 0x14,
+    0x09, 0x08, 0x06, 0x06, 0x0a, 0x05, 0x08, 0x04, 0x03, 0x13, 0x10, 0x10,
+    0x15, 0x06, 0x03, 0x0f, 0x1e, 0x04, 0x05, 0x13, 0x02, 0x0c, 0x21, 0x0b,
+    0x02, 0x1e, 0x31, 0x02, 0x0b, 0x13, 0x09, 0x1f, 0xf0, 0x01, 0x00, 0x0c,
+    0x04, 0x0e, 0x0f, 0x0f, 0x09, 0x1e, 0x06, 0x04, 0x0d, 0x02, 0x0b, 0x01,
+    0x0a, 0x00, 0x09, 0x01, 0x0e, 0x0f, 0x1f, 0x0d, 0x17, 0x0e, 0x0c, 0x05,
+    0x1b, 0x40, 0x03, 0x01, 0x0e, 0x10, 0x0a, 0x09, 0x03, 0x18, 0x31, 0x0f,
+    0x0d, 0x09, 0x06, 0x07, 0x02, 0x0b, 0xf0, 0x00, 0x09, 0x02, 0x0d, 0x0a,
+    0x0c, 0x06, 0x29, 0x02, 0x01, 0x07, 0x0b, 0x0f, 0x0e, 0x17, 0x0d, 0x0c,
+    0x06, 0x0a, 0x04, 0x0c, 0x03, 0x0e, 0x44, 0x0a, 0x09, 0x08, 0x90, 0x17,
+    0x05, 0x06, 0x08, 0x25, 0x0c, 0x0f, 0x0c, 0x03, 0x04, 0x01, 0x10, 0x10,
+    0x01, 0x0a, 0x03, 0x05, 0x0f, 0x0f, 0x1f, 0x04, 0x09, 0x01, 0x07, 0x1e,
+    0x20, 0x04, 0x42, 0x0f, 0x0d, 0x01, 0x09, 0x12, 0x18, 0x23, 0xf1, 0x0a,
+    0x0b, 0x08, 0x12, 0x19, 0x13, 0x27, 0x02, 0x01, 0x08, 0x10, 0x07, 0x09,
+    0x04, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x0a, 0x09, 0x0f, 0x0a, 0x08, 0x40,
+    0x0c, 0x03, 0x0a, 0x01, 0x08, 0x00, 0x07, 0x02, 0x08, 0x0b, 0x11, 0x07,
+    0x0f, 0x09, 0x0c, 0x70, 0x0e, 0x05, 0x1c, 0x14, 0x0b, 0x03, 0x08, 0x02,
+    0x07, 0x01, 0x08, 0x00, 0x0c, 0x04, 0x31, 0x0a, 0x0f, 0x0c, 0x06, 0x0b,
+    0x04, 0x0a, 0x03, 0xa0, 0x0e, 0x01, 0x0a, 0x00, 0x0b, 0x04, 0x1f, 0x0f,
+    0x07, 0x0d, 0x05, 0x09, 0x14, 0x08, 0x07, 0x05, 0x16, 0x08, 0x0a, 0x41,
+    0x04, 0x09, 0x03, 0x03, 0x02, 0x01, 0x11, 0x00, 0x03, 0x03, 0x02, 0x0f,
+    0x0f, 0x23, 0x09, 0x0b, 0x04, 0x07, 0x42, 0x09, 0x52, 0x26, 0x05, 0x01,
+    0x04, 0x00, 0x06, 0xf1, 0x03, 0x07, 0x0f, 0x08, 0x09, 0x26, 0x05, 0x04,
+    0x03, 0x07, 0x02, 0x06, 0x01, 0x17, 0x10, 0x08, 0x05, 0x09, 0x0c, 0x08,
+    0x07, 0x07, 0x06, 0x16, 0x14, 0x05, 0xf1, 0x02, 0x06, 0x01, 0x15, 0x00,
+    0x01, 0x06, 0x0a, 0x07, 0x0d, 0x09, 0x04, 0x18, 0x00, 0x01, 0x17, 0x0c,
+    0x09, 0x26, 0x03, 0x01, 0x00, 0x05, 0x03, 0x07, 0x0f, 0x09, 0xb1, 0x1d,
+    0x06, 0x04, 0x09, 0x83, 0x07, 0x18, 0x06, 0x25, 0x06, 0x07, 0x22, 0x32,
+    0x1b, 0x08, 0x01, 0x01, 0x20, 0x03, 0x10, 0x02, 0x04, 0x02, 0x03, 0x25,
+    0x0f, 0x0e, 0x0b, 0x1a, 0x03, 0x04, 0x01, 0x1b, 0x23, 0x10, 0x0c, 0x21,
+    0x0b, 0xc2, 0x0d, 0x0a, 0x42, 0x09, 0x0a, 0x08, 0x15, 0x03, 0x34, 0x04,
+    0x03, 0x02, 0x01, 0x03, 0x00, 0x04, 0xf1, 0x01, 0x07, 0x02, 0x08, 0x06,
+    0x0d, 0x0f, 0x0f, 0x06, 0x0d, 0x04, 0x09, 0x02, 0x08, 0x01, 0x06, 0x10,
+    0x04, 0x06, 0x06, 0x08, 0x0f, 0x0a, 0x07, 0x09, 0x05, 0x08, 0x04, 0x07,
+    0x03, 0x08, 0x71, 0x02, 0x17, 0x01, 0x10, 0x08, 0x05, 0x03, 0x07, 0x0f,
+    0x0e, 0x0c, 0x08, 0x05, 0x0d, 0xf0, 0x02, 0x09, 0x00, 0x0a, 0x03, 0x0c,
+    0x0f, 0x0f, 0x0a, 0x0d, 0x05, 0x1c, 0x23, 0x19, 0x04, 0x18, 0x07, 0x0b,
+    0x07, 0x0a, 0x05, 0x06, 0x03, 0x03, 0x12, 0x10, 0x00, 0x05, 0x01, 0x1f,
+    0x1a, 0x02, 0x63, 0x04, 0x0b, 0x02, 0x09, 0x31, 0x08, 0x07, 0x05, 0x03,
+    0x00, 0x31, 0x05, 0x02, 0x06, 0x0f, 0x18, 0x0c, 0x06, 0xf0, 0x0c, 0x24,
+    0x0a, 0x09, 0x1a, 0x03, 0x02, 0x0e, 0x01, 0x0d, 0x00, 0x1c, 0x04, 0x0f,
+    0x0f, 0x09, 0x0e, 0x06, 0x0d, 0x14, 0x0e, 0x0b, 0x03, 0x0a, 0x02, 0x08,
+    0x11, 0xc0, 0x06, 0x08, 0x07, 0x0a, 0x0f, 0x09, 0x03, 0x08, 0x02, 0x0b,
+    0x0b, 0x0d, 0x0f, 0x0e, 0x06, 0x0b, 0x03, 0x09, 0x01, 0x0b, 0x00, 0x09,
+    0x02, 0x0e, 0x0f, 0x11, 0x0a, 0x0e, 0x09, 0x07, 0xf0, 0x0e, 0x24, 0x0d,
+    0x0c, 0x1e, 0x43, 0x0c, 0x1a, 0x0b, 0x04, 0x1a, 0x05, 0x06, 0x09, 0x05,
+    0x08, 0x02, 0x06, 0x00, 0x05, 0x01, 0x07, 0x10, 0x00, 0x19, 0x01, 0x1f,
+    0x02, 0x1e, 0x13, 0x04, 0x0b, 0x02, 0x42, 0x0e, 0x31, 0x0d, 0x0c, 0x0a,
+    0x09, 0x02, 0x11, 0x1b, 0x03, 0x05, 0x90, 0x2c, 0x04, 0x13, 0x0a, 0x04,
+    0x09, 0x16, 0x08, 0x17, 0x04, 0x02, 0x05, 0x10, 0x03, 0x01, 0x04, 0x08,
+    0x02, 0x06, 0x0f, 0x03, 0x08, 0x07, 0x02, 0x1a, 0x05, 0x71, 0x03, 0x09,
+    0x02, 0x07, 0x01, 0x16, 0x10, 0x07, 0x04, 0x0a, 0x1d, 0x09, 0x70, 0x0e,
+    0x08, 0x0c, 0x05, 0x0a, 0x04, 0x29, 0x03, 0x02, 0x01, 0x0c, 0x00, 0x0e,
+    0x01, 0x21, 0x0d, 0x0e, 0x0e, 0x08, 0x0b, 0x03, 0xf0, 0x1e, 0x00, 0x02,
+    0x0b, 0x0f, 0x0e, 0x0e, 0x1c, 0x06, 0x04, 0x1a, 0x13, 0x08, 0x04, 0x17,
+    0x06, 0x0a, 0x06, 0x0d, 0x05, 0x0e, 0x04, 0x08, 0x03, 0x04, 0x12, 0x10,
+    0x10, 0x05, 0x0c, 0x02, 0x06, 0x0f, 0x04, 0x08, 0x06, 0x03, 0x19, 0x04,
+    0x02, 0x03, 0x21, 0x0b, 0x02, 0x0a, 0x01, 0x07, 0x10, 0x00, 0x09, 0x21,
+    0x08, 0x07, 0x0a, 0x0f, 0x09, 0x09, 0xf0, 0x0d, 0x04, 0x0e, 0x13, 0x4b,
+    0x14, 0x03, 0x02, 0x07, 0x00, 0x08, 0x03, 0x0a, 0x0f, 0x0f, 0x0a, 0x0d,
+    0x06, 0x0b, 0x05, 0x1a, 0x04, 0x03, 0x0c, 0x02, 0x10, 0x0b, 0x01, 0x09,
+    0x00, 0x51, 0x07, 0x03, 0x16, 0x04, 0x02, 0x07, 0x09, 0x08, 0x0f, 0x09,
+    0x08, 0x40, 0x0e, 0x04, 0x0d, 0x02, 0x1b, 0x01, 0x00, 0x0a, 0x01, 0x21,
+    0x08, 0x1f, 0x19, 0x06, 0xf0, 0x0e, 0x15, 0x0b, 0x0a, 0x04, 0x2c, 0x43,
+    0x0a, 0x0b, 0x0d, 0x04, 0x0b, 0x05, 0x09, 0x04, 0x0a, 0x02, 0x09, 0x00,
+    0x0e, 0x02, 0x0c, 0x04, 0x08, 0x10, 0x10, 0x07, 0x06, 0x09, 0x01, 0x0b,
+    0x0f, 0x03, 0x2e, 0x06, 0x22, 0x03, 0x22, 0x0a, 0x01, 0x0d, 0xd0, 0x0f,
+    0x03, 0x0c, 0x04, 0x0b, 0x25, 0x1a, 0x18, 0x14, 0x07, 0x06, 0x06, 0x0c,
+    0x05, 0x0f, 0x04, 0x08, 0x03, 0x03, 0x02, 0x00, 0x01, 0x01, 0x03, 0x22,
+    0x1f, 0x0f, 0x0b, 0x06, 0x0e, 0xf1, 0x04, 0x0a, 0x03, 0x08, 0x02, 0x07,
+    0x01, 0x18, 0x10, 0x07, 0x03, 0x48, 0x1c, 0x06, 0x03, 0x12, 0x09, 0x18,
+    0x11, 0x07, 0x00, 0x28, 0xf1, 0x01, 0x0a, 0x08, 0x27, 0x11, 0x08, 0x08,
+    0x0a, 0x09, 0x04, 0x0a, 0x03, 0x18, 0x22, 0x17, 0x04, 0x15, 0x05, 0x17,
+    0x14, 0x41, 0x0c, 0x03, 0x08, 0x12, 0x02, 0x10, 0x01, 0x00, 0x03, 0x06,
+    0x02, 0x05, 0x0f, 0x06, 0x06, 0x09, 0x03, 0x08, 0x05, 0x02, 0x09, 0x03,
+    0x01, 0x0b, 0x02, 0x30, 0x0e, 0x10, 0x0b, 0x0a, 0x06, 0x0b, 0x0f, 0x21,
+    0x08, 0x09, 0x17, 0x05, 0x04, 0xf0, 0x09, 0x13, 0x0a, 0x0b, 0x04, 0x0e,
+    0x05, 0x1c, 0x03, 0x01, 0x0e, 0x00, 0x0a, 0x02, 0x09, 0x0f, 0x2a, 0x0e,
+    0x07, 0x06, 0x19, 0x05, 0x04, 0x0a, 0x03, 0x09, 0x01, 0x20, 0x0a, 0x00,
+    0x08, 0x01, 0x09, 0x02, 0x11, 0x07, 0x08, 0x2a, 0x0f, 0x42, 0x05, 0x02,
+    0x0b, 0x01, 0x1a, 0x20, 0x01, 0x0c, 0x10, 0x0f, 0x01, 0x0e, 0x08, 0x11,
+    0x1a, 0x0e, 0x07, 0xb0, 0x0e, 0x06, 0x0b, 0x45, 0x09, 0x07, 0x26, 0x06,
+    0x45, 0x07, 0x08, 0x07, 0x04, 0x01, 0x11, 0x14, 0x04, 0x0e, 0x22, 0x03,
+    0x05, 0x32, 0x10, 0x01, 0x04, 0x05, 0x0f, 0x0c, 0x23, 0x07, 0x0a, 0x04,
+    0x08, 0x02, 0x0c, 0x12, 0x11, 0x0a, 0x0d, 0xd1, 0x62, 0x09, 0x0c, 0x0d,
+    0x0e, 0x0d, 0x1a, 0x03, 0x08, 0x15, 0x06, 0x05, 0x02, 0x04, 0x10, 0x03,
+    0x02, 0x03, 0x04, 0x12, 0x0f, 0x0b, 0x0d, 0x0f, 0x41, 0x05, 0x2c, 0x03,
+    0x22, 0x08, 0x0e, 0xf0, 0x01, 0x1d, 0x00, 0x02, 0x3f, 0x0e, 0x0f, 0x07,
+    0x04, 0x0e, 0x13, 0x0d, 0x0b, 0x12, 0x0e, 0x0a, 0x11, 0x0c, 0x1a, 0x06,
+    0x05, 0x1b, 0x02, 0xf0, 0x09, 0x0d, 0x0f, 0x0f, 0x09, 0x0c, 0x05, 0x0a,
+    0x04, 0x09, 0x13, 0x0a, 0x09, 0x04, 0x08, 0x07, 0x06, 0x09, 0x35, 0x08,
+    0x0b, 0x0e, 0x08, 0x04, 0x03, 0x03, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01,
+    0x03, 0x05, 0x02, 0x1f, 0x0f, 0x03, 0x06, 0x04, 0x07, 0x03, 0x25, 0x03,
+    0x02, 0x01, 0x01, 0x00, 0xf0, 0x08, 0x03, 0x0b, 0x0f, 0x0d, 0x0d, 0x0b,
+    0x08, 0x1a, 0x05, 0x04, 0x39, 0x03, 0x04, 0x06, 0x07, 0x08, 0x04, 0x07,
+    0x03, 0x06, 0x11, 0x07, 0x09, 0x08, 0x0a, 0x0e, 0x80, 0x0b, 0x07, 0x1a,
+    0x06, 0x15, 0x0b, 0x09, 0x04, 0x07, 0x02, 0x05, 0x10, 0x04, 0x06, 0x05,
+    0x02, 0x05, 0x0f, 0x07, 0x14, 0x08, 0x06, 0x03, 0x07, 0x13, 0x11, 0x18,
+    0x22, 0x30, 0x0a, 0x08, 0x0c, 0xf1, 0x3b, 0x04, 0x0d, 0x06, 0x04, 0x09,
+    0x03, 0x08, 0x62, 0x0a, 0x18, 0x09, 0x0b, 0x0e, 0x0a, 0x01, 0x09, 0x00,
+    0x06, 0x01, 0x08, 0x51, 0x0c, 0x07, 0x0f, 0x05, 0x03, 0x04, 0x10, 0x03,
+    0x01, 0x03, 0x03, 0xb2, 0x1f, 0x2f, 0x05, 0x02, 0x0c, 0x41, 0x09, 0x08,
+    0x19, 0x0a, 0x32, 0x17, 0x0c, 0xf1, 0x0b, 0x13, 0x09, 0x0a, 0x02, 0x09,
+    0x10, 0x06, 0x14, 0x02, 0x04, 0x05, 0x0c, 0x18, 0x0f, 0x05, 0x09, 0x03,
+    0x0b, 0x22, 0x0c, 0x0d, 0x08, 0x01, 0x06, 0xf1, 0x00, 0x05, 0x02, 0x06,
+    0x1c, 0x07, 0x18, 0x06, 0x03, 0x29, 0x32, 0x08, 0x17, 0x01, 0x00, 0x06,
+    0x01, 0x17, 0x03, 0x08, 0x08, 0x0f, 0x0c, 0xf1, 0x07, 0x09, 0x05, 0x06,
+    0x14, 0x05, 0x04, 0x05, 0x83, 0x06, 0x07, 0x08, 0x17, 0x0a, 0x0b, 0x06,
+    0x03, 0x02, 0x01, 0x11, 0x00, 0x01, 0x02, 0x04, 0x02, 0x1f, 0x1c, 0x13,
+    0x05, 0x0a, 0x02, 0x01, 0x0c, 0xf1, 0x00, 0x15, 0x02, 0x1a, 0x16, 0x05,
+    0x17, 0x04, 0x03, 0x08, 0x22, 0x19, 0x0e, 0x13, 0x0b, 0x0a, 0x02, 0x08,
+    0x01, 0x0a, 0x10, 0x08, 0x06, 0x81, 0x05, 0x15, 0x0f, 0x0c, 0x24, 0x0a,
+    0x08, 0x0a, 0x03, 0x07, 0x02, 0x03, 0x01, 0x00, 0x00, 0x22, 0x01, 0x02,
+    0x1f, 0x08, 0x0a, 0x03, 0x06, 0x0b, 0x22, 0x02, 0x0d, 0x41, 0x0a, 0x0f,
+    0xf1, 0x0c, 0x0b, 0x18, 0x00, 0x02, 0x0b, 0x0a, 0x2e, 0x06, 0x03, 0x62,
+    0x0d, 0x0a, 0x08, 0x09, 0x0b, 0x0e, 0x0b, 0x01, 0x0a, 0x81, 0x10, 0x07,
+    0x09, 0x06, 0x18, 0x0f, 0x07, 0x06, 0x02, 0x05, 0x10, 0x03, 0x01, 0x01,
+    0x04, 0x02, 0x1f, 0x08, 0x23, 0x0e, 0x05, 0x09, 0x02, 0x05, 0x04, 0x31,
+    0x04, 0x05, 0x03, 0x06, 0x12, 0x18, 0x02, 0x21, 0x09, 0x13, 0x08, 0x09,
+    0x24, 0xf0, 0x0e, 0x0c, 0x0d, 0x03, 0x1e, 0x01, 0x00, 0x0a, 0x03, 0x18,
+    0x05, 0x02, 0x0a, 0x06, 0x0c, 0x0f, 0x0e, 0x07, 0x1d, 0x25, 0x1b, 0x03,
+    0x0d, 0x01, 0xd0, 0x0c, 0x00, 0x0b, 0x02, 0x09, 0x0c, 0x0b, 0x0f, 0x0d,
+    0x09, 0x0b, 0x05, 0x0a, 0x04, 0x09, 0x15, 0x37, 0x04, 0x02, 0x10, 0x05,
+    0x09, 0x07, 0x01, 0x0a, 0x0f, 0x03, 0x28, 0x08, 0x02, 0x05, 0x01, 0x04,
+    0xe0, 0x0e, 0x13, 0x0c, 0x09, 0x04, 0x18, 0x05, 0x06, 0x27, 0x15, 0x07,
+    0x06, 0x0a, 0x05, 0x1e, 0x04, 0x03, 0x06, 0x12, 0x02, 0x00, 0x03, 0x01,
+    0x02, 0x04, 0x1f, 0x07, 0x13, 0x0a, 0x03, 0x1d, 0x02, 0x10, 0xd1, 0x0f,
+    0x04, 0x0d, 0x05, 0x0b, 0x03, 0x0e, 0x32, 0x0f, 0x0e, 0x0d, 0x0b, 0x03,
+    0x07, 0x04, 0x06, 0x15, 0x25, 0x04, 0x03, 0x08, 0xb0, 0x01, 0x19, 0x00,
+    0x03, 0x0a, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x09, 0x0a, 0x07, 0x08, 0x16,
+    0x03, 0x10, 0x05, 0x03, 0x04, 0x04, 0x01, 0x1f, 0x19, 0x12, 0x07, 0x1c,
+    0xf1, 0x03, 0x32, 0x09, 0x08, 0x09, 0x08, 0x01, 0x09, 0x00, 0x17, 0x02,
+    0x0e, 0x38, 0x09, 0x04, 0x03, 0x42, 0x2a, 0x0e, 0xc1, 0x0c, 0x01, 0x0e,
+    0x10, 0x08, 0x06, 0x03, 0x19, 0x0d, 0x0c, 0x06, 0x06, 0x05, 0x03, 0x03,
+    0x01, 0x02, 0x00, 0x01, 0x01, 0x04, 0x1f, 0x09, 0x02, 0x0f, 0x63, 0x04,
+    0x0e, 0x02, 0x09, 0x01, 0x08, 0x10, 0x0b, 0x08, 0x01, 0x05, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x05, 0x24, 0x31, 0x17, 0x16, 0x03, 0x02, 0xf0, 0x08,
+    0x01, 0x17, 0x04, 0x0b, 0x08, 0x04, 0x19, 0x01, 0x03, 0x0b, 0x0b, 0x2e,
+    0x07, 0x16, 0x1d, 0x05, 0x03, 0x0b, 0x01, 0x0e, 0x00, 0x0f, 0x01, 0x0d,
+    0x07, 0x90, 0x0c, 0x0f, 0x0b, 0x0e, 0x08, 0x09, 0x06, 0x18, 0x15, 0x0a,
+    0x14, 0x06, 0x03, 0x43, 0x00, 0x01, 0x02, 0x1f, 0x07, 0x08, 0x04, 0x0d,
+    0x22, 0x02, 0x1b, 0x21, 0x1f, 0x31, 0x02, 0x0c, 0x23, 0x08, 0x0f, 0x80,
+    0x0c, 0x04, 0x0a, 0x06, 0x07, 0x27, 0x16, 0x05, 0x04, 0x04, 0x02, 0x03,
+    0x00, 0x02, 0x11, 0x01, 0x04, 0x1f, 0x06, 0x12, 0x0a, 0x02, 0x0f, 0xe1,
+    0x01, 0x0c, 0x04, 0x0d, 0x05, 0x0e, 0x03, 0x0c, 0x72, 0x0d, 0x0a, 0x0b,
+    0x0e, 0x1f, 0x0e, 0x0c, 0x13, 0x09, 0x08, 0x02, 0x0e, 0xb0, 0x01, 0x0b,
+    0x00, 0x09, 0x02, 0x0a, 0x1d, 0x0c, 0x0b, 0x0a, 0x1a, 0x07, 0x04, 0x09,
+    0x01, 0x07, 0x00, 0x05, 0x01, 0x08, 0x04, 0x06, 0x21, 0x0d, 0x19, 0x0f,
+    0x08, 0x0f, 0x00
+};
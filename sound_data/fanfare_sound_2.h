@@ -0,0 +1,1315 @@
+const uint8_t fanfare_sound_2 [] = {
+    0x04, 0x0f, 0xf0, 0x03, 0x0c, 0x14, 0x09, 0x0c, 0x03, 0x0b, 0x02, 0x19,
+    0x01, 0x02, 0x0b, 0x0e, 0x0d, 0x0f, 0x1b, 0x06, 0x44, 0x0d, 0x1a, 0x0b,
+    0x1c, 0x03, 0x90, 0x01, 0x0d, 0x00, 0x0b, 0x03, 0x0a, 0x1f, 0x0b, 0x0a,
+    0x0a, 0x08, 0x06, 0x07, 0x03, 0x06, 0x01, 0x04, 0x10, 0x02, 0x11, 0x06,
+    0x08, 0x09, 0x02, 0x0f, 0x0c, 0x63, 0x05, 0x0b, 0x02, 0x0c, 0x01, 0x08,
+    0x20, 0x0a, 0x08, 0x19, 0x01, 0x02, 0x02, 0x0f, 0xf1, 0x13, 0x0c, 0x0b,
+    0x02, 0x0a, 0x01, 0x08, 0x00, 0x07, 0x01, 0x1b, 0x06, 0x05, 0x08, 0x02,
+    0x07, 0x00, 0x06, 0x01, 0x07, 0x16, 0x08, 0x09, 0x05, 0x0a, 0x04, 0x0c,
+    0x03, 0x0a, 0xe1, 0x02, 0x18, 0x01, 0x10, 0x07, 0x09, 0x03, 0x0b, 0x07,
+    0x0a, 0x06, 0x09, 0x15, 0x07, 0x05, 0x06, 0x14, 0x05, 0x03, 0x03, 0x01,
+    0x02, 0x00, 0x03, 0x03, 0x04, 0x12, 0x1f, 0x0a, 0x0f, 0x21, 0x05, 0x0b,
+    0x23, 0x09, 0x0e, 0xf0, 0x0c, 0x04, 0x19, 0x15, 0x08, 0x64, 0x19, 0x0b,
+    0x1a, 0x0c, 0x0a, 0x03, 0x07, 0x01, 0x06, 0x10, 0x05, 0x0a, 0x08, 0x0e,
+    0xf0, 0x0f, 0x0f, 0x05, 0x0e, 0x0a, 0x1f, 0x0f, 0x06, 0x0e, 0x04, 0x0a,
+    0x13, 0x0b, 0x0c, 0x04, 0x0a, 0x15, 0x0b, 0x1d, 0x04, 0x03, 0x0e, 0x04,
+    0x2b, 0x05, 0x04, 0xf0, 0x02, 0x0e, 0x01, 0x0d, 0x00, 0x0a, 0x01, 0x1e,
+    0x0a, 0x0f, 0x0c, 0x08, 0x0e, 0x05, 0x0c, 0x02, 0x09, 0x00, 0x0b, 0x01,
+    0x0f, 0x13, 0x0b, 0x0a, 0x08, 0x0d, 0x0f, 0x0e, 0x09, 0x0c, 0xf0, 0x05,
+    0x0b, 0x24, 0x0a, 0x0c, 0x0b, 0x03, 0x09, 0x02, 0x0a, 0x11, 0x0c, 0x1e,
+    0x07, 0x0f, 0x1c, 0x06, 0x05, 0x0a, 0x34, 0x1d, 0x0c, 0x19, 0xb0, 0x02,
+    0x00, 0x0c, 0x02, 0x0a, 0x0a, 0x1c, 0x0c, 0x07, 0x0b, 0x06, 0x09, 0x05,
+    0x08, 0x03, 0x16, 0x01, 0x10, 0x15, 0x01, 0x05, 0x07, 0x22, 0x0f, 0x0f,
+    0x09, 0x0c, 0x04, 0x0f, 0x91, 0x02, 0x0d, 0x21, 0x0e, 0x0c, 0x0e, 0x02,
+    0x0b, 0x03, 0x0a, 0x04, 0x19, 0x03, 0x02, 0x06, 0x00, 0x2e, 0xf0, 0x01,
+    0x09, 0x0f, 0x0c, 0x05, 0x1b, 0x02, 0x00, 0x0c, 0x01, 0x09, 0x08, 0x0a,
+    0x0f, 0x2b, 0x0b, 0x07, 0x05, 0x0a, 0x04, 0x09, 0x02, 0x0a, 0x10, 0x1f,
+    0xb0, 0x04, 0x1e, 0x0d, 0x0b, 0x0d, 0x07, 0x0c, 0x15, 0x0b, 0x08, 0x04,
+    0x16, 0x01, 0x00, 0x08, 0x02, 0x0b, 0x04, 0x0e, 0x0d, 0x08, 0xf1, 0x0f,
+    0x09, 0x06, 0x07, 0x15, 0x05, 0x04, 0x07, 0x03, 0x1e, 0x82, 0x1a, 0x0b,
+    0x1a, 0x0b, 0x0d, 0x08, 0x33, 0x05, 0x21, 0x02, 0x10, 0x02, 0x12, 0x03,
+    0x13, 0x09, 0x23, 0x1f, 0x05, 0x06, 0x05, 0x14, 0x14, 0x02, 0x21, 0x03,
+    0x05, 0x12, 0x07, 0x08, 0x02, 0x21, 0x1e, 0x33, 0x0d, 0xf0, 0x0f, 0x0e,
+    0x14, 0x0c, 0x0e, 0x03, 0x0f, 0x02, 0x0e, 0x01, 0x0f, 0x00, 0x0e, 0x01,
+    0x0a, 0x08, 0x0e, 0x0f, 0x0f, 0x07, 0x0d, 0x03, 0x0b, 0x01, 0x09, 0x02,
+    0x0c, 0x05, 0x0e, 0x02, 0xf0, 0x2f, 0x01, 0x04, 0x0c, 0x0e, 0x09, 0x0c,
+    0x06, 0x1b, 0x15, 0x0a, 0x04, 0x19, 0x13, 0x07, 0x02, 0x08, 0x01, 0x0a,
+    0x05, 0x0b, 0x0f, 0x0c, 0x08, 0x1a, 0x06, 0xf0, 0x15, 0x0b, 0x1a, 0x04,
+    0x02, 0x0b, 0x00, 0x0e, 0x01, 0x0d, 0x07, 0x0e, 0x0c, 0x0c, 0x07, 0x1a,
+    0x05, 0x14, 0x0c, 0x0a, 0x03, 0x18, 0x01, 0x10, 0x06, 0x00, 0x07, 0x04,
+    0x01, 0x08, 0x0f, 0x03, 0x09, 0x0d, 0x02, 0x0a, 0x05, 0xf1, 0x0d, 0x02,
+    0x1e, 0x21, 0x0c, 0x0f, 0x02, 0x2c, 0x13, 0x02, 0x19, 0x10, 0x08, 0x04,
+    0x09, 0x09, 0x1a, 0x05, 0x02, 0x0b, 0x01, 0x08, 0x10, 0x81, 0x06, 0x17,
+    0x05, 0x0d, 0x18, 0x07, 0x04, 0x09, 0x03, 0x0a, 0x02, 0x0b, 0x01, 0x09,
+    0x10, 0xf0, 0x0f, 0x0e, 0x03, 0x1f, 0x0b, 0x0d, 0x0e, 0x08, 0x0d, 0x05,
+    0x1b, 0x03, 0x01, 0x0a, 0x00, 0x0b, 0x02, 0x0e, 0x05, 0x0b, 0x03, 0x0a,
+    0x07, 0x0b, 0x0f, 0x0f, 0x07, 0x0c, 0x35, 0xf0, 0x0a, 0x09, 0x0a, 0x49,
+    0x54, 0x18, 0x05, 0x07, 0x07, 0x06, 0x0a, 0x05, 0x09, 0x04, 0x04, 0x33,
+    0x01, 0x00, 0x00, 0x01, 0x02, 0x0b, 0x05, 0x04, 0x0f, 0x1b, 0x15, 0x04,
+    0x01, 0x07, 0x06, 0x20, 0x05, 0x07, 0x13, 0x18, 0x01, 0x12, 0x09, 0x02,
+    0x08, 0x04, 0x01, 0x09, 0x05, 0xf0, 0x4b, 0x44, 0x0a, 0x03, 0x08, 0x02,
+    0x09, 0x11, 0x08, 0x09, 0x07, 0x0b, 0x0f, 0x0c, 0x05, 0x0a, 0x02, 0x18,
+    0x03, 0x0b, 0x29, 0x07, 0xf0, 0x02, 0x01, 0x08, 0x04, 0x09, 0x1d, 0x4a,
+    0x09, 0x06, 0x24, 0x48, 0x03, 0x02, 0x01, 0x04, 0x09, 0x0f, 0x0b, 0x0b,
+    0xf0, 0x2a, 0x07, 0x06, 0x05, 0x09, 0x03, 0x08, 0x11, 0x07, 0x29, 0x07,
+    0x0f, 0x07, 0x1a, 0x05, 0x34, 0x0b, 0x1a, 0x08, 0x02, 0x17, 0x10, 0x10,
+    0x06, 0x03, 0x01, 0x17, 0x1f, 0x43, 0x16, 0x04, 0x02, 0x15, 0x11, 0x02,
+    0x07, 0x02, 0xf1, 0x09, 0x03, 0x08, 0x04, 0x27, 0x03, 0x01, 0x00, 0x08,
+    0x03, 0x19, 0x08, 0x06, 0x38, 0x04, 0x02, 0x01, 0x10, 0x17, 0x04, 0x08,
+    0x0b, 0x09, 0x05, 0x51, 0x1b, 0x04, 0x03, 0x0c, 0x02, 0x0a, 0x01, 0x08,
+    0x10, 0x07, 0xf0, 0x0d, 0x03, 0x1e, 0x0e, 0x0f, 0x0d, 0x09, 0x1b, 0x04,
+    0x01, 0x1e, 0x00, 0x02, 0x0f, 0x07, 0x0c, 0x05, 0x29, 0x02, 0x04, 0x0f,
+    0x0a, 0x0b, 0x08, 0x28, 0x17, 0xf0, 0x06, 0x07, 0x05, 0x08, 0x84, 0x0a,
+    0x09, 0x08, 0x07, 0x08, 0x0a, 0x0e, 0x1f, 0x03, 0x06, 0x12, 0x01, 0x00,
+    0x01, 0x02, 0x03, 0x02, 0x1f, 0x0e, 0x24, 0x0f, 0x03, 0x0e, 0x01, 0x0d,
+    0x13, 0x20, 0x0a, 0x0d, 0x42, 0x0f, 0x01, 0x0c, 0x92, 0x1a, 0x0f, 0x61,
+    0x0d, 0x0b, 0x0a, 0x1b, 0x08, 0x1c, 0xf0, 0x11, 0x09, 0x04, 0x0c, 0x09,
+    0x0a, 0x13, 0x08, 0x09, 0x0c, 0x0b, 0x0d, 0x0c, 0x04, 0x0b, 0x01, 0x0c,
+    0x00, 0x0e, 0x02, 0x1f, 0x08, 0x0d, 0x0e, 0x0a, 0x0c, 0x06, 0x39, 0xf0,
+    0x24, 0x03, 0x28, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x1a, 0x0e, 0x07, 0x0c,
+    0x05, 0x0d, 0x03, 0x0c, 0x11, 0x0a, 0x18, 0x06, 0x0f, 0x39, 0xa0, 0x08,
+    0x05, 0x04, 0x13, 0x0e, 0x0f, 0x14, 0x0e, 0x0b, 0x02, 0x08, 0x10, 0x07,
+    0x06, 0x02, 0x07, 0xe1, 0x1f, 0x0e, 0x0f, 0x06, 0x0b, 0x03, 0x19, 0x42,
+    0x08, 0x0a, 0x0e, 0x0b, 0x01, 0x1a, 0x00, 0x02, 0x0b, 0x07, 0x09, 0x06,
+    0x08, 0x05, 0x0e, 0xf0, 0x04, 0x0d, 0x03, 0x0a, 0x02, 0x09, 0x11, 0x0a,
+    0x08, 0x04, 0x0c, 0x0e, 0x2e, 0x09, 0x07, 0x05, 0x0d, 0x03, 0x0e, 0x02,
+    0x09, 0x01, 0x08, 0x00, 0x0e, 0x03, 0x1c, 0x1f, 0xf0, 0x0e, 0x08, 0x0a,
+    0x03, 0x08, 0x01, 0x07, 0x02, 0x0b, 0x08, 0x0d, 0x06, 0x4c, 0x03, 0x01,
+    0x02, 0x19, 0x0d, 0x07, 0x1c, 0x06, 0x04, 0x0d, 0x53, 0x0e, 0xc0, 0x1f,
+    0x0d, 0x1b, 0x04, 0x18, 0x05, 0x08, 0x06, 0x0e, 0x05, 0x09, 0x04, 0x03,
+    0x03, 0x10, 0x02, 0x01, 0x01, 0x04, 0x04, 0x02, 0x0f, 0x2f, 0xb3, 0x0e,
+    0x03, 0x01, 0x0c, 0x20, 0x0a, 0x08, 0x0b, 0xb1, 0x08, 0x0a, 0x09, 0x0a,
+    0x08, 0x0a, 0x42, 0x09, 0x0a, 0x0b, 0x09, 0x0c, 0x81, 0x08, 0x00, 0x07,
+    0x01, 0x09, 0x12, 0x0b, 0x08, 0x07, 0x19, 0x0d, 0x06, 0x07, 0x03, 0x0a,
+    0xf0, 0x01, 0x09, 0x00, 0x0b, 0x02, 0x0d, 0x0b, 0x1e, 0x0f, 0x0a, 0x0c,
+    0x05, 0x2a, 0x14, 0x03, 0x1d, 0x12, 0x18, 0x01, 0x02, 0x0a, 0x0b, 0x1d,
+    0x0f, 0xf0, 0x07, 0x0e, 0x04, 0x0d, 0x01, 0x1f, 0x00, 0x03, 0x1e, 0x0b,
+    0x07, 0x0d, 0x05, 0x0a, 0x04, 0x09, 0x13, 0x0c, 0x2d, 0x04, 0x15, 0x09,
+    0x02, 0x18, 0x10, 0x10, 0x07, 0x02, 0x05, 0xd1, 0x0d, 0x09, 0x0f, 0x0f,
+    0x06, 0x0e, 0x03, 0x0c, 0x32, 0x0a, 0x09, 0x0a, 0x19, 0x01, 0x00, 0x0a,
+    0x02, 0x09, 0x19, 0x07, 0x06, 0x05, 0x1d, 0xf0, 0x14, 0x0a, 0x03, 0x0b,
+    0x12, 0x0c, 0x09, 0x01, 0x18, 0x03, 0x0d, 0x0b, 0x0e, 0x2c, 0x08, 0x05,
+    0x03, 0x0d, 0x02, 0x0a, 0x11, 0x08, 0x07, 0x03, 0x0a, 0xf0, 0x1f, 0x0c,
+    0x0b, 0x05, 0x0a, 0x01, 0x0b, 0x02, 0x08, 0x09, 0x29, 0x0d, 0x05, 0x03,
+    0x08, 0x11, 0x0a, 0x1e, 0x07, 0x0f, 0x0d, 0x09, 0x0c, 0x06, 0x1b, 0x34,
+    0xe0, 0x1a, 0x09, 0x23, 0x2b, 0x04, 0x19, 0x05, 0x17, 0x08, 0x07, 0x05,
+    0x05, 0x01, 0x04, 0x00, 0x03, 0x01, 0x06, 0x04, 0x07, 0x01, 0x0e, 0x0a,
+    0x62, 0x0f, 0x0f, 0x05, 0x0b, 0x02, 0x09, 0x11, 0x18, 0x22, 0x06, 0x1d,
+    0xf1, 0x13, 0x0a, 0x0b, 0x62, 0x0e, 0x19, 0x0a, 0x0e, 0x0b, 0x18, 0x01,
+    0x10, 0x05, 0x06, 0x02, 0x07, 0x08, 0x09, 0x0f, 0x0d, 0x11, 0x09, 0x08,
+    0x05, 0x0c, 0xf0, 0x03, 0x08, 0x01, 0x09, 0x00, 0x0a, 0x02, 0x0d, 0x0d,
+    0x0e, 0x0f, 0x0f, 0x08, 0x0d, 0x05, 0x1c, 0x14, 0x09, 0x03, 0x0b, 0x12,
+    0x0c, 0x09, 0x01, 0x0b, 0x02, 0x09, 0x09, 0x0c, 0xf0, 0x0f, 0x0f, 0x07,
+    0x0b, 0x03, 0x09, 0x01, 0x08, 0x03, 0x19, 0x1d, 0x18, 0x06, 0x04, 0x09,
+    0x13, 0x0b, 0x1a, 0x04, 0x16, 0x09, 0x1a, 0x04, 0x02, 0x09, 0x30, 0x10,
+    0x0b, 0x07, 0x01, 0x1b, 0x06, 0xf1, 0x0f, 0x0f, 0x07, 0x0e, 0x04, 0x0a,
+    0x03, 0x08, 0x12, 0x0a, 0x28, 0x01, 0x00, 0x01, 0x0c, 0x16, 0x0d, 0x0c,
+    0x03, 0x0e, 0x42, 0x0d, 0x0b, 0x0a, 0x09, 0xf1, 0x08, 0x01, 0x0a, 0x00,
+    0x17, 0x01, 0x07, 0x18, 0x09, 0x05, 0x09, 0x03, 0x0b, 0x02, 0x2a, 0x01,
+    0x10, 0x17, 0x02, 0x07, 0x09, 0x05, 0x0a, 0x11, 0x0c, 0xf1, 0x08, 0x04,
+    0x1a, 0x06, 0x04, 0x29, 0x02, 0x01, 0x10, 0x0a, 0x0b, 0x04, 0x1c, 0x09,
+    0x05, 0x0b, 0x03, 0x0c, 0x72, 0x0f, 0x0d, 0x09, 0x28, 0xc1, 0x09, 0x0b,
+    0x03, 0x09, 0x04, 0x17, 0x03, 0x01, 0x06, 0x20, 0x04, 0x07, 0x1e, 0x01,
+    0x05, 0x0a, 0x82, 0x0e, 0x1c, 0x05, 0x02, 0x0b, 0x31, 0x0c, 0x1a, 0x09,
+    0x02, 0x07, 0x33, 0x0b, 0xb1, 0x0a, 0x07, 0x06, 0x04, 0x34, 0x05, 0x26,
+    0x33, 0x03, 0x10, 0x05, 0x05, 0x32, 0x0f, 0x0b, 0x08, 0x09, 0x04, 0x08,
+    0x02, 0x0e, 0x51, 0x01, 0x0a, 0x10, 0x08, 0x26, 0x02, 0x0d, 0x0f, 0x0d,
+    0xf0, 0x09, 0x0b, 0x06, 0x0a, 0x04, 0x0b, 0x23, 0x0c, 0x0b, 0x08, 0x02,
+    0x0b, 0x11, 0x3f, 0x06, 0x0c, 0x04, 0x1d, 0x01, 0x02, 0x0e, 0x19, 0x0d,
+    0x0c, 0xd0, 0x05, 0x0d, 0x04, 0x0a, 0x23, 0x0b, 0x0a, 0x0c, 0x04, 0x1d,
+    0x15, 0x0b, 0x04, 0x0a, 0x03, 0x07, 0x01, 0x16, 0x00, 0x01, 0x18, 0x05,
+    0xf1, 0x0f, 0x0f, 0x0b, 0x0d, 0x05, 0x1a, 0x03, 0x02, 0x09, 0x01, 0x08,
+    0x00, 0x07, 0x01, 0x16, 0x09, 0x0f, 0x17, 0x06, 0x03, 0x08, 0x42, 0x19,
+    0x0a, 0x0e, 0xf1, 0x1a, 0x01, 0x10, 0x07, 0x0b, 0x04, 0x1d, 0x06, 0x04,
+    0x1c, 0x03, 0x02, 0x0b, 0x01, 0x0d, 0x10, 0x0e, 0x08, 0x01, 0x09, 0x04,
+    0x0a, 0x03, 0x08, 0x02, 0x07, 0xf1, 0x05, 0x19, 0x08, 0x04, 0x0a, 0x03,
+    0x08, 0x02, 0x07, 0x01, 0x09, 0x10, 0x0c, 0x0b, 0x04, 0x09, 0x0a, 0x1a,
+    0x05, 0x04, 0x09, 0x03, 0x0a, 0x82, 0x0b, 0x38, 0xf1, 0x0b, 0x0e, 0x0f,
+    0x0c, 0x01, 0x08, 0x00, 0x07, 0x11, 0x09, 0x0c, 0x10, 0x09, 0x2f, 0x03,
+    0x0f, 0x09, 0x0d, 0x04, 0x0c, 0xf1, 0x03, 0x0b, 0x22, 0x0c, 0x08, 0x09,
+    0x03, 0x08, 0x04, 0x07, 0x05, 0x15, 0x14, 0x04, 0x06, 0x53, 0x07, 0x19,
+    0x05, 0x02, 0x00, 0x02, 0x11, 0x01, 0x03, 0x1f, 0x05, 0x12, 0x0a, 0x06,
+    0x0f, 0x41, 0x04, 0x0b, 0x02, 0x0c, 0x01, 0x0a, 0x10, 0x0b, 0x0f, 0xf0,
+    0x02, 0x1c, 0x09, 0x0f, 0x1b, 0x0b, 0x06, 0x0c, 0x04, 0x2a, 0x33, 0x09,
+    0x08, 0x02, 0x0a, 0x01, 0x0f, 0x04, 0x0e, 0x08, 0x0c, 0x12, 0x0e, 0x1f,
+    0xf0, 0x08, 0x0c, 0x0d, 0x06, 0x0b, 0x04, 0x0a, 0x23, 0x0b, 0x0a, 0x0b,
+    0x04, 0x0a, 0x35, 0x1b, 0x09, 0x08, 0x04, 0x26, 0x01, 0x10, 0x0f, 0x00,
+    0x03, 0x0a, 0xf1, 0x1f, 0x0f, 0x0d, 0x06, 0x0a, 0x04, 0x07, 0x02, 0x06,
+    0x10, 0x17, 0x04, 0x18, 0x0c, 0x06, 0x0a, 0x03, 0x0b, 0x22, 0x0a, 0x08,
+    0x09, 0x13, 0x08, 0x1a, 0xf1, 0x02, 0x01, 0x29, 0x10, 0x03, 0x2c, 0x06,
+    0x14, 0x48, 0x03, 0x02, 0x01, 0x10, 0x0c, 0x12, 0x08, 0x29, 0x06, 0x21,
+    0x0e, 0x06, 0x08, 0x04, 0x0e, 0xf0, 0x13, 0x0c, 0x09, 0x22, 0x0b, 0x0a,
+    0x08, 0x05, 0x09, 0x0d, 0x2c, 0x08, 0x06, 0x05, 0x0a, 0x04, 0x09, 0x33,
+    0x1b, 0x0c, 0x0e, 0x14, 0x0b, 0xf0, 0x0c, 0x03, 0x0f, 0x02, 0x0e, 0x01,
+    0x0c, 0x03, 0x0a, 0x06, 0x0b, 0x03, 0x09, 0x11, 0x08, 0x0b, 0x04, 0x0c,
+    0x1f, 0x1f, 0x08, 0x0c, 0x05, 0x0d, 0x13, 0x0e, 0x0b, 0xf0, 0x34, 0x09,
+    0x2c, 0x23, 0x0f, 0x0e, 0x0f, 0x04, 0x0c, 0x05, 0x0a, 0x04, 0x0b, 0x02,
+    0x0d, 0x10, 0x2f, 0x02, 0x09, 0x0c, 0x0f, 0x0d, 0xf0, 0x08, 0x0c, 0x05,
+    0x0d, 0x04, 0x1a, 0x03, 0x02, 0x0c, 0x01, 0x0f, 0x02, 0x0b, 0x05, 0x0e,
+    0x09, 0x0c, 0x07, 0x0d, 0x05, 0x0c, 0x04, 0x09, 0x43, 0x0c, 0x0b, 0x0c,
+    0x0b, 0xf0, 0x1a, 0x02, 0x03, 0x09, 0x14, 0x0a, 0x09, 0x08, 0x2a, 0x0b,
+    0x06, 0x04, 0x0b, 0x23, 0x0e, 0x1c, 0x54, 0x09, 0x0b, 0x0c, 0x0b, 0xf0,
+    0x0d, 0x0c, 0x03, 0x0b, 0x02, 0x18, 0x01, 0x02, 0x07, 0x04, 0x0a, 0x0e,
+    0x3b, 0x0f, 0x07, 0x04, 0x12, 0x0a, 0x17, 0x05, 0x09, 0x18, 0x08, 0xf0,
+    0x06, 0x09, 0x04, 0x0c, 0x23, 0x1e, 0x0f, 0x14, 0x1c, 0x23, 0x0e, 0x0a,
+    0x08, 0x02, 0x0a, 0x04, 0x09, 0x08, 0x18, 0x17, 0x37, 0x06, 0xf0, 0x05,
+    0x04, 0x13, 0x06, 0x05, 0x04, 0x06, 0x09, 0x07, 0x0f, 0x08, 0x09, 0x09,
+    0x05, 0x0a, 0x04, 0x09, 0x53, 0x0d, 0x0c, 0x1b, 0x09, 0x0c, 0xf0, 0x16,
+    0x0b, 0x0c, 0x05, 0x0b, 0x14, 0x0c, 0x09, 0x13, 0x0d, 0x0e, 0x34, 0x09,
+    0x0a, 0x0b, 0x0a, 0x03, 0x0b, 0x02, 0x1c, 0x03, 0x15, 0x0e, 0x0b, 0xf0,
+    0x03, 0x19, 0x12, 0x0a, 0x03, 0x0e, 0x07, 0x1b, 0x09, 0x07, 0x39, 0x05,
+    0xa4, 0x2a, 0x0b, 0x0a, 0x09, 0xf0, 0x0a, 0x1b, 0x03, 0x0e, 0x12, 0x0d,
+    0x0c, 0x13, 0x2e, 0x04, 0x06, 0x1c, 0x05, 0x24, 0x0e, 0x0b, 0x09, 0x03,
+    0x0c, 0x12, 0x0e, 0xf0, 0x0f, 0x04, 0x0e, 0x06, 0x1b, 0x05, 0x64, 0x0c,
+    0x29, 0x0a, 0x09, 0x08, 0x03, 0x09, 0x02, 0x0d, 0x03, 0x2e, 0x05, 0x06,
+    0xf0, 0x05, 0x0c, 0xa4, 0x0b, 0x39, 0x2a, 0x0b, 0x0c, 0x0b, 0x03, 0x0e,
+    0x12, 0x0f, 0x0b, 0x03, 0x08, 0xf0, 0x04, 0x09, 0x06, 0x2b, 0x07, 0x05,
+    0x04, 0x48, 0x03, 0x04, 0x16, 0x05, 0x09, 0x74, 0x0c, 0x0a, 0x19, 0x1b,
+    0xf0, 0x1a, 0x13, 0x0e, 0x0b, 0x02, 0x0f, 0x03, 0x0d, 0x15, 0x1a, 0x24,
+    0x0e, 0x0c, 0x0a, 0x03, 0x0c, 0x12, 0x0d, 0x1a, 0x04, 0x16, 0x0c, 0xf0,
+    0x0b, 0x05, 0x1a, 0x54, 0x49, 0x13, 0x0c, 0x0d, 0xa4, 0x0e, 0x0f, 0x0d,
+    0x0b, 0x29, 0xf0, 0x2a, 0x09, 0x13, 0x0a, 0x0d, 0x04, 0x0e, 0x05, 0x0a,
+    0x04, 0x1b, 0x23, 0x08, 0x19, 0x04, 0x05, 0x1b, 0x06, 0xf0, 0x05, 0x0a,
+    0xb4, 0x0b, 0x0a, 0x29, 0x5a, 0x09, 0x13, 0x1b, 0x14, 0x0a, 0xf0, 0x0b,
+    0x13, 0x2e, 0x54, 0x0d, 0x1b, 0x0a, 0x09, 0x13, 0x0b, 0x0c, 0x04, 0x0b,
+    0x05, 0x0a, 0x14, 0x0d, 0x0b, 0x73, 0x4f, 0xf0, 0x0e, 0x0a, 0x09, 0x04,
+    0x0c, 0x15, 0x0d, 0x0a, 0xc4, 0x0d, 0x0a, 0x29, 0x6a, 0xf0, 0x09, 0x23,
+    0x0c, 0x0a, 0x0b, 0x04, 0x19, 0x15, 0x0a, 0x04, 0x0b, 0x13, 0x0c, 0x0d,
+    0xf0, 0xc4, 0x0b, 0x2c, 0x0b, 0x1a, 0x1b, 0x3a, 0x23, 0x0e, 0x0b, 0x0e,
+    0xf0, 0x24, 0x1b, 0x0a, 0x33, 0x0d, 0x2b, 0x04, 0x09, 0x25, 0x0b, 0x0d,
+    0x0a, 0x84, 0x0c, 0x2a, 0x1b, 0xf0, 0x0a, 0x09, 0x0b, 0x15, 0x0a, 0x09,
+    0x03, 0x0b, 0x12, 0x0c, 0x0d, 0x04, 0x1a, 0x15, 0x08, 0x34, 0x09, 0x18,
+    0x09, 0xf0, 0x25, 0x0a, 0x0b, 0x0a, 0x64, 0x0c, 0x19, 0x0b, 0x0d, 0x0c,
+    0x0a, 0x02, 0x0c, 0x01, 0x0a, 0x02, 0x0e, 0x17, 0x0c, 0x0d, 0x05, 0x1c,
+    0xf0, 0x84, 0x0b, 0x0a, 0x0b, 0x0d, 0x1e, 0x0b, 0x0a, 0x43, 0x0e, 0x0c,
+    0x0a, 0x09, 0x0a, 0x12, 0x0d, 0x09, 0xf0, 0x03, 0x0c, 0x16, 0x0d, 0x0c,
+    0x05, 0x1a, 0x44, 0x0b, 0x0e, 0x0d, 0x0e, 0x35, 0x0a, 0x19, 0x08, 0x44,
+    0x19, 0x08, 0xf0, 0x09, 0x0b, 0x03, 0x1c, 0x12, 0x0f, 0x04, 0x1e, 0x05,
+    0x04, 0x0d, 0x03, 0x1a, 0x02, 0x03, 0x09, 0x04, 0x0c, 0x06, 0x5a, 0x07,
+    0x06, 0x05, 0xf0, 0x04, 0x13, 0x29, 0x04, 0x15, 0x0b, 0x04, 0x0c, 0x03,
+    0x19, 0x12, 0x08, 0x04, 0x09, 0x09, 0x2a, 0x0a, 0x07, 0x05, 0x0b, 0x14,
+    0x1d, 0xf0, 0x25, 0x1a, 0x08, 0x04, 0x07, 0x02, 0x08, 0x11, 0x07, 0x0b,
+    0x03, 0x0e, 0x07, 0x1c, 0x0a, 0x06, 0x2e, 0x03, 0x01, 0x00, 0x0c, 0x03,
+    0x0b, 0xf0, 0x0c, 0x0c, 0x09, 0x0b, 0x07, 0x0a, 0x05, 0x1b, 0x54, 0x0a,
+    0x0c, 0x0e, 0x0f, 0x0e, 0x23, 0x0f, 0x1c, 0x04, 0x0d, 0x16, 0x0a, 0x09,
+    0xf0, 0x04, 0x07, 0x02, 0x06, 0x00, 0x05, 0x01, 0x06, 0x0a, 0x08, 0x0f,
+    0x1a, 0x08, 0x05, 0x39, 0x04, 0x05, 0x06, 0x25, 0x0b, 0x29, 0x04, 0x13,
+    0x0a, 0xf0, 0x29, 0x04, 0x07, 0x08, 0x1a, 0x05, 0x03, 0x1b, 0x01, 0x00,
+    0x2f, 0x04, 0x0c, 0x08, 0x0d, 0x06, 0x0c, 0x05, 0x19, 0x04, 0x03, 0x0a,
+    0x12, 0x0c, 0xf0, 0x0a, 0x03, 0x08, 0x04, 0x0a, 0x05, 0x09, 0x04, 0x0a,
+    0x03, 0x08, 0x02, 0x0b, 0x04, 0x0c, 0x07, 0x0d, 0x05, 0x0b, 0x03, 0x0a,
+    0x00, 0x1e, 0x01, 0x1c, 0x1d, 0x06, 0x0e, 0xf0, 0x05, 0x0d, 0x34, 0x0e,
+    0x0b, 0x0a, 0x0b, 0x05, 0x39, 0x06, 0x05, 0x04, 0x13, 0x0a, 0x2c, 0x04,
+    0x15, 0x0a, 0x03, 0x0c, 0x01, 0x09, 0xf0, 0x00, 0x06, 0x01, 0x0c, 0x06,
+    0x0b, 0x07, 0x0a, 0x08, 0x0b, 0x06, 0x0a, 0x34, 0x0b, 0x1a, 0x0c, 0x15,
+    0x0b, 0x0c, 0x14, 0x0e, 0x0a, 0x03, 0x0c, 0x04, 0x0b, 0xf0, 0x15, 0x0c,
+    0x0d, 0x04, 0x0b, 0x02, 0x1f, 0x00, 0x01, 0x0d, 0x1b, 0x0e, 0x0c, 0x05,
+    0x0d, 0x54, 0x0c, 0x0a, 0x1b, 0x1e, 0x03, 0x0d, 0xa0, 0x01, 0x0b, 0x00,
+    0x0c, 0x01, 0x0f, 0x06, 0x0b, 0x0a, 0x0c, 0x07, 0x0b, 0x05, 0x1a, 0x03,
+    0x01, 0x08, 0x00, 0x0a, 0x05, 0x07, 0x11, 0x0f, 0x09, 0x08, 0x0f, 0xf0,
+    0x07, 0x0c, 0x05, 0x0a, 0x04, 0x0b, 0x13, 0x1c, 0x04, 0x0b, 0x15, 0x0c,
+    0x1b, 0x04, 0x03, 0x0a, 0x02, 0x0e, 0x03, 0x0c, 0x05, 0x0a, 0x06, 0x19,
+    0x05, 0x03, 0x08, 0xf0, 0x00, 0x09, 0x01, 0x0e, 0x05, 0x1b, 0x02, 0x03,
+    0x1d, 0x17, 0x0b, 0x15, 0x1a, 0x14, 0x0e, 0x0c, 0x05, 0x0a, 0x34, 0x1d,
+    0x0c, 0x0e, 0xf0, 0x05, 0x0c, 0x04, 0x0e, 0x13, 0x0c, 0x08, 0x11, 0x19,
+    0x09, 0x0b, 0x0f, 0x1c, 0x05, 0x04, 0x0b, 0x03, 0x0d, 0x14, 0x09, 0x1a,
+    0x25, 0x1e, 0xf0, 0x03, 0x0d, 0x01, 0x09, 0x00, 0x07, 0x01, 0x0c, 0x07,
+    0x2e, 0x0e, 0x06, 0x04, 0x0a, 0x02, 0x19, 0x00, 0x03, 0x0c, 0x0f, 0x0f,
+    0x09, 0x0e, 0x07, 0x0d, 0x06, 0x0a, 0x05, 0x19, 0xf0, 0x04, 0x13, 0x0c,
+    0x2d, 0x04, 0x15, 0x0a, 0x04, 0x0c, 0x53, 0x1b, 0x1d, 0x4b, 0x01, 0x02,
+    0x0e, 0xf0, 0x05, 0x08, 0x01, 0x17, 0x02, 0x08, 0x08, 0x0f, 0x09, 0x08,
+    0x1b, 0x06, 0x05, 0x09, 0x34, 0x0a, 0x08, 0x09, 0x1a, 0x15, 0x0d, 0x04,
+    0x0f, 0x02, 0x08, 0x21, 0x01, 0x09, 0x10, 0x08, 0x05, 0x02, 0x07, 0x04,
+    0x03, 0x0f, 0x03, 0x04, 0x05, 0x02, 0x05, 0x33, 0x01, 0x07, 0xf0, 0x1a,
+    0x2b, 0x04, 0x05, 0x06, 0x0d, 0x05, 0x0e, 0x03, 0x0c, 0x01, 0x09, 0x00,
+    0x06, 0x02, 0x57, 0x0d, 0x0f, 0x09, 0x04, 0x01, 0x04, 0xf0, 0x09, 0x0f,
+    0x0c, 0x07, 0x1a, 0x16, 0x09, 0x07, 0x18, 0x06, 0x04, 0x09, 0x03, 0x0b,
+    0x04, 0x09, 0x15, 0x0b, 0x0c, 0x04, 0x1e, 0x33, 0x1d, 0x10, 0x1c, 0x02,
+    0x01, 0x31, 0x08, 0x00, 0x17, 0x02, 0x0f, 0x0a, 0x0a, 0xf0, 0x0c, 0x02,
+    0x18, 0x00, 0x02, 0x07, 0x0b, 0x08, 0x0f, 0x19, 0x0c, 0x06, 0x0b, 0x05,
+    0x0a, 0x04, 0x09, 0x13, 0x0a, 0x09, 0x04, 0x3a, 0x06, 0x07, 0x04, 0x02,
+    0x20, 0x0b, 0x10, 0x0e, 0x0f, 0x06, 0xa1, 0x1b, 0x0e, 0x05, 0x19, 0x03,
+    0x42, 0x18, 0x09, 0x0a, 0x0b, 0x03, 0x0a, 0x04, 0x08, 0x05, 0x80, 0x0a,
+    0x03, 0x08, 0x01, 0x07, 0x00, 0x08, 0x03, 0x07, 0x0b, 0x28, 0x0a, 0x04,
+    0x01, 0x09, 0x04, 0x11, 0x08, 0x0d, 0x09, 0x06, 0xf0, 0x1b, 0x14, 0x09,
+    0x05, 0x0a, 0x17, 0x09, 0x28, 0x05, 0x14, 0x0a, 0x15, 0x29, 0x24, 0x1a,
+    0x03, 0x1b, 0x02, 0x01, 0x10, 0x0d, 0x00, 0x0b, 0x02, 0x01, 0x08, 0x0f,
+    0x02, 0x07, 0x0a, 0x01, 0x08, 0x03, 0xf0, 0x0d, 0x10, 0x0b, 0x09, 0x03,
+    0x0b, 0x0a, 0x1e, 0x0f, 0x09, 0x0c, 0x06, 0x0b, 0x05, 0x09, 0x04, 0x08,
+    0x13, 0x07, 0x18, 0x05, 0x07, 0x09, 0x05, 0x1a, 0x03, 0x10, 0x41, 0x07,
+    0x38, 0x08, 0x0f, 0x06, 0x05, 0xf0, 0x0c, 0x23, 0x0b, 0x0a, 0x0c, 0x24,
+    0x19, 0x2c, 0x15, 0x03, 0x0a, 0x01, 0x1b, 0x00, 0x01, 0x0a, 0x04, 0x09,
+    0x06, 0x0b, 0x03, 0x0e, 0x01, 0x21, 0x08, 0x07, 0x19, 0x0f, 0x07, 0xf0,
+    0x0b, 0x04, 0x0a, 0x03, 0x29, 0x04, 0x06, 0x07, 0x0a, 0x05, 0x1b, 0x64,
+    0x09, 0x0b, 0x0a, 0x09, 0x0a, 0x0b, 0x03, 0x0d, 0x02, 0x1b, 0x01, 0x20,
+    0x00, 0x09, 0x03, 0x0f, 0x0f, 0x21, 0x0e, 0x07, 0x0b, 0x03, 0x09, 0x01,
+    0xf0, 0x0b, 0x00, 0x09, 0x01, 0x0c, 0x06, 0x0b, 0x0f, 0x0d, 0x0d, 0x0e,
+    0x06, 0x1f, 0x04, 0x03, 0x3e, 0x12, 0x03, 0x05, 0x0c, 0x04, 0x0d, 0x02,
+    0x5f, 0x00, 0x01, 0xe0, 0x0e, 0x0d, 0x06, 0x04, 0x1e, 0x43, 0x0d, 0x0c,
+    0x0d, 0x0e, 0x04, 0x0b, 0x05, 0x3a, 0x06, 0x04, 0x02, 0x10, 0x71, 0x07,
+    0x06, 0x01, 0x07, 0x03, 0x19, 0x02, 0x01, 0x1b, 0x09, 0x0f, 0x09, 0x07,
+    0xf0, 0x0c, 0x04, 0x0d, 0x13, 0x0a, 0x1c, 0x04, 0x16, 0x0a, 0x19, 0x05,
+    0x54, 0x1a, 0x09, 0x08, 0x09, 0x0b, 0x03, 0x0c, 0x02, 0x0b, 0x01, 0x10,
+    0x08, 0x00, 0x09, 0x03, 0x21, 0x0b, 0x0f, 0x0f, 0x08, 0x0b, 0x06, 0xf0,
+    0x0d, 0x02, 0x0a, 0x10, 0x19, 0x03, 0x0a, 0x0d, 0x0d, 0x0f, 0x0f, 0x09,
+    0x0d, 0x06, 0x0c, 0x04, 0x0b, 0x13, 0x09, 0x18, 0x14, 0x0b, 0x03, 0x0f,
+    0x02, 0x0e, 0x00, 0xf0, 0x0c, 0x02, 0x0e, 0x0f, 0x0f, 0x0c, 0x0e, 0x07,
+    0x0c, 0x05, 0x0a, 0x54, 0x09, 0x38, 0x0a, 0x05, 0x09, 0x06, 0x1a, 0x05,
+    0x03, 0x0b, 0x01, 0x40, 0x0e, 0x10, 0x1b, 0x22, 0x0d, 0x0f, 0x91, 0x0e,
+    0x0f, 0x0f, 0x0d, 0x0e, 0x04, 0x2d, 0x02, 0x11, 0x0e, 0x02, 0x1b, 0x13,
+    0x0a, 0x64, 0xa0, 0x0e, 0x1b, 0x0a, 0x19, 0x2a, 0x03, 0x02, 0x01, 0x07,
+    0x00, 0x0b, 0x04, 0x31, 0x1a, 0x0f, 0x0a, 0x08, 0x06, 0x07, 0x03, 0x30,
+    0x0a, 0x01, 0x08, 0x00, 0x07, 0x01, 0x0b, 0x05, 0x41, 0x08, 0x0e, 0x39,
+    0x08, 0x05, 0x53, 0x60, 0x0c, 0x09, 0x0a, 0x0b, 0x1a, 0x02, 0x00, 0x0f,
+    0x02, 0x21, 0x0b, 0x0e, 0x0a, 0x07, 0x09, 0x06, 0xe0, 0x0e, 0x04, 0x1d,
+    0x23, 0x0c, 0x0e, 0x34, 0x29, 0x1a, 0x05, 0x06, 0x18, 0x05, 0x04, 0x06,
+    0x02, 0x05, 0x10, 0x06, 0x02, 0x24, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x18,
+    0x03, 0x0b, 0x02, 0x04, 0x1d, 0xf1, 0x02, 0x11, 0x1c, 0x02, 0x09, 0x23,
+    0x0a, 0x0c, 0x0a, 0x52, 0x1d, 0x1b, 0x1c, 0x11, 0x0e, 0x08, 0x10, 0x07,
+    0xf1, 0x06, 0x05, 0x07, 0x0f, 0x28, 0x08, 0x06, 0x03, 0x17, 0x01, 0x10,
+    0x15, 0x03, 0x06, 0x0d, 0x08, 0x09, 0x09, 0x05, 0x0a, 0x03, 0x0b, 0x32,
+    0x0a, 0x28, 0x71, 0x11, 0x0b, 0x18, 0x00, 0x02, 0x0a, 0x0f, 0x08, 0x0a,
+    0x0e, 0xf0, 0x06, 0x0d, 0x04, 0x1e, 0x23, 0x0d, 0x0e, 0x34, 0x0a, 0x19,
+    0x38, 0x05, 0x16, 0x04, 0x19, 0x02, 0x10, 0x17, 0x10, 0x01, 0x1b, 0x03,
+    0x01, 0x0f, 0x0a, 0x12, 0x0e, 0x08, 0x05, 0x0b, 0x21, 0x03, 0x0a, 0x12,
+    0x08, 0x0f, 0xf0, 0x03, 0x0b, 0x04, 0x2c, 0x15, 0x54, 0x0b, 0x3a, 0x1c,
+    0x03, 0x02, 0x0b, 0x01, 0x09, 0x00, 0x0e, 0x04, 0x1f, 0x0f, 0xf0, 0x08,
+    0x0e, 0x07, 0x0c, 0x05, 0x1a, 0x03, 0x01, 0x0b, 0x00, 0x0d, 0x02, 0x09,
+    0x08, 0x0c, 0x0e, 0x0d, 0x08, 0x0c, 0x06, 0x0b, 0x04, 0x0c, 0x23, 0x0e,
+    0x1c, 0x12, 0x0f, 0xf0, 0x0c, 0x01, 0x0b, 0x03, 0x0c, 0x0e, 0x0e, 0x09,
+    0x0c, 0x06, 0x0b, 0x05, 0x19, 0x04, 0x33, 0x1d, 0x1e, 0x54, 0x09, 0x0a,
+    0x0b, 0x0d, 0x50, 0x0e, 0x0b, 0x03, 0x0a, 0x01, 0x09, 0x00, 0x0a, 0x01,
+    0x05, 0x31, 0x03, 0x07, 0x1f, 0x18, 0x06, 0x1f, 0xf0, 0x04, 0x23, 0x0d,
+    0x0b, 0x0c, 0x14, 0x0a, 0x0d, 0x05, 0x0a, 0x54, 0x0c, 0x3a, 0x0b, 0x13,
+    0x0e, 0x19, 0x02, 0xf0, 0x01, 0x0a, 0x04, 0x3b, 0x0b, 0x07, 0x06, 0x04,
+    0x0e, 0x03, 0x0d, 0x02, 0x1c, 0x11, 0x1f, 0x04, 0x08, 0x0e, 0x07, 0x0c,
+    0x05, 0x0e, 0x04, 0x0c, 0x43, 0x0f, 0xf0, 0x0e, 0x0d, 0x0a, 0x19, 0x02,
+    0x03, 0x0a, 0x08, 0x1c, 0x07, 0x05, 0x0d, 0xb4, 0x0e, 0x0a, 0x59, 0xf0,
+    0x0a, 0x0b, 0x0c, 0x0b, 0x03, 0x0e, 0x02, 0x0a, 0x11, 0x09, 0x0a, 0x03,
+    0x0b, 0x0d, 0x0c, 0x0f, 0x1b, 0x07, 0x05, 0x0a, 0x04, 0x09, 0x13, 0x1c,
+    0xf0, 0x74, 0x0a, 0x0b, 0x0c, 0x0b, 0x2a, 0x0b, 0x15, 0x08, 0x27, 0x04,
+    0x03, 0x02, 0x08, 0x04, 0x09, 0x08, 0x1a, 0xf0, 0x16, 0x19, 0x05, 0x04,
+    0x1a, 0x03, 0x12, 0x0b, 0x19, 0x04, 0x07, 0x0a, 0x06, 0x2c, 0x05, 0x34,
+    0x0a, 0x19, 0x13, 0x0b, 0xf0, 0x0a, 0x02, 0x0c, 0x03, 0x0a, 0x16, 0x0c,
+    0x0b, 0x15, 0x0a, 0x09, 0xb4, 0x1a, 0x39, 0x1a, 0x0b, 0xf0, 0x0c, 0x0b,
+    0x19, 0x03, 0x12, 0x08, 0x07, 0x03, 0x39, 0x09, 0x0d, 0x07, 0x05, 0x1a,
+    0x04, 0x13, 0x1e, 0x94, 0x09, 0x0a, 0xf0, 0x0c, 0x0b, 0x3a, 0x0b, 0x0a,
+    0x13, 0x0c, 0x09, 0x02, 0x0b, 0x03, 0x0d, 0x06, 0x1b, 0x25, 0x0a, 0x09,
+    0xf0, 0x04, 0x0b, 0x03, 0x0d, 0x12, 0x0f, 0x0d, 0x03, 0x1b, 0x25, 0x0d,
+    0x0a, 0x34, 0x0c, 0x0a, 0x19, 0x33, 0x0d, 0x0b, 0x09, 0x0b, 0xf0, 0x15,
+    0x1d, 0xd4, 0x0e, 0x0c, 0x1a, 0x09, 0x0a, 0x19, 0x2a, 0x2b, 0xf0, 0x03,
+    0x0c, 0x12, 0x0d, 0x19, 0x03, 0x06, 0x0a, 0x07, 0x0c, 0x05, 0x0d, 0xd4,
+    0x0e, 0x0a, 0x29, 0x0a, 0x1b, 0x3a, 0xf0, 0x0b, 0x0a, 0x13, 0x0d, 0x0b,
+    0x02, 0x0f, 0x03, 0x0d, 0x15, 0x0b, 0x0a, 0x34, 0x0d, 0x0c, 0x0b, 0x09,
+    0x23, 0x0b, 0xf0, 0x09, 0x0b, 0x64, 0x0e, 0x0f, 0x0e, 0x0c, 0x1a, 0x09,
+    0x33, 0x0e, 0x0c, 0x0a, 0x0b, 0x15, 0x0a, 0x0b, 0x34, 0x0d, 0xf0, 0x0b,
+    0x1a, 0x45, 0x47, 0x54, 0x2a, 0x1b, 0x09, 0x03, 0x0a, 0x12, 0x0d, 0xf0,
+    0x3f, 0x04, 0x05, 0xf4, 0x0d, 0x0a, 0x19, 0x1a, 0x1b, 0x5a, 0xf0, 0x09,
+    0x04, 0x08, 0x13, 0x0a, 0x0d, 0x54, 0x1e, 0x0c, 0x1a, 0x09, 0x23, 0x0c,
+    0x0a, 0x1b, 0x04, 0xf0, 0x15, 0x1a, 0x44, 0x0c, 0x3a, 0x23, 0x0e, 0x1c,
+    0x64, 0x0d, 0x0e, 0x1b, 0x0a, 0x09, 0xf0, 0x08, 0x13, 0x0a, 0x0b, 0x74,
+    0x09, 0x0c, 0x0e, 0x0d, 0x1b, 0x0c, 0x0a, 0x23, 0x0c, 0x0a, 0x0b, 0x05,
+    0x1a, 0x26, 0xf0, 0x09, 0x08, 0x05, 0x29, 0x04, 0x03, 0x02, 0x0a, 0x03,
+    0x38, 0x05, 0x06, 0x05, 0x84, 0x19, 0x0a, 0x0c, 0x0d, 0x1b, 0xf0, 0x19,
+    0x05, 0x0b, 0x06, 0x09, 0x05, 0x2a, 0x04, 0x03, 0x02, 0x28, 0x01, 0x03,
+    0x08, 0x19, 0x09, 0x06, 0x1a, 0x05, 0x64, 0x0c, 0xf0, 0x0a, 0x0b, 0x0c,
+    0x1e, 0x0b, 0x13, 0x0d, 0x0e, 0x24, 0x09, 0x08, 0x07, 0x03, 0x09, 0x12,
+    0x0a, 0x08, 0x04, 0x19, 0x08, 0xf0, 0x07, 0x0a, 0x05, 0x4b, 0x64, 0x1e,
+    0x0b, 0x13, 0x0e, 0x0c, 0x04, 0x2a, 0x15, 0x04, 0x0c, 0x03, 0x1e, 0xf0,
+    0x12, 0x19, 0x03, 0x05, 0x0b, 0x06, 0x0a, 0x05, 0x19, 0x03, 0x02, 0x0b,
+    0x03, 0x0a, 0x05, 0x09, 0x16, 0x0b, 0x0c, 0x05, 0x0d, 0x04, 0x0e, 0x23,
+    0x0d, 0x0a, 0xf0, 0x0e, 0x04, 0x0d, 0x15, 0x0b, 0x1a, 0x04, 0x02, 0x0e,
+    0x11, 0x0f, 0x1e, 0x03, 0x08, 0x2d, 0x09, 0x06, 0x05, 0x0b, 0x14, 0x1d,
+    0x15, 0x0a, 0xf0, 0x09, 0x04, 0x0a, 0x03, 0x08, 0x02, 0x06, 0x01, 0x08,
+    0x02, 0x09, 0x05, 0x1a, 0x0a, 0x0c, 0x09, 0x06, 0x2a, 0x03, 0x01, 0x00,
+    0x2e, 0x04, 0x0e, 0x08, 0x0c, 0xf0, 0x06, 0x0b, 0x94, 0x0d, 0x1a, 0x2c,
+    0x3a, 0x05, 0x1b, 0x06, 0x05, 0x0a, 0x03, 0x08, 0x01, 0x07, 0xf0, 0x00,
+    0x05, 0x01, 0x09, 0x0b, 0x0a, 0x0f, 0x29, 0x08, 0x05, 0x04, 0x1a, 0x15,
+    0x0b, 0x24, 0x0e, 0x0c, 0x0b, 0x23, 0x0e, 0x0c, 0x1b, 0x04, 0xf0, 0x16,
+    0x0d, 0x0c, 0x04, 0x0b, 0x03, 0x28, 0x11, 0x07, 0x0b, 0x0f, 0x0d, 0x08,
+    0x2c, 0x06, 0x04, 0x03, 0x0e, 0x32, 0x0f, 0x0c, 0x0b, 0x0f, 0xf0, 0x03,
+    0x0e, 0x14, 0x0d, 0x0b, 0x13, 0x18, 0x05, 0x0a, 0x07, 0x0b, 0x04, 0x0e,
+    0x02, 0x0d, 0x00, 0x1b, 0x02, 0x0f, 0x0e, 0x0b, 0x0d, 0x06, 0x0e, 0x05,
+    0x1c, 0x74, 0xf0, 0x2a, 0x0c, 0x0e, 0x0d, 0x0b, 0x13, 0x0c, 0x0e, 0x04,
+    0x0c, 0x05, 0x0b, 0x04, 0x0c, 0x03, 0x09, 0x01, 0x07, 0x00, 0x06, 0x02,
+    0x0a, 0xf0, 0x16, 0x0d, 0x0e, 0x07, 0x0d, 0x05, 0x1b, 0x34, 0x1a, 0x0b,
+    0x25, 0x0a, 0x0b, 0x1a, 0x14, 0x49, 0x05, 0x16, 0xf0, 0x04, 0x02, 0x2b,
+    0x00, 0x02, 0x0f, 0x0e, 0x09, 0x0d, 0x05, 0x0c, 0x54, 0x0b, 0x09, 0x0b,
+    0x0c, 0x1d, 0x03, 0x0a, 0x01, 0x09, 0x00, 0x0e, 0x80, 0x02, 0x0b, 0x07,
+    0x0c, 0x09, 0x0d, 0x06, 0x1c, 0x04, 0x02, 0x2f, 0x10, 0x07, 0x18, 0x31,
+    0x0f, 0x07, 0x17, 0x05, 0x14, 0x0d, 0xf0, 0x0a, 0x13, 0x0c, 0x0d, 0x04,
+    0x2a, 0x15, 0x04, 0x0c, 0x13, 0x0b, 0x19, 0x04, 0x15, 0x0a, 0x0c, 0x04,
+    0x0b, 0x02, 0x0a, 0x00, 0x08, 0x02, 0x0b, 0xf0, 0x05, 0x0a, 0x02, 0x1b,
+    0x04, 0x07, 0x1d, 0x06, 0x04, 0x0e, 0x05, 0x0a, 0x54, 0x0d, 0x0c, 0x0e,
+    0x0d, 0x0e, 0x0c, 0x25, 0x0a, 0x0b, 0x08, 0xf0, 0x04, 0x37, 0x03, 0x01,
+    0x02, 0x1f, 0x0b, 0x0a, 0x06, 0x08, 0x05, 0x07, 0x24, 0x08, 0x0a, 0x0c,
+    0x25, 0x0b, 0x0d, 0x0b, 0x03, 0x0a, 0x01, 0x18, 0xf0, 0x00, 0x02, 0x0a,
+    0x09, 0x0c, 0x0c, 0x3e, 0x05, 0x03, 0x01, 0x00, 0x0a, 0x04, 0x1f, 0x0f,
+    0x09, 0x1c, 0x07, 0x05, 0x0d, 0x04, 0x0c, 0x23, 0x0d, 0x0b, 0xf0, 0x0c,
+    0x04, 0x0e, 0x15, 0x0d, 0x0b, 0x04, 0x1c, 0x53, 0x0b, 0x1c, 0x0a, 0x19,
+    0x01, 0x03, 0x0a, 0x0e, 0x0d, 0x03, 0x0b, 0x00, 0x0f, 0x00, 0x01, 0x08,
+    0xd1, 0x05, 0x09, 0x06, 0x0a, 0x04, 0x1c, 0x03, 0x42, 0x0e, 0x0b, 0x09,
+    0x0b, 0x0d, 0x13, 0x0a, 0x0b, 0x02, 0x0f, 0x11, 0x0c, 0x05, 0x02, 0x00,
+    0x03, 0x03, 0x01, 0x22, 0x04, 0x0e, 0x15, 0x0f, 0x05, 0x01, 0x07, 0x04,
+    0xf0, 0x2a, 0x23, 0x0c, 0x04, 0x1b, 0x05, 0x06, 0x0d, 0x05, 0x0b, 0x03,
+    0x0a, 0x01, 0x17, 0x00, 0x02, 0x0a, 0x09, 0x0b, 0x08, 0x0c, 0x05, 0x0d,
+    0x02, 0x0e, 0x00, 0xf0, 0x1f, 0x04, 0x0e, 0x0e, 0x36, 0x0b, 0x0a, 0x09,
+    0x0a, 0x05, 0x19, 0x04, 0x03, 0x0a, 0x04, 0x09, 0x15, 0x0b, 0x0c, 0x04,
+    0x0e, 0x33, 0x0f, 0x0e, 0x20, 0x0d, 0x1a, 0x02, 0x01, 0x11, 0x37, 0x00,
+    0x02, 0x12, 0x0e, 0x05, 0x01, 0x08, 0x01, 0xf0, 0x0c, 0x00, 0x08, 0x02,
+    0x0b, 0x08, 0x0e, 0x0b, 0x0d, 0x08, 0x0c, 0x06, 0x1a, 0x05, 0x04, 0x09,
+    0x13, 0x1a, 0x04, 0x0c, 0x06, 0x0a, 0x07, 0x09, 0x04, 0x08, 0x02, 0x09,
+    0x00, 0x10, 0x1b, 0x01, 0x0d, 0x91, 0x58, 0x0f, 0x05, 0x03, 0x42, 0x09,
+    0x0a, 0x0b, 0x03, 0x0a, 0x05, 0xf0, 0x1e, 0x04, 0x02, 0x0b, 0x10, 0x0c,
+    0x09, 0x03, 0x0b, 0x09, 0x1a, 0x07, 0x03, 0x09, 0x01, 0x0a, 0x07, 0x0e,
+    0x0f, 0x0f, 0x05, 0x0c, 0x14, 0x1a, 0x05, 0x1b, 0x06, 0xd0, 0x05, 0x0d,
+    0x23, 0x0f, 0x0e, 0x0f, 0x44, 0x0e, 0x0c, 0x0a, 0x0b, 0x29, 0x03, 0x02,
+    0x01, 0x0a, 0x00, 0x0c, 0x03, 0x01, 0x09, 0x0f, 0x02, 0x28, 0x07, 0x01,
+    0x03, 0xf0, 0x10, 0x09, 0x0c, 0x03, 0x0f, 0x0d, 0x0e, 0x0f, 0x1c, 0x08,
+    0x06, 0x0a, 0x04, 0x0c, 0x03, 0x1b, 0x02, 0x03, 0x19, 0x05, 0x06, 0x0b,
+    0x04, 0x0d, 0x02, 0x0e, 0x00, 0xf0, 0x0b, 0x01, 0x0e, 0x1f, 0x1f, 0x07,
+    0x1e, 0x04, 0x13, 0x0b, 0x0a, 0x24, 0x08, 0x39, 0x05, 0x16, 0x08, 0x03,
+    0x19, 0x01, 0x00, 0x50, 0x0b, 0x01, 0x0e, 0x04, 0x0c, 0x06, 0x0b, 0x03,
+    0x0a, 0x02, 0x0b, 0x0c, 0x11, 0x08, 0x0d, 0x09, 0x06, 0xf0, 0x0a, 0x04,
+    0x09, 0x03, 0x0a, 0x04, 0x0b, 0x05, 0x0e, 0x06, 0x0d, 0x04, 0x0e, 0x13,
+    0x0f, 0x0e, 0x44, 0x0b, 0x0a, 0x09, 0x0a, 0x1b, 0x03, 0x02, 0x09, 0x01,
+    0x10, 0x08, 0x00, 0x0a, 0x04, 0x01, 0x09, 0x0f, 0x12, 0x07, 0x06, 0x06,
+    0x03, 0x01, 0x07, 0x01, 0xf0, 0x08, 0x00, 0x19, 0x02, 0x08, 0x0a, 0x0f,
+    0x0d, 0x0c, 0x0c, 0x07, 0x1a, 0x05, 0x04, 0x28, 0x13, 0x04, 0x0a, 0x05,
+    0x0c, 0x04, 0x0b, 0x02, 0x0d, 0x00, 0x1c, 0x01, 0x21, 0x0b, 0x0b, 0x07,
+    0x0a, 0x06, 0xb0, 0x0e, 0x04, 0x0c, 0x43, 0x0e, 0x1c, 0x0d, 0x0e, 0x04,
+    0x0c, 0x15, 0x0b, 0x0d, 0x03, 0x0e, 0x02, 0x09, 0x10, 0x71, 0x17, 0x01,
+    0x09, 0x04, 0x17, 0x12, 0x08, 0x0f, 0x0a, 0x0d, 0x09, 0x06, 0xf0, 0x0d,
+    0x04, 0x1a, 0x13, 0x0e, 0x04, 0x0d, 0x15, 0x0e, 0x0b, 0x04, 0x0d, 0x33,
+    0x1f, 0x0e, 0x0c, 0x14, 0x0a, 0x1b, 0x03, 0x02, 0x0a, 0x10, 0x10, 0x0e,
+    0x0b, 0x05, 0x01, 0x0a, 0x0f, 0x02, 0x07, 0x09, 0x21, 0x18, 0x04, 0x01,
+    0x07, 0x10, 0xe0, 0x09, 0x0c, 0x03, 0x1f, 0x0c, 0x0f, 0x0e, 0x09, 0x0b,
+    0x06, 0x1a, 0x04, 0x13, 0x19, 0x24, 0x08, 0x0a, 0x09, 0x02, 0x0a, 0x00,
+    0x0b, 0x02, 0x11, 0x1a, 0x0d, 0x0a, 0xf0, 0x0d, 0x07, 0x0a, 0x05, 0x19,
+    0x54, 0x38, 0x2a, 0x05, 0x06, 0x05, 0x09, 0x03, 0x0a, 0x01, 0x0b, 0x10,
+    0x0a, 0x1f, 0x02, 0x00, 0x01, 0x11, 0x0c, 0x03, 0x0e, 0x0f, 0x02, 0x0a,
+    0x09, 0xf1, 0x0e, 0x04, 0x1b, 0x02, 0x11, 0x0d, 0x0f, 0x02, 0x0d, 0x13,
+    0x0b, 0x0a, 0x62, 0x0e, 0x0c, 0x0d, 0x0c, 0x1a, 0x0b, 0x11, 0x0e, 0x41,
+    0x08, 0x10, 0x06, 0x07, 0x06, 0x19, 0x0f, 0x0e, 0x60, 0x0d, 0x07, 0x0a,
+    0x03, 0x08, 0x01, 0x07, 0x00, 0x08, 0x02, 0x09, 0x09, 0x0c, 0x0d, 0xc1,
+    0x19, 0x07, 0x05, 0x28, 0x03, 0x42, 0x07, 0x28, 0x01, 0x17, 0x00, 0x04,
+    0x08, 0x0f, 0x09, 0x09, 0xb0, 0x0e, 0x06, 0x0c, 0x04, 0x0b, 0x13, 0x0d,
+    0x0b, 0x24, 0x29, 0x05, 0x07, 0x06, 0x06, 0x0a, 0x15, 0x0b, 0x07, 0x11,
+    0x13, 0x04, 0x01, 0x12, 0x72, 0x00, 0x01, 0x03, 0x02, 0x04, 0x04, 0x08,
+    0x0f, 0x0f, 0x06, 0x0d, 0x03, 0x08, 0x02, 0x0a, 0xf1, 0x11, 0x0b, 0x0d,
+    0x02, 0x1a, 0x23, 0x0c, 0x0a, 0x52, 0x1c, 0x2b, 0x0c, 0x11, 0x0d, 0x08,
+    0x10, 0x06, 0x07, 0xf1, 0x06, 0x19, 0x0c, 0x07, 0x08, 0x06, 0x07, 0x03,
+    0x16, 0x01, 0x10, 0x05, 0x07, 0x03, 0x09, 0x0b, 0x0a, 0x07, 0x0b, 0x04,
+    0x0c, 0x03, 0x1a, 0x02, 0x41, 0x1f, 0xf1, 0x0e, 0x0b, 0x07, 0x00, 0x08,
+    0x03, 0x1a, 0x0d, 0x06, 0x19, 0x04, 0x03, 0x08, 0x62, 0x0a, 0x09, 0x3a,
+    0x09, 0x51, 0x03, 0x08, 0x14, 0x07, 0x16, 0x03, 0x02, 0x04, 0x10, 0x02,
+    0x52, 0x03, 0x01, 0x04, 0x04, 0x06, 0x0f, 0x0c, 0x0a, 0x08, 0x05, 0x09,
+    0x01, 0x04, 0x0e, 0xf0, 0x23, 0x0a, 0x09, 0x0c, 0x04, 0x0d, 0x15, 0x0c,
+    0x1b, 0x54, 0x19, 0x0a, 0x0b, 0x0c, 0x03, 0x0b, 0x02, 0x0a, 0x11, 0x18,
+    0xf0, 0x07, 0x0c, 0x0f, 0x0e, 0x08, 0x0d, 0x07, 0x0b, 0x05, 0x09, 0x03,
+    0x08, 0x01, 0x09, 0x00, 0x2e, 0x02, 0x0a, 0x0c, 0x2d, 0x07, 0x05, 0x34,
+    0x0b, 0x09, 0x08, 0xf0, 0x07, 0x03, 0x08, 0x02, 0x0a, 0x01, 0x0b, 0x04,
+    0x0d, 0x0f, 0x0c, 0x09, 0x1a, 0x06, 0x05, 0x19, 0x04, 0x53, 0x1d, 0x1e,
+    0x1f, 0x70, 0x24, 0x0c, 0x0e, 0x0d, 0x03, 0x0f, 0x02, 0x0e, 0x10, 0x0f,
+    0x0b, 0x01, 0x06, 0x41, 0x04, 0x07, 0x0f, 0x0a, 0x0c, 0x18, 0x05, 0x04,
+    0x0e, 0xf0, 0x23, 0x0d, 0x0b, 0x0c, 0x04, 0x0a, 0x15, 0x09, 0x0a, 0x54,
+    0x0c, 0x0b, 0x3a, 0x03, 0x0c, 0x02, 0x1f, 0x11, 0x0c, 0xf0, 0x05, 0x0b,
+    0x0c, 0x2a, 0x07, 0x06, 0x04, 0x1c, 0x03, 0x02, 0x0a, 0x01, 0x0b, 0x02,
+    0x0a, 0x06, 0x0b, 0x08, 0x1e, 0x06, 0x05, 0x0c, 0x34, 0x0b, 0x09, 0x18,
+    0xf0, 0x13, 0x0a, 0x18, 0x02, 0x04, 0x09, 0x09, 0x0c, 0x06, 0x0e, 0x05,
+    0x1c, 0xb4, 0x0a, 0x59, 0xf0, 0x0a, 0x0b, 0x0c, 0x0b, 0x03, 0x0c, 0x02,
+    0x08, 0x11, 0x09, 0x0c, 0x04, 0x0a, 0x0f, 0x1c, 0x0e, 0x06, 0x0d, 0x04,
+    0x1e, 0x23, 0x0c, 0x0d, 0xf0, 0xa4, 0x0a, 0x0b, 0x0d, 0x0b, 0x2a, 0x1b,
+    0x09, 0x17, 0x03, 0x02, 0x38, 0x05, 0x0a, 0x07, 0xf0, 0x06, 0x39, 0x05,
+    0x04, 0x03, 0x12, 0x1a, 0x04, 0x2b, 0x07, 0x06, 0x05, 0x1c, 0x24, 0x0a,
+    0x09, 0x23, 0x0e, 0x0b, 0x0a, 0xf0, 0x02, 0x0c, 0x03, 0x0d, 0x16, 0x0e,
+    0x1a, 0x05, 0xc4, 0x0c, 0x0a, 0x19, 0x0a, 0x29, 0x0a, 0x2b, 0xf0, 0x09,
+    0x03, 0x18, 0x12, 0x07, 0x04, 0x08, 0x1a, 0x1a, 0x06, 0x0b, 0x04, 0x0e,
+    0x23, 0x0f, 0x1e, 0xa4, 0x0a, 0x0b, 0x0c, 0xf0, 0x0b, 0x0a, 0x09, 0x1a,
+    0x0b, 0x09, 0x08, 0x03, 0x09, 0x02, 0x0b, 0x04, 0x0a, 0x06, 0x1b, 0x15,
+    0x0a, 0x14, 0x0c, 0x0a, 0xf0, 0x03, 0x0c, 0x12, 0x0f, 0x0d, 0x03, 0x0e,
+    0x25, 0x1c, 0x0a, 0x34, 0x0c, 0x0a, 0x19, 0x13, 0x0c, 0x0b, 0x02, 0x0f,
+    0x03, 0x1e, 0x15, 0xf0, 0x0b, 0xd4, 0x0d, 0x0b, 0x1a, 0x39, 0x2a, 0x1b,
+    0x1a, 0x03, 0xf0, 0x12, 0x0b, 0x09, 0x03, 0x0b, 0x06, 0x0d, 0x07, 0x0b,
+    0x05, 0x0c, 0xd4, 0x0d, 0x0a, 0x19, 0x1a, 0x1b, 0x5a, 0xf0, 0x23, 0x0e,
+    0x0a, 0x08, 0x04, 0x19, 0x06, 0x05, 0x0a, 0x24, 0x0d, 0x0b, 0x0a, 0x33,
+    0x0e, 0x0b, 0x09, 0xf0, 0x0c, 0x84, 0x0e, 0x0f, 0x0e, 0x0b, 0x1a, 0x09,
+    0x18, 0x13, 0x0a, 0x0d, 0x15, 0x0b, 0x0a, 0x34, 0x0c, 0x0b, 0xf0, 0x1a,
+    0x45, 0x47, 0x54, 0x1a, 0x1b, 0x0a, 0x08, 0x03, 0x09, 0x02, 0x0c, 0x03,
+    0x0a, 0xf0, 0x05, 0x0c, 0x06, 0x1b, 0x05, 0xf4, 0x0c, 0x0a, 0x19, 0x2a,
+    0x0b, 0x1a, 0x09, 0x0a, 0x0b, 0xf0, 0x0a, 0x09, 0x08, 0x13, 0x0a, 0x1e,
+    0x54, 0x0d, 0x0b, 0x1a, 0x09, 0x23, 0x0b, 0x0a, 0x0b, 0x04, 0x0d, 0x15,
+    0x0b, 0xf0, 0x0a, 0x44, 0x0c, 0x2a, 0x09, 0x23, 0x0e, 0x0c, 0x2e, 0x54,
+    0x1b, 0x19, 0x23, 0x0c, 0xf0, 0x0a, 0x0c, 0x74, 0x0a, 0x0d, 0x0e, 0x0c,
+    0x0b, 0x0c, 0x0b, 0x09, 0x23, 0x0c, 0x0a, 0x0d, 0x04, 0x0f, 0x25, 0x0e,
+    0x0c, 0xf0, 0x0a, 0x04, 0x1c, 0x03, 0x12, 0x0d, 0x4a, 0x03, 0x15, 0x04,
+    0x23, 0x1e, 0x0f, 0x54, 0x0c, 0x0d, 0x0c, 0x0b, 0xf0, 0x09, 0x0a, 0x16,
+    0x49, 0x05, 0x04, 0x03, 0x11, 0x0c, 0x2a, 0x04, 0x08, 0x07, 0x0b, 0x05,
+    0x0d, 0x74, 0x0e, 0x0b, 0x0a, 0xf0, 0x0b, 0x0d, 0x1e, 0x0a, 0x03, 0x0b,
+    0x24, 0x19, 0x08, 0x13, 0x0a, 0x08, 0x12, 0x09, 0x1a, 0x05, 0x07, 0x0b,
+    0x06, 0x0a, 0xf0, 0x05, 0x09, 0x64, 0x2b, 0x0d, 0x1e, 0x0a, 0x13, 0x0d,
+    0x0c, 0x04, 0x1b, 0x15, 0x0a, 0x04, 0x2b, 0x03, 0x12, 0xf0, 0x09, 0x03,
+    0x0d, 0x15, 0x1e, 0x03, 0x0f, 0x12, 0x0e, 0x1b, 0x03, 0x05, 0x0a, 0x16,
+    0x1c, 0x05, 0x0b, 0x04, 0x1c, 0x13, 0x0a, 0x04, 0x09, 0xf0, 0x15, 0x0a,
+    0x0b, 0x04, 0x0e, 0x03, 0x0c, 0x02, 0x0b, 0x11, 0x0c, 0x2f, 0x04, 0x18,
+    0x0e, 0x06, 0x0b, 0x05, 0x0a, 0x14, 0x0c, 0x0d, 0x15, 0x0a, 0x19, 0xf0,
+    0x04, 0x02, 0x0c, 0x11, 0x09, 0x08, 0x02, 0x0b, 0x05, 0x0e, 0x09, 0x1d,
+    0x08, 0x04, 0x1e, 0x02, 0x00, 0x0f, 0x01, 0x0b, 0x08, 0x2c, 0x0d, 0x07,
+    0x05, 0x1b, 0xf0, 0x64, 0x0a, 0x0b, 0x1d, 0x0c, 0x09, 0x15, 0x37, 0x06,
+    0x08, 0x0b, 0x06, 0x08, 0x35, 0x04, 0x01, 0x00, 0xf0, 0x04, 0x06, 0x0f,
+    0x19, 0x0d, 0x08, 0x28, 0x35, 0x0a, 0x0c, 0x24, 0x0e, 0x0c, 0x0a, 0x23,
+    0x0c, 0x0b, 0x0c, 0x05, 0x0a, 0x08, 0x09, 0xf0, 0x06, 0x2a, 0x04, 0x02,
+    0x00, 0x0d, 0x02, 0x09, 0x0c, 0x1c, 0x0d, 0x07, 0x1e, 0x05, 0x04, 0x0b,
+    0x03, 0x0c, 0x22, 0x0f, 0x0c, 0x0b, 0x03, 0x29, 0x04, 0xf0, 0x05, 0x04,
+    0x0a, 0x13, 0x08, 0x09, 0x15, 0x0e, 0x1f, 0x03, 0x01, 0x0e, 0x00, 0x0b,
+    0x05, 0x0a, 0x0f, 0x0f, 0x08, 0x0c, 0x06, 0x0b, 0x05, 0x0a, 0xb4, 0x0c,
+    0x1a, 0xf0, 0x0b, 0x1e, 0x0c, 0x09, 0x08, 0x0a, 0x0e, 0x1f, 0x03, 0x02,
+    0x0b, 0x10, 0x39, 0x04, 0x27, 0xf0, 0x0a, 0x0b, 0x05, 0x09, 0x34, 0x1a,
+    0x0b, 0x0d, 0x25, 0x0b, 0x1a, 0x14, 0x09, 0x1a, 0x15, 0x1e, 0x04, 0x03,
+    0x1c, 0xf0, 0x01, 0x00, 0x0b, 0x04, 0x0e, 0x0f, 0x0f, 0x07, 0x0c, 0x05,
+    0x0a, 0x54, 0x09, 0x1a, 0x0c, 0x0e, 0x0c, 0x03, 0x18, 0x11, 0x07, 0x03,
+    0x19, 0xf0, 0x0b, 0x0e, 0x18, 0x07, 0x04, 0x1a, 0x02, 0x00, 0x19, 0x02,
+    0x1f, 0x0f, 0x0e, 0x08, 0x0b, 0x06, 0x0a, 0x05, 0x19, 0x04, 0x13, 0x0c,
+    0x0e, 0x04, 0x0c, 0xf0, 0x15, 0x0b, 0x09, 0x04, 0x0a, 0x13, 0x09, 0x1a,
+    0x04, 0x15, 0x0b, 0x2a, 0x04, 0x01, 0x00, 0x0b, 0x14, 0x0d, 0x19, 0x02,
+    0x05, 0x0a, 0x08, 0x1b, 0xf0, 0x06, 0x04, 0x0d, 0x05, 0x0a, 0x54, 0x0d,
+    0x0e, 0x0d, 0x0e, 0x0d, 0x0c, 0x15, 0x0b, 0x0c, 0x03, 0x2f, 0x02, 0x01,
+    0x00, 0x0d, 0x03, 0x0c, 0xf0, 0x0f, 0x0f, 0x08, 0x0c, 0x04, 0x0d, 0x23,
+    0x1e, 0x0f, 0x04, 0x0d, 0x05, 0x0c, 0x06, 0x1a, 0x05, 0x03, 0x08, 0x01,
+    0x06, 0x00, 0x08, 0x03, 0x1b, 0x1d, 0x1a, 0xf0, 0x05, 0x03, 0x0b, 0x11,
+    0x07, 0x08, 0x0c, 0x0a, 0x0f, 0x0d, 0x07, 0x0e, 0x06, 0x0d, 0x05, 0x0b,
+    0x04, 0x1c, 0x23, 0x0b, 0x0e, 0x25, 0x0a, 0x0d, 0x0b, 0xf0, 0x04, 0x0a,
+    0x43, 0x0b, 0x0c, 0x0d, 0x2a, 0x02, 0x01, 0x09, 0x06, 0x1b, 0x0e, 0x02,
+    0x09, 0x00, 0x0d, 0x02, 0x0e, 0x09, 0x3c, 0x0a, 0x07, 0xc0, 0x15, 0x39,
+    0x34, 0x0b, 0x15, 0x0c, 0x0d, 0x04, 0x0a, 0x02, 0x0d, 0x01, 0x0e, 0x00,
+    0x0b, 0x02, 0x09, 0x51, 0x0f, 0x0d, 0x08, 0x09, 0x04, 0x07, 0x23, 0x06,
+    0x05, 0x0a, 0xf0, 0x04, 0x18, 0x05, 0x06, 0x09, 0x0a, 0x07, 0x08, 0x26,
+    0x04, 0x01, 0x00, 0x08, 0x03, 0x0a, 0x09, 0x0c, 0x07, 0x0b, 0x04, 0x1f,
+    0x11, 0x0d, 0x09, 0x0e, 0x0a, 0x0d, 0xf0, 0x35, 0x2c, 0x0e, 0x04, 0x1d,
+    0x13, 0x0a, 0x04, 0x0b, 0x15, 0x2c, 0x34, 0x09, 0x28, 0x03, 0x02, 0x0a,
+    0x10, 0x01, 0x0b, 0x00, 0x09, 0x21, 0x05, 0x0c, 0x0f, 0x0a, 0x04, 0x0e,
+    0xf0, 0x01, 0x18, 0x00, 0x03, 0x0b, 0x1a, 0x0c, 0x0e, 0x07, 0x0d, 0x05,
+    0x1e, 0x04, 0x23, 0x0d, 0x0a, 0x0b, 0x04, 0x0d, 0x06, 0x0b, 0x07, 0x08,
+    0x04, 0x17, 0x02, 0x10, 0x00, 0x09, 0x02, 0x08, 0xf1, 0x0f, 0x0b, 0x08,
+    0x19, 0x04, 0x52, 0x0a, 0x08, 0x19, 0x0a, 0x0c, 0x13, 0x0b, 0x1d, 0x02,
+    0x01, 0x08, 0x10, 0x05, 0x06, 0x03, 0x17, 0xf1, 0x06, 0x04, 0x18, 0x11,
+    0x09, 0x09, 0x0a, 0x07, 0x09, 0x03, 0x08, 0x12, 0x0a, 0x0b, 0x03, 0x0c,
+    0x04, 0x09, 0x03, 0x2a, 0x72, 0x0d, 0x0f, 0xf1, 0x2c, 0x0a, 0x11, 0x0b,
+    0x27, 0x10, 0x07, 0x0a, 0x0f, 0x0e, 0x06, 0x06, 0x02, 0x05, 0x10, 0x04,
+    0x08, 0x03, 0x0a, 0x07, 0x0c, 0xf1, 0x06, 0x1d, 0x04, 0x03, 0x0c, 0x02,
+    0x1d, 0x11, 0x0a, 0x02, 0x08, 0x03, 0x09, 0x04, 0x08, 0x03, 0x17, 0x01,
+    0x00, 0x05, 0x03, 0x06, 0x0f, 0x09, 0x07, 0x1a, 0x04, 0xf1, 0x52, 0x0b,
+    0x18, 0x19, 0x0a, 0x03, 0x09, 0x04, 0x08, 0x03, 0x09, 0x01, 0x0a, 0x10,
+    0x08, 0x06, 0x01, 0x18, 0x13, 0x0a, 0x01, 0x09, 0xf1, 0x02, 0x0e, 0x0f,
+    0x0c, 0x07, 0x1a, 0x03, 0x12, 0x08, 0x07, 0x03, 0x08, 0x14, 0x09, 0x18,
+    0x03, 0x62, 0x1a, 0x0d, 0x0b, 0x0a, 0x1c, 0xf1, 0x11, 0x0d, 0x07, 0x10,
+    0x06, 0x08, 0x08, 0x1b, 0x0f, 0x05, 0x09, 0x02, 0x08, 0x10, 0x06, 0x05,
+    0x02, 0x06, 0x07, 0x37, 0x0c, 0x08, 0x05, 0xf1, 0x04, 0x06, 0x02, 0x08,
+    0x11, 0x0b, 0x0d, 0x02, 0x0e, 0x03, 0x09, 0x02, 0x0a, 0x01, 0x07, 0x00,
+    0x06, 0x04, 0x08, 0x0e, 0x0a, 0x05, 0x0c, 0x03, 0x0e, 0x62, 0x0b, 0x09,
+    0x08, 0x81, 0x19, 0x0b, 0x0e, 0x13, 0x1a, 0x02, 0x08, 0x01, 0x07, 0x10,
+    0x04, 0x02, 0x03, 0x03, 0x02, 0x12, 0x24, 0x04, 0x01, 0x23, 0x03, 0x15,
+    0x0f, 0x07, 0x02, 0x06, 0x04, 0x01, 0x08, 0x13, 0xf0, 0x0c, 0x19, 0x04,
+    0x05, 0x3b, 0x06, 0x05, 0x24, 0x09, 0x0a, 0x13, 0x1d, 0x14, 0x1a, 0x03,
+    0x09, 0x02, 0x18, 0x00, 0x01, 0x00, 0x0b, 0x0c, 0x11, 0x09, 0x0f, 0x0a,
+    0x0a, 0xf0, 0x0e, 0x04, 0x0c, 0x01, 0x0a, 0x00, 0x17, 0x01, 0x05, 0x0b,
+    0x1f, 0x0e, 0x0d, 0x07, 0x2e, 0x05, 0x03, 0x12, 0x1f, 0x23, 0x0e, 0x0f,
+    0x0e, 0x01, 0x10, 0x0b, 0x00, 0x0f, 0x05, 0x11, 0x0a, 0x0d, 0x09, 0x08,
+    0xe0, 0x1c, 0x06, 0x04, 0x0b, 0x43, 0x0e, 0x0c, 0x0e, 0x0c, 0x0d, 0x04,
+    0x0a, 0x05, 0x0b, 0x06, 0x0a, 0x05, 0x18, 0x03, 0x01, 0x09, 0x10, 0x18,
+    0x21, 0x11, 0x0b, 0x0d, 0x05, 0x32, 0x0a, 0x0f, 0x0b, 0x05, 0x09, 0x03,
+    0x07, 0x12, 0x01, 0x08, 0xe0, 0x0e, 0x03, 0x0b, 0x04, 0x0d, 0x15, 0x0c,
+    0x1b, 0x64, 0x0a, 0x0b, 0x2a, 0x18, 0x03, 0x02, 0x07, 0x00, 0x18, 0x01,
+    0x21, 0x1d, 0x19, 0x0b, 0xf0, 0x0e, 0x05, 0x0c, 0x02, 0x09, 0x10, 0x0a,
+    0x09, 0x02, 0x0e, 0x09, 0x1f, 0x0f, 0x09, 0x0e, 0x06, 0x0c, 0x04, 0x1b,
+    0x43, 0x09, 0x1a, 0x09, 0x11, 0xf0, 0x0a, 0x0c, 0x0b, 0x0e, 0x0f, 0x0f,
+    0x08, 0x0c, 0x06, 0x19, 0x64, 0x18, 0x39, 0x05, 0x08, 0x07, 0x07, 0x08,
+    0x06, 0x07, 0x40, 0x25, 0x04, 0x01, 0x00, 0x06, 0x01, 0x09, 0x02, 0x01,
+    0x38, 0x0a, 0x02, 0x0f, 0x23, 0x04, 0x02, 0x07, 0x21, 0x02, 0x08, 0xc1,
+    0x0b, 0x0e, 0x02, 0x0c, 0x13, 0x0b, 0x0c, 0x62, 0x0f, 0x1c, 0x1b, 0x0d,
+    0x1a, 0x11, 0xf0, 0x0e, 0x00, 0x09, 0x02, 0x0b, 0x0f, 0x1f, 0x0c, 0x09,
+    0x0e, 0x06, 0x1b, 0x03, 0x01, 0x0a, 0x00, 0x08, 0x01, 0x09, 0x06, 0x0d,
+    0x0f, 0x0f, 0x0b, 0x0e, 0x07, 0x0d, 0x04, 0x1e, 0x23, 0xf0, 0x1b, 0x12,
+    0x0e, 0x0d, 0x11, 0x0b, 0x0e, 0x09, 0x1f, 0x0f, 0x07, 0x1d, 0x05, 0x64,
+    0x0a, 0x09, 0x08, 0x29, 0x70, 0x08, 0x05, 0x27, 0x06, 0x17, 0x16, 0x05,
+    0x02, 0x05, 0x10, 0x01, 0x13, 0x02, 0x01, 0x05, 0x42, 0x07, 0x08, 0x0f,
+    0x0e, 0x05, 0x0b, 0x03, 0x08, 0x02, 0x0b, 0xf1, 0x11, 0x1e, 0x02, 0x0a,
+    0x23, 0x09, 0x0b, 0x09, 0x52, 0x3b, 0x0d, 0x1c, 0x11, 0x07, 0x00, 0x06,
+    0x01, 0x08, 0xf1, 0x17, 0x0a, 0x29, 0x05, 0x04, 0x02, 0x0c, 0x01, 0x09,
+    0x10, 0x08, 0x07, 0x02, 0x19, 0x07, 0x06, 0x0a, 0x04, 0x0b, 0x03, 0x0a,
+    0x22, 0x0c, 0x19, 0xf1, 0x11, 0x0e, 0x0b, 0x10, 0x0f, 0x0e, 0x04, 0x0d,
+    0x06, 0x0e, 0x04, 0x1b, 0x03, 0x72, 0x0c, 0x0a, 0x09, 0x0a, 0x09, 0x0a,
+    0x0b, 0x0c, 0xc1, 0x03, 0x08, 0x24, 0x16, 0x15, 0x02, 0x10, 0x06, 0x05,
+    0x01, 0x07, 0x06, 0x09, 0x0f, 0x0d, 0x08, 0x08, 0x05, 0x07, 0x04, 0x0b,
+    0xf0, 0x23, 0x0c, 0x0b, 0x0e, 0x84, 0x0b, 0x1e, 0x0b, 0x5a, 0x03, 0x02,
+    0x0d, 0x01, 0x0c, 0x02, 0x0a, 0xf0, 0x08, 0x1b, 0x09, 0x06, 0x1c, 0x05,
+    0x04, 0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x0b, 0x02, 0x0e, 0x07, 0x1b,
+    0x09, 0x07, 0x0a, 0x05, 0x1b, 0x24, 0x19, 0xf0, 0x13, 0x0b, 0x09, 0x12,
+    0x0b, 0x09, 0x06, 0x0a, 0x09, 0x0c, 0x06, 0x2b, 0x05, 0xb4, 0x0a, 0x49,
+    0x1a, 0xf0, 0x0b, 0x0c, 0x1a, 0x03, 0x02, 0x07, 0x01, 0x08, 0x02, 0x07,
+    0x07, 0x09, 0x0f, 0x0e, 0x0a, 0x1b, 0x06, 0x04, 0x0c, 0x23, 0x0d, 0x0c,
+    0x0e, 0xf0, 0x84, 0x0a, 0x0c, 0x0d, 0x0b, 0x1a, 0x2b, 0x13, 0x0c, 0x19,
+    0x12, 0x0b, 0x06, 0x1a, 0x07, 0x15, 0x0c, 0xf0, 0x0b, 0x04, 0x0c, 0x13,
+    0x0e, 0x08, 0x12, 0x09, 0x0b, 0x05, 0x0a, 0x07, 0x1b, 0x06, 0x05, 0x0a,
+    0x54, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0xf0, 0x03, 0x07, 0x05, 0x29,
+    0x08, 0x06, 0x05, 0x0a, 0xb4, 0x0b, 0x3a, 0x29, 0x0a, 0x0b, 0x0c, 0xf0,
+    0x0b, 0x03, 0x0d, 0x02, 0x0c, 0x11, 0x0e, 0x0f, 0x04, 0x0e, 0x0a, 0x0d,
+    0x07, 0x0e, 0x05, 0x0d, 0xd4, 0x0c, 0x09, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+    0xf0, 0x0b, 0x0a, 0x09, 0x0a, 0x1b, 0x09, 0x03, 0x0b, 0x12, 0x2e, 0x04,
+    0x06, 0x1a, 0x25, 0x09, 0x08, 0x04, 0x0a, 0xf0, 0x03, 0x0c, 0x12, 0x0f,
+    0x0d, 0x03, 0x0f, 0x25, 0x0d, 0x0c, 0x0a, 0x24, 0x0b, 0x1a, 0x33, 0x0e,
+    0x0c, 0x0a, 0x09, 0x04, 0x0c, 0x06, 0x1a, 0xf0, 0x05, 0xd4, 0x0c, 0x0b,
+    0x3a, 0x29, 0x1a, 0x1b, 0x19, 0x03, 0xf0, 0x12, 0x0a, 0x09, 0x04, 0x2a,
+    0x08, 0x07, 0x06, 0x18, 0x15, 0x07, 0xc4, 0x19, 0x0a, 0x2b, 0x0a, 0x09,
+    0xf0, 0x0a, 0x1b, 0x09, 0x08, 0x13, 0x19, 0x04, 0x0c, 0x05, 0x0b, 0x34,
+    0x1d, 0x0b, 0x0a, 0x23, 0x0e, 0x0a, 0x09, 0xf0, 0x04, 0x28, 0x16, 0x05,
+    0x09, 0x34, 0x0b, 0x0a, 0x19, 0x23, 0x0e, 0x0c, 0x1a, 0x04, 0x05, 0x0c,
+    0x44, 0x0e, 0x0c, 0x0b, 0xf0, 0x1a, 0x45, 0x47, 0x54, 0x2a, 0x0b, 0x0a,
+    0x08, 0x03, 0x09, 0x02, 0x0b, 0x03, 0x0d, 0xf0, 0x16, 0x0b, 0x1a, 0x05,
+    0xd4, 0x0c, 0x29, 0x1a, 0x0b, 0x4a, 0x0b, 0xf0, 0x09, 0x23, 0x0e, 0x0c,
+    0x0a, 0x54, 0x0b, 0x0e, 0x1c, 0x1a, 0x33, 0x0e, 0x0b, 0x0a, 0x0b, 0xa4,
+    0x0c, 0x1e, 0xf0, 0x0c, 0x0b, 0x1a, 0x09, 0x08, 0x07, 0x08, 0x15, 0x3a,
+    0x34, 0x0c, 0x0b, 0x23, 0x0c, 0xf0, 0x0b, 0x0e, 0x74, 0x1a, 0x1b, 0x0c,
+    0x1d, 0x0b, 0x13, 0x0d, 0x0a, 0x04, 0x09, 0x05, 0x0a, 0x24, 0x0d, 0x0b,
+    0xf0, 0x0d, 0x05, 0x0a, 0x04, 0x0d, 0x03, 0x1b, 0x12, 0x1a, 0x03, 0x15,
+    0x09, 0x2a, 0x14, 0x15, 0x09, 0x0a, 0x54, 0x0e, 0x0d, 0x0c, 0xf0, 0x0b,
+    0x0c, 0x0a, 0x03, 0x0d, 0x04, 0x0b, 0x05, 0x1a, 0x04, 0x02, 0x0e, 0x11,
+    0x0b, 0x08, 0x04, 0x0a, 0x0c, 0x2b, 0x09, 0x06, 0x25, 0x0a, 0x09, 0xf0,
+    0x08, 0x04, 0x19, 0x13, 0x0a, 0x04, 0x0b, 0x06, 0x1a, 0x05, 0x44, 0x08,
+    0x09, 0x0b, 0x0a, 0x08, 0x03, 0x07, 0x02, 0x18, 0x03, 0x04, 0x19, 0xf0,
+    0x05, 0x06, 0x18, 0x04, 0x03, 0x1a, 0x07, 0x09, 0x09, 0x06, 0x18, 0x05,
+    0x14, 0x09, 0x0b, 0x45, 0x0a, 0x0b, 0x1c, 0x0b, 0x04, 0x3a, 0xf0, 0x02,
+    0x11, 0x05, 0x1b, 0x07, 0x02, 0x09, 0x01, 0x08, 0x02, 0x0d, 0x07, 0x1c,
+    0x0a, 0x08, 0x2b, 0x06, 0x05, 0x24, 0x0c, 0x0a, 0x28, 0xf0, 0x03, 0x02,
+    0x04, 0x09, 0x0f, 0x0c, 0x08, 0x0a, 0x04, 0x27, 0x12, 0x05, 0x0a, 0x0c,
+    0x0b, 0x09, 0x0a, 0x06, 0x09, 0x04, 0x08, 0x03, 0x09, 0x04, 0x0a, 0x03,
+    0x0d, 0xf0, 0x01, 0x0a, 0x00, 0x0b, 0x03, 0x0a, 0x06, 0x0b, 0x04, 0x1d,
+    0x05, 0x26, 0x2c, 0x04, 0x0d, 0x03, 0x09, 0x11, 0x0a, 0x0f, 0x09, 0x0d,
+    0x0f, 0x0b, 0x06, 0x09, 0xf0, 0x13, 0x08, 0x09, 0x09, 0x0a, 0x07, 0x09,
+    0x13, 0x08, 0x07, 0x04, 0x19, 0x06, 0x03, 0x2b, 0x02, 0x05, 0x0d, 0x0a,
+    0x0c, 0x08, 0x05, 0x07, 0x02, 0x05, 0x10, 0x04, 0x10, 0x03, 0x04, 0x07,
+    0x01, 0x0f, 0x0e, 0x13, 0x05, 0x08, 0x62, 0x0c, 0x22, 0x18, 0x0c, 0xc1,
+    0x0a, 0x0c, 0x0f, 0x13, 0x0e, 0x0c, 0x01, 0x0a, 0x10, 0x07, 0x05, 0x02,
+    0x08, 0x0f, 0x0c, 0x06, 0x0a, 0x02, 0x08, 0x00, 0x0f, 0xf0, 0x01, 0x0c,
+    0x08, 0x0e, 0x0f, 0x0d, 0x09, 0x0b, 0x06, 0x0c, 0x15, 0x0b, 0x08, 0x03,
+    0x17, 0x02, 0x11, 0x08, 0x0b, 0x0e, 0x1e, 0x0b, 0x02, 0x0d, 0x03, 0x0b,
+    0x06, 0x1e, 0x50, 0x07, 0x03, 0x0c, 0x10, 0x0b, 0x07, 0x01, 0x0c, 0x06,
+    0x09, 0x61, 0x0f, 0x0c, 0x05, 0x0b, 0x02, 0x0c, 0x00, 0x09, 0x04, 0x0a,
+    0x0f, 0x0b, 0x05, 0x0f, 0xc0, 0x14, 0x0b, 0x09, 0x25, 0x1a, 0x08, 0x04,
+    0x17, 0x05, 0x09, 0x16, 0x0b, 0x07, 0x04, 0x04, 0x03, 0x10, 0x02, 0x01,
+    0xf1, 0x0f, 0x04, 0x0e, 0x05, 0x06, 0x06, 0x08, 0x27, 0x14, 0x03, 0x08,
+    0x12, 0x0b, 0x2e, 0x04, 0x05, 0x03, 0x2f, 0x01, 0x10, 0x1c, 0x05, 0xf1,
+    0x0f, 0x09, 0x04, 0x05, 0x02, 0x13, 0x00, 0x02, 0x06, 0x0d, 0x09, 0x0a,
+    0x08, 0x05, 0x19, 0x03, 0x01, 0x08, 0x00, 0x27, 0x02, 0x03, 0x10, 0x06,
+    0x07, 0x06, 0x28, 0xc1, 0x09, 0x05, 0x03, 0x09, 0x14, 0x08, 0x09, 0x02,
+    0x08, 0x01, 0x09, 0x00, 0x08, 0x01, 0x0a, 0x0f, 0x0b, 0x0d, 0x08, 0x04,
+    0x06, 0x02, 0x09, 0xf0, 0x01, 0x0a, 0x0c, 0x0e, 0x0f, 0x0f, 0x04, 0x0c,
+    0x02, 0x0a, 0x00, 0x0b, 0x01, 0x08, 0x07, 0x09, 0x0c, 0x08, 0x09, 0x27,
+    0x1f, 0x0d, 0x04, 0x06, 0x03, 0x03, 0x02, 0x00, 0x00, 0x01, 0x03, 0x02,
+    0x42, 0x0f, 0x0d, 0x06, 0x1b, 0x04, 0x42, 0x08, 0x0e, 0x91, 0x0a, 0x08,
+    0x17, 0x04, 0x0b, 0x06, 0x0f, 0x05, 0x07, 0x03, 0x04, 0x11, 0x10, 0x06,
+    0x02, 0x0f, 0x0b, 0x03, 0x07, 0x09, 0x02, 0x03, 0x08, 0xf1, 0x10, 0x06,
+    0x08, 0x04, 0x0c, 0x05, 0x0b, 0x24, 0x0a, 0x19, 0x05, 0x17, 0x04, 0x03,
+    0x06, 0x02, 0x04, 0x00, 0x03, 0x02, 0x04, 0x06, 0x25, 0x07, 0x0c, 0x61,
+    0x0a, 0x04, 0x0f, 0x03, 0x08, 0x02, 0x02, 0x11, 0x00, 0x02, 0x04, 0x1f,
+    0x1e, 0x02, 0x03, 0x04, 0x0a, 0x02, 0x02, 0x09, 0x31, 0x00, 0x05, 0x01,
+    0x08, 0x0f, 0x0a, 0x0a, 0x0f, 0xf0, 0x05, 0x0c, 0x34, 0x09, 0x0a, 0x0c,
+    0x1a, 0x03, 0x04, 0x08, 0x07, 0x07, 0x09, 0x06, 0x06, 0x15, 0x03, 0x10,
+    0x04, 0x08, 0x05, 0x0a, 0x01, 0x0c, 0x03, 0x09, 0xf1, 0x0f, 0x0c, 0x08,
+    0x0e, 0x06, 0x0c, 0x03, 0x0b, 0x11, 0x0a, 0x08, 0x03, 0x09, 0x15, 0x0e,
+    0x1d, 0x02, 0x01, 0x09, 0x00, 0x07, 0x04, 0x08, 0x0a, 0x07, 0x03, 0x16,
+    0x10, 0xf1, 0x09, 0x07, 0x0b, 0x08, 0x19, 0x04, 0x02, 0x1b, 0x01, 0x00,
+    0x08, 0x01, 0x07, 0x04, 0x1a, 0x05, 0x11, 0x09, 0x2a, 0x02, 0x00, 0x02,
+    0x0b, 0x04, 0x0e, 0xd1, 0x07, 0x0c, 0x05, 0x0a, 0x02, 0x09, 0x10, 0x07,
+    0x06, 0x06, 0x09, 0x0f, 0x0c, 0x04, 0x0b, 0x02, 0x0c, 0x10, 0x0b, 0x0d,
+    0x0b, 0x0b, 0x09, 0x08, 0x03, 0x0e, 0xf0, 0x01, 0x09, 0x00, 0x0b, 0x03,
+    0x1d, 0x0a, 0x09, 0x0c, 0x06, 0x0a, 0x05, 0x0b, 0x04, 0x09, 0x02, 0x0d,
+    0x01, 0x0a, 0x00, 0x19, 0x01, 0x0f, 0x0f, 0x06, 0x0e, 0x03, 0x09, 0x07,
+    0x0a, 0xb0, 0x06, 0x0b, 0x07, 0x0d, 0x06, 0x0c, 0x04, 0x0b, 0x03, 0x0a,
+    0x04, 0x0d, 0x15, 0x0e, 0x0c, 0x02, 0x09, 0x10, 0x0b, 0x07, 0x03, 0x0a,
+    0x01, 0x0f, 0x0f, 0x02, 0x04, 0x0e, 0xf1, 0x10, 0x1a, 0x15, 0x0b, 0x0d,
+    0x04, 0x0c, 0x03, 0x0b, 0x02, 0x0d, 0x23, 0x0a, 0x0b, 0x18, 0x02, 0x01,
+    0x06, 0x00, 0x27, 0x03, 0x01, 0x02, 0x06, 0x61, 0x09, 0x05, 0x0f, 0x04,
+    0x0b, 0x03, 0x03, 0x12, 0x10, 0x06, 0x1f, 0x09, 0x32, 0x0f, 0x05, 0x0a,
+    0x02, 0x08, 0x01, 0x07, 0xf1, 0x00, 0x06, 0x05, 0x0c, 0x0f, 0x1f, 0x03,
+    0x02, 0x0c, 0x01, 0x0d, 0x62, 0x1a, 0x0b, 0x09, 0x0b, 0x08, 0x07, 0x01,
+    0x06, 0x00, 0x15, 0x01, 0x21, 0x04, 0x07, 0x02, 0x06, 0x00, 0x14, 0x02,
+    0x04, 0x03, 0x0b, 0x03, 0x04, 0x1f, 0x02, 0x05, 0x01, 0x06, 0x0a, 0xf0,
+    0x37, 0x14, 0x16, 0x18, 0x14, 0x19, 0x12, 0x0d, 0x0f, 0x0f, 0x04, 0x0b,
+    0x00, 0x09, 0x01, 0x0c, 0x0b, 0x0d, 0x0f, 0x0c, 0x0e, 0x0b, 0x06, 0xf0,
+    0x19, 0x02, 0x11, 0x07, 0x09, 0x06, 0x0c, 0x0c, 0x1d, 0x04, 0x01, 0x0a,
+    0x05, 0x0b, 0x03, 0x09, 0x01, 0x18, 0x04, 0x08, 0x19, 0x0c, 0x07, 0x18,
+    0x02, 0x01, 0x61, 0x06, 0x0c, 0x07, 0x09, 0x18, 0x04, 0x02, 0x19, 0x01,
+    0x00, 0x28, 0x03, 0x02, 0x0f, 0x03, 0x05, 0x01, 0x07, 0x02, 0xb0, 0x06,
+    0x00, 0x05, 0x02, 0x08, 0x1f, 0x0a, 0x0d, 0x07, 0x1b, 0x05, 0x03, 0x0c,
+    0x02, 0x0a, 0x10, 0x0e, 0x0a, 0x02, 0x0e, 0x05, 0x11, 0x39, 0x0f, 0x04,
+    0xc0, 0x02, 0x03, 0x0b, 0x05, 0x2c, 0x09, 0x08, 0x06, 0x0b, 0x04, 0x0d,
+    0x05, 0x1a, 0x04, 0x02, 0x27, 0x10, 0x02, 0x01, 0x0a, 0x0f, 0x03, 0x0b,
+    0x05, 0x02, 0x1a, 0x00, 0x51, 0x01, 0x0c, 0x04, 0x0a, 0x03, 0x2b, 0x34,
+    0xe0, 0x0d, 0x2a, 0x15, 0x04, 0x08, 0x02, 0x09, 0x00, 0x1b, 0x05, 0x06,
+    0x28, 0x01, 0x03, 0x0a, 0x06, 0x0d, 0x05, 0x03, 0x14, 0x00, 0x01, 0x03,
+    0x35, 0x0f, 0x08, 0x0a, 0x05, 0x04, 0x04, 0x02, 0x02, 0x06, 0x01, 0x01,
+    0x07, 0x00, 0x00, 0x09, 0x02, 0x01, 0x0c, 0x0f, 0x02, 0x0d, 0x06, 0x01,
+    0x0e, 0x04, 0xf0, 0x0f, 0x22, 0x1e, 0x0f, 0x14, 0x1a, 0x05, 0x08, 0x04,
+    0x27, 0x03, 0x11, 0x19, 0x14, 0x0a, 0x05, 0x18, 0x02, 0x03, 0x0a, 0x05,
+    0xf0, 0x0b, 0x09, 0x0d, 0x0f, 0x0f, 0x0a, 0x0d, 0x06, 0x1c, 0x04, 0x05,
+    0x0a, 0x04, 0x0c, 0x13, 0x0b, 0x08, 0x02, 0x09, 0x01, 0x0a, 0x0b, 0x0c,
+    0x05, 0x0b, 0x00, 0x0e, 0x04, 0x1c, 0x0c, 0xa0, 0x17, 0x0b, 0x0d, 0x05,
+    0x1f, 0x02, 0x10, 0x0e, 0x0d, 0x07, 0x0c, 0x0f, 0x0e, 0x05, 0x0a, 0x01,
+    0x0e, 0x04, 0xe1, 0x08, 0x05, 0x17, 0x10, 0x08, 0x02, 0x27, 0x05, 0x04,
+    0x01, 0x08, 0x03, 0x0c, 0x0f, 0x0d, 0x06, 0x0a, 0x03, 0x09, 0x11, 0x0b,
+    0x28, 0x00, 0x02, 0x12, 0x0f, 0x0a, 0x05, 0x01, 0x09, 0x02, 0xb0, 0x08,
+    0x00, 0x06, 0x02, 0x0a, 0x0d, 0x0c, 0x09, 0x0e, 0x05, 0x2f, 0x04, 0x02,
+    0x01, 0x0e, 0x00, 0x09, 0x01, 0x0a, 0x06, 0x0b, 0x05, 0x01, 0x1a, 0x0f,
+    0x02, 0x04, 0x01, 0x08, 0x10, 0xb0, 0x0c, 0x0b, 0x02, 0x0f, 0x0a, 0x0d,
+    0x0f, 0x0c, 0x0d, 0x0b, 0x08, 0x0a, 0x07, 0x09, 0x04, 0x08, 0x02, 0x06,
+    0x10, 0x05, 0x07, 0x02, 0x01, 0x09, 0x0f, 0x32, 0x0a, 0x04, 0x09, 0x00,
+    0x18, 0x03, 0x05, 0xc1, 0x19, 0x63, 0x0b, 0x0a, 0x18, 0x09, 0x18, 0x02,
+    0x01, 0x17, 0x00, 0x04, 0x08, 0x0d, 0x37, 0x03, 0x50, 0x11, 0x04, 0x06,
+    0x02, 0x17, 0x00, 0x05, 0x02, 0x39, 0x0f, 0x08, 0x04, 0x05, 0x02, 0x03,
+    0x11, 0x01, 0x0b, 0x10, 0x0a, 0x00, 0x09, 0x02, 0x01, 0x0c, 0x0f, 0x02,
+    0x0d, 0x06, 0x31, 0x0e, 0x03, 0x0b, 0x12, 0x09, 0x07, 0x03, 0xf0, 0x0a,
+    0x24, 0x08, 0x09, 0x1a, 0x03, 0x02, 0x0c, 0x00, 0x0e, 0x01, 0x0a, 0x04,
+    0x0b, 0x03, 0x0a, 0x16, 0x0b, 0x1e, 0x04, 0x01, 0x0d, 0x02, 0x3c, 0x0a,
+    0x0f, 0xf0, 0x09, 0x16, 0x0e, 0x0c, 0x05, 0x19, 0x13, 0x27, 0x02, 0x01,
+    0x0c, 0x18, 0x07, 0x01, 0x09, 0x06, 0x0a, 0x0c, 0x0b, 0x16, 0x0c, 0x1e,
+    0x04, 0xe0, 0x02, 0x0c, 0x00, 0x0d, 0x01, 0x0e, 0x0d, 0x0d, 0x0c, 0x0b,
+    0x04, 0x09, 0x01, 0x0a, 0x05, 0x0f, 0x0f, 0x0e, 0x03, 0x09, 0x01, 0x08,
+    0x00, 0x09, 0x02, 0x1b, 0x05, 0x02, 0x11, 0x08, 0x04, 0x0b, 0x0f, 0x02,
+    0x09, 0x07, 0x21, 0x0b, 0x03, 0x1a, 0x11, 0x10, 0x0e, 0x00, 0x1c, 0x02,
+    0x01, 0x0f, 0x02, 0x0d, 0x05, 0x01, 0x0a, 0x01, 0x80, 0x0b, 0x00, 0x08,
+    0x04, 0x1a, 0x0f, 0x0d, 0x19, 0x07, 0x05, 0x28, 0x03, 0x02, 0x10, 0x01,
+    0x06, 0x02, 0x05, 0x12, 0x04, 0x34, 0x16, 0x0f, 0x0b, 0x03, 0x02, 0x02,
+    0x13, 0x10, 0x11, 0x64, 0x04, 0x42, 0x1f, 0x09, 0x07, 0x05, 0x01, 0x02,
+    0x20, 0x05, 0x00, 0x04, 0x02, 0x05, 0x03, 0x11, 0x06, 0x0f, 0x0a, 0x0c,
+    0xd0, 0x0f, 0x01, 0x0d, 0x04, 0x0e, 0x09, 0x0c, 0x06, 0x1a, 0x07, 0x06,
+    0x0b, 0x14, 0x0a, 0x29, 0x15, 0x03, 0x0a, 0x02, 0x09, 0x00, 0x0d, 0x03,
+    0x11, 0x0b, 0x0f, 0x0c, 0x05, 0x30, 0x0a, 0x02, 0x07, 0x30, 0x05, 0x06,
+    0x11, 0x07, 0x0c, 0x04, 0x03, 0x0e, 0x0f, 0x06, 0x1c, 0x07, 0x03, 0x03,
+    0x02, 0x0b, 0x11, 0x01, 0x0e, 0x10, 0x0a, 0x00, 0x08, 0x01, 0x01, 0x0e,
+    0x0f, 0x12, 0x0d, 0x06, 0x09, 0x33, 0x01, 0x0b, 0x90, 0x0e, 0x0a, 0x09,
+    0x34, 0x08, 0x19, 0x18, 0x03, 0x01, 0x09, 0x00, 0x0d, 0x01, 0x01, 0x0a,
+    0x00, 0x22, 0x09, 0x03, 0x0b, 0x0f, 0x0a, 0x06, 0x01, 0x1b, 0x01, 0xf0,
+    0x00, 0x07, 0x03, 0x0a, 0x1f, 0x0c, 0x0d, 0x0a, 0x0c, 0x09, 0x0b, 0x06,
+    0x1a, 0x03, 0x02, 0x0b, 0x01, 0x0d, 0x00, 0x0c, 0x05, 0x0e, 0x08, 0x0b,
+    0x01, 0x09, 0x04, 0x0a, 0x0f, 0x50, 0x1b, 0x09, 0x07, 0x1c, 0x04, 0x01,
+    0x1a, 0x00, 0x03, 0x61, 0x08, 0x0e, 0x09, 0x05, 0x08, 0x02, 0x17, 0x00,
+    0x03, 0x09, 0x0e, 0x0a, 0x05, 0x50, 0x0d, 0x02, 0x0c, 0x10, 0x08, 0x06,
+    0x04, 0x08, 0x05, 0x0a, 0x04, 0x01, 0x19, 0x0f, 0x02, 0x0a, 0x51, 0x0b,
+    0x04, 0x09, 0x02, 0x17, 0x01, 0x00, 0x06, 0x02, 0x17, 0x0f, 0x02, 0x04,
+    0x01, 0x09, 0x00, 0xa0, 0x2f, 0x01, 0x08, 0x09, 0x0d, 0x06, 0x1e, 0x14,
+    0x0a, 0x03, 0x19, 0x02, 0x01, 0x08, 0x00, 0x1b, 0x01, 0x01, 0x02, 0x02,
+    0x0d, 0x1f, 0x03, 0x0a, 0x02, 0x07, 0x03, 0x01, 0x06, 0x01, 0x20, 0x05,
+    0x00, 0x04, 0x02, 0x26, 0x1f, 0x01, 0x02, 0x0c, 0x01, 0x08, 0x08, 0xf0,
+    0x0c, 0x03, 0x0a, 0x10, 0x08, 0x09, 0x04, 0x1a, 0x03, 0x0c, 0x0c, 0x0f,
+    0x1b, 0x01, 0x02, 0x0f, 0x28, 0x0e, 0x0c, 0x0d, 0x06, 0x0b, 0x04, 0x29,
+    0x15, 0x30, 0x04, 0x0a, 0x03, 0x08, 0x02, 0x07, 0x00, 0x01, 0x05, 0x03,
+    0x03, 0x04, 0x0f, 0x05, 0x03, 0x0c, 0x03, 0x22, 0x07, 0x01, 0x02, 0x10,
+    0x10, 0x11, 0x03, 0x07, 0x04, 0x02, 0x08, 0x07, 0x03, 0x0f, 0x0c, 0x44,
+    0x08, 0x07, 0x03, 0x05, 0x01, 0x04, 0x10, 0x03, 0x01, 0x05, 0x01, 0x02,
+    0x16, 0x0f, 0x03, 0x08, 0x02, 0x07, 0x04, 0x01, 0x09, 0x03, 0xa0, 0x0c,
+    0x12, 0x2e, 0x03, 0x04, 0x0a, 0x15, 0x09, 0x08, 0x04, 0x07, 0x02, 0x16,
+    0x20, 0x07, 0x01, 0x08, 0x0b, 0x04, 0x29, 0x0f, 0x09, 0x03, 0x03, 0x01,
+    0x01, 0x07, 0x10, 0x00, 0x15, 0x61, 0x05, 0x07, 0x0f, 0x09, 0x0b, 0x1a,
+    0x07, 0x03, 0x0b, 0x12, 0x0a, 0xf0, 0x0e, 0x01, 0x0a, 0x00, 0x38, 0x05,
+    0x0f, 0x02, 0x03, 0x49, 0x0f, 0x0e, 0x07, 0x03, 0x00, 0x0a, 0x02, 0x1f,
+    0x0f, 0x0b, 0x0e, 0x04, 0x0d, 0x02, 0x10, 0x0a, 0x00, 0x19, 0x02, 0x01,
+    0x0f, 0x02, 0x07, 0x0a, 0x01, 0x06, 0x05, 0x40, 0x07, 0x01, 0x06, 0x00,
+    0x04, 0x02, 0x06, 0x06, 0x07, 0x04, 0x01, 0x06, 0x1f, 0x32, 0x37, 0x04,
+    0x02, 0x01, 0x01, 0x08, 0x00, 0xe0, 0x1e, 0x01, 0x0f, 0x1d, 0x03, 0x02,
+    0x0f, 0x09, 0x0e, 0x07, 0x0d, 0x15, 0x0b, 0x0a, 0x24, 0x0b, 0x09, 0x08,
+    0x03, 0x09, 0x02, 0x07, 0x10, 0x08, 0x01, 0x0a, 0x02, 0x02, 0x0b, 0x1f,
+    0x03, 0x09, 0x02, 0x0a, 0x03, 0x11, 0x09, 0x01, 0x15, 0x10, 0x10, 0x08,
+    0x04, 0x01, 0x09, 0x0f, 0x02, 0x08, 0x0a, 0x01, 0x0a, 0x06, 0xf0, 0x0e,
+    0x01, 0x0c, 0x00, 0x0f, 0x04, 0x0e, 0x05, 0x0b, 0x01, 0x1d, 0x05, 0x0f,
+    0x09, 0x12, 0x08, 0x09, 0x0a, 0x1a, 0x0e, 0x08, 0x1b, 0x06, 0x04, 0x0c,
+    0x05, 0x0a, 0x04, 0x40, 0x0b, 0x03, 0x2e, 0x02, 0x01, 0x00, 0x1b, 0x02,
+    0x01, 0x0f, 0x03, 0x06, 0x0c, 0x02, 0x04, 0x05, 0x11, 0x03, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x02, 0x21, 0x0f, 0x07, 0x06, 0x1d, 0x1f, 0x12,
+    0x0b, 0x04, 0x0f, 0xf1, 0x02, 0x0a, 0x01, 0x07, 0x00, 0x06, 0x01, 0x07,
+    0x1f, 0x09, 0x18, 0x06, 0x03, 0x06, 0x02, 0x05, 0x03, 0x04, 0x06, 0x03,
+    0x0d, 0x42, 0x1f, 0x09, 0x03, 0x21, 0x10, 0x11, 0x02, 0x04, 0x03, 0x1f,
+    0x0f, 0x07, 0x0c, 0x06, 0x03, 0x05, 0x35, 0x01, 0x02, 0x10, 0x10, 0x03,
+    0x01, 0x06, 0x1f, 0x52, 0x07, 0x06, 0x08, 0x25, 0x04, 0x03, 0x02, 0x04,
+    0x01, 0x01, 0x05, 0x00, 0xf0, 0x08, 0x03, 0x0d, 0x0b, 0x0e, 0x12, 0x0c,
+    0x0b, 0x1a, 0x0c, 0x0b, 0x04, 0x1a, 0x11, 0x1f, 0x0c, 0x0f, 0x0d, 0x08,
+    0x09, 0x04, 0x28, 0x02, 0x00, 0x02, 0x01, 0x07, 0x0f, 0x02, 0x28, 0x0b,
+    0x01, 0x05, 0x50, 0x02, 0x15, 0x10, 0x09, 0x13, 0x0d, 0x0f, 0x0a, 0x01,
+    0x0c, 0x0f, 0x12, 0x09, 0x05, 0x08, 0x03, 0x01, 0x0b, 0x02, 0xf0, 0x0e,
+    0x10, 0x1d, 0x14, 0x0b, 0x0e, 0x0f, 0x1f, 0x0d, 0x44, 0x0d, 0x09, 0x1a,
+    0x29, 0x05, 0x04, 0x02, 0x08, 0x10, 0x16, 0x11, 0x03, 0x09, 0x1f, 0x12,
+    0x0c, 0x0b, 0x04, 0x01, 0x09, 0x02, 0x20, 0x08, 0x10, 0x16, 0x03, 0x01,
+    0x17, 0x0f, 0x02, 0x0a, 0x01, 0x08, 0x04, 0xf0, 0x09, 0x01, 0x0a, 0x05,
+    0x0b, 0x0c, 0x0a, 0x04, 0x18, 0x01, 0x04, 0x09, 0x0e, 0x0b, 0x02, 0x0a,
+    0x01, 0x0e, 0x07, 0x1d, 0x0e, 0x17, 0x2b, 0x15, 0x09, 0x14, 0x30, 0x28,
+    0x03, 0x02, 0x09, 0x00, 0x01, 0x26, 0x02, 0x02, 0x0f, 0x03, 0x0a, 0x02,
+    0x04, 0x03, 0x01, 0x23, 0x10, 0x20, 0x05, 0x34, 0x0f, 0x01, 0x06, 0x02,
+    0x0c, 0x03, 0x0f, 0x06, 0x03, 0x04, 0x09, 0x02, 0x02, 0x0f, 0xf1, 0x01,
+    0x0c, 0x10, 0x08, 0x09, 0x09, 0x1b, 0x0f, 0x05, 0x0a, 0x02, 0x08, 0x01,
+    0x07, 0x02, 0x06, 0x04, 0x15, 0x05, 0x07, 0x04, 0x0c, 0x03, 0x07, 0x02,
+    0x03, 0x01, 0x10, 0x00, 0x01, 0x01, 0x02, 0x07, 0x03, 0x04, 0x1f, 0x0e,
+    0x06, 0x09, 0x05, 0x03, 0x04, 0x06, 0x01, 0x02, 0x05, 0x10, 0x10, 0x06,
+    0x05, 0x03, 0x01, 0x06, 0x1f, 0x02, 0x07, 0x21, 0x19, 0x07, 0x05, 0x08,
+    0x04, 0xf0, 0x0e, 0x02, 0x0d, 0x01, 0x09, 0x00, 0x08, 0x03, 0x0a, 0x0f,
+    0x0c, 0x04, 0x08, 0x02, 0x19, 0x06, 0x08, 0x18, 0x12, 0x0a, 0x0a, 0x0d,
+    0x0f, 0x0f, 0x07, 0x0e, 0x05, 0x0b, 0x03, 0x20, 0x09, 0x02, 0x08, 0x00,
+    0x09, 0x02, 0x01, 0x07, 0x0f, 0x02, 0x08, 0x0a, 0x21, 0x09, 0x03, 0x07,
+    0x01, 0x26, 0x10, 0x10, 0x13, 0x01, 0x05, 0x02, 0x04, 0x05, 0x05, 0x53,
+    0x0f, 0x07, 0x06, 0x06, 0x04, 0x04, 0x02, 0x03, 0x10, 0x02, 0x00, 0x04,
+    0x03, 0x01, 0x05, 0x1f, 0x12, 0x08, 0x1a, 0x05, 0x21, 0x12, 0x08, 0x07,
+    0x03, 0x70, 0x0c, 0x04, 0x19, 0x05, 0x06, 0x1a, 0x04, 0x02, 0x38, 0x10,
+    0x02, 0x01, 0x1f, 0x12, 0x09, 0x0e, 0x04, 0x01, 0x0d, 0x02, 0x20, 0x0b,
+    0x10, 0x08, 0x06, 0x03, 0x51, 0x05, 0x0f, 0x07, 0x05, 0x08, 0x01, 0x09,
+    0x03, 0x0c, 0x0c, 0x0a, 0x06, 0xf0, 0x0e, 0x02, 0x0c, 0x00, 0x0b, 0x02,
+    0x0f, 0x0a, 0x0e, 0x03, 0x0d, 0x01, 0x0e, 0x05, 0x0c, 0x0d, 0x0a, 0x09,
+    0x09, 0x0e, 0x08, 0x07, 0x07, 0x06, 0x36, 0x15, 0x04, 0x03, 0x10, 0x07,
+    0x01, 0x18, 0x02, 0x11, 0x0f, 0x0b, 0x06, 0x40, 0x0e, 0x10, 0x0c, 0x09,
+    0x11, 0x0c, 0x0d, 0x13, 0x21, 0x0a, 0x09, 0x05, 0x0b, 0x0f, 0x02, 0x09,
+    0x08, 0x71, 0x0b, 0x04, 0x0a, 0x02, 0x08, 0x10, 0x17, 0x09, 0x09, 0x0f,
+    0x0b, 0x05, 0x09, 0x03, 0x90, 0x0e, 0x02, 0x09, 0x03, 0x07, 0x06, 0x16,
+    0x09, 0x0e, 0x05, 0x0f, 0x04, 0x06, 0x13, 0x01, 0x00, 0x02, 0x01, 0x02,
+    0x03, 0x04, 0x04, 0x04, 0x1f, 0x08, 0x05, 0x06, 0x16, 0x04, 0x03, 0x01,
+    0x02, 0x05, 0x10, 0x01, 0x04, 0x10, 0x05, 0x03, 0x08, 0x1f, 0x21, 0x09,
+    0x18, 0x0a, 0x08, 0x50, 0x1c, 0x04, 0x02, 0x0b, 0x01, 0x09, 0x00, 0x08,
+    0x03, 0x0a, 0x0a, 0xb1, 0x09, 0x03, 0x0a, 0x00, 0x0e, 0x11, 0x0c, 0x2f,
+    0x00, 0x05, 0x0c, 0x0e, 0x05, 0x0c, 0x03, 0x2b, 0x02, 0x11, 0x10, 0x1f,
+    0x00, 0x01, 0x11, 0x0e, 0x0f, 0x1f, 0x0e, 0x40, 0x05, 0x0a, 0x02, 0x08,
+    0x10, 0x06, 0x05, 0x03, 0x01, 0x04, 0x04, 0x02, 0x03, 0x05, 0x05, 0x32,
+    0x0f, 0x0c, 0x0e, 0x07, 0x07, 0x04, 0x04, 0x03, 0x21, 0x01, 0x11, 0x00,
+    0x07, 0x05, 0x02, 0x0f, 0x0f, 0x24, 0x04, 0x0c, 0x01, 0x09, 0x10, 0x17,
+    0x13, 0x01, 0x04, 0x04, 0x02, 0x03, 0x05, 0x03, 0x02, 0x06, 0x05, 0x11,
+    0x07, 0x13, 0x16, 0x20, 0x01, 0x05, 0x00, 0x06, 0x01, 0x01, 0x08, 0x0e,
+    0x02, 0x29, 0x0f, 0x03, 0x04, 0x12, 0x01, 0x07, 0x10, 0x01, 0x16, 0x30,
+    0x02, 0x07, 0x0a, 0x08, 0x14, 0x19, 0x41, 0x0f, 0x0d, 0x09, 0x0a, 0x03,
+    0x09, 0x01, 0x07, 0x00, 0xf0, 0x09, 0x02, 0x0c, 0x0f, 0x0a, 0x06, 0x18,
+    0x02, 0x03, 0x0b, 0x0b, 0x0a, 0x0c, 0x09, 0x0e, 0x18, 0x06, 0x34, 0x09,
+    0x18, 0x07, 0x03, 0x08, 0x01, 0x09, 0x02, 0x60, 0x0b, 0x0f, 0x0d, 0x03,
+    0x0c, 0x01, 0x0d, 0x04, 0x1a, 0x02, 0x00, 0x0d, 0x02, 0x11, 0x08, 0x13,
+    0x07, 0x02, 0x06, 0x1f, 0x03, 0x05, 0x12, 0x06, 0x06, 0x05, 0x03, 0x41,
+    0x16, 0x10, 0x07, 0x08, 0x08, 0x0f, 0x0a, 0x07, 0xa0, 0x0c, 0x04, 0x19,
+    0x02, 0x03, 0x18, 0x05, 0x08, 0x37, 0x07, 0x05, 0x01, 0x00, 0x06, 0x11,
+    0x08, 0x01, 0x66, 0x02, 0x02, 0x1f, 0x04, 0x05, 0x04, 0x03, 0x01, 0x02,
+    0x10, 0x01, 0x00, 0x17, 0x01, 0x31, 0x09, 0x08, 0x0f, 0x09, 0x0c, 0x08,
+    0x08, 0x40, 0x2c, 0x04, 0x02, 0x01, 0x0a, 0x00, 0x09, 0x02, 0x61, 0x08,
+    0x0c, 0x09, 0x04, 0x18, 0x10, 0x06, 0x01, 0x08, 0x04, 0x0d, 0x0e, 0x42,
+    0x0b, 0x05, 0x0c, 0x02, 0x0e, 0x31, 0x0d, 0x09, 0x81, 0x0b, 0x19, 0x00,
+    0x01, 0x0c, 0x0e, 0x0b, 0x0b, 0x08, 0x05, 0x06, 0x02, 0x05, 0x10, 0x04,
+    0x00, 0x05, 0x02, 0x02, 0x13, 0x13, 0x03, 0x07, 0x12, 0x1f, 0x0a, 0x0f,
+    0x31, 0x08, 0x05, 0x04, 0x02, 0x10, 0x01, 0x02, 0x02, 0x1f, 0x06, 0x33,
+    0x1f, 0x03, 0x01, 0x09, 0x10, 0x05, 0x04, 0x04, 0x05, 0x01, 0x13, 0x56,
+    0x02, 0x13, 0x22, 0x12, 0x01, 0x01, 0x10, 0x07, 0x10, 0x05, 0x01, 0x08,
+    0x0b, 0x02, 0x09, 0x0f, 0x03, 0x2a, 0x05, 0x02, 0x02, 0x01, 0x01, 0x20,
+    0x08, 0x10, 0x06, 0x0b, 0x01, 0x11, 0x0c, 0x03, 0x0f, 0x0e, 0x12, 0x0c,
+    0x0d, 0x0a, 0x05, 0x11, 0x0b, 0x02, 0x09, 0x01, 0xf0, 0x0b, 0x00, 0x08,
+    0x02, 0x0c, 0x0f, 0x0f, 0x06, 0x1e, 0x11, 0x1f, 0x07, 0x0a, 0x0e, 0x08,
+    0x0d, 0x05, 0x0a, 0x34, 0x09, 0x08, 0x09, 0x08, 0x03, 0x19, 0x11, 0x80,
+    0x0b, 0x05, 0x0c, 0x04, 0x09, 0x0b, 0x08, 0x0a, 0x27, 0x02, 0x00, 0x02,
+    0x09, 0x03, 0x01, 0x17, 0x02, 0x22, 0x0d, 0x08, 0x0f, 0x19, 0x06, 0x51,
+    0x02, 0x08, 0x10, 0x17, 0x06, 0x19, 0x0e, 0x07, 0xb0, 0x0b, 0x04, 0x0a,
+    0x02, 0x0b, 0x03, 0x19, 0x05, 0x06, 0x1a, 0x04, 0x02, 0x09, 0x00, 0x1b,
+    0x02, 0x03, 0x0e, 0x10, 0x0f, 0x01, 0x1d, 0x09, 0x02, 0x0f, 0x03, 0x0b,
+    0x04, 0x02, 0x0a, 0x02, 0x01, 0x19, 0x01, 0x20, 0x00, 0x07, 0x01, 0x18,
+    0x07, 0x21, 0x0f, 0x0b, 0x0a, 0x09, 0x07, 0x40, 0x0c, 0x04, 0x0b, 0x02,
+    0x0e, 0x01, 0x0c, 0x00, 0x0b, 0x02, 0x11, 0x18, 0x0f, 0x08, 0x20, 0x07,
+    0x01, 0x05, 0x00, 0x04, 0x04, 0x01, 0x26, 0x0f, 0x13, 0x0d, 0x05, 0x22,
+    0x07, 0x02, 0x08, 0x31, 0x0a, 0x61, 0x0f, 0x0e, 0x0c, 0x00, 0x0a, 0x01,
+    0x08, 0x0e, 0x19, 0x0d, 0x06, 0x50, 0x0a, 0x02, 0x09, 0x10, 0x07, 0x05,
+    0x02, 0x07, 0x06, 0x08, 0x04, 0x01, 0x17, 0x1f, 0x22, 0x08, 0x03, 0x06,
+    0x10, 0x01, 0x25, 0x00, 0x02, 0x01, 0x1f, 0x02, 0x08, 0x03, 0x17, 0x05,
+    0x02, 0x03, 0x11, 0x18, 0x01, 0x02, 0x60, 0x0b, 0x04, 0x0a, 0x06, 0x1b,
+    0x25, 0x09, 0x08, 0x04, 0x06, 0x01, 0x01, 0x14, 0x10, 0x00, 0x02, 0x03,
+    0x0a, 0x04, 0x14, 0x0f, 0x09, 0x06, 0x06, 0x23, 0x03, 0x04, 0x01, 0x02,
+    0x10, 0x10, 0x14, 0x02, 0x01, 0x26, 0x1f, 0x03, 0x05, 0x06, 0x03, 0x07,
+    0x03, 0x02, 0x08, 0x02, 0x01, 0x07, 0x01, 0x10, 0x0a, 0x00, 0x08, 0x02,
+    0x11, 0x07, 0x0f, 0x08, 0x07, 0xe0, 0x0d, 0x11, 0x0e, 0x0a, 0x07, 0x1b,
+    0x0d, 0x09, 0x0a, 0x06, 0x29, 0x34, 0x0a, 0x19, 0x03, 0x01, 0x07, 0x00,
+    0x08, 0x04, 0x09, 0x0e, 0x11, 0x08, 0x0f, 0x09, 0x05, 0x50, 0x0a, 0x01,
+    0x08, 0x00, 0x16, 0x02, 0x05, 0x08, 0x04, 0x0b, 0x0e, 0x01, 0x0c, 0x0f,
+    0x02, 0x0a, 0x05, 0x21, 0x0c, 0x02, 0x1a, 0x10, 0xf0, 0x0e, 0x06, 0x1f,
+    0x0f, 0x07, 0x1c, 0x04, 0x02, 0x0e, 0x03, 0x0b, 0x14, 0x1e, 0x02, 0x0a,
+    0x01, 0x07, 0x03, 0x08, 0x09, 0x09, 0x04, 0x18, 0x10, 0x09, 0x09, 0x01,
+    0x0d, 0x0f, 0x03, 0x0c, 0x05, 0x02, 0x0b, 0x03, 0x01, 0x0a, 0x01, 0x10,
+    0x0b, 0x10, 0x07, 0x01, 0x26, 0x05, 0x92, 0x0f, 0x0b, 0x25, 0x05, 0x03,
+    0x02, 0x24, 0x01, 0x00, 0x02, 0x05, 0x0f, 0x14, 0x05, 0x21, 0x10, 0x33,
+    0x0c, 0x03, 0x0f, 0x07, 0x07, 0x1a, 0xd2, 0x03, 0x41, 0x0c, 0x18, 0x09,
+    0x08, 0x10, 0x06, 0x17, 0x09, 0x0b, 0x06, 0x05, 0x04, 0x02, 0x13, 0x10,
+    0xc1, 0x03, 0x02, 0x04, 0x06, 0x05, 0x04, 0x07, 0x0e, 0x08, 0x0f, 0x09,
+    0x02, 0x17, 0x00, 0x01, 0x18, 0x02, 0x0a, 0x0a, 0x0f, 0x0c, 0x05, 0x09,
+    0x04, 0xa0, 0x0b, 0x02, 0x0a, 0x03, 0x08, 0x06, 0x07, 0x0a, 0x06, 0x08,
+    0x45, 0x0a, 0x09, 0x05, 0x02, 0x10, 0x04, 0x01, 0x03, 0x07, 0x04, 0x34,
+    0x0f, 0x0c, 0x0a, 0x04, 0x08, 0x01, 0x03, 0x20, 0x03, 0x10, 0x12, 0x06,
+    0x03, 0x03, 0x0f, 0x0b, 0x04, 0x0a, 0x06, 0x05, 0x04, 0x04, 0x26, 0x02,
+    0x03, 0x11, 0x02, 0x31, 0x15, 0x00, 0x02, 0x07, 0x0f, 0x08, 0x07, 0xd0,
+    0x0c, 0x02, 0x09, 0x01, 0x08, 0x05, 0x0a, 0x0e, 0x09, 0x0c, 0x08, 0x0a,
+    0x06, 0x28, 0x35, 0x07, 0x05, 0x24, 0x01, 0x00, 0x07, 0x02, 0x25, 0x0f,
+    0x06, 0x06, 0x04, 0x02, 0x03, 0x14, 0x10, 0x02, 0x30, 0x05, 0x01, 0x08,
+    0x05, 0x09, 0x04, 0x0e, 0x09, 0x01, 0x0a, 0x0f, 0x12, 0x08, 0x05, 0x07,
+    0x03, 0x01, 0x08, 0x01, 0xf0, 0x0b, 0x00, 0x0c, 0x05, 0x1e, 0x0f, 0x08,
+    0x1b, 0x05, 0x13, 0x0a, 0x0b, 0x04, 0x19, 0x03, 0x01, 0x07, 0x02, 0x1a,
+    0x0e, 0x0b, 0x09, 0x03, 0x08, 0x10, 0x06, 0x00, 0x35, 0x08, 0x02, 0x0f,
+    0x07, 0x07, 0x04, 0x04, 0x02, 0x16, 0x01, 0x01, 0x10, 0x10, 0x07, 0x0b,
+    0x04, 0x61, 0x09, 0x0d, 0x0a, 0x09, 0x29, 0x05, 0x03, 0x02, 0x18, 0x01,
+    0x00, 0x40, 0x1f, 0x02, 0x09, 0x0e, 0x02, 0x0a, 0x00, 0x08, 0x01, 0xa1,
+    0x07, 0x09, 0x09, 0x0f, 0x1b, 0x07, 0x04, 0x0a, 0x42, 0x0b, 0x09, 0x0b,
+    0x0d, 0x18, 0x10, 0x42, 0x17, 0x08, 0x0a, 0x16, 0x03, 0x01, 0x15, 0x10,
+    0x01, 0x90, 0x16, 0x02, 0x09, 0x07, 0x06, 0x08, 0x0a, 0x29, 0x0b, 0x03,
+    0x15, 0x2a, 0x02, 0x07, 0x11, 0x07, 0x0f, 0x08, 0x08, 0xc0, 0x0a, 0x05,
+    0x18, 0x03, 0x04, 0x17, 0x06, 0x08, 0x06, 0x09, 0x25, 0x0b, 0x09, 0x06,
+    0x14, 0x03, 0x10, 0x05, 0x44, 0x07, 0x03, 0x0f, 0x0f, 0x0c, 0x04, 0x07,
+    0x01, 0x02, 0x10, 0x03, 0x00, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x04, 0x13,
+    0x0f, 0x0b, 0x08, 0x16, 0x14, 0x03, 0x02, 0x03, 0x05, 0x11, 0x02, 0x06,
+    0x31, 0x37, 0x00, 0x02, 0x0f, 0x09, 0xb0, 0x09, 0x03, 0x08, 0x01, 0x17,
+    0x04, 0x1f, 0x08, 0x07, 0x0c, 0x06, 0x0a, 0x25, 0x19, 0x08, 0x04, 0x04,
+    0x03, 0x10, 0x01, 0x12, 0x03, 0x1f, 0x07, 0x13, 0x0c, 0x04, 0x0a, 0x02,
+    0x01, 0x0e, 0xf1, 0x10, 0x06, 0x03, 0x01, 0x04, 0x05, 0x06, 0x04, 0x07,
+    0x06, 0x09, 0x0f, 0x1c, 0x07, 0x03, 0x09, 0x01, 0x06, 0x00, 0x05, 0x04,
+    0x07, 0x0c, 0x28, 0x06, 0x04, 0x02, 0x09, 0x51, 0x11, 0x0e, 0x1b, 0x10,
+    0x0c, 0x05, 0x0a, 0x0d, 0x05, 0x42, 0x05, 0x04, 0x02, 0x03, 0x10, 0x02,
+    0x01, 0x05, 0x03, 0x04, 0x0f, 0x0a, 0x15, 0x07, 0x05, 0x04, 0x02, 0x16,
+    0x01, 0x01, 0x10, 0xf0, 0x08, 0x0b, 0x04, 0x0e, 0x1f, 0x0f, 0x0e, 0x08,
+    0x0c, 0x05, 0x0b, 0x03, 0x0d, 0x02, 0x0c, 0x00, 0x1f, 0x01, 0x04, 0x0e,
+    0x02, 0x0a, 0x13, 0x1b, 0x05, 0x2e, 0x0f, 0xf0, 0x0a, 0x06, 0x0d, 0x14,
+    0x0b, 0x0a, 0x05, 0x09, 0x04, 0x0a, 0x03, 0x08, 0x11, 0x09, 0x1f, 0x0d,
+    0x0f, 0x0e, 0x06, 0x09, 0x03, 0x07, 0x01, 0x06, 0x00, 0x08, 0x01, 0xf0,
+    0x0a, 0x06, 0x0b, 0x04, 0x0a, 0x03, 0x1b, 0x05, 0x0a, 0x0d, 0x0f, 0x0e,
+    0x04, 0x0b, 0x01, 0x0a, 0x05, 0x1e, 0x0f, 0x07, 0x0b, 0x05, 0x0a, 0x13,
+    0x1c, 0x04, 0x3a, 0x35, 0x70, 0x08, 0x04, 0x26, 0x02, 0x10, 0x04, 0x05,
+    0x02, 0x06, 0x0f, 0x08, 0x17, 0x07, 0x03, 0x03, 0x01, 0x06, 0x10, 0x20,
+    0x05, 0x04, 0x03, 0x06, 0x0b, 0x01, 0x07, 0x0f, 0x42, 0x38, 0x08, 0x04,
+    0x02, 0x11, 0x07, 0x51, 0x09, 0x00, 0x08, 0x01, 0x1a, 0x08, 0x06, 0x18,
+    0x02, 0x00, 0xa0, 0x0e, 0x02, 0x0a, 0x0b, 0x09, 0x0f, 0x08, 0x0e, 0x07,
+    0x09, 0x06, 0x0b, 0x35, 0x08, 0x04, 0x01, 0x00, 0x06, 0x02, 0x01, 0x07,
+    0x0f, 0x23, 0x08, 0x0d, 0x07, 0x03, 0x26, 0x01, 0x02, 0x10, 0x01, 0x30,
+    0x07, 0x01, 0x08, 0x06, 0x0a, 0x05, 0x0b, 0x04, 0x51, 0x09, 0x0f, 0x0b,
+    0x0c, 0x08, 0x04, 0x07, 0x01, 0x06, 0x00, 0x05, 0x04, 0x02, 0x04, 0x0f,
+    0x13, 0x23, 0x08, 0x04, 0x04, 0x02, 0x25, 0x92, 0x01, 0x10, 0x06, 0x04,
+    0x15, 0x0c, 0x09, 0x04, 0x07, 0x02, 0x04, 0x11, 0x01, 0x00, 0x00, 0x03,
+    0x04, 0x02, 0x05, 0x0f, 0x09, 0x06, 0x07, 0x04, 0x07, 0x03, 0x02, 0x08,
+    0x01, 0x01, 0x07, 0x10, 0xf0, 0x0a, 0x09, 0x03, 0x1c, 0x1f, 0x0e, 0x09,
+    0x0d, 0x06, 0x0b, 0x04, 0x0a, 0x02, 0x0c, 0x10, 0x0a, 0x3c, 0x03, 0x07,
+    0x0a, 0x02, 0x0d, 0x03, 0x29, 0x0d, 0xf0, 0x0e, 0x07, 0x1a, 0x25, 0x0b,
+    0x0a, 0x03, 0x0d, 0x02, 0x0e, 0x11, 0x1c, 0x0a, 0x1e, 0x0f, 0x06, 0x0a,
+    0x03, 0x18, 0x01, 0x00, 0x1a, 0x01, 0x20, 0x04, 0x1e, 0x02, 0x00, 0x01,
+    0x2a, 0x04, 0x02, 0x0e, 0x03, 0x05, 0x02, 0x0b, 0x01, 0x01, 0x2e, 0x00,
+    0xf0, 0x04, 0x0f, 0x0c, 0x08, 0x1b, 0x06, 0x04, 0x19, 0x03, 0x04, 0x08,
+    0x08, 0x06, 0x0a, 0x05, 0x0c, 0x04, 0x0f, 0x33, 0x0a, 0x05, 0x02, 0x00,
+    0x04, 0x04, 0x02, 0x15, 0x0f, 0x09, 0x06, 0x03, 0x06, 0x01, 0x01, 0x08,
+    0x00, 0x30, 0x0a, 0x01, 0x0e, 0x02, 0x0a, 0x06, 0x0b, 0x0e, 0x51, 0x19,
+    0x0a, 0x05, 0x2a, 0x03, 0x02, 0x01, 0x0b, 0x00, 0xe0, 0x2f, 0x01, 0x0e,
+    0x09, 0x0d, 0x03, 0x0c, 0x00, 0x0d, 0x01, 0x0b, 0x07, 0x3c, 0x0e, 0x09,
+    0x06, 0x05, 0x1a, 0x03, 0x01, 0x08, 0x00, 0x0a, 0x01, 0x01, 0x08, 0x02,
+    0x42, 0x07, 0x0c, 0x08, 0x0d, 0x17, 0x03, 0x01, 0x06, 0x10, 0x01, 0x07,
+    0x40, 0x29, 0x01, 0x06, 0x15, 0x0a, 0x0b, 0x0e, 0x21, 0x0a, 0x0c, 0x19,
+    0x03, 0x01, 0xf0, 0x0e, 0x00, 0x0a, 0x04, 0x0e, 0x0f, 0x0f, 0x0a, 0x0e,
+    0x06, 0x0d, 0x02, 0x0e, 0x10, 0x0f, 0x0d, 0x04, 0x1e, 0x0f, 0x0e, 0x0a,
+    0x08, 0x08, 0x05, 0x06, 0x03, 0x05, 0x01, 0x04, 0x00, 0x00, 0x03, 0x02,
+    0x04, 0x14, 0x0f, 0x0f, 0x06, 0x0c, 0x03, 0x03, 0x19, 0x02, 0x01, 0x21,
+    0x10, 0x06, 0x04, 0x03, 0x03, 0x42, 0x0c, 0x24, 0x0f, 0x0a, 0x08, 0x03,
+    0x05, 0x12, 0x33, 0x02, 0x10, 0x11, 0x07, 0x02, 0x04, 0x0f, 0x03, 0x15,
+    0x06, 0x02, 0x11, 0x01, 0x06, 0xf0, 0x0c, 0x06, 0x0e, 0x0b, 0x2b, 0x08,
+    0x06, 0x05, 0x0c, 0x04, 0x1b, 0x13, 0x09, 0x11, 0x0c, 0x0a, 0x09, 0x0c,
+    0x0f, 0x0e, 0x06, 0x0b, 0x03, 0x1a, 0x01, 0x10, 0x20, 0x0e, 0x1f, 0x02,
+    0x10, 0x01, 0x0b, 0x02, 0x09, 0x09, 0x13, 0x1a, 0x0f, 0x04, 0x02, 0x09,
+    0x01, 0x01, 0x0a, 0x00, 0xf0, 0x0b, 0x03, 0x1f, 0x0d, 0x09, 0x0d, 0x07,
+    0x0b, 0x04, 0x18, 0x03, 0x04, 0x19, 0x36, 0x07, 0x36, 0x05, 0x03, 0x02,
+    0x34, 0x00, 0x03, 0x02, 0x0f, 0x07, 0x02, 0x0a, 0x13, 0x00, 0x08, 0x11,
+    0x09, 0x02, 0x0c, 0x51, 0x00, 0x0a, 0x02, 0x19, 0x08, 0x0a, 0x08, 0x07,
+    0x07, 0x05, 0x0f, 0xf0, 0x04, 0x0e, 0x02, 0x0f, 0x00, 0x0e, 0x01, 0x0f,
+    0x0f, 0x0e, 0x0a, 0x0b, 0x04, 0x08, 0x11, 0x17, 0x07, 0x0a, 0x0f, 0x0d,
+    0x0c, 0x0b, 0x07, 0x0a, 0x04, 0x09, 0x01, 0x1c, 0x00, 0xf0, 0x03, 0x19,
+    0x05, 0x03, 0x0a, 0x0e, 0x1f, 0x0f, 0x06, 0x0a, 0x03, 0x08, 0x01, 0x09,
+    0x00, 0x0d, 0x01, 0x08, 0x04, 0x0c, 0x05, 0x0d, 0x04, 0x0e, 0x0c, 0x1f,
+    0x0f, 0x05, 0x0c, 0xe0, 0x02, 0x08, 0x00, 0x0c, 0x04, 0x0d, 0x0f, 0x0f,
+    0x0a, 0x0e, 0x05, 0x1c, 0x01, 0x00, 0x08, 0x02, 0x0e, 0x0f, 0x0d, 0x0e,
+    0x0c, 0x07, 0x0a, 0x15, 0x09, 0x06, 0x03, 0x03, 0x21, 0x02, 0x12, 0x00,
+    0x02, 0x05, 0x02, 0x0f, 0x0f, 0x03, 0x09, 0x0e, 0x12, 0x04, 0x08, 0x01,
+    0x0b, 0x01, 0x10, 0x0c, 0x90, 0x07, 0x02, 0x0a, 0x0b, 0x0d, 0x1f, 0x0f,
+    0x0b, 0x0b, 0x08, 0x06, 0x06, 0x03, 0x04, 0x10, 0x03, 0x06, 0x01, 0x0f,
+    0x09, 0x02, 0x0e, 0x06, 0x93, 0x03, 0x05, 0x10, 0x04, 0x63, 0x04, 0x0a,
+    0x08, 0x06, 0x04, 0x23, 0x02, 0x04, 0x01, 0x05, 0x02, 0xa0, 0x06, 0x01,
+    0x09, 0x08, 0x0c, 0x0f, 0x3e, 0x06, 0x03, 0x01, 0x10, 0x0c, 0x18, 0x01,
+    0x02, 0x1a, 0x04, 0x01, 0x1f, 0x12, 0x0b, 0x0a, 0x04, 0x11, 0x0c, 0x01,
+    0x08, 0x00, 0xf0, 0x0a, 0x03, 0x0e, 0x0f, 0x0f, 0x0b, 0x1d, 0x06, 0x13,
+    0x0b, 0x19, 0x04, 0x06, 0x18, 0x05, 0x06, 0x06, 0x07, 0x05, 0x08, 0x34,
+    0x05, 0x03, 0x00, 0x02, 0x00, 0x08, 0x0f, 0x41, 0x39, 0x05, 0x07, 0x05,
+    0x01, 0x08, 0x00, 0xf0, 0x0d, 0x02, 0x0b, 0x0a, 0x2c, 0x0f, 0x0c, 0x07,
+    0x1e, 0x04, 0x02, 0x0c, 0x00, 0x2f, 0x01, 0x0b, 0x09, 0x0c, 0x04, 0x09,
+    0x01, 0x08, 0x00, 0x1d, 0x05, 0x0f, 0xf0, 0x1f, 0x0a, 0x05, 0x0e, 0x02,
+    0x0a, 0x01, 0x07, 0x03, 0x08, 0x09, 0x29, 0x04, 0x02, 0x09, 0x0d, 0x0f,
+    0x0e, 0x06, 0x0a, 0x03, 0x0b, 0x01, 0x0e, 0x10, 0x1f, 0x03, 0x60, 0x0e,
+    0x06, 0x0d, 0x04, 0x0b, 0x08, 0x0d, 0x0f, 0x1e, 0x05, 0x02, 0x0b, 0x00,
+    0x31, 0x07, 0x03, 0x28, 0x0f, 0x06, 0x03, 0xb0, 0x3c, 0x00, 0x01, 0x08,
+    0x0f, 0x0d, 0x07, 0x0c, 0x05, 0x1a, 0x14, 0x07, 0x03, 0x06, 0x02, 0x15,
+    0x00, 0x01, 0x01, 0x17, 0x0f, 0x14, 0x0b, 0x36, 0x04, 0x03, 0x01, 0x02,
+    0x10, 0x01, 0x20, 0x07, 0x02, 0x08, 0x0d, 0x0b, 0x0f, 0x11, 0x08, 0x0e,
+    0x07, 0x09, 0x30, 0x08, 0x04, 0x06, 0x01, 0x15, 0x00, 0x02, 0x01, 0x07,
+    0x0f, 0x02, 0x0b, 0x0a, 0x01, 0x0e, 0x04, 0xb0, 0x0f, 0x01, 0x2a, 0x00,
+    0x04, 0x1f, 0x0e, 0x1c, 0x07, 0x24, 0x0d, 0x0a, 0x19, 0x03, 0x01, 0x0b,
+    0x00, 0x21, 0x18, 0x05, 0x0f, 0x07, 0x0a, 0x40, 0x08, 0x06, 0x06, 0x03,
+    0x15, 0x01, 0x00, 0x14, 0x01, 0x41, 0x0a, 0x05, 0x0d, 0x06, 0x0e, 0x08,
+    0x0f, 0x0b, 0x06, 0xf0, 0x0e, 0x02, 0x0b, 0x00, 0x0c, 0x03, 0x2f, 0x0f,
+    0x08, 0x05, 0x0e, 0x13, 0x0c, 0x0b, 0x04, 0x08, 0x16, 0x07, 0x06, 0x07,
+    0x25, 0x18, 0x06, 0x04, 0x04, 0x00, 0x03, 0x10, 0x01, 0x02, 0x04, 0x01,
+    0x07, 0x05, 0x22, 0x1f, 0x08, 0x09, 0x04, 0x0a, 0x01, 0x01, 0x0c, 0xf0,
+    0x00, 0x08, 0x01, 0x0e, 0x08, 0x0c, 0x1f, 0x0f, 0x0e, 0x08, 0x0c, 0x04,
+    0x0a, 0x02, 0x0b, 0x01, 0x08, 0x02, 0x07, 0x0f, 0x09, 0x0b, 0x0a, 0x04,
+    0x09, 0x01, 0x1b, 0x00, 0x04, 0x0d, 0xf0, 0x0f, 0x0f, 0x0a, 0x0d, 0x04,
+    0x19, 0x01, 0x02, 0x0c, 0x09, 0x0a, 0x08, 0x09, 0x03, 0x08, 0x01, 0x1b,
+    0x07, 0x0f, 0x1c, 0x06, 0x04, 0x0b, 0x02, 0x09, 0x10, 0x2e, 0xf0, 0x03,
+    0x07, 0x0c, 0x04, 0x09, 0x05, 0x1d, 0x0f, 0x07, 0x0a, 0x03, 0x09, 0x01,
+    0x08, 0x04, 0x1e, 0x0f, 0x06, 0x09, 0x02, 0x08, 0x01, 0x0b, 0x05, 0x0c,
+    0x09, 0x0d, 0x08, 0x1c, 0x70, 0x05, 0x24, 0x0a, 0x19, 0x03, 0x08, 0x02,
+    0x07, 0x10, 0x05, 0x08, 0x01, 0x1f, 0x1e, 0x22, 0x04, 0x09, 0x01, 0x0d,
+    0xc1, 0x10, 0x06, 0x14, 0x02, 0x0a, 0x06, 0x0f, 0x09, 0x0a, 0x08, 0x04,
+    0x07, 0x01, 0x15, 0x00, 0x01, 0x06, 0x03, 0x08, 0x0f, 0x0b, 0x0e, 0x0f,
+    0xf0, 0x04, 0x0c, 0x01, 0x0b, 0x00, 0x08, 0x03, 0x0d, 0x0f, 0x1f, 0x0d,
+    0x06, 0x0e, 0x05, 0x0a, 0x04, 0x2c, 0x03, 0x02, 0x11, 0x0b, 0x08, 0x07,
+    0x0c, 0x0f, 0x0f, 0x0a, 0x0a, 0x50, 0x06, 0x07, 0x02, 0x06, 0x10, 0x04,
+    0x03, 0x04, 0x08, 0x0f, 0x0a, 0xc1, 0x06, 0x08, 0x05, 0x19, 0x0b, 0x05,
+    0x08, 0x02, 0x06, 0x00, 0x07, 0x03, 0x18, 0x0f, 0x0a, 0x05, 0x08, 0x14,
+    0x15, 0x03, 0x08, 0x51, 0x52, 0x2d, 0x0e, 0x0f, 0x0a, 0x30, 0x13, 0x04,
+    0x10, 0x02, 0x03, 0x0c, 0x03, 0x05, 0x0f, 0x0b, 0x06, 0x06, 0x05, 0x07,
+    0x02, 0x02, 0x18, 0x10, 0x01, 0x20, 0x07, 0x01, 0x0a, 0x08, 0x0c, 0x0f,
+    0x21, 0x18, 0x0d, 0x06, 0x07, 0x04, 0xf0, 0x0a, 0x03, 0x18, 0x11, 0x19,
+    0x0c, 0x0f, 0x28, 0x05, 0x02, 0x00, 0x0c, 0x03, 0x0d, 0x0f, 0x1c, 0x07,
+    0x12, 0x0a, 0x2c, 0x08, 0x09, 0x03, 0x91, 0x08, 0x01, 0x07, 0x00, 0x08,
+    0x04, 0x39, 0x0a, 0x05, 0x03, 0x01, 0x07, 0x10, 0x06, 0x07, 0x03, 0xf0,
+    0x0b, 0x07, 0x0a, 0x14, 0x09, 0x0d, 0x0e, 0x0e, 0x08, 0x0d, 0x03, 0x0c,
+    0x01, 0x2a, 0x04, 0x0c, 0x03, 0x09, 0x02, 0x0a, 0x06, 0x09, 0x0c, 0x08,
+    0x09, 0x07, 0x0a, 0x16, 0x27, 0x60, 0x55, 0x08, 0x06, 0x03, 0x10, 0x01,
+    0x06, 0x1f, 0x02, 0x18, 0x03, 0x05, 0x02, 0x07, 0x02, 0x11, 0x08, 0x10,
+    0x07, 0x00, 0x08, 0x01, 0x21, 0x06, 0x07, 0x08, 0x0f, 0x09, 0x0b, 0xf0,
+    0x0c, 0x03, 0x0a, 0x01, 0x08, 0x03, 0x09, 0x04, 0x08, 0x03, 0x0a, 0x1f,
+    0x0e, 0x0a, 0x05, 0x18, 0x02, 0x00, 0x0a, 0x02, 0x1f, 0x0f, 0x0e, 0x0e,
+    0x07, 0x0c, 0x05, 0x0d, 0x04, 0x30, 0x0b, 0x03, 0x0a, 0x02, 0x1c, 0x01,
+    0x00, 0x11, 0x18, 0x05, 0x0e, 0x22, 0x06, 0x08, 0x04, 0x04, 0x43, 0x01,
+    0x01, 0x10, 0x00, 0x02, 0x06, 0x03, 0x0f, 0x05, 0x02, 0x05, 0x07, 0x31,
+    0x04, 0x26, 0x0c, 0x07, 0x03, 0x1a, 0xf0, 0x01, 0x04, 0x0b, 0x0f, 0x0e,
+    0x08, 0x0c, 0x07, 0x0a, 0x04, 0x09, 0x13, 0x08, 0x09, 0x15, 0x18, 0x07,
+    0x06, 0x0a, 0x05, 0x0f, 0x04, 0x09, 0x03, 0x04, 0x02, 0x10, 0x00, 0x01,
+    0x01, 0x03, 0x1f, 0x06, 0x05, 0x0d, 0x16, 0x05, 0x05, 0x02, 0x02, 0x07,
+    0x10, 0x01, 0x08, 0x20, 0x07, 0x01, 0x09, 0x08, 0x0c, 0x0f, 0x71, 0x0a,
+    0x0a, 0x09, 0x05, 0x18, 0x03, 0x02, 0x07, 0x10, 0x18, 0x05, 0x09, 0x09,
+    0xd0, 0x1f, 0x04, 0x02, 0x0d, 0x00, 0x0e, 0x02, 0x1b, 0x08, 0x04, 0x0a,
+    0x03, 0x09, 0x0b, 0x0a, 0x0f, 0x2b, 0x06, 0x03, 0x01, 0x0e, 0x00, 0x0f,
+    0x03, 0x11, 0x1c, 0x0a, 0x08, 0xf0, 0x0f, 0x04, 0x1e, 0x01, 0x10, 0x2f,
+    0x02, 0x06, 0x0d, 0x04, 0x0b, 0x03, 0x1e, 0x1b, 0x0d, 0x04, 0x0b, 0x01,
+    0x0a, 0x03, 0x28, 0x06, 0x03, 0x09, 0xb0, 0x19, 0x0f, 0x06, 0x0a, 0x34,
+    0x0b, 0x0d, 0x0b, 0x09, 0x05, 0x28, 0x06, 0x04, 0x02, 0x07, 0x10, 0x06,
+    0x01, 0x05, 0x0e, 0x03, 0x04, 0x0f, 0x07, 0x03, 0x05, 0x08, 0x02, 0x02,
+    0x19, 0xf1, 0x10, 0x05, 0x01, 0x06, 0x06, 0x38, 0x0c, 0x04, 0x01, 0x02,
+    0x09, 0x04, 0x0c, 0x01, 0x0d, 0x00, 0x1f, 0x04, 0x06, 0x0b, 0x02, 0x0e,
+    0x01, 0x09, 0x00, 0x06, 0xc1, 0x01, 0x09, 0x08, 0x08, 0x09, 0x09, 0x06,
+    0x18, 0x04, 0x03, 0x17, 0x02, 0x01, 0x09, 0x10, 0x0c, 0x08, 0x04, 0x0c,
+    0x0f, 0x0a, 0x07, 0x0e, 0xf0, 0x03, 0x08, 0x10, 0x06, 0x07, 0x02, 0x0a,
+    0x06, 0x0c, 0x0e, 0x1d, 0x05, 0x03, 0x0c, 0x08, 0x0e, 0x09, 0x0c, 0x04,
+    0x0a, 0x01, 0x1d, 0x03, 0x0e, 0x1e, 0x08, 0x06, 0x0c, 0xa0, 0x03, 0x0d,
+    0x02, 0x0e, 0x03, 0x09, 0x06, 0x06, 0x09, 0x25, 0x0a, 0x0c, 0x0d, 0x04,
+    0x06, 0x13, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x1f, 0x09, 0x03,
+    0x0e, 0x04, 0x04, 0x06, 0x05, 0x01, 0x03, 0x07, 0x10, 0x01, 0x18, 0x20,
+    0x01, 0x09, 0x08, 0x0c, 0x0f, 0xa1, 0x09, 0x08, 0x1a, 0x05, 0x03, 0x09,
+    0x02, 0x27, 0x10, 0x05, 0x08, 0x0b, 0x07, 0x05, 0x06, 0x03, 0x05, 0x10,
+    0x92, 0x04, 0x05, 0x12, 0x06, 0x07, 0x05, 0x18, 0x08, 0x04, 0x17, 0x02,
+    0x01, 0x16, 0x10, 0x61, 0x07, 0x04, 0x09, 0x0f, 0x0a, 0x06, 0x09, 0x03,
+    0x08, 0x01, 0x07, 0x10, 0x08, 0xb0, 0x0d, 0x02, 0x1b, 0x06, 0x05, 0x09,
+    0x03, 0x0b, 0x0a, 0x1c, 0x0f, 0x05, 0x09, 0x11, 0x08, 0x0a, 0x03, 0x0d,
+    0x06, 0x0f, 0x0e, 0x01, 0x0a, 0x08, 0xb0, 0x0c, 0x04, 0x0a, 0x03, 0x0b,
+    0x14, 0x1a, 0x05, 0x18, 0x06, 0x07, 0x37, 0x04, 0x02, 0x10, 0x08, 0x07,
+    0x01, 0x09, 0x0f, 0x12, 0x0b, 0x05, 0x0a, 0x02, 0x01, 0x1d, 0x01, 0xf0,
+    0x00, 0x0c, 0x01, 0x1a, 0x06, 0x0b, 0x19, 0x04, 0x05, 0x0b, 0x0f, 0x0a,
+    0x08, 0x09, 0x02, 0x08, 0x01, 0x09, 0x07, 0x2b, 0x0d, 0x05, 0x03, 0x0a,
+    0x11, 0x08, 0x80, 0x0b, 0x08, 0x0d, 0x0f, 0x0f, 0x09, 0x0c, 0x06, 0x19,
+    0x04, 0x03, 0x0a, 0x02, 0x0c, 0x01, 0x0e, 0x00, 0x21, 0x09, 0x04, 0x0c,
+    0x0d, 0x0a, 0x05, 0xf0, 0x0c, 0x01, 0x09, 0x00, 0x1a, 0x02, 0x03, 0x08,
+    0x04, 0x1a, 0x09, 0x06, 0x19, 0x03, 0x07, 0x0b, 0x0e, 0x0d, 0x05, 0x0b,
+    0x01, 0x0c, 0x03, 0x0a, 0x0f, 0x0d, 0x09, 0x0c, 0x06, 0xa0, 0x0a, 0x04,
+    0x18, 0x13, 0x09, 0x05, 0x18, 0x26, 0x09, 0x18, 0x04, 0x01, 0x07, 0x10,
+    0x16, 0x11, 0x01, 0x07, 0x08, 0x02, 0x09, 0x0f, 0x03, 0x0a, 0x05, 0x02,
+    0x1d, 0x02, 0x11, 0x10, 0x0a, 0xf0, 0x0b, 0x01, 0x0a, 0x06, 0x0c, 0x1f,
+    0x0f, 0x0e, 0x09, 0x0d, 0x04, 0x1e, 0x02, 0x10, 0x0f, 0x0e, 0x07, 0x0c,
+    0x0f, 0x0e, 0x07, 0x0a, 0x04, 0x08, 0x01, 0x05, 0x00, 0x06, 0x02, 0x00,
+    0x0a, 0x0b, 0x01, 0x09, 0x0f, 0x02, 0x08, 0x09, 0x71, 0x09, 0x04, 0x08,
+    0x02, 0x19, 0x01, 0x10, 0x0b, 0x08, 0x04, 0x1a, 0x0f, 0x07, 0xd0, 0x0f,
+    0x04, 0x0e, 0x02, 0x0a, 0x01, 0x08, 0x00, 0x0b, 0x02, 0x08, 0x16, 0x1a,
+    0x03, 0x0b, 0x08, 0x0c, 0x0f, 0x0e, 0x04, 0x0b, 0x10, 0x09, 0x1a, 0x05,
+    0x21, 0x0f, 0x0d, 0x0a, 0x0a, 0x05, 0xb0, 0x0e, 0x13, 0x0a, 0x29, 0x04,
+    0x25, 0x1b, 0x04, 0x0d, 0x03, 0x0b, 0x02, 0x09, 0x10, 0x08, 0x06, 0x05,
+    0x01, 0x08, 0x0f, 0x02, 0x09, 0x09, 0xa1, 0x0b, 0x03, 0x0a, 0x01, 0x27,
+    0x10, 0x02, 0x18, 0x03, 0x04, 0x09, 0x0e, 0x0b, 0x08, 0x0a, 0x03, 0x09,
+    0x01, 0x60, 0x0b, 0x00, 0x1f, 0x05, 0x0c, 0x0e, 0x06, 0x0c, 0x04, 0x09,
+    0x01, 0x08, 0x00, 0x21, 0x07, 0x04, 0x0a, 0x0d, 0x09, 0x09, 0xf0, 0x0c,
+    0x06, 0x19, 0x04, 0x13, 0x0a, 0x08, 0x02, 0x09, 0x01, 0x0a, 0x06, 0x0b,
+    0x0e, 0x0e, 0x02, 0x0f, 0x01, 0x0e, 0x13, 0x1c, 0x01, 0x1e, 0x02, 0x15,
+    0x0f, 0xf0, 0x0e, 0x02, 0x2f, 0x05, 0x0e, 0x05, 0x0d, 0x01, 0x1a, 0x03,
+    0x0f, 0x0e, 0x08, 0x2d, 0x05, 0x03, 0x12, 0x0e, 0x0f, 0x04, 0x0d, 0x05,
+    0x0e, 0x04, 0x0f, 0x03, 0x20, 0x2e, 0x01, 0x00, 0x11, 0x21, 0x38, 0x00,
+    0x04, 0x12, 0x0f, 0x0a, 0x09, 0xb1, 0x0b, 0x03, 0x08, 0x01, 0x17, 0x10,
+    0x49, 0x03, 0x0b, 0x0c, 0x06, 0x03, 0x08, 0x02, 0x06, 0x01, 0x24, 0x00,
+    0x12, 0x06, 0x0f, 0x03, 0x23, 0x08, 0x02, 0x05, 0x11, 0x01, 0x02, 0x00,
+    0x00, 0x03, 0x03, 0x02, 0x05, 0x0f, 0x04, 0x07, 0x07, 0x33, 0x09, 0x03,
+    0x18, 0x01, 0x30, 0x1a, 0x12, 0x07, 0x71, 0x09, 0x04, 0x3a, 0x0e, 0x05,
+    0x03, 0x01, 0x09, 0x10, 0x07, 0x05, 0x01, 0x32, 0x34, 0x05, 0x06, 0x03,
+    0x07, 0x21, 0x15, 0x0f, 0x04, 0x04, 0x00, 0x10, 0x05, 0x01, 0x0b, 0x0f,
+    0x71, 0x1f, 0x0e, 0x05, 0x1e, 0x02, 0x11, 0x0c, 0x2b, 0x02, 0x03, 0x05,
+    0x60, 0x1e, 0x14, 0x0b, 0x03, 0x0e, 0x02, 0x09, 0x10, 0x08, 0x06, 0x04,
+    0x01, 0x17, 0x0f, 0x12, 0x0d, 0x06, 0x05, 0x21, 0x07, 0x02, 0x16, 0x10,
+    0x10, 0x08, 0x01, 0x0a, 0x03, 0x51, 0x0b, 0x1f, 0x1f, 0x05, 0x0b, 0x02,
+    0x0a, 0x10, 0x09, 0x50, 0x0b, 0x05, 0x0e, 0x0f, 0x0f, 0x07, 0x0d, 0x04,
+    0x0a, 0x01, 0x08, 0x00, 0x21, 0x06, 0x04, 0x07, 0x0d, 0x09, 0x0a, 0xf0,
+    0x0b, 0x06, 0x0a, 0x14, 0x09, 0x08, 0x03, 0x09, 0x02, 0x0b, 0x01, 0x0a,
+    0x04, 0x0b, 0x08, 0x28, 0x03, 0x07, 0x09, 0x17, 0x03, 0x01, 0x18, 0x02,
+    0x05, 0x2c, 0x06, 0xf0, 0x03, 0x05, 0x0e, 0x0f, 0x2d, 0x05, 0x01, 0x03,
+    0x0a, 0x0f, 0x0c, 0x08, 0x1b, 0x05, 0x04, 0x58, 0x03, 0x04, 0x06, 0x07,
+    0x05, 0x02, 0x50, 0x09, 0x01, 0x08, 0x03, 0x19, 0x06, 0x02, 0x08, 0x00,
+    0x0c, 0x03, 0x51, 0x0a, 0x0f, 0x0c, 0x09, 0x1d, 0x03, 0x01, 0x0a, 0x10,
+    0x08, 0x70, 0x0e, 0x03, 0x2f, 0x1f, 0x09, 0x0c, 0x05, 0x09, 0x03, 0x08,
+    0x01, 0x09, 0x00, 0x21, 0x07, 0x05, 0x28, 0x0f, 0x08, 0x30, 0x03, 0x06,
+    0x10, 0x04, 0x06, 0x07, 0x01, 0x08, 0x0f, 0x03, 0x09, 0x06, 0x12, 0x0b,
+    0x03, 0x09, 0x02, 0xa1, 0x0d, 0x21, 0x0e, 0x0a, 0x08, 0x00, 0x0a, 0x03,
+    0x0b, 0x0a, 0x1c, 0x05, 0x03, 0x0b, 0x01, 0x09, 0x10, 0x07, 0x80, 0x09,
+    0x01, 0x0c, 0x06, 0x0a, 0x0b, 0x09, 0x15, 0x08, 0x19, 0x08, 0x02, 0x08,
+    0x00, 0x07, 0x03, 0x01, 0x0a, 0x0f, 0x22, 0x0c, 0x06, 0x0a, 0x03, 0x08,
+    0x02, 0x91, 0x1a, 0x11, 0x0c, 0x02, 0x1e, 0x13, 0x0b, 0x22, 0x1e, 0x0b,
+    0x01, 0x18, 0x10, 0x20, 0x06, 0x04, 0x09, 0x1f, 0x11, 0x2c, 0x08, 0x30,
+    0x03, 0x08, 0x01, 0x05, 0x00, 0x34, 0x01, 0x01, 0x09, 0x04, 0x0f, 0x17,
+    0x07, 0x13, 0x03, 0x05, 0x01, 0x07, 0x02, 0x10, 0x08, 0x41, 0x06, 0x04,
+    0x08, 0x0e, 0x09, 0x06, 0x08, 0x03, 0x0e, 0xf0, 0x01, 0x0b, 0x00, 0x1c,
+    0x03, 0x0f, 0x0e, 0x0a, 0x0d, 0x06, 0x1c, 0x14, 0x09, 0x03, 0x1b, 0x02,
+    0x00, 0x0f, 0x02, 0x0a, 0x05, 0x09, 0x08, 0x0c, 0x0f, 0x2f, 0x04, 0xf0,
+    0x01, 0x00, 0x0c, 0x01, 0x0b, 0x04, 0x0e, 0x08, 0x0c, 0x14, 0x0b, 0x0d,
+    0x0d, 0x0a, 0x08, 0x18, 0x02, 0x03, 0x09, 0x0f, 0x2a, 0x08, 0x05, 0x04,
+    0x09, 0x13, 0x0a, 0xb0, 0x0e, 0x15, 0x0b, 0x0a, 0x03, 0x28, 0x01, 0x03,
+    0x0c, 0x29, 0x06, 0x01, 0x00, 0x08, 0x03, 0x0c, 0x0d, 0x09, 0xf1, 0x0f,
+    0x0a, 0x05, 0x09, 0x02, 0x18, 0x10, 0x16, 0x03, 0x0e, 0x07, 0x0d, 0x18,
+    0x06, 0x03, 0x09, 0x01, 0x0d, 0x10, 0x0a, 0x07, 0x05, 0x18, 0x0d, 0x04,
+    0x06, 0xf1, 0x01, 0x14, 0x00, 0x01, 0x06, 0x05, 0x09, 0x0f, 0x0f, 0x08,
+    0x0c, 0x04, 0x0a, 0x02, 0x0c, 0x21, 0x0f, 0x0e, 0x19, 0x00, 0x03, 0x08,
+    0x0e, 0x0a, 0x07, 0x08, 0x04, 0x07, 0xf1, 0x02, 0x05, 0x01, 0x04, 0x00,
+    0x05, 0x01, 0x06, 0x04, 0x08, 0x07, 0x09, 0x02, 0x0e, 0x01, 0x0b, 0x02,
+    0x08, 0x11, 0x09, 0x0c, 0x04, 0x0e, 0x0f, 0x0d, 0x06, 0x0c, 0x03, 0x0b,
+    0x12, 0x09, 0x01, 0x0d, 0xb0, 0x03, 0x1b, 0x05, 0x06, 0x1a, 0x25, 0x49,
+    0x04, 0x02, 0x10, 0x06, 0x03, 0x0b, 0x0e, 0x0a, 0x21, 0x0f, 0x0f, 0x06,
+    0x09, 0x02, 0x0a, 0x20, 0x10, 0x05, 0x03, 0x03, 0x05, 0x01, 0x1f, 0x0e,
+    0x32, 0x0d, 0x05, 0x0b, 0x02, 0x09, 0x01, 0x0c, 0x61, 0x10, 0x08, 0x06,
+    0x05, 0x07, 0x0e, 0x09, 0x05, 0x08, 0x03, 0x07, 0x01, 0x0f, 0xa0, 0x00,
+    0x0b, 0x02, 0x0a, 0x1e, 0x0d, 0x4b, 0x07, 0x05, 0x04, 0x03, 0x02, 0x08,
+    0x10, 0x07, 0x08, 0x31, 0x06, 0x0d, 0x0f, 0x0e, 0x0b, 0x08, 0x03, 0x0e,
+    0xf0, 0x01, 0x1a, 0x00, 0x01, 0x09, 0x05, 0x0a, 0x0e, 0x2b, 0x05, 0x03,
+    0x07, 0x0d, 0x09, 0x19, 0x12, 0x1e, 0x0a, 0x07, 0x0d, 0x05, 0x1b, 0x04,
+    0x13, 0x0c, 0xb0, 0x0f, 0x04, 0x0c, 0x03, 0x0b, 0x01, 0x2a, 0x02, 0x0a,
+    0x0f, 0x08, 0x05, 0x27, 0x01, 0x00, 0x02, 0x0e, 0x08, 0x0a, 0xf1, 0x0f,
+    0x0e, 0x06, 0x0b, 0x02, 0x18, 0x10, 0x06, 0x02, 0x07, 0x07, 0x0a, 0x08,
+    0x0c, 0x05, 0x0b, 0x03, 0x09, 0x02, 0x08, 0x01, 0x06, 0x00, 0x08, 0x03,
+    0x1d, 0x05, 0x01, 0x1a, 0xe1, 0x00, 0x11, 0x0d, 0x0a, 0x02, 0x0b, 0x09,
+    0x1c, 0x07, 0x04, 0x0a, 0x03, 0x08, 0x12, 0x0b, 0x08, 0x01, 0x09, 0x00,
+    0x07, 0x03, 0x08, 0x0f, 0x09, 0x09, 0x0d, 0xf0, 0x05, 0x0b, 0x02, 0x0a,
+    0x01, 0x08, 0x00, 0x0b, 0x01, 0x0c, 0x06, 0x0b, 0x0f, 0x0a, 0x05, 0x07,
+    0x01, 0x08, 0x02, 0x09, 0x09, 0x1a, 0x06, 0x05, 0x0d, 0x0f, 0x0f, 0x08,
+    0x0d, 0x05, 0x0a, 0xd0, 0x04, 0x08, 0x03, 0x19, 0x04, 0x35, 0x3a, 0x04,
+    0x1c, 0x03, 0x02, 0x09, 0x10, 0x0a, 0x07, 0x03, 0x0a, 0x0b, 0x09, 0xe1,
+    0x0f, 0x0f, 0x06, 0x08, 0x01, 0x05, 0x10, 0x02, 0x04, 0x05, 0x07, 0x1f,
+    0x0f, 0x0e, 0x06, 0x0c, 0x03, 0x0a, 0x01, 0x1b, 0x10, 0x17, 0x05, 0x0f,
+    0x0e, 0xc0, 0x07, 0x0c, 0x04, 0x0d, 0x02, 0x09, 0x00, 0x0b, 0x01, 0x0c,
+    0x0a, 0x0d, 0x0f, 0x0b, 0x0d, 0x08, 0x09, 0x07, 0x07, 0x06, 0x05, 0x15,
+    0x02, 0x00, 0x02, 0x01, 0x01, 0x05, 0x22, 0x0f, 0x0e, 0x0e, 0x09, 0x05,
+    0x0b, 0x01, 0x02, 0x0f, 0xf0, 0x01, 0x19, 0x00, 0x01, 0x08, 0x06, 0x09,
+    0x0f, 0x0b, 0x06, 0x09, 0x03, 0x08, 0x07, 0x0a, 0x09, 0x0b, 0x12, 0x0a,
+    0x0c, 0x0a, 0x0d, 0x07, 0x1e, 0x05, 0x04, 0x0d, 0x23, 0x0e, 0xb0, 0x0c,
+    0x0a, 0x12, 0x07, 0x08, 0x08, 0x0b, 0x0f, 0x0a, 0x08, 0x08, 0x04, 0x07,
+    0x01, 0x06, 0x00, 0x07, 0x02, 0x0c, 0x07, 0x0a, 0xf1, 0x0f, 0x0f, 0x06,
+    0x0d, 0x01, 0x0f, 0x10, 0x0a, 0x06, 0x01, 0x09, 0x05, 0x1b, 0x08, 0x06,
+    0x09, 0x04, 0x08, 0x02, 0x09, 0x01, 0x08, 0x00, 0x17, 0x13, 0x19, 0x01,
+    0xf1, 0x03, 0x0a, 0x04, 0x08, 0x11, 0x07, 0x08, 0x06, 0x0a, 0x07, 0x0c,
+    0x04, 0x1b, 0x13, 0x18, 0x02, 0x01, 0x07, 0x00, 0x08, 0x02, 0x1c, 0x0a,
+    0x05, 0x0a, 0x03, 0x19, 0xf1, 0x01, 0x10, 0x0a, 0x16, 0x01, 0x04, 0x17,
+    0x07, 0x02, 0x06, 0x00, 0x05, 0x03, 0x08, 0x0f, 0x0d, 0x03, 0x2a, 0x02,
+    0x07, 0x05, 0x19, 0x03, 0x32, 0x0b, 0xf1, 0x09, 0x0b, 0x0d, 0x23, 0x09,
+    0x0b, 0x09, 0x12, 0x0b, 0x18, 0x01, 0x10, 0x06, 0x05, 0x02, 0x18, 0x08,
+    0x0f, 0x0a, 0x04, 0x09, 0x10, 0x06, 0xf1, 0x05, 0x01, 0x08, 0x03, 0x0b,
+    0x09, 0x0c, 0x0e, 0x0a, 0x07, 0x08, 0x04, 0x27, 0x02, 0x01, 0x00, 0x08,
+    0x03, 0x2a, 0x08, 0x05, 0x03, 0x09, 0x01, 0x08, 0x10, 0x05, 0x71, 0x27,
+    0x06, 0x0f, 0x1b, 0x06, 0x04, 0x07, 0x13, 0x03, 0x01, 0x11, 0x02, 0x00,
+    0x23, 0x04, 0x04, 0x0f, 0x0b, 0x06, 0x0c, 0x12, 0x03, 0x08, 0x01, 0x0b,
+    0xf1, 0x10, 0x08, 0x15, 0x01, 0x05, 0x26, 0x0d, 0x05, 0x02, 0x07, 0x03,
+    0x0a, 0x05, 0x29, 0x11, 0x16, 0x0a, 0x18, 0x04, 0x03, 0x19, 0x02, 0xf1,
+    0x01, 0x0a, 0x10, 0x0b, 0x0d, 0x04, 0x0a, 0x0b, 0x08, 0x06, 0x07, 0x04,
+    0x26, 0x02, 0x10, 0x04, 0x02, 0x07, 0x06, 0x09, 0x0f, 0x0c, 0x07, 0x1a,
+    0x02, 0x01, 0x16, 0xf1, 0x00, 0x01, 0x27, 0x06, 0x0e, 0x0b, 0x16, 0x06,
+    0x04, 0x35, 0x02, 0x00, 0x02, 0x03, 0x06, 0x05, 0x08, 0x09, 0x19, 0x03,
+    0x10, 0x0b, 0x08, 0xf1, 0x04, 0x09, 0x08, 0x0a, 0x05, 0x0b, 0x04, 0x0a,
+    0x03, 0x09, 0x02, 0x17, 0x01, 0x00, 0x08, 0x02, 0x2a, 0x0a, 0x05, 0x03,
+    0x09, 0x01, 0x0b, 0x20, 0x0c, 0x07, 0x0b, 0xf1, 0x02, 0x0d, 0x03, 0x0b,
+    0x10, 0x0e, 0x0d, 0x05, 0x1e, 0x0e, 0x02, 0x0c, 0x01, 0x0d, 0x05, 0x0e,
+    0x04, 0x0c, 0x13, 0x0a, 0x09, 0x22, 0x0b, 0x09, 0x0c, 0x13, 0x0a, 0xf1,
+    0x0b, 0x22, 0x0e, 0x0a, 0x08, 0x01, 0x0a, 0x10, 0x07, 0x05, 0x02, 0x09,
+    0x04, 0x0c, 0x06, 0x0d, 0x02, 0x0a, 0x00, 0x0e, 0x21, 0x0f, 0x0b, 0x0f,
+    0x05, 0x1d, 0xf1, 0x08, 0x05, 0x1c, 0x03, 0x02, 0x0a, 0x01, 0x09, 0x00,
+    0x17, 0x03, 0x0a, 0x18, 0x06, 0x03, 0x09, 0x01, 0x08, 0x10, 0x16, 0x04,
+    0x09, 0x0b, 0x2b, 0x07, 0x41, 0x04, 0x02, 0x08, 0x10, 0x06, 0x14, 0x01,
+    0x22, 0x05, 0x07, 0x0f, 0x0a, 0x07, 0x0c, 0x31, 0x03, 0x0b, 0x01, 0x0a,
+    0x10, 0x09, 0x0e, 0xf0, 0x01, 0x0b, 0x04, 0x0e, 0x0a, 0x0d, 0x06, 0x0e,
+    0x02, 0x0f, 0x03, 0x0e, 0x07, 0x0c, 0x12, 0x0e, 0x0b, 0x0b, 0x2d, 0x09,
+    0x06, 0x05, 0x0b, 0x03, 0x19, 0x11, 0x08, 0xf0, 0x05, 0x0a, 0x0f, 0x0f,
+    0x0a, 0x0d, 0x05, 0x0c, 0x03, 0x0e, 0x02, 0x0c, 0x10, 0x0e, 0x09, 0x03,
+    0x0b, 0x07, 0x0c, 0x1f, 0x0f, 0x0e, 0x04, 0x0b, 0x01, 0x0e, 0x00, 0x0b,
+    0x01, 0x0c, 0x50, 0x06, 0x0e, 0x0f, 0x0f, 0x0d, 0x0d, 0x09, 0x09, 0x05,
+    0x08, 0x02, 0x04, 0x71, 0x00, 0x03, 0x01, 0x04, 0x08, 0x06, 0x0f, 0x0b,
+    0x08, 0x19, 0x02, 0x10, 0x08, 0x0d, 0xf0, 0x04, 0x0e, 0x0f, 0x1f, 0x0b,
+    0x07, 0x0e, 0x04, 0x0c, 0x03, 0x09, 0x02, 0x0a, 0x01, 0x08, 0x03, 0x0a,
+    0x0f, 0x1e, 0x08, 0x05, 0x0b, 0x03, 0x0a, 0x02, 0x28, 0x11, 0xf0, 0x13,
+    0x07, 0x09, 0x04, 0x08, 0x06, 0x0a, 0x08, 0x0d, 0x0f, 0x0c, 0x03, 0x0d,
+    0x02, 0x0c, 0x09, 0x0d, 0x08, 0x1c, 0x06, 0x05, 0x0b, 0x13, 0x0d, 0x0a,
+    0x04, 0x1c, 0x15, 0xf0, 0x0a, 0x04, 0x0b, 0x23, 0x0e, 0x0b, 0x08, 0x01,
+    0x09, 0x00, 0x0e, 0x03, 0x1b, 0x14, 0x0d, 0x05, 0x1a, 0x07, 0x06, 0x18,
+    0x12, 0x09, 0x06, 0x1e, 0x60, 0x0f, 0x0b, 0x0c, 0x07, 0x1b, 0x04, 0x02,
+    0x0a, 0x00, 0x0e, 0x03, 0x07, 0xf1, 0x0b, 0x08, 0x05, 0x09, 0x03, 0x28,
+    0x01, 0x10, 0x06, 0x03, 0x19, 0x0f, 0x0d, 0x07, 0x06, 0x05, 0x02, 0x04,
+    0x00, 0x05, 0x01, 0x09, 0x02, 0x08, 0x04, 0x09, 0x0f, 0x0b, 0x81, 0x06,
+    0x1a, 0x03, 0x01, 0x0c, 0x20, 0x0e, 0x08, 0x1a, 0x02, 0x07, 0x08, 0x08,
+    0x0d, 0xf0, 0x03, 0x0a, 0x02, 0x0d, 0x06, 0x0b, 0x03, 0x09, 0x02, 0x0c,
+    0x0e, 0x0d, 0x0c, 0x0c, 0x07, 0x1a, 0x04, 0x01, 0x0c, 0x00, 0x0b, 0x03,
+    0x0a, 0x1f, 0x0e, 0x0b, 0x07, 0x0a, 0x05, 0x08, 0xf0, 0x04, 0x17, 0x03,
+    0x01, 0x08, 0x00, 0x0d, 0x03, 0x0e, 0x04, 0x2f, 0x0b, 0x0f, 0x04, 0x0e,
+    0x01, 0x0f, 0x00, 0x0b, 0x01, 0x09, 0x06, 0x0b, 0x1f, 0x0f, 0x0e, 0x0b,
+    0x09, 0x30, 0x05, 0x07, 0x02, 0x05, 0x00, 0x03, 0x02, 0x05, 0x01, 0x0f,
+    0x09, 0x12, 0x0b, 0x08, 0x04, 0x0e, 0x51, 0x01, 0x0d, 0x10, 0x08, 0x05,
+    0x03, 0x06, 0x1f, 0x08, 0x0f, 0xf0, 0x07, 0x0d, 0x04, 0x0c, 0x03, 0x1a,
+    0x02, 0x00, 0x0f, 0x02, 0x0e, 0x0f, 0x0d, 0x0a, 0x0b, 0x06, 0x0a, 0x04,
+    0x08, 0x02, 0x09, 0x01, 0x08, 0x10, 0x09, 0x2f, 0x03, 0x0f, 0xf0, 0x08,
+    0x0d, 0x04, 0x0c, 0x07, 0x0d, 0x03, 0x0b, 0x02, 0x0a, 0x0c, 0x0b, 0x0e,
+    0x0a, 0x08, 0x09, 0x05, 0x0a, 0x13, 0x1b, 0x04, 0x0c, 0x15, 0x0a, 0x09,
+    0x04, 0x0b, 0x23, 0x0e, 0x60, 0x0d, 0x0a, 0x01, 0x0c, 0x00, 0x0e, 0x02,
+    0x0c, 0x01, 0x0f, 0x02, 0x08, 0xf1, 0x0d, 0x0c, 0x08, 0x1d, 0x02, 0x10,
+    0x09, 0x1a, 0x03, 0x17, 0x0d, 0x0c, 0x05, 0x0b, 0x03, 0x18, 0x01, 0x00,
+    0x06, 0x03, 0x07, 0x0a, 0x28, 0x05, 0x03, 0x61, 0x01, 0x19, 0x10, 0x06,
+    0x03, 0x07, 0x0f, 0x08, 0x0a, 0x07, 0x03, 0x0c, 0xf0, 0x01, 0x09, 0x02,
+    0x0e, 0x05, 0x1d, 0x02, 0x03, 0x1f, 0x0f, 0x09, 0x0d, 0x05, 0x1b, 0x03,
+    0x02, 0x09, 0x11, 0x0a, 0x07, 0x03, 0x0a, 0x1d, 0x0b, 0x09, 0x04, 0x07,
+    0xf0, 0x02, 0x09, 0x05, 0x0a, 0x03, 0x0c, 0x02, 0x0e, 0x1e, 0x0f, 0x1e,
+    0x05, 0x02, 0x0d, 0x00, 0x0c, 0x01, 0x2f, 0x08, 0x0c, 0x07, 0x0e, 0x05,
+    0x0b, 0x04, 0x19, 0x03, 0x20, 0x02, 0x0e, 0x01, 0x0c, 0x00, 0x07, 0x71,
+    0x02, 0x38, 0x03, 0x07, 0x0f, 0x04, 0x17, 0x01, 0x10, 0x06, 0x05, 0x12,
+    0x03, 0x06, 0x0d, 0x04, 0x03, 0x0c, 0x13, 0x34, 0x05, 0x02, 0x02, 0x10,
+    0x01, 0x00, 0x05, 0x05, 0x01, 0x27, 0x0f, 0x03, 0x07, 0x02, 0x04, 0x01,
+    0x09, 0x02, 0x30, 0x0e, 0x01, 0x09, 0x00, 0x1a, 0x03, 0x1f, 0x11, 0x08,
+    0x07, 0x08, 0xd0, 0x1a, 0x05, 0x03, 0x0b, 0x02, 0x09, 0x00, 0x0d, 0x02,
+    0x0b, 0x0f, 0x0c, 0x0e, 0x1a, 0x07, 0x05, 0x08, 0x03, 0x16, 0x01, 0x00,
+    0x04, 0x01, 0x06, 0x0b, 0x01, 0x08, 0x0f, 0x12, 0x09, 0x03, 0x08, 0x01,
+    0x11, 0x0c, 0x13, 0x09, 0xf0, 0x0c, 0x02, 0x0a, 0x0e, 0x1c, 0x0f, 0x07,
+    0x1b, 0x04, 0x13, 0x0c, 0x0d, 0x34, 0x0a, 0x2c, 0x23, 0x0f, 0x0e, 0x0b,
+    0x02, 0x07, 0x00, 0x10, 0x09, 0x01, 0x0a, 0x00, 0x01, 0x08, 0x03, 0x02,
+    0x09, 0x0f, 0x03, 0x0a, 0x05, 0x02, 0x19, 0x02, 0x91, 0x10, 0x17, 0x03,
+    0x38, 0x0c, 0x0e, 0x07, 0x03, 0x07, 0x01, 0x08, 0x00, 0x07, 0x03, 0xf0,
+    0x0d, 0x0d, 0x0c, 0x07, 0x0a, 0x05, 0x09, 0x03, 0x08, 0x02, 0x07, 0x01,
+    0x08, 0x03, 0x0a, 0x0f, 0x0b, 0x08, 0x1a, 0x02, 0x03, 0x0b, 0x07, 0x0c,
+    0x05, 0x0b, 0x01, 0x0e, 0x02, 0x1f, 0x0c, 0xf0, 0x08, 0x0e, 0x05, 0x0d,
+    0x04, 0x0a, 0x02, 0x0c, 0x01, 0x09, 0x00, 0x0e, 0x02, 0x1f, 0x08, 0x09,
+    0x0d, 0x03, 0x0c, 0x01, 0x0e, 0x14, 0x0b, 0x1a, 0x03, 0x0f, 0x0e, 0x0d,
+    0xc0, 0x0c, 0x04, 0x19, 0x11, 0x0b, 0x06, 0x2c, 0x0d, 0x08, 0x05, 0x0e,
+    0x04, 0x1d, 0x23, 0x1a, 0x02, 0x08, 0x00, 0xb1, 0x06, 0x02, 0x28, 0x03,
+    0x05, 0x0b, 0x09, 0x03, 0x0a, 0x01, 0x08, 0x10, 0x07, 0x08, 0x03, 0x1a,
+    0x0e, 0x0b, 0x09, 0x06, 0x30, 0x0b, 0x01, 0x0a, 0x00, 0x08, 0x01, 0x0b,
+    0x05, 0x51, 0x0c, 0x0f, 0x0e, 0x05, 0x0c, 0x03, 0x1a, 0x01, 0x10, 0x0b,
+    0x80, 0x0f, 0x02, 0x0e, 0x0e, 0x1f, 0x0f, 0x08, 0x1d, 0x05, 0x03, 0x0b,
+    0x02, 0x08, 0x01, 0x06, 0x02, 0x31, 0x05, 0x1f, 0x06, 0x05, 0x1b, 0x14,
+    0x30, 0x05, 0x33, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x08, 0x12, 0x0e, 0x07,
+    0x03, 0x0b, 0x61, 0x01, 0x07, 0x12, 0x19, 0x01, 0x0c, 0x08, 0x0b, 0x0a,
+    0x08, 0x05, 0x0e, 0xd0, 0x04, 0x0c, 0x23, 0x0e, 0x0c, 0x0e, 0x54, 0x0b,
+    0x0c, 0x0d, 0x0b, 0x0a, 0x08, 0x02, 0x06, 0x10, 0x05, 0x0b, 0x02, 0x18,
+    0x01, 0x07, 0x22, 0x0f, 0x0e, 0x04, 0x09, 0x01, 0x0c, 0x61, 0x10, 0x07,
+    0x06, 0x03, 0x07, 0x0d, 0x09, 0x0f, 0x08, 0x07, 0x07, 0x04, 0x0a, 0xf0,
+    0x03, 0x17, 0x01, 0x03, 0x0a, 0x0c, 0x1c, 0x06, 0x05, 0x0b, 0x03, 0x0a,
+    0x02, 0x19, 0x01, 0x02, 0x08, 0x09, 0x17, 0x06, 0x05, 0x08, 0x0f, 0x0a,
+    0x0a, 0x09, 0x04, 0x18, 0xf0, 0x01, 0x02, 0x09, 0x0d, 0x0c, 0x0a, 0x0d,
+    0x06, 0x0e, 0x04, 0x0d, 0x02, 0x0b, 0x11, 0x08, 0x07, 0x03, 0x08, 0x0b,
+    0x19, 0x0d, 0x04, 0x0a, 0x01, 0x2d, 0x03, 0x04, 0xf0, 0x03, 0x0c, 0x0f,
+    0x0d, 0x09, 0x0a, 0x02, 0x09, 0x01, 0x0d, 0x05, 0x0c, 0x09, 0x0d, 0x07,
+    0x0b, 0x06, 0x0a, 0x05, 0x09, 0x04, 0x0b, 0x23, 0x1e, 0x0c, 0x02, 0x08,
+    0x00, 0x0b, 0x50, 0x03, 0x0c, 0x15, 0x1a, 0x0f, 0x0c, 0x06, 0x0b, 0x02,
+    0x06, 0xf1, 0x10, 0x18, 0x03, 0x09, 0x0b, 0x1a, 0x07, 0x02, 0x19, 0x00,
+    0x11, 0x0b, 0x1e, 0x03, 0x09, 0x1c, 0x04, 0x03, 0x09, 0x01, 0x0c, 0x10,
+    0x0f, 0x09, 0xf1, 0x01, 0x18, 0x06, 0x0e, 0x09, 0x07, 0x18, 0x04, 0x02,
+    0x17, 0x01, 0x00, 0x06, 0x01, 0x08, 0x0d, 0x07, 0x0f, 0x06, 0x0c, 0x04,
+    0x06, 0x03, 0x02, 0x12, 0x10, 0x05, 0xf1, 0x04, 0x08, 0x0f, 0x2a, 0x0b,
+    0x03, 0x00, 0x0c, 0x01, 0x0b, 0x12, 0x0c, 0x38, 0x0c, 0x09, 0x04, 0x03,
+    0x19, 0x22, 0x08, 0x09, 0x03, 0x07, 0xf1, 0x04, 0x06, 0x05, 0x05, 0x06,
+    0x04, 0x08, 0x03, 0x07, 0x02, 0x04, 0x11, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x0a, 0x07, 0x0f, 0x0b, 0x05, 0x0a, 0x01, 0x0c, 0x10, 0x27, 0x03, 0x31,
+    0x1f, 0x08, 0x07, 0x08, 0x06, 0x04, 0x0e, 0xf0, 0x02, 0x0d, 0x00, 0x0f,
+    0x02, 0x0e, 0x0a, 0x1c, 0x06, 0x05, 0x0d, 0x03, 0x0e, 0x02, 0x0d, 0x11,
+    0x0a, 0x08, 0x02, 0x0d, 0x06, 0x0b, 0x1f, 0x1f, 0x05, 0x0d, 0x03, 0x18,
+    0xf0, 0x01, 0x02, 0x09, 0x0b, 0x0b, 0x0c, 0x2c, 0x07, 0x04, 0x02, 0x0b,
+    0x11, 0x0d, 0x09, 0x02, 0x1a, 0x07, 0x0b, 0x49, 0x05, 0x02, 0x03, 0x05,
+    0xf0, 0x03, 0x0d, 0x08, 0x1c, 0x04, 0x02, 0x09, 0x05, 0x0b, 0x09, 0x2a,
+    0x06, 0x05, 0x44, 0x0d, 0x3b, 0x03, 0x0d, 0x02, 0x0a, 0x01, 0x29, 0xf0,
+    0x04, 0x05, 0x04, 0x08, 0x09, 0x0a, 0x06, 0x0b, 0x03, 0x0a, 0x12, 0x18,
+    0x04, 0x2a, 0x0a, 0x06, 0x03, 0x09, 0x04, 0x0a, 0x07, 0x08, 0x03, 0x49,
+    0x04, 0xf0, 0x0a, 0x06, 0x05, 0x04, 0x08, 0x03, 0x09, 0x12, 0x0a, 0x09,
+    0x05, 0x1b, 0x0e, 0x08, 0x1a, 0x05, 0x03, 0x0b, 0x02, 0x0c, 0x01, 0x0d,
+    0x02, 0x0e, 0x19, 0x1c, 0xf0, 0x06, 0x19, 0x03, 0x11, 0x08, 0x0b, 0x03,
+    0x0a, 0x04, 0x0c, 0x17, 0x1e, 0x04, 0x0d, 0x12, 0x0b, 0x0f, 0x14, 0x0c,
+    0x19, 0x09, 0x08, 0x0a, 0xf0, 0x05, 0x0b, 0x04, 0x0c, 0x23, 0x0d, 0x0c,
+    0x0e, 0x14, 0x0a, 0x0c, 0x25, 0x0a, 0x09, 0x07, 0x04, 0x16, 0x02, 0x01,
+    0x07, 0x06, 0x18, 0x0b, 0x05, 0x0a, 0xf0, 0x07, 0x0b, 0x05, 0x0d, 0x03,
+    0x1b, 0x12, 0x1a, 0x04, 0x09, 0x09, 0x0a, 0x08, 0x09, 0x27, 0x06, 0x04,
+    0x02, 0x08, 0x03, 0x0a, 0x06, 0x1b, 0x15, 0x0a, 0xf0, 0x04, 0x0b, 0x03,
+    0x2a, 0x02, 0x01, 0x03, 0x08, 0x0c, 0x19, 0x0f, 0x07, 0x2a, 0x04, 0x03,
+    0x02, 0x09, 0x03, 0x08, 0x17, 0x0a, 0x0b, 0x05, 0x0c, 0x04, 0x1a, 0xf0,
+    0x13, 0x08, 0x02, 0x0a, 0x03, 0x08, 0x05, 0x1a, 0x06, 0x05, 0x09, 0x13,
+    0x0a, 0x1b, 0x04, 0x03, 0x0d, 0x14, 0x0c, 0x29, 0x05, 0x07, 0x06, 0x18,
+    0xf0, 0x05, 0x54, 0x09, 0x1a, 0x1c, 0x0b, 0x13, 0x0d, 0x0a, 0x02, 0x0b,
+    0x03, 0x0e, 0x04, 0x1c, 0x03, 0x15, 0x1b, 0x04, 0x09, 0xf0, 0x13, 0x0a,
+    0x18, 0x04, 0x05, 0x1a, 0x04, 0x05, 0x09, 0x06, 0x0a, 0x05, 0x19, 0x13,
+    0x1c, 0x05, 0x24, 0x0e, 0x0c, 0x0a, 0x23, 0x0e, 0x19, 0xf0, 0x04, 0x0b,
+    0x06, 0x2c, 0x05, 0x04, 0x33, 0x0e, 0x0a, 0x08, 0x0b, 0x06, 0x0a, 0x05,
+    0x0d, 0x03, 0x1f, 0x12, 0x2e, 0x23, 0xf0, 0x0d, 0x15, 0x0a, 0x1c, 0x04,
+    0x13, 0x1b, 0x14, 0x0a, 0x19, 0x16, 0x0a, 0x05, 0x09, 0x04, 0x0b, 0x13,
+    0x1e, 0x44, 0x09, 0x0b, 0xf0, 0x0c, 0x0d, 0x0b, 0x03, 0x0e, 0x12, 0x0f,
+    0x0c, 0x03, 0x1a, 0x15, 0x0b, 0x04, 0x0a, 0x15, 0x29, 0x04, 0x13, 0x0b,
+    0x0a, 0x04, 0x09, 0xf0, 0x25, 0x0b, 0x0d, 0x1b, 0x04, 0x03, 0x0d, 0x02,
+    0x0f, 0x03, 0x0c, 0x25, 0x0a, 0x19, 0x04, 0x0b, 0x03, 0x0c, 0x12, 0x0e,
+    0x1a, 0x04, 0x07, 0x1b, 0xf0, 0x06, 0x05, 0x09, 0x04, 0x0a, 0x23, 0x0c,
+    0x09, 0x2b, 0x15, 0x04, 0x0d, 0x43, 0x0f, 0x0e, 0x0b, 0x09, 0x0a, 0x04,
+    0x0b, 0x05, 0x0a, 0xf0, 0x04, 0x0d, 0x13, 0x0e, 0x0c, 0x24, 0x09, 0x08,
+    0x09, 0x25, 0x0a, 0x0b, 0x1a, 0x94, 0x19, 0x1a, 0x0c, 0x0b, 0xf0, 0x0a,
+    0x09, 0x08, 0x03, 0x0a, 0x14, 0x09, 0x0b, 0x03, 0x0e, 0x24, 0x0c, 0x0e,
+    0x0a, 0x33, 0x0e, 0x0b, 0x0c, 0x0f, 0x04, 0x1c, 0x15, 0xf0, 0x1a, 0x04,
+    0x13, 0x0b, 0x0e, 0x44, 0x0d, 0x1c, 0x0b, 0x09, 0x13, 0x0c, 0x0b, 0x04,
+    0x09, 0x25, 0x0a, 0x09, 0x08, 0x14, 0x19, 0xf0, 0x13, 0x0b, 0x1e, 0x14,
+    0x0d, 0x13, 0x0e, 0x0d, 0x14, 0x1a, 0x13, 0x1d, 0x04, 0x0b, 0x15, 0x09,
+    0x08, 0x14, 0x09, 0x08, 0xf0, 0x15, 0x17, 0x07, 0x06, 0x0a, 0x05, 0x0b,
+    0xf4, 0x0a, 0x19, 0x1a, 0x1b, 0x0a, 0x08, 0x07, 0x19, 0xf0, 0x0b, 0x0c,
+    0x09, 0x0a, 0xf4, 0x0b, 0x0a, 0x09, 0x08, 0x09, 0x0d, 0x0e, 0x0c, 0x0a,
+    0x09, 0x08, 0xf0, 0x09, 0x0d, 0x0c, 0x0b, 0x0a, 0xf4, 0x08, 0x07, 0x08,
+    0x0c, 0x0f, 0x0e, 0x0b, 0x19, 0x08, 0x09, 0xf0, 0x1d, 0x0b, 0x0a, 0x09,
+    0xe4, 0x28, 0x0b, 0x0d, 0x0c, 0x09, 0x08, 0x09, 0x08, 0x0c, 0x30, 0x0f,
+    0x0d, 0x4b, 0xf2, 0xf1, 0x0c, 0x0d, 0x2b, 0x0a, 0x09, 0x0b, 0x0c, 0x0a,
+    0x0c, 0x0e, 0x0c, 0xf2, 0xf1, 0x0a, 0x19, 0x0c, 0x1f, 0x0d, 0x0a, 0x09,
+    0x0b, 0x0e, 0x0c, 0x0d, 0x0b, 0x1a, 0xf2, 0xf1, 0x09, 0x0b, 0x0e, 0x0d,
+    0x0c, 0x0b, 0x2a, 0x0d, 0x0b, 0x0a, 0x1c, 0x2a, 0xf2, 0xf1, 0x0c, 0x0d,
+    0x0c, 0x0b, 0x1a, 0x0b, 0x1e, 0x0c, 0x3b, 0x0c, 0xf2, 0xf1, 0x1b, 0x1a,
+    0x1b, 0x0a, 0x1c, 0x0a, 0x0c, 0x0d, 0x0c, 0x1a, 0x0b, 0xf2, 0xf1, 0x0d,
+    0x0e, 0x0c, 0x0b, 0x0a, 0x09, 0x0b, 0x0e, 0x0c, 0x0b, 0x2a, 0x0b, 0x0c,
+    0x0e, 0xf2, 0xf1, 0x0d, 0x0c, 0x0b, 0x1a, 0x0b, 0x0e, 0x0d, 0x0c, 0x0b,
+    0x3a, 0x0c, 0x0d, 0xf2, 0xf1, 0x0c, 0x2a, 0x0b, 0x1e, 0x0c, 0x3b, 0x0c,
+    0x0b, 0x0c, 0x2b, 0xf2, 0xf1, 0x1a, 0x2b, 0x1c, 0x0b, 0x0a, 0x09, 0x0b,
+    0x1e, 0x0c, 0xf2, 0xf1, 0x1b, 0x0a, 0x0b, 0x0d, 0x0c, 0x3b, 0x0a, 0x0b,
+    0x0d, 0x1c, 0x1b, 0xf2, 0xf1, 0x0a, 0x2b, 0x1c, 0x0b, 0x2a, 0x1c, 0x1b,
+    0x0a, 0xf2, 0xf1, 0x0b, 0x0c, 0x0d, 0x0c, 0x3b, 0x1c, 0x6b, 0xf2, 0xf1,
+    0x0c, 0x1b, 0x0c, 0x1b, 0x0a, 0x0b, 0x3c, 0x0b, 0x1a, 0xf2, 0xf1, 0x0b,
+    0x0c, 0x1b, 0x0a, 0x2b, 0x2c, 0x2b, 0x0a, 0x0b, 0xf2, 0xf1, 0x2c, 0x2b,
+    0x0a, 0x0b, 0x1c, 0x0b, 0x1a, 0x0c, 0x0d, 0x1c, 0xf2, 0xf1, 0x3b, 0x3c,
+    0x4b, 0x0c, 0x1b, 0xf2, 0xf1, 0x0c, 0x1b, 0x0a, 0x0b, 0x2c, 0x3b, 0x2c,
+    0xf2, 0xf1, 0x5b, 0x1c, 0x2b, 0x0a, 0x0b, 0x1c, 0x5b, 0xf2, 0xf1, 0x1c,
+    0x3b, 0x2c, 0x2b, 0xf2, 0xf1, 0x0c, 0x3b, 0x0c, 0x2b, 0x0c, 0x2b, 0x0c,
+    0x3b, 0xf2, 0xf1, 0x2c, 0x3b, 0x0c, 0x2b, 0x0c, 0x2b, 0xf2, 0xf1, 0x2c,
+    0x3b, 0x2c, 0x4b, 0xf2, 0xf1, 0x1c, 0x3b, 0x0c, 0x0b, 0x0c, 0x3b, 0x3c,
+    0xf2, 0xf1, 0x5b, 0x0c, 0x6b, 0xf2, 0xf1, 0x2c, 0x3b, 0x0c, 0x0b, 0x0c,
+    0x4b, 0x2c, 0xf2, 0xf1, 0x3b, 0x2c, 0x4b, 0x2c, 0xf2, 0xf1, 0x3b, 0x0c,
+    0x0b, 0x0c, 0x6b, 0x0c, 0xf2, 0xf1, 0x4b, 0x0c, 0x1b, 0x0c, 0x3b, 0x0c,
+    0x0b, 0x0c, 0xf2, 0xf1, 0x6b, 0x1c, 0x2b, 0x2c, 0x3b, 0xf2, 0xf1, 0x1c,
+    0x5b, 0x0c, 0x4b, 0xf2, 0xf1, 0x1c, 0x5b, 0x0c, 0x0b, 0x0c, 0x4b, 0xa2,
+    0xf1, 0x0c, 0x7b, 0x27, 0x23, 0xf5, 0xf4, 0xf1, 0xf5, 0xf4, 0xf1, 0xc5,
+    0xc4, 0xa1, 0x05, 0x04, 0x01
+};
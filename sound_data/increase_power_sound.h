@@ -0,0 +1,1131 @@
+const uint8_t increase_power_sound [] = {
+    0xf3, 0xf0, 0x5d, 0x6e, 0x9d, 0xf3, 0xf0, 0x9e, 0xf3, 0xf0, 0x5d, 0x5e,
+    0x0c, 0x0a, 0x29, 0x13, 0xf0, 0x04, 0x08, 0x05, 0x0a, 0x17, 0x09, 0x0a,
+    0x06, 0x0b, 0x05, 0x2a, 0x04, 0x13, 0x18, 0x22, 0x07, 0x08, 0x11, 0x0c,
+    0x0e, 0x22, 0xf0, 0x0b, 0x0e, 0x0f, 0x03, 0x0e, 0x04, 0x0d, 0x06, 0x0c,
+    0x0d, 0x0e, 0x0f, 0x0f, 0x0d, 0x0e, 0x0e, 0x0c, 0x08, 0x1b, 0x05, 0x04,
+    0x0a, 0x03, 0x27, 0x02, 0x01, 0x40, 0x30, 0x08, 0x07, 0x09, 0x0f, 0x71,
+    0x0c, 0x01, 0x0a, 0x02, 0x0b, 0x04, 0x0a, 0x09, 0x0d, 0x2f, 0x0f, 0x0e,
+    0x0c, 0x0c, 0xe0, 0x0f, 0x06, 0x0e, 0x04, 0x0c, 0x02, 0x1b, 0x11, 0x27,
+    0x20, 0x29, 0x01, 0x02, 0x03, 0x0c, 0x05, 0x1a, 0x07, 0x1f, 0x0c, 0x51,
+    0x38, 0x0c, 0x0a, 0x06, 0x04, 0x07, 0x03, 0x06, 0x12, 0x80, 0x08, 0x06,
+    0x01, 0x07, 0x20, 0x18, 0x1a, 0x01, 0x02, 0x0c, 0x04, 0x0b, 0x05, 0x01,
+    0x08, 0x06, 0x02, 0x06, 0x0b, 0x03, 0x05, 0x0d, 0x05, 0x04, 0x1a, 0x06,
+    0x73, 0x05, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x21, 0x01, 0x30,
+    0x10, 0x24, 0x51, 0x01, 0x05, 0x02, 0x06, 0x04, 0x07, 0x06, 0x09, 0x09,
+    0x0b, 0x1f, 0x02, 0x09, 0x03, 0x08, 0x0e, 0x32, 0x1b, 0x08, 0x04, 0x0a,
+    0x02, 0x09, 0x01, 0x11, 0x0c, 0x50, 0x09, 0x90, 0x0b, 0x06, 0x14, 0x06,
+    0x01, 0x07, 0x02, 0x09, 0x04, 0x0c, 0x07, 0x0e, 0x0a, 0x0f, 0x1f, 0x01,
+    0x0d, 0x62, 0x1a, 0x0d, 0x08, 0x0b, 0x04, 0x0a, 0x02, 0x09, 0x01, 0x07,
+    0x50, 0x06, 0x01, 0x07, 0x60, 0x08, 0x07, 0x06, 0x08, 0x01, 0x09, 0x02,
+    0x0a, 0x04, 0x0c, 0x05, 0xa1, 0x08, 0x06, 0x09, 0x0d, 0x0a, 0x0f, 0x0e,
+    0x0e, 0x0d, 0x0a, 0x0b, 0x05, 0x0a, 0x03, 0x08, 0x01, 0x0a, 0x50, 0x08,
+    0x06, 0x50, 0x08, 0x17, 0x0b, 0x01, 0x0e, 0x02, 0x0f, 0x03, 0x81, 0x0d,
+    0x05, 0x0e, 0x06, 0x2f, 0x0c, 0x0f, 0x0e, 0x0e, 0x09, 0x1d, 0x04, 0x02,
+    0x0a, 0x01, 0x50, 0x0f, 0x50, 0x0c, 0x07, 0x26, 0x61, 0x05, 0x01, 0x06,
+    0x02, 0x07, 0x04, 0x08, 0x07, 0x09, 0x08, 0x0b, 0x1f, 0x0d, 0x12, 0x19,
+    0x0d, 0x0e, 0x41, 0x0c, 0x06, 0x0a, 0x03, 0x19, 0x01, 0x50, 0x07, 0x70,
+    0x09, 0x26, 0x08, 0x01, 0x09, 0x02, 0x0b, 0x04, 0x0e, 0x05, 0x91, 0x09,
+    0x06, 0x0a, 0x0b, 0x0b, 0x1f, 0x0e, 0x0c, 0x0d, 0x0b, 0x06, 0x0a, 0x03,
+    0x0b, 0x01, 0x0c, 0x50, 0x0a, 0xa0, 0x0e, 0x19, 0x08, 0x2a, 0x01, 0x02,
+    0x04, 0x1b, 0x07, 0x08, 0x0c, 0x3f, 0x0e, 0x21, 0x19, 0x08, 0x0e, 0xd0,
+    0x0c, 0x07, 0x0a, 0x04, 0x08, 0x02, 0x07, 0x01, 0x08, 0x30, 0x0a, 0x09,
+    0x07, 0x08, 0x01, 0x17, 0x02, 0x03, 0x0b, 0x05, 0x0d, 0x07, 0x0c, 0x09,
+    0x51, 0x09, 0x2f, 0x0a, 0x0c, 0x0b, 0x0a, 0x09, 0x06, 0x08, 0x04, 0x90,
+    0x0b, 0x02, 0x0a, 0x01, 0x09, 0x30, 0x0b, 0x09, 0x17, 0x01, 0x26, 0x02,
+    0x04, 0x15, 0x81, 0x05, 0x07, 0x08, 0x08, 0x0d, 0x0a, 0x1f, 0x1b, 0x09,
+    0x0c, 0x06, 0x1a, 0x03, 0x02, 0x60, 0x0f, 0x01, 0x0d, 0x50, 0x0f, 0x0b,
+    0x08, 0x07, 0x0c, 0x91, 0x09, 0x01, 0x0a, 0x02, 0x0e, 0x03, 0x0c, 0x05,
+    0x2e, 0x09, 0x0d, 0x0e, 0x0d, 0x09, 0x0a, 0x06, 0x09, 0x04, 0xa0, 0x0e,
+    0x02, 0x0c, 0x01, 0x0a, 0x30, 0x0c, 0x0a, 0x17, 0x01, 0x26, 0x02, 0x04,
+    0x07, 0x07, 0x06, 0x91, 0x06, 0x0a, 0x07, 0x2f, 0x09, 0x1c, 0x0a, 0x0a,
+    0x06, 0x09, 0x03, 0x08, 0x01, 0x09, 0x60, 0x08, 0x40, 0x09, 0x08, 0x06,
+    0x07, 0x0b, 0x91, 0x09, 0x01, 0x0c, 0x03, 0x0b, 0x04, 0x0d, 0x07, 0x0e,
+    0x0b, 0x2f, 0x1f, 0x0a, 0x0e, 0x06, 0x0b, 0x04, 0x60, 0x0f, 0x02, 0x0d,
+    0x01, 0x09, 0x50, 0x0a, 0x08, 0x16, 0xb1, 0x05, 0x07, 0x01, 0x09, 0x03,
+    0x08, 0x04, 0x09, 0x06, 0x0b, 0x0a, 0x0d, 0x1f, 0x1e, 0x0d, 0x0b, 0x08,
+    0x09, 0x04, 0x08, 0x03, 0x50, 0x0a, 0x01, 0x0c, 0x50, 0x0d, 0x09, 0x07,
+    0x06, 0xa1, 0x05, 0x07, 0x01, 0x18, 0x03, 0x04, 0x09, 0x06, 0x0b, 0x0a,
+    0x1c, 0x1f, 0x0d, 0x0c, 0x0b, 0x07, 0x0a, 0x05, 0x70, 0x0e, 0x03, 0x0a,
+    0x01, 0x0b, 0x50, 0x0c, 0x09, 0x17, 0x0a, 0xa1, 0x07, 0x01, 0x09, 0x03,
+    0x08, 0x04, 0x0a, 0x06, 0x0b, 0x0a, 0x1c, 0x1f, 0x0d, 0x0e, 0x0a, 0x08,
+    0x09, 0x04, 0x08, 0x03, 0x60, 0x0a, 0x01, 0x0b, 0x50, 0x0c, 0x09, 0x17,
+    0x0a, 0x81, 0x07, 0x01, 0x18, 0x03, 0x04, 0x09, 0x06, 0x2a, 0x0a, 0x1f,
+    0x0b, 0x1d, 0x0a, 0x80, 0x0e, 0x06, 0x0b, 0x03, 0x0c, 0x01, 0x1e, 0x50,
+    0x0c, 0x18, 0x0b, 0x31, 0x27, 0x01, 0x03, 0x05, 0x06, 0x06, 0x12, 0x15,
+    0x09, 0x0c, 0x33, 0x24, 0x0d, 0x0a, 0x09, 0x03, 0x05, 0x14, 0x12, 0x03,
+    0x01, 0x07, 0x11, 0x30, 0x08, 0x0f, 0xf0, 0x0c, 0x0a, 0x11, 0x07, 0x08,
+    0x02, 0x19, 0x04, 0x05, 0x0b, 0x07, 0x0d, 0x09, 0x3f, 0x0e, 0x0f, 0x0e,
+    0x0a, 0x0e, 0x06, 0x0b, 0x04, 0x29, 0x02, 0xf0, 0x51, 0x08, 0x16, 0x07,
+    0x08, 0x02, 0x19, 0x04, 0x05, 0x0c, 0x07, 0x1e, 0x0b, 0x2f, 0x2f, 0x0b,
+    0x0e, 0x06, 0x0c, 0xf0, 0x04, 0x0a, 0x02, 0x09, 0x51, 0x08, 0x07, 0x06,
+    0x05, 0x06, 0x27, 0x02, 0x04, 0x05, 0x0a, 0x07, 0x0b, 0x0b, 0x0c, 0x2f,
+    0x2f, 0xf0, 0x0e, 0x0e, 0x07, 0x0c, 0x04, 0x0e, 0x02, 0x0d, 0x11, 0x0a,
+    0x09, 0x30, 0x0f, 0x0c, 0x0e, 0x0f, 0x01, 0x0b, 0x02, 0x0e, 0x04, 0x0a,
+    0x06, 0x0b, 0x08, 0x0e, 0x0c, 0x3f, 0xf0, 0x1f, 0x0c, 0x07, 0x0e, 0x05,
+    0x0b, 0x03, 0x09, 0x11, 0x0c, 0x09, 0x30, 0x0f, 0x0d, 0x1f, 0x01, 0x0b,
+    0x02, 0x0e, 0x03, 0x0f, 0x05, 0x0e, 0xf0, 0x08, 0x0c, 0x0e, 0x1e, 0x1f,
+    0x1f, 0x0c, 0x08, 0x0d, 0x05, 0x0e, 0x03, 0x0a, 0x11, 0x0e, 0x0a, 0x30,
+    0x0f, 0x0d, 0x1e, 0x01, 0x0a, 0x02, 0x0b, 0xf0, 0x04, 0x19, 0x06, 0x08,
+    0x0b, 0x0e, 0x0d, 0x2f, 0x0e, 0x0f, 0x0e, 0x0a, 0x0b, 0x07, 0x09, 0x04,
+    0x18, 0x02, 0x51, 0x0a, 0x07, 0x26, 0xf0, 0x08, 0x02, 0x09, 0x03, 0x0c,
+    0x05, 0x0a, 0x07, 0x0c, 0x0d, 0x0d, 0x2f, 0x0e, 0x0f, 0x0e, 0x0b, 0x0b,
+    0x07, 0x0a, 0x04, 0x09, 0x02, 0x08, 0x51, 0x0b, 0x08, 0x26, 0xf0, 0x08,
+    0x02, 0x09, 0x03, 0x0b, 0x05, 0x0a, 0x07, 0x0b, 0x0c, 0x0c, 0x1f, 0x0d,
+    0x1f, 0x0d, 0x09, 0x1e, 0x06, 0x04, 0x0a, 0x02, 0x09, 0x51, 0x0c, 0xf0,
+    0x08, 0x27, 0x19, 0x02, 0x03, 0x0c, 0x05, 0x0a, 0x07, 0x1b, 0x0d, 0x2f,
+    0x0c, 0x0e, 0x0d, 0x09, 0x1e, 0x06, 0x04, 0x0a, 0xf0, 0x02, 0x09, 0x51,
+    0x0a, 0x07, 0x26, 0x18, 0x02, 0x03, 0x0b, 0x04, 0x0e, 0x07, 0x0b, 0x0b,
+    0x0e, 0x0d, 0x1f, 0x1f, 0x0e, 0x0a, 0x0d, 0xf0, 0x07, 0x0c, 0x04, 0x0b,
+    0x02, 0x0a, 0x51, 0x0b, 0x07, 0x26, 0x08, 0x02, 0x07, 0x03, 0x0a, 0x04,
+    0x1d, 0x06, 0x0a, 0x0e, 0x0c, 0x1f, 0x1f, 0xf0, 0x1e, 0x0a, 0x07, 0x1d,
+    0x04, 0x02, 0x0b, 0x51, 0x0c, 0x08, 0x27, 0x08, 0x02, 0x07, 0x03, 0x0a,
+    0x04, 0x2d, 0x06, 0x0a, 0xf0, 0x0e, 0x2e, 0x1f, 0x0a, 0x1d, 0x07, 0x04,
+    0x0e, 0x02, 0x0b, 0x51, 0x0c, 0x08, 0x27, 0x08, 0x02, 0x07, 0x03, 0x09,
+    0x04, 0x2c, 0xf0, 0x06, 0x0a, 0x0e, 0x0d, 0x1f, 0x0e, 0x1d, 0x0a, 0x08,
+    0x0b, 0x05, 0x0a, 0x02, 0x1d, 0x51, 0x08, 0x27, 0x08, 0x02, 0x07, 0xf0,
+    0x03, 0x08, 0x04, 0x0a, 0x06, 0x1b, 0x0a, 0x0e, 0x0c, 0x1f, 0x1d, 0x0d,
+    0x0a, 0x0a, 0x09, 0x07, 0x07, 0x04, 0x06, 0x03, 0x15, 0x02, 0x41, 0x27,
+    0xf0, 0x08, 0x0c, 0x02, 0x0e, 0x03, 0x0f, 0x05, 0x2d, 0x08, 0x0b, 0x1f,
+    0x1c, 0x0a, 0x0d, 0x08, 0x0c, 0x06, 0x1a, 0x03, 0x02, 0x08, 0x51, 0x09,
+    0x38, 0xf0, 0x0c, 0x02, 0x0d, 0x04, 0x19, 0x06, 0x09, 0x1a, 0x0d, 0x1f,
+    0x2b, 0x0b, 0x09, 0x2a, 0x06, 0x03, 0x02, 0x08, 0xf0, 0x51, 0x09, 0x17,
+    0x18, 0x1c, 0x02, 0x03, 0x0e, 0x05, 0x1b, 0x08, 0x0a, 0x0d, 0x0e, 0x0e,
+    0x0f, 0x0c, 0x0a, 0x1d, 0x08, 0x06, 0x0b, 0xf0, 0x03, 0x0c, 0x02, 0x09,
+    0x51, 0x0a, 0x17, 0x18, 0x1b, 0x02, 0x03, 0x0c, 0x05, 0x1a, 0x08, 0x0a,
+    0x0c, 0x0e, 0x0d, 0x0f, 0x0c, 0x0a, 0x1d, 0xf0, 0x08, 0x06, 0x0c, 0x03,
+    0x0e, 0x02, 0x0a, 0x51, 0x0b, 0x38, 0x2b, 0x02, 0x03, 0x05, 0x0a, 0x07,
+    0x1b, 0x0a, 0x0e, 0x0c, 0xf0, 0x0f, 0x1b, 0x0b, 0x08, 0x0d, 0x06, 0x0c,
+    0x04, 0x09, 0x02, 0x1b, 0x51, 0x28, 0x09, 0x0b, 0x02, 0x0a, 0x03, 0x0b,
+    0x04, 0x0e, 0x07, 0x0b, 0xf0, 0x09, 0x1c, 0x0d, 0x0f, 0x1b, 0x0b, 0x08,
+    0x1d, 0x06, 0x04, 0x0a, 0x02, 0x0c, 0x51, 0x0b, 0x08, 0x07, 0x08, 0x09,
+    0x2a, 0x02, 0x03, 0xf0, 0x04, 0x0d, 0x06, 0x3e, 0x08, 0x0b, 0x0e, 0x0a,
+    0x1d, 0x08, 0x06, 0x0e, 0x04, 0x0b, 0x02, 0x0e, 0x51, 0x0d, 0x08, 0x07,
+    0x18, 0x0a, 0xf0, 0x02, 0x09, 0x03, 0x0a, 0x04, 0x0c, 0x06, 0x1d, 0x08,
+    0x0c, 0x0c, 0x0f, 0x0b, 0x0d, 0x0a, 0x0b, 0x09, 0x09, 0x08, 0x06, 0x07,
+    0x04, 0x06, 0x02, 0x07, 0x41, 0x09, 0x18, 0xf0, 0x09, 0x0a, 0x02, 0x19,
+    0x03, 0x04, 0x1b, 0x06, 0x09, 0x0a, 0x0c, 0x0b, 0x0e, 0x0d, 0x0a, 0x1c,
+    0x08, 0x07, 0x0a, 0x05, 0x19, 0x03, 0x02, 0x08, 0x41, 0x09, 0xf0, 0x08,
+    0x19, 0x0b, 0x02, 0x19, 0x03, 0x04, 0x0a, 0x06, 0x1b, 0x08, 0x0a, 0x1d,
+    0x0d, 0x0a, 0x1c, 0x08, 0x06, 0x1e, 0x04, 0x03, 0x09, 0xf0, 0x02, 0x08,
+    0x41, 0x09, 0x18, 0x09, 0x0a, 0x02, 0x19, 0x03, 0x04, 0x1a, 0x06, 0x07,
+    0x0d, 0x0a, 0x0c, 0x0d, 0x1d, 0x0a, 0x08, 0x0c, 0x07, 0x0b, 0xf0, 0x05,
+    0x0a, 0x03, 0x0b, 0x02, 0x09, 0x41, 0x0a, 0x08, 0x19, 0x0a, 0x02, 0x18,
+    0x03, 0x04, 0x19, 0x06, 0x07, 0x1b, 0x0a, 0x0e, 0x0c, 0x0b, 0x0b, 0xf0,
+    0x08, 0x0c, 0x07, 0x1b, 0x05, 0x03, 0x0d, 0x02, 0x0a, 0x51, 0x0b, 0x08,
+    0x09, 0x1a, 0x0f, 0x02, 0x0e, 0x03, 0x0d, 0x05, 0x0b, 0x06, 0x1e, 0x08,
+    0xf0, 0x0c, 0x2c, 0x0a, 0x08, 0x07, 0x0b, 0x05, 0x0c, 0x03, 0x0e, 0x02,
+    0x0b, 0x51, 0x0c, 0x08, 0x09, 0x0a, 0x0b, 0x0f, 0x02, 0x0d, 0x03, 0x0c,
+    0x05, 0x0a, 0xf0, 0x06, 0x1c, 0x08, 0x1e, 0x0a, 0x49, 0x0a, 0x08, 0x06,
+    0x04, 0x03, 0x17, 0x02, 0x41, 0x19, 0x0a, 0x0b, 0x0f, 0x02, 0x0d, 0xf0,
+    0x03, 0x0c, 0x05, 0x0a, 0x06, 0x1c, 0x08, 0x0c, 0x1b, 0x0b, 0x08, 0x0c,
+    0x07, 0x0b, 0x05, 0x0e, 0x03, 0x0f, 0x02, 0x1e, 0x51, 0x19, 0x0a, 0x0b,
+    0xf0, 0x0f, 0x02, 0x0c, 0x03, 0x0a, 0x05, 0x09, 0x06, 0x0b, 0x07, 0x0e,
+    0x1a, 0x0d, 0x1c, 0x08, 0x07, 0x0b, 0x06, 0x0a, 0x04, 0x0b, 0x03, 0x09,
+    0x02, 0x08, 0x41, 0x19, 0xf0, 0x1a, 0x0e, 0x02, 0x0b, 0x03, 0x0a, 0x04,
+    0x0c, 0x05, 0x0e, 0x07, 0x0c, 0x1b, 0x0b, 0x0c, 0x08, 0x0e, 0x07, 0x0d,
+    0x06, 0x1b, 0x04, 0x02, 0x0d, 0x21, 0x0b, 0xf0, 0x07, 0x28, 0x02, 0x33,
+    0x0b, 0x0e, 0x0d, 0x14, 0x0a, 0x0b, 0x03, 0x1e, 0x04, 0x05, 0x39, 0x04,
+    0x15, 0x24, 0x0a, 0xf0, 0x09, 0x08, 0x15, 0x09, 0x0b, 0x14, 0x0e, 0x0b,
+    0x12, 0x0f, 0x0e, 0x31, 0x0f, 0x0e, 0x09, 0x17, 0x02, 0x03, 0x09, 0x04,
+    0x0a, 0x05, 0x07, 0xc1, 0x06, 0x0a, 0x0b, 0x0e, 0x0f, 0x0f, 0x09, 0x0d,
+    0x05, 0x0a, 0x02, 0x09, 0x01, 0x08, 0x40, 0x06, 0x04, 0x13, 0x14, 0x01,
+    0xc2, 0x02, 0x06, 0x04, 0x08, 0x06, 0x0b, 0x09, 0x1e, 0x0f, 0x0e, 0x0a,
+    0x0b, 0x07, 0x05, 0x15, 0x02, 0x50, 0x04, 0x02, 0x01, 0x10, 0x13, 0x11,
+    0x04, 0x01, 0x06, 0x02, 0x02, 0x27, 0x04, 0x03, 0x07, 0x04, 0x2f, 0x07,
+    0x06, 0x0a, 0x05, 0x08, 0x04, 0x0b, 0x05, 0x03, 0x07, 0x04, 0x62, 0x04,
+    0x02, 0x02, 0x01, 0x01, 0x20, 0x20, 0x11, 0x01, 0x73, 0x02, 0x02, 0x04,
+    0x03, 0x06, 0x05, 0x2f, 0x07, 0x0b, 0x09, 0x09, 0x07, 0x06, 0x04, 0x14,
+    0x03, 0x03, 0x02, 0x21, 0x05, 0x01, 0x14, 0x30, 0x10, 0x45, 0x81, 0x01,
+    0x03, 0x04, 0x07, 0x09, 0x08, 0x0c, 0x09, 0x0b, 0x0a, 0x06, 0x0b, 0x04,
+    0x0a, 0x03, 0xf0, 0x0f, 0x12, 0x0d, 0x0a, 0x21, 0x0c, 0x09, 0x0b, 0x03,
+    0x08, 0x04, 0x29, 0x16, 0x08, 0x0b, 0x09, 0x0c, 0x07, 0x1e, 0x04, 0x02,
+    0x0d, 0x01, 0x0a, 0x30, 0x20, 0x0d, 0x1e, 0x31, 0x08, 0x01, 0x19, 0x03,
+    0x05, 0x0a, 0x1a, 0x02, 0x07, 0x23, 0x16, 0x1f, 0x45, 0x09, 0x02, 0x05,
+    0x01, 0x03, 0x50, 0x01, 0x40, 0x04, 0x13, 0x15, 0x21, 0x02, 0x06, 0x04,
+    0x39, 0x09, 0x02, 0x0d, 0x03, 0x2f, 0x04, 0x06, 0x07, 0x05, 0x16, 0x0a,
+    0x03, 0x04, 0x02, 0x05, 0x02, 0x11, 0x04, 0x40, 0x13, 0x40, 0x12, 0x43,
+    0x02, 0x03, 0x01, 0x07, 0x02, 0x09, 0x04, 0x0c, 0x05, 0x24, 0x1f, 0x0a,
+    0x0c, 0x0e, 0x0b, 0x03, 0x06, 0x0c, 0x02, 0x03, 0x0f, 0x31, 0x01, 0x09,
+    0x40, 0x06, 0x03, 0x01, 0x02, 0x00, 0x23, 0x11, 0x01, 0x03, 0x02, 0x62,
+    0x05, 0x03, 0x07, 0x04, 0x0e, 0x06, 0x1f, 0x09, 0x0a, 0x0e, 0x08, 0x08,
+    0x0b, 0x01, 0x04, 0x0f, 0xf0, 0x02, 0x0e, 0x11, 0x0b, 0x27, 0x20, 0x09,
+    0x01, 0x08, 0x02, 0x0d, 0x03, 0x0f, 0x07, 0x0e, 0x0b, 0x2f, 0x0f, 0x0d,
+    0x0a, 0x0d, 0x05, 0x0b, 0x03, 0x1c, 0xf0, 0x12, 0x18, 0x11, 0x09, 0x02,
+    0x18, 0x03, 0x14, 0x19, 0x05, 0x0d, 0x08, 0x2c, 0x0a, 0x07, 0x05, 0x0b,
+    0x03, 0x0a, 0x02, 0x08, 0x31, 0x1a, 0x60, 0x09, 0x1e, 0x02, 0x03, 0x1f,
+    0x06, 0x07, 0x28, 0x71, 0x0c, 0x0e, 0x0b, 0x07, 0x06, 0x06, 0x05, 0x04,
+    0x03, 0x13, 0x01, 0x30, 0x22, 0x42, 0x03, 0x01, 0x14, 0x02, 0x93, 0x05,
+    0x05, 0x07, 0x06, 0x0c, 0x07, 0x2f, 0x19, 0x05, 0x08, 0x03, 0x03, 0x02,
+    0x01, 0x01, 0x40, 0x30, 0x04, 0x23, 0x02, 0x22, 0x01, 0x03, 0x03, 0x15,
+    0x05, 0x03, 0x08, 0x06, 0x44, 0x2f, 0x0a, 0x0f, 0x09, 0x09, 0x06, 0x05,
+    0x03, 0x15, 0x02, 0x12, 0x50, 0x04, 0x20, 0x05, 0x03, 0x52, 0x01, 0x02,
+    0x01, 0x03, 0x02, 0x05, 0x04, 0x16, 0x08, 0x13, 0x2f, 0x08, 0x07, 0x14,
+    0x06, 0x0d, 0x03, 0x25, 0x05, 0x02, 0x03, 0x01, 0x02, 0x80, 0x16, 0x01,
+    0x20, 0x25, 0x01, 0x16, 0x03, 0x05, 0x07, 0x0a, 0x08, 0x0e, 0x61, 0x07,
+    0x1f, 0x18, 0x0b, 0x17, 0x05, 0x03, 0x06, 0x12, 0x05, 0xf0, 0x17, 0x21,
+    0x08, 0x1b, 0x02, 0x03, 0x0d, 0x04, 0x2a, 0x06, 0x0b, 0x0f, 0x09, 0x0c,
+    0x18, 0x07, 0x04, 0x07, 0x02, 0x38, 0x21, 0xf0, 0x02, 0x17, 0x03, 0x04,
+    0x09, 0x08, 0x0b, 0x0c, 0x0d, 0x1f, 0x0e, 0x0f, 0x0e, 0x0d, 0x08, 0x0a,
+    0x05, 0x09, 0x03, 0x47, 0x01, 0x30, 0x30, 0x1b, 0x01, 0x03, 0x0a, 0x09,
+    0x0c, 0x1b, 0x01, 0x09, 0x22, 0x08, 0x1f, 0x19, 0x0e, 0x01, 0x0b, 0x08,
+    0xa0, 0x0e, 0x03, 0x0b, 0x01, 0x08, 0x40, 0x06, 0x05, 0x04, 0x05, 0x18,
+    0x01, 0x04, 0x09, 0x08, 0x0c, 0x0b, 0x01, 0x1a, 0x1f, 0x02, 0x23, 0x09,
+    0x0d, 0x08, 0x08, 0x27, 0x05, 0x02, 0x03, 0x21, 0x01, 0x05, 0x40, 0x04,
+    0x50, 0x05, 0x04, 0x05, 0x07, 0x01, 0x0a, 0x03, 0x0c, 0x04, 0x11, 0x09,
+    0x08, 0x0b, 0x0c, 0x22, 0x19, 0x1f, 0x0a, 0x0b, 0x31, 0x0c, 0x05, 0x0a,
+    0x02, 0x08, 0x11, 0x07, 0xf0, 0x18, 0x20, 0x26, 0x01, 0x02, 0x08, 0x03,
+    0x0a, 0x05, 0x0c, 0x0a, 0x0d, 0x0e, 0x1f, 0x1f, 0x0d, 0x09, 0x0c, 0x05,
+    0x1b, 0x03, 0x02, 0x0d, 0x31, 0xf0, 0x0e, 0x0c, 0x09, 0x0c, 0x12, 0x0a,
+    0x2e, 0x03, 0x05, 0x17, 0x0b, 0x1c, 0x06, 0x04, 0x0e, 0x03, 0x0a, 0x42,
+    0x29, 0xe0, 0x0b, 0x0a, 0x03, 0x09, 0x05, 0x1a, 0x17, 0x2d, 0x08, 0x07,
+    0x06, 0x0c, 0x05, 0x1b, 0x03, 0x01, 0x0f, 0x40, 0x1e, 0x0d, 0xb1, 0x08,
+    0x0c, 0x01, 0x0b, 0x03, 0x0c, 0x05, 0x0d, 0x07, 0x1e, 0x0c, 0x0f, 0x0c,
+    0x0d, 0x0a, 0x07, 0x28, 0x03, 0x01, 0x50, 0x40, 0x0b, 0x07, 0x05, 0x06,
+    0x07, 0x01, 0x26, 0x01, 0x62, 0x03, 0x06, 0x07, 0x0c, 0x09, 0x1f, 0x1c,
+    0x0d, 0x0a, 0x08, 0x31, 0x0c, 0x04, 0x09, 0x01, 0x07, 0x40, 0x15, 0x40,
+    0x04, 0x15, 0x01, 0x06, 0x02, 0x11, 0x05, 0x04, 0x66, 0x06, 0x02, 0x09,
+    0x03, 0x0a, 0x14, 0x0e, 0x0b, 0x03, 0x08, 0x02, 0x04, 0x31, 0x07, 0x02,
+    0x06, 0x01, 0x15, 0x30, 0x70, 0x06, 0x05, 0x08, 0x01, 0x0a, 0x02, 0x1c,
+    0x04, 0x08, 0x0d, 0x1c, 0x0f, 0x51, 0x0b, 0x09, 0x1c, 0x07, 0x04, 0x0b,
+    0x02, 0x1a, 0x01, 0x30, 0x12, 0x07, 0x06, 0x11, 0x18, 0x01, 0xf0, 0x0d,
+    0x02, 0x0a, 0x03, 0x0c, 0x05, 0x0d, 0x07, 0x1b, 0x19, 0x09, 0x08, 0x28,
+    0x05, 0x03, 0x42, 0x0a, 0x09, 0x0a, 0x08, 0x0b, 0x03, 0x0e, 0x05, 0xe0,
+    0x1b, 0x06, 0x27, 0x0c, 0x1b, 0x06, 0x0a, 0x04, 0x0b, 0x02, 0x0d, 0x41,
+    0x09, 0x17, 0x09, 0x1c, 0x02, 0x04, 0x0e, 0x05, 0x61, 0x09, 0x07, 0x1a,
+    0x0d, 0x0f, 0x09, 0x0e, 0x08, 0x07, 0x07, 0x04, 0x06, 0x03, 0x50, 0x27,
+    0x01, 0x40, 0x06, 0x07, 0x09, 0x21, 0x07, 0x01, 0x0a, 0x03, 0x0b, 0x05,
+    0x42, 0x08, 0x0a, 0x29, 0x2f, 0x17, 0x0d, 0x01, 0x08, 0x70, 0x08, 0x03,
+    0x06, 0x01, 0x35, 0x30, 0x16, 0x01, 0x02, 0x11, 0x05, 0x04, 0x16, 0x06,
+    0x32, 0x0b, 0x07, 0x2f, 0x09, 0x0b, 0x11, 0x0d, 0x09, 0x0a, 0x05, 0xa0,
+    0x1e, 0x02, 0x01, 0x19, 0x30, 0x06, 0x05, 0x07, 0x01, 0x08, 0x02, 0x09,
+    0x04, 0x0a, 0x07, 0x0d, 0x08, 0x31, 0x09, 0x1d, 0x0a, 0x09, 0x0e, 0x08,
+    0x0b, 0xf0, 0x0a, 0x05, 0x09, 0x03, 0x18, 0x12, 0x07, 0x21, 0x08, 0x07,
+    0x09, 0x02, 0x08, 0x03, 0x19, 0x05, 0x06, 0x0a, 0x08, 0x0b, 0x17, 0x1c,
+    0x05, 0x0d, 0x03, 0xf0, 0x0c, 0x42, 0x0d, 0x1c, 0x2a, 0x03, 0x04, 0x0b,
+    0x05, 0x2a, 0x26, 0x2c, 0x05, 0x04, 0x03, 0x0a, 0x02, 0x08, 0x31, 0xf0,
+    0x09, 0x08, 0x0b, 0x0f, 0x02, 0x0d, 0x04, 0x0a, 0x06, 0x0b, 0x09, 0x0c,
+    0x2f, 0x0d, 0x0e, 0x0c, 0x08, 0x0b, 0x05, 0x09, 0x03, 0x0a, 0x01, 0x0c,
+    0x40, 0x0b, 0x20, 0x07, 0x08, 0x0c, 0x71, 0x08, 0x01, 0x09, 0x03, 0x08,
+    0x06, 0x09, 0x0b, 0x0b, 0x0e, 0x1e, 0x2f, 0x0a, 0x70, 0x0c, 0x08, 0x09,
+    0x03, 0x08, 0x01, 0x07, 0x40, 0x26, 0x07, 0x41, 0x06, 0x01, 0x08, 0x02,
+    0x0c, 0x05, 0x0b, 0x09, 0x0c, 0x0e, 0x22, 0x19, 0x0f, 0x0d, 0x07, 0x0c,
+    0x01, 0x08, 0x07, 0x90, 0x0b, 0x03, 0x0a, 0x01, 0x19, 0x30, 0x16, 0x17,
+    0x01, 0x02, 0x08, 0x04, 0x09, 0x06, 0x11, 0x16, 0x0d, 0x0f, 0x02, 0x05,
+    0x1b, 0x03, 0x04, 0x04, 0x03, 0x08, 0x05, 0x02, 0x04, 0x07, 0x01, 0x02,
+    0x1f, 0xf0, 0x51, 0x0b, 0x08, 0x06, 0x08, 0x0c, 0x02, 0x0e, 0x04, 0x0b,
+    0x06, 0x1a, 0x09, 0x18, 0x2b, 0x07, 0x05, 0x09, 0x03, 0x0a, 0x32, 0x0e,
+    0xf0, 0x0b, 0x1a, 0x13, 0x09, 0x0c, 0x04, 0x0a, 0x15, 0x09, 0x0a, 0x06,
+    0x1b, 0x05, 0x04, 0x0c, 0x03, 0x0e, 0x02, 0x0d, 0x21, 0x0e, 0x0a, 0x0d,
+    0xf0, 0x02, 0x09, 0x03, 0x08, 0x04, 0x19, 0x06, 0x08, 0x0a, 0x2e, 0x0b,
+    0x0c, 0x1b, 0x07, 0x04, 0x0c, 0x03, 0x0b, 0x02, 0x09, 0x01, 0x07, 0x20,
+    0x19, 0x0e, 0x40, 0x01, 0x0a, 0x02, 0x1b, 0x04, 0x08, 0x0c, 0x0d, 0x08,
+    0x41, 0x0e, 0x0a, 0x1f, 0x0c, 0x09, 0x0a, 0x07, 0x06, 0x0c, 0x60, 0x03,
+    0x0a, 0x01, 0x18, 0x40, 0x06, 0x07, 0x08, 0x17, 0x91, 0x01, 0x02, 0x0a,
+    0x04, 0x0e, 0x06, 0x2f, 0x0e, 0x0f, 0x0b, 0x0e, 0x08, 0x0b, 0x05, 0x09,
+    0x03, 0x0e, 0xf0, 0x01, 0x0c, 0x30, 0x0a, 0x17, 0x08, 0x01, 0x17, 0x02,
+    0x04, 0x08, 0x06, 0x0a, 0x0b, 0x0d, 0x2f, 0x3f, 0x0c, 0x06, 0x0d, 0x03,
+    0x0c, 0xf0, 0x02, 0x09, 0x41, 0x0c, 0x09, 0x06, 0x07, 0x09, 0x02, 0x0b,
+    0x03, 0x0c, 0x05, 0x0a, 0x07, 0x0c, 0x28, 0x0a, 0x1b, 0x06, 0x1a, 0x04,
+    0x03, 0x09, 0xf0, 0x42, 0x1c, 0x0a, 0x0e, 0x0f, 0x03, 0x0b, 0x14, 0x09,
+    0x0b, 0x15, 0x0d, 0x0b, 0x14, 0x0c, 0x0b, 0x03, 0x0c, 0x22, 0x0b, 0x08,
+    0x17, 0xf0, 0x13, 0x09, 0x04, 0x18, 0x05, 0x06, 0x0a, 0x28, 0x0b, 0x0d,
+    0x0e, 0x06, 0x0c, 0x04, 0x0b, 0x03, 0x0d, 0x02, 0x0e, 0x01, 0x0c, 0x20,
+    0x0f, 0x0c, 0x0f, 0x30, 0x01, 0x0c, 0x02, 0x0a, 0x04, 0x09, 0x06, 0x16,
+    0xf1, 0x0b, 0x0d, 0x07, 0x0f, 0x08, 0x0d, 0x39, 0x07, 0x04, 0x02, 0x01,
+    0x16, 0x40, 0x14, 0x05, 0x07, 0x01, 0x06, 0x02, 0x08, 0x04, 0x19, 0x61,
+    0x07, 0x0e, 0x0b, 0x0f, 0x0e, 0x0d, 0x0b, 0x09, 0x09, 0x07, 0x07, 0x04,
+    0x0d, 0x80, 0x02, 0x09, 0x01, 0x06, 0x30, 0x17, 0x08, 0x0d, 0x01, 0x0b,
+    0x02, 0x0f, 0x04, 0x17, 0xa1, 0x07, 0x2e, 0x08, 0x29, 0x0a, 0x06, 0x18,
+    0x03, 0x01, 0x0a, 0x30, 0x0b, 0x08, 0x0c, 0xf0, 0x0b, 0x01, 0x07, 0x02,
+    0x08, 0x03, 0x09, 0x04, 0x2b, 0x07, 0x19, 0x1c, 0x0a, 0x08, 0x0b, 0x06,
+    0x0a, 0x04, 0x09, 0x52, 0x0c, 0x0a, 0x29, 0xf0, 0x0b, 0x03, 0x09, 0x04,
+    0x48, 0x06, 0x07, 0x26, 0x07, 0x04, 0x18, 0x03, 0x32, 0x09, 0x0b, 0x1f,
+    0x03, 0x0d, 0xf0, 0x04, 0x0c, 0x05, 0x0e, 0x06, 0x0c, 0x17, 0x0a, 0x19,
+    0x05, 0x04, 0x0a, 0x03, 0x0b, 0x02, 0x0a, 0x21, 0x0b, 0x07, 0x08, 0x12,
+    0x07, 0x09, 0x03, 0x1b, 0x05, 0xe0, 0x07, 0x0d, 0x0a, 0x0e, 0x0c, 0x1f,
+    0x0f, 0x0b, 0x0e, 0x06, 0x0c, 0x04, 0x0a, 0x02, 0x0b, 0x01, 0x0a, 0x30,
+    0x0b, 0x08, 0x0a, 0x0f, 0x01, 0x0b, 0x02, 0x07, 0x81, 0x03, 0x09, 0x05,
+    0x0b, 0x08, 0x0c, 0x1f, 0x0a, 0x09, 0x0e, 0x07, 0x0a, 0x06, 0x06, 0x05,
+    0x03, 0x28, 0x80, 0x01, 0x30, 0x07, 0x08, 0x0a, 0x01, 0x09, 0x02, 0x0a,
+    0x04, 0x0b, 0x06, 0x07, 0x81, 0x0a, 0x08, 0x1e, 0x1a, 0x09, 0x0b, 0x06,
+    0x0a, 0x04, 0x18, 0x02, 0x01, 0x06, 0x30, 0x0f, 0xf0, 0x0c, 0x09, 0x0e,
+    0x01, 0x0a, 0x02, 0x0b, 0x03, 0x1e, 0x05, 0x09, 0x0c, 0x0b, 0x0d, 0x0c,
+    0x0c, 0x0d, 0x2a, 0x09, 0x05, 0x03, 0x29, 0x52, 0xf0, 0x27, 0x19, 0x03,
+    0x04, 0x0a, 0x06, 0x09, 0x17, 0x18, 0x16, 0x09, 0x08, 0x05, 0x07, 0x04,
+    0x06, 0x33, 0x07, 0x18, 0xf0, 0x09, 0x04, 0x18, 0x45, 0x1a, 0x0c, 0x0b,
+    0x14, 0x0d, 0x09, 0x03, 0x0a, 0x02, 0x0b, 0x21, 0x0d, 0x0a, 0x0e, 0x02,
+    0x0a, 0x03, 0x09, 0xd0, 0x04, 0x0b, 0x05, 0x0c, 0x07, 0x0d, 0x0a, 0x0c,
+    0x0d, 0x2d, 0x0b, 0x06, 0x04, 0x0c, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x08,
+    0x30, 0x0a, 0x0b, 0x07, 0xf1, 0x1a, 0x01, 0x02, 0x1b, 0x04, 0x06, 0x2e,
+    0x08, 0x0a, 0x08, 0x0c, 0x06, 0x0a, 0x05, 0x07, 0x03, 0x16, 0x01, 0x40,
+    0x05, 0x04, 0x15, 0x91, 0x08, 0x01, 0x07, 0x02, 0x19, 0x04, 0x06, 0x0a,
+    0x0b, 0x0b, 0x0d, 0x0c, 0x0c, 0x09, 0x0a, 0x07, 0x07, 0x0e, 0xf0, 0x04,
+    0x0b, 0x02, 0x09, 0x01, 0x06, 0x10, 0x08, 0x07, 0x01, 0x06, 0x02, 0x0a,
+    0x03, 0x0d, 0x04, 0x0e, 0x05, 0x0c, 0x26, 0x1b, 0x3a, 0x05, 0x06, 0x05,
+    0xb0, 0x13, 0x0d, 0x0c, 0x05, 0x1d, 0x06, 0x04, 0x0c, 0x03, 0x0a, 0x02,
+    0x08, 0x01, 0x0b, 0x20, 0x0f, 0x0a, 0x0f, 0x01, 0x08, 0x21, 0x02, 0x0b,
+    0x04, 0x0f, 0x0a, 0x09, 0x12, 0x0f, 0x0a, 0x0c, 0x0d, 0xe1, 0x06, 0x08,
+    0x03, 0x06, 0x01, 0x15, 0x20, 0x03, 0x04, 0x01, 0x16, 0x03, 0x05, 0x09,
+    0x0c, 0x0a, 0x0f, 0x0b, 0x0d, 0x08, 0x08, 0x05, 0x03, 0x04, 0x01, 0x02,
+    0x02, 0x20, 0x01, 0x03, 0x10, 0x04, 0x16, 0x01, 0x01, 0x03, 0x02, 0x05,
+    0x06, 0x04, 0x24, 0x0d, 0x08, 0x1f, 0x0f, 0x0e, 0x03, 0x07, 0x0a, 0x02,
+    0x03, 0x07, 0x51, 0x11, 0x04, 0x01, 0x10, 0x10, 0x01, 0x01, 0x02, 0x02,
+    0x72, 0x04, 0x04, 0x09, 0x07, 0x1f, 0x1f, 0x0a, 0x0d, 0x04, 0x0a, 0x02,
+    0x07, 0x01, 0x09, 0xf1, 0x10, 0x07, 0x35, 0x01, 0x02, 0x03, 0x04, 0x06,
+    0x08, 0x25, 0x06, 0x03, 0x01, 0x06, 0x20, 0x17, 0x09, 0x01, 0x0a, 0x04,
+    0x0b, 0x08, 0x0f, 0x01, 0x0d, 0x0b, 0x32, 0x1f, 0x0f, 0x0e, 0x06, 0x08,
+    0x02, 0x07, 0x21, 0x40, 0x04, 0x01, 0x10, 0x22, 0x01, 0x01, 0x02, 0x13,
+    0x03, 0x05, 0x06, 0x07, 0x04, 0x2f, 0x0a, 0x05, 0x0f, 0x06, 0x09, 0x05,
+    0x08, 0x06, 0x24, 0x03, 0x03, 0x01, 0x21, 0x30, 0x02, 0x01, 0x03, 0x10,
+    0x16, 0x01, 0xf1, 0x03, 0x07, 0x06, 0x0c, 0x1f, 0x1f, 0x09, 0x0c, 0x04,
+    0x18, 0x01, 0x20, 0x09, 0x16, 0x01, 0x05, 0x02, 0x07, 0x04, 0x08, 0x06,
+    0x0a, 0x1d, 0x09, 0x18, 0xf1, 0x05, 0x02, 0x07, 0x30, 0x08, 0x36, 0x01,
+    0x03, 0x37, 0x05, 0x07, 0x0b, 0x0e, 0x06, 0x0b, 0x15, 0x04, 0x01, 0x06,
+    0x20, 0x17, 0xa1, 0x18, 0x01, 0x03, 0x19, 0x05, 0x08, 0x0a, 0x0f, 0x0b,
+    0x0c, 0x09, 0x05, 0x07, 0x02, 0x05, 0x30, 0x07, 0x40, 0x05, 0x04, 0x05,
+    0x01, 0x18, 0x03, 0x01, 0x05, 0x0a, 0x02, 0x08, 0x0c, 0x03, 0x1f, 0x1f,
+    0x14, 0x09, 0x0b, 0x03, 0x04, 0x08, 0x02, 0x01, 0x07, 0x31, 0x30, 0x03,
+    0x01, 0x10, 0x12, 0x01, 0x11, 0x03, 0x43, 0x05, 0x03, 0x0a, 0x06, 0x1f,
+    0x0c, 0x1d, 0x0d, 0x02, 0x05, 0x0e, 0xf1, 0x02, 0x0a, 0x01, 0x17, 0x30,
+    0x05, 0x06, 0x39, 0x01, 0x03, 0x04, 0x03, 0x0c, 0x02, 0x0b, 0x01, 0x08,
+    0x10, 0x0b, 0x0e, 0x01, 0x28, 0x02, 0x51, 0x05, 0x0a, 0x0a, 0x0e, 0x0d,
+    0x1f, 0x0e, 0x08, 0x08, 0x0a, 0x40, 0x04, 0x06, 0x01, 0x04, 0x30, 0x13,
+    0x02, 0x21, 0x04, 0x01, 0x09, 0x04, 0x28, 0x02, 0x07, 0x03, 0x1f, 0x44,
+    0x0d, 0x0e, 0x07, 0x06, 0x04, 0x02, 0x02, 0x30, 0x01, 0x15, 0x40, 0x03,
+    0x04, 0x01, 0x06, 0x03, 0x38, 0x05, 0x01, 0x09, 0x02, 0x0f, 0x13, 0x0c,
+    0x27, 0x06, 0x02, 0x03, 0x21, 0x01, 0x05, 0x20, 0x04, 0x40, 0x15, 0x01,
+    0x08, 0x03, 0x0d, 0x06, 0x0f, 0x0b, 0x01, 0x0d, 0x1f, 0x12, 0x0a, 0x09,
+    0x08, 0x01, 0x0b, 0x04, 0xf0, 0x0e, 0x01, 0x0d, 0x20, 0x0a, 0x17, 0x01,
+    0x06, 0x02, 0x09, 0x03, 0x1d, 0x07, 0x1f, 0x0e, 0x0d, 0x0c, 0x0b, 0x05,
+    0x0a, 0x03, 0x08, 0x22, 0x19, 0xc0, 0x0a, 0x03, 0x09, 0x06, 0x28, 0x09,
+    0x0c, 0x0d, 0x27, 0x06, 0x03, 0x01, 0x08, 0x20, 0x17, 0x1a, 0x01, 0x03,
+    0x01, 0x07, 0x06, 0x03, 0x05, 0x0e, 0x05, 0x14, 0x2f, 0x07, 0x0c, 0x13,
+    0x06, 0x07, 0x15, 0x02, 0x02, 0x71, 0x40, 0x03, 0x21, 0x03, 0x02, 0x04,
+    0x05, 0x06, 0x0a, 0x07, 0x02, 0x2f, 0x09, 0x13, 0x2f, 0x02, 0x07, 0x11,
+    0x03, 0x19, 0x02, 0xf0, 0x01, 0x17, 0x10, 0x16, 0x01, 0x02, 0x07, 0x03,
+    0x0a, 0x06, 0x0b, 0x18, 0x1d, 0x05, 0x1e, 0x03, 0x22, 0x0f, 0x0d, 0x0b,
+    0x03, 0x09, 0x04, 0x0c, 0xc0, 0x05, 0x1d, 0x06, 0x0a, 0x0b, 0x0c, 0x19,
+    0x06, 0x03, 0x08, 0x01, 0x07, 0x20, 0x0a, 0x0b, 0x0f, 0x01, 0x1e, 0x03,
+    0x06, 0x07, 0xf1, 0x0b, 0x08, 0x0f, 0x0b, 0x0c, 0x0a, 0x06, 0x19, 0x03,
+    0x01, 0x07, 0x30, 0x06, 0x15, 0x07, 0x01, 0x1b, 0x03, 0x06, 0x1c, 0x0e,
+    0x0f, 0x0a, 0x09, 0x09, 0x81, 0x04, 0x08, 0x01, 0x07, 0x30, 0x04, 0x13,
+    0x04, 0x01, 0x06, 0x03, 0x09, 0x06, 0x07, 0x32, 0x0d, 0x0b, 0x1f, 0x0f,
+    0x1c, 0x09, 0xf1, 0x03, 0x07, 0x01, 0x15, 0x30, 0x03, 0x02, 0x13, 0x02,
+    0x04, 0x04, 0x08, 0x05, 0x0c, 0x08, 0x0d, 0x0a, 0x0c, 0x1b, 0x05, 0x03,
+    0x0a, 0x02, 0x0b, 0x21, 0x0c, 0x71, 0x08, 0x09, 0x42, 0x17, 0x09, 0x0c,
+    0x09, 0x01, 0x16, 0xa2, 0x30, 0x04, 0x05, 0x17, 0x01, 0x03, 0x08, 0x06,
+    0x09, 0x0a, 0x0a, 0x0f, 0x0b, 0x0e, 0x0a, 0x06, 0x05, 0x13, 0x03, 0x03,
+    0x01, 0x01, 0x14, 0x40, 0x30, 0x13, 0x44, 0x02, 0x02, 0x03, 0x05, 0x04,
+    0x0c, 0x06, 0x1f, 0x0e, 0x13, 0x1a, 0x0c, 0x12, 0x05, 0x06, 0x01, 0x08,
+    0x01, 0x30, 0x0b, 0xf0, 0x06, 0x05, 0x07, 0x01, 0x19, 0x03, 0x06, 0x0b,
+    0x1f, 0x0c, 0x1f, 0x0c, 0x06, 0x0e, 0x02, 0x1f, 0x31, 0x0d, 0x09, 0x0c,
+    0x02, 0x2e, 0xf0, 0x04, 0x07, 0x0d, 0x0c, 0x0e, 0x0b, 0x08, 0x1a, 0x04,
+    0x02, 0x07, 0x31, 0x08, 0x09, 0x08, 0x0d, 0x03, 0x0b, 0x05, 0x1c, 0x07,
+    0x0a, 0x0b, 0x08, 0x0d, 0xf0, 0x07, 0x0b, 0x04, 0x0a, 0x02, 0x08, 0x11,
+    0x09, 0x0b, 0x02, 0x18, 0x03, 0x06, 0x09, 0x09, 0x0a, 0x0d, 0x0c, 0x0f,
+    0x0e, 0x0a, 0x0d, 0x05, 0x0a, 0x02, 0x18, 0x30, 0x16, 0x30, 0x09, 0x01,
+    0x0b, 0x03, 0x08, 0x11, 0x07, 0x0c, 0x0d, 0x0a, 0x02, 0x1f, 0x0c, 0x43,
+    0x09, 0x0c, 0x05, 0x06, 0x03, 0x03, 0x21, 0x01, 0x12, 0x20, 0x20, 0x03,
+    0x04, 0x01, 0x15, 0x02, 0x11, 0x05, 0x16, 0x09, 0x62, 0x1f, 0x07, 0x08,
+    0x0e, 0x07, 0x05, 0x26, 0x02, 0x41, 0x01, 0x07, 0xf0, 0x19, 0x0c, 0x02,
+    0x0b, 0x34, 0x09, 0x0b, 0x0a, 0x08, 0x03, 0x07, 0x12, 0x08, 0x1b, 0x03,
+    0x04, 0x0a, 0x07, 0x0b, 0x0e, 0x0e, 0x1f, 0x0f, 0xa0, 0x0e, 0x09, 0x0c,
+    0x05, 0x0a, 0x03, 0x08, 0x01, 0x06, 0x20, 0x15, 0x08, 0x01, 0x07, 0x03,
+    0x08, 0x08, 0x0b, 0x0c, 0x01, 0x09, 0x1f, 0x32, 0x08, 0x09, 0x0a, 0x07,
+    0x05, 0x06, 0x02, 0x11, 0x07, 0x30, 0x06, 0x50, 0x18, 0x09, 0x01, 0x1a,
+    0x03, 0x06, 0x0c, 0x09, 0x61, 0x08, 0x0f, 0x09, 0x0d, 0x08, 0x07, 0x17,
+    0x03, 0x01, 0x16, 0x20, 0x40, 0x19, 0x01, 0x2b, 0x03, 0x06, 0x09, 0x21,
+    0x18, 0x0f, 0x0d, 0x09, 0x0c, 0xf0, 0x0e, 0x05, 0x0c, 0x02, 0x0a, 0x31,
+    0x08, 0x17, 0x09, 0x02, 0x08, 0x03, 0x09, 0x05, 0x1a, 0x08, 0x17, 0x1b,
+    0x05, 0x0a, 0x03, 0x09, 0x12, 0x0d, 0xb0, 0x0f, 0x03, 0x0d, 0x04, 0x0a,
+    0x05, 0x0c, 0x06, 0x0d, 0x07, 0x0b, 0x06, 0x0a, 0x03, 0x0c, 0x02, 0x19,
+    0x01, 0x20, 0x17, 0x21, 0x16, 0x01, 0x03, 0x07, 0x06, 0x02, 0x16, 0x0c,
+    0x03, 0x2e, 0x15, 0x45, 0x03, 0x07, 0x02, 0x03, 0x01, 0x01, 0x30, 0x04,
+    0x30, 0x13, 0x24, 0x01, 0x01, 0x52, 0x03, 0x05, 0x07, 0x06, 0x1f, 0x08,
+    0x1a, 0x0d, 0x08, 0x31, 0x0d, 0x03, 0x0b, 0x01, 0x0a, 0x20, 0x0b, 0xf0,
+    0x0e, 0x0b, 0x01, 0x18, 0x02, 0x03, 0x09, 0x05, 0x0a, 0x06, 0x09, 0x07,
+    0x48, 0x06, 0x04, 0x23, 0x19, 0x04, 0x05, 0x1b, 0x06, 0x07, 0xf0, 0x0a,
+    0x09, 0x09, 0x08, 0x28, 0x05, 0x03, 0x01, 0x09, 0x10, 0x0b, 0x0e, 0x01,
+    0x0b, 0x02, 0x0c, 0x04, 0x0b, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x0f, 0x0b,
+    0x0e, 0x06, 0x0b, 0x04, 0xf0, 0x0a, 0x02, 0x09, 0x21, 0x16, 0x28, 0x02,
+    0x04, 0x06, 0x0b, 0x0b, 0x0e, 0x1f, 0x0f, 0x0c, 0x09, 0x0a, 0x05, 0x09,
+    0x02, 0x18, 0x30, 0x06, 0x00, 0x09, 0x81, 0x07, 0x01, 0x09, 0x03, 0x0a,
+    0x06, 0x0b, 0x0e, 0x1e, 0x0f, 0x0e, 0x0d, 0x07, 0x0b, 0x03, 0x08, 0x01,
+    0xf0, 0x1d, 0x30, 0x08, 0x07, 0x09, 0x01, 0x0b, 0x03, 0x09, 0x06, 0x6a,
+    0x0b, 0x0d, 0x0f, 0x09, 0x05, 0x04, 0x73, 0x0c, 0x0a, 0x70, 0x0b, 0x0c,
+    0x2b, 0x09, 0x02, 0x0a, 0x01, 0x0d, 0x10, 0x81, 0x07, 0x18, 0x01, 0x02,
+    0x09, 0x04, 0x0a, 0x07, 0x0c, 0x0b, 0x0d, 0x1f, 0x0e, 0x19, 0x0c, 0x80,
+    0x05, 0x07, 0x02, 0x06, 0x01, 0x14, 0x20, 0x05, 0x07, 0x01, 0x08, 0x03,
+    0x0c, 0x05, 0x01, 0x09, 0x09, 0x52, 0x08, 0x0f, 0x29, 0x0b, 0x07, 0x04,
+    0x08, 0x01, 0x07, 0x30, 0x01, 0x08, 0xf0, 0x1a, 0x0e, 0x01, 0x0b, 0x03,
+    0x08, 0x05, 0x3a, 0x0a, 0x0c, 0x0b, 0x08, 0x09, 0x04, 0x08, 0x32, 0x09,
+    0x08, 0x17, 0x03, 0x08, 0x04, 0xf0, 0x0a, 0x06, 0x0c, 0x18, 0x0d, 0x0c,
+    0x07, 0x1a, 0x05, 0x02, 0x0e, 0x31, 0x0c, 0x0d, 0x0e, 0x1f, 0x02, 0x04,
+    0x0b, 0x05, 0x1c, 0x16, 0x0b, 0x05, 0xf0, 0x1c, 0x04, 0x02, 0x1e, 0x11,
+    0x0f, 0x02, 0x0c, 0x03, 0x6b, 0x05, 0x07, 0x09, 0x0d, 0x08, 0x04, 0x02,
+    0x0a, 0x01, 0x27, 0x20, 0x00, 0x11, 0x26, 0x01, 0x02, 0x42, 0x04, 0x08,
+    0x07, 0x4a, 0x1f, 0x0d, 0x01, 0x0a, 0x70, 0x04, 0x07, 0x01, 0x06, 0x20,
+    0x05, 0x04, 0x25, 0x01, 0x03, 0x05, 0x01, 0x24, 0x08, 0x02, 0x0c, 0x03,
+    0x1d, 0x04, 0x03, 0x06, 0x02, 0x07, 0x0a, 0x11, 0x03, 0x09, 0x12, 0x0f,
+    0xf0, 0x0c, 0x21, 0x0f, 0x0c, 0x0d, 0x02, 0x09, 0x43, 0x0a, 0x1e, 0x0d,
+    0x1a, 0x12, 0x1b, 0x03, 0x04, 0x19, 0x06, 0x0a, 0x0a, 0xb0, 0x1f, 0x19,
+    0x0c, 0x08, 0x07, 0x07, 0x05, 0x06, 0x03, 0x15, 0x01, 0x10, 0x07, 0x0a,
+    0x01, 0x08, 0x02, 0x0a, 0x04, 0x07, 0x51, 0x06, 0x09, 0x0a, 0x1a, 0x0f,
+    0x0d, 0x08, 0x08, 0x06, 0x04, 0x0b, 0xf0, 0x01, 0x1e, 0x20, 0x0c, 0x0e,
+    0x01, 0x0a, 0x02, 0x1e, 0x04, 0x08, 0x0c, 0x1f, 0x0e, 0x0c, 0x08, 0x0d,
+    0x05, 0x0c, 0x02, 0x0d, 0x01, 0x08, 0x10, 0x0e, 0x0c, 0xf0, 0x01, 0x09,
+    0x02, 0x0d, 0x04, 0x0c, 0x08, 0x0b, 0x1f, 0x0d, 0x0f, 0x0d, 0x0e, 0x08,
+    0x0b, 0x04, 0x09, 0x02, 0x07, 0x31, 0x09, 0x18, 0x0b, 0x02, 0x09, 0x03,
+    0x0c, 0xf0, 0x05, 0x0e, 0x26, 0x0c, 0x1d, 0x04, 0x0e, 0x13, 0x0b, 0x0a,
+    0x24, 0x19, 0x0b, 0x25, 0x0a, 0x0b, 0x0a, 0x04, 0x09, 0x12, 0x0d, 0x09,
+    0x20, 0x01, 0x08, 0x10, 0x0b, 0x07, 0x81, 0x01, 0x06, 0x02, 0x07, 0x04,
+    0x09, 0x08, 0x0b, 0x0e, 0x0e, 0x1f, 0x0f, 0x0b, 0x08, 0x08, 0x04, 0x0e,
+    0x80, 0x01, 0x0c, 0x30, 0x06, 0x04, 0x05, 0x07, 0x01, 0x08, 0x03, 0x09,
+    0x06, 0x0e, 0x0c, 0x09, 0x71, 0x1f, 0x0e, 0x0d, 0x0b, 0x1b, 0x05, 0x02,
+    0x0a, 0x01, 0x07, 0x20, 0x08, 0x0d, 0xf0, 0x0f, 0x01, 0x0c, 0x02, 0x1a,
+    0x04, 0x05, 0x0d, 0x16, 0x2b, 0x05, 0x04, 0x28, 0x33, 0x09, 0x0c, 0x04,
+    0x0b, 0x05, 0x0a, 0x06, 0x1b, 0xf0, 0x07, 0x05, 0x0c, 0x04, 0x0b, 0x03,
+    0x08, 0x21, 0x0b, 0x08, 0x0a, 0x02, 0x09, 0x03, 0x18, 0x05, 0x07, 0x4a,
+    0x0b, 0x0d, 0x07, 0x05, 0x04, 0x09, 0xf0, 0x02, 0x18, 0x11, 0x09, 0x02,
+    0x07, 0x03, 0x18, 0x05, 0x08, 0x09, 0x0d, 0x3a, 0x0f, 0x0b, 0x06, 0x03,
+    0x0b, 0x01, 0x09, 0x20, 0x08, 0x09, 0x0e, 0x30, 0x01, 0x0b, 0x03, 0x0c,
+    0x06, 0x0d, 0x0b, 0x08, 0x31, 0x1f, 0x0b, 0x0c, 0x0e, 0x08, 0x07, 0x0d,
+    0xf0, 0x03, 0x0a, 0x01, 0x09, 0x20, 0x0a, 0x08, 0x17, 0x01, 0x02, 0x19,
+    0x04, 0x07, 0x0c, 0x0a, 0x1d, 0x1d, 0x0e, 0x07, 0x0d, 0x04, 0x0e, 0x53,
+    0x0c, 0x0a, 0xf0, 0x38, 0x04, 0x07, 0x05, 0x16, 0x04, 0x03, 0x08, 0x02,
+    0x09, 0x01, 0x0c, 0x02, 0x08, 0x03, 0x09, 0x04, 0x0d, 0x07, 0x0c, 0x0c,
+    0x0d, 0x1f, 0x1f, 0x80, 0x0b, 0x0d, 0x05, 0x0b, 0x03, 0x19, 0x01, 0x30,
+    0x07, 0x06, 0x08, 0x07, 0x91, 0x01, 0x08, 0x03, 0x09, 0x06, 0x0a, 0x0e,
+    0x1b, 0x0f, 0x0e, 0x09, 0x0a, 0x27, 0x04, 0x01, 0x20, 0x2e, 0xf0, 0x01,
+    0x08, 0x02, 0x0a, 0x03, 0x0d, 0x06, 0x0c, 0x19, 0x0d, 0x0e, 0x08, 0x0d,
+    0x05, 0x0c, 0x03, 0x09, 0x22, 0x08, 0x07, 0x06, 0x03, 0x15, 0x05, 0xf0,
+    0x07, 0x16, 0x0c, 0x0f, 0x07, 0x0c, 0x08, 0x08, 0x19, 0x05, 0x03, 0x18,
+    0x32, 0x17, 0x19, 0x13, 0x0e, 0x04, 0x0d, 0x25, 0x1e, 0xf0, 0x0b, 0x04,
+    0x0c, 0x03, 0x09, 0x12, 0x0a, 0x0d, 0x03, 0x19, 0x04, 0x05, 0x1a, 0x06,
+    0x17, 0x0b, 0x0d, 0x05, 0x0a, 0x03, 0x09, 0x02, 0x08, 0x01, 0x07, 0x10,
+    0x0a, 0x30, 0x0e, 0x01, 0x0a, 0x02, 0x0d, 0x04, 0x08, 0x51, 0x06, 0x0b,
+    0x0b, 0x0e, 0x0f, 0x0f, 0x0d, 0x0c, 0x08, 0x08, 0x05, 0x0c, 0x70, 0x02,
+    0x18, 0x30, 0x05, 0x06, 0x28, 0x01, 0x03, 0x05, 0x06, 0x41, 0x09, 0x08,
+    0x0d, 0x09, 0x1f, 0x08, 0x07, 0x07, 0x0d, 0xf0, 0x04, 0x09, 0x03, 0x18,
+    0x02, 0x11, 0x0a, 0x09, 0x02, 0x17, 0x03, 0x04, 0x58, 0x25, 0x04, 0x23,
+    0x09, 0x0b, 0x04, 0x09, 0xf0, 0x05, 0x0c, 0x06, 0x0e, 0x17, 0x1c, 0x06,
+    0x0b, 0x05, 0x19, 0x03, 0x02, 0x07, 0x11, 0x16, 0x02, 0x15, 0x03, 0x04,
+    0x07, 0x07, 0x08, 0x0a, 0x0a, 0x1f, 0x1e, 0xf0, 0x0a, 0x0b, 0x06, 0x1a,
+    0x03, 0x31, 0x0c, 0x17, 0x0a, 0x02, 0x09, 0x03, 0x0e, 0x05, 0x0d, 0x0a,
+    0x1c, 0x0f, 0x0a, 0x0b, 0x07, 0x1a, 0x04, 0xf0, 0x02, 0x08, 0x21, 0x07,
+    0x06, 0x27, 0x02, 0x04, 0x06, 0x09, 0x09, 0x0d, 0x1f, 0x1e, 0x0b, 0x1d,
+    0x06, 0x02, 0x0f, 0x31, 0x0c, 0x09, 0x17, 0xf0, 0x02, 0x06, 0x03, 0x07,
+    0x05, 0x08, 0x07, 0x19, 0x18, 0x0a, 0x07, 0x0b, 0x04, 0x0e, 0x33, 0x0d,
+    0x0e, 0x0c, 0x0b, 0x34, 0x09, 0x3a, 0x60, 0x13, 0x08, 0x02, 0x09, 0x21,
+    0x0a, 0x08, 0x16, 0xf1, 0x02, 0x03, 0x07, 0x05, 0x09, 0x08, 0x0a, 0x0d,
+    0x19, 0x0f, 0x0a, 0x08, 0x05, 0x07, 0x03, 0x05, 0x01, 0x14, 0x30, 0x03,
+    0x04, 0x06, 0x01, 0x07, 0x03, 0x08, 0x51, 0x05, 0x2b, 0x0c, 0x0f, 0x0e,
+    0x09, 0x09, 0x08, 0x05, 0x0e, 0xf0, 0x02, 0x0d, 0x31, 0x0a, 0x17, 0x09,
+    0x02, 0x08, 0x03, 0x09, 0x05, 0x3a, 0x27, 0x05, 0x0b, 0x03, 0x0a, 0x32,
+    0x2e, 0xf0, 0x0f, 0x03, 0x0e, 0x04, 0x0d, 0x16, 0x0b, 0x0c, 0x05, 0x1b,
+    0x04, 0x02, 0x0f, 0x11, 0x0e, 0x0c, 0x12, 0x08, 0x0a, 0x03, 0x09, 0x04,
+    0x0c, 0x06, 0x1a, 0x08, 0xf0, 0x07, 0x0b, 0x05, 0x0c, 0x04, 0x0e, 0x03,
+    0x0b, 0x21, 0x0f, 0x0c, 0x0f, 0x02, 0x2b, 0x03, 0x05, 0x06, 0x0e, 0x08,
+    0x2d, 0x09, 0x06, 0x04, 0x0a, 0x02, 0x0b, 0x30, 0x30, 0x0f, 0x0b, 0x0f,
+    0x19, 0x71, 0x01, 0x03, 0x18, 0x06, 0x0a, 0x09, 0x1f, 0x0a, 0x08, 0x0a,
+    0x06, 0x05, 0x0b, 0xf0, 0x02, 0x0a, 0x01, 0x07, 0x20, 0x09, 0x08, 0x0a,
+    0x01, 0x0b, 0x02, 0x0e, 0x05, 0x1a, 0x0a, 0x0d, 0x0c, 0x0f, 0x1b, 0x0e,
+    0x07, 0x2a, 0x04, 0x13, 0x08, 0xf0, 0x32, 0x2a, 0x1d, 0x33, 0x0b, 0x1a,
+    0x12, 0x0c, 0x0a, 0x03, 0x08, 0x04, 0x09, 0x05, 0x0a, 0x08, 0x29, 0x0d,
+    0x0f, 0xf0, 0x0d, 0x1a, 0x07, 0x04, 0x09, 0x02, 0x0c, 0x01, 0x08, 0x20,
+    0x19, 0x0f, 0x01, 0x0d, 0x03, 0x0a, 0x06, 0x0b, 0x0c, 0x0d, 0x1f, 0x1f,
+    0x0d, 0x0e, 0x07, 0x0c, 0xf0, 0x03, 0x0b, 0x31, 0x0a, 0x17, 0x08, 0x02,
+    0x07, 0x03, 0x19, 0x05, 0x08, 0x0b, 0x0a, 0x0d, 0x09, 0x0c, 0x06, 0x0e,
+    0x04, 0x0b, 0x02, 0x0c, 0x21, 0x0e, 0x0b, 0xf0, 0x0a, 0x02, 0x09, 0x03,
+    0x0c, 0x04, 0x0e, 0x07, 0x1c, 0x19, 0x1a, 0x07, 0x05, 0x28, 0x03, 0x32,
+    0x17, 0x09, 0x13, 0x08, 0x0b, 0xf0, 0x04, 0x0d, 0x06, 0x0b, 0x15, 0x0d,
+    0x1c, 0x04, 0x23, 0x09, 0x08, 0x09, 0x24, 0x08, 0x09, 0x0d, 0x05, 0x1b,
+    0x06, 0x05, 0x0d, 0x03, 0x0e, 0x02, 0x06, 0xc1, 0x01, 0x07, 0x20, 0x08,
+    0x07, 0x0a, 0x01, 0x08, 0x02, 0x1a, 0x04, 0x07, 0x2b, 0x0c, 0x0d, 0x08,
+    0x0a, 0x05, 0x08, 0x03, 0x0c, 0xf0, 0x01, 0x09, 0x30, 0x17, 0x08, 0x0d,
+    0x01, 0x0f, 0x03, 0x0e, 0x06, 0x3f, 0x0e, 0x1f, 0x0c, 0x0e, 0x05, 0x0d,
+    0x03, 0x1a, 0x02, 0x21, 0x0c, 0xf0, 0x08, 0x0a, 0x02, 0x18, 0x03, 0x04,
+    0x0a, 0x25, 0x19, 0x0a, 0x04, 0x09, 0x23, 0x0a, 0x1b, 0x04, 0x09, 0x25,
+    0x0a, 0x0c, 0x0d, 0xf0, 0x16, 0x0a, 0x09, 0x04, 0x0a, 0x03, 0x09, 0x02,
+    0x07, 0x11, 0x08, 0x09, 0x02, 0x37, 0x03, 0x05, 0x08, 0x0d, 0x08, 0x0f,
+    0x0a, 0x0d, 0x19, 0x07, 0x05, 0x18, 0xf0, 0x03, 0x31, 0x0b, 0x09, 0x0b,
+    0x1f, 0x02, 0x04, 0x0b, 0x06, 0x1d, 0x1a, 0x0c, 0x07, 0x1b, 0x05, 0x03,
+    0x09, 0x01, 0x0a, 0x10, 0x1f, 0xf0, 0x01, 0x2a, 0x02, 0x04, 0x06, 0x0c,
+    0x0b, 0x1e, 0x0f, 0x0e, 0x0d, 0x09, 0x0c, 0x05, 0x0a, 0x02, 0x1b, 0x31,
+    0x08, 0x27, 0x02, 0x03, 0x19, 0xf0, 0x05, 0x07, 0x1a, 0x18, 0x1c, 0x07,
+    0x04, 0x0e, 0x93, 0x0f, 0x0d, 0x1a, 0x0b, 0x0a, 0x0b, 0x0c, 0x0a, 0x08,
+    0xf0, 0x02, 0x0b, 0x11, 0x1e, 0x02, 0x2b, 0x03, 0x05, 0x08, 0x1c, 0x0c,
+    0x1f, 0x0d, 0x0c, 0x08, 0x1b, 0x04, 0x02, 0x09, 0x01, 0x07, 0x20, 0x18,
+    0x20, 0x0d, 0x01, 0x0a, 0x03, 0x05, 0x61, 0x05, 0x06, 0x09, 0x07, 0x1f,
+    0x08, 0x17, 0x0c, 0x08, 0x06, 0x04, 0x09, 0xf0, 0x02, 0x18, 0x31, 0x07,
+    0x08, 0x0c, 0x02, 0x0b, 0x04, 0x09, 0x06, 0x2b, 0x17, 0x06, 0x0d, 0x04,
+    0x0c, 0x32, 0x0f, 0x0e, 0x0c, 0x0b, 0xf0, 0x03, 0x18, 0x04, 0x05, 0x09,
+    0x16, 0x0a, 0x2b, 0x05, 0x04, 0x03, 0x29, 0x32, 0x0a, 0x0b, 0x03, 0x0a,
+    0x04, 0x1b, 0x05, 0x06, 0x0a, 0xf0, 0x15, 0x0d, 0x0b, 0x04, 0x0c, 0x03,
+    0x0a, 0x22, 0x19, 0x0c, 0x03, 0x19, 0x04, 0x05, 0x1b, 0x06, 0x18, 0x0a,
+    0x19, 0x05, 0x03, 0x0a, 0x02, 0x18, 0x70, 0x21, 0x07, 0x09, 0x02, 0x08,
+    0x03, 0x0b, 0x06, 0x0a, 0x09, 0x0e, 0x1f, 0x07, 0xf1, 0x08, 0x0e, 0x06,
+    0x08, 0x05, 0x05, 0x14, 0x02, 0x01, 0x03, 0x20, 0x14, 0x06, 0x01, 0x07,
+    0x03, 0x09, 0x07, 0x0b, 0x0e, 0x2c, 0x0c, 0x08, 0x05, 0x0b, 0x31, 0x02,
+    0x0a, 0x30, 0x0e, 0x0a, 0x0e, 0xf0, 0x0a, 0x11, 0x08, 0x0b, 0x02, 0x0d,
+    0x04, 0x1b, 0x06, 0x0e, 0x2e, 0x0f, 0x09, 0x07, 0x1c, 0x05, 0x04, 0x0d,
+    0x13, 0x0a, 0x08, 0x02, 0x07, 0x31, 0x09, 0xf0, 0x1a, 0x0d, 0x12, 0x08,
+    0x09, 0x04, 0x0a, 0x09, 0x2b, 0x0e, 0x0f, 0x0e, 0x2a, 0x0d, 0x07, 0x06,
+    0x18, 0x03, 0x01, 0x0a, 0x20, 0x0e, 0x40, 0x0a, 0x0b, 0x01, 0x1a, 0x02,
+    0x04, 0x06, 0xd1, 0x09, 0x07, 0x0c, 0x08, 0x0f, 0x0a, 0x0e, 0x09, 0x08,
+    0x18, 0x03, 0x02, 0x05, 0x01, 0x03, 0x20, 0x12, 0x03, 0x01, 0x04, 0x02,
+    0x18, 0x04, 0x02, 0x07, 0x09, 0x03, 0x2f, 0x0d, 0x14, 0x0b, 0x19, 0x03,
+    0x06, 0x02, 0x03, 0x08, 0x31, 0x11, 0x04, 0x11, 0x20, 0x00, 0x02, 0x01,
+    0x11, 0x01, 0x12, 0x03, 0x02, 0x06, 0x03, 0x13, 0x09, 0x05, 0x0d, 0x06,
+    0x24, 0x0f, 0x0c, 0x0d, 0x08, 0x06, 0x09, 0x03, 0x03, 0x0a, 0x02, 0x02,
+    0x0c, 0xf1, 0x01, 0x16, 0x40, 0x04, 0x13, 0x15, 0x01, 0x02, 0x07, 0x13,
+    0x08, 0x0a, 0x07, 0x0b, 0x0a, 0x1c, 0x0d, 0x0a, 0x1a, 0x07, 0x05, 0x18,
+    0x31, 0x03, 0x02, 0x07, 0x01, 0x05, 0x30, 0x03, 0x12, 0x02, 0x01, 0x13,
+    0x22, 0x01, 0x94, 0x02, 0x05, 0x03, 0x08, 0x04, 0x0c, 0x15, 0x0d, 0x09,
+    0x04, 0x05, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x40, 0x25, 0x20, 0x09,
+    0x01, 0x0b, 0x03, 0x11, 0x08, 0x05, 0x09, 0x0c, 0x02, 0x18, 0x0f, 0x23,
+    0x0d, 0x07, 0x07, 0x06, 0x03, 0x02, 0x17, 0x01, 0x01, 0x40, 0x40, 0x08,
+    0x15, 0x06, 0x0b, 0x01, 0x31, 0x08, 0x03, 0x09, 0x09, 0x0a, 0x0d, 0x0b,
+    0x0c, 0x12, 0x19, 0x0d, 0x08, 0x01, 0x0b, 0x06, 0xf0, 0x0d, 0x03, 0x0a,
+    0x01, 0x0c, 0x20, 0x0b, 0x09, 0x0a, 0x11, 0x07, 0x0b, 0x02, 0x0d, 0x03,
+    0x0e, 0x16, 0x0d, 0x0c, 0x07, 0x0b, 0x0d, 0x0c, 0x0e, 0x1d, 0x0b, 0x07,
+    0xb0, 0x0b, 0x05, 0x19, 0x03, 0x02, 0x0b, 0x11, 0x0c, 0x08, 0x20, 0x19,
+    0x0a, 0x01, 0x0e, 0x03, 0x0a, 0x05, 0x0e, 0x0a, 0x01, 0x0b, 0x0d, 0x02,
+    0x0a, 0x0f, 0x13, 0x18, 0x0c, 0x09, 0x02, 0x07, 0x05, 0x11, 0x06, 0x02,
+    0x15, 0x01, 0x30, 0x30, 0x04, 0x83, 0x01, 0x01, 0x02, 0x03, 0x03, 0x06,
+    0x04, 0x0e, 0x07, 0x2f, 0x0c, 0x0d, 0x0b, 0x02, 0x07, 0x0c, 0x01, 0x03,
+    0x0e, 0xf0, 0x01, 0x0b, 0x30, 0x09, 0x06, 0x05, 0x16, 0x01, 0x02, 0x0a,
+    0x04, 0x0e, 0x05, 0x3f, 0x0b, 0x0f, 0x0e, 0x0a, 0x0e, 0x07, 0x0d, 0x04,
+    0x0e, 0x03, 0x1b, 0xf0, 0x12, 0x0a, 0x31, 0x0f, 0x0d, 0x0b, 0x0e, 0x12,
+    0x0a, 0x09, 0x03, 0x0b, 0x05, 0x0d, 0x08, 0x1c, 0x0a, 0x0c, 0x1b, 0x08,
+    0x06, 0x0a, 0x04, 0x09, 0x70, 0x03, 0x08, 0x02, 0x17, 0x01, 0x10, 0x0a,
+    0x0b, 0x01, 0x1e, 0x02, 0x04, 0x07, 0x51, 0x07, 0x0a, 0x0e, 0x0c, 0x1f,
+    0x0e, 0x0a, 0x07, 0x07, 0x03, 0x0e, 0x70, 0x01, 0x0b, 0x30, 0x08, 0x05,
+    0x04, 0x06, 0x01, 0x07, 0x03, 0x0c, 0x05, 0x09, 0x01, 0x08, 0x1a, 0x02,
+    0x1f, 0x13, 0x0d, 0x0e, 0x06, 0x04, 0x08, 0x03, 0x25, 0x03, 0x02, 0x01,
+    0x11, 0x40, 0x24, 0x20, 0x15, 0xb1, 0x01, 0x16, 0x04, 0x06, 0x08, 0x09,
+    0x0b, 0x1f, 0x1d, 0x09, 0x0c, 0x06, 0x0b, 0x03, 0x0c, 0x01, 0x0e, 0x50,
+    0x0c, 0x70, 0x1f, 0x0e, 0x2f, 0x01, 0x02, 0x0e, 0x03, 0x0d, 0x04, 0x91,
+    0x09, 0x07, 0x0a, 0x0a, 0x1b, 0x0e, 0x0a, 0x0a, 0x06, 0x09, 0x04, 0x08,
+    0x02, 0x07, 0x01, 0x06, 0x30, 0x05, 0x10, 0x06, 0x14, 0x31, 0x01, 0x05,
+    0x02, 0x06, 0x05, 0x07, 0x0a, 0x02, 0x26, 0x1f, 0x03, 0x14, 0x0d, 0x15,
+    0x06, 0x03, 0x03, 0x02, 0x06, 0x01, 0x11, 0x07, 0x30, 0x25, 0x40, 0x16,
+    0x01, 0x03, 0x17, 0x04, 0x61, 0x08, 0x09, 0x1f, 0x0b, 0x0e, 0x0e, 0x0d,
+    0x06, 0x1c, 0x02, 0x01, 0xf0, 0x1f, 0x20, 0x0d, 0x0b, 0x01, 0x17, 0x02,
+    0x03, 0x09, 0x06, 0x1a, 0x08, 0x0c, 0x19, 0x0d, 0x0a, 0x18, 0x07, 0x06,
+    0x27, 0x04, 0x03, 0x52, 0xf0, 0x08, 0x09, 0x0b, 0x1d, 0x0e, 0x13, 0x0c,
+    0x0b, 0x04, 0x09, 0x06, 0x58, 0x09, 0x0b, 0x0e, 0x09, 0x07, 0x04, 0x09,
+    0x03, 0x80, 0x08, 0x02, 0x07, 0x01, 0x08, 0x10, 0x0a, 0x18, 0x01, 0x02,
+    0x0b, 0x04, 0x0d, 0x08, 0x0f, 0x0d, 0x01, 0x0c, 0x0e, 0x12, 0x0a, 0x0f,
+    0x09, 0x0c, 0x01, 0x0a, 0x07, 0x90, 0x0c, 0x03, 0x08, 0x01, 0x07, 0x30,
+    0x06, 0x15, 0x06, 0x01, 0x08, 0x03, 0x0a, 0x07, 0x0c, 0x0d, 0x01, 0x09,
+    0x1f, 0x22, 0x08, 0x09, 0x0e, 0x08, 0x07, 0x51, 0x09, 0x03, 0x28, 0x01,
+    0x20, 0x06, 0x05, 0x11, 0xf0, 0x06, 0x08, 0x02, 0x09, 0x03, 0x0b, 0x04,
+    0x0d, 0x06, 0x0c, 0x17, 0x0d, 0x0c, 0x08, 0x2b, 0x07, 0x06, 0x04, 0x2c,
+    0x13, 0x12, 0x0f, 0x1e, 0x31, 0xf0, 0x2b, 0x02, 0x09, 0x04, 0x08, 0x06,
+    0x19, 0x0b, 0x1f, 0x0a, 0x0b, 0x0d, 0x0a, 0x06, 0x1b, 0x04, 0x02, 0x0e,
+    0x01, 0x0c, 0x10, 0x0b, 0x50, 0x09, 0x01, 0x17, 0x02, 0x03, 0x0a, 0x06,
+    0x0b, 0x0d, 0x0d, 0x2f, 0x11, 0x19, 0x60, 0x0c, 0x07, 0x0b, 0x03, 0x09,
+    0x01, 0x0a, 0x30, 0x0b, 0x19, 0xa1, 0x06, 0x01, 0x08, 0x03, 0x07, 0x06,
+    0x08, 0x0c, 0x19, 0x0f, 0x0e, 0x1a, 0x07, 0x03, 0x0b, 0x01, 0x0e, 0x30,
+    0x0a, 0xf0, 0x0f, 0x0c, 0x0f, 0x01, 0x09, 0x02, 0x08, 0x03, 0x0b, 0x05,
+    0x0a, 0x07, 0x1b, 0x1a, 0x1a, 0x09, 0x08, 0x1b, 0x06, 0x05, 0x19, 0x03,
+    0x32, 0x0b, 0x50, 0x0a, 0x09, 0x07, 0x31, 0x0a, 0x0b, 0x0e, 0xb1, 0x08,
+    0x02, 0x09, 0x04, 0x18, 0x07, 0x0b, 0x29, 0x1c, 0x07, 0x07, 0x04, 0x16,
+    0x02, 0x01, 0x25, 0x30, 0x30, 0x06, 0x08, 0x01, 0x19, 0x02, 0x01, 0x06,
+    0x02, 0x08, 0x0d, 0x03, 0x19, 0x0f, 0x04, 0x0c, 0x03, 0x18, 0x08, 0x02,
+    0x03, 0x01, 0x09, 0x01, 0x40, 0x0a, 0x40, 0x07, 0x04, 0x05, 0x16, 0x11,
+    0x02, 0x08, 0x06, 0x22, 0x07, 0x0c, 0x09, 0x1f, 0x0a, 0x01, 0x0b, 0x0c,
+    0x70, 0x0f, 0x04, 0x0c, 0x01, 0x09, 0x20, 0x06, 0x05, 0x19, 0x01, 0x04,
+    0x0b, 0x09, 0x21, 0x09, 0x0f, 0x0b, 0x0d, 0x0a, 0x09, 0xf0, 0x0c, 0x04,
+    0x0b, 0x02, 0x0a, 0x10, 0x0e, 0x0a, 0x01, 0x08, 0x03, 0x19, 0x05, 0x07,
+    0x0a, 0x1f, 0x1e, 0x0b, 0x0a, 0x05, 0x08, 0x02, 0x07, 0x01, 0x25, 0x10,
+    0x00, 0x01, 0x01, 0x14, 0x03, 0x02, 0x06, 0x03, 0x25, 0x0b, 0x05, 0x1f,
+    0x0a, 0x0e, 0x04, 0x07, 0x0c, 0x02, 0x03, 0x08, 0x01, 0x01, 0x06, 0x30,
+    0x30, 0x03, 0x10, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x04, 0x04, 0x07,
+    0x07, 0x06, 0x2f, 0x0d, 0x0a, 0x0f, 0x0f, 0x08, 0x0a, 0x07, 0x04, 0x07,
+    0x03, 0x03, 0x04, 0x01, 0x01, 0x03, 0x20, 0x20, 0x01, 0x00, 0x31, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x06, 0x0c, 0x08, 0x02, 0x1f, 0x1c, 0x23, 0x0b,
+    0x07, 0x06, 0x06, 0x02, 0x03, 0x08, 0xf1, 0x01, 0x16, 0x20, 0x05, 0x17,
+    0x01, 0x02, 0x0a, 0x04, 0x0e, 0x06, 0x1b, 0x04, 0x02, 0x0a, 0x30, 0x0d,
+    0x07, 0x16, 0x01, 0x08, 0x03, 0x0b, 0x01, 0x08, 0x08, 0x42, 0x0e, 0x0a,
+    0x1f, 0x0c, 0x09, 0x08, 0x15, 0x03, 0x31, 0x40, 0x04, 0x01, 0x10, 0x02,
+    0x01, 0x03, 0x02, 0x02, 0x04, 0x05, 0x03, 0x05, 0x0a, 0x05, 0x06, 0x2f,
+    0x08, 0x07, 0x0c, 0x08, 0x06, 0x06, 0x05, 0x04, 0x04, 0x02, 0x12, 0x03,
+    0x40, 0x02, 0x01, 0x41, 0x00, 0x01, 0x04, 0x02, 0x06, 0x04, 0x07, 0x02,
+    0x0b, 0x08, 0x03, 0x1f, 0x0b, 0x04, 0x08, 0x35, 0x09, 0x04, 0x04, 0x02,
+    0x02, 0x01, 0x01, 0x40, 0x04, 0x10, 0x13, 0x01, 0x04, 0x03, 0x35, 0x04,
+    0x01, 0x08, 0x02, 0x1f, 0x13, 0x06, 0x0e, 0x02, 0x07, 0x05, 0x01, 0x09,
+    0x03, 0xe0, 0x0c, 0x01, 0x0b, 0x20, 0x09, 0x08, 0x0c, 0x01, 0x0b, 0x03,
+    0x09, 0x07, 0x0c, 0x1f, 0x1f, 0x09, 0x0e, 0x04, 0x0c, 0x02, 0x09, 0x01,
+    0x0a, 0x10, 0x0e, 0x61, 0x08, 0x01, 0x49, 0x03, 0x06, 0x0c, 0x0f, 0x0c,
+    0x08, 0x08, 0x40, 0x0a, 0x03, 0x07, 0x01, 0x05, 0x20, 0x04, 0x03, 0x01,
+    0x12, 0x01, 0x02, 0x03, 0x03, 0x03, 0x05, 0x05, 0x04, 0x0c, 0x07, 0x05,
+    0x1f, 0x0b, 0x06, 0x0e, 0x05, 0x07, 0x0a, 0x04, 0x02, 0x06, 0x03, 0x40,
+    0x04, 0x12, 0x01, 0x10, 0x21, 0x01, 0x01, 0x02, 0x12, 0x02, 0x05, 0x05,
+    0x07, 0x03, 0x0e, 0x0a, 0x04, 0x1f, 0x0e, 0x05, 0x0c, 0x04, 0x05, 0x0a,
+    0x23, 0x02, 0x06, 0x01, 0x03, 0x20, 0x02, 0x02, 0x40, 0x03, 0x04, 0x01,
+    0x06, 0x03, 0x07, 0x06, 0x09, 0x0e, 0x61, 0x08, 0x0f, 0x0b, 0x0e, 0x1a,
+    0x05, 0x02, 0x09, 0x01, 0x07, 0x20, 0x06, 0x00, 0x09, 0x91, 0x08, 0x01,
+    0x09, 0x02, 0x0b, 0x04, 0x1d, 0x09, 0x0f, 0x0a, 0x0a, 0x08, 0x04, 0x07,
+    0x01, 0x06, 0x20, 0x05, 0x20, 0x16, 0x01, 0x17, 0x02, 0x01, 0x04, 0x02,
+    0x06, 0x0a, 0x03, 0x15, 0x1f, 0x34, 0x04, 0x09, 0x03, 0x04, 0x72, 0x02,
+    0x02, 0x01, 0x21, 0x20, 0x02, 0x01, 0x05, 0x04, 0x16, 0x0a, 0x53, 0x2f,
+    0x0c, 0x0f, 0x08, 0x05, 0x05, 0x01, 0x03, 0x30, 0x02, 0x02, 0x30, 0x03,
+    0x02, 0x03, 0x01, 0x16, 0x03, 0x01, 0x05, 0x02, 0x07, 0x0e, 0x03, 0x28,
+    0x1f, 0x15, 0x0a, 0x03, 0x07, 0x04, 0x02, 0x15, 0x02, 0x21, 0x01, 0x03,
+    0x10, 0x02, 0x30, 0x13, 0x01, 0x03, 0x04, 0x06, 0x15, 0x09, 0xf1, 0x1f,
+    0x07, 0x08, 0x09, 0x19, 0x04, 0x02, 0x0d, 0x01, 0x0c, 0x10, 0x0b, 0x1a,
+    0x01, 0x12, 0x09, 0x0c, 0x03, 0x1d, 0x14, 0x0b, 0x02, 0x0c, 0x01, 0x30,
+    0x1f, 0x30, 0x0d, 0x0b, 0x01, 0x19, 0x01, 0x42, 0x03, 0x0a, 0x06, 0x0b,
+    0x0e, 0x0c, 0x0f, 0x0b, 0x0d, 0x11, 0x0a, 0x06, 0x16, 0x03, 0x30, 0x01,
+    0x05, 0x20, 0x04, 0x03, 0x11, 0x02, 0x01, 0x53, 0x03, 0x02, 0x05, 0x04,
+    0x0c, 0x07, 0x1f, 0x1b, 0x0e, 0x0a, 0x02, 0x05, 0x09, 0xc1, 0x02, 0x05,
+    0x11, 0x03, 0x01, 0x10, 0x02, 0x13, 0x02, 0x03, 0x05, 0x06, 0x07, 0x0e,
+    0x0a, 0x1f, 0x1f, 0x06, 0x0a, 0x03, 0x0e, 0xf0, 0x02, 0x09, 0x01, 0x27,
+    0x10, 0x01, 0x19, 0x03, 0x06, 0x0b, 0x0c, 0x1f, 0x1f, 0x0e, 0x07, 0x2b,
+    0x03, 0x02, 0x01, 0x09, 0x00, 0x0b, 0x01, 0x08, 0xd0, 0x03, 0x07, 0x04,
+    0x09, 0x06, 0x3a, 0x0b, 0x0f, 0x0c, 0x05, 0x09, 0x02, 0x0a, 0x01, 0x09,
+    0x10, 0x0e, 0x0a, 0x01, 0x0c, 0x03, 0x0f, 0x05, 0x08, 0x41, 0x09, 0x0a,
+    0x1f, 0x0e, 0x0b, 0x08, 0x08, 0x03, 0x0e, 0x60, 0x01, 0x08, 0x30, 0x07,
+    0x14, 0x06, 0x01, 0x0f, 0x03, 0x0b, 0x01, 0x06, 0x0c, 0x02, 0x1f, 0x0b,
+    0x83, 0x0e, 0x0e, 0x0a, 0x08, 0x05, 0x03, 0x03, 0x01, 0x02, 0x20, 0x01,
+    0x20, 0x01, 0x14, 0x02, 0x21, 0x04, 0x06, 0x0b, 0x17, 0x1f, 0x32, 0x09,
+    0x0c, 0x08, 0x04, 0x07, 0x02, 0x21, 0x0a, 0x01, 0x08, 0x20, 0x07, 0xf0,
+    0x0a, 0x0f, 0x01, 0x0e, 0x03, 0x0c, 0x06, 0x3b, 0x09, 0x0a, 0x06, 0x03,
+    0x09, 0x12, 0x18, 0x11, 0x1a, 0x03, 0x09, 0x06, 0x0b, 0x0a, 0x0c, 0x1f,
+    0x80, 0x0e, 0x0d, 0x0c, 0x0c, 0x06, 0x0a, 0x02, 0x08, 0x01, 0x06, 0x20,
+    0x07, 0x06, 0x08, 0x01, 0x01, 0x07, 0x03, 0x42, 0x06, 0x05, 0x08, 0x0c,
+    0x09, 0x0f, 0x0b, 0x0e, 0x18, 0x07, 0x21, 0x02, 0x17, 0x30, 0x40, 0x08,
+    0x15, 0x01, 0x07, 0x03, 0x08, 0x05, 0x01, 0x17, 0x09, 0x02, 0x1f, 0x13,
+    0x36, 0x0b, 0x02, 0x05, 0x11, 0x02, 0x05, 0x01, 0x40, 0x06, 0x10, 0x05,
+    0x04, 0x01, 0x05, 0x02, 0x17, 0x03, 0x81, 0x07, 0x08, 0x0d, 0x0a, 0x0f,
+    0x1c, 0x0d, 0x06, 0x1a, 0x02, 0x01, 0x18, 0x20, 0xf0, 0x0b, 0x0c, 0x01,
+    0x0a, 0x02, 0x0b, 0x05, 0x0a, 0x08, 0x2b, 0x1a, 0x05, 0x0a, 0x03, 0x09,
+    0x22, 0x0b, 0x0a, 0x08, 0x03, 0x17, 0x06, 0x09, 0x08, 0x0d, 0xa0, 0x19,
+    0x0c, 0x07, 0x0a, 0x05, 0x0b, 0x02, 0x0c, 0x30, 0x0d, 0x09, 0x08, 0x09,
+    0x01, 0x0b, 0x04, 0x0d, 0x07, 0x01, 0x0b, 0x0a, 0x22, 0x0a, 0x1f, 0x0c,
+    0x0a, 0x0d, 0x01, 0x0b, 0x05, 0x40, 0x0c, 0x01, 0x09, 0x30, 0x07, 0x04,
+    0x13, 0x11, 0x01, 0x04, 0x02, 0x22, 0x05, 0x05, 0x06, 0x0e, 0x27, 0x0f,
+    0x23, 0x0d, 0x06, 0x26, 0x03, 0x02, 0x02, 0x01, 0x01, 0xf0, 0x08, 0x10,
+    0x27, 0x01, 0x02, 0x09, 0x04, 0x1a, 0x08, 0x0a, 0x1c, 0x0d, 0x08, 0x0b,
+    0x04, 0x0c, 0x03, 0x08, 0x02, 0x09, 0x11, 0x0c, 0x0e, 0x02, 0x0c, 0x03,
+    0x70, 0x0d, 0x05, 0x0c, 0x19, 0x0b, 0x0c, 0x08, 0x1b, 0x05, 0x02, 0x1a,
+    0x01, 0x20, 0x71, 0x18, 0x19, 0x01, 0x03, 0x0b, 0x0a, 0x0e, 0x0f, 0x0f,
+    0x09, 0x1b, 0x07, 0x60, 0x03, 0x09, 0x01, 0x06, 0x20, 0x05, 0x06, 0x08,
+    0x01, 0x09, 0x04, 0x01, 0x0a, 0x0c, 0x02, 0x19, 0x1f, 0x03, 0x02, 0x0a,
+    0x0c, 0x01, 0x19, 0x06, 0xf0, 0x02, 0x06, 0x10, 0x05, 0x14, 0x01, 0x03,
+    0x05, 0x07, 0x26, 0x0e, 0x0d, 0x08, 0x27, 0x07, 0x05, 0x07, 0x48, 0x0f,
+    0x0b, 0x1a, 0x50, 0x04, 0x17, 0x01, 0x20, 0x06, 0x15, 0x01, 0x01, 0x44,
+    0x04, 0x02, 0x07, 0x04, 0x1f, 0x07, 0x09, 0x0b, 0x04, 0x05, 0x04, 0x02,
+    0x06, 0x01, 0x01, 0x05, 0x20, 0x20, 0x04, 0x03, 0x05, 0x01, 0x01, 0x17,
+    0x04, 0x02, 0x0a, 0x04, 0x16, 0x1f, 0x06, 0x04, 0x05, 0x05, 0x02, 0x04,
+    0x01, 0x01, 0x13, 0x20, 0x20, 0x01, 0x02, 0x01, 0x01, 0x04, 0x04, 0x03,
+    0x05, 0x07, 0x07, 0x07, 0x1f, 0x1f, 0x0b, 0x09, 0x07, 0x06, 0x06, 0x03,
+    0x03, 0x04, 0x01, 0x01, 0x03, 0x20, 0x10, 0x02, 0x20, 0x02, 0x01, 0x04,
+    0x03, 0x05, 0x01, 0x0a, 0x06, 0x02, 0x1f, 0x0a, 0x03, 0x07, 0x64, 0x05,
+    0x06, 0x02, 0x05, 0x01, 0x04, 0x10, 0x03, 0x12, 0x01, 0x03, 0x01, 0x05,
+    0x06, 0x50, 0x28, 0x07, 0x05, 0x02, 0x29, 0x21, 0x61, 0x26, 0x04, 0x1c,
+    0x07, 0x1f, 0x08, 0x07, 0x04, 0x06, 0x01, 0x30, 0x07, 0x20, 0x15, 0x08,
+    0x01, 0x11, 0x07, 0x05, 0x08, 0x0d, 0x02, 0x17, 0x1f, 0x13, 0x25, 0x08,
+    0x02, 0x03, 0x11, 0x20, 0x14, 0x40, 0x05, 0x01, 0x06, 0x04, 0x08, 0x0b,
+    0x0e, 0x2f, 0x01, 0x1d, 0x02, 0x01, 0x09, 0x05, 0x40, 0x08, 0x01, 0x05,
+    0x20, 0x04, 0x03, 0x15, 0x02, 0x01, 0x04, 0x03, 0x16, 0x08, 0x06, 0x1f,
+    0x0f, 0x05, 0x0e, 0x04, 0x09, 0x05, 0x03, 0x04, 0x02, 0x02, 0x01, 0x01,
+    0x21, 0x20, 0x20, 0x03, 0x01, 0x01, 0x14, 0x03, 0x03, 0x09, 0x05, 0x25,
+    0x1f, 0x0e, 0x0f, 0x07, 0x08, 0x04, 0x03, 0x06, 0x23, 0x02, 0x03, 0x20,
+    0x02, 0x00, 0x05, 0x11, 0x24, 0x01, 0x02, 0x02, 0x14, 0x03, 0x03, 0x05,
+    0x02, 0x02, 0x0b, 0xf1, 0x21, 0x0c, 0x1a, 0x03, 0x08, 0x05, 0x29, 0x06,
+    0x0c, 0x0f, 0x07, 0x06, 0x05, 0x02, 0x14, 0x20, 0x03, 0x14, 0x01, 0x03,
+    0x07, 0x08, 0x09, 0x61, 0x1f, 0x1a, 0x0a, 0x08, 0x03, 0x07, 0x20, 0x06,
+    0x04, 0x13, 0x52, 0x01, 0x04, 0x04, 0x08, 0x06, 0x0e, 0x0a, 0x0f, 0x0f,
+    0x0a, 0x0b, 0x31, 0x03, 0x05, 0x01, 0x02, 0x20, 0x01, 0x00, 0x12, 0x01,
+    0x02, 0x02, 0x03, 0x05, 0x04, 0x04, 0x0d, 0x06, 0x06, 0x1f, 0x0e, 0x07,
+    0x09, 0x06, 0x0b, 0x03, 0x05, 0x03, 0x11, 0x04, 0x30, 0x12, 0x10, 0x21,
+    0x02, 0x02, 0x04, 0x05, 0x06, 0x02, 0x0c, 0x09, 0x03, 0x1f, 0x0e, 0x24,
+    0x08, 0x05, 0x04, 0x02, 0x02, 0x05, 0x01, 0x01, 0x04, 0x10, 0xf0, 0x15,
+    0x01, 0x07, 0x02, 0x09, 0x05, 0x2b, 0x1b, 0x06, 0x0a, 0x03, 0x0b, 0x12,
+    0x1d, 0x03, 0x0e, 0x05, 0x0a, 0x06, 0x0b, 0x08, 0x0e, 0x06, 0x1f, 0x03,
+    0xf0, 0x01, 0x0c, 0x10, 0x09, 0x0a, 0x01, 0x18, 0x02, 0x06, 0x09, 0x0e,
+    0x0c, 0x1f, 0x0e, 0x0d, 0x0b, 0x0b, 0x04, 0x09, 0x21, 0x08, 0x07, 0x19,
+    0x02, 0x05, 0x10, 0x1a, 0x0b, 0x1f, 0x41, 0x17, 0x06, 0x05, 0x02, 0x04,
+    0x20, 0x13, 0x20, 0x04, 0x01, 0x46, 0x04, 0x01, 0x09, 0x03, 0x2f, 0x07,
+    0x0e, 0x08, 0x15, 0x07, 0x03, 0x02, 0x01, 0x04, 0x30, 0x30, 0x03, 0x02,
+    0x01, 0x13, 0x02, 0x01, 0x05, 0x02, 0x04, 0x0d, 0x03, 0x06, 0x1f, 0x05,
+    0x07, 0x04, 0x08, 0x07, 0x02, 0x09, 0x03, 0x11, 0x0a, 0x01, 0x07, 0x10,
+    0xf0, 0x09, 0x08, 0x01, 0x07, 0x02, 0x08, 0x05, 0x19, 0x0a, 0x0d, 0x18,
+    0x07, 0x03, 0x09, 0x22, 0x0a, 0x08, 0x19, 0x03, 0x05, 0x0a, 0x08, 0x0c,
+    0x09, 0x3e, 0x06, 0xd0, 0x03, 0x31, 0x0d, 0x0b, 0x0e, 0x04, 0x0a, 0x06,
+    0x0b, 0x07, 0x0c, 0x08, 0x0d, 0x07, 0x1b, 0x03, 0x21, 0x09, 0x07, 0x81,
+    0x15, 0x02, 0x04, 0x06, 0x07, 0x07, 0x0e, 0x19, 0x0d, 0x05, 0x07, 0x02,
+    0x06, 0x30, 0x15, 0x10, 0x06, 0x01, 0x17, 0x02, 0x02, 0x05, 0x03, 0x18,
+    0x0c, 0x04, 0x1f, 0x06, 0x16, 0x04, 0x06, 0x02, 0x05, 0x01, 0x01, 0x04,
+    0x20, 0x30, 0x03, 0x12, 0x01, 0x03, 0x03, 0x01, 0x74, 0x07, 0x03, 0x2f,
+    0x07, 0x0f, 0x09, 0x07, 0x04, 0x03, 0x02, 0x01, 0x21, 0x10, 0x13, 0x01,
+    0xf0, 0x05, 0x02, 0x17, 0x06, 0x0c, 0x18, 0x0f, 0x09, 0x17, 0x04, 0x03,
+    0x08, 0x12, 0x0a, 0x0b, 0x04, 0x0a, 0x07, 0x0b, 0x1b, 0x1c, 0x07, 0x0d,
+    0x03, 0x0b, 0x31, 0xf0, 0x09, 0x08, 0x07, 0x0a, 0x03, 0x0b, 0x04, 0x0c,
+    0x06, 0x1b, 0x08, 0x07, 0x0a, 0x04, 0x09, 0x12, 0x28, 0x03, 0x04, 0x0a,
+    0x06, 0x0d, 0x0c, 0x0e, 0x0f, 0x50, 0x0f, 0x0a, 0x0c, 0x04, 0x08, 0x02,
+    0x06, 0x20, 0x05, 0x13, 0x11, 0x01, 0x44, 0x03, 0x03, 0x08, 0x05, 0x2f,
+    0x08, 0x0e, 0x09, 0x03, 0x05, 0x06, 0x22, 0x01, 0x03, 0x20, 0x01, 0x20,
+    0x13, 0x01, 0x04, 0x03, 0x01, 0x05, 0x06, 0x02, 0x06, 0x2f, 0x13, 0x07,
+    0x29, 0x02, 0x06, 0x11, 0x01, 0x08, 0x20, 0xf0, 0x0a, 0x17, 0x01, 0x08,
+    0x03, 0x09, 0x08, 0x0b, 0x1f, 0x0d, 0x0e, 0x07, 0x0d, 0x03, 0x0a, 0x02,
+    0x0c, 0x11, 0x0e, 0x0b, 0x02, 0x0e, 0x04, 0x0c, 0x06, 0x0d, 0x07, 0xf0,
+    0x3e, 0x06, 0x03, 0x21, 0x1b, 0x02, 0x18, 0x04, 0x05, 0x09, 0x07, 0x0b,
+    0x08, 0x0c, 0x06, 0x0d, 0x04, 0x0c, 0x12, 0x0a, 0x48, 0x03, 0x04, 0x80,
+    0x06, 0x0b, 0x0f, 0x17, 0x08, 0x04, 0x26, 0x02, 0x20, 0x25, 0x01, 0x01,
+    0x02, 0x04, 0x04, 0x34, 0x0b, 0x06, 0x1f, 0x0a, 0x0b, 0x0b, 0x07, 0x13,
+    0x03, 0x04, 0x30, 0x03, 0x02, 0x01, 0x01, 0x20, 0x12, 0x01, 0x24, 0x04,
+    0x01, 0x08, 0x03, 0x2f, 0x08, 0x23, 0x0a, 0x17, 0x05, 0x02, 0x01, 0x08,
+    0x01, 0x20, 0x0e, 0xf0, 0x0a, 0x1b, 0x01, 0x03, 0x0d, 0x07, 0x1e, 0x1a,
+    0x0c, 0x05, 0x0a, 0x02, 0x09, 0x21, 0x0c, 0x07, 0x09, 0x03, 0x0a, 0x05,
+    0x1c, 0x09, 0x0e, 0x1d, 0xf0, 0x0b, 0x05, 0x1e, 0x02, 0x21, 0x0f, 0x0e,
+    0x0f, 0x02, 0x0c, 0x03, 0x19, 0x15, 0x0a, 0x14, 0x0b, 0x09, 0x12, 0x0a,
+    0x09, 0x04, 0x08, 0x05, 0x09, 0xa0, 0x07, 0x1a, 0x0c, 0x0d, 0x09, 0x07,
+    0x08, 0x04, 0x27, 0x02, 0x10, 0x16, 0x01, 0x02, 0x0b, 0x05, 0x0a, 0x01,
+    0x0b, 0x08, 0x52, 0x1f, 0x0d, 0x0e, 0x07, 0x07, 0x02, 0x05, 0x30, 0x03,
+    0x20, 0x13, 0x15, 0x01, 0x01, 0x03, 0x02, 0x06, 0x07, 0x23, 0x07, 0x0f,
+    0x29, 0x0e, 0x0d, 0x02, 0x04, 0x01, 0x0a, 0x01, 0xf0, 0x09, 0x20, 0x08,
+    0x07, 0x08, 0x01, 0x09, 0x03, 0x2c, 0x08, 0x0e, 0x0d, 0x0b, 0x06, 0x0a,
+    0x03, 0x18, 0x02, 0x01, 0x09, 0x02, 0x07, 0x04, 0x08, 0x06, 0x09, 0x0c,
+    0xf0, 0x0a, 0x0f, 0x0b, 0x0c, 0x0a, 0x06, 0x09, 0x02, 0x0a, 0x31, 0x29,
+    0x0b, 0x02, 0x0c, 0x04, 0x0d, 0x15, 0x0c, 0x0d, 0x06, 0x0b, 0x14, 0x0a,
+    0x09, 0x16, 0xa0, 0x08, 0x09, 0x07, 0x0a, 0x08, 0x09, 0x06, 0x18, 0x04,
+    0x02, 0x09, 0x01, 0x07, 0x10, 0x16, 0x01, 0x27, 0x02, 0x01, 0x05, 0x02,
+    0x0b, 0x03, 0x06, 0x1f, 0x05, 0x05, 0x06, 0x04, 0x07, 0x05, 0x13, 0x03,
+    0x03, 0x01, 0x01, 0x14, 0x20, 0x10, 0x23, 0x01, 0x01, 0x02, 0x03, 0x05,
+    0x32, 0x07, 0x07, 0x0f, 0x08, 0x0c, 0x09, 0x09, 0x0e, 0xf1, 0x03, 0x09,
+    0x30, 0x07, 0x15, 0x06, 0x01, 0x08, 0x04, 0x07, 0x0a, 0x18, 0x0f, 0x0c,
+    0x07, 0x06, 0x06, 0x03, 0x14, 0x01, 0x10, 0x05, 0x07, 0x01, 0x08, 0xf1,
+    0x02, 0x1a, 0x05, 0x07, 0x0b, 0x06, 0x0e, 0x04, 0x0d, 0x01, 0x1e, 0x30,
+    0x0c, 0x09, 0x0c, 0x01, 0x0b, 0x03, 0x09, 0x04, 0x08, 0x15, 0x07, 0x28,
+    0x03, 0xe1, 0x22, 0x19, 0x33, 0x17, 0x36, 0x02, 0x01, 0x10, 0x07, 0x06,
+    0x01, 0x07, 0x02, 0x0c, 0x05, 0x0f, 0x0a, 0x09, 0x42, 0x1f, 0x0b, 0x08,
+    0x06, 0x05, 0x03, 0x03, 0x01, 0x01, 0x53, 0x20, 0x10, 0x01, 0x01, 0x02,
+    0x04, 0x13, 0x0a, 0x04, 0x1f, 0x04, 0x05, 0x03, 0x06, 0x0b, 0x02, 0x07,
+    0x04, 0x01, 0x08, 0x01, 0xc0, 0x0c, 0x20, 0x0d, 0x0a, 0x0e, 0x02, 0x0a,
+    0x04, 0x2e, 0x0b, 0x0f, 0x0a, 0x0b, 0x06, 0x09, 0x02, 0x08, 0x20, 0x09,
+    0x08, 0x51, 0x07, 0x01, 0x19, 0x03, 0x08, 0x0a, 0x1f, 0x0c, 0x0a, 0x0e,
+    0xf0, 0x0d, 0x04, 0x09, 0x02, 0x07, 0x01, 0x08, 0x10, 0x09, 0x0c, 0x01,
+    0x0d, 0x03, 0x0a, 0x05, 0x19, 0x07, 0x09, 0x1a, 0x06, 0x64, 0x1b, 0x1c,
+    0x50, 0x0a, 0x09, 0x0a, 0x03, 0x09, 0x02, 0x08, 0x01, 0x09, 0x00, 0x11,
+    0x07, 0x01, 0x06, 0x02, 0x02, 0x05, 0x04, 0x33, 0x54, 0x09, 0x0f, 0x0b,
+    0x06, 0x02, 0x04, 0x01, 0x02, 0x40, 0x35, 0x10, 0x01, 0x03, 0x56, 0x06,
+    0x01, 0x0a, 0x02, 0x0f, 0x13, 0x0d, 0x07, 0x02, 0x03, 0x01, 0x07, 0x01,
+    0x20, 0x08, 0x20, 0x17, 0x41, 0x06, 0x01, 0x08, 0x03, 0x29, 0x08, 0x0e,
+    0x0d, 0x40, 0x0d, 0x07, 0x0b, 0x02, 0x0a, 0x20, 0x0b, 0x0a, 0x51, 0x08,
+    0x01, 0x09, 0x03, 0x0a, 0x07, 0x0b, 0x0f, 0x1a, 0x0e, 0x09, 0xf0, 0x0e,
+    0x03, 0x0a, 0x01, 0x09, 0x10, 0x0a, 0x06, 0x01, 0x05, 0x02, 0x07, 0x04,
+    0x08, 0x08, 0x09, 0x0c, 0x0c, 0x0f, 0x0f, 0x0a, 0x0e, 0x05, 0x1d, 0x14,
+    0x1a, 0x03, 0x12, 0x50, 0x1b, 0x03, 0x09, 0x02, 0x0a, 0x11, 0x0f, 0x0c,
+    0x00, 0x61, 0x09, 0x01, 0x08, 0x02, 0x0a, 0x04, 0x0c, 0x08, 0x0d, 0x0e,
+    0x0b, 0x0c, 0x09, 0x0a, 0x40, 0x0a, 0x05, 0x08, 0x02, 0x26, 0x20, 0x51,
+    0x05, 0x01, 0x16, 0x04, 0x08, 0x07, 0x0f, 0x19, 0x0e, 0x08, 0x60, 0x0d,
+    0x04, 0x0a, 0x01, 0x0b, 0x10, 0x0a, 0x0c, 0x01, 0x1a, 0x03, 0x05, 0x31,
+    0x08, 0x0c, 0x19, 0x0f, 0x0a, 0x07, 0x07, 0x30, 0x08, 0x02, 0x06, 0x20,
+    0x07, 0x06, 0x51, 0x05, 0x01, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x1f, 0x0e,
+    0x0d, 0x0c, 0xf0, 0x0f, 0x04, 0x0c, 0x01, 0x0d, 0x20, 0x0b, 0x07, 0x0c,
+    0x01, 0x0e, 0x03, 0x0c, 0x07, 0x0d, 0x0b, 0x2e, 0x0f, 0x09, 0x04, 0x1c,
+    0x03, 0x02, 0x1f, 0x11, 0xf0, 0x0e, 0x02, 0x1a, 0x33, 0x29, 0x02, 0x1a,
+    0x03, 0x04, 0x0b, 0x06, 0x2d, 0x1c, 0x09, 0x0c, 0x06, 0x1b, 0x03, 0x01,
+    0x09, 0x20, 0x10, 0x17, 0x61, 0x06, 0x01, 0x08, 0x03, 0x09, 0x06, 0x0b,
+    0x0e, 0x0c, 0x0b, 0x1b, 0x05, 0x04, 0xe0, 0x1f, 0x01, 0x10, 0x0d, 0x0f,
+    0x01, 0x0c, 0x02, 0x0f, 0x05, 0x0e, 0x0b, 0x0d, 0x0f, 0x0c, 0x09, 0x1b,
+    0x04, 0x01, 0x09, 0x20, 0x07, 0x08, 0x0d, 0x01, 0x01, 0x09, 0x03, 0x32,
+    0x08, 0x07, 0x0a, 0x1f, 0x0c, 0x09, 0x09, 0x01, 0x0a, 0x04, 0x50, 0x0e,
+    0x01, 0x08, 0x20, 0x06, 0x05, 0x07, 0x01, 0x08, 0x02, 0x41, 0x07, 0x05,
+    0x38, 0x09, 0x0f, 0x0a, 0x05, 0xf0, 0x0d, 0x04, 0x1a, 0x03, 0x22, 0x18,
+    0x0c, 0x33, 0x1b, 0x0c, 0x1a, 0x12, 0x0b, 0x03, 0x0a, 0x05, 0x49, 0x18,
+    0x09, 0xf0, 0x08, 0x04, 0x0a, 0x02, 0x09, 0x11, 0x07, 0x16, 0x02, 0x03,
+    0x08, 0x05, 0x0a, 0x09, 0x0d, 0x0f, 0x0e, 0x0c, 0x0c, 0x06, 0x1a, 0x04,
+    0x01, 0x0c, 0x10, 0x0a, 0xb0, 0x0f, 0x01, 0x0d, 0x03, 0x0a, 0x06, 0x0d,
+    0x0d, 0x0e, 0x0f, 0x0f, 0x0a, 0x1e, 0x04, 0x01, 0x0d, 0x20, 0x19, 0x0e,
+    0x01, 0x01, 0x09, 0x03, 0x32, 0x07, 0x06, 0x09, 0x0f, 0x08, 0x0e, 0x27,
+    0x09, 0x01, 0x05, 0x30, 0x01, 0x06, 0x20, 0x15, 0x11, 0x04, 0x01, 0x05,
+    0x03, 0x32, 0x04, 0x08, 0x05, 0x0e, 0x06, 0x0f, 0x07, 0x0d, 0x51, 0x29,
+    0x04, 0x02, 0x01, 0x28, 0x10, 0x01, 0xf0, 0x0d, 0x02, 0x0c, 0x13, 0x0b,
+    0x0d, 0x04, 0x1a, 0x13, 0x09, 0x04, 0x18, 0x06, 0x17, 0x2a, 0x09, 0x08,
+    0x0b, 0x04, 0x0c, 0x02, 0x0e, 0x01, 0x09, 0x00, 0xf0, 0x0e, 0x01, 0x09,
+    0x02, 0x18, 0x04, 0x07, 0x29, 0x0b, 0x09, 0x06, 0x0a, 0x05, 0x09, 0x02,
+    0x0a, 0x11, 0x09, 0x0e, 0x02, 0x0d, 0x04, 0x0b, 0x07, 0x0c, 0x0c, 0x0d,
+    0x0f, 0x50, 0x0e, 0x07, 0x0d, 0x03, 0x0a, 0x01, 0x08, 0x20, 0x07, 0x06,
+    0x01, 0x15, 0x01, 0x42, 0x03, 0x07, 0x07, 0x08, 0x1f, 0x0a, 0x18, 0x0b,
+    0x01, 0x05, 0x60, 0x09, 0x01, 0x07, 0x20, 0x16, 0x08, 0x01, 0x0a, 0x04,
+    0x09, 0x07, 0x31, 0x08, 0x0d, 0x19, 0x0f, 0x0c, 0x07, 0x06, 0xf0, 0x18,
+    0x03, 0x02, 0x06, 0x11, 0x07, 0x09, 0x02, 0x08, 0x03, 0x2a, 0x05, 0x16,
+    0x0b, 0x04, 0x0c, 0x13, 0x0b, 0x0c, 0x24, 0x09, 0x0a, 0x0b, 0x16, 0xf0,
+    0x29, 0x04, 0x03, 0x08, 0x02, 0x07, 0x01, 0x08, 0x02, 0x27, 0x03, 0x05,
+    0x08, 0x28, 0x1c, 0x08, 0x09, 0x05, 0x0b, 0x02, 0x0e, 0x11, 0x0b, 0xc0,
+    0x0e, 0x02, 0x0b, 0x03, 0x0c, 0x05, 0x0b, 0x08, 0x1a, 0x0c, 0x06, 0x19,
+    0x03, 0x01, 0x0b, 0x10, 0x09, 0x18, 0x01, 0x03, 0x0b, 0x05, 0x11, 0x0a,
+    0x0d, 0x0d, 0x1f, 0x12, 0x0b, 0x08, 0x0c, 0x01, 0x17, 0x05, 0x30, 0x01,
+    0x15, 0x20, 0x04, 0x01, 0x13, 0x01, 0x02, 0x03, 0x04, 0x12, 0x07, 0x05,
+    0x1f, 0x0a, 0xf1, 0x1e, 0x09, 0x03, 0x0f, 0x01, 0x0e, 0x20, 0x0d, 0x08,
+    0x09, 0x01, 0x07, 0x02, 0x08, 0x23, 0x0a, 0x0b, 0x0c, 0x02, 0x1a, 0x31,
+    0x1b, 0xf1, 0x0e, 0x02, 0x0a, 0x03, 0x0c, 0x04, 0x0a, 0x13, 0x0b, 0x08,
+    0x02, 0x17, 0x21, 0x08, 0x09, 0x02, 0x18, 0x43, 0x09, 0x0b, 0x09, 0x07,
+    0xf1, 0x02, 0x16, 0x11, 0x27, 0x02, 0x03, 0x04, 0x08, 0x05, 0x1a, 0x06,
+    0x04, 0x18, 0x02, 0x01, 0x07, 0x10, 0x06, 0x15, 0x01, 0x02, 0x07, 0x04,
+    0x0a, 0xf1, 0x08, 0x0c, 0x1f, 0x0d, 0x0a, 0x09, 0x06, 0x03, 0x05, 0x01,
+    0x23, 0x20, 0x04, 0x01, 0x06, 0x03, 0x09, 0x08, 0x0b, 0x1f, 0x0f, 0x0e,
+    0x0c, 0x0a, 0x04, 0x18, 0x11, 0x01, 0x20, 0x0f, 0xf0, 0x0b, 0x0e, 0x01,
+    0x0a, 0x03, 0x19, 0x06, 0x07, 0x3a, 0x08, 0x05, 0x33, 0x09, 0x08, 0x09,
+    0x04, 0x0a, 0x05, 0x0d, 0x16, 0x0e, 0x0b, 0xf0, 0x05, 0x1a, 0x03, 0x22,
+    0x08, 0x27, 0x13, 0x29, 0x04, 0x16, 0x0a, 0x05, 0x0b, 0x04, 0x0a, 0x13,
+    0x19, 0x14, 0x0a, 0x1c, 0xa0, 0x05, 0x16, 0x0e, 0x0d, 0x04, 0x0a, 0x02,
+    0x0c, 0x01, 0x0b, 0x10, 0x29, 0x01, 0x03, 0x0a, 0x06, 0x07, 0xf1, 0x0b,
+    0x0a, 0x1f, 0x0f, 0x0e, 0x07, 0x09, 0x03, 0x06, 0x01, 0x14, 0x20, 0x03,
+    0x04, 0x01, 0x06, 0x03, 0x07, 0x07, 0x49, 0x1f, 0x09, 0x03, 0xf1, 0x01,
+    0x06, 0x20, 0x57, 0x01, 0x03, 0x06, 0x19, 0x26, 0x05, 0x03, 0x15, 0x02,
+    0x11, 0x06, 0x27, 0x02, 0x03, 0xf1, 0x14, 0x08, 0x09, 0x03, 0x1c, 0x02,
+    0x41, 0x0a, 0x18, 0x0a, 0x0d, 0x02, 0x0a, 0x23, 0x0c, 0x0d, 0x0b, 0x02,
+    0x0f, 0x31, 0x0e, 0x0c, 0xf1, 0x1f, 0x02, 0x0b, 0x13, 0x19, 0x02, 0x0a,
+    0x11, 0x0c, 0x17, 0x10, 0x18, 0x01, 0x02, 0x0c, 0x05, 0x0b, 0x09, 0x1c,
+    0x1f, 0x09, 0x01, 0x07, 0x0c, 0x40, 0x03, 0x08, 0x01, 0x06, 0x20, 0x15,
+    0x04, 0x61, 0x01, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x1f, 0x1c, 0x0d, 0x09,
+    0x05, 0x0d, 0xf0, 0x02, 0x08, 0x21, 0x09, 0x17, 0x02, 0x08, 0x04, 0x09,
+    0x07, 0x0b, 0x08, 0x1d, 0x07, 0x04, 0x0e, 0x02, 0x1d, 0x11, 0x09, 0x02,
+    0x08, 0x03, 0x19, 0x05, 0xf0, 0x09, 0x1a, 0x0e, 0x09, 0x0b, 0x06, 0x1a,
+    0x03, 0x12, 0x09, 0x08, 0x11, 0x0d, 0x0e, 0x02, 0x0d, 0x03, 0x0f, 0x24,
+    0x0e, 0x1f, 0x13, 0x0e, 0x0c, 0xf0, 0x24, 0x19, 0x0c, 0x15, 0x0a, 0x09,
+    0x04, 0x0b, 0x03, 0x1a, 0x02, 0x11, 0x09, 0x28, 0x02, 0x04, 0x07, 0x0a,
+    0x0b, 0x0e, 0x1f, 0x0f, 0x0e, 0x60, 0x06, 0x0b, 0x03, 0x09, 0x01, 0x08,
+    0x20, 0x17, 0x0e, 0x01, 0x09, 0x51, 0x03, 0x0c, 0x07, 0x1d, 0x1e, 0x0c,
+    0x08, 0x09, 0x03, 0x0f, 0xf0, 0x01, 0x0a, 0x20, 0x0e, 0x0b, 0x0e, 0x01,
+    0x1f, 0x03, 0x08, 0x0c, 0x0b, 0x0d, 0x09, 0x0c, 0x06, 0x0b, 0x03, 0x0a,
+    0x11, 0x0e, 0x0b, 0x02, 0x19, 0x03, 0x04, 0x0c, 0xf0, 0x08, 0x2b, 0x0b,
+    0x08, 0x05, 0x0c, 0x02, 0x1e, 0x31, 0x0a, 0x08, 0x0b, 0x02, 0x0e, 0x04,
+    0x0c, 0x05, 0x0e, 0x07, 0x0d, 0x08, 0x0c, 0x05, 0x0d, 0x64, 0x0c, 0xf0,
+    0x0b, 0x09, 0x08, 0x37, 0x03, 0x02, 0x08, 0x11, 0x0b, 0x1a, 0x02, 0x04,
+    0x0b, 0x07, 0x0c, 0x0d, 0x0e, 0x1f, 0x0f, 0x0e, 0xf0, 0x06, 0x0d, 0x03,
+    0x0b, 0x01, 0x0a, 0x10, 0x18, 0x01, 0x06, 0x02, 0x09, 0x04, 0x1e, 0x09,
+    0x1f, 0x1f, 0x09, 0x0d, 0x04, 0x09, 0x02, 0x07, 0x21, 0x08, 0x07, 0xf0,
+    0x09, 0x03, 0x08, 0x05, 0x0b, 0x0b, 0x1d, 0x0e, 0x0b, 0x0a, 0x07, 0x08,
+    0x03, 0x07, 0x11, 0x08, 0x07, 0x02, 0x16, 0x03, 0x05, 0x07, 0x0b, 0x08,
+    0x0f, 0x1a, 0x0e, 0xf0, 0x08, 0x09, 0x04, 0x08, 0x02, 0x09, 0x21, 0x0c,
+    0x08, 0x0c, 0x02, 0x0e, 0x04, 0x3b, 0x06, 0x18, 0x06, 0x19, 0x04, 0x43,
+    0x0b, 0x09, 0x08, 0xf0, 0x07, 0x09, 0x04, 0x08, 0x13, 0x09, 0x08, 0x12,
+    0x0c, 0x2a, 0x03, 0x05, 0x07, 0x0b, 0x0a, 0x1d, 0x0d, 0x09, 0x0c, 0x05,
+    0x0a, 0x03, 0x08, 0x01, 0x09, 0x60, 0x10, 0x18, 0x01, 0x07, 0x02, 0x1b,
+    0x05, 0x0a, 0x0e, 0x1f, 0x18, 0x21, 0x08, 0x07, 0x04, 0x0c, 0xf0, 0x02,
+    0x09, 0x21, 0x08, 0x07, 0x0a, 0x02, 0x0b, 0x04, 0x1c, 0x08, 0x0a, 0x0b,
+    0x07, 0x0c, 0x05, 0x0a, 0x02, 0x09, 0x21, 0x07, 0x08, 0x0d, 0x02, 0x0e,
+    0x04, 0x2f, 0xf0, 0x09, 0x1f, 0x0d, 0x09, 0x0a, 0x04, 0x09, 0x02, 0x08,
+    0x01, 0x07, 0x00, 0x0a, 0x01, 0x07, 0x02, 0x08, 0x03, 0x0b, 0x05, 0x1d,
+    0x08, 0x0a, 0x0c, 0x08, 0x0a, 0x05, 0x09, 0xf0, 0x04, 0x0a, 0x03, 0x0c,
+    0x12, 0x0e, 0x0b, 0x03, 0x09, 0x04, 0x08, 0x23, 0x0a, 0x09, 0x08, 0x02,
+    0x0a, 0x03, 0x08, 0x04, 0x09, 0x05, 0x0b, 0x07, 0x2c, 0x08, 0x07, 0xf0,
+    0x05, 0x1b, 0x03, 0x01, 0x0e, 0x10, 0x1f, 0x01, 0x0c, 0x02, 0x0f, 0x05,
+    0x0c, 0x09, 0x0d, 0x0f, 0x1e, 0x0d, 0x06, 0x0d, 0x03, 0x1e, 0x01, 0x10,
+    0x1f, 0xf0, 0x01, 0x0a, 0x02, 0x0d, 0x05, 0x0a, 0x09, 0x0d, 0x0b, 0x1e,
+    0x08, 0x05, 0x0d, 0x02, 0x0b, 0x21, 0x08, 0x09, 0x0c, 0x02, 0x0d, 0x04,
+    0x0e, 0x09, 0x0c, 0x0f, 0x2e, 0x0c, 0xf0, 0x06, 0x03, 0x1b, 0x01, 0x10,
+    0x0c, 0x0a, 0x01, 0x08, 0x02, 0x09, 0x04, 0x0a, 0x08, 0x0b, 0x0e, 0x1e,
+    0x0f, 0x0a, 0x0c, 0x05, 0x0a, 0x04, 0x09, 0x03, 0x08, 0x12, 0x17, 0xf0,
+    0x03, 0x26, 0x54, 0x17, 0x06, 0x07, 0x05, 0x18, 0x07, 0x09, 0x09, 0x18,
+    0x0b, 0x1a, 0x06, 0x04, 0x28, 0x02, 0xf0, 0x21, 0x07, 0x0a, 0x02, 0x0b,
+    0x04, 0x1a, 0x07, 0x0c, 0x0b, 0x09, 0x0c, 0x06, 0x1b, 0x04, 0x02, 0x0a,
+    0x11, 0x09, 0x0c, 0x02, 0x09, 0x03, 0x0b, 0x06, 0x3a, 0xf0, 0x0b, 0x0e,
+    0x08, 0x04, 0x0b, 0x01, 0x2e, 0x10, 0x01, 0x09, 0x02, 0x0b, 0x04, 0x0e,
+    0x08, 0x1f, 0x1f, 0x0e, 0x08, 0x0d, 0x04, 0x0b, 0x01, 0x1e, 0xf0, 0x10,
+    0x0c, 0x01, 0x18, 0x02, 0x04, 0x09, 0x08, 0x0a, 0x0e, 0x1b, 0x0f, 0x08,
+    0x1c, 0x04, 0x03, 0x0a, 0x02, 0x09, 0x11, 0x0a, 0x0d, 0x02, 0x0b, 0x03,
+    0x0a, 0xf0, 0x04, 0x49, 0x15, 0x24, 0x1a, 0x45, 0x0b, 0x0a, 0x0b, 0x29,
+    0x03, 0x02, 0x11, 0x0a, 0x09, 0x02, 0x08, 0xf0, 0x03, 0x09, 0x04, 0x3c,
+    0x07, 0x0b, 0x09, 0x06, 0x1d, 0x04, 0x02, 0x1b, 0x21, 0x0d, 0x1f, 0x02,
+    0x04, 0x1e, 0x06, 0x08, 0x0c, 0x06, 0x0b, 0x50, 0x04, 0x38, 0x02, 0x21,
+    0x0e, 0x02, 0x08, 0x41, 0x04, 0x29, 0x08, 0x0f, 0x0c, 0x08, 0x07, 0x1e,
+    0xf0, 0x03, 0x01, 0x09, 0x20, 0x18, 0x1c, 0x01, 0x03, 0x1e, 0x07, 0x0c,
+    0x1f, 0x0f, 0x0a, 0x0e, 0x05, 0x0c, 0x03, 0x0d, 0x02, 0x0a, 0x11, 0x0b,
+    0x0e, 0xf0, 0x02, 0x1a, 0x03, 0x04, 0x09, 0x15, 0x28, 0x04, 0x13, 0x09,
+    0x0b, 0x24, 0x1a, 0x0b, 0x16, 0x39, 0x04, 0x03, 0x22, 0x0a, 0xf0, 0x08,
+    0x0a, 0x03, 0x09, 0x04, 0x2a, 0x06, 0x07, 0x06, 0x1b, 0x05, 0x04, 0x1a,
+    0x02, 0x11, 0x0c, 0x0f, 0x02, 0x0a, 0x03, 0x1b, 0x05, 0x07, 0x1d, 0xf0,
+    0x09, 0x06, 0x0c, 0x04, 0x09, 0x02, 0x0a, 0x11, 0x09, 0x08, 0x02, 0x07,
+    0x03, 0x09, 0x05, 0x0b, 0x0a, 0x0d, 0x0f, 0x0f, 0x0d, 0x1e, 0x06, 0x03,
+    0x0b, 0x01, 0x08, 0x10, 0x1a, 0xf0, 0x01, 0x07, 0x02, 0x09, 0x04, 0x0e,
+    0x08, 0x4f, 0x1f, 0x09, 0x04, 0x02, 0x0e, 0x21, 0x0b, 0x07, 0x09, 0x02,
+    0x07, 0x03, 0x09, 0x04, 0x1a, 0xf0, 0x15, 0x1c, 0x04, 0x03, 0x0d, 0x24,
+    0x09, 0x0a, 0x09, 0x05, 0x08, 0x16, 0x19, 0x04, 0x2a, 0x03, 0x32, 0x07,
+    0x08, 0x0b, 0xf0, 0x03, 0x0a, 0x04, 0x0c, 0x05, 0x0b, 0x16, 0x1a, 0x05,
+    0x09, 0x03, 0x0a, 0x12, 0x0b, 0x0c, 0x03, 0x19, 0x04, 0x05, 0x1a, 0x17,
+    0x0b, 0x05, 0x19, 0x03, 0xf0, 0x02, 0x08, 0x11, 0x27, 0x02, 0x03, 0x0a,
+    0x05, 0x0e, 0x0a, 0x1f, 0x1f, 0x0e, 0x08, 0x0c, 0x03, 0x0d, 0x01, 0x0a,
+    0x20, 0x0c, 0x0a, 0x1f, 0x01, 0xf0, 0x04, 0x0b, 0x08, 0x0d, 0x1f, 0x1e,
+    0x09, 0x0d, 0x04, 0x0e, 0x02, 0x0b, 0x21, 0x0a, 0x08, 0x0a, 0x02, 0x29,
+    0x04, 0x06, 0x07, 0x0a, 0x08, 0x09, 0x06, 0x18, 0xf0, 0x04, 0x33, 0x0b,
+    0x09, 0x08, 0x1b, 0x14, 0x0d, 0x13, 0x0f, 0x0e, 0x32, 0x0f, 0x1b, 0x0e,
+    0x03, 0x0c, 0x04, 0x0b, 0x05, 0x0a, 0xf0, 0x16, 0x1b, 0x04, 0x0e, 0x03,
+    0x1c, 0x12, 0x0b, 0x13, 0x08, 0x1a, 0x04, 0x15, 0x0b, 0x0d, 0x04, 0x1a,
+    0x03, 0x02, 0x0b, 0x11, 0x1a, 0xf0, 0x02, 0x0b, 0x04, 0x09, 0x07, 0x0b,
+    0x0d, 0x0e, 0x1f, 0x0f, 0x0c, 0x07, 0x09, 0x03, 0x18, 0x01, 0x10, 0x09,
+    0x08, 0x01, 0x06, 0x02, 0x08, 0x04, 0x0c, 0x08, 0x2f, 0x1f, 0xf0, 0x0c,
+    0x0e, 0x05, 0x2c, 0x02, 0x21, 0x19, 0x02, 0x18, 0x04, 0x05, 0x2b, 0x16,
+    0x04, 0x0c, 0x03, 0x0a, 0x22, 0x0e, 0x2c, 0xf0, 0x03, 0x04, 0x2d, 0x25,
+    0x0a, 0x04, 0x19, 0x43, 0x17, 0x08, 0x09, 0x04, 0x08, 0x15, 0x09, 0x0a,
+    0x04, 0x0b, 0xf0, 0x03, 0x0e, 0x12, 0x1f, 0x13, 0x0b, 0x0d, 0x04, 0x0c,
+    0x15, 0x1d, 0x04, 0x0b, 0x03, 0x2c, 0x02, 0x11, 0x0b, 0x02, 0x0a, 0x03,
+    0x0d, 0x05, 0x0e, 0xf0, 0x09, 0x0c, 0x0e, 0x0d, 0x0d, 0x0b, 0x06, 0x09,
+    0x03, 0x08, 0x01, 0x0a, 0x10, 0x0c, 0x0b, 0x01, 0x09, 0x02, 0x0d, 0x04,
+    0x3f, 0x09, 0x1f, 0x0b, 0x0b, 0x05, 0x28, 0xf0, 0x02, 0x21, 0x17, 0x02,
+    0x18, 0x04, 0x06, 0x1a, 0x08, 0x07, 0x1c, 0x05, 0x03, 0x0e, 0x22, 0x0f,
+    0x0c, 0x0d, 0x03, 0x1b, 0x04, 0xf0, 0x15, 0x1d, 0x14, 0x0e, 0x09, 0x03,
+    0x08, 0x32, 0x19, 0x0a, 0x1c, 0x03, 0x25, 0x0a, 0x1d, 0x04, 0x1f, 0x33,
+    0x1e, 0xf0, 0x0c, 0x24, 0x09, 0x0a, 0x09, 0x13, 0x0b, 0x09, 0x02, 0x0a,
+    0x11, 0x2c, 0x02, 0x04, 0x0a, 0x06, 0x3c, 0x0a, 0x0f, 0x0e, 0xf0, 0x05,
+    0x0d, 0x03, 0x09, 0x01, 0x1d, 0x10, 0x0c, 0x01, 0x08, 0x02, 0x0a, 0x04,
+    0x0d, 0x08, 0x0e, 0x0c, 0x0f, 0x0e, 0x0e, 0x08, 0x0c, 0x04, 0x0a, 0x02,
+    0x08, 0x21, 0x0a, 0x08, 0xf0, 0x0a, 0x02, 0x0c, 0x04, 0x0d, 0x07, 0x0c,
+    0x08, 0x1d, 0x07, 0x05, 0x0c, 0x03, 0x0a, 0x32, 0x09, 0x07, 0x09, 0x1e,
+    0x03, 0x05, 0x1c, 0x16, 0x1a, 0xf0, 0x05, 0x03, 0x0b, 0x32, 0x0c, 0x0b,
+    0x0a, 0x0b, 0x03, 0x0c, 0x04, 0x0e, 0x25, 0x1d, 0x0b, 0x04, 0x09, 0x83,
+    0x0b, 0x0a, 0x09, 0x0a, 0xf0, 0x0b, 0x0c, 0x0d, 0x0b, 0x08, 0x12, 0x0b,
+    0x1a, 0x03, 0x04, 0x0e, 0x06, 0x0c, 0x08, 0x0d, 0x0a, 0x0e, 0x08, 0x0c,
+    0x04, 0x0b, 0x02, 0x0d, 0x01, 0x0a, 0xf0, 0x10, 0x0b, 0x0c, 0x01, 0x09,
+    0x02, 0x0c, 0x05, 0x0b, 0x09, 0x2e, 0x1f, 0x09, 0x0c, 0x04, 0x0b, 0x02,
+    0x0a, 0x21, 0x0b, 0x09, 0x2a, 0x02, 0x04, 0xf0, 0x06, 0x2c, 0x07, 0x06,
+    0x05, 0x0a, 0x03, 0x09, 0x22, 0x07, 0x08, 0x0a, 0x03, 0x09, 0x05, 0x28,
+    0x09, 0x1c, 0x07, 0x09, 0x06, 0x06, 0x25, 0x04, 0xf0, 0x03, 0x12, 0x06,
+    0x07, 0x03, 0x08, 0x04, 0x09, 0x05, 0x1b, 0x16, 0x2a, 0x05, 0x04, 0x93,
+    0x0e, 0x2b, 0x0c, 0x0e, 0xf0, 0x0b, 0x08, 0x07, 0x26, 0x04, 0x06, 0x07,
+    0x07, 0x09, 0x38, 0x0c, 0x09, 0x05, 0x03, 0x09, 0x02, 0x38, 0x11, 0x02,
+    0xf0, 0x03, 0x19, 0x06, 0x0a, 0x0a, 0x1f, 0x0b, 0x1a, 0x07, 0x04, 0x18,
+    0x02, 0x21, 0x09, 0x08, 0x0a, 0x02, 0x0b, 0x04, 0x1c, 0x07, 0x08, 0x2d,
+    0x07, 0xf0, 0x05, 0x03, 0x0a, 0x22, 0x18, 0x09, 0x03, 0x08, 0x04, 0x0a,
+    0x06, 0x0c, 0x07, 0x1d, 0x06, 0x05, 0x1a, 0x03, 0x02, 0x09, 0x21, 0x0c,
+    0x0a, 0x1f, 0xf0, 0x02, 0x04, 0x0b, 0x06, 0x1c, 0x18, 0x0b, 0x07, 0x09,
+    0x05, 0x18, 0x04, 0x03, 0x09, 0x12, 0x0b, 0x0a, 0x13, 0x08, 0x0a, 0x32,
+    0x2f, 0xf0, 0x0e, 0x03, 0x0c, 0x04, 0x1d, 0x05, 0x07, 0x1c, 0x08, 0x07,
+    0x0a, 0x05, 0x09, 0x03, 0x0a, 0x02, 0x28, 0x21, 0x0d, 0x02, 0x0e, 0x04,
+    0x0c, 0x07, 0x3b, 0xf0, 0x1b, 0x06, 0x04, 0x09, 0x02, 0x0a, 0x11, 0x0c,
+    0x0b, 0x02, 0x08, 0x03, 0x09, 0x05, 0x0a, 0x07, 0x0d, 0x08, 0x0c, 0x06,
+    0x1e, 0x04, 0x02, 0x0c, 0x21, 0x0b, 0xf0, 0x0c, 0x0e, 0x02, 0x0c, 0x04,
+    0x0b, 0x06, 0x0e, 0x09, 0x1c, 0x08, 0x06, 0x0a, 0x04, 0x09, 0x02, 0x0b,
+    0x11, 0x0c, 0x0a, 0x02, 0x18, 0x03, 0x04, 0x0a, 0x07, 0x19, 0xf0, 0x09,
+    0x08, 0x1a, 0x06, 0x04, 0x09, 0x03, 0x0a, 0x22, 0x0c, 0x29, 0x03, 0x54,
+    0x18, 0x19, 0x08, 0x19, 0x05, 0xf0, 0x06, 0x38, 0x17, 0x06, 0x05, 0x07,
+    0x03, 0x18, 0x02, 0x11, 0x1a, 0x02, 0x08, 0x03, 0x4a, 0x05, 0x08, 0x0e,
+    0x0c, 0x06, 0x0b, 0xf0, 0x04, 0x0a, 0x02, 0x1c, 0x21, 0x0b, 0x1e, 0x02,
+    0x04, 0x0c, 0x07, 0x29, 0x08, 0x07, 0x05, 0x08, 0x03, 0x27, 0x22, 0x19,
+    0x03, 0xf0, 0x05, 0x1a, 0x09, 0x0d, 0x0b, 0x0a, 0x1a, 0x06, 0x04, 0x28,
+    0x02, 0x21, 0x07, 0x1a, 0x02, 0x03, 0x0e, 0x06, 0x0c, 0x08, 0x0e, 0x09,
+    0x0c, 0x07, 0x0b, 0xf0, 0x05, 0x09, 0x04, 0x28, 0x03, 0x12, 0x0a, 0x63,
+    0x09, 0x0b, 0x0d, 0x1e, 0x1b, 0x14, 0x09, 0x0b, 0x15, 0x09, 0x0a, 0xf0,
+    0x16, 0x08, 0x27, 0x04, 0x03, 0x22, 0x18, 0x1b, 0x03, 0x04, 0x1c, 0x06,
+    0x07, 0x1e, 0x06, 0x05, 0x0a, 0x03, 0x0e, 0x02, 0x0a, 0x11, 0x0c, 0xf0,
+    0x0d, 0x02, 0x09, 0x03, 0x1a, 0x05, 0x07, 0x1b, 0x08, 0x07, 0x0a, 0x05,
+    0x18, 0x03, 0x22, 0x17, 0x18, 0x03, 0x06, 0x17, 0x0b, 0x0e, 0x29, 0xf0,
+    0x09, 0x06, 0x04, 0x08, 0x02, 0x07, 0x21, 0x18, 0x2c, 0x02, 0x04, 0x07,
+    0x0e, 0x1b, 0x3d, 0x07, 0x04, 0x03, 0x0a, 0x02, 0x09, 0xf0, 0x11, 0x0b,
+    0x0e, 0x02, 0x0a, 0x13, 0x09, 0x0e, 0x34, 0x0b, 0x0c, 0x0a, 0x09, 0x45,
+    0x08, 0x29, 0x0a, 0x04, 0x0c, 0x03, 0x0b, 0xf0, 0x32, 0x0d, 0x09, 0x07,
+    0x0a, 0x03, 0x08, 0x04, 0x09, 0x05, 0x3c, 0x16, 0x05, 0x04, 0x0a, 0x03,
+    0x08, 0x22, 0x09, 0x0a, 0x0c, 0x03, 0x0b, 0xf0, 0x05, 0x0a, 0x16, 0x0b,
+    0x0e, 0x05, 0x0b, 0x03, 0x0c, 0x02, 0x0b, 0x11, 0x0c, 0x0b, 0x02, 0x08,
+    0x03, 0x09, 0x05, 0x1a, 0x09, 0x0d, 0x0b, 0x0a, 0x0a, 0x07, 0x19, 0x04,
+    0xf0, 0x02, 0x18, 0x21, 0x09, 0x1b, 0x02, 0x04, 0x0a, 0x08, 0x39, 0x0e,
+    0x0d, 0x08, 0x05, 0x28, 0x03, 0x02, 0x11, 0x0b, 0x0f, 0x02, 0x1c, 0xf0,
+    0x03, 0x04, 0x0d, 0x05, 0x0b, 0x06, 0x29, 0x05, 0x24, 0x0a, 0x09, 0x13,
+    0x0c, 0x0e, 0x14, 0x0b, 0x1a, 0x13, 0x09, 0x22, 0x0c, 0x0a, 0xf0, 0x0d,
+    0x03, 0x1a, 0x04, 0x05, 0x0c, 0x16, 0x0a, 0x0b, 0x05, 0x0d, 0x04, 0x0b,
+    0x03, 0x09, 0x22, 0x0a, 0x09, 0x0b, 0x03, 0x09, 0x04, 0x0a, 0x15, 0x0b,
+    0x1e, 0xf0, 0x04, 0x03, 0x0c, 0x02, 0x0e, 0x11, 0x1f, 0x02, 0x1d, 0x03,
+    0x05, 0x0c, 0x09, 0x0b, 0x0e, 0x0a, 0x0a, 0x19, 0x06, 0x04, 0x07, 0x02,
+    0x06, 0x21, 0x17, 0xf0, 0x09, 0x02, 0x0a, 0x04, 0x0b, 0x07, 0x0d, 0x0e,
+    0x0c, 0x0d, 0x0b, 0x09, 0x1a, 0x05, 0x03, 0x09, 0x02, 0x08, 0x11, 0x0c,
+    0x0e, 0x02, 0x1b, 0x03, 0x04, 0x0c, 0x15, 0x0a, 0xf0, 0x2b, 0x04, 0x43,
+    0x0c, 0x0b, 0x0a, 0x0e, 0x44, 0x0c, 0x0d, 0x0a, 0x09, 0x07, 0x33, 0x18,
+    0x09, 0x0c, 0xf0, 0x14, 0x0a, 0x0c, 0x15, 0x1a, 0x04, 0x09, 0x03, 0x0a,
+    0x22, 0x1c, 0x0f, 0x03, 0x0b, 0x04, 0x0c, 0x05, 0x0d, 0x06, 0x0b, 0x04,
+    0x0e, 0x03, 0x0d, 0x02, 0x2f, 0xf0, 0x11, 0x02, 0x0b, 0x03, 0x5a, 0x05,
+    0x08, 0x0a, 0x08, 0x05, 0x03, 0x09, 0x02, 0x07, 0x21, 0x08, 0x09, 0x0c,
+    0x03, 0x08, 0x05, 0x0a, 0xf0, 0x08, 0x0d, 0x0e, 0x0e, 0x0b, 0x1d, 0x07,
+    0x04, 0x0c, 0x02, 0x0a, 0x21, 0x0b, 0x09, 0x0b, 0x02, 0x09, 0x03, 0x0b,
+    0x04, 0x1e, 0x05, 0x06, 0x0b, 0x05, 0x0a, 0x14, 0x19, 0xf0, 0x23, 0x0a,
+    0x09, 0x0e, 0x24, 0x1b, 0x0a, 0x13, 0x0d, 0x0a, 0x22, 0x0d, 0x0b, 0x0e,
+    0x03, 0x09, 0x14, 0x08, 0x0a, 0x15, 0x0b, 0xf0, 0x1c, 0x14, 0x1a, 0x33,
+    0x09, 0x0a, 0x0b, 0x04, 0x0a, 0x15, 0x29, 0x04, 0x03, 0x0a, 0x02, 0x0d,
+    0x11, 0x1f, 0x02, 0x0e, 0xf0, 0x03, 0x0d, 0x05, 0x0c, 0x07, 0x1e, 0x09,
+    0x08, 0x0d, 0x05, 0x0b, 0x03, 0x0a, 0x02, 0x08, 0x21, 0x09, 0x08, 0x0b,
+    0x02, 0x0c, 0x04, 0x0b, 0x07, 0x1c, 0x0b, 0x0a, 0x1b, 0xf0, 0x07, 0x04,
+    0x1a, 0x02, 0x21, 0x0e, 0x0b, 0x0e, 0x02, 0x0d, 0x03, 0x0f, 0x05, 0x1d,
+    0x16, 0x0c, 0x05, 0x0a, 0x04, 0x08, 0x03, 0x09, 0x12, 0x1c, 0xf0, 0x13,
+    0x0a, 0x0e, 0x34, 0x0b, 0x0c, 0x0a, 0x09, 0x43, 0x0a, 0x08, 0x09, 0x0a,
+    0x0b, 0x04, 0x0a, 0x15, 0x1b, 0x14, 0x0c, 0x1a, 0xf0, 0x43, 0x29, 0x0c,
+    0x34, 0x1a, 0x09, 0x08, 0x03, 0x09, 0x12, 0x1b, 0x03, 0x1a, 0x04, 0x05,
+    0x0d, 0x07, 0x1c, 0xf0, 0x08, 0x06, 0x0e, 0x04, 0x0a, 0x03, 0x08, 0x02,
+    0x07, 0x11, 0x18, 0x02, 0x07, 0x03, 0x08, 0x05, 0x0a, 0x08, 0x1c, 0x0e,
+    0x0b, 0x1d, 0x07, 0x04, 0x0c, 0x02, 0x0b, 0xf0, 0x21, 0x0e, 0x0b, 0x0c,
+    0x02, 0x0b, 0x03, 0x0d, 0x05, 0x1b, 0x06, 0x05, 0x1e, 0x04, 0x03, 0x0c,
+    0x22, 0x0e, 0x0c, 0x0d, 0x03, 0x1a, 0x04, 0x25, 0x0b, 0xf0, 0x0c, 0x0a,
+    0x04, 0x0c, 0x03, 0x0b, 0x32, 0x1d, 0x0b, 0x0d, 0x03, 0x1b, 0x44, 0x1e,
+    0x0c, 0x09, 0x83, 0x0c, 0x1b, 0xf0, 0x0e, 0x2f, 0x0c, 0x09, 0x12, 0x0c,
+    0x0b, 0x03, 0x19, 0x04, 0x05, 0x0a, 0x06, 0x0b, 0x07, 0x0c, 0x06, 0x0b,
+    0x04, 0x0a, 0xf0, 0x03, 0x19, 0x02, 0x11, 0x0a, 0x0b, 0x02, 0x09, 0x03,
+    0x0a, 0x05, 0x0b, 0x09, 0x1a, 0x0e, 0x0d, 0x19, 0x07, 0x04, 0x08, 0x02,
+    0x09, 0x21, 0x0b, 0x09, 0x0b, 0xf0, 0x02, 0x0c, 0x04, 0x09, 0x06, 0x0a,
+    0x07, 0x0b, 0x06, 0x1d, 0x05, 0x03, 0x1e, 0x22, 0x0c, 0x0d, 0x03, 0x19,
+    0x04, 0x15, 0x0a, 0x0b, 0x14, 0x0e, 0x0b, 0xf0, 0x03, 0x0a, 0x32, 0x0b,
+    0x0a, 0x09, 0x1c, 0x03, 0x04, 0x1d, 0x05, 0x16, 0x0a, 0x29, 0x05, 0x04,
+    0x63, 0x0b, 0x29, 0xf0, 0x0a, 0x0b, 0x0a, 0x22, 0x0f, 0x1e, 0x03, 0x0c,
+    0x04, 0x1b, 0x05, 0x07, 0x1a, 0x08, 0x06, 0x0b, 0x04, 0x0a, 0x03, 0x19,
+    0x02, 0x11, 0x1a, 0xf0, 0x02, 0x18, 0x03, 0x05, 0x09, 0x07, 0x0a, 0x09,
+    0x0c, 0x08, 0x0d, 0x05, 0x1e, 0x03, 0x02, 0x0b, 0x21, 0x0e, 0x0d, 0x1f,
+    0x02, 0x04, 0x0c, 0x06, 0x2b, 0xf0, 0x07, 0x06, 0x05, 0x1a, 0x03, 0x32,
+    0x19, 0x0a, 0x1e, 0x03, 0x04, 0x0f, 0x25, 0x0e, 0x0d, 0x0a, 0x03, 0x1e,
+    0x32, 0x0b, 0xf0, 0x09, 0x0c, 0x03, 0x1b, 0x04, 0x25, 0x1c, 0x0b, 0x04,
+    0x1d, 0xa3, 0x09, 0x18, 0x09, 0x0a, 0x0e, 0x0d, 0xf0, 0x1c, 0x0a, 0x14,
+    0x09, 0x0c, 0x05, 0x3a, 0x16, 0x05, 0x04, 0x18, 0x03, 0x02, 0x09, 0x11,
+    0x0b, 0x0c, 0x02, 0x09, 0x03, 0x1a, 0xf0, 0x05, 0x07, 0x0b, 0x0a, 0x1c,
+    0x09, 0x06, 0x1a, 0x04, 0x02, 0x0d, 0x21, 0x0e, 0x0c, 0x0f, 0x02, 0x0e,
+    0x03, 0x0f, 0x05, 0x0d, 0x16, 0x0b, 0x0a, 0x05, 0x19, 0xf0, 0x03, 0x22,
+    0x1a, 0x0b, 0x03, 0x09, 0x04, 0x0c, 0x06, 0x1a, 0x17, 0x09, 0x05, 0x0a,
+    0x03, 0x0d, 0x02, 0x0b, 0x11, 0x0f, 0x0d, 0x02, 0x09, 0x03, 0x08, 0xf0,
+    0x04, 0x49, 0x06, 0x17, 0x06, 0x04, 0x0a, 0x93, 0x0b, 0x09, 0x18, 0x0a,
+    0x0d, 0x1c, 0x0b, 0x0a, 0xf0, 0x04, 0x08, 0x15, 0x07, 0x18, 0x06, 0x07,
+    0x47, 0x06, 0x05, 0x04, 0x03, 0x22, 0x18, 0x0d, 0x03, 0x0c, 0x04, 0x0e,
+    0x06, 0x0c, 0x08, 0x1b, 0xf0, 0x07, 0x04, 0x0e, 0x03, 0x0c, 0x02, 0x0b,
+    0x21, 0x0e, 0x0d, 0x1f, 0x02, 0x04, 0x0c, 0x06, 0x0b, 0x08, 0x19, 0x07,
+    0x05, 0x4a, 0x03, 0x22, 0xf0, 0x03, 0x09, 0x04, 0x0a, 0x05, 0x1c, 0x06,
+    0x05, 0x0e, 0x04, 0x0d, 0x03, 0x0c, 0x32, 0x0a, 0x17, 0x0a, 0x03, 0x09,
+    0x04, 0x2c, 0x06, 0x17, 0xf0, 0x0b, 0x06, 0x2a, 0x04, 0x03, 0x22, 0x0b,
+    0x09, 0x0a, 0x03, 0x08, 0x74, 0x07, 0x08, 0x29, 0x0a, 0x0c, 0x0d, 0xf0,
+    0x25, 0x0b, 0x0a, 0x09, 0x04, 0x0a, 0x13, 0x09, 0x07, 0x22, 0x18, 0x0b,
+    0x03, 0x0a, 0x04, 0x0b, 0x05, 0x0d, 0x07, 0x0b, 0x06, 0x0c, 0x05, 0x0a,
+    0x04, 0x09, 0xf0, 0x03, 0x08, 0x22, 0x19, 0x0b, 0x03, 0x0a, 0x05, 0x09,
+    0x17, 0x08, 0x19, 0x06, 0x05, 0x07, 0x03, 0x08, 0x22, 0x39, 0x03, 0x05,
+    0x08, 0xf0, 0x09, 0x17, 0x1c, 0x06, 0x0b, 0x45, 0x07, 0x04, 0x23, 0x56,
+    0x04, 0x06, 0x0a, 0x0e, 0x1d, 0x35, 0x07, 0xf0, 0x05, 0x14, 0x64, 0x05,
+    0x06, 0x08, 0x0a, 0x0c, 0x0d, 0x08, 0x05, 0x36, 0x36, 0x15, 0x17, 0xf0,
+    0x04, 0x08, 0x03, 0x09, 0x22, 0x0d, 0x1a, 0x13, 0x08, 0x1c, 0x04, 0x06,
+    0x1a, 0x17, 0x09, 0x05, 0x1a, 0x04, 0x03, 0x08, 0x22, 0x09, 0x08, 0xf0,
+    0x0a, 0x03, 0x09, 0x04, 0x3a, 0x05, 0x06, 0x05, 0x04, 0x19, 0x03, 0x22,
+    0x0b, 0x0a, 0x0d, 0x03, 0x0b, 0x04, 0x0e, 0x06, 0x1c, 0x07, 0x06, 0x0b,
+    0xf0, 0x05, 0x0a, 0x03, 0x0b, 0x02, 0x08, 0x21, 0x0b, 0x0c, 0x0f, 0x02,
+    0x0e, 0x04, 0x0a, 0x06, 0x0c, 0x18, 0x1b, 0x06, 0x1c, 0x04, 0x03, 0x1a,
+    0x32, 0x08, 0xf0, 0x0a, 0x0e, 0x03, 0x0b, 0xa4, 0x0a, 0x0b, 0x0c, 0x0a,
+    0x49, 0x0b, 0x0a, 0x13, 0x0c, 0x0b, 0xf0, 0x12, 0x0f, 0x0d, 0x23, 0x09,
+    0x0b, 0x0f, 0x04, 0x0e, 0x15, 0x1b, 0x04, 0x0c, 0x13, 0x0e, 0x08, 0x22,
+    0x1a, 0x0d, 0x03, 0x0b, 0x04, 0x1c, 0xf0, 0x05, 0x06, 0x0b, 0x05, 0x0a,
+    0x04, 0x09, 0x03, 0x0a, 0x22, 0x0b, 0x0a, 0x0c, 0x03, 0x0a, 0x04, 0x0b,
+    0x16, 0x0a, 0x0d, 0x05, 0x1e, 0x04, 0x03, 0x0b, 0x32, 0x09, 0xf0, 0x17,
+    0x29, 0x03, 0x05, 0x07, 0x3b, 0x09, 0x08, 0x06, 0x04, 0x0a, 0x02, 0x0e,
+    0x21, 0x0f, 0x0e, 0x0f, 0x02, 0x2b, 0x03, 0xf0, 0x14, 0x0e, 0x15, 0x0b,
+    0x09, 0x64, 0x1a, 0x09, 0x08, 0x09, 0x0a, 0x09, 0x63, 0x0b, 0x0a, 0x08,
+    0x07, 0x08, 0xf0, 0x09, 0x0e, 0x14, 0x0c, 0x0e, 0x15, 0x0b, 0x1a, 0x04,
+    0x43, 0x0b, 0x18, 0x09, 0x0b, 0x04, 0x0a, 0x15, 0x09, 0x0a, 0x04, 0x1b,
+    0xf0, 0x13, 0x09, 0x22, 0x1a, 0x0e, 0x03, 0x0b, 0x05, 0x09, 0x08, 0x08,
+    0x0b, 0x07, 0x0c, 0x36, 0x08, 0x05, 0x03, 0x22, 0x17, 0x18, 0xf0, 0x03,
+    0x04, 0x0b, 0x06, 0x0c, 0x08, 0x1b, 0x07, 0x06, 0x1a, 0x04, 0x32, 0x0d,
+    0x18, 0x09, 0x03, 0x08, 0x04, 0x09, 0x35, 0x0a, 0x0c, 0x0d, 0xf0, 0x19,
+    0x14, 0x08, 0xa3, 0x19, 0x0b, 0x0d, 0x0e, 0x1d, 0x0b, 0x09, 0x0a, 0x0b,
+    0x24, 0x09, 0x0a, 0xf0, 0x0d, 0x15, 0x0b, 0x09, 0x14, 0x0a, 0x18, 0x43,
+    0x07, 0x08, 0x09, 0x0e, 0x24, 0x0b, 0x0d, 0x0a, 0x13, 0x0e, 0x0b, 0x12,
+    0x0d, 0xf0, 0x0e, 0x03, 0x0a, 0x04, 0x09, 0x05, 0x0a, 0x16, 0x0b, 0x0c,
+    0x05, 0x0e, 0x04, 0x0a, 0x03, 0x09, 0x02, 0x08, 0x21, 0x0b, 0x0c, 0x1f,
+    0x02, 0x04, 0x0d, 0x07, 0x0b, 0xf0, 0x0a, 0x0a, 0x08, 0x0b, 0x06, 0x0c,
+    0x04, 0x0b, 0x02, 0x0e, 0x21, 0x2f, 0x02, 0x0d, 0x03, 0x0c, 0x04, 0x0d,
+    0x15, 0x1b, 0x04, 0x0c, 0x33, 0x0e, 0x0b, 0xf0, 0x19, 0x54, 0x08, 0x09,
+    0x1b, 0x0a, 0x09, 0x43, 0x0a, 0x19, 0x0a, 0x0b, 0x44, 0x09, 0x0d, 0x0c,
+    0xf0, 0x0a, 0x09, 0x33, 0x0a, 0x09, 0x0a, 0x0b, 0x04, 0x09, 0x15, 0x18,
+    0x04, 0x0a, 0x13, 0x0e, 0x0a, 0x22, 0x1d, 0x0f, 0x03, 0x1d, 0xf0, 0x04,
+    0x05, 0x0c, 0x16, 0x0a, 0x09, 0x04, 0x0a, 0x03, 0x09, 0x32, 0x0a, 0x07,
+    0x08, 0x0a, 0x03, 0x0b, 0x05, 0x0a, 0x07, 0x0b, 0x08, 0x0d, 0x07, 0x0c,
+    0x05, 0x1e, 0xf0, 0x03, 0x02, 0x0a, 0x21, 0x0e, 0x0d, 0x0f, 0x02, 0x0d,
+    0x03, 0x0e, 0x05, 0x4a, 0x16, 0x05, 0x04, 0x43, 0x0b, 0x19, 0x0b, 0xf0,
+    0x0d, 0x34, 0x2a, 0x19, 0x43, 0x18, 0x09, 0x0a, 0x04, 0x09, 0x15, 0x1a,
+    0x14, 0x0e, 0x0c, 0xc3, 0x0e, 0xf0, 0x0b, 0x1a, 0x0c, 0x2d, 0x0b, 0x0a,
+    0x18, 0x0b, 0x04, 0x2a, 0x05, 0x06, 0x07, 0x19, 0xf0, 0x06, 0x04, 0x1a,
+    0x03, 0x02, 0x0b, 0x11, 0x1e, 0x02, 0x19, 0x03, 0x04, 0x1c, 0x06, 0x17,
+    0x0d, 0x0b, 0x06, 0x19, 0x04, 0x03, 0x07, 0x22, 0x18, 0xf0, 0x19, 0x03,
+    0x04, 0x0a, 0x05, 0x0c, 0x06, 0x0b, 0x05, 0x0d, 0x04, 0x0e, 0x03, 0x0d,
+    0x32, 0x0f, 0x0c, 0x0d, 0x0f, 0x03, 0x0c, 0x34, 0x0b, 0x1d, 0xf0, 0x1c,
+    0x53, 0x19, 0x08, 0x0a, 0x0e, 0x44, 0x0c, 0x0e, 0x0d, 0x0b, 0x09, 0x53,
+    0x0a, 0x19, 0xf0, 0x0a, 0x0b, 0x0d, 0x64, 0x19, 0x08, 0x17, 0x08, 0x0a,
+    0x15, 0x09, 0x0b, 0x06, 0x19, 0x05, 0x04, 0x08, 0x03, 0x09, 0xf0, 0x02,
+    0x0a, 0x11, 0x0e, 0x0f, 0x02, 0x1b, 0x03, 0x05, 0x3a, 0x07, 0x09, 0x08,
+    0x06, 0x19, 0x04, 0x32, 0x0d, 0x08, 0x07, 0x18, 0x03, 0xf0, 0x04, 0x09,
+    0x06, 0x18, 0x07, 0x06, 0x19, 0x05, 0x04, 0x38, 0x33, 0x0a, 0x04, 0x19,
+    0x25, 0x1a, 0x04, 0x1c, 0x03, 0xf0, 0x32, 0x0e, 0x0c, 0x0a, 0x0e, 0x03,
+    0x0b, 0x04, 0x0a, 0x25, 0x09, 0x1a, 0x04, 0x0c, 0xb3, 0x0d, 0x3a, 0x0c,
+    0xf0, 0x0e, 0x0d, 0x0c, 0x1a, 0x0c, 0x14, 0x09, 0x0b, 0x15, 0x1a, 0x04,
+    0x0c, 0x13, 0x0e, 0x0a, 0x32, 0x0d, 0x09, 0x0a, 0xf0, 0x0e, 0x03, 0x0c,
+    0x04, 0x0e, 0x06, 0x1b, 0x17, 0x19, 0x05, 0x04, 0x08, 0x03, 0x07, 0x22,
+    0x08, 0x07, 0x19, 0x03, 0x04, 0x0a, 0x05, 0x0c, 0x16, 0x0b, 0xf0, 0x1a,
+    0x05, 0x03, 0x0d, 0x32, 0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x0e, 0x34, 0x0c,
+    0x1e, 0x0b, 0x03, 0x0c, 0x22, 0x0e, 0x0b, 0x0a, 0xf0, 0x13, 0x08, 0x2c,
+    0x04, 0x25, 0x0d, 0x0c, 0x04, 0x0e, 0xa3, 0x0d, 0x09, 0x28, 0x0a, 0x1c,
+    0x2d, 0xf0, 0x24, 0x09, 0x0b, 0x0c, 0x15, 0x1a, 0x04, 0x0c, 0x13, 0x0e,
+    0x0a, 0x32, 0x0c, 0x19, 0x0c, 0x03, 0x0b, 0x04, 0x0c, 0xf0, 0x05, 0x1d,
+    0x16, 0x0b, 0x05, 0x19, 0x04, 0x03, 0x08, 0x22, 0x19, 0x0b, 0x03, 0x0a,
+    0x04, 0x0b, 0x25, 0x0c, 0x0d, 0x1b, 0x04, 0x03, 0x0a, 0xf0, 0x22, 0x0c,
+    0x1b, 0x03, 0x39, 0x04, 0x05, 0x06, 0x15, 0x0b, 0x29, 0x04, 0x03, 0x22,
+    0x0b, 0x0a, 0x0e, 0x03, 0x2a, 0x04, 0xf0, 0x35, 0x1b, 0x09, 0x04, 0x08,
+    0x33, 0x09, 0x08, 0x07, 0x08, 0xb4, 0x07, 0x19, 0x1a, 0x09, 0x2a, 0xf0,
+    0x0b, 0x0a, 0x09, 0x03, 0x0c, 0x42, 0x0f, 0x0d, 0x0a, 0x0b, 0x0f, 0x03,
+    0x0e, 0x04, 0x0d, 0x05, 0x1e, 0x16, 0x0a, 0xf0, 0x05, 0x19, 0x04, 0x03,
+    0x08, 0x22, 0x09, 0x08, 0x0a, 0x03, 0x09, 0x04, 0x1a, 0x05, 0x16, 0x09,
+    0x18, 0x05, 0x04, 0x07, 0x33, 0x28, 0xf0, 0x2b, 0x04, 0x25, 0x0d, 0x0b,
+    0x04, 0x1c, 0x03, 0x32, 0x0b, 0x19, 0x0b, 0x03, 0x09, 0x04, 0x0a, 0x05,
+    0x0c, 0x16, 0x0a, 0x1b, 0xf0, 0x05, 0x04, 0x09, 0x43, 0x0a, 0x08, 0x07,
+    0x08, 0x09, 0xb4, 0x08, 0x09, 0x1a, 0x39, 0x1a, 0xf0, 0x19, 0x43, 0x0b,
+    0x09, 0x18, 0x09, 0x04, 0x28, 0x05, 0x26, 0x09, 0x38, 0x05, 0x04, 0x03,
+    0xf0, 0x22, 0x1a, 0x0d, 0x03, 0x2b, 0x04, 0x25, 0x0d, 0x2b, 0x04, 0x03,
+    0x22, 0x0e, 0x1d, 0x03, 0x0a, 0x04, 0x19, 0x25, 0xf0, 0x0b, 0x0a, 0x04,
+    0x0c, 0x03, 0x0d, 0x32, 0x0c, 0x1a, 0x0d, 0x03, 0x0b, 0x04, 0x0c, 0x05,
+    0x0d, 0x16, 0x0b, 0x1a, 0x05, 0x04, 0x19, 0x03, 0xf0, 0x12, 0x0b, 0x09,
+    0x03, 0x07, 0x04, 0x16, 0x25, 0x07, 0x08, 0x06, 0x07, 0x05, 0x08, 0x64,
+    0x2a, 0x29, 0x08, 0xf0, 0x53, 0x0a, 0x09, 0x18, 0x09, 0x0b, 0x04, 0x19,
+    0x25, 0x1a, 0x14, 0x0c, 0x09, 0x03, 0x0a, 0x22, 0x1e, 0x0f, 0xf0, 0x03,
+    0x0c, 0x04, 0x0a, 0x15, 0x09, 0x0a, 0x04, 0x0b, 0x13, 0x0e, 0x0a, 0x22,
+    0x0e, 0x0d, 0x0e, 0x03, 0x0b, 0x04, 0x1a, 0x25, 0x0c, 0x0b, 0x04, 0x2d,
+    0xf0, 0x03, 0x32, 0x1a, 0x0c, 0x03, 0x1a, 0x04, 0x25, 0x0b, 0x0e, 0x0c,
+    0x04, 0x1e, 0x03, 0x32, 0x0f, 0x0c, 0x0b, 0x0e, 0xf0, 0x13, 0x0a, 0x0e,
+    0x44, 0x0b, 0x0d, 0x0e, 0x0b, 0x09, 0xb3, 0x0e, 0x0c, 0x0b, 0x0c, 0x0d,
+    0x0c, 0x1b, 0x1a, 0xf0, 0x0b, 0x0d, 0x54, 0x0a, 0x0c, 0x0e, 0x0d, 0x0b,
+    0x09, 0x53, 0x0a, 0x18, 0x09, 0x0b, 0x0e, 0x34, 0x0b, 0xf0, 0x0d, 0x0b,
+    0x09, 0x43, 0x0c, 0x19, 0x0a, 0x0d, 0x04, 0x0b, 0x25, 0x1a, 0x09, 0x04,
+    0x0a, 0x03, 0x0b, 0x32, 0x0c, 0x1a, 0xf0, 0x0d, 0x03, 0x0a, 0x04, 0x1b,
+    0x05, 0x16, 0x0a, 0x09, 0x05, 0x1a, 0x04, 0x03, 0x09, 0x32, 0x1c, 0x0e,
+    0x0f, 0x03, 0x0c, 0x44, 0x0a, 0xf0, 0x0b, 0x0c, 0x0a, 0x09, 0xc3, 0x0d,
+    0x0c, 0x0b, 0x0d, 0x3e, 0x0c, 0x2b, 0xf0, 0x0d, 0x34, 0x09, 0x0a, 0x0b,
+    0x0a, 0x53, 0x0e, 0x0b, 0x19, 0x0a, 0x0c, 0x44, 0x09, 0x0b, 0x0c, 0x0a,
+    0x09, 0xf0, 0x43, 0x0c, 0x19, 0x0a, 0x0c, 0x44, 0x0a, 0x0c, 0x0d, 0x0c,
+    0x0a, 0x03, 0x0b, 0x32, 0x0e, 0x1d, 0x0f, 0x03, 0x0c, 0xf0, 0x04, 0x1b,
+    0x25, 0x0c, 0x0b, 0x04, 0x0d, 0x03, 0x0e, 0x42, 0x0f, 0x1c, 0x0e, 0x0f,
+    0x03, 0x0d, 0x34, 0x0b, 0x0d, 0x0e, 0x0c, 0xf0, 0xe3, 0x0f, 0x0e, 0x1b,
+    0x0c, 0x3d, 0x0c, 0x0b, 0x0a, 0x0b, 0x0d, 0x0e, 0x24, 0x0a, 0xf0, 0x1b,
+    0x63, 0x0f, 0x0e, 0x0b, 0x0a, 0x1b, 0x0d, 0x24, 0x29, 0x53, 0x0d, 0x0b,
+    0x1a, 0xf0, 0x0b, 0x0e, 0x44, 0x0a, 0x0c, 0x0d, 0x0c, 0x09, 0x03, 0x0c,
+    0x32, 0x0f, 0x1d, 0x0f, 0x03, 0x0b, 0x04, 0x0a, 0x25, 0x09, 0x1a, 0xf0,
+    0x04, 0x0c, 0x53, 0x0e, 0x09, 0x18, 0x09, 0x0a, 0x44, 0x09, 0x0b, 0x1c,
+    0x0a, 0x63, 0x0e, 0x0b, 0x1a, 0xf0, 0x0b, 0x0c, 0x0d, 0xb4, 0x29, 0x48,
+    0x09, 0x1a, 0x09, 0xf0, 0xe3, 0x0e, 0x0b, 0x1a, 0x0b, 0x0d, 0x3e, 0x0d,
+    0x1b, 0x0c, 0x0e, 0x34, 0x0a, 0xf0, 0x1b, 0x0a, 0x53, 0x0d, 0x0b, 0x09,
+    0x18, 0x09, 0x14, 0x08, 0x0a, 0x15, 0x09, 0x0a, 0x14, 0x0e, 0x0c, 0x63,
+    0x0e, 0xf0, 0x09, 0x18, 0x09, 0x0a, 0x0e, 0x34, 0x0a, 0x1b, 0x0a, 0x53,
+    0x0e, 0x0b, 0x0a, 0x0b, 0x0c, 0x0d, 0xf0, 0x34, 0x39, 0x53, 0x0c, 0x3b,
+    0x0d, 0x34, 0x39, 0xd3, 0x0e, 0x2c, 0xf0, 0x0d, 0x3e, 0x0c, 0x1b, 0x0c,
+    0x0e, 0x34, 0x09, 0x2a, 0xf0, 0x63, 0x0e, 0x0c, 0x0a, 0x19, 0x0b, 0x0d,
+    0x54, 0x0a, 0x0c, 0x0d, 0x0c, 0x0a, 0x08, 0x43, 0x0a, 0x09, 0x08, 0xf0,
+    0x09, 0x0b, 0x44, 0x09, 0x0a, 0x1b, 0x0a, 0x63, 0x0e, 0x3b, 0x0c, 0x0e,
+    0x24, 0x29, 0xf0, 0xf3, 0x0c, 0x2b, 0x0c, 0x0e, 0x3f, 0x0e, 0x0c, 0x1b,
+    0x1c, 0xf0, 0x63, 0x6d, 0x44, 0x19, 0x1a, 0x09, 0x63, 0x0e, 0x0c, 0x0a,
+    0xf0, 0x09, 0x0a, 0x0b, 0x0c, 0x44, 0x09, 0x2b, 0x0a, 0x53, 0x0d, 0x0b,
+    0x2a, 0x0c, 0x44, 0x09, 0xf0, 0x2a, 0x09, 0x43, 0x0d, 0x3b, 0x44, 0x08,
+    0x39, 0x53, 0x0e, 0x0c, 0xf0, 0x1b, 0x0c, 0x0d, 0x34, 0x39, 0xf3, 0x0e,
+    0x4c, 0x0d, 0xae, 0xf0, 0x83, 0x0d, 0x0c, 0x0b, 0x0a, 0x0b, 0x0c, 0xf0,
+    0x0d, 0x44, 0x09, 0x0a, 0x0b, 0x0a, 0x09, 0x63, 0x0d, 0x0b, 0x1a, 0x0b,
+    0x0c, 0x0e, 0x34, 0x09, 0x0a, 0x19, 0xf0, 0x53, 0x0d, 0x3c, 0x0e, 0x34,
+    0x39, 0x63, 0x0d, 0x0c, 0x1b, 0x0c, 0xf0, 0x0d, 0x0e, 0x34, 0x39, 0xf3,
+    0x0d, 0x3c, 0x2d, 0x1e, 0xf0, 0x0d, 0x5e, 0x83, 0x1d, 0x3c, 0x1e, 0x24,
+    0x29, 0xf0, 0x73, 0x0e, 0x0d, 0x0c, 0x1b, 0x0c, 0x0d, 0x0e, 0x34, 0x39,
+    0xf3, 0x0d, 0x3c, 0xf0, 0x0d, 0x3e, 0x0d, 0x3c, 0x0d, 0x03, 0x0e, 0x34,
+    0x39, 0xf0, 0xf3, 0x0d, 0x3c, 0x1d, 0x9e, 0xf0, 0xf3, 0x1d, 0x2c, 0x1d,
+    0x4e, 0xf0, 0x1d, 0x2c, 0xf3, 0x0d, 0x4e, 0x1d, 0x1c, 0x0d, 0xf0, 0x4e,
+    0xf3, 0x1d, 0x1c, 0x1d, 0x4e, 0xf0, 0x6d, 0xf3, 0x4e, 0xbd, 0xf0, 0xf3,
+    0x4e, 0x6d, 0xf0, 0xe3, 0x2e, 0x7d, 0x0e, 0x20, 0x1d, 0x03, 0x0d, 0x00
+};
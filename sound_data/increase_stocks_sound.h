@@ -0,0 +1,701 @@
+const uint8_t increase_stocks_sound [] = {
+    0xfa, 0xf3, 0xf0, 0x2a, 0xf3, 0xf0, 0x09, 0x1a, 0x0b, 0x0a, 0x09, 0x0d,
+    0x08, 0x0b, 0x0e, 0x08, 0x07, 0x0f, 0x0e, 0xf3, 0xf0, 0x09, 0x08, 0x09,
+    0x0c, 0x0d, 0x0a, 0x07, 0x0e, 0x08, 0x0b, 0x0e, 0x0a, 0x06, 0x0b, 0x0f,
+    0x0b, 0xa3, 0xf0, 0x09, 0x08, 0x0d, 0x0b, 0x0e, 0x07, 0x0b, 0x0a, 0x09,
+    0x0c, 0x09, 0x14, 0x15, 0x45, 0x07, 0x05, 0x06, 0xf0, 0x34, 0x06, 0x07,
+    0x19, 0x02, 0x13, 0x1d, 0x02, 0x1c, 0x03, 0x04, 0x0a, 0x03, 0x09, 0x02,
+    0x0d, 0x04, 0x09, 0x03, 0x1a, 0x04, 0x12, 0x0d, 0xf0, 0x0f, 0x13, 0x0b,
+    0x1c, 0x02, 0x13, 0x1b, 0x02, 0x09, 0x03, 0x0b, 0x04, 0x09, 0x03, 0x18,
+    0x02, 0x03, 0x0a, 0x02, 0x0d, 0x03, 0x0c, 0x12, 0x1a, 0xf0, 0x04, 0x09,
+    0x05, 0x08, 0x04, 0x29, 0x05, 0x06, 0x03, 0x0b, 0x05, 0x0a, 0x06, 0x18,
+    0x04, 0x02, 0x0a, 0x13, 0x1c, 0x04, 0x2b, 0x03, 0x02, 0x04, 0x09, 0xf0,
+    0x03, 0x0c, 0x12, 0x1d, 0x03, 0x0a, 0x01, 0x0c, 0x02, 0x0d, 0x03, 0x0a,
+    0x22, 0x0b, 0x08, 0x0a, 0x13, 0x08, 0x0a, 0x02, 0x0e, 0x01, 0x0b, 0x03,
+    0x0a, 0x14, 0x07, 0xf0, 0x16, 0x15, 0x07, 0x23, 0x08, 0x0b, 0x0f, 0x22,
+    0x0d, 0x0b, 0x0a, 0x03, 0x1b, 0x15, 0x0a, 0x03, 0x0d, 0x17, 0x0c, 0x0d,
+    0x05, 0x0c, 0xf0, 0x06, 0x1e, 0x05, 0x03, 0x0d, 0x14, 0x0b, 0x0c, 0x12,
+    0x0f, 0x0c, 0x11, 0x0e, 0x0f, 0x02, 0x0d, 0x01, 0x0c, 0x00, 0x0e, 0x12,
+    0x09, 0x08, 0x01, 0x09, 0x12, 0x0d, 0xf0, 0x0a, 0x01, 0x1b, 0x42, 0x0d,
+    0x08, 0x0a, 0x08, 0x03, 0x19, 0x09, 0x07, 0x0a, 0x05, 0x0c, 0x0a, 0x0e,
+    0x09, 0x0c, 0x04, 0x0d, 0x05, 0x0f, 0x04, 0x0e, 0xf0, 0x01, 0x1f, 0x02,
+    0x43, 0x0b, 0x09, 0x1a, 0x19, 0x06, 0x04, 0x07, 0x02, 0x26, 0x04, 0x03,
+    0x01, 0x08, 0x02, 0x0a, 0x03, 0x0d, 0x01, 0x0c, 0xf0, 0x03, 0x0b, 0x05,
+    0x0c, 0x04, 0x0d, 0x03, 0x0e, 0x12, 0x4f, 0x04, 0x03, 0x01, 0x14, 0x0c,
+    0x09, 0x02, 0x2a, 0x03, 0x04, 0x01, 0x0d, 0x02, 0x09, 0xf0, 0x13, 0x0a,
+    0x08, 0x02, 0x0a, 0x11, 0x1b, 0x12, 0x0a, 0x19, 0x00, 0x22, 0x08, 0x0c,
+    0x0a, 0x04, 0x09, 0x09, 0x1a, 0x18, 0x0d, 0x1f, 0x1f, 0xf0, 0x08, 0x0e,
+    0x03, 0x0d, 0x04, 0x0a, 0x15, 0x0b, 0x19, 0x02, 0x03, 0x0b, 0x04, 0x0e,
+    0x03, 0x0b, 0x02, 0x0a, 0x03, 0x09, 0x02, 0x0a, 0x01, 0x07, 0x02, 0x08,
+    0x03, 0x07, 0xf0, 0x02, 0x28, 0x01, 0x22, 0x0c, 0x1f, 0x10, 0x0d, 0x12,
+    0x0a, 0x09, 0x01, 0x0d, 0x02, 0x0e, 0x04, 0x0c, 0x03, 0x09, 0x07, 0x0a,
+    0x08, 0x19, 0x04, 0x20, 0x02, 0x08, 0x11, 0x0b, 0x07, 0x31, 0x02, 0x06,
+    0x11, 0x08, 0x07, 0x05, 0x06, 0xb2, 0x09, 0x07, 0x07, 0x08, 0x08, 0x0a,
+    0x0d, 0x1c, 0x14, 0x0e, 0x05, 0x09, 0x02, 0x07, 0x21, 0x05, 0x04, 0x03,
+    0x12, 0x01, 0x03, 0xd0, 0x14, 0x00, 0x01, 0x15, 0x02, 0x11, 0x46, 0x02,
+    0x01, 0x02, 0x04, 0x07, 0x31, 0x18, 0x0b, 0x0f, 0x02, 0x01, 0x0d, 0x04,
+    0x52, 0x0a, 0x02, 0x09, 0x04, 0x0b, 0x0f, 0x0c, 0x08, 0x0a, 0x06, 0x09,
+    0x05, 0xc1, 0x0c, 0x02, 0x1a, 0x01, 0x02, 0x1b, 0x10, 0x0e, 0x11, 0x0c,
+    0x18, 0x03, 0x05, 0x07, 0x01, 0x06, 0x00, 0x17, 0x02, 0x31, 0xf0, 0x0c,
+    0x0b, 0x1e, 0x03, 0x1a, 0x09, 0x06, 0x19, 0x05, 0x06, 0x0a, 0x02, 0x09,
+    0x03, 0x0d, 0x06, 0x0a, 0x02, 0x19, 0x01, 0x34, 0x0a, 0x09, 0xe0, 0x18,
+    0x12, 0x09, 0x0b, 0x03, 0x0a, 0x02, 0x18, 0x01, 0x03, 0x16, 0x11, 0x07,
+    0x04, 0x06, 0x02, 0x05, 0x00, 0x16, 0x12, 0x18, 0x01, 0x11, 0x02, 0x1c,
+    0x01, 0x82, 0x04, 0x0e, 0x0f, 0x1d, 0x0b, 0x07, 0x0e, 0x0f, 0x0d, 0x03,
+    0x0b, 0x02, 0x08, 0x06, 0x27, 0x04, 0x21, 0x01, 0x02, 0x06, 0x03, 0x50,
+    0x18, 0x12, 0x09, 0x00, 0x0a, 0x01, 0x09, 0x02, 0x08, 0x10, 0x41, 0x06,
+    0x17, 0x02, 0x01, 0x16, 0x00, 0x03, 0x60, 0x28, 0x02, 0x10, 0x09, 0x11,
+    0x08, 0x09, 0x02, 0x0d, 0x01, 0x21, 0x18, 0x04, 0x0f, 0x09, 0x0a, 0x80,
+    0x0b, 0x09, 0x0a, 0x0f, 0x08, 0x04, 0x05, 0x00, 0x04, 0x11, 0x15, 0x00,
+    0x07, 0x01, 0x1c, 0x03, 0x01, 0x06, 0x02, 0x0d, 0x0f, 0x04, 0x3b, 0x0d,
+    0x05, 0x0b, 0x07, 0x0f, 0x0a, 0x14, 0x06, 0x0a, 0x03, 0x0b, 0x07, 0x02,
+    0x09, 0x03, 0x01, 0x18, 0x00, 0xf0, 0x11, 0x06, 0x05, 0x30, 0x04, 0x13,
+    0x15, 0x01, 0x10, 0x06, 0x05, 0x02, 0x06, 0x01, 0x05, 0x00, 0x08, 0x03,
+    0x17, 0x02, 0x00, 0x06, 0x02, 0x11, 0x05, 0x05, 0x26, 0x04, 0x02, 0x07,
+    0x13, 0x08, 0x07, 0x09, 0x04, 0x08, 0x0f, 0x05, 0x29, 0x0c, 0x03, 0x04,
+    0x02, 0x08, 0x01, 0x2a, 0x03, 0xf0, 0x00, 0x12, 0x0d, 0x0e, 0x00, 0x0a,
+    0x02, 0x07, 0x04, 0x18, 0x12, 0x0a, 0x11, 0x19, 0x03, 0x1c, 0x02, 0x01,
+    0x1a, 0x07, 0x06, 0x0b, 0x02, 0xf0, 0x0d, 0x0a, 0x1f, 0x0f, 0x12, 0x0a,
+    0x0c, 0x04, 0x0b, 0x02, 0x08, 0x03, 0x0a, 0x02, 0x0b, 0x01, 0x0a, 0x04,
+    0x0b, 0x05, 0x0a, 0x02, 0x08, 0x05, 0x09, 0x04, 0x07, 0x00, 0x06, 0x02,
+    0x90, 0x08, 0x04, 0x09, 0x10, 0x0d, 0x0e, 0x02, 0x0a, 0x01, 0x17, 0x12,
+    0x06, 0x00, 0x07, 0x01, 0x0b, 0x02, 0x11, 0x08, 0x01, 0x39, 0x04, 0x02,
+    0x08, 0x03, 0x02, 0x04, 0x05, 0x06, 0x2b, 0x0f, 0x08, 0x03, 0x06, 0x01,
+    0x05, 0x0a, 0x03, 0x04, 0x18, 0x22, 0x03, 0x02, 0x0a, 0x01, 0x09, 0x10,
+    0xf0, 0x0b, 0x1f, 0x01, 0x00, 0x0b, 0x01, 0x0a, 0x03, 0x07, 0x00, 0x05,
+    0x01, 0x06, 0x05, 0x09, 0x02, 0x1a, 0x00, 0x32, 0x08, 0x17, 0x08, 0x10,
+    0x09, 0x21, 0x07, 0x22, 0x39, 0x42, 0x0c, 0x04, 0x07, 0x03, 0x08, 0x0f,
+    0x07, 0x05, 0x01, 0x25, 0x30, 0x30, 0x24, 0x01, 0x11, 0x10, 0x06, 0x02,
+    0x0a, 0x14, 0x04, 0x0b, 0x06, 0x0c, 0x03, 0x0a, 0x0e, 0x0f, 0x0f, 0x0f,
+    0x05, 0x0b, 0x0d, 0x02, 0x07, 0x1b, 0x0f, 0x05, 0x0e, 0x03, 0x08, 0x21,
+    0x02, 0x16, 0x21, 0x05, 0x00, 0x14, 0x01, 0xe0, 0x10, 0x13, 0x11, 0x24,
+    0x00, 0x03, 0x05, 0x02, 0x14, 0x00, 0x03, 0x05, 0x04, 0x17, 0x10, 0x08,
+    0x02, 0x09, 0x03, 0x0e, 0x26, 0x11, 0x0a, 0x1e, 0x02, 0x1f, 0x13, 0x0f,
+    0x1d, 0x06, 0x12, 0x0f, 0x1b, 0x07, 0x21, 0x00, 0x08, 0x01, 0x07, 0x05,
+    0xf0, 0x0a, 0x01, 0x09, 0x00, 0x07, 0x11, 0x0a, 0x0e, 0x02, 0x0b, 0x11,
+    0x0a, 0x08, 0x04, 0x29, 0x05, 0x02, 0x06, 0x0a, 0x0b, 0x09, 0x02, 0x08,
+    0x03, 0x0a, 0x0f, 0x0f, 0x06, 0xf0, 0x0d, 0x01, 0x0b, 0x02, 0x0a, 0x03,
+    0x19, 0x04, 0x03, 0x08, 0x01, 0x09, 0x03, 0x0a, 0x05, 0x09, 0x02, 0x18,
+    0x04, 0x07, 0x09, 0x01, 0x08, 0x00, 0x0e, 0x14, 0x0c, 0x0a, 0x11, 0x90,
+    0x19, 0x02, 0x17, 0x03, 0x02, 0x15, 0x00, 0x01, 0x16, 0x04, 0x02, 0x07,
+    0x04, 0x09, 0x0f, 0x11, 0x0a, 0x06, 0x0e, 0x04, 0x02, 0x0b, 0x1f, 0x33,
+    0x0e, 0x0d, 0x04, 0x0a, 0x12, 0x09, 0x12, 0x0c, 0x13, 0x0b, 0x11, 0x0c,
+    0x10, 0x08, 0xe0, 0x0d, 0x02, 0x0b, 0x10, 0x0f, 0x0a, 0x03, 0x09, 0x02,
+    0x07, 0x00, 0x06, 0x02, 0x17, 0x04, 0x02, 0x06, 0x11, 0x08, 0x09, 0x02,
+    0x1c, 0x03, 0x01, 0x09, 0x00, 0x51, 0x07, 0x14, 0x29, 0x02, 0x0d, 0x0a,
+    0x0f, 0x18, 0x06, 0x90, 0x0c, 0x07, 0x0f, 0x06, 0x03, 0x04, 0x01, 0x03,
+    0x10, 0x02, 0x03, 0x02, 0x04, 0x10, 0x05, 0x04, 0x05, 0x01, 0x15, 0x0d,
+    0x02, 0x03, 0x04, 0x06, 0x0a, 0x07, 0x17, 0x0f, 0x0f, 0x05, 0x0c, 0x16,
+    0x07, 0x0b, 0x0f, 0x0d, 0x05, 0x07, 0x07, 0x04, 0x04, 0x05, 0x03, 0x11,
+    0x04, 0x22, 0x02, 0x07, 0x01, 0x04, 0x30, 0x41, 0x00, 0x04, 0x0b, 0x01,
+    0x01, 0x03, 0x80, 0x22, 0x06, 0x12, 0x03, 0x03, 0x04, 0x11, 0x05, 0x06,
+    0x10, 0x07, 0x08, 0x05, 0x01, 0x09, 0x06, 0x02, 0x08, 0x01, 0x03, 0x09,
+    0x04, 0x06, 0x08, 0x0f, 0x0a, 0x07, 0x04, 0x08, 0x06, 0x05, 0x07, 0x15,
+    0x08, 0x05, 0x02, 0x14, 0x24, 0x01, 0x02, 0x13, 0x21, 0x03, 0x04, 0x52,
+    0x03, 0x00, 0x02, 0x03, 0x23, 0x05, 0x00, 0x01, 0x15, 0x11, 0x07, 0x13,
+    0x0a, 0xf0, 0x0c, 0x05, 0x0d, 0x12, 0x09, 0x0c, 0x04, 0x1e, 0x23, 0x0f,
+    0x1c, 0x00, 0x03, 0x0b, 0x0d, 0x0a, 0x02, 0x07, 0x01, 0x09, 0x05, 0x0c,
+    0x13, 0x0b, 0x0a, 0xf0, 0x07, 0x09, 0x03, 0x08, 0x04, 0x07, 0x0a, 0x05,
+    0x07, 0x44, 0x19, 0x01, 0x02, 0x0a, 0x03, 0x02, 0x02, 0x00, 0x03, 0x03,
+    0x14, 0x14, 0x06, 0x0d, 0x09, 0x10, 0x05, 0x0c, 0x06, 0x09, 0xd1, 0x0f,
+    0x0f, 0x0c, 0x1e, 0x0a, 0x0b, 0x1d, 0x11, 0x0f, 0x09, 0x0e, 0x03, 0x18,
+    0x00, 0x01, 0x07, 0x02, 0x05, 0x01, 0x06, 0x02, 0x08, 0x10, 0x0f, 0xc0,
+    0x0c, 0x11, 0x0e, 0x0b, 0x02, 0x1a, 0x03, 0x10, 0x09, 0x0b, 0x07, 0x0c,
+    0x05, 0x19, 0x02, 0x03, 0x0a, 0x16, 0x0e, 0x18, 0x11, 0x0f, 0x08, 0x0c,
+    0xb0, 0x05, 0x08, 0x0c, 0x05, 0x1b, 0x03, 0x02, 0x0a, 0x01, 0x02, 0x10,
+    0x00, 0x12, 0x02, 0x03, 0x10, 0x04, 0x17, 0x02, 0x01, 0x04, 0x08, 0x02,
+    0x1c, 0x19, 0x03, 0x04, 0x06, 0x1a, 0x05, 0x0f, 0x06, 0x0d, 0x07, 0x07,
+    0x1f, 0x05, 0x18, 0x04, 0x04, 0x02, 0x19, 0x00, 0x21, 0x02, 0x07, 0x03,
+    0x05, 0x01, 0x40, 0x06, 0x00, 0x04, 0x01, 0x23, 0x03, 0x04, 0x02, 0x01,
+    0x02, 0x21, 0x00, 0x03, 0x01, 0xa2, 0x30, 0x02, 0x04, 0x03, 0x00, 0x01,
+    0x01, 0x03, 0x09, 0x04, 0x0d, 0x05, 0x16, 0x07, 0x0c, 0x0f, 0x0e, 0x13,
+    0x0d, 0x0b, 0x07, 0x0e, 0x22, 0x13, 0x0b, 0x08, 0x11, 0x0b, 0x21, 0x19,
+    0x12, 0x0f, 0xf0, 0x00, 0x0a, 0x01, 0x07, 0x15, 0x08, 0x07, 0x03, 0x05,
+    0x01, 0x06, 0x03, 0x18, 0x04, 0x03, 0x07, 0x02, 0x18, 0x03, 0x12, 0x07,
+    0x09, 0x05, 0x0d, 0x06, 0x0b, 0x02, 0x09, 0xf0, 0x01, 0x08, 0x05, 0x09,
+    0x08, 0x0b, 0x03, 0x0e, 0x01, 0x0b, 0x04, 0x19, 0x07, 0x05, 0x0a, 0x06,
+    0x09, 0x0d, 0x08, 0x06, 0x17, 0x04, 0x0b, 0x06, 0x0d, 0x05, 0x04, 0x03,
+    0x01, 0x32, 0x80, 0x02, 0x05, 0x03, 0x00, 0x03, 0x01, 0x04, 0x24, 0x06,
+    0x08, 0x0b, 0x08, 0x07, 0x81, 0x06, 0x08, 0x03, 0x0b, 0x07, 0x1f, 0x0f,
+    0x05, 0x0d, 0x01, 0x09, 0x02, 0x08, 0x0a, 0x06, 0x0e, 0x0b, 0xf0, 0x03,
+    0x09, 0x02, 0x28, 0x04, 0x03, 0x12, 0x17, 0x01, 0x08, 0x00, 0x06, 0x01,
+    0x08, 0x05, 0x09, 0x04, 0x0a, 0x11, 0x08, 0x09, 0x06, 0x1c, 0x0f, 0x05,
+    0x0a, 0xf0, 0x03, 0x0c, 0x07, 0x0b, 0x0d, 0x09, 0x08, 0x07, 0x0a, 0x06,
+    0x09, 0x05, 0x03, 0x04, 0x02, 0x03, 0x18, 0x02, 0x01, 0x02, 0x10, 0x00,
+    0x01, 0x01, 0x02, 0x03, 0x10, 0x06, 0x05, 0x11, 0x02, 0x09, 0x07, 0x18,
+    0x02, 0x08, 0x03, 0x0e, 0x0c, 0x04, 0x0f, 0x0e, 0x06, 0x09, 0x08, 0x08,
+    0x04, 0x06, 0x0b, 0x0a, 0x05, 0x2e, 0x0f, 0x04, 0x02, 0x03, 0x00, 0x02,
+    0x0d, 0x01, 0x11, 0x0c, 0x02, 0x0b, 0x01, 0x20, 0x0e, 0x10, 0x09, 0x08,
+    0x21, 0x11, 0x05, 0x13, 0x60, 0x12, 0x02, 0x31, 0x00, 0x01, 0x09, 0x03,
+    0x72, 0x01, 0x01, 0x03, 0x02, 0x0c, 0x04, 0x0e, 0x06, 0x0c, 0x08, 0x08,
+    0x09, 0x0f, 0x0b, 0x0e, 0x0f, 0x31, 0x16, 0x0b, 0x0a, 0x04, 0x09, 0x11,
+    0x0f, 0xf0, 0x0d, 0x07, 0x0b, 0x04, 0x09, 0x12, 0x08, 0x19, 0x05, 0x03,
+    0x0b, 0x01, 0x1e, 0x30, 0x0d, 0x0f, 0x0b, 0x01, 0x0f, 0x02, 0x0e, 0x11,
+    0x0f, 0x0e, 0xf0, 0x08, 0x0d, 0x09, 0x2c, 0x03, 0x02, 0x04, 0x0d, 0x05,
+    0x0b, 0x24, 0x0d, 0x1b, 0x07, 0x0c, 0x06, 0x0d, 0x0a, 0x0e, 0x0b, 0x0d,
+    0x07, 0x0c, 0x02, 0x0a, 0x14, 0x08, 0xe0, 0x07, 0x01, 0x04, 0x50, 0x03,
+    0x04, 0x17, 0x19, 0x12, 0x08, 0x0d, 0x04, 0x1e, 0x05, 0x07, 0x0d, 0x04,
+    0x0e, 0x06, 0x08, 0x11, 0x0f, 0x09, 0x07, 0x0f, 0xf0, 0x14, 0x0b, 0x0e,
+    0x08, 0x1c, 0x06, 0x09, 0x0a, 0x04, 0x09, 0x03, 0x1a, 0x12, 0x07, 0x31,
+    0x09, 0x08, 0x06, 0x19, 0x05, 0x04, 0x1b, 0x03, 0xf0, 0x04, 0x09, 0x17,
+    0x1b, 0x0e, 0x09, 0x06, 0x17, 0x04, 0x07, 0x06, 0x09, 0x04, 0x07, 0x13,
+    0x05, 0x14, 0x02, 0x41, 0x09, 0x04, 0x01, 0x20, 0x10, 0x12, 0x21, 0x11,
+    0x04, 0x09, 0x02, 0x17, 0x02, 0x07, 0x03, 0x0c, 0x08, 0x04, 0x1f, 0x0e,
+    0x25, 0x0f, 0x09, 0x0c, 0x06, 0x0d, 0x04, 0x0f, 0x0e, 0x13, 0x0b, 0x08,
+    0x04, 0x0a, 0x12, 0x03, 0x07, 0x12, 0x09, 0x11, 0x07, 0x03, 0x0a, 0xc0,
+    0x02, 0x09, 0x70, 0x18, 0x06, 0x05, 0x03, 0x11, 0x03, 0x11, 0x05, 0x07,
+    0x12, 0x0a, 0x08, 0x01, 0x04, 0x06, 0x22, 0x0a, 0x08, 0x0f, 0x0b, 0x18,
+    0x0f, 0x31, 0x0b, 0x1b, 0x09, 0x08, 0x08, 0x1f, 0xf0, 0x03, 0x02, 0x0c,
+    0x03, 0x0e, 0x06, 0x0c, 0x14, 0x1b, 0x03, 0x09, 0x12, 0x0c, 0x0d, 0x01,
+    0x0c, 0x20, 0x07, 0x04, 0x16, 0x01, 0x03, 0x27, 0x12, 0xc0, 0x05, 0x09,
+    0x0f, 0x2a, 0x0a, 0x08, 0x05, 0x08, 0x03, 0x19, 0x17, 0x0a, 0x06, 0x0b,
+    0x05, 0x1e, 0x16, 0x09, 0x91, 0x0f, 0x0b, 0x06, 0x08, 0x22, 0x06, 0x05,
+    0x14, 0x11, 0x12, 0x10, 0x01, 0x02, 0x33, 0xf0, 0x43, 0x04, 0x06, 0x09,
+    0x07, 0x07, 0x08, 0x03, 0x0a, 0x05, 0x1d, 0x09, 0x1f, 0x1f, 0x06, 0x2e,
+    0x03, 0x08, 0x09, 0x0c, 0xf0, 0x05, 0x0b, 0x04, 0x19, 0x02, 0x01, 0x0d,
+    0x13, 0x0e, 0x0a, 0x01, 0x17, 0x02, 0x03, 0x38, 0x06, 0x0d, 0x07, 0x03,
+    0x09, 0x07, 0x0a, 0x0d, 0x0b, 0x05, 0x0c, 0xd0, 0x04, 0x0b, 0x02, 0x1a,
+    0x01, 0x03, 0x08, 0x04, 0x06, 0x11, 0x14, 0x12, 0x12, 0x05, 0x11, 0x02,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x11, 0x01, 0x14, 0x03, 0x02, 0x14,
+    0x05, 0x03, 0x08, 0x04, 0x09, 0x0c, 0x06, 0x0f, 0x0f, 0x09, 0x16, 0x0e,
+    0x08, 0x0d, 0x07, 0x04, 0x0e, 0x16, 0x03, 0x1b, 0x07, 0x05, 0x04, 0x0a,
+    0x24, 0x00, 0x07, 0x01, 0x25, 0x04, 0x03, 0x12, 0x42, 0x03, 0x01, 0x02,
+    0x10, 0x21, 0x01, 0x31, 0x30, 0x30, 0x02, 0x04, 0x01, 0xf1, 0x08, 0x02,
+    0x12, 0x03, 0x05, 0x0c, 0x06, 0x0b, 0x07, 0x0c, 0x19, 0x0a, 0x05, 0x0a,
+    0x07, 0x0b, 0x0f, 0x0e, 0x05, 0x0b, 0x13, 0x0a, 0x0c, 0x01, 0x0e, 0x03,
+    0x0d, 0x08, 0x08, 0xf1, 0x02, 0x06, 0x01, 0x04, 0x05, 0x23, 0x03, 0x12,
+    0x12, 0x10, 0x03, 0x02, 0x05, 0x01, 0x06, 0x00, 0x0a, 0x02, 0x0d, 0x01,
+    0x2f, 0x03, 0x0f, 0x05, 0x0b, 0xf1, 0x01, 0x0c, 0x14, 0x0b, 0x0a, 0x03,
+    0x1e, 0x05, 0x12, 0x0b, 0x0d, 0x0f, 0x09, 0x0a, 0x05, 0x03, 0x04, 0x06,
+    0x03, 0x02, 0x22, 0x01, 0x05, 0x03, 0x01, 0x00, 0x00, 0x22, 0x01, 0x11,
+    0x02, 0x03, 0x80, 0x03, 0x06, 0x14, 0x02, 0x01, 0x05, 0x08, 0x06, 0x06,
+    0x08, 0x02, 0x0a, 0x06, 0x0b, 0x05, 0x0c, 0x03, 0x01, 0x19, 0x0d, 0x02,
+    0x0f, 0x01, 0x0a, 0x04, 0xf0, 0x1c, 0x16, 0x1a, 0x03, 0x06, 0x0b, 0x02,
+    0x0c, 0x00, 0x0e, 0x04, 0x3f, 0x05, 0x01, 0x03, 0x04, 0x1a, 0x02, 0x0a,
+    0x0c, 0x0f, 0x0d, 0x03, 0x0e, 0x05, 0xb0, 0x0c, 0x07, 0x09, 0x04, 0x18,
+    0x0a, 0x04, 0x17, 0x00, 0x02, 0x18, 0x03, 0x00, 0x06, 0x11, 0x05, 0x04,
+    0x00, 0x22, 0x01, 0x11, 0x02, 0x30, 0x10, 0x03, 0x04, 0x11, 0x23, 0x12,
+    0x03, 0x04, 0x04, 0x00, 0x06, 0x05, 0x03, 0x0b, 0x36, 0x0f, 0x0f, 0x06,
+    0x1e, 0x0c, 0x0f, 0x0f, 0x05, 0x04, 0x0c, 0x14, 0x07, 0x0a, 0x0f, 0x1b,
+    0x03, 0x24, 0x12, 0x08, 0x0a, 0x01, 0x02, 0x0d, 0xf0, 0x06, 0x07, 0x05,
+    0x05, 0x10, 0x04, 0x05, 0x02, 0x03, 0x00, 0x02, 0x01, 0x21, 0x02, 0x00,
+    0x01, 0x22, 0x05, 0x04, 0x05, 0x03, 0x09, 0x04, 0x04, 0x06, 0x0a, 0x09,
+    0x20, 0x0f, 0x0e, 0x03, 0x0f, 0x05, 0x09, 0x71, 0x0f, 0x0d, 0x15, 0x0c,
+    0x0e, 0x0a, 0x0a, 0x13, 0x08, 0x07, 0x05, 0x08, 0x12, 0x0f, 0xf0, 0x0e,
+    0x03, 0x2b, 0x01, 0x02, 0x03, 0x0a, 0x10, 0x08, 0x09, 0x01, 0x0f, 0x00,
+    0x0e, 0x01, 0x0a, 0x03, 0x2e, 0x02, 0x03, 0x0a, 0x0c, 0x07, 0x0b, 0x08,
+    0x0c, 0xf0, 0x0f, 0x2b, 0x05, 0x06, 0x0c, 0x0d, 0x13, 0x0e, 0x0c, 0x06,
+    0x0b, 0x03, 0x08, 0x02, 0x0c, 0x03, 0x0f, 0x01, 0x0e, 0x00, 0x0f, 0x01,
+    0x0c, 0x10, 0x0a, 0x08, 0x01, 0x17, 0xf0, 0x10, 0x0c, 0x02, 0x0d, 0x11,
+    0x18, 0x03, 0x0e, 0x12, 0x0b, 0x19, 0x06, 0x05, 0x0a, 0x04, 0x0e, 0x1e,
+    0x0d, 0x1a, 0x0b, 0x0d, 0x09, 0x15, 0x17, 0xf0, 0x08, 0x08, 0x03, 0x27,
+    0x02, 0x06, 0x04, 0x06, 0x02, 0x08, 0x15, 0x0b, 0x1a, 0x04, 0x08, 0x0d,
+    0x07, 0x1c, 0x06, 0x0c, 0x0b, 0x05, 0x1a, 0x04, 0xf0, 0x07, 0x09, 0x03,
+    0x07, 0x01, 0x18, 0x03, 0x01, 0x09, 0x00, 0x15, 0x11, 0x34, 0x00, 0x11,
+    0x00, 0x36, 0x01, 0x10, 0x02, 0x07, 0x10, 0x01, 0x29, 0x00, 0x01, 0x04,
+    0x12, 0x07, 0x0b, 0x04, 0x09, 0x03, 0x0c, 0x0b, 0x04, 0x0f, 0x0c, 0x35,
+    0x07, 0x0b, 0x1f, 0x0a, 0x17, 0x06, 0x04, 0x0a, 0x18, 0x03, 0x05, 0x02,
+    0x02, 0x0c, 0x11, 0x04, 0x09, 0x02, 0x0a, 0xf0, 0x00, 0x26, 0x12, 0x00,
+    0x05, 0x31, 0x13, 0x01, 0x12, 0x02, 0x01, 0x03, 0x12, 0x04, 0x05, 0x01,
+    0x16, 0x06, 0x07, 0x07, 0x02, 0x08, 0xf0, 0x06, 0x0a, 0x0f, 0x0f, 0x06,
+    0x0e, 0x07, 0x0f, 0x0f, 0x0e, 0x07, 0x2d, 0x15, 0x03, 0x0e, 0x05, 0x0a,
+    0x04, 0x1b, 0x02, 0x04, 0x0d, 0x05, 0x09, 0x11, 0x07, 0x0a, 0xf0, 0x03,
+    0x0c, 0x11, 0x0d, 0x0b, 0x23, 0x09, 0x28, 0x15, 0x0a, 0x09, 0x2b, 0x0c,
+    0x05, 0x07, 0x1e, 0x0f, 0x03, 0x0a, 0x01, 0x0e, 0x04, 0x1a, 0xf0, 0x02,
+    0x01, 0x09, 0x12, 0x1d, 0x11, 0x1b, 0x00, 0x0e, 0x01, 0x09, 0x02, 0x07,
+    0x10, 0x09, 0x0e, 0x03, 0x0a, 0x01, 0x09, 0x00, 0x0b, 0x13, 0x0e, 0x0d,
+    0xf0, 0x02, 0x0c, 0x04, 0x1d, 0x05, 0x04, 0x0e, 0x06, 0x0d, 0x05, 0x0b,
+    0x06, 0x0e, 0x0a, 0x0c, 0x04, 0x0a, 0x03, 0x0e, 0x0a, 0x0b, 0x06, 0x09,
+    0x02, 0x08, 0x14, 0x27, 0x12, 0xf0, 0x08, 0x04, 0x09, 0x05, 0x0a, 0x06,
+    0x0c, 0x05, 0x0b, 0x06, 0x1f, 0x0f, 0x07, 0x1b, 0x04, 0x08, 0x0c, 0x06,
+    0x0e, 0x11, 0x1c, 0x02, 0x08, 0x01, 0x06, 0x50, 0x05, 0xb0, 0x08, 0x0b,
+    0x09, 0x06, 0x17, 0x02, 0x01, 0x05, 0x00, 0x04, 0x01, 0x05, 0x02, 0x08,
+    0x10, 0x0c, 0x09, 0x01, 0x22, 0x08, 0x12, 0x0f, 0x1b, 0x03, 0x05, 0x04,
+    0x1f, 0x1d, 0x45, 0x07, 0x0e, 0x05, 0x1f, 0x0f, 0x07, 0x0c, 0x04, 0x11,
+    0x0d, 0x03, 0x0e, 0x42, 0x02, 0x0d, 0x10, 0x09, 0x05, 0x11, 0x06, 0x07,
+    0x01, 0x10, 0x0a, 0xf0, 0x07, 0x11, 0x06, 0x04, 0x10, 0x03, 0x02, 0x02,
+    0x13, 0x03, 0x10, 0x05, 0x06, 0x13, 0x07, 0x08, 0x02, 0x0b, 0x06, 0x2a,
+    0x09, 0x06, 0x04, 0x1b, 0xf0, 0x08, 0x0e, 0x0c, 0x06, 0x0a, 0x03, 0x09,
+    0x07, 0x0c, 0x0f, 0x0f, 0x04, 0x0a, 0x02, 0x0b, 0x05, 0x0a, 0x04, 0x19,
+    0x01, 0x02, 0x0b, 0x04, 0x09, 0x03, 0x1a, 0x02, 0x03, 0x2c, 0xf0, 0x06,
+    0x05, 0x02, 0x1b, 0x04, 0x0f, 0x0f, 0x06, 0x0a, 0x03, 0x09, 0x06, 0x1c,
+    0x05, 0x01, 0x0b, 0x02, 0x19, 0x03, 0x02, 0x0a, 0x11, 0x0d, 0x0b, 0x13,
+    0x39, 0xf0, 0x10, 0x03, 0x08, 0x02, 0x06, 0x00, 0x37, 0x02, 0x03, 0x01,
+    0x02, 0x19, 0x05, 0x16, 0x0a, 0x09, 0x04, 0x0a, 0x06, 0x0e, 0x0a, 0x0d,
+    0xf0, 0x02, 0x0f, 0x01, 0x0e, 0x16, 0x0c, 0x0a, 0x02, 0x0b, 0x06, 0x0a,
+    0x0b, 0x09, 0x04, 0x08, 0x03, 0x29, 0x04, 0x03, 0x02, 0x08, 0x01, 0x07,
+    0x02, 0x1d, 0x0a, 0x05, 0x0c, 0x10, 0x03, 0x0e, 0x0c, 0x08, 0x81, 0x0f,
+    0x0a, 0x04, 0x18, 0x06, 0x0a, 0x16, 0x03, 0x22, 0x24, 0x01, 0x08, 0x90,
+    0x10, 0x07, 0x08, 0x03, 0x07, 0x02, 0x25, 0x00, 0x01, 0x03, 0x03, 0x10,
+    0x14, 0x01, 0x03, 0x11, 0x20, 0x04, 0x03, 0x32, 0x06, 0x01, 0x0a, 0x12,
+    0x0f, 0x0a, 0x03, 0x03, 0x08, 0x04, 0x1f, 0x0c, 0x05, 0x0b, 0x46, 0x06,
+    0x09, 0x0a, 0x08, 0x0f, 0x07, 0x04, 0x06, 0x02, 0x07, 0x05, 0x03, 0x16,
+    0x04, 0x02, 0x03, 0x11, 0x07, 0x02, 0x09, 0x21, 0x13, 0x07, 0x06, 0x01,
+    0x09, 0xf0, 0x00, 0x17, 0x11, 0x04, 0x10, 0x23, 0x01, 0x10, 0x15, 0x01,
+    0x17, 0x22, 0x08, 0x09, 0x05, 0x1a, 0x07, 0x04, 0x09, 0x03, 0x08, 0xf0,
+    0x07, 0x0a, 0x0e, 0x0b, 0x16, 0x0c, 0x1e, 0x0a, 0x09, 0x0c, 0x14, 0x2b,
+    0x03, 0x02, 0x08, 0x01, 0x07, 0x02, 0x0a, 0x05, 0x0b, 0x04, 0x0a, 0x03,
+    0x0b, 0x06, 0x1d, 0xf0, 0x0d, 0x06, 0x0c, 0x15, 0x0b, 0x0a, 0x06, 0x19,
+    0x13, 0x0a, 0x04, 0x18, 0x03, 0x01, 0x0a, 0x02, 0x09, 0x04, 0x1a, 0x02,
+    0x01, 0x0b, 0x02, 0x08, 0x04, 0x07, 0xf0, 0x02, 0x08, 0x11, 0x07, 0x06,
+    0x02, 0x57, 0x11, 0x13, 0x02, 0x04, 0x08, 0x0e, 0x09, 0x07, 0x1a, 0x15,
+    0x09, 0x09, 0x08, 0x06, 0x27, 0xf0, 0x03, 0x02, 0x13, 0x09, 0x08, 0x02,
+    0x09, 0x05, 0x0b, 0x06, 0x1a, 0x03, 0x02, 0x0d, 0x04, 0x2b, 0x02, 0x11,
+    0x0e, 0x04, 0x0d, 0x08, 0x1c, 0x17, 0x10, 0x0e, 0x1f, 0x19, 0x21, 0x05,
+    0x07, 0x07, 0x04, 0x32, 0x0a, 0x03, 0x04, 0x12, 0x02, 0x05, 0x21, 0x83,
+    0x04, 0x02, 0x03, 0xa0, 0x05, 0x07, 0x03, 0x11, 0x02, 0x12, 0x10, 0x13,
+    0x02, 0x01, 0x24, 0x00, 0x01, 0x02, 0x12, 0x04, 0x25, 0x13, 0x03, 0x04,
+    0x05, 0x06, 0x54, 0x0f, 0x08, 0x0a, 0x19, 0x06, 0x08, 0x0a, 0x0f, 0x09,
+    0x04, 0x0d, 0x23, 0x03, 0x0a, 0x05, 0x18, 0x04, 0x02, 0x02, 0x0b, 0x21,
+    0x03, 0x09, 0x04, 0x08, 0x02, 0x0c, 0xf0, 0x01, 0x17, 0x00, 0x11, 0x05,
+    0x04, 0x10, 0x13, 0x01, 0x04, 0x10, 0x16, 0x01, 0x0b, 0x02, 0x0a, 0x01,
+    0x0d, 0x02, 0x0b, 0x05, 0x0a, 0x04, 0x09, 0x13, 0x08, 0xf0, 0x1a, 0x08,
+    0x0e, 0x0b, 0x17, 0x2a, 0x0f, 0x0d, 0x09, 0x04, 0x18, 0x03, 0x02, 0x19,
+    0x11, 0x28, 0x03, 0x05, 0x14, 0x09, 0x0e, 0xf0, 0x09, 0x1f, 0x0f, 0x07,
+    0x1b, 0x24, 0x0c, 0x0e, 0x12, 0x0b, 0x09, 0x13, 0x18, 0x12, 0x09, 0x0d,
+    0x04, 0x09, 0x02, 0x0d, 0x11, 0x0b, 0x0f, 0xf0, 0x03, 0x0d, 0x01, 0x0b,
+    0x00, 0x0c, 0x01, 0x0a, 0x12, 0x0d, 0x0a, 0x01, 0x0e, 0x02, 0x0c, 0x24,
+    0x0b, 0x1a, 0x09, 0x0b, 0x06, 0x0a, 0x13, 0x08, 0x0b, 0x06, 0x0a, 0xa0,
+    0x03, 0x29, 0x11, 0x02, 0x0a, 0x03, 0x09, 0x12, 0x18, 0x13, 0x0a, 0x09,
+    0x01, 0x0e, 0x12, 0x28, 0xf1, 0x01, 0x02, 0x0a, 0x27, 0x0b, 0x0c, 0x0b,
+    0x0a, 0x1a, 0x0c, 0x0f, 0x0b, 0x08, 0x07, 0x14, 0x05, 0x04, 0x06, 0x03,
+    0x04, 0x02, 0x0b, 0x51, 0x0f, 0x41, 0x16, 0x0c, 0x07, 0x03, 0x40, 0x42,
+    0x01, 0x00, 0x11, 0x00, 0x31, 0x71, 0x01, 0x04, 0x05, 0x08, 0x02, 0x0b,
+    0x04, 0x07, 0x05, 0x06, 0x08, 0x0d, 0x07, 0x62, 0x0f, 0x09, 0x0b, 0x08,
+    0x08, 0x09, 0x05, 0x0b, 0x0d, 0x0a, 0x0f, 0x09, 0x08, 0x0c, 0x51, 0x06,
+    0x09, 0x0e, 0x07, 0x09, 0x26, 0x05, 0x04, 0x01, 0x0d, 0xf0, 0x10, 0x1a,
+    0x01, 0x16, 0x20, 0x04, 0x03, 0x02, 0x32, 0x06, 0x15, 0x07, 0x23, 0x0a,
+    0x09, 0x0a, 0x14, 0x06, 0x04, 0x05, 0xf0, 0x05, 0x06, 0x0c, 0x48, 0x0e,
+    0x0b, 0x16, 0x08, 0x29, 0x03, 0x11, 0x0a, 0x12, 0x09, 0x08, 0x14, 0x19,
+    0x03, 0x0a, 0x04, 0x1e, 0xf0, 0x0a, 0x0b, 0x0c, 0x07, 0x1a, 0x04, 0x03,
+    0x09, 0x06, 0x28, 0x04, 0x12, 0x09, 0x04, 0x08, 0x03, 0x09, 0x04, 0x0b,
+    0x03, 0x0d, 0x11, 0x0a, 0x09, 0x02, 0x08, 0xf0, 0x33, 0x17, 0x06, 0x05,
+    0x07, 0x16, 0x09, 0x04, 0x07, 0x03, 0x39, 0x05, 0x04, 0x05, 0x07, 0x37,
+    0x03, 0x32, 0x09, 0x40, 0x08, 0x01, 0x0a, 0x00, 0x0d, 0x02, 0x0b, 0x03,
+    0x06, 0x01, 0x01, 0x04, 0xc2, 0x20, 0x05, 0x07, 0x06, 0x01, 0x15, 0x03,
+    0x12, 0x16, 0x03, 0x09, 0x07, 0x1b, 0x0f, 0x0c, 0x0a, 0x05, 0x09, 0x08,
+    0x06, 0x03, 0x0f, 0x04, 0x14, 0x05, 0x03, 0x22, 0x02, 0x15, 0x01, 0xb0,
+    0x06, 0x03, 0x05, 0x09, 0x04, 0x0a, 0x03, 0x08, 0x72, 0x07, 0x18, 0x03,
+    0x10, 0x02, 0x11, 0x21, 0x81, 0x12, 0x02, 0x03, 0x03, 0x08, 0x04, 0x07,
+    0x06, 0x14, 0x08, 0x0c, 0x06, 0x09, 0x52, 0x0e, 0x1b, 0x09, 0x12, 0x0a,
+    0x0d, 0x0c, 0x0a, 0x0b, 0x0f, 0x51, 0x17, 0x0d, 0x0c, 0x04, 0x1b, 0x03,
+    0x05, 0x08, 0x04, 0x1c, 0xf0, 0x01, 0x10, 0x0b, 0x0a, 0x01, 0x09, 0x02,
+    0x06, 0x10, 0x04, 0x03, 0x02, 0x05, 0x03, 0x06, 0x02, 0x08, 0x13, 0x09,
+    0x08, 0x02, 0x0b, 0x14, 0x0c, 0x1a, 0x12, 0xf0, 0x09, 0x03, 0x08, 0x06,
+    0x0c, 0x0f, 0x0e, 0x04, 0x0b, 0x01, 0x0e, 0x03, 0x0f, 0x04, 0x0b, 0x12,
+    0x0a, 0x0c, 0x11, 0x0d, 0x09, 0x04, 0x1a, 0x05, 0x03, 0x0c, 0x12, 0x0f,
+    0xf0, 0x0d, 0x04, 0x1e, 0x0f, 0x05, 0x0d, 0x01, 0x0e, 0x03, 0x0b, 0x04,
+    0x0c, 0x03, 0x09, 0x04, 0x1b, 0x03, 0x02, 0x28, 0x06, 0x07, 0x03, 0x27,
+    0x02, 0x11, 0xf0, 0x0b, 0x06, 0x1c, 0x05, 0x02, 0x0a, 0x04, 0x0d, 0x08,
+    0x0b, 0x06, 0x0a, 0x07, 0x1d, 0x04, 0x01, 0x0c, 0x03, 0x0e, 0x05, 0x09,
+    0x02, 0x17, 0x01, 0x10, 0x06, 0x05, 0x90, 0x02, 0x07, 0x03, 0x06, 0x00,
+    0x08, 0x01, 0x09, 0x03, 0x08, 0x02, 0x1a, 0x03, 0x02, 0x0b, 0x00, 0x18,
+    0x01, 0x21, 0x03, 0x1a, 0x22, 0x09, 0x12, 0x1f, 0x01, 0x03, 0x06, 0x1e,
+    0x14, 0x0f, 0x04, 0x0b, 0x03, 0x06, 0x0d, 0x02, 0x0e, 0x0f, 0x21, 0x16,
+    0x0a, 0x07, 0x04, 0x0b, 0xf0, 0x00, 0x08, 0x01, 0x07, 0x04, 0x08, 0x22,
+    0x09, 0x1a, 0x00, 0x0c, 0x02, 0x07, 0x05, 0x05, 0x11, 0x03, 0x22, 0x02,
+    0x01, 0x02, 0x03, 0x03, 0x14, 0x00, 0x60, 0x01, 0x15, 0x09, 0x16, 0x06,
+    0x08, 0x0a, 0x0a, 0x04, 0x0c, 0x05, 0x1a, 0x01, 0x0f, 0x62, 0x03, 0x19,
+    0x02, 0x04, 0x0c, 0x03, 0x09, 0x05, 0x0b, 0x0f, 0x09, 0x12, 0x0c, 0x21,
+    0x08, 0x0b, 0x07, 0x04, 0x0b, 0xf0, 0x02, 0x0c, 0x03, 0x09, 0x10, 0x1a,
+    0x03, 0x0b, 0x01, 0x07, 0x00, 0x08, 0x02, 0x37, 0x01, 0x03, 0x0f, 0x03,
+    0x06, 0x01, 0x08, 0x06, 0x09, 0x03, 0x0b, 0x02, 0x19, 0xf0, 0x04, 0x12,
+    0x38, 0x0e, 0x05, 0x02, 0x19, 0x04, 0x12, 0x08, 0x09, 0x07, 0x0a, 0x02,
+    0x09, 0x00, 0x2a, 0x14, 0x02, 0x0c, 0x04, 0x0e, 0xb0, 0x02, 0x0c, 0x01,
+    0x0e, 0x07, 0x0c, 0x05, 0x3a, 0x02, 0x04, 0x12, 0x09, 0x0a, 0x0d, 0x05,
+    0x0b, 0x01, 0x0e, 0x04, 0x07, 0xc1, 0x05, 0x06, 0x02, 0x17, 0x03, 0x01,
+    0x08, 0x00, 0x09, 0x13, 0x0b, 0x0c, 0x02, 0x1b, 0x05, 0x04, 0x0a, 0x03,
+    0x09, 0x0f, 0x08, 0x0a, 0x0d, 0xf0, 0x02, 0x09, 0x13, 0x08, 0x07, 0x11,
+    0x05, 0x14, 0x10, 0x02, 0x02, 0x13, 0x03, 0x01, 0x05, 0x03, 0x06, 0x02,
+    0x09, 0x01, 0x0a, 0x05, 0x0d, 0x06, 0x19, 0x01, 0x20, 0x02, 0x0a, 0x03,
+    0x0e, 0x02, 0x08, 0x31, 0x14, 0x09, 0x0a, 0x02, 0x0f, 0x08, 0x0b, 0x32,
+    0x0f, 0x0e, 0x08, 0x1c, 0x0f, 0x0a, 0x0f, 0x31, 0x03, 0x0d, 0x15, 0x0a,
+    0x08, 0x31, 0x0d, 0xf0, 0x09, 0x0d, 0x1b, 0x12, 0x09, 0x00, 0x0b, 0x02,
+    0x08, 0x04, 0x06, 0x22, 0x15, 0x04, 0x00, 0x15, 0x01, 0x02, 0x06, 0x10,
+    0x08, 0x0b, 0xb0, 0x01, 0x0d, 0x02, 0x0b, 0x04, 0x0d, 0x05, 0x0a, 0x02,
+    0x0b, 0x04, 0x0a, 0x09, 0x1c, 0x06, 0x18, 0x0b, 0x0c, 0x04, 0x0f, 0x07,
+    0x08, 0xa1, 0x0e, 0x0a, 0x04, 0x0c, 0x13, 0x0e, 0x0c, 0x22, 0x0b, 0x0e,
+    0x09, 0x10, 0x18, 0x11, 0x0a, 0x0f, 0xf0, 0x22, 0x0c, 0x0e, 0x09, 0x03,
+    0x0a, 0x06, 0x29, 0x03, 0x22, 0x0b, 0x09, 0x13, 0x0a, 0x0c, 0x11, 0x0e,
+    0x0d, 0x13, 0x0b, 0x09, 0x14, 0x08, 0xf0, 0x17, 0x12, 0x0a, 0x05, 0x29,
+    0x03, 0x02, 0x03, 0x08, 0x02, 0x0a, 0x03, 0x0c, 0x05, 0x09, 0x03, 0x18,
+    0x02, 0x33, 0x09, 0x08, 0x0b, 0x0a, 0xf0, 0x01, 0x0f, 0x02, 0x0d, 0x06,
+    0x0b, 0x05, 0x0c, 0x03, 0x0d, 0x04, 0x1e, 0x03, 0x04, 0x1c, 0x06, 0x04,
+    0x1a, 0x02, 0x03, 0x1c, 0x04, 0x06, 0x0e, 0x0a, 0x0d, 0x15, 0x0c, 0x10,
+    0x0f, 0x0f, 0x19, 0x11, 0x0c, 0x04, 0x0e, 0xf0, 0x03, 0x0c, 0x01, 0x09,
+    0x50, 0x17, 0x04, 0x02, 0x03, 0x05, 0x01, 0x06, 0x03, 0x07, 0x11, 0x0a,
+    0x0b, 0x04, 0x0e, 0x06, 0x0c, 0x33, 0x0a, 0x29, 0x50, 0x05, 0x0c, 0x06,
+    0x0e, 0x05, 0x0f, 0x06, 0x09, 0x11, 0x09, 0x0c, 0x0b, 0x09, 0x52, 0x0f,
+    0x0e, 0x05, 0x0c, 0x02, 0x0b, 0x03, 0x0a, 0x04, 0x08, 0x02, 0x0c, 0x51,
+    0x11, 0x0b, 0x08, 0x00, 0x0a, 0x51, 0x08, 0x09, 0x0c, 0xf0, 0x09, 0x0b,
+    0x1e, 0x02, 0x01, 0x0b, 0x10, 0x07, 0x0a, 0x11, 0x09, 0x08, 0x00, 0x0e,
+    0x11, 0x19, 0x02, 0x0a, 0x13, 0x09, 0x08, 0x02, 0x0a, 0xf0, 0x03, 0x09,
+    0x04, 0x0a, 0x08, 0x1b, 0x0b, 0x05, 0x0c, 0x06, 0x0e, 0x0e, 0x1f, 0x0f,
+    0x09, 0x0e, 0x07, 0x0b, 0x15, 0x29, 0x04, 0x03, 0x18, 0x02, 0x11, 0x0d,
+    0xf0, 0x0f, 0x03, 0x0b, 0x05, 0x0a, 0x33, 0x08, 0x07, 0x0a, 0x0b, 0x12,
+    0x0a, 0x09, 0x01, 0x0d, 0x62, 0x09, 0x1c, 0x0b, 0x18, 0xf0, 0x0c, 0x04,
+    0x0a, 0x03, 0x08, 0x12, 0x09, 0x0e, 0x14, 0x0c, 0x09, 0x53, 0x0b, 0x09,
+    0x0a, 0x0e, 0x0d, 0x0a, 0x21, 0x0f, 0x0b, 0x0e, 0xf0, 0x13, 0x0c, 0x1a,
+    0x12, 0x0c, 0x15, 0x0a, 0x0d, 0x24, 0x0e, 0x0b, 0x09, 0x15, 0x1a, 0x06,
+    0x09, 0x24, 0x0a, 0x19, 0x08, 0x0b, 0xf0, 0x0c, 0x1c, 0x07, 0x06, 0x0d,
+    0x1b, 0x0e, 0x0d, 0x04, 0x0b, 0x02, 0x09, 0x60, 0x0b, 0x08, 0x06, 0x05,
+    0x14, 0x05, 0x01, 0x17, 0x03, 0xf0, 0x12, 0x18, 0x03, 0x19, 0x05, 0x23,
+    0x0d, 0x0b, 0x09, 0x04, 0x0a, 0x05, 0x1c, 0x08, 0x0a, 0x0e, 0x0b, 0x1d,
+    0x19, 0x1f, 0x0f, 0x09, 0x0e, 0xf0, 0x05, 0x0d, 0x06, 0x1a, 0x09, 0x06,
+    0x09, 0x05, 0x08, 0x24, 0x07, 0x16, 0x13, 0x17, 0x02, 0x38, 0x11, 0x02,
+    0x01, 0x09, 0x10, 0x0a, 0xf0, 0x0b, 0x61, 0x18, 0x09, 0x18, 0x1d, 0x02,
+    0x0b, 0x23, 0x0a, 0x09, 0x1a, 0x07, 0x09, 0x09, 0x07, 0x0a, 0x0a, 0x0b,
+    0xf0, 0x0e, 0x0d, 0x1f, 0x0f, 0x0e, 0x08, 0x1d, 0x06, 0x05, 0x1e, 0x13,
+    0x0d, 0x04, 0x19, 0x12, 0x08, 0x13, 0x1a, 0x62, 0x09, 0x18, 0xf0, 0x09,
+    0x0a, 0x08, 0x09, 0x03, 0x17, 0x12, 0x0a, 0x03, 0x0d, 0x02, 0x0a, 0x01,
+    0x0c, 0x03, 0x08, 0x04, 0x17, 0x23, 0x08, 0x0b, 0x04, 0x0a, 0xf0, 0x05,
+    0x0d, 0x14, 0x1b, 0x05, 0x0a, 0x03, 0x09, 0x02, 0x0a, 0x03, 0x0b, 0x02,
+    0x08, 0x01, 0x07, 0x02, 0x08, 0x33, 0x09, 0x18, 0x19, 0x04, 0x05, 0x1a,
+    0xf0, 0x14, 0x0b, 0x05, 0x0c, 0x04, 0x0a, 0x03, 0x0d, 0x06, 0x0b, 0x07,
+    0x19, 0x04, 0x05, 0x0c, 0x08, 0x1b, 0x09, 0x06, 0x0a, 0x25, 0x0b, 0x0c,
+    0x0b, 0x03, 0x28, 0xf0, 0x12, 0x01, 0x06, 0x40, 0x08, 0x0b, 0x0c, 0x06,
+    0x17, 0x01, 0x02, 0x08, 0x11, 0x0b, 0x0a, 0x02, 0x0c, 0x23, 0x0a, 0x08,
+    0x0a, 0xf0, 0x15, 0x0b, 0x0a, 0x06, 0x09, 0x09, 0x0a, 0x0f, 0x0b, 0x09,
+    0x1a, 0x06, 0x08, 0x0b, 0x0f, 0x3a, 0x08, 0x05, 0x08, 0x09, 0x09, 0x06,
+    0x0a, 0x05, 0x1b, 0x06, 0xf0, 0x04, 0x0c, 0x13, 0x0a, 0x09, 0x04, 0x08,
+    0x02, 0x09, 0x10, 0x0a, 0x0e, 0x11, 0x0c, 0x17, 0x40, 0x0b, 0x0f, 0x0c,
+    0x0b, 0x31, 0x08, 0x0a, 0xf0, 0x09, 0x1e, 0x03, 0x05, 0x0a, 0x03, 0x18,
+    0x04, 0x0b, 0x19, 0x0e, 0x05, 0x0a, 0x07, 0x0c, 0x1f, 0x0d, 0x2e, 0x0e,
+    0x0c, 0x0d, 0x0d, 0x07, 0x0b, 0xf0, 0x05, 0x1a, 0x06, 0x07, 0x08, 0x02,
+    0x17, 0x01, 0x13, 0x36, 0x11, 0x32, 0x07, 0x09, 0x28, 0x03, 0x02, 0x09,
+    0x01, 0x0d, 0xf0, 0x02, 0x0c, 0x04, 0x0b, 0x02, 0x0a, 0x01, 0x09, 0x03,
+    0x1a, 0x05, 0x03, 0x48, 0x02, 0x05, 0x07, 0x06, 0x05, 0x09, 0x06, 0x0c,
+    0x04, 0x1e, 0x12, 0x1f, 0xf0, 0x03, 0x02, 0x0d, 0x00, 0x0e, 0x01, 0x0f,
+    0x04, 0x0c, 0x03, 0x1a, 0x01, 0x03, 0x08, 0x06, 0x07, 0x04, 0x08, 0x03,
+    0x09, 0x04, 0x1a, 0x05, 0x13, 0x09, 0x0b, 0x06, 0x0d, 0xf0, 0x07, 0x0c,
+    0x03, 0x1a, 0x04, 0x0e, 0x0b, 0x0a, 0x09, 0x13, 0x08, 0x09, 0x05, 0x0b,
+    0x03, 0x0d, 0x02, 0x0c, 0x13, 0x0a, 0x0e, 0x11, 0x0d, 0x29, 0x12, 0xf0,
+    0x10, 0x08, 0x05, 0x12, 0x06, 0x08, 0x10, 0x19, 0x22, 0x1a, 0x08, 0x03,
+    0x09, 0x06, 0x0a, 0x05, 0x1b, 0x04, 0x08, 0x0c, 0x0f, 0x0f, 0x07, 0x0c,
+    0xf0, 0x03, 0x2f, 0x09, 0x0f, 0x06, 0x0d, 0x04, 0x0b, 0x08, 0x0d, 0x09,
+    0x0c, 0x15, 0x0d, 0x0b, 0x07, 0x0c, 0x06, 0x0b, 0x13, 0x08, 0x19, 0x04,
+    0x02, 0x07, 0x00, 0x15, 0xf0, 0x01, 0x02, 0x06, 0x01, 0x25, 0x00, 0x11,
+    0x08, 0x10, 0x0b, 0x3a, 0x01, 0x02, 0x01, 0x02, 0x09, 0x05, 0x0a, 0x06,
+    0x09, 0x03, 0x08, 0x04, 0x1c, 0x70, 0x0b, 0x07, 0x2b, 0x04, 0x06, 0x0e,
+    0x0d, 0x0b, 0x1c, 0x09, 0x0b, 0x07, 0x11, 0x0f, 0x08, 0x08, 0x0e, 0xf0,
+    0x06, 0x1b, 0x09, 0x06, 0x0a, 0x02, 0x07, 0x01, 0x18, 0x02, 0x01, 0x19,
+    0x10, 0x0b, 0x31, 0x1e, 0x09, 0x0d, 0x03, 0x1a, 0x02, 0x01, 0x09, 0xf0,
+    0x02, 0x0c, 0x03, 0x0b, 0x11, 0x0f, 0x1b, 0x13, 0x1e, 0x12, 0x0d, 0x05,
+    0x0a, 0x07, 0x0b, 0x15, 0x0a, 0x0b, 0x09, 0x0d, 0x06, 0x0b, 0x03, 0x09,
+    0x14, 0x0a, 0xf0, 0x0b, 0x02, 0x0c, 0x01, 0x0d, 0x02, 0x0e, 0x13, 0x0a,
+    0x28, 0x02, 0x03, 0x05, 0x17, 0x03, 0x02, 0x08, 0x14, 0x19, 0x02, 0x0a,
+    0x03, 0x0b, 0x24, 0x0e, 0xf0, 0x0c, 0x0b, 0x05, 0x0c, 0x06, 0x0d, 0x05,
+    0x0b, 0x13, 0x0a, 0x0b, 0x04, 0x0e, 0x03, 0x0b, 0x02, 0x1d, 0x14, 0x2f,
+    0x22, 0x0e, 0x01, 0x0d, 0xf0, 0x50, 0x0f, 0x1a, 0x0b, 0x07, 0x08, 0x21,
+    0x1d, 0x0b, 0x03, 0x1e, 0x06, 0x05, 0x1b, 0x06, 0x09, 0x1c, 0x18, 0x0b,
+    0xf0, 0x07, 0x1e, 0x08, 0x0a, 0x0d, 0x07, 0x1b, 0x06, 0x0b, 0x1c, 0x07,
+    0x04, 0x0b, 0x05, 0x0c, 0x07, 0x0b, 0x04, 0x0a, 0x22, 0x0d, 0x0a, 0x07,
+    0x01, 0x09, 0x40, 0x0c, 0xf0, 0x0b, 0x0f, 0x0c, 0x0a, 0x11, 0x09, 0x08,
+    0x10, 0x0a, 0x0e, 0x01, 0x0f, 0x12, 0x09, 0x18, 0x03, 0x04, 0x19, 0x05,
+    0x04, 0x0d, 0x05, 0x1b, 0xf0, 0x06, 0x05, 0x1d, 0x04, 0x06, 0x0e, 0x08,
+    0x1c, 0x16, 0x2f, 0x0e, 0x0f, 0x0a, 0x1e, 0x09, 0x08, 0x0d, 0x05, 0x0a,
+    0x03, 0x09, 0x02, 0x18, 0x11, 0xf0, 0x06, 0x10, 0x08, 0x0a, 0x21, 0x08,
+    0x16, 0x02, 0x07, 0x03, 0x28, 0x52, 0x0a, 0x1b, 0x0e, 0x03, 0x0a, 0x04,
+    0x09, 0xf0, 0x03, 0x0d, 0x04, 0x0c, 0x08, 0x1b, 0x07, 0x04, 0x0d, 0x05,
+    0x0e, 0x07, 0x1d, 0x04, 0x53, 0x0c, 0x0b, 0x0a, 0x28, 0x04, 0x07, 0x03,
+    0x08, 0xf0, 0x02, 0x09, 0x13, 0x1a, 0x11, 0x0b, 0x0c, 0x23, 0x0a, 0x28,
+    0x24, 0x0a, 0x0e, 0x15, 0x0d, 0x0b, 0x06, 0x29, 0x05, 0x03, 0xf0, 0x14,
+    0x0a, 0x0e, 0x12, 0x0d, 0x0e, 0x14, 0x0f, 0x0d, 0x13, 0x0e, 0x1c, 0x12,
+    0x09, 0x01, 0x1b, 0x40, 0x19, 0x06, 0x0b, 0xf0, 0x21, 0x0d, 0x09, 0x1f,
+    0x03, 0x05, 0x3e, 0x06, 0x07, 0x06, 0x08, 0x1c, 0x0a, 0x08, 0x1b, 0x0b,
+    0x0d, 0x1c, 0x07, 0x08, 0x0b, 0x0e, 0x0c, 0xf0, 0x07, 0x0a, 0x14, 0x0b,
+    0x2a, 0x03, 0x12, 0x08, 0x41, 0x19, 0x0c, 0x08, 0x09, 0x02, 0x28, 0x11,
+    0x02, 0x07, 0x01, 0x09, 0xf0, 0x00, 0x0e, 0x21, 0x08, 0x0a, 0x1f, 0x12,
+    0x0d, 0x03, 0x0a, 0x05, 0x09, 0x14, 0x0a, 0x0c, 0x06, 0x0b, 0x14, 0x0d,
+    0x1b, 0x26, 0x0c, 0x0e, 0xf0, 0x0a, 0x1d, 0x0c, 0x0e, 0x0e, 0x0f, 0x0f,
+    0x09, 0x0d, 0x06, 0x1e, 0x05, 0x02, 0x1f, 0x11, 0x1e, 0x40, 0x09, 0x0c,
+    0x1b, 0x21, 0x08, 0xf0, 0x0a, 0x0d, 0x02, 0x0b, 0x11, 0x1f, 0x22, 0x0c,
+    0x0a, 0x1b, 0x04, 0x15, 0x09, 0x0a, 0x37, 0x0b, 0x0a, 0x09, 0x0a, 0x05,
+    0x09, 0xf0, 0x04, 0x08, 0x05, 0x07, 0x04, 0x06, 0x03, 0x17, 0x04, 0x03,
+    0x09, 0x02, 0x0e, 0x23, 0x0d, 0x0e, 0x0b, 0x04, 0x19, 0x03, 0x32, 0x0a,
+    0x0b, 0x19, 0xf0, 0x23, 0x1c, 0x0b, 0x05, 0x0a, 0x04, 0x0c, 0x03, 0x0b,
+    0x14, 0x09, 0x08, 0x03, 0x29, 0x04, 0x13, 0x08, 0x14, 0x19, 0x03, 0x0a,
+    0x04, 0x0c, 0xf0, 0x03, 0x0e, 0x02, 0x0c, 0x03, 0x19, 0x02, 0x21, 0x08,
+    0x17, 0x00, 0x1c, 0x21, 0x1b, 0x02, 0x0f, 0x13, 0x0d, 0x0b, 0x05, 0x0d,
+    0x06, 0x0b, 0xf0, 0x04, 0x1d, 0x07, 0x08, 0x0b, 0x05, 0x1c, 0x06, 0x07,
+    0x0b, 0x05, 0x1d, 0x09, 0x07, 0x0e, 0x04, 0x0c, 0x05, 0x0b, 0x04, 0x0c,
+    0x12, 0x0a, 0x09, 0x01, 0x0e, 0x00, 0x1c, 0xf0, 0x01, 0x22, 0x0a, 0x08,
+    0x0a, 0x03, 0x08, 0x02, 0x09, 0x13, 0x1b, 0x41, 0x0c, 0x0e, 0x0f, 0x09,
+    0x0c, 0x02, 0x0b, 0x01, 0x0c, 0x02, 0x0b, 0xf0, 0x04, 0x09, 0x23, 0x0b,
+    0x09, 0x0a, 0x02, 0x1d, 0x03, 0x05, 0x0a, 0x03, 0x0e, 0x05, 0x0b, 0x08,
+    0x0e, 0x09, 0x0d, 0x0a, 0x1f, 0x0f, 0x09, 0x0c, 0x07, 0x0d, 0x0a, 0x0c,
+    0xf0, 0x05, 0x0d, 0x03, 0x0c, 0x02, 0x0e, 0x21, 0x0c, 0x0a, 0x0d, 0x10,
+    0x1b, 0x21, 0x08, 0x17, 0x02, 0x09, 0x11, 0x0b, 0x08, 0x22, 0x1d, 0xf0,
+    0x0b, 0x23, 0x0a, 0x0c, 0x1e, 0x06, 0x05, 0x0b, 0x04, 0x3e, 0x06, 0x04,
+    0x03, 0x05, 0x0a, 0x03, 0x0b, 0x01, 0x0e, 0x13, 0x0a, 0x0b, 0x02, 0x0e,
+    0xf0, 0x23, 0x0a, 0x0b, 0x09, 0x04, 0x0b, 0x03, 0x1e, 0x02, 0x03, 0x0b,
+    0x12, 0x0e, 0x0b, 0x14, 0x0a, 0x0c, 0x03, 0x09, 0x04, 0x0c, 0x05, 0x0a,
+    0x04, 0x09, 0x13, 0x0a, 0xf0, 0x08, 0x02, 0x09, 0x13, 0x18, 0x02, 0x09,
+    0x23, 0x0a, 0x0b, 0x48, 0x05, 0x06, 0x23, 0x09, 0x02, 0x08, 0x21, 0x0a,
+    0x09, 0xf0, 0x08, 0x22, 0x07, 0x28, 0x13, 0x09, 0x02, 0x0d, 0x03, 0x0e,
+    0x05, 0x0c, 0x13, 0x1f, 0x35, 0x0d, 0x0c, 0x0b, 0x0c, 0x04, 0x0e, 0xf0,
+    0x05, 0x0c, 0x06, 0x0e, 0x25, 0x0d, 0x0e, 0x0c, 0x23, 0x0b, 0x09, 0x0b,
+    0x02, 0x09, 0x01, 0x0d, 0x22, 0x0b, 0x1c, 0x03, 0x08, 0x12, 0x0b, 0x0c,
+    0xf0, 0x03, 0x09, 0x22, 0x0a, 0x18, 0x11, 0x07, 0x08, 0x22, 0x07, 0x16,
+    0x33, 0x07, 0x19, 0x2c, 0x12, 0x03, 0x0b, 0xf0, 0x04, 0x1a, 0x05, 0x17,
+    0x0b, 0x0c, 0x09, 0x0d, 0x0f, 0x1f, 0x0d, 0x0a, 0x0e, 0x0b, 0x0d, 0x08,
+    0x0c, 0x15, 0x0b, 0x0a, 0x03, 0x08, 0x21, 0x1b, 0x09, 0xf0, 0x30, 0x0e,
+    0x0f, 0x0e, 0x0b, 0x21, 0x0a, 0x19, 0x22, 0x08, 0x1d, 0x14, 0x0c, 0x0a,
+    0x03, 0x09, 0x04, 0x0b, 0x05, 0x0a, 0x04, 0x0c, 0xf0, 0x15, 0x1b, 0x04,
+    0x09, 0x06, 0x18, 0x05, 0x23, 0x09, 0x0a, 0x09, 0x02, 0x0b, 0x13, 0x1e,
+    0x02, 0x0a, 0x43, 0x09, 0x0a, 0x08, 0x09, 0xf0, 0x0a, 0x02, 0x0c, 0x04,
+    0x0b, 0x05, 0x19, 0x04, 0x15, 0x1b, 0x04, 0x2a, 0x15, 0x62, 0x19, 0x0a,
+    0x08, 0x09, 0x0d, 0xf0, 0x09, 0x03, 0x1c, 0x04, 0x03, 0x0b, 0x04, 0x09,
+    0x03, 0x0b, 0x12, 0x09, 0x0b, 0x03, 0x09, 0x11, 0x0a, 0x0d, 0x22, 0x0a,
+    0x09, 0x0a, 0x03, 0x08, 0x02, 0x0a, 0xf0, 0x03, 0x09, 0x04, 0x0a, 0x03,
+    0x19, 0x14, 0x1b, 0x03, 0x04, 0x0a, 0x07, 0x19, 0x14, 0x1a, 0x06, 0x15,
+    0x0b, 0x0e, 0x06, 0x0d, 0x14, 0x1b, 0xf0, 0x05, 0x0e, 0x23, 0x1c, 0x2e,
+    0x12, 0x03, 0x0d, 0x22, 0x0b, 0x09, 0x0d, 0x21, 0x1f, 0x1e, 0x10, 0x1b,
+    0x21, 0xf0, 0x08, 0x29, 0x12, 0x03, 0x48, 0x05, 0x04, 0x03, 0x04, 0x03,
+    0x0b, 0x04, 0x0c, 0x06, 0x1b, 0x15, 0x1d, 0x0c, 0x0a, 0x0e, 0xf0, 0x09,
+    0x2c, 0x0d, 0x07, 0x16, 0x0b, 0x0c, 0x04, 0x0a, 0x12, 0x1b, 0x21, 0x0c,
+    0x0b, 0x0e, 0x10, 0x0f, 0x0c, 0x21, 0x09, 0x0a, 0x09, 0xf0, 0x22, 0x18,
+    0x0d, 0x14, 0x1a, 0x33, 0x0c, 0x0e, 0x0b, 0x0c, 0x05, 0x0a, 0x04, 0x19,
+    0x13, 0x0d, 0x04, 0x2b, 0x33, 0xf0, 0x38, 0x14, 0x33, 0x19, 0x18, 0x04,
+    0x09, 0x03, 0x0a, 0x02, 0x0d, 0x03, 0x0a, 0x44, 0x0c, 0x0e, 0x2f, 0xf0,
+    0x16, 0x0c, 0x0b, 0x05, 0x29, 0x03, 0x42, 0x07, 0x08, 0x07, 0x06, 0x03,
+    0x05, 0x04, 0x26, 0x15, 0x04, 0x07, 0x33, 0x08, 0xf0, 0x29, 0x22, 0x0b,
+    0x08, 0x19, 0x13, 0x08, 0x22, 0x19, 0x0d, 0x33, 0x0b, 0x0a, 0x09, 0x38,
+    0x04, 0xf0, 0x05, 0x06, 0x05, 0x19, 0x14, 0x0c, 0x16, 0x0a, 0x0c, 0x25,
+    0x0b, 0x0a, 0x1c, 0x07, 0x06, 0x0d, 0x04, 0x1e, 0x33, 0x0c, 0x0b, 0xf0,
+    0x0a, 0x02, 0x0d, 0x31, 0x0c, 0x0a, 0x0e, 0x0c, 0x20, 0x0e, 0x19, 0x31,
+    0x07, 0x0c, 0x0e, 0x0f, 0x02, 0x0d, 0x03, 0x0e, 0x04, 0x0d, 0xf0, 0x05,
+    0x0a, 0x13, 0x0d, 0x0b, 0x04, 0x0c, 0x05, 0x0d, 0x14, 0x0e, 0x0c, 0x05,
+    0x0a, 0x07, 0x0b, 0x0c, 0x0a, 0x0b, 0x09, 0x08, 0x58, 0x26, 0x05, 0xf0,
+    0x03, 0x12, 0x09, 0x0b, 0x03, 0x09, 0x02, 0x0a, 0x21, 0x0b, 0x0a, 0x0b,
+    0x32, 0x08, 0x19, 0x08, 0x03, 0x07, 0x04, 0x18, 0x05, 0x03, 0x09, 0xf0,
+    0x12, 0x0a, 0x1e, 0x13, 0x0c, 0x22, 0x0d, 0x0c, 0x0e, 0x23, 0x0b, 0x0e,
+    0x1c, 0x12, 0x1e, 0x03, 0x04, 0x0d, 0x03, 0x0e, 0x02, 0x0d, 0xf0, 0x03,
+    0x18, 0x15, 0x09, 0x23, 0x0a, 0x08, 0x19, 0x04, 0x05, 0x1b, 0x06, 0x14,
+    0x0d, 0x0e, 0x17, 0x0c, 0x0e, 0x05, 0x0b, 0x03, 0x08, 0x22, 0x07, 0xf0,
+    0x09, 0x1b, 0x21, 0x09, 0x0d, 0x02, 0x0a, 0x03, 0x19, 0x04, 0x03, 0x08,
+    0x02, 0x19, 0x03, 0x14, 0x0a, 0x09, 0x12, 0x0a, 0x17, 0x03, 0xf0, 0x04,
+    0x28, 0x03, 0x22, 0x07, 0x09, 0x03, 0x28, 0x04, 0x03, 0x02, 0x09, 0x03,
+    0x0a, 0x05, 0x0b, 0x07, 0x09, 0x05, 0x08, 0x04, 0x27, 0x05, 0x0a, 0xf0,
+    0x09, 0x48, 0x16, 0x08, 0x0c, 0x0e, 0x19, 0x08, 0x04, 0x08, 0x03, 0x1a,
+    0x14, 0x08, 0x02, 0x09, 0x31, 0x07, 0x06, 0x19, 0xf0, 0x20, 0x0a, 0x07,
+    0x19, 0x01, 0x02, 0x0a, 0x03, 0x08, 0x12, 0x09, 0x0d, 0x04, 0x0e, 0x06,
+    0x0d, 0x05, 0x0b, 0x04, 0x08, 0x03, 0x19, 0x04, 0x05, 0x1b, 0x04, 0xf0,
+    0x13, 0x0a, 0x0e, 0x05, 0x1b, 0x17, 0x0c, 0x04, 0x0e, 0x03, 0x0c, 0x04,
+    0x2b, 0x05, 0x04, 0x03, 0x0a, 0x02, 0x0b, 0x03, 0x3a, 0x05, 0x04, 0x12,
+    0xf0, 0x08, 0x23, 0x07, 0x09, 0x0a, 0x02, 0x0b, 0x01, 0x0d, 0x02, 0x29,
+    0x13, 0x02, 0x1a, 0x11, 0x0b, 0x13, 0x08, 0x09, 0x22, 0x18, 0xf0, 0x0b,
+    0x03, 0x1a, 0x14, 0x18, 0x03, 0x04, 0x07, 0x05, 0x18, 0x06, 0x05, 0x09,
+    0x13, 0x0a, 0x19, 0x05, 0x06, 0x08, 0x04, 0x07, 0x13, 0x08, 0x09, 0xf0,
+    0x04, 0x0a, 0x15, 0x0b, 0x0a, 0x04, 0x0c, 0x05, 0x2a, 0x06, 0x07, 0x06,
+    0x09, 0x03, 0x08, 0x22, 0x07, 0x0a, 0x0d, 0x21, 0x0e, 0x0a, 0x0d, 0x02,
+    0x2a, 0xf0, 0x43, 0x18, 0x09, 0x14, 0x08, 0x0a, 0x03, 0x08, 0x12, 0x07,
+    0x1b, 0x03, 0x02, 0x0c, 0x11, 0x0d, 0x0c, 0x02, 0x28, 0x33, 0xf0, 0x07,
+    0x08, 0x04, 0x07, 0x05, 0x18, 0x08, 0x05, 0x1a, 0x03, 0x04, 0x0b, 0x16,
+    0x0d, 0x1c, 0x15, 0x0b, 0x07, 0x2a, 0x0b, 0x09, 0xf0, 0x06, 0x0b, 0x05,
+    0x0a, 0x14, 0x08, 0x07, 0x05, 0x36, 0x03, 0x31, 0x08, 0x07, 0x20, 0x0a,
+    0x09, 0x0e, 0x01, 0x0f, 0x12, 0x0b, 0x0e, 0xf0, 0x13, 0x0c, 0x0d, 0x04,
+    0x0a, 0x06, 0x1b, 0x05, 0x63, 0x19, 0x0c, 0x0d, 0x0b, 0x09, 0x0a, 0x05,
+    0x09, 0x06, 0x08, 0x15, 0x09, 0x0a, 0xf0, 0x04, 0x0b, 0x03, 0x0d, 0x15,
+    0x0a, 0x0b, 0x13, 0x1c, 0x24, 0x0e, 0x0f, 0x0e, 0x13, 0x0d, 0x0a, 0x04,
+    0x09, 0x03, 0x0c, 0x22, 0x1e, 0x09, 0xf0, 0x01, 0x0a, 0x12, 0x09, 0x0a,
+    0x11, 0x08, 0x07, 0x42, 0x06, 0x07, 0x09, 0x08, 0x07, 0x03, 0x18, 0x04,
+    0x03, 0x2b, 0x14, 0x03, 0x0c, 0xf0, 0x04, 0x0e, 0x06, 0x0b, 0x04, 0x0a,
+    0x03, 0x0d, 0x24, 0x0a, 0x1b, 0x03, 0x2e, 0x02, 0x03, 0x04, 0x0b, 0x03,
+    0x0e, 0x14, 0x0d, 0x1e, 0x03, 0x04, 0x0b, 0xf0, 0x05, 0x0d, 0x03, 0x0c,
+    0x42, 0x0b, 0x0c, 0x1b, 0x0a, 0x01, 0x0e, 0x02, 0x19, 0x03, 0x12, 0x0d,
+    0x0f, 0x03, 0x0c, 0x12, 0x0d, 0x0e, 0x04, 0x0b, 0xf0, 0x03, 0x1a, 0x42,
+    0x2b, 0x0d, 0x11, 0x1e, 0x22, 0x0c, 0x09, 0x0a, 0x03, 0x0b, 0x12, 0x0e,
+    0x1f, 0x14, 0x1e, 0xf0, 0x03, 0x04, 0x0c, 0x15, 0x0a, 0x0c, 0x06, 0x0e,
+    0x15, 0x1b, 0x08, 0x0c, 0x06, 0x0d, 0x05, 0x0e, 0x07, 0x0b, 0x05, 0x09,
+    0x03, 0x0a, 0x04, 0x0c, 0x03, 0x0b, 0x41, 0x0d, 0xf0, 0x09, 0x07, 0x06,
+    0x08, 0x10, 0x0c, 0x0b, 0x21, 0x0d, 0x0e, 0x0f, 0x13, 0x2c, 0x02, 0x04,
+    0x0d, 0x05, 0x0b, 0x33, 0x0c, 0x0b, 0xf0, 0x09, 0x18, 0x04, 0x03, 0x0a,
+    0x02, 0x1c, 0x14, 0x0b, 0x03, 0x1d, 0x15, 0x0c, 0x03, 0x1a, 0x05, 0x07,
+    0x0b, 0x34, 0x0c, 0x1a, 0xf0, 0x0b, 0x06, 0x19, 0x05, 0x03, 0x0b, 0x14,
+    0x0e, 0x0a, 0x02, 0x0e, 0x13, 0x0c, 0x49, 0x11, 0x02, 0x31, 0x07, 0x06,
+    0x27, 0xf0, 0x12, 0x01, 0x09, 0x02, 0x1b, 0x03, 0x02, 0x0e, 0x04, 0x0d,
+    0x06, 0x0c, 0x14, 0x0a, 0x0c, 0x07, 0x3b, 0x06, 0x05, 0x04, 0x03, 0x1e,
+    0x14, 0xf0, 0x0d, 0x02, 0x0e, 0x03, 0x1b, 0x04, 0x13, 0x09, 0x0e, 0x04,
+    0x0d, 0x12, 0x0f, 0x1c, 0x33, 0x0b, 0x0a, 0x08, 0x02, 0x09, 0x13, 0x0a,
+    0x0e, 0xf0, 0x02, 0x0b, 0x03, 0x08, 0x05, 0x07, 0x13, 0x08, 0x09, 0x04,
+    0x0a, 0x03, 0x09, 0x42, 0x0a, 0x1e, 0x0d, 0x0a, 0x01, 0x0c, 0x02, 0x0a,
+    0x03, 0x38, 0x12, 0xf0, 0x03, 0x12, 0x19, 0x23, 0x0a, 0x09, 0x08, 0x04,
+    0x17, 0x05, 0x16, 0x08, 0x09, 0x04, 0x0a, 0x05, 0x0c, 0x08, 0x1b, 0x15,
+    0x0a, 0xf0, 0x07, 0x0b, 0x05, 0x1c, 0x04, 0x15, 0x0d, 0x1b, 0x04, 0x33,
+    0x0e, 0x1a, 0x08, 0x11, 0x19, 0x02, 0x18, 0x01, 0x00, 0x0f, 0x21, 0x0c,
+    0xf0, 0x0e, 0x0b, 0x02, 0x0a, 0x33, 0x48, 0x14, 0x0a, 0x12, 0x0d, 0x0b,
+    0x13, 0x0e, 0x0a, 0x02, 0x1e, 0x23, 0x0f, 0xf0, 0x0c, 0x24, 0x0b, 0x0e,
+    0x0f, 0x05, 0x0d, 0x04, 0x0e, 0x05, 0x0c, 0x07, 0x0b, 0x05, 0x0a, 0x04,
+    0x19, 0x06, 0x05, 0x0a, 0x03, 0x0e, 0x14, 0x0a, 0x29, 0x23, 0xf0, 0x07,
+    0x12, 0x18, 0x11, 0x19, 0x02, 0x08, 0x01, 0x09, 0x00, 0x0d, 0x21, 0x0a,
+    0x0e, 0x0b, 0x02, 0x09, 0x13, 0x18, 0x24, 0x09, 0xf0, 0x0d, 0x1e, 0x16,
+    0x1a, 0x05, 0x08, 0x09, 0x07, 0x18, 0x24, 0x1a, 0x63, 0x09, 0x0a, 0x0b,
+    0x0a, 0x0b, 0x0a, 0xf0, 0x08, 0x04, 0x07, 0x03, 0x08, 0x02, 0x19, 0x13,
+    0x0a, 0x12, 0x09, 0x0c, 0x03, 0x0b, 0x02, 0x0f, 0x03, 0x0c, 0x34, 0x0b,
+    0x0a, 0x1b, 0x23, 0x0d, 0xf0, 0x0f, 0x0e, 0x02, 0x0b, 0x13, 0x08, 0x0a,
+    0x12, 0x09, 0x08, 0x03, 0x07, 0x62, 0x18, 0x3a, 0x08, 0x13, 0x07, 0xf0,
+    0x09, 0x02, 0x0a, 0x03, 0x19, 0x05, 0x14, 0x0b, 0x1a, 0x16, 0x09, 0x05,
+    0x1b, 0x06, 0x25, 0x0d, 0x3b, 0x14, 0x05, 0x1a, 0xf0, 0x13, 0x38, 0x04,
+    0x03, 0x22, 0x09, 0x08, 0x31, 0x0c, 0x2f, 0x22, 0x0a, 0x08, 0x19, 0x03,
+    0x12, 0x0b, 0xf0, 0x19, 0x13, 0x0a, 0x12, 0x0d, 0x0f, 0x33, 0x0c, 0x0a,
+    0x0c, 0x0d, 0x34, 0x09, 0x0a, 0x08, 0x09, 0x15, 0x0b, 0x19, 0x04, 0xf0,
+    0x05, 0x1b, 0x06, 0x15, 0x19, 0x06, 0x18, 0x05, 0x04, 0x09, 0x23, 0x0b,
+    0x0a, 0x09, 0x32, 0x0a, 0x08, 0x0a, 0x09, 0x11, 0x0a, 0x0e, 0xf0, 0x02,
+    0x0a, 0x11, 0x0e, 0x0c, 0x32, 0x08, 0x09, 0x08, 0x0a, 0x23, 0x08, 0x0c,
+    0x0b, 0x04, 0x19, 0x06, 0x07, 0x0a, 0x15, 0x0b, 0x0c, 0x07, 0x0b, 0xf0,
+    0x05, 0x0c, 0x23, 0x0f, 0x0e, 0x0c, 0x52, 0x0f, 0x0d, 0x0e, 0x0f, 0x0d,
+    0x0a, 0x13, 0x08, 0x19, 0x12, 0x18, 0x33, 0x07, 0xf0, 0x06, 0x17, 0x34,
+    0x08, 0x09, 0x0b, 0x15, 0x0c, 0x1b, 0x04, 0x15, 0x0a, 0x0b, 0x03, 0x1e,
+    0x02, 0x13, 0x2b, 0x72, 0xf0, 0x09, 0x0a, 0x09, 0x08, 0x07, 0x08, 0x09,
+    0x11, 0x0d, 0x0f, 0x22, 0x0e, 0x0b, 0x08, 0x03, 0x1a, 0x24, 0x09, 0x1a,
+    0xf0, 0x15, 0x0d, 0x26, 0x0b, 0x09, 0x2a, 0x07, 0x05, 0x04, 0x0e, 0x05,
+    0x0d, 0x04, 0x0c, 0x23, 0x08, 0x0a, 0x0c, 0x62, 0x0d, 0x09, 0x08, 0xf0,
+    0x19, 0x18, 0x03, 0x07, 0x12, 0x09, 0x38, 0x13, 0x12, 0x0a, 0x33, 0x09,
+    0x28, 0x04, 0x17, 0xf0, 0x05, 0x04, 0x08, 0x03, 0x0b, 0x14, 0x0a, 0x08,
+    0x03, 0x09, 0x14, 0x0a, 0x0c, 0x13, 0x0b, 0x0e, 0x55, 0x0c, 0x1d, 0x1b,
+    0x0c, 0xf0, 0x04, 0x0d, 0x23, 0x0c, 0x0d, 0x18, 0x22, 0x1a, 0x11, 0x0c,
+    0x0b, 0x22, 0x08, 0x09, 0x08, 0x11, 0x0c, 0x0d, 0x22, 0x09, 0x0a, 0xf0,
+    0x09, 0x23, 0x08, 0x0b, 0x0a, 0x04, 0x0c, 0x25, 0x0e, 0x0c, 0x1b, 0x26,
+    0x0c, 0x0b, 0x04, 0x1c, 0x23, 0x0b, 0x09, 0x82, 0x1b, 0xf0, 0x0c, 0x09,
+    0x0b, 0x0d, 0x0b, 0x09, 0x0b, 0x33, 0x08, 0x09, 0x28, 0x34, 0x09, 0x0a,
+    0x0b, 0xf0, 0x35, 0x2a, 0x0b, 0x04, 0x0d, 0x43, 0x0e, 0x1b, 0x0a, 0x08,
+    0xc2, 0x0a, 0x09, 0x08, 0x37, 0xf0, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0f,
+    0x13, 0x0b, 0x0d, 0x04, 0x19, 0x35, 0x0b, 0x0c, 0x0e, 0x26, 0x0a, 0x0c,
+    0xf0, 0x0b, 0x15, 0x0e, 0x1c, 0x04, 0x23, 0x0d, 0x0b, 0x09, 0xf2, 0x0b,
+    0x0a, 0x09, 0x38, 0x2a, 0xf0, 0x0b, 0x0c, 0x0b, 0x0c, 0x0d, 0x0c, 0xc3,
+    0x09, 0x1b, 0x0c, 0x0e, 0x2b, 0x1a, 0xf0, 0x1c, 0x0f, 0x14, 0x0d, 0x0e,
+    0x05, 0x1d, 0x06, 0x25, 0x0e, 0x0c, 0x0b, 0x14, 0x0c, 0x09, 0x03, 0x0b,
+    0xd2, 0x0d, 0x0a, 0xf0, 0x09, 0x08, 0x07, 0x08, 0x16, 0x27, 0x08, 0x09,
+    0x0c, 0x13, 0x0a, 0x0b, 0x04, 0x09, 0x15, 0x0a, 0xf0, 0x0b, 0x06, 0x0a,
+    0x07, 0x1b, 0x06, 0x15, 0x2d, 0x04, 0x03, 0x0c, 0x92, 0x0f, 0x0c, 0x0b,
+    0x0a, 0x09, 0x08, 0x09, 0x0a, 0xf0, 0x0b, 0x0d, 0x13, 0x18, 0x34, 0x07,
+    0x28, 0x35, 0x07, 0x08, 0x19, 0x34, 0x2c, 0x0a, 0xf0, 0x43, 0x0e, 0x0b,
+    0x19, 0x08, 0x72, 0x09, 0x27, 0x28, 0x09, 0x63, 0x07, 0x18, 0xf0, 0x09,
+    0x0a, 0x0c, 0x0e, 0x04, 0x0b, 0x15, 0x19, 0x26, 0x08, 0x09, 0x0b, 0x35,
+    0x0d, 0x0c, 0x0a, 0x19, 0x04, 0x23, 0x0a, 0xf0, 0x09, 0x08, 0x92, 0x0b,
+    0x1a, 0x18, 0x09, 0x0a, 0x2b, 0xf3, 0x18, 0x07, 0x08, 0xf0, 0x09, 0x08,
+    0x0a, 0x0e, 0x0c, 0x0b, 0x0a, 0x09, 0x0a, 0x09, 0x08, 0x09, 0x13, 0x0b,
+    0x0a, 0x04, 0x19, 0x25, 0xf0, 0x0a, 0x0c, 0x36, 0x0d, 0x0b, 0x09, 0x18,
+    0x05, 0x04, 0x09, 0x03, 0x0b, 0x22, 0x0c, 0x1a, 0x41, 0x0e, 0x1d, 0x0b,
+    0xf0, 0x0a, 0x52, 0x17, 0x08, 0x19, 0x0c, 0x13, 0x0a, 0x0b, 0x04, 0x19,
+    0x06, 0x07, 0x18, 0x08, 0x1b, 0x37, 0x08, 0xf0, 0x07, 0x05, 0x18, 0x04,
+    0x03, 0x39, 0x42, 0x08, 0x07, 0x83, 0x06, 0x17, 0x08, 0x19, 0x0a, 0xf0,
+    0x0c, 0x0d, 0x74, 0x0a, 0x09, 0x0a, 0x1c, 0x09, 0x1a, 0x33, 0x0e, 0x0c,
+    0x0a, 0x09, 0x92, 0x0d, 0x0a, 0xf0, 0x38, 0x0a, 0x0c, 0x0a, 0x0b, 0x53,
+    0x19, 0x2a, 0x0c, 0x44, 0x19, 0xf0, 0x0c, 0x0d, 0x0c, 0x15, 0x0a, 0x0d,
+    0x24, 0x0e, 0x0c, 0x0d, 0x23, 0x0f, 0x0c, 0x0b, 0xa2, 0x0f, 0x0e, 0x0d,
+    0x0a, 0x19, 0xf0, 0x08, 0x0b, 0x0e, 0x1d, 0x53, 0x19, 0x08, 0x09, 0x08,
+    0x09, 0x14, 0x17, 0x15, 0x36, 0xf0, 0x24, 0x07, 0x43, 0x08, 0x07, 0x18,
+    0x09, 0x04, 0x08, 0x05, 0x17, 0x06, 0x17, 0x38, 0x18, 0x06, 0x09, 0xf0,
+    0x15, 0x1a, 0x04, 0x19, 0x23, 0x08, 0x07, 0x12, 0x09, 0x08, 0x71, 0x0c,
+    0x0a, 0x0b, 0x0a, 0x0c, 0x2e, 0xf0, 0x22, 0x0b, 0x0d, 0x1f, 0x03, 0x04,
+    0x1e, 0x05, 0x37, 0x3b, 0x05, 0x1d, 0x14, 0x19, 0x03, 0xc2, 0x0a, 0x0b,
+    0xf0, 0x0a, 0x07, 0x09, 0x0a, 0x0b, 0x0c, 0x1d, 0x2f, 0x23, 0x0d, 0x1c,
+    0x14, 0x1b, 0xf0, 0x03, 0x0d, 0x44, 0x1a, 0x19, 0x08, 0x23, 0x1a, 0x09,
+    0x32, 0x0a, 0x0b, 0x09, 0x08, 0x13, 0x07, 0x08, 0x12, 0x0a, 0xf0, 0x0d,
+    0xa3, 0x19, 0x0a, 0x19, 0x1b, 0x09, 0x1e, 0x0c, 0x04, 0x0d, 0x05, 0x1a,
+    0x14, 0x0b, 0xf0, 0x05, 0x0a, 0x14, 0x0b, 0x0a, 0x33, 0x0e, 0x1a, 0x09,
+    0x22, 0x0a, 0x0c, 0x0b, 0x01, 0x0f, 0x02, 0x0b, 0x03, 0x09, 0x12, 0x0d,
+    0x0e, 0x33, 0x0b, 0xf0, 0x2a, 0x02, 0x0e, 0x43, 0x09, 0x0b, 0x08, 0x0a,
+    0x0c, 0x12, 0x0d, 0x0f, 0x03, 0x1c, 0x42, 0x09, 0x0c, 0x0b, 0xf0, 0x0c,
+    0x13, 0x09, 0x08, 0x04, 0x09, 0x15, 0x1a, 0x06, 0x0b, 0x08, 0x0a, 0x16,
+    0x29, 0x08, 0x05, 0x0a, 0x14, 0x19, 0x03, 0x0a, 0x12, 0x0e, 0xf0, 0x0d,
+    0x71, 0x0e, 0x0c, 0x0e, 0x08, 0x09, 0x0c, 0x18, 0x22, 0x29, 0x03, 0x2a,
+    0x04, 0x05, 0x07, 0x0b, 0xf0, 0x16, 0x0c, 0x0e, 0x09, 0x0c, 0x06, 0x1b,
+    0x15, 0x1e, 0x03, 0x02, 0x0d, 0x13, 0x0a, 0x18, 0x62, 0x0a, 0x19, 0x0d,
+    0x28, 0xf0, 0x03, 0x12, 0x0b, 0x0a, 0x23, 0x0c, 0x0a, 0x08, 0x14, 0x0b,
+    0x0c, 0x03, 0x0e, 0x24, 0x1a, 0x39, 0x05, 0x04, 0x03, 0xf0, 0x04, 0x0a,
+    0x03, 0x1b, 0x02, 0x13, 0x0a, 0x09, 0x62, 0x08, 0x0b, 0x0e, 0x0a, 0x0d,
+    0x1e, 0x13, 0x0b, 0x09, 0x02, 0x0b, 0x13, 0x0c, 0xf0, 0x0a, 0x02, 0x0b,
+    0x03, 0x0a, 0x04, 0x08, 0x13, 0x09, 0x0c, 0x44, 0x0b, 0x0a, 0x0b, 0x2a,
+    0x05, 0x04, 0x0b, 0x23, 0x0a, 0x0e, 0x0c, 0xf0, 0x12, 0x09, 0x0c, 0x03,
+    0x09, 0x12, 0x1a, 0x63, 0x08, 0x09, 0x0b, 0x0a, 0x09, 0x0e, 0x0c, 0x02,
+    0x0d, 0x03, 0x0a, 0x04, 0x08, 0x13, 0x07, 0xf0, 0x18, 0x04, 0x03, 0x09,
+    0x52, 0x1e, 0x1d, 0x09, 0x17, 0x13, 0x08, 0x02, 0x1a, 0x03, 0x05, 0x09,
+    0x04, 0x0b, 0x05, 0x0a, 0xf0, 0x07, 0x0b, 0x06, 0x2e, 0x35, 0x1d, 0x04,
+    0x0c, 0x23, 0x0a, 0x0c, 0x0b, 0x22, 0x09, 0x08, 0x19, 0x61, 0x07, 0x19,
+    0xf0, 0x08, 0x09, 0x0d, 0x02, 0x0b, 0x13, 0x19, 0x04, 0x0d, 0x26, 0x0c,
+    0x0b, 0x2e, 0x08, 0x06, 0x25, 0x0c, 0x0d, 0x0a, 0xf0, 0x04, 0x19, 0x03,
+    0x22, 0x0d, 0x0e, 0x0d, 0x11, 0x1f, 0x62, 0x0a, 0x08, 0x07, 0x1a, 0x08,
+    0x0e, 0x33, 0x0b, 0x0c, 0xf0, 0x0b, 0x1d, 0x04, 0x05, 0x0a, 0x14, 0x29,
+    0x05, 0x04, 0x0a, 0x03, 0x0d, 0x14, 0x0a, 0x18, 0x33, 0x09, 0x0a, 0x09,
+    0x22, 0x0a, 0xf0, 0x09, 0x0c, 0x03, 0x09, 0x12, 0x0b, 0x0a, 0x13, 0x19,
+    0x02, 0x0d, 0x13, 0x19, 0x12, 0x0c, 0x0e, 0x33, 0x0a, 0x1b, 0x0a, 0xf0,
+    0x04, 0x09, 0x05, 0x0a, 0x04, 0x0b, 0x03, 0x0e, 0x14, 0x0d, 0x0c, 0x23,
+    0x1e, 0x0c, 0x12, 0x0e, 0x0d, 0x43, 0x28, 0x07, 0x28, 0xf0, 0x14, 0xa3,
+    0x09, 0x0b, 0x0c, 0x1a, 0x0b, 0x09, 0x08, 0x09, 0x0a, 0x09, 0x32, 0x0b,
+    0x0a, 0x0d, 0xf0, 0x0a, 0x11, 0x0e, 0x0f, 0x12, 0x0b, 0x0a, 0x03, 0x08,
+    0x24, 0x09, 0x0a, 0x2d, 0x05, 0x16, 0x1e, 0x15, 0x0c, 0x16, 0x2a, 0xf0,
+    0x24, 0x28, 0x03, 0x22, 0x0a, 0x09, 0x07, 0x51, 0x09, 0x08, 0x19, 0x08,
+    0x09, 0x02, 0x18, 0x13, 0x09, 0xf0, 0x04, 0x38, 0x06, 0x07, 0x08, 0x1b,
+    0x57, 0x08, 0x17, 0x06, 0x05, 0x46, 0x24, 0x03, 0x72, 0x07, 0xf0, 0x18,
+    0x07, 0x08, 0x19, 0x0a, 0x33, 0x09, 0x0d, 0x0e, 0x0d, 0x04, 0x0b, 0x15,
+    0x0a, 0x09, 0x14, 0x0a, 0x0b, 0xf0, 0x35, 0x09, 0x08, 0x17, 0x04, 0x08,
+    0x33, 0x29, 0x08, 0xb2, 0x09, 0x0a, 0x0e, 0x0c, 0x09, 0x0a, 0x1e, 0xf0,
+    0x0c, 0x1f, 0x0d, 0x03, 0x08, 0x04, 0x07, 0x05, 0x06, 0x04, 0x07, 0x05,
+    0x06, 0x08, 0x25, 0x09, 0x07, 0x09, 0x14, 0x0b, 0x0f, 0xf3, 0xf0, 0x1d,
+    0x0c, 0x09, 0x08, 0x19, 0x18, 0x0a, 0x0d, 0x0a, 0x09, 0x0b, 0x0c, 0x1a,
+    0xf3, 0xf0, 0x0b, 0x39, 0x07, 0x16, 0x07, 0x06, 0x05, 0x06, 0x07, 0x08,
+    0x19, 0x03, 0xf0, 0x24, 0x0b, 0x0e, 0x0d, 0x05, 0x0c, 0x16, 0x2b, 0x45,
+    0x0e, 0x0a, 0x07, 0x05, 0x06, 0x04, 0x07, 0x03, 0x08, 0x02, 0x0a, 0x71,
+    0x0f, 0xf0, 0x0d, 0x1a, 0x1b, 0x0a, 0x0d, 0x02, 0x0c, 0x13, 0x1a, 0x04,
+    0x09, 0x05, 0x1a, 0x36, 0x0b, 0x1a, 0xf0, 0x05, 0x0c, 0x24, 0x0e, 0x0d,
+    0x0b, 0x03, 0x0a, 0xb2, 0x0c, 0x0e, 0x0c, 0x08, 0x07, 0x08, 0x19, 0x08,
+    0x09, 0x0c, 0xf0, 0x0d, 0x03, 0x0a, 0x14, 0x19, 0x03, 0x1d, 0x04, 0x05,
+    0x0c, 0x54, 0x0e, 0x1b, 0x1d, 0x0a, 0x53, 0x1b, 0x29, 0xf0, 0x08, 0x62,
+    0x09, 0x0a, 0x0d, 0x0b, 0x09, 0x08, 0x0a, 0x93, 0x18, 0x07, 0x18, 0x09,
+    0xf0, 0x1d, 0x0b, 0x0e, 0x64, 0x1c, 0x0a, 0x08, 0x09, 0x0b, 0x0a, 0xf3,
+    0x0c, 0x0b, 0x1a, 0x0b, 0xf0, 0x0a, 0x18, 0x0a, 0x0b, 0x0a, 0x18, 0x1b,
+    0x0a, 0x53, 0x39, 0x08, 0xf0, 0x07, 0x62, 0x09, 0x0a, 0x1b, 0x19, 0x0d,
+    0x23, 0x0a, 0x0c, 0x0e, 0x04, 0x0a, 0x05, 0x19, 0x26, 0x2a, 0xf0, 0x25,
+    0x09, 0x0a, 0x04, 0x0d, 0x03, 0x0e, 0xb2, 0x1f, 0x0e, 0x0c, 0x09, 0x37,
+    0x08, 0x07, 0xf0, 0x18, 0x33, 0x0b, 0x0c, 0x0e, 0x04, 0x0b, 0x35, 0x0a,
+    0x0d, 0x0c, 0x0a, 0x34, 0x0e, 0x0c, 0x0b, 0x19, 0x03, 0xb2, 0x0a, 0xf0,
+    0x1b, 0x09, 0x18, 0x09, 0x2b, 0x0d, 0x0f, 0x33, 0x0b, 0x1f, 0x0e, 0x04,
+    0x2b, 0xf0, 0x15, 0x44, 0x0d, 0x0b, 0x1c, 0x0a, 0x53, 0x0c, 0x0a, 0x29,
+    0x08, 0x62, 0x09, 0x08, 0x1a, 0xf0, 0x18, 0x09, 0x53, 0x07, 0x28, 0x09,
+    0x0a, 0xb4, 0x09, 0x0a, 0x09, 0x08, 0x0b, 0x0d, 0xf0, 0x0a, 0x19, 0x0a,
+    0x19, 0xf3, 0x0c, 0x0a, 0x09, 0x0b, 0x0c, 0x09, 0x07, 0x08, 0x0a, 0x09,
+    0xf0, 0x08, 0x09, 0x2a, 0x19, 0x03, 0x92, 0x0d, 0x0e, 0x0f, 0x0d, 0x09,
+    0x0a, 0x0d, 0x0b, 0x0a, 0xf0, 0x0b, 0x13, 0x08, 0x0a, 0x44, 0x08, 0x09,
+    0x0b, 0x0c, 0x0e, 0x15, 0x0d, 0x0c, 0x34, 0x0d, 0x0b, 0x0c, 0x0a, 0x03,
+    0x0c, 0xb2, 0x1f, 0xf0, 0x0e, 0x0d, 0x0c, 0x0a, 0x09, 0x08, 0x09, 0x0a,
+    0x19, 0x33, 0x08, 0x09, 0x0b, 0x0c, 0x04, 0x09, 0xf0, 0x65, 0x08, 0x09,
+    0x0a, 0x09, 0x08, 0x17, 0x04, 0x08, 0x03, 0x09, 0xb2, 0x0c, 0x1b, 0x0a,
+    0x19, 0x0a, 0xf0, 0x0b, 0x1e, 0x1f, 0x03, 0x0c, 0xa4, 0x19, 0x0a, 0x0b,
+    0x0d, 0x1e, 0x1b, 0x0a, 0xf0, 0x09, 0x43, 0x0e, 0x0b, 0x29, 0x92, 0x0b,
+    0x09, 0x18, 0x19, 0x08, 0x09, 0x0b, 0x0e, 0xf0, 0x23, 0x29, 0xc4, 0x08,
+    0x49, 0x0a, 0x0b, 0x49, 0xf0, 0xf3, 0x0c, 0x1a, 0x0b, 0x0a, 0x19, 0x08,
+    0x09, 0x0a, 0x39, 0x0a, 0x09, 0xf0, 0xa2, 0x0d, 0x3e, 0x0d, 0x0b, 0x0c,
+    0x1e, 0x0d, 0x13, 0x08, 0x09, 0xb4, 0x08, 0x19, 0xf0, 0x0b, 0x2e, 0x0d,
+    0x29, 0x08, 0x43, 0x09, 0x18, 0x09, 0x08, 0x72, 0x0b, 0x0a, 0xf0, 0x4b,
+    0x0c, 0x43, 0x09, 0x0a, 0x1b, 0x0d, 0x54, 0x0a, 0x0b, 0x0a, 0x29, 0xf0,
+    0x23, 0x0c, 0x0a, 0x09, 0x62, 0x0d, 0x1e, 0x0c, 0x0a, 0x0b, 0x0d, 0x03,
+    0x09, 0x14, 0x16, 0x05, 0x15, 0x06, 0xf0, 0x08, 0xa4, 0x29, 0x0a, 0x0c,
+    0x0b, 0x29, 0x0a, 0x0e, 0x23, 0x1a, 0x1f, 0xa2, 0xf0, 0x0d, 0x0b, 0x19,
+    0x3a, 0x0c, 0x09, 0xf3, 0x0a, 0x09, 0x0a, 0x0b, 0x1d, 0xf0, 0x0e, 0x0c,
+    0x0d, 0x1f, 0x1e, 0x0d, 0x1e, 0xf3, 0x0b, 0x1a, 0x2b, 0xf0, 0x19, 0x0b,
+    0x1a, 0x09, 0x08, 0x09, 0x0a, 0x08, 0xf3, 0x07, 0x38, 0x17, 0xf0, 0x48,
+    0x0a, 0x0d, 0x1e, 0x03, 0x0a, 0x74, 0x0b, 0x0c, 0x0d, 0x0a, 0x29, 0xf0,
+    0x0c, 0xf3, 0x0a, 0x29, 0x08, 0x37, 0x08, 0x17, 0x08, 0xf0, 0x09, 0x0a,
+    0x2b, 0xf3, 0x3e, 0x1c, 0x0e, 0x0b, 0x29, 0xf0, 0x18, 0x17, 0xf3, 0x18,
+    0x29, 0x0a, 0x1e, 0x0c, 0x0e, 0x2f, 0xf0, 0x0e, 0x0d, 0xf3, 0x1e, 0x0c,
+    0x0b, 0x0a, 0x19, 0x08, 0x67, 0xf0, 0x08, 0xf3, 0x19, 0x2a, 0x0b, 0x0c,
+    0x1b, 0x0c, 0x2e, 0xf0, 0x2c, 0xf3, 0x0b, 0x0c, 0x0b, 0x0a, 0x0b, 0x0c,
+    0x4b, 0x0a, 0x29, 0xf0, 0x28, 0x23, 0x0c, 0x92, 0x2e, 0x0d, 0x1e, 0x2f,
+    0x0a, 0x33, 0xf0, 0x1b, 0x0d, 0x29, 0x64, 0x1a, 0x19, 0x1d, 0xf3, 0x0c,
+    0x0a, 0x19, 0xf0, 0x28, 0x17, 0x38, 0x19, 0xf3, 0x0b, 0x0a, 0x0b, 0x1c,
+    0xf0, 0x0b, 0x0d, 0x0c, 0x0b, 0x1c, 0x1b, 0x29, 0xf3, 0x48, 0xf0, 0x19,
+    0x0a, 0x1b, 0x0c, 0x0d, 0x1c, 0x0e, 0x0d, 0xf3, 0x0c, 0x1d, 0x2b, 0xf0,
+    0x0a, 0x39, 0x58, 0xf3, 0x59, 0xf0, 0x2a, 0x2b, 0x0c, 0x1b, 0xf3, 0x0c,
+    0x4b, 0xf0, 0x3c, 0x2b, 0x39, 0xf3, 0x88, 0xf0, 0x39, 0x2b, 0xf3, 0x0c,
+    0x1d, 0x2e, 0xf0, 0x0d, 0x2c, 0x0b, 0x1a, 0x09, 0x66, 0x64, 0xf0, 0x29,
+    0xf3, 0x2a, 0x1b, 0x0a, 0x6b, 0xf0, 0x2a, 0xf3, 0x79, 0x2a, 0x6b, 0xf0,
+    0xf3, 0x0c, 0x2b, 0x2a, 0x09, 0x1a, 0xf0, 0xc9, 0xf3, 0x6a, 0xf0, 0xf3,
+    0x7b, 0x1c, 0x2b, 0xf0, 0x1a, 0xf3, 0x69, 0x08, 0x49, 0xf0, 0x4a, 0xf3,
+    0x7b, 0x0a, 0x1b, 0xf0, 0x2a, 0xf3, 0x69, 0x1a, 0x09, 0xfa, 0xf0, 0xf3,
+    0x1a, 0x19, 0xf0, 0x0a, 0xf3, 0x19, 0xfa, 0xf0, 0xf3, 0xca, 0xf0, 0x19,
+    0xf3, 0x1a, 0x09, 0xfa, 0xf0, 0xf3, 0xfa, 0xc0, 0xa3, 0x5a, 0x0a, 0x03,
+    0x00
+};
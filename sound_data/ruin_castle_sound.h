@@ -0,0 +1,844 @@
+const uint8_t ruin_castle_sound [] = {
+    0xf3, 0xf5, 0xf1, 0xf3, 0x95, 0x91, 0x09, 0xf0, 0x0a, 0x09, 0x0a, 0x09,
+    0x0a, 0xc3, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x1a,
+    0xf0, 0x0c, 0x09, 0x22, 0x0a, 0x19, 0x03, 0x08, 0x02, 0x29, 0x17, 0x06,
+    0x08, 0x02, 0x07, 0x0c, 0x08, 0x03, 0x09, 0x04, 0x0c, 0x03, 0x0b, 0x02,
+    0x0f, 0xf0, 0x06, 0x0c, 0x01, 0x0a, 0x0f, 0x0b, 0x03, 0x09, 0x07, 0x1a,
+    0x02, 0x00, 0x0e, 0x01, 0x09, 0x04, 0x0a, 0x08, 0x0b, 0x16, 0x0c, 0x0a,
+    0x01, 0x07, 0x00, 0x08, 0x02, 0x1e, 0x07, 0xf0, 0x03, 0x0d, 0x15, 0x0e,
+    0x09, 0x01, 0x08, 0x10, 0x07, 0x09, 0x01, 0x08, 0x00, 0x1a, 0x02, 0x03,
+    0x09, 0x00, 0x0c, 0x03, 0x09, 0x01, 0x08, 0x06, 0x0b, 0x17, 0x2a, 0xf0,
+    0x08, 0x03, 0x09, 0x06, 0x0d, 0x03, 0x0e, 0x15, 0x2c, 0x06, 0x03, 0x1a,
+    0x02, 0x09, 0x08, 0x02, 0x06, 0x00, 0x05, 0x04, 0x07, 0x01, 0x0b, 0x00,
+    0x1a, 0x02, 0xf0, 0x04, 0x1b, 0x06, 0x13, 0x0a, 0x18, 0x02, 0x20, 0x06,
+    0x08, 0x0c, 0x05, 0x0a, 0x0b, 0x08, 0x04, 0x07, 0x01, 0x06, 0x00, 0x08,
+    0x01, 0x0c, 0x00, 0x09, 0x01, 0x08, 0xf0, 0x02, 0x07, 0x07, 0x08, 0x04,
+    0x0a, 0x08, 0x1c, 0x0f, 0x08, 0x2d, 0x0c, 0x08, 0x09, 0x0e, 0x06, 0x1c,
+    0x05, 0x03, 0x1a, 0x02, 0x30, 0x0b, 0x07, 0x1a, 0xf0, 0x01, 0x0e, 0x0b,
+    0x09, 0x02, 0x07, 0x03, 0x08, 0x06, 0x17, 0x13, 0x08, 0x01, 0x19, 0x02,
+    0x01, 0x0d, 0x19, 0x0f, 0x1e, 0x01, 0x00, 0x0d, 0x01, 0x0f, 0xf0, 0x12,
+    0x0d, 0x0c, 0x03, 0x09, 0x04, 0x2b, 0x09, 0x0f, 0x0d, 0x0c, 0x06, 0x2b,
+    0x04, 0x1f, 0x19, 0x09, 0x0a, 0x08, 0x01, 0x07, 0x16, 0x09, 0x08, 0xf0,
+    0x01, 0x36, 0x00, 0x14, 0x02, 0x08, 0x05, 0x09, 0x21, 0x07, 0x06, 0x09,
+    0x02, 0x0b, 0x01, 0x09, 0x00, 0x16, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x03,
+    0x0d, 0xf0, 0x21, 0x18, 0x0e, 0x04, 0x0f, 0x11, 0x0c, 0x0b, 0x04, 0x0a,
+    0x01, 0x0d, 0x06, 0x1b, 0x15, 0x0c, 0x08, 0x0d, 0x09, 0x1e, 0x0f, 0x0a,
+    0x0d, 0x6f, 0x4f, 0xf0, 0x0d, 0x0c, 0x0c, 0x2a, 0x04, 0x03, 0x20, 0x0b,
+    0x0a, 0x09, 0x11, 0x17, 0x03, 0x08, 0x0f, 0x0a, 0xf0, 0x05, 0x09, 0x01,
+    0x07, 0x13, 0x08, 0x09, 0x02, 0x0d, 0x07, 0x1f, 0x03, 0x02, 0x0c, 0x01,
+    0x09, 0x05, 0x08, 0x07, 0x07, 0x03, 0x05, 0x06, 0x04, 0x0b, 0x03, 0x06,
+    0x02, 0x04, 0x11, 0xd0, 0x05, 0x03, 0x00, 0x00, 0x01, 0x03, 0x32, 0x0e,
+    0x09, 0x0a, 0x0c, 0x41, 0x07, 0x06, 0x03, 0x01, 0x10, 0x02, 0x01, 0xf1,
+    0x04, 0x02, 0x0e, 0x13, 0x07, 0x04, 0x04, 0x05, 0x05, 0x04, 0x06, 0x03,
+    0x09, 0x09, 0x0b, 0x05, 0x0c, 0x02, 0x0d, 0x04, 0x0c, 0x06, 0x0a, 0x0c,
+    0x0c, 0x0f, 0x1e, 0x0e, 0x0a, 0x0c, 0xf1, 0x08, 0x0e, 0x06, 0x0d, 0x05,
+    0x0e, 0x04, 0x0c, 0x43, 0x09, 0x1b, 0x19, 0x04, 0x08, 0x03, 0x09, 0x05,
+    0x28, 0x04, 0x03, 0x02, 0x09, 0x03, 0x0a, 0xf1, 0x04, 0x0c, 0x06, 0x0a,
+    0x05, 0x07, 0x04, 0x16, 0x07, 0x06, 0x17, 0x05, 0x02, 0x08, 0x13, 0x0c,
+    0x0a, 0x12, 0x09, 0x1c, 0x11, 0x0d, 0x12, 0x0b, 0x0a, 0x01, 0x06, 0x08,
+    0x62, 0x0f, 0x09, 0x0c, 0x08, 0x08, 0x06, 0x1b, 0x05, 0x04, 0x07, 0x03,
+    0x05, 0x04, 0x31, 0x14, 0x03, 0x02, 0x12, 0x01, 0x02, 0xf0, 0x03, 0x01,
+    0x25, 0xb0, 0x14, 0x12, 0x14, 0x05, 0x07, 0x04, 0x02, 0x01, 0x06, 0x70,
+    0x11, 0xf0, 0x00, 0x01, 0x04, 0x09, 0x0b, 0x05, 0x01, 0x02, 0x02, 0x07,
+    0x03, 0x0e, 0x14, 0x03, 0x12, 0x07, 0x29, 0x10, 0x01, 0x06, 0x11, 0x00,
+    0x0a, 0x01, 0x17, 0x02, 0x05, 0x03, 0x2f, 0x08, 0x34, 0x1d, 0x1c, 0x0a,
+    0x0d, 0x23, 0x1a, 0x0b, 0x09, 0x18, 0x0c, 0x12, 0x0b, 0x06, 0x0f, 0xf1,
+    0x03, 0x1d, 0x01, 0x00, 0x0f, 0x23, 0x0a, 0x09, 0x16, 0x01, 0x00, 0x05,
+    0x31, 0x07, 0x18, 0x0d, 0x22, 0x0c, 0x3f, 0x33, 0xf1, 0x1c, 0x14, 0x1b,
+    0x05, 0x0d, 0x08, 0x0c, 0x16, 0x0d, 0x0e, 0x07, 0x0c, 0x08, 0x0e, 0x0d,
+    0x0d, 0x1c, 0x0c, 0x0b, 0x0e, 0x0a, 0x0d, 0x29, 0x51, 0x0b, 0x0d, 0x1b,
+    0x18, 0x0c, 0x07, 0x37, 0x0e, 0xf0, 0x0c, 0x0b, 0x2c, 0x15, 0x14, 0x0d,
+    0x0a, 0x23, 0x08, 0x0a, 0x09, 0x02, 0x18, 0x03, 0x01, 0x09, 0x02, 0x08,
+    0x01, 0x07, 0x80, 0x06, 0x20, 0x04, 0x02, 0x11, 0x21, 0x02, 0x04, 0xf0,
+    0x06, 0x08, 0x01, 0x0b, 0x32, 0x08, 0x19, 0x0c, 0x03, 0x19, 0x01, 0x40,
+    0x0b, 0x0f, 0x0a, 0x36, 0x12, 0xf0, 0x01, 0x08, 0x12, 0x0c, 0x1b, 0x03,
+    0x14, 0x0c, 0x0b, 0x02, 0x07, 0x01, 0x08, 0x03, 0x07, 0x02, 0x08, 0x01,
+    0x0c, 0x02, 0x0f, 0x03, 0x1e, 0x02, 0x01, 0x0c, 0x12, 0x08, 0xa0, 0x0a,
+    0x13, 0x08, 0x0a, 0x24, 0x1b, 0x0e, 0x06, 0x1b, 0x07, 0x0a, 0x0e, 0x09,
+    0x0f, 0x1b, 0x08, 0xf1, 0x19, 0x0d, 0x0c, 0x0a, 0x0b, 0x0b, 0x18, 0x0c,
+    0x0b, 0x17, 0x1a, 0x06, 0x1b, 0x15, 0x19, 0x04, 0x23, 0x0b, 0x09, 0x08,
+    0x12, 0x0a, 0xc1, 0x0b, 0x13, 0x09, 0x18, 0x12, 0x0a, 0xc1, 0x0d, 0x0e,
+    0x0f, 0x0c, 0x0a, 0x08, 0x07, 0x0c, 0xf0, 0x1a, 0x0c, 0x0b, 0x0c, 0x22,
+    0x18, 0x0a, 0x01, 0x0c, 0x30, 0x07, 0x08, 0x09, 0x0b, 0x01, 0x18, 0x03,
+    0x04, 0x09, 0xb0, 0x01, 0x0e, 0x02, 0x0a, 0x13, 0x09, 0x1a, 0x14, 0x09,
+    0x12, 0x08, 0x19, 0x13, 0x0e, 0x24, 0x0f, 0x09, 0x11, 0x0d, 0x05, 0x28,
+    0x02, 0x08, 0x03, 0x1f, 0x64, 0x1b, 0x1d, 0x0c, 0x2b, 0x0b, 0x0a, 0x09,
+    0x07, 0x1d, 0x33, 0x03, 0x05, 0x0c, 0x0f, 0x09, 0x15, 0x2e, 0xe2, 0x03,
+    0x12, 0x0f, 0x0b, 0x51, 0x1d, 0x09, 0x08, 0x07, 0x06, 0xf0, 0x09, 0x1b,
+    0x09, 0x1f, 0xf1, 0x0b, 0x0a, 0x0b, 0x0e, 0x0b, 0x0c, 0x1e, 0x0a, 0x08,
+    0xf0, 0x3a, 0x0e, 0x71, 0x0a, 0x07, 0x09, 0x07, 0x06, 0x19, 0x0f, 0xf0,
+    0x0b, 0x0a, 0x19, 0xa0, 0x0a, 0x0b, 0x0c, 0x0f, 0x0b, 0x09, 0x08, 0x0b,
+    0x0e, 0x18, 0x11, 0x0b, 0xf0, 0x02, 0x09, 0x01, 0x1c, 0x20, 0x0b, 0x09,
+    0x21, 0x07, 0x09, 0x0b, 0x02, 0x18, 0x11, 0x0c, 0x22, 0x09, 0x0a, 0x0b,
+    0x11, 0x0f, 0x0e, 0xf0, 0x00, 0x0b, 0x01, 0x0c, 0x82, 0x0a, 0x07, 0x09,
+    0x18, 0x09, 0x0c, 0x0b, 0x19, 0x01, 0x10, 0x0c, 0x0b, 0x01, 0x08, 0x12,
+    0x07, 0x90, 0x0a, 0x13, 0x09, 0x0a, 0x01, 0x28, 0x02, 0x04, 0x03, 0x19,
+    0x04, 0x12, 0x0f, 0x0a, 0x41, 0x03, 0x09, 0x02, 0x0b, 0x03, 0x0d, 0x04,
+    0x0e, 0x15, 0x09, 0x52, 0x1b, 0x06, 0x08, 0x0d, 0x0a, 0x0e, 0x0d, 0x0f,
+    0x0e, 0x0a, 0x23, 0x0f, 0x0b, 0x0a, 0x0c, 0x0b, 0x09, 0x34, 0x0a, 0x0a,
+    0x07, 0x0e, 0x06, 0x0f, 0x0d, 0x0c, 0x15, 0x0f, 0x0d, 0x07, 0x0e, 0x14,
+    0x0f, 0x0b, 0x0c, 0x0d, 0x13, 0x06, 0x0a, 0x0a, 0x0d, 0x52, 0x07, 0x0a,
+    0x06, 0x09, 0x0a, 0x08, 0x0f, 0x07, 0x0d, 0x06, 0x0b, 0x08, 0x01, 0x05,
+    0x0c, 0xf0, 0x03, 0x1a, 0x09, 0x07, 0x09, 0x06, 0x0a, 0x04, 0x0c, 0x13,
+    0x0e, 0x19, 0x22, 0x08, 0x07, 0x01, 0x08, 0x50, 0x16, 0x04, 0x05, 0x04,
+    0xf0, 0x15, 0x01, 0x40, 0x17, 0x05, 0x03, 0x05, 0x01, 0x16, 0x03, 0x32,
+    0x28, 0x09, 0x03, 0x18, 0x02, 0x06, 0x0a, 0xf0, 0x05, 0x1b, 0x08, 0x0a,
+    0x0c, 0x07, 0x0d, 0x0a, 0x0c, 0x07, 0x2b, 0x04, 0x02, 0x03, 0x09, 0x34,
+    0x08, 0x0a, 0x0b, 0x0c, 0x03, 0x0d, 0x14, 0x1c, 0xf0, 0x05, 0x0a, 0x14,
+    0x0c, 0x0e, 0x15, 0x0a, 0x0b, 0x06, 0x0c, 0x09, 0x0e, 0x0e, 0x2d, 0x0a,
+    0x09, 0x0a, 0x1e, 0x0d, 0x07, 0x0d, 0x08, 0x0b, 0x06, 0x0a, 0x04, 0x1b,
+    0xf0, 0x02, 0x01, 0x0c, 0x12, 0x09, 0x08, 0x31, 0x0a, 0x28, 0xf0, 0x0d,
+    0x09, 0x0b, 0x19, 0x37, 0xf0, 0x08, 0x17, 0x06, 0x05, 0x14, 0x10, 0x05,
+    0x18, 0x01, 0x20, 0x09, 0x07, 0x16, 0x21, 0x09, 0x80, 0x28, 0x02, 0x03,
+    0x14, 0x1b, 0x05, 0x0c, 0x06, 0x0d, 0x17, 0x0f, 0x09, 0x21, 0x06, 0x0e,
+    0x07, 0x0f, 0x08, 0x09, 0x12, 0x17, 0x0c, 0x08, 0xb3, 0x0e, 0x1a, 0x07,
+    0x24, 0x0b, 0x0c, 0x0b, 0x05, 0x0a, 0x08, 0x0c, 0x2f, 0x0b, 0x0a, 0x09,
+    0x08, 0x08, 0x04, 0x0e, 0xb2, 0x03, 0x0a, 0x05, 0x08, 0x07, 0x06, 0x05,
+    0x05, 0x08, 0x04, 0x09, 0x03, 0x04, 0x12, 0x02, 0x04, 0x01, 0x0a, 0xb0,
+    0x0e, 0x0b, 0xb1, 0x14, 0x06, 0x07, 0x09, 0x08, 0x16, 0x08, 0x03, 0x11,
+    0x11, 0x10, 0x12, 0x00, 0x01, 0x01, 0x11, 0x03, 0x00, 0x00, 0x41, 0xd0,
+    0x11, 0x03, 0x04, 0x19, 0x22, 0x34, 0x03, 0x04, 0x05, 0x03, 0x08, 0x14,
+    0x0b, 0x0e, 0x09, 0x08, 0x31, 0x0d, 0x09, 0x0f, 0x0a, 0x05, 0x0d, 0x04,
+    0x09, 0x92, 0x0d, 0x1b, 0x0f, 0x04, 0x19, 0x03, 0x0b, 0x0a, 0x0a, 0x0b,
+    0x0f, 0x0d, 0x0b, 0x0b, 0x09, 0x09, 0x07, 0x0e, 0xf1, 0x25, 0x0c, 0x0e,
+    0x0a, 0x03, 0x0b, 0x22, 0x0a, 0x08, 0x06, 0x31, 0x07, 0x08, 0x07, 0x06,
+    0x12, 0x04, 0x12, 0x10, 0x11, 0x01, 0x01, 0x30, 0x13, 0x80, 0x04, 0x06,
+    0x01, 0x07, 0x12, 0x0b, 0x1d, 0x10, 0x0f, 0x03, 0x08, 0xf1, 0x06, 0x09,
+    0x09, 0x0a, 0x1f, 0x0e, 0x1c, 0x0e, 0x07, 0x1b, 0x0a, 0x0d, 0x2c, 0x0e,
+    0x08, 0x17, 0x1d, 0x06, 0x1b, 0x05, 0x04, 0x1a, 0x02, 0xf1, 0x11, 0x08,
+    0x06, 0x00, 0x08, 0x22, 0x17, 0x06, 0x20, 0x07, 0x05, 0x07, 0x01, 0x0a,
+    0x14, 0x09, 0x0b, 0x07, 0x0e, 0x14, 0x0d, 0x0b, 0x05, 0x19, 0x81, 0x06,
+    0x04, 0x17, 0x02, 0x01, 0x08, 0x70, 0x07, 0x0a, 0x0b, 0x0c, 0x09, 0x72,
+    0x1b, 0x0f, 0x61, 0x0a, 0x09, 0x0d, 0x0e, 0x0a, 0xa3, 0x0c, 0x0e, 0x02,
+    0x1a, 0x01, 0x04, 0x0b, 0x07, 0x29, 0x06, 0x05, 0x06, 0x1b, 0x0f, 0x0a,
+    0x0e, 0x12, 0x05, 0x09, 0x02, 0x0f, 0x31, 0x04, 0x0c, 0x15, 0x0b, 0x08,
+    0x04, 0x0d, 0xf0, 0x02, 0x0c, 0x11, 0x0f, 0x0e, 0x90, 0x1f, 0x0b, 0x18,
+    0x05, 0x14, 0x05, 0x04, 0x11, 0x02, 0x41, 0x00, 0xf0, 0x02, 0x03, 0x01,
+    0x03, 0x20, 0x05, 0x09, 0x03, 0x11, 0x05, 0x01, 0x02, 0x10, 0x23, 0x02,
+    0x08, 0x04, 0x12, 0x05, 0x17, 0x04, 0x60, 0x06, 0x09, 0x09, 0x0a, 0x07,
+    0x0b, 0x13, 0x0d, 0x0a, 0x02, 0x0e, 0x04, 0x07, 0x71, 0x07, 0x08, 0x18,
+    0x09, 0x1a, 0x04, 0x15, 0x0b, 0x0e, 0x19, 0x0d, 0x18, 0xa2, 0x0b, 0x06,
+    0x07, 0x03, 0x18, 0x05, 0x03, 0x0a, 0x02, 0x0c, 0x13, 0x0a, 0x0c, 0x04,
+    0x0d, 0x03, 0x0f, 0x32, 0x0a, 0x33, 0x1e, 0x0c, 0x03, 0x1b, 0x04, 0x07,
+    0x05, 0x1f, 0x0e, 0x36, 0x0b, 0x07, 0x07, 0x16, 0x04, 0x03, 0x35, 0x09,
+    0x02, 0x0a, 0x01, 0x08, 0xf0, 0x0e, 0x04, 0x0d, 0x03, 0x08, 0x02, 0x09,
+    0x41, 0x15, 0x02, 0x11, 0x90, 0x00, 0x13, 0x02, 0x04, 0x03, 0x02, 0x30,
+    0x04, 0x05, 0x13, 0xf1, 0x11, 0x07, 0x08, 0x02, 0x09, 0x03, 0x06, 0x05,
+    0x0e, 0x07, 0x0f, 0x0b, 0x05, 0x0d, 0x0b, 0x0e, 0x0a, 0x0d, 0x06, 0x0b,
+    0x05, 0x09, 0x14, 0x08, 0x09, 0x03, 0x28, 0x02, 0x81, 0x04, 0x03, 0x07,
+    0x11, 0x18, 0x00, 0x06, 0x12, 0x04, 0x13, 0x00, 0x21, 0x11, 0x12, 0x40,
+    0x13, 0x10, 0x04, 0x01, 0x05, 0x10, 0x08, 0x31, 0x06, 0x41, 0x17, 0x0c,
+    0x22, 0x09, 0x0b, 0x13, 0x0c, 0x03, 0x1a, 0x01, 0x14, 0x02, 0x0b, 0x14,
+    0x05, 0x0d, 0x06, 0x0e, 0x08, 0x09, 0x0c, 0x0d, 0x0c, 0x2d, 0x1f, 0x0f,
+    0x09, 0x06, 0x06, 0x1e, 0x0f, 0x05, 0x18, 0x04, 0x1c, 0x03, 0x0a, 0x02,
+    0x0b, 0x05, 0x11, 0x0c, 0x1c, 0x18, 0xf0, 0x08, 0x07, 0x09, 0x06, 0x16,
+    0x05, 0x04, 0x0b, 0x03, 0x0a, 0x12, 0x0b, 0x08, 0xa1, 0x0c, 0x08, 0x05,
+    0x0b, 0x06, 0x14, 0x08, 0x40, 0x03, 0x01, 0x00, 0x12, 0x13, 0x11, 0xf1,
+    0x01, 0x02, 0x02, 0x04, 0x03, 0x31, 0x04, 0x17, 0x28, 0x04, 0x02, 0x01,
+    0x1e, 0x02, 0x13, 0x1c, 0x02, 0x0d, 0x00, 0x0c, 0x02, 0x0d, 0x01, 0x00,
+    0x09, 0x22, 0x01, 0x0d, 0x00, 0x0e, 0x11, 0x07, 0x13, 0x19, 0x00, 0x14,
+    0x02, 0x0c, 0x01, 0x09, 0x55, 0x03, 0x0a, 0x01, 0x0e, 0x13, 0x0f, 0x0d,
+    0x0f, 0x0e, 0x0e, 0x0c, 0x04, 0x05, 0x0e, 0x13, 0x07, 0x0b, 0x06, 0x0f,
+    0x22, 0x04, 0x0d, 0x06, 0x0a, 0x07, 0x0f, 0x21, 0x03, 0x0c, 0x0b, 0x08,
+    0x04, 0x0b, 0xf0, 0x05, 0x09, 0x04, 0x07, 0x02, 0x15, 0x03, 0x02, 0x04,
+    0x24, 0x03, 0x02, 0x01, 0x06, 0xa0, 0x01, 0x12, 0x04, 0x02, 0x00, 0x02,
+    0xf0, 0x00, 0x02, 0x03, 0x05, 0x01, 0x0f, 0x02, 0x0a, 0x23, 0x0e, 0x16,
+    0x04, 0x07, 0x05, 0x0e, 0x17, 0x0a, 0x03, 0x09, 0x12, 0x0d, 0x09, 0x04,
+    0x0a, 0x10, 0x03, 0x0c, 0x01, 0x08, 0x21, 0x04, 0x0a, 0x13, 0x0f, 0x0a,
+    0x42, 0x0f, 0x0f, 0x06, 0x0a, 0x05, 0x09, 0x09, 0x08, 0x15, 0x0c, 0x31,
+    0x19, 0x03, 0x04, 0x07, 0x22, 0x0f, 0xf0, 0x0d, 0x1f, 0x13, 0x0d, 0x02,
+    0x1c, 0x03, 0x01, 0x09, 0x02, 0x0d, 0x06, 0x09, 0x12, 0x07, 0x09, 0x03,
+    0x08, 0x00, 0x07, 0x03, 0x35, 0x02, 0x03, 0xf0, 0x02, 0x00, 0x04, 0x02,
+    0x07, 0x05, 0x08, 0x34, 0x0a, 0x09, 0x0b, 0x0a, 0x02, 0x09, 0x01, 0x07,
+    0x02, 0x0a, 0x01, 0x0f, 0x07, 0x0d, 0x04, 0x09, 0x03, 0x0b, 0x04, 0x09,
+    0xc0, 0x03, 0x28, 0x0a, 0x04, 0x03, 0x27, 0x05, 0x04, 0x03, 0x18, 0x04,
+    0x02, 0x07, 0x13, 0x09, 0x0c, 0x02, 0x0f, 0x03, 0x07, 0x61, 0x05, 0x08,
+    0x04, 0x09, 0x03, 0x1c, 0x07, 0x08, 0x0d, 0x05, 0x0f, 0x0e, 0x0a, 0x32,
+    0x1d, 0x2b, 0x0f, 0x07, 0x0e, 0x61, 0x04, 0x1a, 0x23, 0x2b, 0x05, 0x0b,
+    0x08, 0x06, 0x0d, 0xf0, 0x04, 0x3e, 0x0a, 0x04, 0x03, 0x06, 0x0c, 0x0a,
+    0x0d, 0x08, 0x0b, 0x03, 0x0a, 0x04, 0x29, 0x06, 0x22, 0x0a, 0x09, 0x21,
+    0x0a, 0x09, 0x0d, 0xf0, 0x05, 0x0a, 0x0b, 0x08, 0x07, 0x17, 0x05, 0x0a,
+    0x18, 0x04, 0x03, 0x06, 0x02, 0x14, 0x03, 0x08, 0x03, 0x06, 0x12, 0x10,
+    0x11, 0x04, 0x03, 0x32, 0x04, 0xf0, 0x13, 0x06, 0x31, 0x05, 0x08, 0x09,
+    0x0f, 0x12, 0x09, 0x05, 0x13, 0x04, 0x00, 0x04, 0x02, 0x27, 0x04, 0x01,
+    0x02, 0x18, 0x01, 0x30, 0x40, 0x0b, 0x0c, 0x0e, 0x08, 0x71, 0x17, 0x31,
+    0x06, 0x0a, 0x09, 0x03, 0x0a, 0x12, 0x0c, 0x1a, 0x12, 0x13, 0x09, 0x13,
+    0x0f, 0x0a, 0x05, 0x0c, 0x62, 0x08, 0x0b, 0x0d, 0x09, 0x04, 0x18, 0x07,
+    0x09, 0x07, 0x06, 0x06, 0x09, 0x09, 0x01, 0x04, 0x0f, 0xf0, 0x05, 0x0e,
+    0x08, 0x0a, 0x09, 0x08, 0x05, 0x07, 0x02, 0x06, 0x00, 0x07, 0x01, 0x0a,
+    0x04, 0x09, 0x00, 0x0a, 0x14, 0x0c, 0x18, 0x01, 0x02, 0x09, 0x01, 0x0d,
+    0x13, 0x1f, 0xf0, 0x08, 0x0d, 0x0f, 0x0c, 0x05, 0x2a, 0x12, 0x24, 0x0b,
+    0x0c, 0x0d, 0x02, 0x0a, 0x01, 0x0c, 0x02, 0x1f, 0x11, 0x0c, 0x03, 0x1a,
+    0x07, 0x04, 0x09, 0xf0, 0x03, 0x0b, 0x06, 0x1a, 0x03, 0x06, 0x3c, 0x1f,
+    0x0d, 0x05, 0x0a, 0x04, 0x0d, 0x07, 0x0c, 0x09, 0x0d, 0x0a, 0x1f, 0x0f,
+    0x07, 0x0c, 0x16, 0x0b, 0x1c, 0xf0, 0x03, 0x05, 0x0a, 0x07, 0x1c, 0x06,
+    0x04, 0x1e, 0x05, 0x07, 0x0c, 0x02, 0x1e, 0x03, 0x0b, 0x0c, 0x03, 0x0a,
+    0x02, 0x1e, 0x03, 0x02, 0x1b, 0x03, 0x04, 0x09, 0xf0, 0x03, 0x1c, 0x05,
+    0x04, 0x2d, 0x02, 0x03, 0x14, 0x09, 0x08, 0x41, 0x0a, 0x08, 0x29, 0x02,
+    0x16, 0x01, 0x10, 0x05, 0x07, 0x80, 0x11, 0x05, 0x54, 0x00, 0x21, 0x00,
+    0x11, 0x03, 0x22, 0x61, 0x10, 0x01, 0x03, 0x10, 0x04, 0x13, 0x01, 0x03,
+    0x06, 0xf0, 0x10, 0x08, 0x06, 0x21, 0x08, 0x0a, 0x0c, 0x02, 0x0a, 0x09,
+    0x0b, 0x05, 0x1a, 0x03, 0x01, 0x0c, 0x03, 0x0e, 0x07, 0x0c, 0x03, 0x09,
+    0x06, 0x2b, 0x0f, 0x05, 0x50, 0x09, 0x0c, 0x05, 0x09, 0x03, 0x0a, 0x08,
+    0x1c, 0x06, 0x0a, 0x07, 0xa1, 0x05, 0x08, 0x02, 0x0a, 0x24, 0x0b, 0x0a,
+    0x1b, 0x0f, 0x08, 0x2a, 0x0e, 0x08, 0x04, 0x0c, 0x07, 0x09, 0xf2, 0x0f,
+    0x0b, 0x0e, 0x1a, 0x0f, 0x06, 0x19, 0x03, 0x04, 0x0a, 0x03, 0x09, 0x16,
+    0x0a, 0x0b, 0x0a, 0x0c, 0x0b, 0x2b, 0x06, 0x18, 0x0a, 0x12, 0x09, 0x0d,
+    0x22, 0x06, 0x0a, 0x0f, 0x0b, 0x0a, 0x0f, 0x41, 0x05, 0x0d, 0x03, 0x0e,
+    0x02, 0x0d, 0x04, 0x08, 0x12, 0x0b, 0x80, 0x19, 0x11, 0x18, 0x00, 0x01,
+    0x15, 0x02, 0x01, 0x13, 0x00, 0x01, 0x11, 0x11, 0xd0, 0x12, 0xf0, 0x41,
+    0x03, 0x14, 0x07, 0x08, 0x1c, 0x11, 0x0d, 0x03, 0x0e, 0x04, 0x0f, 0x00,
+    0x02, 0x19, 0x11, 0x13, 0x15, 0x02, 0x01, 0x63, 0x02, 0x07, 0x03, 0x0a,
+    0x09, 0x0d, 0x0f, 0x0f, 0x0b, 0x0b, 0x06, 0x08, 0x05, 0x0a, 0x12, 0x07,
+    0x09, 0x05, 0x1e, 0x51, 0x06, 0x07, 0x0b, 0x06, 0x19, 0x15, 0x08, 0x02,
+    0x0e, 0xf0, 0x01, 0x0d, 0x12, 0x19, 0x04, 0x08, 0x05, 0x07, 0x03, 0x16,
+    0x01, 0x00, 0x07, 0x01, 0x06, 0x10, 0x08, 0x09, 0x02, 0x08, 0x01, 0x19,
+    0x30, 0x06, 0x14, 0xf0, 0x01, 0x25, 0x03, 0x02, 0x11, 0x16, 0x00, 0x27,
+    0x01, 0x02, 0x21, 0x08, 0x0c, 0x08, 0x00, 0x0c, 0x02, 0x0e, 0x04, 0x0a,
+    0x03, 0x1c, 0x40, 0x05, 0x06, 0x0e, 0x0d, 0x1f, 0x09, 0x06, 0x09, 0x31,
+    0x0a, 0x0b, 0x19, 0x0e, 0x0f, 0x08, 0x09, 0x02, 0x0d, 0x07, 0x63, 0x08,
+    0x08, 0x06, 0x09, 0x0f, 0x0c, 0x0d, 0x0a, 0x05, 0x09, 0x06, 0x08, 0x15,
+    0x0b, 0x72, 0x0a, 0x06, 0x0b, 0x18, 0x0d, 0x0b, 0x03, 0x29, 0x07, 0x0f,
+    0x04, 0x3f, 0x81, 0x21, 0x02, 0x0d, 0x03, 0x19, 0x01, 0x32, 0x18, 0x0d,
+    0xf0, 0x0b, 0x03, 0x09, 0x04, 0x1b, 0x03, 0x02, 0x08, 0x11, 0x1a, 0x02,
+    0x1b, 0x07, 0x14, 0x0a, 0x2d, 0x15, 0x08, 0x0e, 0x17, 0x1c, 0xf0, 0x0a,
+    0x2e, 0x0f, 0x06, 0x07, 0x0c, 0x05, 0x0d, 0x03, 0x0b, 0x12, 0x08, 0x06,
+    0x01, 0x05, 0x00, 0x03, 0x11, 0x22, 0x02, 0x03, 0x01, 0x04, 0x30, 0x09,
+    0xf0, 0x05, 0x01, 0x00, 0x11, 0x01, 0x20, 0x32, 0x01, 0x10, 0x05, 0x06,
+    0x01, 0x27, 0x00, 0x01, 0x02, 0x08, 0x01, 0x0c, 0x22, 0x0f, 0x00, 0x19,
+    0x21, 0x03, 0x0a, 0x04, 0x06, 0xa2, 0x05, 0x08, 0x0c, 0x09, 0x09, 0x0a,
+    0x0e, 0x1c, 0x0f, 0x07, 0x1e, 0x2f, 0x0f, 0x0c, 0x0b, 0x08, 0x25, 0x0e,
+    0x31, 0x0a, 0x08, 0x16, 0x06, 0x0a, 0xf0, 0x04, 0x09, 0x05, 0x1a, 0x04,
+    0x31, 0x1d, 0x19, 0x03, 0x08, 0x02, 0x06, 0x01, 0x07, 0x02, 0x18, 0x41,
+    0x06, 0x07, 0x08, 0x0b, 0xe0, 0x02, 0x0a, 0x41, 0x0b, 0x09, 0x08, 0x06,
+    0x07, 0x03, 0x38, 0x02, 0x00, 0x12, 0x0a, 0x04, 0x0c, 0x03, 0x0b, 0x00,
+    0x0e, 0x01, 0x07, 0xf1, 0x03, 0x08, 0x07, 0x07, 0x0b, 0x28, 0x07, 0x03,
+    0x04, 0x1a, 0x06, 0x04, 0x1c, 0x05, 0x06, 0x0e, 0x07, 0x1c, 0x08, 0x07,
+    0x0e, 0x08, 0x0c, 0x07, 0x0e, 0x0e, 0x0a, 0x12, 0x0f, 0x0c, 0x08, 0x08,
+    0x23, 0x06, 0x0b, 0x03, 0x0d, 0x06, 0x0a, 0x14, 0x07, 0x0d, 0x05, 0x0e,
+    0x45, 0x0f, 0x1f, 0x0c, 0x05, 0x0e, 0x04, 0x0d, 0x03, 0x0e, 0x04, 0x02,
+    0x0f, 0x23, 0x03, 0x1b, 0x22, 0x0f, 0x32, 0x0d, 0x11, 0x0e, 0x09, 0x60,
+    0x0c, 0x21, 0x07, 0x08, 0x0a, 0xf0, 0x08, 0x06, 0x04, 0x11, 0x03, 0x02,
+    0x30, 0x03, 0x22, 0x01, 0x01, 0x05, 0x60, 0x04, 0x07, 0x09, 0x07, 0x05,
+    0xf0, 0x04, 0x03, 0x11, 0x14, 0x02, 0x02, 0x03, 0x01, 0x04, 0x00, 0x26,
+    0x01, 0x02, 0x41, 0x07, 0x08, 0x0a, 0x0d, 0x0c, 0x00, 0x09, 0x01, 0x2b,
+    0xf0, 0x07, 0x06, 0x04, 0x09, 0x12, 0x08, 0x0a, 0x06, 0x1b, 0x14, 0x0e,
+    0x0a, 0x1d, 0x09, 0x08, 0x1c, 0x06, 0x05, 0x1a, 0x06, 0x1e, 0x3c, 0x30,
+    0x0c, 0x08, 0x04, 0x0d, 0x06, 0x08, 0xf1, 0x0a, 0x09, 0x27, 0x0a, 0x0b,
+    0x0d, 0x15, 0x1c, 0x09, 0x0e, 0x0c, 0x1c, 0x0d, 0x04, 0x0a, 0x02, 0x0d,
+    0x05, 0x0a, 0x24, 0x09, 0x18, 0x05, 0x19, 0xf1, 0x12, 0x08, 0x03, 0x09,
+    0x02, 0x0b, 0x04, 0x1d, 0x02, 0x11, 0x0c, 0x0b, 0x02, 0x09, 0x31, 0x0a,
+    0x08, 0x0a, 0x1c, 0x03, 0x12, 0x09, 0x07, 0x01, 0x21, 0x0c, 0xf0, 0x1b,
+    0x10, 0x0f, 0x0a, 0x01, 0x08, 0x03, 0x07, 0x31, 0x08, 0x07, 0x09, 0x0a,
+    0x00, 0x0e, 0x01, 0x0d, 0x00, 0x09, 0x11, 0x08, 0x0a, 0x40, 0x08, 0xd0,
+    0x0a, 0x09, 0x15, 0x01, 0x13, 0x00, 0x01, 0x24, 0x00, 0x01, 0x30, 0x03,
+    0x05, 0x13, 0x01, 0x01, 0x31, 0x00, 0x50, 0x03, 0x02, 0x11, 0x02, 0x03,
+    0x12, 0x04, 0x21, 0x03, 0x03, 0x44, 0x04, 0x22, 0x02, 0x03, 0x04, 0x03,
+    0x33, 0x06, 0x04, 0x07, 0x13, 0x09, 0x1a, 0x04, 0x04, 0x03, 0x25, 0x09,
+    0x15, 0x0b, 0x0d, 0x16, 0x06, 0x0e, 0x17, 0x1c, 0x05, 0x14, 0x08, 0x0d,
+    0x1b, 0x0e, 0x07, 0x2f, 0x0a, 0x0d, 0x1f, 0x1f, 0x0e, 0x07, 0x0d, 0x0c,
+    0x05, 0x0b, 0x0a, 0x06, 0x0c, 0x08, 0x15, 0x0b, 0x07, 0x0d, 0x06, 0x04,
+    0x0b, 0x05, 0x03, 0x29, 0x04, 0x02, 0x03, 0x03, 0x22, 0x22, 0x08, 0x06,
+    0x08, 0x21, 0x01, 0x09, 0x10, 0x08, 0x0a, 0xf0, 0x01, 0x26, 0x00, 0x21,
+    0x07, 0x0a, 0x40, 0x0e, 0x1f, 0x09, 0x07, 0x31, 0x09, 0x0d, 0x09, 0x0b,
+    0x00, 0x0f, 0x11, 0x0a, 0xe0, 0x19, 0x12, 0x08, 0x03, 0x0a, 0x04, 0x09,
+    0x06, 0x0b, 0x09, 0x0a, 0x05, 0x0b, 0x23, 0x0c, 0x0a, 0x0b, 0x12, 0x0e,
+    0x0a, 0x01, 0x0b, 0x02, 0x06, 0xf1, 0x01, 0x17, 0x02, 0x03, 0x08, 0x05,
+    0x0a, 0x14, 0x09, 0x0c, 0x05, 0x0d, 0x09, 0x0c, 0x2f, 0x0d, 0x0f, 0x1e,
+    0x04, 0x15, 0x0c, 0x0a, 0x06, 0x09, 0x04, 0x0f, 0xf0, 0x06, 0x2d, 0x15,
+    0x07, 0x0c, 0x03, 0x1d, 0x04, 0x05, 0x4a, 0x13, 0x04, 0x13, 0x0d, 0x04,
+    0x0a, 0x13, 0x0c, 0x19, 0x04, 0xf0, 0x03, 0x18, 0x14, 0x19, 0x13, 0x0a,
+    0x02, 0x0e, 0x03, 0x0c, 0x22, 0x0a, 0x0d, 0x0e, 0x23, 0x0b, 0x0a, 0x0c,
+    0x04, 0x1e, 0x03, 0x04, 0x0c, 0x90, 0x06, 0x1a, 0x03, 0x02, 0x07, 0x14,
+    0x16, 0x02, 0x25, 0x11, 0x00, 0x06, 0x01, 0x12, 0x11, 0xd0, 0x04, 0xe0,
+    0x05, 0x04, 0x53, 0x04, 0x33, 0x21, 0x02, 0x21, 0xf1, 0x02, 0x01, 0x00,
+    0x02, 0x11, 0x23, 0x12, 0x04, 0x11, 0x16, 0x32, 0x08, 0x0a, 0x0d, 0x1c,
+    0x11, 0x0f, 0x00, 0x0b, 0x72, 0x31, 0x0c, 0x0a, 0x0d, 0x1b, 0x02, 0x13,
+    0x09, 0x0d, 0x04, 0x08, 0x33, 0x06, 0x0a, 0x04, 0x0b, 0x07, 0x0e, 0x0f,
+    0x0b, 0x44, 0x0a, 0x1c, 0x0b, 0x07, 0x0d, 0x0e, 0x0f, 0x07, 0x0c, 0x05,
+    0x06, 0x2a, 0x06, 0x08, 0x57, 0x0e, 0x05, 0x1b, 0x04, 0x07, 0x0c, 0x0f,
+    0x0e, 0x16, 0x0b, 0x16, 0x09, 0x0f, 0x1d, 0x05, 0x0e, 0x04, 0x06, 0x0e,
+    0x13, 0x05, 0x0b, 0x0a, 0x0d, 0x12, 0x05, 0x09, 0x24, 0x0f, 0x81, 0x0b,
+    0x0a, 0x01, 0x49, 0x40, 0x08, 0x01, 0x0b, 0xf0, 0x12, 0x09, 0x1c, 0x11,
+    0x09, 0x10, 0x07, 0x14, 0x01, 0x02, 0x03, 0x40, 0x14, 0x23, 0x01, 0x12,
+    0x10, 0x11, 0xf0, 0x02, 0x04, 0x40, 0x06, 0x09, 0x0a, 0x27, 0x11, 0x05,
+    0x12, 0x0a, 0x05, 0x33, 0x06, 0x04, 0x06, 0x08, 0x04, 0x07, 0x05, 0x40,
+    0x09, 0x06, 0x08, 0x08, 0x16, 0x0c, 0x0f, 0x08, 0x09, 0x71, 0x1f, 0x1c,
+    0x0a, 0x0a, 0x0c, 0x09, 0x0f, 0x08, 0x0d, 0x17, 0x0e, 0x06, 0x0e, 0xf0,
+    0x04, 0x0f, 0x06, 0x0d, 0x05, 0x1c, 0x14, 0x0a, 0x03, 0x09, 0x02, 0x0b,
+    0x03, 0x0a, 0x12, 0x09, 0x0d, 0x11, 0x0c, 0x0f, 0x02, 0x0b, 0x01, 0x0f,
+    0x22, 0x0b, 0x0d, 0xf0, 0x0b, 0x61, 0x0e, 0x0c, 0x08, 0x09, 0x0d, 0x1e,
+    0x12, 0x1a, 0x03, 0x08, 0x12, 0x0a, 0x09, 0x11, 0x2b, 0x12, 0xd0, 0x0d,
+    0x03, 0x0c, 0x02, 0x0d, 0x13, 0x0a, 0x08, 0x04, 0x3a, 0x05, 0x06, 0x05,
+    0x03, 0x0e, 0x06, 0x0d, 0x0d, 0x0e, 0x09, 0x0f, 0x0d, 0x08, 0x51, 0x0b,
+    0x09, 0x09, 0x0a, 0x0e, 0x0c, 0x08, 0x0d, 0x07, 0x0f, 0x08, 0x0b, 0x42,
+    0x0f, 0x0e, 0x09, 0x0b, 0x08, 0x09, 0x0a, 0x08, 0x08, 0x0c, 0x51, 0x07,
+    0x19, 0x04, 0x03, 0x18, 0x02, 0x03, 0x06, 0x02, 0x0e, 0xf0, 0x61, 0x0c,
+    0x0e, 0x1b, 0x18, 0x16, 0x20, 0x07, 0x1a, 0x61, 0x09, 0x0b, 0x09, 0x07,
+    0x09, 0xf0, 0x0c, 0x22, 0x08, 0x19, 0x13, 0x08, 0x19, 0x42, 0x0a, 0x08,
+    0x0a, 0x08, 0x13, 0x07, 0x08, 0x02, 0x19, 0x03, 0x15, 0x0a, 0x90, 0x0d,
+    0x14, 0x0f, 0x0e, 0x03, 0x0a, 0x04, 0x09, 0x03, 0x0d, 0x34, 0x0c, 0x0b,
+    0x0e, 0x07, 0xb1, 0x05, 0x28, 0x07, 0x06, 0x05, 0x09, 0x07, 0x0a, 0x0f,
+    0x3c, 0x08, 0x07, 0x05, 0x06, 0x0a, 0x07, 0x08, 0x05, 0x0e, 0xf0, 0x12,
+    0x0c, 0x1f, 0x14, 0x0b, 0x03, 0x0a, 0x12, 0x1c, 0x11, 0x08, 0x0a, 0x02,
+    0x0f, 0x01, 0x0e, 0xa0, 0x0c, 0x28, 0x09, 0x40, 0x07, 0x25, 0x02, 0x11,
+    0x01, 0x02, 0x13, 0x80, 0x03, 0x10, 0x04, 0x06, 0x21, 0x17, 0x0a, 0x02,
+    0x08, 0x01, 0x0e, 0x02, 0x09, 0xf1, 0x05, 0x1c, 0x06, 0x05, 0x0b, 0x0c,
+    0x0d, 0x0f, 0x0f, 0x09, 0x0d, 0x06, 0x1b, 0x04, 0x06, 0x2c, 0x08, 0x07,
+    0x06, 0x0e, 0x05, 0x0d, 0x02, 0x0e, 0x01, 0x0f, 0x02, 0x0e, 0xf1, 0x05,
+    0x0a, 0x03, 0x09, 0x00, 0x0a, 0x01, 0x0c, 0x02, 0x09, 0x11, 0x18, 0x12,
+    0x0b, 0x09, 0x61, 0x08, 0x19, 0x08, 0x0c, 0x0f, 0x0b, 0xf1, 0x42, 0x08,
+    0x19, 0x0c, 0x0b, 0x10, 0x0e, 0x0c, 0x71, 0x08, 0x17, 0x09, 0x0a, 0x08,
+    0x16, 0x12, 0x05, 0xf1, 0x16, 0x01, 0x10, 0x38, 0x21, 0x0a, 0x32, 0x0b,
+    0x09, 0x0a, 0x19, 0x24, 0x0a, 0x19, 0x0c, 0x09, 0x48, 0xf1, 0x06, 0x17,
+    0x0b, 0x0d, 0x29, 0x0a, 0x0b, 0x0f, 0x28, 0x09, 0x06, 0x08, 0x29, 0x0c,
+    0x19, 0x08, 0x0a, 0x07, 0x06, 0x16, 0x11, 0x0c, 0x08, 0x0c, 0xf0, 0x04,
+    0x0b, 0x05, 0x0e, 0x06, 0x0c, 0x05, 0x0a, 0x14, 0x0c, 0x19, 0x32, 0x08,
+    0x0a, 0x09, 0x31, 0x08, 0x17, 0x06, 0x12, 0x28, 0xf0, 0x01, 0x10, 0x09,
+    0x0c, 0x01, 0x09, 0x30, 0x0d, 0x09, 0x06, 0x08, 0x11, 0x07, 0x06, 0x80,
+    0x18, 0x0a, 0x0e, 0x0f, 0x09, 0xf0, 0x08, 0x09, 0x0d, 0x01, 0x0b, 0x50,
+    0x0f, 0x0b, 0x0a, 0x0f, 0x0e, 0x0b, 0x11, 0x0c, 0x07, 0x02, 0x18, 0x25,
+    0x09, 0x0a, 0x60, 0x14, 0x19, 0x02, 0x07, 0x01, 0x06, 0x30, 0x08, 0x0c,
+    0x08, 0x61, 0x0b, 0x11, 0x08, 0x0a, 0x12, 0x08, 0x0c, 0x03, 0x0f, 0x14,
+    0x0b, 0x22, 0x0d, 0x03, 0x0f, 0x06, 0x0b, 0x13, 0x09, 0x0e, 0x0f, 0x0c,
+    0x74, 0x0e, 0x0d, 0x07, 0x0e, 0x0f, 0x0f, 0x09, 0x0d, 0x07, 0x0c, 0x0f,
+    0x0a, 0x0c, 0x08, 0x09, 0x09, 0x03, 0x07, 0x0e, 0x22, 0x05, 0x0b, 0x24,
+    0x0a, 0x0e, 0x31, 0x0a, 0x03, 0x08, 0x12, 0x07, 0x0b, 0xf0, 0x03, 0x18,
+    0x02, 0x31, 0x09, 0x0e, 0x0a, 0x0c, 0x02, 0x08, 0x01, 0x09, 0x00, 0x0b,
+    0x21, 0x09, 0x0b, 0x09, 0x12, 0x07, 0x08, 0x01, 0x07, 0x00, 0x1a, 0xf0,
+    0x01, 0x10, 0x1f, 0x02, 0x0c, 0x23, 0x1b, 0x0c, 0x16, 0x1a, 0x08, 0x1b,
+    0x07, 0x0a, 0x2c, 0x0f, 0x09, 0x0f, 0x0e, 0x07, 0x0c, 0xf0, 0x0c, 0x0d,
+    0x0f, 0x0e, 0x06, 0x0c, 0x05, 0x0d, 0x12, 0x0c, 0x0f, 0x06, 0x0c, 0x03,
+    0x1b, 0x14, 0x09, 0x03, 0x08, 0x06, 0x09, 0x23, 0x0b, 0x0e, 0x0d, 0x01,
+    0x0a, 0xf0, 0x13, 0x08, 0x09, 0x12, 0x1b, 0x01, 0x08, 0x02, 0x0c, 0x03,
+    0x0a, 0x04, 0x09, 0x03, 0x0b, 0x01, 0x0a, 0x32, 0x08, 0x0a, 0x0e, 0x1b,
+    0x01, 0x30, 0x0d, 0xf0, 0x09, 0x0a, 0x0b, 0x41, 0x08, 0x0c, 0x09, 0x08,
+    0x07, 0x02, 0x08, 0x01, 0x0a, 0x20, 0x0e, 0x38, 0x31, 0x0a, 0xf0, 0x0e,
+    0x02, 0x0d, 0x04, 0x1b, 0x07, 0x06, 0x0d, 0x14, 0x0e, 0x0b, 0x06, 0x0d,
+    0x09, 0x0e, 0x07, 0x0b, 0x06, 0x19, 0x04, 0x03, 0x08, 0x02, 0x0a, 0x13,
+    0x18, 0xf0, 0x62, 0x17, 0x0a, 0x1e, 0x0d, 0x0e, 0x13, 0x2b, 0x02, 0x01,
+    0x0d, 0x20, 0x0e, 0x07, 0x39, 0x01, 0x32, 0xf0, 0x07, 0x19, 0x13, 0x0a,
+    0x04, 0x09, 0x03, 0x1e, 0x14, 0x0d, 0x03, 0x0a, 0x04, 0x19, 0x46, 0x0a,
+    0x0b, 0x0c, 0x0b, 0x40, 0x09, 0x1a, 0x18, 0x1d, 0x09, 0x08, 0x27, 0x41,
+    0x1a, 0x08, 0x08, 0x07, 0x0b, 0x08, 0x07, 0x82, 0x0b, 0x08, 0x0f, 0x4a,
+    0x0b, 0x09, 0x0c, 0x0d, 0x0a, 0x09, 0x07, 0x07, 0x05, 0x0b, 0x31, 0x14,
+    0x0d, 0x0a, 0x05, 0x08, 0x04, 0x0e, 0xf0, 0x13, 0x0b, 0x0c, 0x02, 0x29,
+    0x41, 0x0b, 0x08, 0x07, 0x30, 0x09, 0x07, 0x06, 0x15, 0xa1, 0x16, 0x18,
+    0xf0, 0x19, 0x1b, 0x09, 0x0c, 0x02, 0x19, 0x03, 0x12, 0x0d, 0x0c, 0x03,
+    0x1a, 0x34, 0x08, 0x09, 0x0a, 0xf0, 0x33, 0x0d, 0x0f, 0x0e, 0x0b, 0x02,
+    0x0d, 0x03, 0x09, 0x22, 0x0a, 0x08, 0x0a, 0x61, 0x0d, 0x0e, 0x0b, 0x07,
+    0x08, 0x0b, 0x0a, 0xe0, 0x22, 0x09, 0x0a, 0x39, 0x34, 0x08, 0x13, 0x09,
+    0x0b, 0x04, 0x1a, 0x05, 0x06, 0x0b, 0x05, 0x1e, 0x07, 0x0a, 0x08, 0x41,
+    0x0e, 0x1a, 0x0f, 0x0a, 0x09, 0x0d, 0x08, 0x1c, 0x0f, 0xf0, 0x0d, 0x0e,
+    0x0e, 0x0d, 0x0c, 0x08, 0x0b, 0x16, 0x0c, 0x0e, 0x07, 0x1b, 0x05, 0x14,
+    0x0e, 0x0d, 0x15, 0x0a, 0x1d, 0x14, 0x0e, 0x13, 0x1b, 0xf0, 0x05, 0x09,
+    0x03, 0x1a, 0x72, 0x09, 0x08, 0x27, 0x08, 0x09, 0xe1, 0x0e, 0x0c, 0x0a,
+    0x0c, 0x0b, 0x09, 0xf0, 0x07, 0x06, 0x15, 0x07, 0x28, 0x0b, 0x52, 0x08,
+    0x09, 0x0b, 0x0a, 0x09, 0x0b, 0x33, 0x0a, 0xf0, 0x09, 0x18, 0x02, 0x0c,
+    0x03, 0x1a, 0x02, 0x23, 0x09, 0x0c, 0x19, 0x04, 0x03, 0x18, 0x82, 0x07,
+    0x0a, 0x1b, 0xf0, 0x08, 0x09, 0x1a, 0x03, 0x09, 0x04, 0x2b, 0x15, 0x17,
+    0x2c, 0x18, 0x0b, 0x07, 0x0c, 0x36, 0x0b, 0x0a, 0x09, 0xf0, 0x1a, 0x15,
+    0x09, 0x14, 0x1b, 0x05, 0x0d, 0x04, 0x0b, 0x06, 0x0c, 0x08, 0x0b, 0x06,
+    0x0a, 0x15, 0x0b, 0x1a, 0x04, 0x03, 0x09, 0x04, 0x08, 0x23, 0x09, 0xf0,
+    0x0b, 0x09, 0x62, 0x1a, 0x18, 0x07, 0x19, 0x21, 0x0b, 0x09, 0x0e, 0x32,
+    0x0c, 0x4a, 0xf0, 0x13, 0x02, 0x0e, 0x13, 0x1f, 0x44, 0x0b, 0x1c, 0x0d,
+    0x0e, 0x15, 0x0c, 0x0b, 0x34, 0x07, 0x56, 0xf0, 0x15, 0x04, 0x12, 0x08,
+    0x07, 0x21, 0x19, 0x0c, 0x12, 0x0a, 0x0b, 0x51, 0x0c, 0x19, 0x0c, 0x1f,
+    0xf0, 0x02, 0x0c, 0x53, 0x09, 0x0a, 0x0d, 0x0b, 0x08, 0x1a, 0x25, 0x0c,
+    0x0b, 0x04, 0x0e, 0x25, 0x1c, 0x0e, 0x07, 0x0c, 0x08, 0x1d, 0xf0, 0x09,
+    0x0f, 0x0e, 0x0d, 0x0d, 0x1f, 0x3e, 0x0a, 0x08, 0x15, 0x0b, 0x0c, 0x16,
+    0x0a, 0x0b, 0x05, 0x2c, 0x04, 0x02, 0x01, 0x0f, 0x12, 0x1e, 0xf0, 0x51,
+    0x0f, 0x0e, 0x2f, 0x0a, 0x12, 0x09, 0x0a, 0x33, 0x08, 0x09, 0x1b, 0x02,
+    0x0d, 0x03, 0x0f, 0x06, 0x0d, 0xf0, 0x07, 0x0e, 0x06, 0x0d, 0x15, 0x0c,
+    0x1a, 0x06, 0x15, 0x0b, 0x39, 0x16, 0x04, 0x03, 0x1a, 0x04, 0x05, 0x0c,
+    0x04, 0x1e, 0x23, 0x0c, 0xf0, 0x0e, 0x04, 0x0b, 0x63, 0x0e, 0x09, 0x0a,
+    0x0b, 0x19, 0x08, 0x42, 0x1d, 0x0e, 0x09, 0x08, 0x11, 0x09, 0x0b, 0xf0,
+    0x02, 0x09, 0x31, 0x0e, 0x0f, 0x0d, 0x09, 0x10, 0x0f, 0x0e, 0x81, 0x0c,
+    0x0e, 0x08, 0x17, 0x18, 0x07, 0x0a, 0xf0, 0x12, 0x09, 0x08, 0x31, 0x0b,
+    0x1e, 0x0c, 0x02, 0x28, 0x13, 0x02, 0x1a, 0x43, 0x0b, 0x0a, 0x0c, 0x09,
+    0x14, 0x08, 0xf0, 0x0a, 0x55, 0x0b, 0x0c, 0x0d, 0x1a, 0x0d, 0x06, 0x0e,
+    0x07, 0x0c, 0x06, 0x0a, 0x15, 0x0c, 0x0d, 0x47, 0x1b, 0x0c, 0x0d, 0xf0,
+    0x1b, 0x08, 0x09, 0x0c, 0x08, 0x0b, 0x06, 0x1a, 0x05, 0x44, 0x0b, 0x0c,
+    0x0d, 0x0b, 0x09, 0x03, 0x0b, 0x42, 0x0d, 0x09, 0x07, 0x0b, 0xf0, 0x0d,
+    0xe1, 0x0e, 0x1a, 0x09, 0x0a, 0x0b, 0x0a, 0x0b, 0x0e, 0x08, 0x0a, 0x0e,
+    0x0a, 0x09, 0x0b, 0xf0, 0x02, 0x19, 0x33, 0x0a, 0x1b, 0x32, 0x1c, 0x0e,
+    0x2f, 0x23, 0x0b, 0x04, 0x0a, 0x05, 0x19, 0x16, 0x0a, 0xf0, 0x07, 0x09,
+    0x06, 0x1b, 0x17, 0x3c, 0x75, 0x0d, 0x1c, 0x0e, 0x0a, 0x04, 0x0c, 0x23,
+    0x1b, 0x0a, 0xf0, 0x14, 0x08, 0x09, 0x03, 0x0a, 0x02, 0x0d, 0x03, 0x08,
+    0x34, 0x07, 0x06, 0x05, 0x04, 0x26, 0xb3, 0x35, 0xf0, 0x07, 0x0b, 0x0e,
+    0x0c, 0x0d, 0x0b, 0x04, 0x2a, 0x25, 0x1d, 0xd4, 0x1c, 0x0a, 0x0c, 0x0b,
+    0xf0, 0x09, 0x0c, 0x0f, 0x0e, 0x0a, 0x09, 0x0c, 0x2a, 0xa5, 0x0d, 0x09,
+    0x0a, 0x0e, 0x0a, 0x0b, 0xf0, 0x1a, 0x0d, 0x04, 0x0f, 0x43, 0x1e, 0x18,
+    0x0d, 0xf2, 0x0b, 0x07, 0x06, 0x08, 0x07, 0x08, 0x09, 0xf0, 0x08, 0x07,
+    0x08, 0x07, 0x06, 0x05, 0x07, 0x0b, 0x08, 0x42, 0x0b, 0x0d, 0x09, 0x0c,
+    0x0b, 0x83, 0x0a, 0x09, 0xf0, 0x0a, 0x0d, 0x0a, 0x08, 0x09, 0x08, 0x0a,
+    0xf2, 0x0d, 0x0f, 0x0e, 0x0a, 0x08, 0x0a, 0x06, 0x07, 0x08, 0xf0, 0x0a,
+    0x0f, 0x1b, 0x1a, 0x08, 0x92, 0x07, 0x0b, 0x0e, 0x0a, 0x28, 0x0a, 0x0d,
+    0xf0, 0x19, 0x33, 0x0a, 0x0d, 0x0a, 0x94, 0x09, 0x0a, 0x0e, 0x0f, 0x0e,
+    0x0c, 0x0a, 0x0c, 0x0a, 0x0d, 0x73, 0x0c, 0xf0, 0x0e, 0x0a, 0x08, 0x0a,
+    0x07, 0x1b, 0x14, 0x07, 0x09, 0x05, 0x0a, 0x06, 0x09, 0x17, 0x0d, 0x0b,
+    0x08, 0x0c, 0x09, 0x0a, 0x0b, 0x0e, 0x1d, 0xf0, 0x0a, 0x0c, 0x5f, 0x0b,
+    0x0c, 0x0f, 0x0d, 0x08, 0x17, 0x0d, 0x0c, 0x16, 0x0d, 0x0a, 0x44, 0x0b,
+    0x0a, 0x09, 0x07, 0x06, 0xf0, 0x13, 0x07, 0x06, 0x02, 0x07, 0x81, 0x0a,
+    0x1b, 0x0a, 0x0b, 0x0e, 0x0f, 0x0e, 0x0f, 0x22, 0x0c, 0x09, 0x48, 0x23,
+    0xf0, 0x04, 0x03, 0x07, 0x02, 0x08, 0x03, 0x09, 0x24, 0x08, 0x3a, 0x03,
+    0x22, 0x0d, 0x0e, 0x13, 0x0a, 0x09, 0x22, 0x0b, 0xf0, 0x0e, 0x09, 0x11,
+    0x0e, 0x0d, 0x12, 0x0a, 0x08, 0x31, 0x0b, 0x0e, 0x0b, 0x0a, 0x02, 0x08,
+    0x41, 0x09, 0x28, 0x0b, 0xf0, 0x02, 0x19, 0x03, 0x24, 0x08, 0x0a, 0x09,
+    0x06, 0x38, 0x07, 0x06, 0x35, 0x0a, 0x0b, 0x0c, 0x16, 0x0a, 0x09, 0x0c,
+    0x08, 0x1d, 0xb7, 0xf0, 0x0c, 0x0b, 0x09, 0x0b, 0x09, 0x08, 0x0a, 0x07,
+    0x08, 0x09, 0x1b, 0x06, 0x25, 0x0d, 0x1c, 0x84, 0xf0, 0x0d, 0x0f, 0x1a,
+    0x0e, 0x0d, 0x09, 0x08, 0x0b, 0x83, 0x08, 0x07, 0x08, 0x09, 0x08, 0x1b,
+    0xf0, 0x08, 0x0d, 0xb2, 0x0b, 0x1f, 0x0d, 0x0b, 0x19, 0x0a, 0x0c, 0x08,
+    0x0a, 0x0e, 0xf1, 0x09, 0x08, 0xf0, 0x0e, 0x0b, 0x0a, 0x0c, 0x19, 0x06,
+    0x27, 0x15, 0x16, 0x61, 0x07, 0x09, 0xf0, 0x08, 0x06, 0x08, 0x0d, 0x39,
+    0x62, 0x0f, 0x0c, 0x0e, 0x0a, 0x23, 0x0f, 0x08, 0x07, 0x44, 0x09, 0xf0,
+    0x08, 0x2a, 0x55, 0x07, 0x09, 0x08, 0x09, 0x0a, 0x0b, 0x16, 0x09, 0x08,
+    0x27, 0x07, 0x06, 0x15, 0x18, 0xf0, 0x16, 0x19, 0x07, 0x28, 0x05, 0x06,
+    0x34, 0x09, 0x2a, 0x25, 0x0b, 0x0d, 0x4b, 0x06, 0x08, 0x16, 0xf0, 0x07,
+    0x1c, 0x08, 0x07, 0x0b, 0x0d, 0x0c, 0x18, 0x0e, 0x1d, 0x0a, 0x07, 0x1e,
+    0x14, 0x0d, 0x16, 0x0e, 0x0c, 0x05, 0x0b, 0x04, 0x0e, 0x25, 0x0d, 0x0a,
+    0xf0, 0x09, 0x04, 0x08, 0x25, 0x27, 0x06, 0x26, 0x05, 0x04, 0x03, 0x17,
+    0x04, 0x03, 0x19, 0x42, 0x0a, 0x0b, 0x38, 0xf0, 0x23, 0x09, 0x05, 0x0a,
+    0x06, 0x19, 0x05, 0x03, 0x0a, 0x14, 0x09, 0x0c, 0x13, 0x1d, 0x24, 0x0b,
+    0x0d, 0x0c, 0x03, 0x1b, 0x02, 0xf0, 0x14, 0x0a, 0x49, 0x15, 0x24, 0x08,
+    0x02, 0x0a, 0x11, 0x0d, 0x0f, 0x02, 0x0d, 0x03, 0x0a, 0x02, 0x09, 0x81,
+    0x0c, 0x0d, 0x0e, 0xf0, 0x0c, 0x0b, 0x0a, 0x0e, 0x0d, 0x0a, 0x10, 0x0e,
+    0x09, 0x01, 0x08, 0x02, 0x06, 0x31, 0x07, 0x0a, 0x1b, 0x12, 0x08, 0x0a,
+    0xf0, 0x03, 0x09, 0x14, 0x08, 0x37, 0x03, 0x05, 0x74, 0x09, 0x2a, 0x0c,
+    0x1e, 0x15, 0x0d, 0x0b, 0x06, 0x1c, 0xf0, 0x04, 0x05, 0x0b, 0x07, 0x1c,
+    0x08, 0x07, 0x2b, 0x06, 0x05, 0x04, 0x0c, 0x13, 0x0d, 0x0c, 0x15, 0x1e,
+    0x03, 0x0f, 0x32, 0x0e, 0x0d, 0x1c, 0xf0, 0x13, 0x19, 0x62, 0x0c, 0x0d,
+    0x19, 0x0d, 0x0f, 0x0d, 0x13, 0x18, 0x12, 0x19, 0x31, 0x0d, 0x0a, 0xf0,
+    0x09, 0x08, 0xc0, 0x0a, 0x0e, 0x0d, 0x0e, 0x09, 0x08, 0x0a, 0x09, 0x1a,
+    0x09, 0x06, 0x07, 0x01, 0x06, 0xd0, 0x12, 0x07, 0x08, 0x01, 0x0c, 0x00,
+    0x09, 0x01, 0x2a, 0x23, 0x09, 0x04, 0x0c, 0x06, 0x1b, 0x08, 0x07, 0x1c,
+    0x05, 0x06, 0x06, 0xf1, 0x0b, 0x07, 0x0f, 0x08, 0x0d, 0x19, 0x06, 0x15,
+    0x08, 0x09, 0x06, 0x2a, 0x09, 0x18, 0x0c, 0x0a, 0x2b, 0x0b, 0x0c, 0x0f,
+    0x0a, 0x1c, 0x19, 0x21, 0x0e, 0x08, 0x0f, 0x07, 0x09, 0x0d, 0xf0, 0x07,
+    0x0c, 0x08, 0x0d, 0x06, 0x0e, 0x15, 0x0c, 0x0a, 0x03, 0x0c, 0x22, 0x0b,
+    0x0d, 0x0e, 0x13, 0x0c, 0x0a, 0x02, 0x0b, 0x11, 0x0e, 0x0f, 0x12, 0x0b,
+    0x0c, 0xf0, 0x03, 0x0a, 0x02, 0x09, 0x41, 0x0a, 0x0e, 0x1f, 0x0c, 0x12,
+    0x0a, 0x08, 0x01, 0x0a, 0x02, 0x08, 0x33, 0x09, 0x18, 0x0a, 0x32, 0x0c,
+    0xf0, 0x09, 0x08, 0x07, 0x03, 0x08, 0x05, 0x0a, 0x03, 0x0d, 0x02, 0x0c,
+    0x03, 0x0b, 0x04, 0x0c, 0x03, 0x19, 0x05, 0x09, 0x1a, 0x0a, 0x05, 0x0b,
+    0x12, 0x0a, 0x0e, 0xf0, 0x03, 0x0f, 0x04, 0x0c, 0x13, 0x0a, 0x09, 0x04,
+    0x0a, 0x03, 0x0d, 0x14, 0x0b, 0x0c, 0x02, 0x19, 0x04, 0x09, 0x1a, 0x06,
+    0x12, 0x0c, 0x0e, 0x07, 0x0c, 0x04, 0x0a, 0xf0, 0x02, 0x1b, 0x05, 0x03,
+    0x18, 0x01, 0x14, 0x07, 0x36, 0x03, 0x05, 0x08, 0x03, 0x05, 0x01, 0x06,
+    0x12, 0x08, 0x0a, 0x03, 0x0b, 0x05, 0x0a, 0x13, 0x18, 0xf0, 0x17, 0x07,
+    0x76, 0x04, 0x05, 0x0c, 0x06, 0x03, 0x14, 0x13, 0x07, 0x09, 0x12, 0x0a,
+    0x28, 0x73, 0xf0, 0x0a, 0x29, 0x18, 0x12, 0x1b, 0x11, 0x09, 0x47, 0x12,
+    0x41, 0x08, 0x27, 0xf0, 0x22, 0x09, 0x08, 0x21, 0x1c, 0x0e, 0x02, 0x0d,
+    0x03, 0x0a, 0x22, 0x0b, 0x0d, 0x19, 0x23, 0x0a, 0x09, 0x04, 0x0b, 0x30,
+    0x08, 0x2e, 0x0a, 0x06, 0x08, 0x06, 0x51, 0x1f, 0x07, 0x08, 0x0b, 0x27,
+    0x1f, 0x07, 0x1e, 0xf0, 0x05, 0x09, 0x0d, 0x08, 0x2b, 0x06, 0x05, 0x04,
+    0x09, 0x23, 0x08, 0x17, 0x02, 0x09, 0x23, 0x08, 0x09, 0x08, 0x52, 0x1b,
+    0x29, 0xf0, 0x0a, 0x13, 0x08, 0x07, 0x32, 0x28, 0x17, 0x33, 0x08, 0x0a,
+    0x09, 0x12, 0x1d, 0x33, 0x1b, 0xf0, 0x0a, 0x1d, 0x02, 0x31, 0x1f, 0x0e,
+    0x0f, 0x42, 0x0e, 0x0f, 0x0e, 0x2c, 0x03, 0x24, 0x09, 0x0c, 0xf0, 0x3b,
+    0x05, 0x09, 0x08, 0x04, 0x2a, 0x06, 0x07, 0x24, 0x0d, 0x0e, 0x0d, 0x03,
+    0x0c, 0x04, 0x0e, 0x0f, 0x0c, 0x07, 0x0d, 0x04, 0x1e, 0x07, 0xf0, 0x08,
+    0x1c, 0x07, 0x05, 0x4a, 0x04, 0x25, 0x12, 0x0c, 0x4f, 0x04, 0x01, 0x00,
+    0x03, 0x05, 0x0b, 0x01, 0x09, 0x12, 0x0a, 0xf0, 0x09, 0x00, 0x0c, 0x11,
+    0x1f, 0x00, 0x0e, 0x01, 0x0f, 0x04, 0x3e, 0x03, 0x32, 0x1a, 0x03, 0x08,
+    0x12, 0x17, 0x14, 0x08, 0xf0, 0x07, 0x05, 0x18, 0x04, 0x11, 0x07, 0x0a,
+    0x05, 0x09, 0x07, 0x0a, 0x05, 0x18, 0x12, 0x09, 0x03, 0x08, 0x02, 0x07,
+    0x04, 0x06, 0x03, 0x27, 0x22, 0xf0, 0x08, 0x01, 0x0a, 0x00, 0x0b, 0x01,
+    0x07, 0x00, 0x18, 0x01, 0x03, 0x0a, 0x02, 0x0c, 0x00, 0x0b, 0x01, 0x0f,
+    0x05, 0x0e, 0x02, 0x0a, 0x01, 0x1f, 0x04, 0x0c, 0x0d, 0x15, 0x2a, 0xf0,
+    0x08, 0x14, 0x08, 0x09, 0x0c, 0x0b, 0x0a, 0x0a, 0x14, 0x09, 0x2e, 0x05,
+    0x03, 0x04, 0x3b, 0x06, 0x04, 0x12, 0x09, 0x04, 0x1a, 0xf0, 0x05, 0x02,
+    0x0c, 0x21, 0x0e, 0x1d, 0x02, 0x0b, 0x03, 0x0a, 0x02, 0x09, 0x01, 0x07,
+    0x02, 0x0a, 0x04, 0x09, 0x13, 0x2a, 0x04, 0x13, 0x09, 0x38, 0x60, 0x15,
+    0x03, 0x22, 0x0a, 0x08, 0x09, 0x13, 0x05, 0xf1, 0x06, 0x22, 0x07, 0x18,
+    0x03, 0x09, 0x05, 0x0a, 0x04, 0x0b, 0x05, 0x0d, 0x16, 0x1b, 0x07, 0x2c,
+    0x08, 0x06, 0x04, 0x1e, 0x07, 0x0f, 0x0f, 0x41, 0x0a, 0x0b, 0x08, 0x08,
+    0x07, 0x07, 0x06, 0x06, 0x15, 0x0a, 0xf0, 0x0b, 0x06, 0x0d, 0x24, 0x0b,
+    0x09, 0x18, 0x02, 0x01, 0x09, 0x12, 0x0b, 0x0c, 0x10, 0x0d, 0x09, 0x31,
+    0x17, 0x28, 0x20, 0xf0, 0x05, 0x38, 0x01, 0x12, 0x11, 0x07, 0x18, 0x02,
+    0x04, 0x0b, 0x03, 0x0e, 0x02, 0x0f, 0x13, 0x0d, 0x0c, 0x04, 0x0e, 0x06,
+    0x0c, 0x05, 0x0d, 0xf0, 0x14, 0x0b, 0x09, 0x15, 0x0a, 0x0b, 0x04, 0x0c,
+    0x15, 0x1a, 0x34, 0x0e, 0x0c, 0x0b, 0x0c, 0x05, 0x1b, 0x06, 0x05, 0x0e,
+    0x34, 0x0c, 0x0b, 0xf0, 0x0a, 0x0e, 0x05, 0x0d, 0x16, 0x1b, 0x05, 0x0c,
+    0x06, 0x0e, 0x17, 0x0b, 0x0c, 0x09, 0x0d, 0x07, 0x0e, 0x05, 0x0c, 0x04,
+    0x1b, 0x03, 0x22, 0x0e, 0x0c, 0xf0, 0x09, 0xf1, 0x0e, 0x19, 0x0a, 0x0b,
+    0x09, 0x08, 0x09, 0x0d, 0x0b, 0x19, 0x18, 0x09, 0xf0, 0x27, 0x71, 0x0a,
+    0x2f, 0x0d, 0x0c, 0x12, 0x08, 0x09, 0x31, 0x1c, 0x1f, 0x02, 0x0b, 0xf0,
+    0xb3, 0x08, 0x09, 0x08, 0x09, 0x0a, 0x0c, 0x0b, 0x0a, 0x0c, 0x1e, 0x0d,
+    0x24, 0x1b, 0x09, 0x15, 0x08, 0xf0, 0x07, 0x14, 0x08, 0x09, 0x63, 0x0d,
+    0x0b, 0x19, 0x0b, 0x0c, 0x0e, 0x04, 0x0c, 0x33, 0x0b, 0x0a, 0x1e, 0x14,
+    0x0c, 0xf0, 0x0e, 0x05, 0x0c, 0x24, 0x1e, 0x0b, 0xf3, 0x0e, 0x0c, 0x0d,
+    0x0b, 0x2a, 0x1b, 0x0c, 0x0e, 0xf0, 0x0c, 0x0b, 0x0d, 0x1a, 0x43, 0x0c,
+    0x0a, 0x08, 0x09, 0x0c, 0x14, 0x1a, 0x23, 0x0c, 0x2e, 0x04, 0xf0, 0x06,
+    0x1c, 0x15, 0x4b, 0x06, 0x07, 0x16, 0x07, 0x0c, 0x06, 0x1d, 0x05, 0x24,
+    0x0f, 0x0e, 0x0b, 0x05, 0x0a, 0x04, 0x0b, 0x25, 0x09, 0xf0, 0x0a, 0x0b,
+    0x06, 0x09, 0x04, 0x0a, 0x15, 0x0c, 0x2b, 0x54, 0x19, 0x18, 0x03, 0x09,
+    0x32, 0x0a, 0x09, 0x18, 0xf0, 0xf1, 0x0a, 0x19, 0x08, 0x09, 0x08, 0x07,
+    0x08, 0x07, 0x26, 0x08, 0x09, 0x0b, 0xf0, 0x0d, 0x11, 0x0e, 0x0d, 0x12,
+    0x09, 0x0c, 0x03, 0x0e, 0x04, 0x0d, 0x03, 0x0e, 0x04, 0x0b, 0x55, 0x0d,
+    0x0c, 0x1d, 0x0b, 0x0a, 0x34, 0x0b, 0xf0, 0x0e, 0x1c, 0x05, 0x0a, 0x14,
+    0x0d, 0x0e, 0x05, 0x0b, 0x24, 0x0d, 0x1a, 0x33, 0x0e, 0x0b, 0x0a, 0x18,
+    0x12, 0x09, 0xf0, 0x13, 0x18, 0x12, 0x29, 0x03, 0x42, 0x1e, 0x0f, 0x0d,
+    0x0e, 0x03, 0x1d, 0x34, 0x0b, 0x0c, 0x0d, 0x05, 0x0b, 0xf0, 0x06, 0x1a,
+    0x07, 0x0a, 0x0b, 0x0c, 0x0c, 0x1f, 0x0b, 0x1d, 0x0e, 0x0b, 0x2c, 0x1d,
+    0x0f, 0x2b, 0x0a, 0x09, 0x06, 0x0d, 0x07, 0x0e, 0x06, 0x1d, 0xf0, 0x05,
+    0x06, 0x0e, 0x05, 0x0c, 0x44, 0x0b, 0x0c, 0x1b, 0x0a, 0x03, 0x09, 0x04,
+    0x0c, 0x12, 0x0b, 0x1e, 0x11, 0x09, 0x02, 0x08, 0x41, 0x06, 0xf0, 0x07,
+    0x08, 0x07, 0x08, 0x10, 0x09, 0x08, 0x01, 0x17, 0xc0, 0x0e, 0x0c, 0x0f,
+    0x0a, 0x07, 0x0b, 0x08, 0x0d, 0xf0, 0x0b, 0x0f, 0x0c, 0x0f, 0x01, 0x19,
+    0x00, 0x21, 0x08, 0x19, 0x02, 0x08, 0x01, 0x0b, 0x22, 0x0e, 0x0d, 0x0a,
+    0x04, 0x38, 0x23, 0xf0, 0x12, 0x1a, 0x23, 0x08, 0x07, 0x08, 0x04, 0x09,
+    0x13, 0x0a, 0x09, 0x05, 0x08, 0x04, 0x0a, 0x05, 0x0b, 0x09, 0x0a, 0x07,
+    0x09, 0x18, 0x0a, 0xf0, 0x0b, 0x06, 0x0d, 0x07, 0x0e, 0x06, 0x0c, 0x05,
+    0x0e, 0x06, 0x0d, 0x25, 0x1a, 0x1b, 0x14, 0x0c, 0x15, 0x0d, 0x0a, 0x14,
+    0x19, 0x15, 0x1b, 0xf0, 0x06, 0x0e, 0x07, 0x0b, 0x04, 0x0a, 0x05, 0x0d,
+    0x07, 0x1b, 0x15, 0x1a, 0x06, 0x15, 0x0d, 0x1e, 0x04, 0x13, 0x1c, 0x82,
+    0x0e, 0x0a, 0xf0, 0x09, 0x07, 0x08, 0x0b, 0x0c, 0x0b, 0x0a, 0x03, 0x19,
+    0x04, 0x33, 0x0a, 0x09, 0x0b, 0x0c, 0x72, 0x0a, 0x09, 0x2a, 0xf0, 0x0b,
+    0x0d, 0x0e, 0x03, 0x0b, 0x34, 0x1a, 0x0b, 0x0c, 0x05, 0x0b, 0x06, 0x0a,
+    0x15, 0x0b, 0x0a, 0x04, 0x0b, 0x33, 0x0c, 0xf0, 0x09, 0x0b, 0x0a, 0x04,
+    0x29, 0x06, 0x15, 0x08, 0x08, 0x67, 0x09, 0x0e, 0x0d, 0x0b, 0x1d, 0x0c,
+    0x76, 0x09, 0xf0, 0x0d, 0x0c, 0x18, 0x07, 0x06, 0x05, 0x27, 0x04, 0x03,
+    0x22, 0x09, 0x0c, 0x1b, 0x11, 0x08, 0x42, 0x27, 0xf0, 0x18, 0x11, 0x0a,
+    0x0b, 0x32, 0x09, 0x18, 0x09, 0x51, 0x0f, 0x1d, 0x0a, 0x0c, 0x0e, 0x92,
+    0x09, 0xf0, 0x0a, 0x29, 0x18, 0x09, 0x07, 0x08, 0x23, 0x07, 0x08, 0x0a,
+    0x12, 0x0d, 0x0f, 0x13, 0x2c, 0xf0, 0x14, 0x1b, 0x06, 0x05, 0x0c, 0x04,
+    0x0d, 0x15, 0x3b, 0x06, 0x15, 0x2a, 0x74, 0x0c, 0x0a, 0x1e, 0xf0, 0x0c,
+    0x0e, 0x05, 0x1c, 0x06, 0x05, 0x1b, 0x04, 0x23, 0x0c, 0x0a, 0x09, 0x62,
+    0x0a, 0x19, 0x07, 0x18, 0x17, 0xf0, 0xf3, 0x08, 0x09, 0x1a, 0x19, 0x08,
+    0x09, 0x38, 0x09, 0x0a, 0x09, 0xf0, 0x03, 0x28, 0x14, 0x03, 0x09, 0x04,
+    0x1a, 0x23, 0x19, 0x22, 0x0b, 0x09, 0x07, 0xa1, 0x0a, 0x08, 0x09, 0x18,
+    0xf0, 0x07, 0x16, 0x07, 0x19, 0x32, 0x17, 0x08, 0x09, 0x13, 0x17, 0x24,
+    0x16, 0x17, 0x05, 0xf0, 0x04, 0x09, 0x05, 0x2a, 0x06, 0x17, 0x1b, 0x08,
+    0x17, 0x0c, 0x3b, 0x08, 0x0a, 0x28, 0x1c, 0x07, 0x2a, 0x26, 0xf0, 0x09,
+    0x05, 0x2a, 0x86, 0x0b, 0x0d, 0x0c, 0x0b, 0x0a, 0x0b, 0x1c, 0x15, 0x1d,
+    0x66, 0x0b, 0x0e, 0xf0, 0x0c, 0x0b, 0x1a, 0x05, 0x3c, 0x26, 0x07, 0x3a,
+    0x36, 0x0b, 0x05, 0x0c, 0x24, 0x0e, 0x0a, 0xf0, 0x29, 0x03, 0x22, 0x18,
+    0xf1, 0x0d, 0x0c, 0x09, 0x0a, 0x0b, 0x19, 0x08, 0x06, 0x07, 0x08, 0xf0,
+    0x17, 0x09, 0x0d, 0x0a, 0x41, 0x1e, 0x0d, 0x0b, 0x0e, 0x92, 0x0d, 0x0c,
+    0x0b, 0x0c, 0x2e, 0xf0, 0x0d, 0x0b, 0x0a, 0x33, 0x18, 0x19, 0x22, 0x1e,
+    0x0d, 0xa3, 0x19, 0x1a, 0x09, 0xf0, 0x48, 0x0a, 0x34, 0x0b, 0x0a, 0x0c,
+    0x0d, 0xa3, 0x0f, 0x0e, 0x0c, 0x0a, 0x0d, 0x0c, 0xf0, 0x0b, 0x3e, 0x84,
+    0x0c, 0x0d, 0x1e, 0x1f, 0x0e, 0x0d, 0x0b, 0x33, 0x0d, 0x09, 0xf0, 0x18,
+    0x62, 0x19, 0x0d, 0x09, 0x0b, 0x1a, 0x43, 0x19, 0x08, 0x09, 0x0a, 0xf2,
+    0x0c, 0x0b, 0xf0, 0x0c, 0x09, 0x0a, 0x0d, 0x0b, 0x0d, 0x0b, 0x0d, 0x0e,
+    0x0a, 0x0c, 0x0a, 0x09, 0x1a, 0xb2, 0x08, 0xf0, 0x09, 0x0b, 0x09, 0x08,
+    0x0a, 0x2c, 0x0e, 0x0f, 0x03, 0x0c, 0x84, 0x19, 0x0c, 0x0b, 0x29, 0x70,
+    0x28, 0x53, 0x09, 0x0b, 0x06, 0xc1, 0x07, 0x29, 0x04, 0x05, 0x08, 0x18,
+    0x1b, 0x19, 0x1d, 0x38, 0x0e, 0x0f, 0x0c, 0x0a, 0x0e, 0xf0, 0x08, 0x0c,
+    0x86, 0x0d, 0x0c, 0x0d, 0x1b, 0x0c, 0x0a, 0x09, 0x08, 0x24, 0x09, 0x08,
+    0x09, 0x03, 0x0b, 0xc2, 0x0f, 0x0e, 0xf0, 0x0c, 0x1a, 0x0b, 0x08, 0x17,
+    0x18, 0x09, 0x0a, 0x71, 0x0f, 0x0e, 0x0f, 0x0e, 0x2d, 0xf0, 0x0e, 0xd2,
+    0x08, 0x19, 0x0c, 0x3e, 0x0c, 0x0b, 0x0d, 0x0e, 0x0b, 0xf0, 0x0c, 0x33,
+    0x08, 0x09, 0x0a, 0x0c, 0x44, 0x39, 0x08, 0x23, 0x0a, 0x0b, 0x0c, 0x04,
+    0x0a, 0x35, 0x09, 0x1a, 0xf0, 0x09, 0x14, 0x0b, 0x0a, 0x13, 0x0d, 0x0a,
+    0x02, 0x0e, 0x41, 0x0f, 0x0e, 0x0b, 0x09, 0x0a, 0xf2, 0x48, 0xf0, 0x17,
+    0x08, 0x19, 0x07, 0x08, 0x09, 0x0a, 0x18, 0x02, 0x09, 0x03, 0x08, 0x24,
+    0x27, 0xf0, 0x63, 0x18, 0x09, 0x0a, 0x1b, 0x0e, 0x14, 0x0b, 0x0e, 0x06,
+    0x0b, 0x05, 0x0c, 0x46, 0x0b, 0x0d, 0x0e, 0x2c, 0xf0, 0x07, 0x06, 0x0b,
+    0x25, 0x0d, 0x1c, 0x14, 0x0e, 0x0a, 0x03, 0x0b, 0x32, 0x0d, 0x0a, 0x09,
+    0x0a, 0x13, 0x18, 0x12, 0x19, 0xf0, 0x63, 0x07, 0x18, 0x0a, 0x0c, 0x1e,
+    0x14, 0x0b, 0x0a, 0x33, 0x1b, 0x1c, 0x44, 0x19, 0xf0, 0x0b, 0x0a, 0x0b,
+    0x45, 0x3a, 0x09, 0x04, 0x0a, 0x25, 0x09, 0x0b, 0x0a, 0x54, 0x0c, 0x0d,
+    0x0c, 0x1a, 0xf0, 0x0b, 0x33, 0x0f, 0x0e, 0x0d, 0x0a, 0x62, 0x1f, 0x2e,
+    0x0b, 0x09, 0xf1, 0x0e, 0x0c, 0x1b, 0xf0, 0x1e, 0x0d, 0x0b, 0x0c, 0x0a,
+    0x19, 0x18, 0x17, 0x51, 0x26, 0xf0, 0x07, 0x09, 0x0b, 0x02, 0x07, 0x13,
+    0x06, 0x07, 0x34, 0x26, 0x07, 0x75, 0x08, 0x0a, 0x0c, 0x0d, 0x1e, 0xf0,
+    0x0d, 0x0e, 0x06, 0x1b, 0x07, 0x09, 0x2a, 0x0b, 0x0c, 0x0e, 0x2b, 0x0b,
+    0x09, 0x08, 0x0d, 0x09, 0x1c, 0x18, 0x1d, 0x09, 0x08, 0x0c, 0xf0, 0x77,
+    0x0e, 0x0c, 0x0d, 0x4b, 0x15, 0x0e, 0x1d, 0x04, 0x13, 0x0c, 0x0a, 0x72,
+    0x1d, 0x0b, 0xf0, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0xf3, 0x08, 0x09, 0x18,
+    0x1a, 0x09, 0x1b, 0x1a, 0xf0, 0x09, 0x08, 0x0a, 0x2e, 0xa3, 0x1d, 0x0e,
+    0x0c, 0x0b, 0x09, 0x0a, 0x08, 0x17, 0xf0, 0x02, 0x09, 0x41, 0x0d, 0x0a,
+    0x2b, 0x10, 0x0c, 0x08, 0x21, 0x06, 0x08, 0x07, 0x02, 0x06, 0x11, 0x07,
+    0x19, 0x02, 0x11, 0x08, 0xf0, 0x0c, 0x04, 0x0a, 0x02, 0x0c, 0x03, 0x0a,
+    0x14, 0x0b, 0x09, 0x08, 0x0b, 0x0f, 0x0d, 0x17, 0x0a, 0x0b, 0x0f, 0x1c,
+    0x05, 0x07, 0x0d, 0x08, 0x3e, 0x07, 0x03, 0xf0, 0x04, 0x03, 0x0a, 0x02,
+    0x09, 0x03, 0x08, 0x22, 0x19, 0x17, 0x11, 0x09, 0x02, 0x07, 0x00, 0x09,
+    0x11, 0x0d, 0x1a, 0x10, 0x1e, 0x01, 0xf0, 0x10, 0x0c, 0x0f, 0x41, 0x0c,
+    0x0e, 0x0a, 0x08, 0x0a, 0x02, 0x09, 0x05, 0x18, 0x02, 0x03, 0x0c, 0x05,
+    0x0a, 0x03, 0x09, 0x04, 0x0b, 0x05, 0x0a, 0x03, 0x0b, 0xa0, 0x08, 0x0d,
+    0x05, 0x0b, 0x04, 0x09, 0x09, 0x0a, 0x08, 0x2b, 0x06, 0x17, 0x0c, 0x09,
+    0x0e, 0x08, 0x0d, 0x05, 0x07, 0x11, 0x0f, 0x08, 0x0a, 0x0f, 0xf0, 0x09,
+    0x0c, 0x0a, 0x0d, 0x09, 0x0e, 0x05, 0x0d, 0x06, 0x2e, 0x07, 0x03, 0x14,
+    0x0c, 0x0b, 0x13, 0x08, 0x0a, 0x04, 0x0c, 0x23, 0x0b, 0x0a, 0x07, 0x02,
+    0x08, 0xf0, 0x05, 0x1a, 0x03, 0x01, 0x0b, 0x03, 0x09, 0x02, 0x0a, 0x11,
+    0x07, 0x28, 0x02, 0x01, 0x10, 0x1c, 0x61, 0x0a, 0x0b, 0x0c, 0x1e, 0xf0,
+    0x0c, 0x09, 0x02, 0x08, 0x21, 0x0b, 0x0e, 0x0f, 0x12, 0x0b, 0x0a, 0x03,
+    0x0b, 0x24, 0x0d, 0x0b, 0x1a, 0x06, 0x14, 0x3b, 0x08, 0xf0, 0x05, 0x08,
+    0x0d, 0x06, 0x0c, 0x04, 0x1b, 0x16, 0x0a, 0x04, 0x0c, 0x15, 0x0a, 0x0b,
+    0x03, 0x0c, 0x04, 0x0b, 0x25, 0x0a, 0x09, 0x08, 0x33, 0x0a, 0x1c, 0xf0,
+    0x0a, 0x02, 0x0b, 0x13, 0x09, 0x08, 0x31, 0x0a, 0x1c, 0x0e, 0x22, 0x0c,
+    0x0e, 0x0a, 0x03, 0x0b, 0x12, 0x0c, 0x2f, 0x04, 0xf0, 0x03, 0x14, 0x0e,
+    0x0a, 0x03, 0x0b, 0x14, 0x0a, 0x0d, 0x15, 0x0e, 0x0b, 0x14, 0x0e, 0x0f,
+    0x05, 0x0d, 0x24, 0x0f, 0x0e, 0x1d, 0x33, 0x0b, 0xf0, 0x1c, 0x15, 0x0b,
+    0x1e, 0x03, 0x02, 0x0d, 0x04, 0x09, 0x06, 0x1a, 0x14, 0x09, 0x33, 0x0b,
+    0x09, 0x28, 0x14, 0x0a, 0xf0, 0x12, 0x0d, 0x19, 0x33, 0x0a, 0x0c, 0x19,
+    0x24, 0x1a, 0x03, 0x0b, 0x04, 0x39, 0x15, 0x06, 0x24, 0x0a, 0x2e, 0xf0,
+    0x83, 0x1f, 0x0e, 0x0b, 0x18, 0x09, 0x0c, 0x22, 0x0e, 0x0f, 0x0d, 0x13,
+    0x08, 0x07, 0x02, 0x08, 0xf0, 0x03, 0x09, 0x12, 0x08, 0x0a, 0x11, 0x0d,
+    0x29, 0x42, 0x07, 0x09, 0x08, 0x31, 0x0a, 0x2e, 0x42, 0x0b, 0x0a, 0xf0,
+    0x09, 0x0a, 0x0c, 0x23, 0x0b, 0x0a, 0x1e, 0x54, 0x0a, 0x19, 0x0a, 0x09,
+    0x23, 0x1b, 0x1a, 0x04, 0xf0, 0x13, 0x0d, 0x0e, 0x06, 0x0b, 0x04, 0x09,
+    0x03, 0x0b, 0x04, 0x19, 0x03, 0x42, 0x0d, 0x0c, 0x08, 0x09, 0x0b, 0xe1,
+    0x0d, 0x0c, 0x0b, 0x09, 0xf0, 0x1c, 0x08, 0x07, 0x08, 0x1a, 0x0c, 0x19,
+    0x0a, 0x02, 0x08, 0x33, 0x0a, 0x19, 0x0a, 0xf0, 0x04, 0x0b, 0x16, 0x1d,
+    0x07, 0x0b, 0x06, 0x3c, 0x25, 0x06, 0x1b, 0x03, 0x24, 0x0a, 0x09, 0x08,
+    0x0a, 0x47, 0x08, 0x0b, 0xf0, 0x0c, 0x09, 0x1d, 0x08, 0x19, 0x18, 0x0a,
+    0x06, 0x1c, 0x04, 0x03, 0x1b, 0x04, 0x05, 0x0a, 0x03, 0x0b, 0x04, 0x1a,
+    0x13, 0x0e, 0x04, 0x1a, 0xf0, 0x03, 0x04, 0x19, 0x33, 0x1b, 0x08, 0x04,
+    0x07, 0x12, 0x09, 0x0b, 0x53, 0x08, 0x09, 0x1c, 0x0d, 0x0c, 0x05, 0x1a,
+    0xf0, 0x14, 0x08, 0x05, 0x07, 0x04, 0x06, 0x53, 0x17, 0x08, 0x07, 0x16,
+    0x04, 0x45, 0x15, 0x24, 0x06, 0xf0, 0x03, 0x08, 0x62, 0x1a, 0x0b, 0x1a,
+    0x09, 0x0c, 0x14, 0x19, 0x02, 0x0d, 0x03, 0x0a, 0x04, 0x19, 0x13, 0x0b,
+    0x04, 0x09, 0xf0, 0x03, 0x0c, 0x04, 0x09, 0x23, 0x0c, 0x0a, 0x0d, 0x04,
+    0x1a, 0x13, 0x0b, 0x04, 0x0a, 0x33, 0x0c, 0x1e, 0x0c, 0x84, 0x1a, 0x09,
+    0xf0, 0x1a, 0x09, 0x08, 0x0a, 0x0c, 0x53, 0x0e, 0x0a, 0x2e, 0x0f, 0x04,
+    0x0e, 0x25, 0x1b, 0x1a, 0xf0, 0x06, 0x09, 0x0b, 0x07, 0x0d, 0x06, 0x1b,
+    0x05, 0x04, 0x0d, 0x33, 0x0e, 0x1a, 0x09, 0x42, 0x0e, 0x0d, 0x0f, 0x0e,
+    0x0f, 0x93, 0x0e, 0xf0, 0x0f, 0x0c, 0x1a, 0x18, 0x19, 0x08, 0x72, 0x0b,
+    0x0f, 0x1e, 0x0a, 0x28, 0xf0, 0x21, 0x0b, 0x1a, 0x70, 0x0f, 0x0c, 0x29,
+    0x0b, 0x08, 0x09, 0x71, 0x27, 0x08, 0xf0, 0x0b, 0x0d, 0x19, 0x22, 0x08,
+    0x1b, 0x03, 0x09, 0x64, 0x08, 0x29, 0x0c, 0x2d, 0x05, 0xf0, 0x16, 0x0b,
+    0x1a, 0x07, 0x28, 0x0b, 0x0c, 0x1b, 0x07, 0x16, 0x0d, 0x0c, 0x07, 0x0d,
+    0x08, 0x1c, 0x07, 0x16, 0x0b, 0x0e, 0x07, 0x0d, 0x16, 0x1c, 0xf0, 0x37,
+    0x1b, 0x0c, 0x1b, 0x28, 0x0c, 0x1b, 0x07, 0x16, 0x0d, 0x0c, 0x15, 0x0d,
+    0x3a, 0x04, 0x03, 0x12, 0xf0, 0x0b, 0x03, 0x08, 0x32, 0x0a, 0x28, 0x81,
+    0x0a, 0x08, 0x09, 0x08, 0x17, 0x08, 0x0c, 0x0e, 0x32, 0x09, 0xf0, 0x0a,
+    0x08, 0x0a, 0x53, 0x09, 0x0b, 0x0c, 0x1b, 0x0d, 0x04, 0x0b, 0x05, 0x0a,
+    0x04, 0x0e, 0x13, 0x0c, 0x0e, 0x05, 0x0c, 0x26, 0x0b, 0xf0, 0x0a, 0x0c,
+    0x07, 0x0d, 0x06, 0x0c, 0x05, 0x0d, 0x17, 0x0b, 0x0d, 0x04, 0x2f, 0x12,
+    0x43, 0x0d, 0x0b, 0x1a, 0x0c, 0x04, 0x09, 0xf0, 0x53, 0x0b, 0x0c, 0x0d,
+    0x1c, 0x0e, 0x44, 0x0a, 0x09, 0x28, 0x15, 0x17, 0x04, 0x08, 0x43, 0x19,
+    0xf0, 0x0a, 0x09, 0x0a, 0x22, 0x0d, 0x0c, 0x0d, 0x33, 0x0a, 0x1e, 0x0b,
+    0x82, 0x1f, 0x0d, 0x0b, 0x18, 0xf0, 0x29, 0x13, 0x07, 0x08, 0x42, 0x0a,
+    0x19, 0x08, 0x07, 0xc1, 0x1b, 0x1a, 0x08, 0x07, 0xf0, 0x18, 0x09, 0x0c,
+    0x0e, 0x1c, 0x02, 0x19, 0x13, 0x07, 0x02, 0x08, 0x13, 0x09, 0x0a, 0x01,
+    0x0f, 0x02, 0x0d, 0x03, 0x0b, 0xf0, 0x02, 0x0a, 0x01, 0x0f, 0x02, 0x0e,
+    0x63, 0x1b, 0x0c, 0x0e, 0x0f, 0x0c, 0x0a, 0x04, 0x09, 0x65, 0x18, 0x0a,
+    0x0b, 0x1a, 0xf0, 0x0d, 0x16, 0x1c, 0x07, 0x1d, 0x16, 0x2b, 0x17, 0x15,
+    0x0e, 0x0c, 0x06, 0x0a, 0x05, 0x0b, 0x24, 0x09, 0x0b, 0x0e, 0xf0, 0x43,
+    0x0f, 0x1d, 0x0e, 0x0b, 0x22, 0x0f, 0x0c, 0x0a, 0x13, 0x09, 0x0a, 0x12,
+    0x0c, 0x0e, 0x53, 0x0b, 0x09, 0x08, 0x09, 0xf0, 0x0a, 0x09, 0x14, 0x36,
+    0x05, 0x06, 0x14, 0x07, 0x28, 0x05, 0x04, 0x03, 0x09, 0x04, 0x08, 0x05,
+    0x07, 0x64, 0x08, 0x09, 0x0b, 0xf0, 0x0a, 0x0b, 0x2c, 0x35, 0x0b, 0x2a,
+    0x44, 0x19, 0x0b, 0x0c, 0x05, 0x49, 0x34, 0xf0, 0x43, 0x0e, 0x0d, 0x0b,
+    0x09, 0x0a, 0xa2, 0x0c, 0x1b, 0x1a, 0x0c, 0x0b, 0x0e, 0x0f, 0xf0, 0x0e,
+    0x0d, 0xa3, 0x08, 0x09, 0x07, 0x08, 0x0a, 0x0c, 0x0b, 0x2a, 0x0d, 0xf4,
+    0x0a, 0x1b, 0xf0, 0x0d, 0x1b, 0x0e, 0x0f, 0x0e, 0x2c, 0x0a, 0x29, 0x14,
+    0x1b, 0x73, 0x0e, 0xf0, 0x0d, 0x2e, 0x1d, 0x09, 0x92, 0x2b, 0x2a, 0x0b,
+    0x0a, 0x08, 0xf0, 0x07, 0x11, 0x0a, 0x08, 0x50, 0x0f, 0x0d, 0x0b, 0x0a,
+    0x0b, 0x0f, 0x51, 0x09, 0x08, 0x09, 0x1b, 0x0c, 0xa2, 0x18, 0xf0, 0x07,
+    0x08, 0x09, 0x1a, 0x09, 0x08, 0x09, 0x0c, 0x33, 0x19, 0x2a, 0xd4, 0x4e,
+    0xf0, 0x0d, 0x1b, 0x0d, 0x0a, 0x09, 0x1a, 0x13, 0x0e, 0x0d, 0x14, 0x0a,
+    0x09, 0xf0, 0x23, 0x0a, 0x0e, 0x0f, 0x14, 0x0b, 0x0a, 0x83, 0x0e, 0x0d,
+    0x0c, 0x09, 0x18, 0x09, 0x1a, 0x14, 0x09, 0x0b, 0xf0, 0x05, 0x0c, 0x06,
+    0x1b, 0x45, 0x0a, 0x0b, 0x1a, 0x04, 0x0d, 0x43, 0x4e, 0x04, 0x0d, 0x15,
+    0x0a, 0x0d, 0xf0, 0x17, 0x0b, 0x0c, 0x28, 0x0b, 0x2c, 0x17, 0x0e, 0x76,
+    0x0d, 0x0c, 0x0e, 0x0b, 0x3a, 0x15, 0x0b, 0xf0, 0x1a, 0x04, 0x53, 0x0e,
+    0x0b, 0x09, 0x28, 0x42, 0x0e, 0x0d, 0x0b, 0x0c, 0x0e, 0x63, 0x08, 0x09,
+    0x2a, 0xf0, 0x18, 0x12, 0x0a, 0x09, 0x41, 0x1d, 0x0b, 0x09, 0x08, 0x60,
+    0x1f, 0x0e, 0x0c, 0x0a, 0xf0, 0x1d, 0x41, 0x18, 0x09, 0x0c, 0x0b, 0x52,
+    0x07, 0x08, 0x0a, 0x0b, 0x0e, 0x0f, 0x03, 0x0b, 0x14, 0x19, 0xf0, 0x05,
+    0x08, 0x16, 0x17, 0x25, 0x28, 0x24, 0x29, 0x73, 0x0b, 0x0a, 0x1c, 0x0a,
+    0x1c, 0xf0, 0x0e, 0x24, 0x1a, 0x0b, 0x35, 0x19, 0x0a, 0x09, 0x04, 0x0c,
+    0x05, 0x1b, 0x16, 0x0e, 0x08, 0x0c, 0x0a, 0x0d, 0x0b, 0x0e, 0x0a, 0x1d,
+    0xf0, 0x09, 0x08, 0x1e, 0x27, 0x1d, 0x06, 0x0c, 0x15, 0x0d, 0x1b, 0x34,
+    0x09, 0x18, 0x03, 0x09, 0x22, 0x0a, 0x18, 0xf0, 0xf1, 0x0b, 0x0a, 0x1b,
+    0x0a, 0x18, 0x09, 0x3b, 0x0a, 0x0b, 0x0c, 0x0d, 0xf0, 0x51, 0x0c, 0x0e,
+    0x3f, 0xd2, 0x19, 0x0a, 0x0b, 0x0a, 0x1b, 0x0d, 0x1b, 0xf0, 0x0d, 0x1e,
+    0x0f, 0x53, 0x1c, 0x0b, 0x0d, 0x0c, 0x0e, 0x14, 0x0b, 0x0c, 0x15, 0x2a,
+    0x26, 0x1b, 0xf0, 0x17, 0x1a, 0x08, 0x4b, 0x09, 0x0b, 0x0d, 0x1b, 0x0c,
+    0x0a, 0x1d, 0x0c, 0x09, 0x0e, 0x18, 0x0c, 0x0b, 0x07, 0x0a, 0x06, 0x0b,
+    0xf0, 0x55, 0x1e, 0x2d, 0x0b, 0x04, 0x0d, 0x33, 0x0f, 0x0e, 0x0c, 0x0a,
+    0x02, 0x0e, 0xb1, 0x0f, 0x0d, 0x0e, 0x0c, 0xf0, 0x09, 0x08, 0x19, 0x18,
+    0x17, 0xa0, 0x0e, 0x0c, 0x0b, 0x08, 0x07, 0x18, 0x09, 0xf0, 0x0c, 0x0e,
+    0x0f, 0x61, 0x18, 0x09, 0x18, 0x1b, 0x22, 0x08, 0x0b, 0x0e, 0x13, 0x0a,
+    0x0d, 0x14, 0x0c, 0xf0, 0x0d, 0x15, 0x1c, 0xa6, 0x1b, 0x0e, 0x0b, 0x2a,
+    0x0c, 0x0b, 0x0d, 0x2b, 0x17, 0xf0, 0x18, 0x0d, 0x1c, 0x07, 0x05, 0x2e,
+    0x04, 0x23, 0x0c, 0x0a, 0x12, 0x0e, 0x0f, 0x03, 0x0b, 0x14, 0x09, 0x0a,
+    0x65, 0x09, 0x0a, 0x19, 0xf0, 0x1a, 0x09, 0x34, 0x0a, 0x1b, 0x0e, 0x15,
+    0x0b, 0x0d, 0x26, 0x1a, 0x0c, 0x07, 0x3d, 0x08, 0x0a, 0xf0, 0x0b, 0x0c,
+    0x1c, 0x0f, 0x0d, 0x1b, 0x0b, 0x18, 0x1c, 0x07, 0x1b, 0x06, 0x15, 0x0d,
+    0x1a, 0x14, 0x08, 0x03, 0x09, 0x82, 0x0c, 0x0d, 0xf0, 0x0a, 0x09, 0x28,
+    0x17, 0x31, 0x0b, 0x09, 0x08, 0x07, 0x70, 0x0c, 0x1a, 0x09, 0x0a, 0xf0,
+    0x1c, 0x0e, 0x91, 0x07, 0x08, 0x09, 0x0c, 0x0b, 0x09, 0x38, 0x52, 0x06,
+    0x17, 0xf0, 0x08, 0x0a, 0x0c, 0x43, 0x08, 0x0a, 0x0e, 0x1f, 0xa4, 0x0c,
+    0x0b, 0x0c, 0x0d, 0x0a, 0x19, 0x08, 0xf0, 0x19, 0x0a, 0x25, 0x09, 0x0b,
+    0x0d, 0x36, 0x0b, 0x0d, 0x0b, 0x0a, 0x05, 0x0b, 0x14, 0x0c, 0x0b, 0xd3,
+    0x0e, 0x0b, 0x0a, 0xf0, 0x0b, 0x1d, 0x0b, 0x0d, 0x0e, 0x0f, 0x3e, 0xa4,
+    0x2a, 0x19, 0xf0, 0x1a, 0x39, 0x43, 0x0e, 0x0b, 0x19, 0x08, 0x14, 0x16,
+    0xa3, 0x07, 0x08, 0x37, 0xf0, 0x18, 0x09, 0x0a, 0x09, 0xf2, 0x0e, 0x0f,
+    0x0d, 0x0c, 0x0d, 0x0b, 0x0c, 0x1b, 0xf0, 0x0c, 0x0e, 0x0f, 0x0e, 0x1d,
+    0x0e, 0x12, 0x1f, 0x13, 0x0b, 0x0e, 0x04, 0x09, 0x15, 0x08, 0x0a, 0x94,
+    0x0e, 0xf0, 0x0c, 0x0d, 0x2c, 0x0b, 0x0a, 0x1b, 0x55, 0x09, 0x08, 0x17,
+    0x08, 0x07, 0x14, 0x18, 0xf0, 0xc3, 0x09, 0x08, 0x29, 0x0a, 0x09, 0x0b,
+    0x2d, 0x1c, 0x24, 0x29, 0xf0, 0xf3, 0x0c, 0x0a, 0x3b, 0x0a, 0x09, 0x18,
+    0x0a, 0x09, 0x0a, 0x0e, 0x0d, 0xf0, 0x1b, 0x53, 0x0a, 0x19, 0x18, 0x52,
+    0x1b, 0x0a, 0x0b, 0x1c, 0xf3, 0x18, 0x19, 0xf0, 0x1a, 0x0c, 0x0e, 0x0c,
+    0x0a, 0x09, 0x18, 0x0a, 0x0c, 0x0d, 0x64, 0x09, 0x3a, 0xf0, 0x0b, 0x09,
+    0x23, 0x0e, 0x0c, 0x0b, 0x52, 0x0e, 0x0d, 0x19, 0x0a, 0x0c, 0x73, 0x08,
+    0x09, 0x2a, 0xf0, 0x19, 0x08, 0x72, 0x2c, 0x0a, 0x09, 0x0a, 0x0c, 0x0f,
+    0xe3, 0x0c, 0x1e, 0xf0, 0x1c, 0x19, 0x28, 0x07, 0x08, 0x09, 0x0b, 0x0d,
+    0x14, 0x19, 0x23, 0x2e, 0xf0, 0x24, 0x09, 0x0a, 0x0c, 0x05, 0x0a, 0x34,
+    0x0b, 0x1a, 0x09, 0xf3, 0x0b, 0x1a, 0x09, 0x0a, 0x0b, 0x1a, 0xf0, 0x38,
+    0x17, 0x18, 0x63, 0x09, 0x08, 0x09, 0x1b, 0x0a, 0x0d, 0xf0, 0x54, 0x0b,
+    0x0a, 0x0b, 0x0a, 0x0b, 0x0d, 0x05, 0x0a, 0x44, 0x2d, 0x0a, 0x09, 0x33,
+    0x1c, 0x0a, 0x09, 0xf0, 0x42, 0x0d, 0x0b, 0x2c, 0xa3, 0x08, 0x09, 0x2a,
+    0x09, 0x08, 0x19, 0x18, 0xf0, 0x64, 0x26, 0x07, 0x06, 0x17, 0x53, 0x09,
+    0x0c, 0x0b, 0x0c, 0x1d, 0x54, 0x09, 0x0a, 0x0b, 0xf0, 0x0c, 0x0b, 0x0c,
+    0x35, 0x0a, 0x0b, 0x1a, 0x44, 0x0e, 0x1d, 0x0b, 0x0a, 0xb3, 0x0d, 0x0b,
+    0x1a, 0xf0, 0x09, 0x08, 0x09, 0x18, 0x09, 0x18, 0xf2, 0x0b, 0x1c, 0x0b,
+    0x0d, 0x0c, 0x0b, 0x09, 0xf0, 0x38, 0x07, 0x28, 0x32, 0x09, 0x0a, 0x0d,
+    0x0f, 0x03, 0x0c, 0x64, 0x09, 0x0a, 0x0b, 0xf0, 0x2c, 0x0d, 0x05, 0x0a,
+    0x86, 0x09, 0x0b, 0x0c, 0x0d, 0x1b, 0x0c, 0x0d, 0x2a, 0x15, 0xf0, 0x34,
+    0x0c, 0x09, 0x0a, 0x09, 0x13, 0x1c, 0xb2, 0x0f, 0x0d, 0x0c, 0x09, 0x38,
+    0x37, 0xf0, 0xb1, 0x0b, 0x0d, 0x1c, 0x0a, 0x09, 0x2a, 0x0b, 0x0d, 0x0e,
+    0x12, 0x09, 0x0a, 0xf0, 0x23, 0x09, 0x0b, 0x0d, 0x34, 0x1a, 0x0b, 0x0a,
+    0x53, 0x0e, 0x0d, 0x0e, 0x2f, 0x14, 0x0b, 0x0e, 0x75, 0x0b, 0xf0, 0x19,
+    0x0a, 0x09, 0x0a, 0x09, 0x0a, 0xe4, 0x0e, 0x1d, 0x1e, 0x0c, 0x0d, 0x0e,
+    0x1c, 0xf0, 0x0d, 0x0c, 0x0b, 0x09, 0x0a, 0x23, 0x0d, 0x0b, 0x0a, 0xf2,
+    0x1f, 0x0e, 0x1d, 0x0e, 0x0a, 0xf0, 0x09, 0x0a, 0x19, 0x18, 0x09, 0x38,
+    0xa2, 0x17, 0x18, 0x0a, 0xf0, 0x09, 0x0a, 0x0c, 0x0d, 0xc3, 0x09, 0x0a,
+    0x09, 0x0a, 0x0b, 0x09, 0x3a, 0x28, 0xf0, 0x52, 0x2c, 0x1b, 0x0d, 0x13,
+    0x0a, 0x0d, 0x24, 0x0a, 0x0b, 0x1e, 0x05, 0x16, 0x0b, 0x0d, 0x37, 0x3c,
+    0xf0, 0x18, 0x1d, 0x17, 0x0e, 0x0d, 0x08, 0x0b, 0x27, 0x2c, 0x16, 0x0e,
+    0x0c, 0x17, 0x2b, 0x05, 0xf0, 0x16, 0x0a, 0x09, 0x15, 0x1a, 0x04, 0x0b,
+    0x13, 0x0f, 0x0e, 0x12, 0x1f, 0x13, 0x0d, 0x0a, 0x04, 0x28, 0x05, 0x24,
+    0x09, 0x08, 0xf0, 0x13, 0x0b, 0x0c, 0x92, 0x1e, 0x0c, 0x1b, 0x0a, 0x09,
+    0x1a, 0x09, 0xf1, 0x1f, 0x0e, 0x0c, 0xf0, 0x0a, 0x19, 0x08, 0x07, 0x06,
+    0x08, 0x17, 0x08, 0x09, 0x0a, 0x01, 0x0d, 0x52, 0x08, 0x0a, 0x1b, 0xf0,
+    0x0d, 0x0e, 0x73, 0x0b, 0x0c, 0x0b, 0x2d, 0x0e, 0x0d, 0x14, 0x19, 0xf3,
+    0x0d, 0x0c, 0x0a, 0xf0, 0x2c, 0x1b, 0x0a, 0x09, 0x2a, 0x09, 0x3a, 0x63,
+    0x09, 0xf0, 0x0b, 0x1a, 0x0b, 0xf4, 0x29, 0x0c, 0x0d, 0x1c, 0x2a, 0x1b,
+    0xf0, 0x1a, 0x0b, 0x0a, 0x44, 0x1b, 0x19, 0x0a, 0x05, 0x0d, 0x03, 0x0b,
+    0x04, 0x0e, 0x07, 0x1b, 0x04, 0x15, 0x0e, 0x1c, 0xf0, 0x14, 0x1a, 0x05,
+    0x04, 0x0b, 0x02, 0x1e, 0x03, 0x04, 0x09, 0x02, 0x0d, 0x43, 0x0b, 0x09,
+    0x0b, 0x09, 0x18, 0x04, 0x42, 0x09, 0x0b, 0xf0, 0x0a, 0x09, 0x0c, 0x11,
+    0x0e, 0x0c, 0xf2, 0x0a, 0x08, 0x27, 0x08, 0x19, 0x18, 0x0a, 0xf0, 0x0b,
+    0x0e, 0x0d, 0x0b, 0x0d, 0x03, 0x0a, 0x24, 0x08, 0x09, 0x0b, 0x15, 0x1a,
+    0x16, 0x0b, 0x0a, 0x05, 0x0b, 0x16, 0x0a, 0x39, 0xf0, 0x14, 0x05, 0xc4,
+    0x0b, 0x0a, 0x0b, 0x0a, 0x1b, 0x09, 0x0a, 0x29, 0x08, 0x07, 0xf0, 0x13,
+    0x08, 0x09, 0x12, 0x0a, 0x0b, 0x03, 0x08, 0x22, 0x1a, 0x0d, 0x03, 0x19,
+    0x02, 0x13, 0x08, 0x09, 0x02, 0x0c, 0x03, 0x09, 0x02, 0x08, 0x23, 0x09,
+    0xf0, 0x0a, 0x09, 0x04, 0x08, 0x23, 0x0a, 0x0b, 0x0c, 0x14, 0x0d, 0x09,
+    0x03, 0x0b, 0x34, 0x0c, 0x09, 0x0b, 0x0a, 0x13, 0x09, 0x0b, 0x02, 0x0f,
+    0xf0, 0x33, 0x0e, 0x0b, 0x0e, 0x0c, 0x04, 0x19, 0x05, 0x06, 0x18, 0x05,
+    0x03, 0x0a, 0x06, 0x0b, 0x03, 0x0c, 0x05, 0x0a, 0x03, 0x0c, 0x04, 0x1e,
+    0x03, 0x02, 0x0b, 0xf0, 0x07, 0x0a, 0x02, 0x19, 0x04, 0x03, 0x08, 0x02,
+    0x0b, 0x03, 0x0a, 0x01, 0x0b, 0x03, 0x08, 0x02, 0x09, 0x03, 0x08, 0x22,
+    0x09, 0x08, 0x0a, 0x01, 0x1b, 0x42, 0x08, 0xf0, 0x09, 0x0b, 0x08, 0xa3,
+    0x07, 0x08, 0x19, 0x1b, 0x0c, 0x1b, 0x1d, 0x74, 0x29, 0xf0, 0x08, 0x07,
+    0x28, 0xf3, 0x19, 0x1a, 0x0b, 0x09, 0x0a, 0x09, 0x0b, 0x0a, 0xf0, 0x09,
+    0x08, 0x07, 0x18, 0x29, 0xc3, 0x38, 0x2a, 0x0b, 0xf0, 0x09, 0x18, 0x42,
+    0x0a, 0x0b, 0x1a, 0x0d, 0x73, 0x08, 0x09, 0x1a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0xf0, 0x14, 0x1a, 0x05, 0x07, 0x06, 0x06, 0x07, 0x05, 0x0a, 0xf4, 0x0c,
+    0x0b, 0x0a, 0x09, 0x2b, 0x0c, 0x09, 0x0a, 0xf0, 0x0b, 0x0a, 0x19, 0x0a,
+    0x09, 0x04, 0x1e, 0xd3, 0x0d, 0x0b, 0x0a, 0x09, 0x18, 0x09, 0x08, 0xf0,
+    0x09, 0x1a, 0x0b, 0x08, 0xf4, 0x19, 0x0a, 0x0b, 0x0a, 0x0c, 0x0b, 0x0a,
+    0x0d, 0x0e, 0x2b, 0xf0, 0x0c, 0x0a, 0x09, 0x04, 0x0b, 0xf3, 0x28, 0x17,
+    0x18, 0x27, 0xf0, 0x08, 0x0a, 0x48, 0x73, 0x39, 0x0e, 0x0c, 0x07, 0x54,
+    0x09, 0x08, 0xf0, 0x0b, 0x0a, 0x09, 0x1d, 0xf3, 0x0c, 0x0b, 0x0a, 0x19,
+    0x18, 0x09, 0x0a, 0x28, 0xf0, 0x09, 0x1a, 0x13, 0x08, 0x1c, 0xf2, 0x09,
+    0x0a, 0x08, 0x09, 0x0a, 0x07, 0x08, 0x17, 0xf0, 0x18, 0x0a, 0x0b, 0x0e,
+    0x0d, 0x32, 0x1e, 0x0d, 0x18, 0x33, 0x09, 0x0b, 0x1a, 0xf4, 0x0b, 0xf0,
+    0x0a, 0x0d, 0x0c, 0x1a, 0x39, 0x08, 0x09, 0x2a, 0x34, 0x0b, 0x1a, 0xf0,
+    0x0e, 0xf3, 0x2d, 0x0b, 0x0c, 0x0d, 0x1e, 0x0d, 0x4f, 0xf0, 0x1e, 0x33,
+    0x0d, 0x0b, 0x0a, 0x1f, 0xe2, 0x0d, 0x0b, 0x3a, 0x09, 0x0b, 0x0d, 0xf0,
+    0x0e, 0x0f, 0x0e, 0x0f, 0x0a, 0x73, 0x29, 0x18, 0x0a, 0x0b, 0x08, 0x44,
+    0x09, 0x0b, 0x0d, 0xf0, 0x0e, 0x2a, 0x35, 0x0b, 0x0e, 0x34, 0x0d, 0x0c,
+    0x0a, 0x0e, 0xc3, 0x0c, 0x0a, 0x39, 0xf0, 0x1a, 0x08, 0x07, 0x18, 0x0d,
+    0x82, 0x3e, 0x0c, 0x0d, 0x0e, 0x0c, 0x09, 0xf3, 0xf0, 0x0f, 0x0b, 0x0a,
+    0x0b, 0x09, 0x1b, 0x0a, 0x19, 0x0b, 0x0c, 0x0e, 0x0f, 0x1b, 0xf3, 0xf0,
+    0x0e, 0x0c, 0x1f, 0x1b, 0x0c, 0x0b, 0x2c, 0x0b, 0x09, 0x0c, 0x1b, 0xf3,
+    0xf0, 0x2e, 0x0d, 0x0e, 0x1d, 0x0c, 0x1b, 0x0a, 0x2b, 0x0a, 0x1f, 0xf2,
+    0xf0, 0x0d, 0x0f, 0x1e, 0x0d, 0x0c, 0x0b, 0x0a, 0x0c, 0x0b, 0x0e, 0x0c,
+    0x0b, 0x0c, 0x0e, 0x32, 0xf0, 0x0b, 0x0d, 0x0c, 0x0a, 0x13, 0x1d, 0x42,
+    0x0c, 0x0a, 0x0c, 0x0f, 0x1a, 0xf3, 0x09, 0x08, 0x09, 0x0a, 0xf0, 0x0e,
+    0x0c, 0x0b, 0x0e, 0x0d, 0x2f, 0x0e, 0x0b, 0x0d, 0x03, 0x19, 0xf4, 0x0a,
+    0x09, 0x3a, 0xf0, 0x29, 0x0a, 0x0b, 0x1d, 0x0c, 0x0d, 0x74, 0x1e, 0x0c,
+    0x19, 0xf0, 0x0a, 0x09, 0x1d, 0xa3, 0x0e, 0x0c, 0x0a, 0x09, 0x1b, 0x08,
+    0x07, 0x08, 0x09, 0xf2, 0x08, 0xf0, 0x07, 0x08, 0x27, 0x28, 0x09, 0x08,
+    0x09, 0x0a, 0x0b, 0x09, 0x0a, 0x22, 0x09, 0xf0, 0x0d, 0x08, 0x03, 0x36,
+    0xf4, 0x07, 0x18, 0x0a, 0x0b, 0x0f, 0x09, 0x08, 0x0a, 0x09, 0xf0, 0x0b,
+    0x1e, 0xf4, 0x0f, 0x0b, 0x0a, 0x0e, 0x0c, 0x0e, 0x0b, 0x0a, 0x49, 0xe0,
+    0x18, 0x07, 0x54, 0x08, 0x29, 0x08, 0x0d, 0x53, 0x1e, 0x0b, 0x18, 0x0b,
+    0xf1, 0xf1, 0x0a, 0x1d, 0x0c, 0x0e, 0x2f, 0x0e, 0x0c, 0x0e, 0x0b, 0x1c,
+    0x0d, 0x1e, 0xf1, 0xf1, 0x2d, 0x1e, 0x0d, 0x0c, 0x3e, 0x0f, 0x0d, 0x0c,
+    0x0e, 0xb1, 0xb1, 0x0d, 0x2b, 0x0a, 0x0c, 0x0b, 0x0c, 0x0d, 0x1e, 0x09,
+    0x93, 0xf0, 0x0b, 0x1a, 0x0b, 0x1e, 0x1d, 0x0e, 0x0a, 0x54, 0x1b, 0x0c,
+    0x19, 0x1c, 0xf3, 0xf0, 0x2b, 0x0c, 0x0e, 0x1d, 0x2a, 0x2b, 0x0d, 0x0a,
+    0xf3, 0xf0, 0x49, 0x2a, 0x0e, 0x6f, 0xf3, 0xf0, 0x0d, 0x0c, 0x3e, 0x2c,
+    0x2a, 0x09, 0x0a, 0x0b, 0x0a, 0xf3, 0xf0, 0x09, 0x48, 0x19, 0xc8, 0xf3,
+    0xf0, 0x77, 0x18, 0x09, 0xe3, 0xf0, 0x0a, 0x19, 0x2a, 0x0b, 0x2a, 0x0b,
+    0x0c, 0x0e, 0x0f, 0x0b, 0xa4, 0x0c, 0xf0, 0x0b, 0x0d, 0x0e, 0x0c, 0x1b,
+    0x1a, 0x09, 0x2e, 0x73, 0x0c, 0x0b, 0x28, 0xf0, 0x0d, 0x92, 0x0e, 0x0d,
+    0x1e, 0x0c, 0x0d, 0x0e, 0x0d, 0x0e, 0x0d, 0xf3, 0x0e, 0x0b, 0x09, 0x0b,
+    0xf0, 0x0a, 0x08, 0x0e, 0x0d, 0x0a, 0x09, 0x08, 0x0c, 0x0e, 0x1f, 0x0e,
+    0xf3, 0x0c, 0x2b, 0xf0, 0x2a, 0x18, 0x19, 0x1a, 0x0d, 0x1c, 0x13, 0x0e,
+    0x08, 0xf4, 0x19, 0xf0, 0x0e, 0x0d, 0x0a, 0x08, 0x07, 0x18, 0x0a, 0x09,
+    0x0d, 0x0b, 0x08, 0x0a, 0x09, 0x84, 0x0b, 0x29, 0xf0, 0x18, 0x07, 0x06,
+    0x08, 0xf3, 0x3a, 0x09, 0x08, 0x09, 0x1a, 0xf0, 0x19, 0x08, 0x09, 0x08,
+    0x09, 0x88, 0xf3, 0x09, 0xf0, 0x28, 0x09, 0x08, 0x09, 0x0a, 0xf3, 0x09,
+    0x0a, 0x09, 0x4a, 0x0b, 0xf0, 0x29, 0x1a, 0x19, 0xf3, 0x28, 0x09, 0x0c,
+    0x08, 0x07, 0x0a, 0x0d, 0xf0, 0x09, 0x08, 0x19, 0x0a, 0x09, 0x1b, 0xf3,
+    0x0c, 0x0b, 0x0c, 0x0d, 0x0b, 0x0c, 0x0b, 0x0c, 0xf0, 0x5e, 0x0c, 0xf3,
+    0x0e, 0x0d, 0x0c, 0x1e, 0x0f, 0x0e, 0x0a, 0x0e, 0xf0, 0x0f, 0x0a, 0x08,
+    0x07, 0x0a, 0x09, 0x08, 0xf3, 0x39, 0x0a, 0x19, 0x0a, 0x0b, 0xf0, 0x08,
+    0x09, 0x0b, 0x2a, 0x1b, 0xf3, 0x09, 0x1a, 0x09, 0x0b, 0x0a, 0x0b, 0x0a,
+    0xf0, 0x08, 0x09, 0x0a, 0x09, 0x1a, 0x0d, 0xb3, 0x09, 0x0a, 0x0c, 0x0b,
+    0x0a, 0x0b, 0x0d, 0x2b, 0xf0, 0x0d, 0x09, 0x54, 0x18, 0x09, 0x08, 0x09,
+    0x0b, 0xf3, 0x0a, 0x0e, 0x0c, 0x0e, 0x0c, 0x0b, 0x09, 0xf0, 0x1a, 0x1b,
+    0x1d, 0x08, 0x09, 0x0a, 0xf3, 0x18, 0x1b, 0x3a, 0xf0, 0x29, 0x3b, 0x1a,
+    0xf3, 0x09, 0x4a, 0xf0, 0x0b, 0x19, 0x1b, 0x0d, 0x1c, 0x1b, 0xf3, 0x1a,
+    0x0c, 0x0b, 0x0c, 0x0e, 0xf0, 0x0a, 0x09, 0x0c, 0x0e, 0x1b, 0x1c, 0x1a,
+    0xf3, 0x0c, 0x0b, 0x1a, 0x0b, 0x1a, 0xf0, 0x09, 0x28, 0x0b, 0x0d, 0x08,
+    0x06, 0xf3, 0x08, 0x0b, 0x19, 0x0b, 0x08, 0x07, 0xf0, 0x08, 0x09, 0x1a,
+    0x0b, 0x0c, 0x0b, 0x09, 0x0a, 0xf3, 0x0b, 0x2a, 0x0b, 0x09, 0x0a, 0xf0,
+    0x1c, 0x0b, 0x09, 0x0d, 0x0f, 0x0c, 0x0b, 0x0c, 0xd3, 0x0e, 0x0b, 0x0c,
+    0x1b, 0x1d, 0xf0, 0x1c, 0x1d, 0x1a, 0x07, 0x84, 0x76, 0x09, 0xf3, 0xf0,
+    0x1a, 0x0b, 0x0c, 0x0b, 0x1a, 0x0c, 0x0a, 0x0b, 0x0d, 0x0b, 0x0d, 0x0e,
+    0x1c, 0xf3, 0xf0, 0x0b, 0x0a, 0x0c, 0x0a, 0x2b, 0x0a, 0x28, 0x1b, 0x0c,
+    0x0a, 0x09, 0xf3, 0xf0, 0x0a, 0x0b, 0x0f, 0x0a, 0x0b, 0x1c, 0x0a, 0x18,
+    0x09, 0x0a, 0x19, 0x08, 0x19, 0xf3, 0xf0, 0x08, 0x19, 0x0b, 0x09, 0x18,
+    0x09, 0x18, 0x0a, 0x0b, 0x09, 0x0a, 0x0b, 0xf3, 0xf0, 0x0a, 0x09, 0x0a,
+    0x1b, 0x0a, 0x39, 0x0a, 0x1c, 0x0d, 0x0e, 0x39, 0x34, 0xf0, 0x0c, 0xf3,
+    0x0e, 0x0d, 0x4b, 0x1a, 0x0b, 0x0a, 0x1b, 0xf0, 0x0c, 0x0b, 0x09, 0xf3,
+    0x2a, 0x09, 0x5a, 0x0b, 0x0c, 0xf0, 0x0b, 0x0c, 0x1b, 0xf3, 0x4c, 0x1b,
+    0x0c, 0x2a, 0x09, 0xf0, 0x1a, 0x0c, 0x1b, 0xf3, 0x0e, 0x0d, 0x0b, 0x1c,
+    0x1b, 0x1a, 0x5b, 0xf0, 0xf3, 0x0a, 0x1b, 0x5a, 0x39, 0xf0, 0x1a, 0x3b,
+    0xf3, 0x4a, 0x0b, 0x6a, 0xf0, 0xf3, 0x1b, 0x0a, 0x2b, 0x0a, 0x09, 0x5a,
+    0xf0, 0x09, 0x0a, 0xf3, 0x18, 0x89, 0x0a, 0xf0, 0x19, 0x0a, 0x39, 0xf3,
+    0x1a, 0x29, 0x3a, 0xf0, 0x09, 0x1a, 0x09, 0xf3, 0x1a, 0x19, 0x0b, 0x09,
+    0x0a, 0x09, 0x08, 0x49, 0xf0, 0x0a, 0x09, 0xf3, 0x0a, 0x2b, 0x2a, 0x1b,
+    0x0a, 0x3b, 0xf0, 0x0c, 0x1b, 0xf3, 0x0e, 0x0b, 0x1c, 0x1b, 0x0a, 0x0b,
+    0x09, 0x2a, 0xf0, 0x1b, 0x1a, 0xe3, 0x29, 0x0a, 0x19, 0x0b, 0x0a, 0x0b,
+    0x0e, 0x0b, 0xf0, 0x0c, 0x0e, 0x08, 0xf4, 0x19, 0x4a, 0x0b, 0x2a, 0x09,
+    0x0a, 0xf0, 0x0b, 0x0a, 0x09, 0x04, 0x0e, 0xb3, 0x0d, 0x1c, 0x0b, 0x0c,
+    0x09, 0x0b, 0x0c, 0x09, 0x0a, 0x09, 0x4f, 0xf2, 0xf0, 0x0e, 0x0d, 0x0c,
+    0x0b, 0x1c, 0x0d, 0x1c, 0x0e, 0x0d, 0x07, 0xf3, 0xf0, 0x48, 0x09, 0x0a,
+    0x09, 0x1a, 0x2b, 0x0c, 0x2d, 0xf3, 0xf0, 0x0c, 0x0d, 0x0e, 0x2c, 0x4b,
+    0x0a, 0x0b, 0x0a, 0x1b, 0xf3, 0xf0, 0x1a, 0x5b, 0x0a, 0x3b, 0x4a, 0xd3,
+    0xf0, 0x0b, 0x0a, 0x0b, 0x3a, 0x29, 0x06, 0x04, 0x65, 0x65, 0xf0, 0xd6,
+    0xd4, 0xf0, 0x19, 0xf3, 0x1a, 0xab, 0xf0, 0x1c, 0xf3, 0x3b, 0x0c, 0x2b,
+    0x5a, 0xf0, 0x09, 0x1a, 0xf3, 0x09, 0x0a, 0x09, 0x0a, 0x1b, 0x0c, 0x1b,
+    0x0c, 0x0b, 0xf0, 0xaa, 0xf3, 0x1b, 0x0c, 0x0a, 0x0b, 0xf0, 0x0c, 0x0b,
+    0x3c, 0xf3, 0x1d, 0x0b, 0x0d, 0x0e, 0x1c, 0x0d, 0x2c, 0xf0, 0x5b, 0xf3,
+    0xda, 0xf0, 0xf3, 0x09, 0x1a, 0x09, 0x2a, 0x09, 0x1a, 0x09, 0xf0, 0x9a,
+    0xf3, 0x0b, 0xaa, 0xf0, 0xf3, 0xa9, 0xf0, 0x2a, 0xf3, 0x0b, 0x1a, 0x3b,
+    0x0c, 0xab, 0xf0, 0xf3, 0x0a, 0x09, 0x2a, 0x09, 0x0a, 0x59, 0xf0, 0xf3,
+    0x0a, 0xd9, 0xf0, 0x1a, 0xf3, 0x0b, 0x1a, 0x3b, 0x2c, 0x3b, 0xf0, 0x0c,
+    0xf3, 0x0b, 0x1d, 0x3b, 0x1c, 0x1b, 0x0a, 0xf0, 0x09, 0x0b, 0x09, 0x1b,
+    0xf3, 0x0a, 0x0e, 0x09, 0x0b, 0x0a, 0x09, 0x0a, 0x09, 0x0c, 0x2a, 0xf0,
+    0x29, 0xf3, 0x3a, 0x09, 0x0a, 0x39, 0x0a, 0x09, 0xf0, 0x1a, 0x1b, 0xf3,
+    0x0a, 0x0c, 0x0e, 0x1b, 0x0a, 0x0c, 0x0b, 0x0a, 0x0d, 0x0e, 0x0b, 0xf0,
+    0x0a, 0x0b, 0x0c, 0x0a, 0xf3, 0x0c, 0x0d, 0x3a, 0x09, 0x2a, 0x49, 0xf0,
+    0x0a, 0xf3, 0x29, 0x08, 0x29, 0x1a, 0x19, 0x0a, 0xf0, 0x09, 0x2a, 0xf3,
+    0x0b, 0x1a, 0x6b, 0xca, 0xf0, 0xf3, 0x2b, 0x1c, 0xf0, 0x0b, 0x19, 0x1a,
+    0xf3, 0x0b, 0x3a, 0x09, 0x2a, 0x0b, 0x1a, 0xf0, 0x39, 0xf3, 0x5a, 0x19,
+    0x1a, 0x0b, 0xf0, 0x1a, 0x29, 0xf3, 0x0a, 0x2b, 0x0a, 0xdb, 0xf0, 0xf3,
+    0xaa, 0xf0, 0x09, 0xf3, 0xfa, 0xf0, 0xf3, 0x0a, 0x79, 0x0a, 0x29, 0xf0,
+    0x5a, 0xf3, 0x09, 0xfa, 0xf0, 0xf3, 0xfa, 0xf0, 0xf3, 0xfa, 0xf0, 0xf3,
+    0xda, 0x60, 0x23, 0x0a, 0x03, 0x00
+};
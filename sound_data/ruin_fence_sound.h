@@ -0,0 +1,275 @@
+const uint8_t ruin_fence_sound [] = {
+    0xd4, 0xcb, 0xf0, 0x0a, 0x63, 0x0d, 0x0a, 0x29, 0xf0, 0x0a, 0x0b, 0x04,
+    0x08, 0x55, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0d, 0x76, 0x0a, 0x0b, 0x2a,
+    0xf0, 0x2b, 0x05, 0x0e, 0xf4, 0x0f, 0x0e, 0x0d, 0x1c, 0x1b, 0x0c, 0x2d,
+    0x2e, 0xf0, 0x0c, 0x1b, 0x44, 0x1c, 0x0b, 0x0a, 0x33, 0x0e, 0x1d, 0x0e,
+    0x94, 0x0a, 0x2b, 0xf0, 0x0c, 0x1e, 0x1d, 0x0e, 0xc5, 0x0a, 0x6b, 0x2c,
+    0xf0, 0x0b, 0x0a, 0x54, 0x0e, 0x0d, 0x0b, 0x0a, 0x19, 0x53, 0x0b, 0x19,
+    0x28, 0xf0, 0x72, 0x0c, 0x0b, 0x0a, 0x1b, 0x0d, 0x0e, 0x0f, 0x23, 0x0a,
+    0x0b, 0x0d, 0x24, 0x09, 0x0b, 0x0d, 0xc5, 0x2a, 0xf0, 0x09, 0x3a, 0x09,
+    0x0a, 0x0b, 0x0c, 0x0d, 0x86, 0x0b, 0x0c, 0x0d, 0x1e, 0xf0, 0x0d, 0x2b,
+    0xc5, 0x0e, 0x0d, 0x0c, 0x0b, 0x2a, 0x19, 0x3a, 0xf0, 0xd4, 0x1e, 0x0d,
+    0x5c, 0x3d, 0x0e, 0x45, 0x1a, 0xf0, 0x1b, 0x0d, 0xd6, 0x0a, 0x1b, 0x2a,
+    0x0b, 0x1a, 0x0b, 0x0c, 0x0d, 0xf0, 0x0c, 0x0a, 0x25, 0x0b, 0x0a, 0x09,
+    0xd4, 0x0c, 0x0b, 0x1a, 0x09, 0x3a, 0x19, 0xf0, 0x1a, 0x09, 0xf3, 0x0e,
+    0x0c, 0x3a, 0x49, 0x0a, 0x0b, 0xf0, 0x0d, 0x4e, 0x23, 0xd4, 0x39, 0x1a,
+    0x1c, 0x0b, 0x1a, 0xf0, 0x0b, 0x0d, 0x0e, 0x65, 0x1a, 0x1b, 0x0c, 0x1d,
+    0x16, 0x1a, 0x25, 0x0d, 0x0b, 0x0a, 0xf0, 0x94, 0x1e, 0x0d, 0x0b, 0x1a,
+    0x1b, 0x0a, 0x09, 0x53, 0x5e, 0xf0, 0xf4, 0x09, 0x0a, 0x29, 0x2a, 0x29,
+    0x0a, 0x0b, 0x0c, 0x0d, 0x1c, 0xf0, 0x34, 0x0b, 0x0a, 0x09, 0xf3, 0x0e,
+    0x0d, 0x0c, 0x0b, 0x0a, 0x2b, 0x0a, 0x38, 0xf0, 0x29, 0x33, 0x0a, 0x0b,
+    0x0e, 0x0f, 0x04, 0x0d, 0x05, 0x0b, 0xf6, 0x0a, 0x0c, 0x1e, 0x0d, 0x0c,
+    0xf0, 0x0b, 0x5a, 0x0b, 0x0c, 0x0e, 0x07, 0x0c, 0x28, 0x0b, 0x0c, 0x1b,
+    0x07, 0x06, 0x0a, 0xf0, 0x05, 0x09, 0x04, 0x18, 0x03, 0x62, 0x09, 0x17,
+    0x08, 0x09, 0x0a, 0x0c, 0x03, 0x08, 0x54, 0x07, 0x08, 0x0a, 0x0b, 0x0c,
+    0xf0, 0x0e, 0x05, 0x0c, 0x06, 0x0b, 0x17, 0x3a, 0x06, 0x05, 0x64, 0x0b,
+    0x29, 0x0a, 0x0b, 0x0d, 0x05, 0x0b, 0x26, 0x0a, 0xf0, 0x1b, 0x05, 0x0c,
+    0x14, 0x0e, 0x0a, 0x03, 0x0b, 0x22, 0x0e, 0x0c, 0x0d, 0x03, 0x29, 0x04,
+    0x05, 0x06, 0x0a, 0x07, 0x0b, 0x08, 0x0c, 0x09, 0x0d, 0xf0, 0x0a, 0x0e,
+    0x0c, 0x0d, 0x0b, 0x0e, 0x0a, 0x0d, 0x09, 0x4c, 0x08, 0x07, 0x06, 0x05,
+    0x24, 0x0d, 0x0a, 0x08, 0x03, 0x09, 0x32, 0x0b, 0x19, 0xf0, 0x0d, 0x03,
+    0x0a, 0x24, 0x09, 0x0a, 0x0c, 0x05, 0x1a, 0x26, 0x0b, 0x0a, 0x05, 0x09,
+    0x03, 0x0a, 0x02, 0x08, 0x51, 0x09, 0x17, 0x08, 0xf0, 0x0a, 0x0f, 0x02,
+    0x0d, 0x03, 0x0c, 0x04, 0x0b, 0x05, 0x2a, 0x26, 0x19, 0x05, 0x44, 0x0a,
+    0x19, 0x0a, 0x0c, 0x35, 0x0b, 0xf0, 0x0e, 0x0d, 0x0a, 0x34, 0x0b, 0x19,
+    0x0c, 0x05, 0x0d, 0x07, 0x1c, 0x09, 0x0b, 0x0b, 0x09, 0x1c, 0x07, 0x06,
+    0x1a, 0x05, 0x04, 0x09, 0xf0, 0x23, 0x0b, 0x0a, 0x0c, 0x14, 0x09, 0x1d,
+    0x05, 0x06, 0x0e, 0x08, 0x0c, 0x09, 0x0e, 0x0a, 0x0d, 0x09, 0x0c, 0x07,
+    0x0b, 0x05, 0x0c, 0x04, 0x0a, 0x53, 0x0b, 0x19, 0xf0, 0x18, 0x07, 0x32,
+    0x09, 0x08, 0x09, 0x0e, 0x03, 0x0b, 0x84, 0x09, 0x0a, 0x19, 0x28, 0xf0,
+    0x09, 0x0b, 0x35, 0x0a, 0x1d, 0x0b, 0x54, 0x0e, 0x1c, 0x0d, 0x0c, 0x09,
+    0x23, 0x1a, 0x0c, 0x04, 0x0b, 0xf0, 0x05, 0x0c, 0x26, 0x0d, 0x0e, 0x1b,
+    0x05, 0x04, 0x0a, 0x03, 0x09, 0x02, 0x08, 0x31, 0x09, 0x08, 0x09, 0x0c,
+    0x12, 0x09, 0x0d, 0x03, 0x1a, 0x04, 0xf0, 0x05, 0x0c, 0x16, 0x2e, 0x05,
+    0x04, 0x0c, 0x23, 0x0e, 0x0c, 0x0e, 0x04, 0x0d, 0x05, 0x0e, 0x07, 0x0c,
+    0x09, 0x0d, 0x0c, 0x3e, 0x0e, 0x0b, 0x07, 0xf0, 0x05, 0x0c, 0x04, 0x1b,
+    0x13, 0x08, 0x02, 0x0a, 0x21, 0x0f, 0x0d, 0x0e, 0x12, 0x09, 0x0d, 0x03,
+    0x0b, 0x04, 0x0a, 0x25, 0x09, 0x0a, 0x09, 0x04, 0x1a, 0xf0, 0x03, 0x02,
+    0x0b, 0x61, 0x6f, 0x12, 0x0a, 0x0d, 0x33, 0x09, 0x0a, 0x0b, 0x0e, 0x04,
+    0x4b, 0xf0, 0x05, 0x26, 0x05, 0x0d, 0x54, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a,
+    0x08, 0x03, 0x09, 0x32, 0x0a, 0x19, 0x0b, 0x30, 0x03, 0x0a, 0x04, 0x0e,
+    0x06, 0x0f, 0x0a, 0x07, 0xf1, 0x0c, 0x09, 0x0e, 0x0a, 0x0c, 0x1b, 0x09,
+    0x06, 0x1a, 0x04, 0x03, 0x08, 0x52, 0x09, 0x08, 0x09, 0x0a, 0x0c, 0x0f,
+    0x03, 0x1d, 0x04, 0x05, 0x0c, 0xf1, 0x36, 0x2a, 0x09, 0x25, 0x0b, 0x09,
+    0x08, 0x04, 0x09, 0x03, 0x0a, 0x12, 0x0c, 0x08, 0x01, 0x0a, 0x30, 0x0e,
+    0x1a, 0x0f, 0xb1, 0x01, 0x0c, 0x02, 0x0b, 0x03, 0x1c, 0x05, 0x08, 0x0e,
+    0x0d, 0x1f, 0x2f, 0x0e, 0x0a, 0x0e, 0x09, 0x0c, 0x07, 0x09, 0x0e, 0xf0,
+    0x07, 0x1b, 0x05, 0x04, 0x1a, 0x33, 0x08, 0x09, 0x0b, 0x14, 0x09, 0x0a,
+    0x03, 0x0d, 0x02, 0x0e, 0x21, 0x0f, 0x0c, 0x0e, 0x02, 0x0c, 0x03, 0x0b,
+    0xf0, 0x14, 0x09, 0x08, 0x23, 0x1a, 0x0e, 0x05, 0x0a, 0x07, 0x1b, 0x1a,
+    0x0d, 0x09, 0x1e, 0x28, 0x0c, 0x3d, 0x09, 0x1a, 0xa0, 0x09, 0x0c, 0x07,
+    0x0b, 0x05, 0x0a, 0x03, 0x0b, 0x02, 0x08, 0x01, 0x07, 0xf0, 0x09, 0x08,
+    0x09, 0x0e, 0x58, 0xc1, 0x0a, 0x0b, 0x1c, 0x0d, 0x0e, 0x20, 0x0f, 0x09,
+    0xf2, 0x0e, 0x01, 0x0d, 0x03, 0x0b, 0x05, 0x0d, 0x08, 0x0b, 0x19, 0x0c,
+    0x1d, 0x0a, 0x1c, 0x0c, 0x0b, 0x09, 0x0a, 0x06, 0x09, 0x04, 0x08, 0x03,
+    0x07, 0x32, 0x29, 0xf2, 0x08, 0x21, 0x1c, 0x0e, 0x02, 0x0b, 0x03, 0x0c,
+    0x05, 0x3b, 0x08, 0x0e, 0x1f, 0x07, 0x09, 0x04, 0x04, 0x02, 0x01, 0x01,
+    0x40, 0x20, 0x02, 0x31, 0x01, 0x33, 0x01, 0x02, 0x03, 0x03, 0x07, 0x04,
+    0x0d, 0x04, 0x05, 0x4f, 0x05, 0x07, 0x07, 0x08, 0x18, 0x09, 0x0a, 0x06,
+    0x1c, 0x0c, 0x05, 0x07, 0x04, 0x0b, 0x04, 0x03, 0x0a, 0x02, 0x02, 0x0b,
+    0x01, 0x11, 0x0c, 0x30, 0x09, 0x60, 0x0b, 0x09, 0x0c, 0x01, 0x09, 0x32,
+    0x08, 0x0a, 0x0d, 0x11, 0x08, 0x03, 0x09, 0x04, 0x42, 0x47, 0x06, 0x08,
+    0x09, 0x0a, 0x07, 0x33, 0x26, 0x05, 0x03, 0x02, 0x05, 0x01, 0x04, 0x04,
+    0x20, 0x18, 0x43, 0x0c, 0x01, 0x0a, 0x03, 0x08, 0x06, 0x0d, 0x42, 0x0b,
+    0x2e, 0x2f, 0x08, 0x0b, 0x07, 0x11, 0x06, 0x14, 0x03, 0x70, 0x01, 0x03,
+    0x50, 0x02, 0x21, 0x03, 0x08, 0x01, 0x09, 0x01, 0x03, 0x0b, 0x02, 0x07,
+    0x0c, 0x03, 0x0e, 0x0b, 0x05, 0x2f, 0x0e, 0x07, 0x0f, 0x18, 0x0b, 0x0c,
+    0x06, 0x09, 0x06, 0x04, 0x0a, 0x03, 0x13, 0x09, 0x01, 0x17, 0x40, 0x02,
+    0x01, 0x06, 0xf0, 0x18, 0x0a, 0x01, 0x07, 0x02, 0x16, 0x83, 0x08, 0x1a,
+    0x09, 0x18, 0x09, 0x0b, 0x04, 0x0c, 0x06, 0x0b, 0x08, 0x80, 0x0d, 0x0b,
+    0x1e, 0x1e, 0x3d, 0x0b, 0x0a, 0x0b, 0x1d, 0x0e, 0x0f, 0x19, 0x01, 0x0d,
+    0x42, 0x0a, 0x0e, 0x0c, 0x1f, 0x0e, 0x0c, 0x0e, 0x1a, 0x0f, 0x51, 0x0b,
+    0x08, 0x09, 0x06, 0x07, 0x05, 0x16, 0x04, 0x03, 0x04, 0x12, 0x12, 0x03,
+    0x12, 0x03, 0x21, 0x12, 0x01, 0x50, 0x04, 0xf0, 0x03, 0x02, 0x11, 0x22,
+    0x01, 0x02, 0x03, 0x23, 0x05, 0x07, 0x06, 0x14, 0x37, 0x05, 0x26, 0x06,
+    0xb0, 0x04, 0x07, 0x03, 0x08, 0x02, 0x09, 0x01, 0x0a, 0x40, 0x0d, 0x08,
+    0x17, 0x0d, 0x01, 0x0c, 0x02, 0x0f, 0x03, 0x0a, 0x11, 0x05, 0x0e, 0x08,
+    0x09, 0x12, 0x0d, 0x0d, 0x3f, 0x0a, 0x53, 0x0d, 0x0e, 0x0a, 0x0b, 0x08,
+    0x07, 0x07, 0x05, 0x09, 0x02, 0x14, 0x0f, 0x41, 0x0a, 0x03, 0x09, 0x02,
+    0x18, 0x61, 0x0e, 0xf0, 0x0c, 0x1a, 0x0b, 0x0e, 0x42, 0x09, 0x1a, 0x09,
+    0x08, 0x71, 0x0d, 0x2a, 0x2b, 0xf0, 0x0e, 0x02, 0x19, 0x03, 0x14, 0x38,
+    0x03, 0x02, 0x01, 0x09, 0x20, 0x0c, 0x0a, 0x0d, 0x01, 0x39, 0x02, 0x03,
+    0x44, 0x70, 0x0c, 0x2d, 0x05, 0x0a, 0x26, 0x0b, 0x0f, 0x09, 0x21, 0x07,
+    0x0a, 0x09, 0x0d, 0x0c, 0x09, 0x42, 0x2f, 0x0c, 0x0f, 0x0d, 0x0a, 0x0a,
+    0x06, 0x0f, 0xd1, 0x04, 0x0b, 0x03, 0x18, 0x12, 0x06, 0x01, 0x07, 0x40,
+    0x09, 0x06, 0x05, 0x06, 0x1a, 0x01, 0x02, 0x0d, 0x04, 0x0b, 0x06, 0x07,
+    0x92, 0x09, 0x08, 0x0e, 0x0a, 0x3f, 0x0c, 0x1f, 0x0e, 0x0d, 0x0c, 0x08,
+    0x0b, 0x06, 0x09, 0x35, 0x0f, 0xd1, 0x0d, 0x0c, 0x0e, 0x06, 0x0c, 0x07,
+    0x1d, 0x09, 0x1e, 0x1b, 0x0d, 0x09, 0x0c, 0x07, 0x0e, 0x04, 0x0b, 0x02,
+    0x06, 0x01, 0x02, 0x02, 0x90, 0x01, 0x11, 0x40, 0x20, 0x11, 0x01, 0x02,
+    0x02, 0x04, 0x13, 0x05, 0xf1, 0x07, 0x04, 0x0a, 0x05, 0x0e, 0x07, 0x2f,
+    0x0a, 0x0e, 0x0d, 0x0a, 0x0c, 0x06, 0x0a, 0x03, 0x0b, 0x02, 0x08, 0x41,
+    0x1a, 0x0c, 0x0b, 0x08, 0x70, 0x0d, 0x61, 0x0a, 0x0b, 0x1e, 0x1c, 0x09,
+    0x32, 0x01, 0x08, 0x02, 0x0c, 0x04, 0x0d, 0x06, 0x0a, 0x03, 0x09, 0x09,
+    0x04, 0x0d, 0x0a, 0x05, 0x1f, 0x1b, 0x06, 0x27, 0x0d, 0x0c, 0x09, 0x0e,
+    0x68, 0x0b, 0x08, 0x0a, 0x09, 0x0b, 0x0a, 0x2c, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x1e, 0x09, 0x3f, 0x0c, 0x3f, 0x2f, 0x0c, 0x0e, 0x0d, 0x1e, 0x2f, 0x09,
+    0x08, 0x0c, 0x05, 0x1d, 0x0b, 0x03, 0x05, 0x02, 0x0c, 0x03, 0x01, 0x1a,
+    0x02, 0x60, 0x01, 0x07, 0x50, 0x06, 0x03, 0x12, 0x03, 0x02, 0x02, 0x02,
+    0x03, 0xf1, 0x04, 0x14, 0x08, 0x0c, 0x05, 0x1d, 0x07, 0x09, 0x0c, 0x08,
+    0x08, 0x07, 0x06, 0x05, 0x05, 0x03, 0x04, 0x12, 0x02, 0x01, 0x11, 0x40,
+    0x50, 0x01, 0x42, 0x01, 0x03, 0x04, 0x01, 0x06, 0x02, 0x08, 0x03, 0x23,
+    0x0d, 0x05, 0x3f, 0x08, 0x09, 0x24, 0x0d, 0x0e, 0x0e, 0x0f, 0x23, 0x08,
+    0x0b, 0x05, 0x07, 0x03, 0x08, 0x02, 0x22, 0x0b, 0x01, 0x0f, 0xf0, 0x29,
+    0x01, 0x70, 0x05, 0x23, 0x04, 0x05, 0x08, 0x31, 0x06, 0x08, 0x09, 0x0d,
+    0x02, 0x0b, 0x04, 0x09, 0xf0, 0x06, 0x0a, 0x09, 0x09, 0x1a, 0x0a, 0x3b,
+    0x09, 0x07, 0x05, 0x04, 0x3a, 0x03, 0x02, 0x01, 0xa0, 0x0c, 0x07, 0x06,
+    0x05, 0x26, 0xf0, 0x07, 0x08, 0x0a, 0x0e, 0x01, 0x18, 0x02, 0x03, 0x19,
+    0x05, 0x06, 0x2b, 0x17, 0x06, 0x0c, 0x25, 0x0e, 0x0d, 0xf0, 0x0e, 0x36,
+    0x0c, 0x0d, 0x0c, 0x3a, 0x05, 0x04, 0x03, 0x02, 0x0c, 0xa1, 0x0f, 0x0d,
+    0x0a, 0x08, 0x37, 0x70, 0x09, 0x0d, 0x0f, 0x02, 0x0b, 0x03, 0x0a, 0x04,
+    0x0e, 0x05, 0x08, 0x51, 0x06, 0x19, 0x17, 0x0b, 0x08, 0x0c, 0x0a, 0x0e,
+    0x0c, 0x09, 0x72, 0x0d, 0x0c, 0x3f, 0x0e, 0x2f, 0x0e, 0x0d, 0x0c, 0x09,
+    0x08, 0x0f, 0x61, 0x06, 0x0d, 0x04, 0x0b, 0x03, 0x09, 0x02, 0x18, 0x01,
+    0x60, 0x0a, 0x0e, 0xf0, 0x0a, 0x09, 0x0a, 0x0d, 0x0f, 0x11, 0x09, 0x0e,
+    0x02, 0x1c, 0x93, 0x1f, 0x0e, 0x0d, 0x0c, 0x1b, 0xf0, 0x0d, 0x0f, 0x04,
+    0x0e, 0x05, 0x1c, 0x06, 0x57, 0x0b, 0x0c, 0x1b, 0x0c, 0x0d, 0x18, 0x0c,
+    0x0e, 0x0a, 0x1d, 0x0e, 0x4f, 0x0c, 0xf0, 0x2e, 0x0d, 0x0e, 0x0e, 0x0b,
+    0x1d, 0x09, 0x18, 0x1e, 0x09, 0x0d, 0x1b, 0x1b, 0x0a, 0x0a, 0x08, 0x3b,
+    0x07, 0x06, 0xf0, 0x05, 0x54, 0x0c, 0x29, 0x0a, 0x0c, 0x15, 0x0a, 0x3d,
+    0x06, 0x08, 0x0c, 0x1f, 0x2c, 0x0c, 0x0a, 0x0a, 0xf0, 0x09, 0x39, 0x08,
+    0x07, 0x06, 0x05, 0x0a, 0x04, 0x0b, 0x33, 0x0e, 0x0b, 0x09, 0x08, 0x92,
+    0x0d, 0x0b, 0x0a, 0x19, 0x08, 0xf0, 0x17, 0x08, 0x0b, 0x03, 0x1a, 0x04,
+    0x05, 0x0b, 0x16, 0x0a, 0x1c, 0x07, 0x18, 0x0b, 0x0c, 0x07, 0x0d, 0x16,
+    0x0e, 0x0b, 0x05, 0x0c, 0xf0, 0x04, 0x0d, 0x33, 0x0e, 0x0a, 0x09, 0x08,
+    0x02, 0x0b, 0x61, 0x0e, 0x09, 0x08, 0x09, 0x0a, 0x0c, 0x0e, 0x02, 0x1a,
+    0x03, 0x04, 0x0c, 0xf0, 0x05, 0x0d, 0x06, 0x0e, 0x08, 0x0c, 0x0a, 0x2d,
+    0x0e, 0x2f, 0x0e, 0x2f, 0x0d, 0x0a, 0x0b, 0x2e, 0x0d, 0x1f, 0x3d, 0x0d,
+    0x1a, 0xf0, 0x0b, 0x0c, 0x09, 0x0b, 0x07, 0x19, 0x35, 0x28, 0x04, 0x09,
+    0x03, 0x0a, 0x12, 0x1e, 0x03, 0x09, 0x44, 0x08, 0x09, 0x0b, 0xf0, 0x0a,
+    0x18, 0x03, 0x02, 0x09, 0x21, 0x0c, 0x0a, 0x08, 0x40, 0x0e, 0x09, 0x08,
+    0x09, 0x0c, 0x11, 0x08, 0x0c, 0x02, 0x19, 0x13, 0xf0, 0x0e, 0x74, 0x0b,
+    0x2e, 0x2c, 0x0b, 0x33, 0x0d, 0x0a, 0x08, 0x07, 0x02, 0x08, 0x01, 0x0a,
+    0x90, 0x0e, 0x30, 0x08, 0x16, 0x23, 0xf1, 0x04, 0x05, 0x08, 0x01, 0x07,
+    0x02, 0x08, 0x03, 0x0b, 0x05, 0x0e, 0x08, 0x6f, 0x0e, 0x0f, 0x0e, 0x0c,
+    0x0e, 0x1f, 0xf1, 0x0e, 0x0c, 0x0d, 0x08, 0x0e, 0x07, 0x2b, 0x06, 0x05,
+    0x04, 0x0a, 0x03, 0x09, 0x22, 0x0b, 0x0a, 0x0d, 0x73, 0x09, 0x4a, 0xf1,
+    0x0b, 0x0e, 0x14, 0x19, 0x03, 0x0c, 0x32, 0x0f, 0x0d, 0x0a, 0x09, 0x71,
+    0x0e, 0x0a, 0x19, 0x0a, 0x0c, 0xf1, 0x0e, 0x0f, 0x72, 0x0a, 0x0e, 0x1f,
+    0x0e, 0x0b, 0x0a, 0x09, 0x11, 0x0c, 0x08, 0x80, 0x0a, 0x07, 0x06, 0x15,
+    0xf1, 0x06, 0x07, 0x0a, 0x0f, 0x01, 0x0a, 0x02, 0x19, 0x03, 0x04, 0x0b,
+    0x05, 0x0c, 0x07, 0x0b, 0x08, 0x0d, 0x09, 0x0e, 0x0b, 0x0d, 0x1e, 0x1e,
+    0xf1, 0x0d, 0x0d, 0x0a, 0x0c, 0x07, 0x1b, 0x05, 0x04, 0x09, 0x03, 0x08,
+    0x52, 0x09, 0x08, 0x07, 0x18, 0x09, 0x03, 0x07, 0xc4, 0x06, 0x07, 0x08,
+    0xf1, 0x2a, 0x09, 0x18, 0x19, 0x0b, 0x0e, 0x05, 0x0d, 0x06, 0x1c, 0x07,
+    0x08, 0x2d, 0x09, 0x0a, 0x41, 0x1c, 0x0b, 0x0a, 0x0b, 0x09, 0x1a, 0x08,
+    0x0f, 0xf0, 0x1b, 0x0d, 0x1b, 0x0a, 0x08, 0x1c, 0x17, 0x0b, 0x46, 0x0d,
+    0x0c, 0x0d, 0x0c, 0x0b, 0x45, 0x0e, 0x0c, 0x1a, 0x09, 0xf0, 0x04, 0x0a,
+    0x13, 0x0c, 0x09, 0x02, 0x0a, 0x01, 0x0c, 0xb0, 0x0f, 0x0a, 0x08, 0x06,
+    0x35, 0x16, 0x08, 0xf0, 0x0e, 0x01, 0x1b, 0x02, 0x03, 0x2c, 0x04, 0x05,
+    0x06, 0x0d, 0x08, 0x3b, 0x0a, 0x1b, 0x3a, 0x1c, 0x1d, 0x08, 0x1e, 0xf0,
+    0x06, 0x05, 0x0c, 0x34, 0x0d, 0x0a, 0x09, 0x08, 0x23, 0x1b, 0x0d, 0x34,
+    0x09, 0x0b, 0x0c, 0x0e, 0x05, 0x0c, 0x46, 0x0b, 0x1c, 0xf0, 0x0d, 0x0e,
+    0x17, 0x0b, 0x0a, 0x06, 0x0b, 0x35, 0x0d, 0x1a, 0x0b, 0x66, 0x0a, 0x1b,
+    0x0c, 0x0d, 0x0e, 0xf0, 0x0c, 0x75, 0x0e, 0x0b, 0x0c, 0x0d, 0x0e, 0x0d,
+    0x0b, 0x0a, 0xd4, 0x0d, 0x0c, 0x2b, 0x0c, 0x2b, 0xf0, 0x0a, 0x19, 0x08,
+    0x07, 0x03, 0x09, 0x02, 0x0b, 0xb1, 0x1f, 0x0e, 0x0c, 0x09, 0x08, 0x17,
+    0xf0, 0x18, 0x09, 0x0c, 0x32, 0x08, 0x0a, 0x0b, 0x0e, 0x03, 0x2c, 0x04,
+    0xd5, 0x0e, 0x0d, 0x0c, 0x0d, 0xf0, 0x1e, 0x0d, 0x0c, 0x0b, 0x0a, 0x1b,
+    0x0d, 0xb6, 0x0b, 0x0c, 0x0d, 0x0c, 0x1b, 0x1c, 0xf0, 0x0b, 0x0a, 0x0b,
+    0x0d, 0x07, 0x4c, 0x68, 0x0d, 0x0e, 0x0d, 0x27, 0x0e, 0x0c, 0x0b, 0xf0,
+    0x46, 0x0e, 0x2d, 0x0e, 0x77, 0x0b, 0x1c, 0x2b, 0x1a, 0x06, 0x0b, 0x25,
+    0x1c, 0xf0, 0x0e, 0x46, 0x0c, 0x1e, 0x1d, 0x07, 0x0b, 0x28, 0x1a, 0x1b,
+    0x19, 0x0d, 0x0a, 0x0c, 0x09, 0x0b, 0x07, 0x0c, 0x06, 0x1b, 0xf0, 0x05,
+    0x64, 0x0e, 0x0c, 0x1a, 0x0b, 0x0a, 0x09, 0x23, 0x0e, 0x0d, 0x0e, 0x94,
+    0x6a, 0xf0, 0x29, 0xa3, 0x0e, 0x0b, 0x3a, 0x0b, 0x0e, 0x2f, 0xf0, 0xf4,
+    0x3b, 0x2a, 0x2b, 0x0a, 0x09, 0x28, 0x19, 0xf0, 0x04, 0x53, 0x0e, 0x0c,
+    0x0b, 0x0c, 0x1e, 0x54, 0x09, 0x3a, 0x0b, 0x25, 0x09, 0x1a, 0xf0, 0x14,
+    0x1c, 0x25, 0x0a, 0x0c, 0x0a, 0x24, 0x0d, 0x0b, 0x0c, 0x15, 0x1a, 0x14,
+    0x1d, 0x05, 0x0b, 0x06, 0x1a, 0x07, 0x06, 0x0c, 0xf0, 0x55, 0x0d, 0x1c,
+    0x0d, 0x0c, 0x0a, 0xf4, 0x0c, 0x4a, 0x09, 0x08, 0x27, 0xf0, 0x08, 0x09,
+    0x0b, 0x0c, 0x0d, 0x34, 0x2e, 0x0c, 0x93, 0x0f, 0x2e, 0x0d, 0x0b, 0xf0,
+    0x1a, 0x0b, 0x0d, 0x24, 0x09, 0x0a, 0x0b, 0xf5, 0x09, 0x3a, 0x0b, 0x2c,
+    0xf0, 0x0b, 0x1a, 0x39, 0x15, 0x08, 0x07, 0x24, 0x18, 0x07, 0x03, 0x08,
+    0x02, 0x09, 0x61, 0x0e, 0x0b, 0xf0, 0x1a, 0x09, 0x0a, 0x0b, 0x32, 0x07,
+    0x08, 0x09, 0x0c, 0x03, 0x1a, 0x04, 0x05, 0x19, 0x06, 0x07, 0x0a, 0x08,
+    0x1b, 0x0a, 0xf0, 0x1b, 0x3c, 0x0a, 0x09, 0x18, 0x0d, 0x0b, 0x07, 0x1c,
+    0x06, 0x15, 0x0d, 0x0a, 0x04, 0x0b, 0x13, 0x0e, 0x0b, 0xa2, 0x0f, 0x0d,
+    0x0a, 0xf0, 0x09, 0x18, 0x09, 0x0a, 0x0b, 0x0d, 0x0f, 0x33, 0x0a, 0x0c,
+    0x0d, 0x0e, 0x44, 0x0a, 0x0c, 0x2e, 0xf0, 0xc5, 0x0a, 0x0c, 0x0e, 0x0d,
+    0x1b, 0x0c, 0x1d, 0x1c, 0x0d, 0x0e, 0x36, 0x0a, 0x2b, 0xf0, 0x45, 0x1e,
+    0x0d, 0x0c, 0x0b, 0x64, 0x0e, 0x0c, 0x0b, 0x2a, 0x09, 0xf3, 0x0e, 0x0c,
+    0xf0, 0x5a, 0x0c, 0x4e, 0x0d, 0x0c, 0x03, 0x0a, 0x42, 0x0f, 0xf0, 0x0e,
+    0x0c, 0x0a, 0x09, 0x91, 0x2f, 0x0e, 0x0d, 0x1c, 0x1e, 0x0f, 0x22, 0x09,
+    0x0a, 0xf0, 0x0e, 0x13, 0x0a, 0x0e, 0x04, 0x0b, 0x25, 0x09, 0x1a, 0x06,
+    0x39, 0x07, 0x18, 0x67, 0x0a, 0x29, 0x3a, 0xf0, 0x06, 0x15, 0x0c, 0x0a,
+    0xc4, 0x0e, 0x0d, 0x0c, 0x0b, 0x3a, 0x1b, 0x0c, 0xf0, 0x1d, 0x55, 0x0a,
+    0x0b, 0x1d, 0x0c, 0x0a, 0x64, 0x2e, 0x0d, 0x0b, 0x09, 0x08, 0xf3, 0x0a,
+    0xf0, 0x69, 0x0a, 0x0c, 0x0d, 0x1e, 0x0d, 0x1c, 0x53, 0x0d, 0xf0, 0x4e,
+    0xf4, 0x09, 0x1a, 0x19, 0x1a, 0x1b, 0x0c, 0x1b, 0xf0, 0x0c, 0x0b, 0x1a,
+    0x34, 0x29, 0x08, 0x43, 0x09, 0x38, 0xa2, 0x2d, 0xf0, 0x0c, 0x1b, 0x0c,
+    0x0e, 0x2f, 0x03, 0x0a, 0x54, 0x08, 0x19, 0x0a, 0x0b, 0x0d, 0xf0, 0xf5,
+    0x0a, 0x0c, 0x0d, 0x0e, 0x0c, 0x0b, 0x0a, 0x0b, 0x1c, 0x0b, 0x0a, 0x29,
+    0x4a, 0xf0, 0x45, 0x0b, 0x16, 0x0a, 0x0b, 0xf5, 0x0c, 0x2b, 0x0c, 0x0b,
+    0x0a, 0x29, 0xf0, 0x0a, 0x0b, 0x0c, 0x3d, 0xf5, 0x4e, 0x0d, 0x0c, 0x1b,
+    0xf0, 0x4a, 0x1c, 0xf5, 0x0b, 0x0a, 0x3b, 0x2a, 0xf0, 0x09, 0x0a, 0x1b,
+    0x1c, 0x35, 0x2d, 0x0e, 0x56, 0x0b, 0x0d, 0x0e, 0x1c, 0xf0, 0x0d, 0x07,
+    0x0b, 0x28, 0x2a, 0x07, 0x0c, 0x16, 0x0e, 0x0b, 0xf5, 0x0e, 0x2c, 0x1d,
+    0x0c, 0x0b, 0xf0, 0x4a, 0x09, 0x0a, 0x0b, 0x95, 0x0d, 0x0e, 0x0d, 0x0c,
+    0x5a, 0xf0, 0x94, 0x0e, 0x0d, 0x2c, 0x0d, 0x3e, 0x65, 0x0a, 0x0b, 0x2c,
+    0xf0, 0x0d, 0x0e, 0x06, 0x0a, 0x57, 0x59, 0x06, 0x0a, 0xf5, 0x0d, 0x0c,
+    0x1b, 0x1a, 0xf0, 0x39, 0x2a, 0x29, 0x85, 0x0a, 0x0b, 0x0c, 0x1d, 0xf0,
+    0x2c, 0x0d, 0x36, 0x3a, 0x85, 0x0c, 0x1b, 0x0c, 0x1d, 0x0c, 0x0b, 0xf0,
+    0x0a, 0x64, 0x0e, 0x0c, 0x2b, 0x0a, 0x09, 0x13, 0x0b, 0x0a, 0xb2, 0x1f,
+    0x0e, 0x0d, 0x2b, 0xf0, 0x0c, 0x2e, 0x0f, 0x13, 0x0b, 0x0e, 0x34, 0x0a,
+    0x0b, 0x0c, 0x0e, 0x05, 0x0b, 0x86, 0x0a, 0x0b, 0x0c, 0xf0, 0x0d, 0x0e,
+    0x0d, 0x0c, 0x0b, 0x0a, 0x25, 0x0d, 0x0b, 0x0a, 0x24, 0x1e, 0x0c, 0x53,
+    0x0f, 0x0e, 0x0b, 0x0a, 0xf0, 0x09, 0x08, 0xa2, 0x0c, 0x0b, 0x0a, 0x19,
+    0x08, 0x09, 0x0a, 0x0b, 0x0d, 0x0e, 0x23, 0x09, 0x0a, 0x0b, 0xf0, 0xf4,
+    0x08, 0x19, 0x0a, 0x1b, 0x6c, 0x0d, 0x0c, 0x1b, 0xf0, 0xf4, 0x0c, 0x0d,
+    0x0e, 0x2c, 0x0d, 0x1e, 0x0d, 0x0c, 0x1d, 0x2e, 0xf0, 0xd4, 0x0d, 0x2e,
+    0x0d, 0x0c, 0x1b, 0x2a, 0x19, 0xf3, 0x0e, 0x0c, 0xf0, 0x0b, 0x0a, 0x2b,
+    0x0a, 0x0b, 0x1c, 0x2d, 0x6e, 0xb3, 0xf0, 0x0c, 0x0a, 0x19, 0x28, 0xd2,
+    0x3e, 0x0d, 0x5c, 0xf0, 0x0d, 0x0e, 0x0f, 0x13, 0x0a, 0x0c, 0x34, 0x0a,
+    0x0b, 0x0d, 0x0e, 0x55, 0x0a, 0x0b, 0xf0, 0x0c, 0x1d, 0x0e, 0x86, 0x1b,
+    0x1c, 0x3b, 0x0a, 0x45, 0x2d, 0xf0, 0x0c, 0x0b, 0xf4, 0x2e, 0x0d, 0x0c,
+    0x0b, 0x1a, 0x0b, 0x4a, 0xf0, 0x2b, 0xf4, 0x1a, 0x0b, 0x1c, 0x0d, 0xae,
+    0xf0, 0xf4, 0x0d, 0x0c, 0x0b, 0x0a, 0x1b, 0x5c, 0xf0, 0x0d, 0x0c, 0xf4,
+    0x2b, 0x1a, 0x19, 0x1a, 0x1b, 0x1a, 0x0b, 0xf0, 0x0c, 0x1d, 0xf4, 0x1b,
+    0x0a, 0x1b, 0x1a, 0x09, 0x2a, 0x19, 0xf0, 0x0a, 0x1b, 0xd4, 0x4c, 0x1b,
+    0x0a, 0x19, 0x1a, 0x09, 0xf0, 0x83, 0x0e, 0x1d, 0x1e, 0x0d, 0x0c, 0x0b,
+    0x0c, 0xf4, 0x09, 0x1a, 0x09, 0x0a, 0x0b, 0x0c, 0xf0, 0x1d, 0x3c, 0x0d,
+    0x6e, 0xf4, 0x0d, 0x5c, 0xf0, 0x0d, 0x2e, 0x34, 0x2d, 0x0e, 0x45, 0x0a,
+    0x0b, 0x2a, 0xf0, 0xf4, 0x9e, 0x0d, 0x1c, 0x1b, 0xf0, 0x0a, 0x84, 0x1b,
+    0x0a, 0x1b, 0x1c, 0x0d, 0x0e, 0x25, 0x2a, 0x44, 0x0e, 0x0c, 0xf0, 0x0b,
+    0x0a, 0x09, 0x23, 0x2e, 0xf4, 0x19, 0x1a, 0x0b, 0x0c, 0x5e, 0xf0, 0x0d,
+    0x0c, 0x0b, 0x2a, 0x54, 0x0b, 0x0c, 0x0d, 0x0e, 0x95, 0x3a, 0xf0, 0x0b,
+    0x0c, 0x0d, 0x0c, 0x0b, 0x0a, 0xf4, 0x0e, 0x1c, 0x1b, 0x0a, 0x1b, 0x1c,
+    0xf0, 0x0d, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x74, 0x49, 0x0a, 0x0c, 0x0e,
+    0x85, 0x0a, 0x0b, 0xf0, 0x0c, 0x3d, 0x0b, 0x0a, 0xf4, 0x0e, 0x0d, 0x0c,
+    0x0b, 0x0a, 0x1b, 0x0c, 0x0d, 0xf0, 0x1e, 0x1d, 0x2c, 0xd4, 0x2b, 0x1c,
+    0x0b, 0x0a, 0x69, 0xf0, 0x93, 0x0e, 0x3d, 0x4e, 0xa4, 0x09, 0xf0, 0x1a,
+    0x1b, 0x0a, 0x0b, 0x0c, 0x1d, 0x0e, 0xa5, 0x0a, 0x0b, 0x0c, 0x0d, 0x2e,
+    0xf0, 0x0d, 0x1b, 0x0a, 0xc4, 0x0e, 0x0d, 0x0c, 0x0b, 0x2a, 0x59, 0xf0,
+    0x23, 0x2e, 0x24, 0x29, 0x53, 0x0e, 0x0d, 0x0c, 0x0d, 0x1e, 0xf4, 0x29,
+    0xf0, 0x4a, 0x1b, 0x1a, 0x2b, 0x1a, 0xf4, 0x1b, 0xf0, 0x1a, 0x4b, 0x0a,
+    0x29, 0x2a, 0x64, 0x1b, 0xf0, 0x0c, 0x1d, 0x0e, 0xf5, 0x1a, 0x1b, 0x0c,
+    0x0d, 0x2e, 0x0d, 0x1b, 0xf0, 0x3a, 0xf4, 0x0e, 0x0d, 0x5c, 0x0d, 0x4e,
+    0xf0, 0x0d, 0x2c, 0xf4, 0x2b, 0x0a, 0x2b, 0x2a, 0xf0, 0x2b, 0x2a, 0x24,
+    0x09, 0x43, 0x0e, 0x2d, 0x0e, 0xf4, 0x19, 0x0a, 0xf0, 0x1b, 0x5c, 0x1b,
+    0x4a, 0xe4, 0x19, 0xf0, 0x4a, 0x1b, 0x0c, 0x0d, 0x1e, 0x55, 0x0a, 0x0b,
+    0x1c, 0xf0, 0x1b, 0x16, 0x18, 0x07, 0x07, 0x09, 0x06, 0x3b, 0xe5, 0x1c,
+    0x2d, 0x0c, 0xf0, 0x0b, 0x2a, 0x09, 0x0b, 0xf4, 0x0a, 0x49, 0x1a, 0x2b,
+    0xf0, 0x2c, 0x1b, 0xf4, 0x2a, 0x19, 0x38, 0x19, 0xf0, 0x2a, 0x0b, 0x0c,
+    0xf4, 0x0d, 0x0e, 0x1d, 0x0b, 0x3a, 0x19, 0xf0, 0x58, 0xf4, 0x49, 0x0a,
+    0x0b, 0x1c, 0xf0, 0x2b, 0x3c, 0x44, 0x1b, 0x0a, 0x67, 0x65, 0xf0, 0x0a,
+    0xf4, 0x1b, 0x1a, 0x1b, 0x0c, 0x2d, 0x2c, 0x1d, 0xf0, 0x3e, 0xf4, 0x1d,
+    0x2c, 0x0b, 0x3a, 0x19, 0xf0, 0x2a, 0xf4, 0x2b, 0x1a, 0x0b, 0x1c, 0x1d,
+    0x3c, 0xf0, 0xf4, 0x0d, 0x0c, 0x0b, 0x0c, 0x0d, 0x2c, 0x0b, 0x1a, 0x09,
+    0x1a, 0xf0, 0x19, 0xf4, 0x1a, 0x1b, 0x2a, 0x19, 0x2a, 0x1b, 0xf0, 0x1c,
+    0xf4, 0x1d, 0x1c, 0x1d, 0xac, 0xf0, 0xf4, 0x1d, 0x1c, 0x0b, 0x0a, 0x2b,
+    0x1a, 0x19, 0xf0, 0x2a, 0xf4, 0x09, 0x2a, 0x1b, 0x1a, 0x1b, 0x5c, 0xf0,
+    0xf4, 0x0d, 0x0c, 0x0b, 0x1c, 0x0d, 0x5e, 0x0d, 0xf0, 0x5e, 0xf4, 0x1d,
+    0x2c, 0x1b, 0x2a, 0xf0, 0x19, 0x04, 0x6e, 0x63, 0x19, 0xf4, 0x2a, 0x19,
+    0xf0, 0x1a, 0x1b, 0x1a, 0x2b, 0x0c, 0xf4, 0x1d, 0x1c, 0x1b, 0xf0, 0x1a,
+    0x2b, 0x0a, 0x3b, 0xf4, 0x3c, 0x1b, 0xf0, 0x1a, 0x2b, 0x1a, 0x1b, 0x0c,
+    0xf4, 0x1d, 0x2c, 0x0d, 0xf0, 0x2c, 0x5d, 0x1c, 0xe4, 0x1b, 0x0a, 0x2b,
+    0xf0, 0x0a, 0x1b, 0x0c, 0x0d, 0x1e, 0x1a, 0x45, 0x0b, 0x1a, 0x8e, 0xf4,
+    0xf0, 0x1d, 0x0c, 0x2b, 0x0a, 0x2b, 0xf4, 0xf0, 0x1a, 0x3b, 0x1a, 0x2b,
+    0x0a, 0x3b, 0xf4, 0xf0, 0x1a, 0x0b, 0x1c, 0x1b, 0x0a, 0x2b, 0x0a, 0x3b,
+    0xf4, 0xf0, 0x2a, 0x2b, 0x0a, 0x0b, 0x1c, 0x0d, 0x0c, 0x0b, 0x0c, 0xf4,
+    0x0d, 0x3c, 0xf0, 0x0d, 0x0c, 0x1b, 0x0a, 0x1b, 0x0c, 0x0d, 0x6c, 0xf4,
+    0xf0, 0x0d, 0x5c, 0x4d, 0x54, 0x0e, 0x30, 0x0d, 0x1c, 0x0e, 0xf2, 0xf1,
+    0x0d, 0x3e, 0x3d, 0x1e, 0x5d, 0xf2, 0xf1, 0xfc, 0x62, 0x61, 0x4c, 0x0c,
+    0x02, 0x01
+};
@@ -0,0 +1,8 @@
+/*
+ * Bank 10 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "build_fence_sound.h"
+#include "ruin_fence_sound.h"
+#include "decrease_stocks_sound.h"
@@ -0,0 +1,6 @@
+/*
+ * Bank 2 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "increase_stocks_sound.h"
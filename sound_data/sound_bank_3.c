@@ -0,0 +1,6 @@
+/*
+ * Bank 3 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "build_castle_sound.h"
@@ -0,0 +1,7 @@
+/*
+ * Bank 5 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "card_sound.h"
+#include "ruin_castle_sound.h"
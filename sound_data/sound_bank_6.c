@@ -0,0 +1,6 @@
+/*
+ * Bank 6 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "fanfare_sound_1.h"
@@ -0,0 +1,6 @@
+/*
+ * Bank 7 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "curse_sound.h"
@@ -0,0 +1,6 @@
+/*
+ * Bank 9 - Sound data, generated by bank-packer.
+ */
+
+#include <stdint.h>
+#include "increase_power_sound.h"
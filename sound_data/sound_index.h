@@ -0,0 +1,15 @@
+/*
+ * Sound index, generated by bank-packer.
+ */
+
+#define SOUND_CARD                     0
+#define SOUND_BUILD_CASTLE             1
+#define SOUND_RUIN_CASTLE              2
+#define SOUND_BUILD_FENCE              3
+#define SOUND_RUIN_FENCE               4
+#define SOUND_INCREASE_STOCKS          5
+#define SOUND_DECREASE_STOCKS          6
+#define SOUND_INCREASE_POWER           7
+#define SOUND_CURSE                    8
+#define SOUND_FANFARE                  9
+#define SOUND_COUNT                    10
@@ -0,0 +1,43 @@
+/*
+ * Sound table, generated by bank-packer.
+ */
+
+/* The first three fields are read by PlaySampleSegment */
+typedef struct sound_segment_s {
+    uint16_t triplets;
+    const uint8_t *data;
+    uint8_t continued;
+    uint8_t bank;
+} sound_segment_t;
+
+extern const uint8_t card_sound [];
+extern const uint8_t build_castle_sound [];
+extern const uint8_t ruin_castle_sound [];
+extern const uint8_t build_fence_sound [];
+extern const uint8_t ruin_fence_sound [];
+extern const uint8_t increase_stocks_sound [];
+extern const uint8_t decrease_stocks_sound [];
+extern const uint8_t increase_power_sound [];
+extern const uint8_t curse_sound [];
+extern const uint8_t fanfare_sound_1 [];
+extern const uint8_t fanfare_sound_2 [];
+
+/* Segments, in playback order */
+static const sound_segment_t sound_segments [] = {
+    { .triplets =  1228, .data = card_sound + 0, .continued = 0, .bank =  5 },
+    { .triplets =  7035, .data = build_castle_sound + 0, .continued = 0, .bank =  3 },
+    { .triplets =  8627, .data = ruin_castle_sound + 0, .continued = 0, .bank =  5 },
+    { .triplets =  3824, .data = build_fence_sound + 0, .continued = 0, .bank = 10 },
+    { .triplets =  3302, .data = ruin_fence_sound + 0, .continued = 0, .bank = 10 },
+    { .triplets =  6010, .data = increase_stocks_sound + 0, .continued = 0, .bank =  2 },
+    { .triplets =  4434, .data = decrease_stocks_sound + 0, .continued = 0, .bank = 10 },
+    { .triplets =  8792, .data = increase_power_sound + 0, .continued = 0, .bank =  9 },
+    { .triplets = 10560, .data = curse_sound + 0, .continued = 0, .bank =  7 },
+    { .triplets =  8286, .data = fanfare_sound_1 + 0, .continued = 0, .bank =  6 },
+    { .triplets =    19, .data = fanfare_sound_1 + 4637, .continued = 1, .bank =  6 },
+    { .triplets =  3409, .data = fanfare_sound_1 + 11045, .continued = 1, .bank =  6 },
+    { .triplets =  9990, .data = fanfare_sound_2 + 0, .continued = 0, .bank =  8 },
+};
+
+/* Index of the first segment of each sound, followed by the total number of segments */
+static const uint16_t sound_first_segment [SOUND_COUNT + 1] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 13 };
@@ -1,9 +0,0 @@
-/*
- * Ants for Master System
- * An Ants clone for the Sega Master System
- *
- * Banked - Sound data
- */
-
-#include <stdint.h>
-#include "../sound_data/fanfare_2.h"
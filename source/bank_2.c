@@ -1,9 +0,0 @@
-/*
- * Ants for Master System
- * An Ants clone for the Sega Master System
- *
- * Bank 2 - Title VDP Pattern data.
- */
-
-#include <stdint.h>
-#include "../title_tile_data/patterns.h"
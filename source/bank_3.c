@@ -1,9 +0,0 @@
-/*
- * Ants for Master System
- * An Ants clone for the Sega Master System
- *
- * Bank 3 - Gameplay VDP Pattern data.
- */
-
-#include <stdint.h>
-#include "../game_tile_data/patterns.h"
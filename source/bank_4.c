@@ -1,9 +0,0 @@
-/*
- * Ants for Master System
- * An Ants clone for the Sega Master System
- *
- * Bank 4 - Gameplay VDP Pattern data.
- */
-
-#include <stdint.h>
-#include "../card_tile_data/patterns.h"
@@ -1,8 +0,0 @@
-/*
- * Ants for Master System
- * An Ants clone for the Sega Master System
- *
- * Bank 4 - Gameplay VDP Pattern data (cards).
- */
-
-extern const uint32_t cards_patterns [];
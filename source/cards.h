@@ -19,6 +19,10 @@
 #define DISCARD_X_SPRITE 128
 #define DISCARD_Y_SPRITE 0
 
+/* Cards that can slide at once. Each card is four sprites wide, so
+ * two cards on the same lines reach the limit of eight per line. */
+#define CARD_SLIDES_MAX 2
+
 #define CARD_BITS   0x1f
 #define DISCARD_BIT 0x80
 
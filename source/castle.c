@@ -10,9 +10,10 @@
 
 #include "SMSlib.h"
 
-#include "bank_3.h"
+#include "../game_tile_data/bank_3.h"
 
 #include "vram.h"
+#include "vram_queue.h"
 #include "game.h"
 
 /* Pattern and index data */
@@ -205,21 +206,26 @@ void castle_update (void)
             strip_vram_base += 5;
         }
 
-        /* To show a complete transition from one castle height to another within a single
-         * frame, we need to start at VBlank and finish all writing before the castle is
-         * on-screen. The castle tiles begin at line 48, so finishing by then is the goal.
-         *
-         * For PAL consoles, the following code completes by line 23, so the full transition
-         * is completed glitch-free each time.
-         *
-         * For NTSC consoles, the following code completes by line 74. So, the peaks of the
-         * castle may glitch slightly for transitions greater than ~90 height.
-         *
-         * Possibly this could be improved by skipping unchanged parts of the tile-map, or
-         * by using unsafe writes for data that we know will occur during VBlank. */
-        SMS_waitForVBlank ();
-        SMS_loadTileMapArea (col_base, 6, strip_map, 6, 12);
-        SMS_loadTiles (pattern_buffer, (player == 0) ? PATTERN_CASTLE_1_BUFFER : PATTERN_CASTLE_2_BUFFER, sizeof (pattern_buffer));
+        /* The whole castle is more than fits in a single VBlank. Each strip only
+         * uses its own five patterns, so each strip's patterns are written in the
+         * same VBlank as its column of the name-table. The castle changes a strip
+         * at a time, without ever showing new patterns through old entries. */
+        strip_vram_base = (player == 0) ? PATTERN_CASTLE_1_BUFFER : PATTERN_CASTLE_2_BUFFER;
+        for (uint8_t col = 0; col < 6; col++)
+        {
+            uint16_t column_map [12];
+            for (uint8_t row = 0; row < 12; row++)
+            {
+                column_map [row] = strip_map [col + 6 * row];
+            }
+
+            vram_queue_group_begin ();
+            vram_queue_tiles (pattern_buffer [col], strip_vram_base, sizeof (pattern_buffer [col]));
+            vram_queue_tilemap (col_base + col, 6, column_map, 1, 12);
+            vram_queue_group_end ();
+
+            strip_vram_base += 5;
+        }
 
         /* Update the cache */
         castle_cache [player] = value;
@@ -388,9 +394,8 @@ void fence_update (void)
         memcpy (&pattern_buffer [buffer_index], &background_patterns [(background_indices [grass_panel] << 3) + 5], 12);
 
         /* Write to VRAM */
-        SMS_waitForVBlank ();
-        SMS_loadTileMapArea ((player == 0) ? 13 : 18, 6, strip_map, 1, 12);
-        SMS_loadTiles (pattern_buffer, strip_vram_base, sizeof (pattern_buffer));
+        vram_queue_tiles (pattern_buffer, strip_vram_base, sizeof (pattern_buffer));
+        vram_queue_tilemap ((player == 0) ? 13 : 18, 6, strip_map, 1, 12);
 
         /* Update the cache */
         fence_cache [player] = value;
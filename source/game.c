@@ -13,11 +13,12 @@
 #include "SMSlib.h"
 
 #define TARGET_SMS
-#include "bank_2.h"
-#include "bank_3.h"
+#include "../title_tile_data/bank_2.h"
+#include "../game_tile_data/bank_3.h"
 #include "../game_tile_data/palette.h"
 
 #include "vram.h"
+#include "vram_queue.h"
 #define INCLUDE_CARD_DATA
 #include "cards.h"
 #include "castle.h"
@@ -34,6 +35,8 @@ uint16_t vdp_background_indices [432]; /* 192 × 144 area */
 /* External functions */
 extern void card_buffer_prepare (void);
 extern void card_slide_from (uint16_t start_x, uint16_t start_y, card_t card, uint8_t slot);
+extern void card_slide_target (uint16_t end_x, uint16_t end_y, bool fast, uint8_t delay);
+extern void card_slide_run (void);
 extern void card_slide_to (uint16_t end_x, uint16_t end_y);
 extern void card_slide_to_fast (uint16_t end_x, uint16_t end_y);
 extern void card_slide_done (void);
@@ -75,9 +78,10 @@ const uint16_t starting_resources [8] = {
 
 
 /*
- * Draw a card and place it into the active player's hand.
+ * Pick a new card for the active player's hand.
+ * The return value is the card to show, which is the card-back if the hand is hidden.
  */
-static void draw_card (uint8_t slot, bool fast)
+static card_t pick_card (uint8_t slot)
 {
     uint16_t r = rand ();
     card_t card = 0;
@@ -108,12 +112,23 @@ static void draw_card (uint8_t slot, bool fast)
     }
     hands [player] [slot] = card;
 
-    /* Animate */
     if (player_visible [player] == false)
     {
         card = CARD_BACK;
     }
 
+    return card;
+}
+
+
+/*
+ * Draw a card and place it into the active player's hand.
+ */
+static void draw_card (uint8_t slot, bool fast)
+{
+    card_t card = pick_card (slot);
+
+    /* Animate */
     card_slide_from (DRAW_X_SPRITE, DRAW_Y_SPRITE, card, slot);
     if (fast)
     {
@@ -128,6 +143,34 @@ static void draw_card (uint8_t slot, bool fast)
 }
 
 
+/*
+ * Deal a full hand to the active player. The cards are dealt in groups that
+ * slide at the same time, each card following a few frames behind the last.
+ */
+static void deal_hand (void)
+{
+    card_t cards [CARD_SLIDES_MAX];
+
+    for (uint8_t slot = 0; slot < 8; slot += CARD_SLIDES_MAX)
+    {
+        for (uint8_t i = 0; i < CARD_SLIDES_MAX; i++)
+        {
+            cards [i] = pick_card (slot + i);
+            card_slide_from (DRAW_X_SPRITE, DRAW_Y_SPRITE, cards [i], slot + i);
+            card_slide_target ((slot + i) << 5, HAND_Y_SPRITE, true, i << 2);
+        }
+
+        card_slide_run ();
+
+        for (uint8_t i = 0; i < CARD_SLIDES_MAX; i++)
+        {
+            render_card_as_background ((slot + i) << 2, HAND_Y_TILE, cards [i], slot + i);
+        }
+        card_slide_done ();
+    }
+}
+
+
 /*
  * Add a resource to a player.
  * A bound of 999 is used as this is what we can display.
@@ -366,37 +409,37 @@ static void play_card (uint8_t slot)
         case CARD_FORT:
         case CARD_BABYLON:
         case CARD_PIXIES:
-            play_build_castle_sound ();
+            play_sound (SOUND_BUILD_CASTLE);
             break;
 
         case CARD_SWAT:
-            play_ruin_castle_sound ();
+            play_sound (SOUND_RUIN_CASTLE);
             break;
 
         case CARD_WALL:
         case CARD_DEFENCE:
         case CARD_FENCE:
-            play_build_fence_sound ();
+            play_sound (SOUND_BUILD_FENCE);
             break;
 
         case CARD_SCHOOL:
         case CARD_RECRUIT:
         case CARD_SORCERER:
-            play_increase_power_sound ();
+            play_sound (SOUND_INCREASE_POWER);
             break;
 
         case CARD_CONJURE_BRICKS:
         case CARD_CONJURE_WEAPONS:
         case CARD_CONJURE_CRYSTALS:
         case CARD_THIEF:
-            play_increase_stocks_sound ();
+            play_sound (SOUND_INCREASE_STOCKS);
             break;
 
         case CARD_CRUSH_BRICKS:
         case CARD_CRUSH_WEAPONS:
         case CARD_CRUSH_CRYSTALS:
         case CARD_SABOTEUR:
-            play_decrease_stocks_sound ();
+            play_sound (SOUND_DECREASE_STOCKS);
             break;
 
         case CARD_ARCHER:
@@ -408,16 +451,16 @@ static void play_card (uint8_t slot)
         case CARD_DRAGON:
             if (castle_damaged)
             {
-                play_ruin_castle_sound ();
+                play_sound (SOUND_RUIN_CASTLE);
             }
             else
             {
-                play_ruin_fence_sound ();
+                play_sound (SOUND_RUIN_FENCE);
             }
             break;
 
         case CARD_CURSE:
-            play_curse_sound ();
+            play_sound (SOUND_CURSE);
             break;
 
         default:
@@ -445,23 +488,46 @@ static void discard_card (uint8_t slot)
 
 
 /*
- * Slide a card off-screen, used at the end of a game.
+ * Slide the active player's cards off-screen, used at the end of a game.
+ * The cards slide in groups, each card following a few frames behind the last.
  */
-static void clear_card (uint8_t slot)
+static void clear_hand (void)
 {
-    card_t card = hands [player] [slot];
-    hands [player] [slot] = CARD_NONE;
+    uint8_t sliding = 0;
 
-    if (!player_visible [player])
+    for (uint8_t slot = 0; slot < 8; slot++)
     {
-        card = CARD_BACK;
+        card_t card = hands [player] [slot];
+
+        if (card == CARD_NONE)
+        {
+            continue;
+        }
+        hands [player] [slot] = CARD_NONE;
+
+        if (!player_visible [player])
+        {
+            card = CARD_BACK;
+        }
+
+        card_slide_from (slot << 5, HAND_Y_SPRITE, card, slot);
+        render_card_as_background (slot << 2, HAND_Y_TILE, CARD_NONE, slot);
+        card_slide_target (slot << 5, 192, true, sliding << 2);
+
+        /* Animate once the group is full, or the hand is empty */
+        if (++sliding == CARD_SLIDES_MAX)
+        {
+            card_slide_run ();
+            card_slide_done ();
+            sliding = 0;
+        }
     }
 
-    /* Animate */
-    card_slide_from (slot << 5, HAND_Y_SPRITE, card, slot);
-    render_card_as_background (slot << 2, HAND_Y_TILE, CARD_NONE, slot);
-    card_slide_to_fast (slot << 5, 192);
-    card_slide_done ();
+    if (sliding)
+    {
+        card_slide_run ();
+        card_slide_done ();
+    }
 }
 
 
@@ -531,18 +597,15 @@ static void draw_cursor (uint8_t x)
     /* To save some VRAM pattern memory, only
      * keep one cursor loaded at a time. */
 
-    /* The cursors are in bank 2 */
-    SMS_mapROMBank (2);
+    /* The cursors are stored with the title patterns */
     if (card_valid (card))
     {
-        SMS_loadTiles (&cursor_patterns [32], PATTERN_HAND_CURSOR, 128);
+        vram_queue_tiles_rom (CURSOR_PATTERNS_BANK, &cursor_patterns [32], PATTERN_HAND_CURSOR, 128);
     }
     else
     {
-        SMS_loadTiles (&cursor_patterns [64], PATTERN_HAND_CURSOR, 128);
+        vram_queue_tiles_rom (CURSOR_PATTERNS_BANK, &cursor_patterns [64], PATTERN_HAND_CURSOR, 128);
     }
-    SMS_mapROMBank (3);
-
 
     SMS_initSprites ();
 
@@ -552,7 +615,8 @@ static void draw_cursor (uint8_t x)
     SMS_addSprite (x,     172 + 8, PATTERN_HAND_CURSOR + 2);
     SMS_addSprite (x + 8, 172 + 8, PATTERN_HAND_CURSOR + 3);
 
-    SMS_copySpritestoSAT ();
+    vram_queue_sprites ();
+    vram_queue_wait ();
 }
 
 
@@ -562,7 +626,8 @@ static void draw_cursor (uint8_t x)
 static void clear_cursor (void)
 {
     SMS_initSprites ();
-    SMS_copySpritestoSAT ();
+    vram_queue_sprites ();
+    vram_queue_wait ();
 }
 
 
@@ -773,6 +838,9 @@ void game_start (void)
     fence_update ();
     SMS_displayOn ();
 
+    /* From here on, VRAM is only written during VBlank */
+    vram_queue_start ();
+
     /* Outer loop - Ensures that when one game is completed, another begins */
     while (!reset)
     {
@@ -804,18 +872,12 @@ void game_start (void)
         }
 
         /* Deal first player */
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            draw_card (i, true);
-        }
+        deal_hand ();
         delay_frames (60);
 
         /* Deal second player */
         set_player (!player);
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            draw_card (i, true);
-        }
+        deal_hand ();
         delay_frames (60);
 
         /* The player who starts does not generate
@@ -830,7 +892,7 @@ void game_start (void)
             if (first)
             {
                 /* Start the game with the increase-power sound */
-                play_increase_power_sound ();
+                play_sound (SOUND_INCREASE_POWER);
                 first = false;
             }
             else
@@ -858,7 +920,7 @@ void game_start (void)
                     panel_update_wins (player);
 
                     /* TODO: trumpet sprite */
-                    play_fanfare_sound ();
+                    play_sound (SOUND_FANFARE);
                     break;
                 }
             }
@@ -874,12 +936,8 @@ void game_start (void)
         }
 
         /* Tidy up after the completed game */
-        for (uint8_t card = 0; card < 8; card++)
-        {
-            if (hands [player] [card] != CARD_NONE)
-            {
-                clear_card (card);
-            }
-        }
+        clear_hand ();
     }
+
+    vram_queue_stop ();
 }
@@ -11,11 +11,13 @@
 #include "../libraries/sms-fxsample/fxsample.h"
 
 #define TARGET_SMS
-#include "bank_4.h"
+#include "../card_tile_data/bank_4.h"
+#include "../card_tile_data/bank_5.h"
 #include "../game_tile_data/pattern_index.h"
 #include "../card_tile_data/pattern_index.h"
 
 #include "vram.h"
+#include "vram_queue.h"
 #include "cards.h"
 #include "game.h"
 #include "save.h"
@@ -42,7 +44,8 @@ static const uint16_t empty_slot [24] = {
 /* Ten cards are loaded into VRAM at a time:
  * 0-7: Player's hand
  *   8: Most recent discard
- *   9: Card-back */
+ *   9: Card-back
+ * Each slot holds the name-table entries for its card, pointing into the pattern pool. */
 static uint16_t card_buffer [10] [24];
 uint8_t card_buffer_contains [10] = {
     CARD_NONE, CARD_NONE, CARD_NONE, CARD_NONE,
@@ -50,35 +53,108 @@ uint8_t card_buffer_contains [10] = {
     CARD_NONE, CARD_NONE
 };
 
-/* A reference to which card_buffer slot is being used as a sprite */
-static uint8_t card_buffer_sprite = 0;
+/* Cards being used as sprites take the first entries of the SAT, in the order they
+ * were added. Their tiles are set once, after which only the positions change. */
+#define CARD_SPRITES (sizeof (cards_metasprite) / 3)
+static uint8_t card_sprite_y [CARD_SPRITES * CARD_SLIDES_MAX];
+static uint8_t card_sprite_xn [CARD_SPRITES * CARD_SLIDES_MAX * 2];
+
+/* Card patterns are shared between the buffered cards through a pool of 240 VRAM
+ * patterns, so that borders, backgrounds, and cost icons are only loaded once.
+ * Each pool entry counts the card slots using it. Entries no longer in use keep
+ * their pattern until they are needed again, so cards that return to the screen,
+ * such as the other player's hand, often need nothing to be loaded.
+ *
+ * Source patterns are numbered through the card sheet, then the discarded sheet.
+ * Ten slots of 24 patterns can never use more than the whole pool. */
+#define CARD_POOL_SIZE          240
+#define CARD_POOL_NONE          0xff
+#define CARD_SOURCE_DISCARDED   (sizeof (cards_patterns) / 32)
+#define CARD_SOURCE_COUNT       (CARD_SOURCE_DISCARDED + sizeof (cards_discarded_patterns) / 32)
+#define CARD_SOURCE_NONE        0xffff
+
+static uint8_t card_pool_refs [CARD_POOL_SIZE];
+static uint16_t card_pool_source [CARD_POOL_SIZE];
+static uint8_t card_pool_entry [CARD_SOURCE_COUNT];
+static uint8_t card_pool_next = 0;
 
 
 /*
- * For now, the ten buffered cards are stored without de-duplication,
- * using a fixed 24-pattern block per card.
+ * Empty the card pattern pool and the ten card buffer slots.
  */
 void card_buffer_prepare (void)
 {
-    /* Dynamic buffer in VRAM for patterns */
-    uint16_t index = 0;
-    for (uint8_t slot = 0; slot < 10; slot++)
+    memset (card_pool_refs, 0, sizeof (card_pool_refs));
+    memset (card_pool_source, 0xff, sizeof (card_pool_source));
+    memset (card_pool_entry, CARD_POOL_NONE, sizeof (card_pool_entry));
+    card_pool_next = 0;
+
+    /* Reset the software reference */
+    memset (card_buffer_contains, CARD_NONE, sizeof (card_buffer_contains));
+}
+
+
+/*
+ * Take a reference to a source pattern in the pool, loading it into VRAM if it
+ * is not already there. The return value is the name-table entry to use for it.
+ */
+static uint16_t card_pool_acquire (uint16_t source)
+{
+    uint8_t entry = card_pool_entry [source];
+
+    if (entry == CARD_POOL_NONE)
     {
-        for (uint8_t pattern = 0; pattern < 24; pattern++)
+        /* Take the next entry that is not in use, cycling through the
+         * pool so that recently released patterns are kept the longest. */
+        while (card_pool_refs [card_pool_next] != 0)
+        {
+            card_pool_next = (card_pool_next == CARD_POOL_SIZE - 1) ? 0 : card_pool_next + 1;
+        }
+        entry = card_pool_next;
+        card_pool_next = (card_pool_next == CARD_POOL_SIZE - 1) ? 0 : card_pool_next + 1;
+
+        /* Forget the pattern it held before */
+        if (card_pool_source [entry] != CARD_SOURCE_NONE)
         {
-            card_buffer [slot] [pattern] = 0x0800 | PATTERN_CARD_BUFFER + index++;
+            card_pool_entry [card_pool_source [entry]] = CARD_POOL_NONE;
         }
+        card_pool_source [entry] = source;
+        card_pool_entry [source] = entry;
 
-        /* Reset the software reference */
-        card_buffer_contains [slot] = CARD_NONE;
+        if (source < CARD_SOURCE_DISCARDED)
+        {
+            vram_queue_tiles_rom (CARDS_PATTERNS_BANK, &cards_patterns [source << 3],
+                                  PATTERN_CARD_BUFFER + entry, 32);
+        }
+        else
+        {
+            vram_queue_tiles_rom (CARDS_DISCARDED_PATTERNS_BANK, &cards_discarded_patterns [(source - CARD_SOURCE_DISCARDED) << 3],
+                                  PATTERN_CARD_BUFFER + entry, 32);
+        }
     }
+
+    card_pool_refs [entry]++;
+
+    return 0x0800 | (PATTERN_CARD_BUFFER + entry);
 }
 
 
-/* Slide animation variables */
-uint16_t slide_start_x = 0;
-uint16_t slide_start_y = 0;
-card_t slide_card = 0;
+/* Slide animation variables. Each card's position is fixed-point, with as many
+ * fractional bits as it takes to reach the end in a power-of-two number of frames. */
+typedef struct card_slide_s {
+    uint16_t start_x;
+    uint16_t start_y;
+    uint16_t x;
+    uint16_t y;
+    uint16_t step_x;    /* Distance to the end, added once per frame */
+    uint16_t step_y;
+    uint8_t shift;      /* Fractional bits */
+    uint8_t frames;     /* Frames of movement remaining */
+    uint8_t delay;      /* Frames to wait before starting */
+} card_slide_t;
+
+static card_slide_t card_slides [CARD_SLIDES_MAX];
+static uint8_t card_slide_count = 0;
 
 
 /*
@@ -96,83 +172,103 @@ static inline uint8_t load_card (card_t card, uint8_t slot)
     /* Only update the data in VRAM if the card in this buffer-slot has changed */
     if (card_buffer_contains [slot] != card)
     {
+        /* Release the previous card's patterns. They are released before the new card's
+         * are taken, so that patterns common to both are kept without being re-loaded. */
+        if (card_buffer_contains [slot] != CARD_NONE)
+        {
+            for (uint8_t i = 0; i < 24; i++)
+            {
+                card_pool_refs [(card_buffer [slot][i] & 0x01ff) - PATTERN_CARD_BUFFER]--;
+            }
+        }
+
         card_buffer_contains [slot] = card;
-        SMS_mapROMBank (4); /* Card artwork is located in bank 4. */
 
         if (card & DISCARD_BIT)
         {
             card = card & CARD_BITS;
 
-            const uint16_t *discard_panels = (card < 10) ? &cards_panels [CARD_DISCARD] [0] :
-                                             (card < 20) ? &cards_panels [CARD_DISCARD] [8] :
-                                                           &cards_panels [CARD_DISCARD] [16];
-
             /* Top section (unchanged) */
             for (uint8_t i = 0; i < 16; i++)
             {
-                uint16_t pattern = cards_panels [card] [i] << 3;
-                SMS_loadTiles (&cards_patterns [pattern], card_buffer [slot][i] & 0x01ff, 32);
+                card_buffer [slot][i] = card_pool_acquire (cards_panels [card] [i]);
             }
 
-            /* Middle section (half-and-half) */
-            for (uint8_t i = 0; i < 4; i++)
+            /* Middle and bottom sections, already composited with the discard overlay */
+            for (uint8_t i = 0; i < 8; i++)
             {
-                uint32_t pattern_buffer [8];
-                uint16_t card_pattern = cards_panels [card] [i + 16] << 3;
-                uint16_t discard_pattern = discard_panels [i] << 3;
-
-                /* Three lines from the card pattern, and five lines from the discard pattern */
-                memcpy (&pattern_buffer [0], &cards_patterns [card_pattern    + 0], 3 << 2);
-                memcpy (&pattern_buffer [3], &cards_patterns [discard_pattern + 3], 5 << 2);
-                SMS_loadTiles (pattern_buffer, card_buffer [slot][i + 16] & 0x01ff, 32);
-            }
-
-            /* Bottom section (discard-text) */
-            for (uint8_t i = 4; i < 8; i++)
-            {
-                uint16_t pattern = discard_panels [i] << 3;
-                SMS_loadTiles (&cards_patterns [pattern], card_buffer [slot][i + 16] & 0x01ff, 32);
+                card_buffer [slot][i + 16] = card_pool_acquire (CARD_SOURCE_DISCARDED + cards_discarded_panels [card] [i]);
             }
         }
         else
         {
-            /* copy pattern bytes to VRAM */
             for (uint8_t i = 0; i < 24; i++)
             {
-                uint16_t pattern = cards_panels [card] [i] << 3;
-                SMS_loadTiles (&cards_patterns [pattern], card_buffer [slot][i] & 0x01ff, 32);
+                card_buffer [slot][i] = card_pool_acquire (cards_panels [card] [i]);
             }
         }
-        SMS_mapROMBank (3); /* By default, keep the gameplay VDP patterns mapped */
     }
 
     return slot;
 }
 
 
-static inline void render_card_as_sprite_prepare (card_t card, uint8_t slot)
+/*
+ * Load a card and set the tiles of the sprites for the given sliding card.
+ * The metasprite table from Sneptile gives the position of each tile within the
+ * card, which is looked up in the slot's name-table entries. The pool lies within
+ * the first 256 patterns, so the low byte of each entry is the sprite pattern.
+ */
+static inline void render_card_as_sprite_prepare (card_t card, uint8_t slot, uint8_t index)
 {
-    card_buffer_sprite = load_card (card, slot);
+    const uint8_t *sprite = cards_metasprite;
+    const uint16_t *patterns = card_buffer [load_card (card, slot)];
+    uint8_t *sprite_xn = &card_sprite_xn [index * CARD_SPRITES * 2];
+
+    for (uint8_t i = 0; i < CARD_SPRITES; i++)
+    {
+        sprite_xn [(i << 1) + 1] = (uint8_t) patterns [sprite [2]];
+        sprite += 3;
+    }
 }
 
 
 /*
- * Draw the card, already in the reserved pattern area, using sprites.
- * TODO: Consider using SMS_updateSpritePosition.
+ * Position the sprites for the given sliding card.
+ * They are written to the SAT by card_slide_show.
  */
-static inline void render_card_as_sprite (uint16_t x, uint16_t y)
+static inline void render_card_as_sprite (uint8_t index, uint8_t x, uint8_t y)
 {
-    uint8_t pattern_index = 0;
+    const uint8_t *sprite = cards_metasprite;
+    uint8_t *sprite_y = &card_sprite_y [index * CARD_SPRITES];
+    uint8_t *sprite_xn = &card_sprite_xn [index * CARD_SPRITES * 2];
 
-    for (uint8_t panel_y = 0; panel_y < 6; panel_y++)
-    for (uint8_t panel_x = 0; panel_x < 4; panel_x++)
+    /* Sprites are shown on the line after their Y value */
+    y--;
+
+    for (uint8_t count = CARD_SPRITES; count; count--)
     {
-        SMS_addSprite (x + (panel_x << 3),
-                       y + (panel_y << 3), card_buffer [card_buffer_sprite] [pattern_index++]);
+        /* 0xd0 would end the sprite list early. It is below the screen, as is 0xd1. */
+        uint8_t line = y + sprite [1];
+        *sprite_y++ = (line == 0xd0) ? 0xd1 : line;
+        *sprite_xn = x + sprite [0];
+        sprite_xn += 2;
+        sprite += 3;
     }
 }
 
 
+/*
+ * Write the positions of the sliding cards' sprites during the next VBlank,
+ * and wait for them to be shown.
+ */
+static void card_slide_show (void)
+{
+    vram_queue_sprite_positions (card_sprite_y, card_sprite_xn, card_slide_count * CARD_SPRITES);
+    vram_queue_wait ();
+}
+
+
 /*
  * Render a card to the background.
  * TODO: Temporarily taking in the slot number to simplify caching.
@@ -181,64 +277,99 @@ void render_card_as_background (uint8_t x, uint8_t y, card_t card, uint8_t slot)
 {
     if (card == CARD_NONE)
     {
-        SMS_loadTileMapArea (x, y, empty_slot, 4, 6);
+        vram_queue_tilemap (x, y, empty_slot, 4, 6);
     }
     else
     {
         slot = load_card (card, slot);
-        SMS_loadTileMapArea (x, y, card_buffer [slot], 4, 6);
+        vram_queue_tilemap (x, y, card_buffer [slot], 4, 6);
     }
 }
 
 
 /*
- * Prepare for the card sliding animation.
+ * Add a card to the sliding animation, up to CARD_SLIDES_MAX at a time.
  * This will render the card as a sprite in the starting position.
  */
 void card_slide_from (uint16_t start_x, uint16_t start_y, card_t card, uint8_t slot)
 {
-    slide_start_x = start_x;
-    slide_start_y = start_y;
+    card_slide_t *slide = &card_slides [card_slide_count];
 
-    SMS_initSprites ();
-    render_card_as_sprite_prepare (card, slot);
-    render_card_as_sprite (start_x, start_y);
+    slide->start_x = start_x;
+    slide->start_y = start_y;
+    slide->frames = 0;
+    slide->delay = 0;
+
+    render_card_as_sprite_prepare (card, slot, card_slide_count);
+    render_card_as_sprite (card_slide_count, start_x, start_y);
+    card_slide_count++;
 
-    SMS_waitForVBlank ();
-    SMS_copySpritestoSAT ();
+    /* The sprites are shown once the card's patterns have been loaded */
+    card_slide_show ();
 }
 
 
 /*
- * Animate a card sliding from the start position to the end
- * position, leaving it rendered as a sprite.
+ * Set the end position of the most recently added card. It will take 32
+ * frames to get there, or 16 if fast, after waiting for delay frames.
  */
-void card_slide_to (uint16_t end_x, uint16_t end_y)
+void card_slide_target (uint16_t end_x, uint16_t end_y, bool fast, uint8_t delay)
 {
-    uint16_t x;
-    uint16_t y;
+    card_slide_t *slide = &card_slides [card_slide_count - 1];
+
+    slide->shift = fast ? 4 : 5;
+    slide->x = slide->start_x << slide->shift;
+    slide->y = slide->start_y << slide->shift;
+    slide->step_x = end_x - slide->start_x;
+    slide->step_y = end_y - slide->start_y;
+    slide->frames = 1 << slide->shift;
+    slide->delay = delay;
+}
 
-    x = slide_start_x << 5;
-    y = slide_start_y << 5;
+
+/*
+ * Animate the cards until they have all reached their end position,
+ * leaving them rendered as sprites.
+ */
+void card_slide_run (void)
+{
+    bool moving = true;
 
     /* Play the card sound with each animation. */
-    play_card_sound ();
+    play_sound (SOUND_CARD);
 
-    for (uint8_t frame = 0; frame < 32; frame++)
+    while (moving)
     {
-        x += end_x - slide_start_x;
-        y += end_y - slide_start_y;
+        moving = false;
 
-        SMS_initSprites ();
-        render_card_as_sprite (x >> 5, y >> 5);
+        for (uint8_t index = 0; index < card_slide_count; index++)
+        {
+            card_slide_t *slide = &card_slides [index];
 
-        /* Write the new sprite position only during vblank. */
-        SMS_waitForVBlank ();
-        SMS_copySpritestoSAT ();
+            if (slide->delay)
+            {
+                slide->delay--;
+                moving = true;
+            }
+            else if (slide->frames)
+            {
+                slide->x += slide->step_x;
+                slide->y += slide->step_y;
+                slide->frames--;
+                render_card_as_sprite (index, slide->x >> slide->shift, slide->y >> slide->shift);
+                moving = true;
+            }
+        }
+
+        /* Write the new sprite positions only during vblank. */
+        if (moving)
+        {
+            card_slide_show ();
+        }
     }
 
-    /* Note, we don't clear the sprite here. First the
-     * caller needs to draw the card into the background. */
+    /* Note, we don't clear the sprites here. First the
+     * caller needs to draw the cards into the background. */
 }
 
 
@@ -246,43 +377,34 @@ void card_slide_to (uint16_t end_x, uint16_t end_y)
  * Animate a card sliding from the start position to the end
  * position, leaving it rendered as a sprite.
  */
-void card_slide_to_fast (uint16_t end_x, uint16_t end_y)
+void card_slide_to (uint16_t end_x, uint16_t end_y)
 {
-    uint16_t x;
-    uint16_t y;
-
-    x = slide_start_x << 4;
-    y = slide_start_y << 4;
-
-    /* Play the card sound with each animation. */
-    play_card_sound ();
-
-    for (uint8_t frame = 0; frame < 16; frame++)
-    {
-        x += end_x - slide_start_x;
-        y += end_y - slide_start_y;
-
-        SMS_initSprites ();
-        render_card_as_sprite (x >> 4, y >> 4);
+    card_slide_target (end_x, end_y, false, 0);
+    card_slide_run ();
+}
 
-        /* Write the new sprite position only during vblank. */
-        SMS_waitForVBlank ();
-        SMS_copySpritestoSAT ();
-    }
 
-    /* Note, we don't clear the sprite here. First the
-     * caller needs to draw the card into the background. */
+/*
+ * Animate a card sliding from the start position to the end
+ * position, leaving it rendered as a sprite.
+ */
+void card_slide_to_fast (uint16_t end_x, uint16_t end_y)
+{
+    card_slide_target (end_x, end_y, true, 0);
+    card_slide_run ();
 }
 
 
 /*
  * Clear the card sprite animation. This should be called
- * once the card has been drawn to the background.
+ * once the cards have been drawn to the background.
  */
 void card_slide_done (void)
 {
     SMS_initSprites ();
-    SMS_copySpritestoSAT ();
+    vram_queue_sprites ();
+    vram_queue_wait ();
+    card_slide_count = 0;
 }
 
 
@@ -301,10 +423,13 @@ void delay_frames (uint8_t frames)
 
 /*
  * Frame interrupt.
- * currently used to check if the reset button has been pressed.
+ * Used to write queued VRAM updates during VBlank, and
+ * to check if the reset button has been pressed.
  */
 static void frame_interrupt (void)
 {
+    vram_queue_flush ();
+
     if (SMS_getKeysPressed () & RESET_KEY)
     {
         reset = true;
@@ -9,7 +9,10 @@
 
 #include "SMSlib.h"
 
+#include "../game_tile_data/bank_3.h"
+
 #include "vram.h"
+#include "vram_queue.h"
 #include "digits.h"
 #include "game.h"
 
@@ -93,9 +96,8 @@ void panel_update_wins (uint8_t player)
         }
     }
 
-    /* TODO: Consider waiting for v-sync before writing to VRAM. */
-    SMS_loadTiles (buffer_l, PATTERN_WIN_DIGITS + (player << 1),     sizeof (buffer_l));
-    SMS_loadTiles (buffer_r, PATTERN_WIN_DIGITS + (player << 1) + 1, sizeof (buffer_r));
+    vram_queue_tiles (buffer_l, PATTERN_WIN_DIGITS + (player << 1),     sizeof (buffer_l));
+    vram_queue_tiles (buffer_r, PATTERN_WIN_DIGITS + (player << 1) + 1, sizeof (buffer_r));
 }
 
 
@@ -124,15 +126,13 @@ void panel_init_wins (void)
  */
 void panel_update_player (uint8_t player)
 {
-    SMS_mapROMBank (3);
-
     if (player == 0)
     {
-        SMS_loadTiles (&player_patterns[0], PATTERN_PLAYERS, 512);
+        vram_queue_tiles_rom (PLAYER_PATTERNS_BANK, &player_patterns[0], PATTERN_PLAYERS, 512);
     }
     else
     {
-        SMS_loadTiles (&player_patterns[128], PATTERN_PLAYERS, 512);
+        vram_queue_tiles_rom (PLAYER_PATTERNS_BANK, &player_patterns[128], PATTERN_PLAYERS, 512);
     }
 
 }
@@ -285,10 +285,10 @@ void panel_update (void)
             }
         }
 
-        /* TODO: Consider waiting for v-sync before writing to VRAM. This would need to
-         *       be done outside of the loop to allow all values to change simultaneously. */
-        SMS_loadTiles (buffer_l, PATTERN_PANEL_DIGITS + (player << 4) + (field << 1),     sizeof (buffer_l));
-        SMS_loadTiles (buffer_r, PATTERN_PANEL_DIGITS + (player << 4) + (field << 1) + 1, sizeof (buffer_r));
+        /* Queued digits are written in the same VBlank where they fit, so values
+         * that change together usually appear together. */
+        vram_queue_tiles (buffer_l, PATTERN_PANEL_DIGITS + (player << 4) + (field << 1),     sizeof (buffer_l));
+        vram_queue_tiles (buffer_r, PATTERN_PANEL_DIGITS + (player << 4) + (field << 1) + 1, sizeof (buffer_r));
     }
 
     memcpy (panel_cache [0], resources [0], sizeof (panel_cache [0]));
@@ -10,125 +10,26 @@
 #include "SMSlib.h"
 #include "../libraries/sms-fxsample/fxsample.h"
 
-extern const uint8_t card_sound [];
-extern const uint8_t increase_power_sound [];
-extern const uint8_t build_castle_sound [];
-extern const uint8_t build_fence_sound [];
-extern const uint8_t ruin_castle_sound [];
-extern const uint8_t ruin_fence_sound [];
-extern const uint8_t increase_stocks_sound [];
-extern const uint8_t decrease_stocks_sound [];
-extern const uint8_t curse_sound [];
-extern const uint8_t fanfare_sound_1 [];
-extern const uint8_t fanfare_sound_2 [];
-
-/*
- * Play the card-slide sound.
- */
-void play_card_sound (void)
-{
-    SMS_mapROMBank (5);
-    PlaySample ((void *) card_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the increase-power sound.
- */
-void play_increase_power_sound (void)
-{
-    SMS_mapROMBank (5);
-    PlaySample ((void *) increase_power_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
+#include "vram_queue.h"
+#include "sound.h"
+#include "../sound_data/sound_table.h"
 
 
 /*
- * Play the build-castle sound.
+ * Play a sound. The bank placement of each sound is generated
+ * by bank-packer. Each sound is played as a list of segments,
+ * some of which may be shared with other sounds.
  */
-void play_build_castle_sound (void)
+void play_sound (uint8_t sound)
 {
-    SMS_mapROMBank (6);
-    PlaySample ((void *) build_castle_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
+    /* Samples are played with interrupts disabled, so
+     * write any queued VRAM updates before they start. */
+    vram_queue_wait ();
 
-/*
- * Play the build-fence sound.
- */
-void play_build_fence_sound (void)
-{
-    SMS_mapROMBank (6);
-    PlaySample ((void *) build_fence_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the ruin-castle sound.
- */
-void play_ruin_castle_sound (void)
-{
-    SMS_mapROMBank (7);
-    PlaySample ((void *) ruin_castle_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the ruin-fence sound.
- */
-void play_ruin_fence_sound (void)
-{
-    SMS_mapROMBank (7);
-    PlaySample ((void *) ruin_fence_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the increase-stocks sound.
- */
-void play_increase_stocks_sound (void)
-{
-    SMS_mapROMBank (8);
-    PlaySample ((void *) increase_stocks_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the decrease-stocks sound.
- */
-void play_decrease_stocks_sound (void)
-{
-    SMS_mapROMBank (8);
-    PlaySample ((void *) decrease_stocks_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the decrease-stocks sound.
- */
-void play_curse_sound (void)
-{
-    SMS_mapROMBank (9);
-    PlaySample ((void *) curse_sound);
-    SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
-}
-
-
-/*
- * Play the fanfare sound.
- */
-void play_fanfare_sound (void)
-{
-    SMS_mapROMBank (10);
-    PlaySample ((void *) fanfare_sound_1);
-    SMS_mapROMBank (11);
-    PlaySample ((void *) fanfare_sound_2);
+    for (uint16_t segment = sound_first_segment [sound]; segment < sound_first_segment [sound + 1]; segment++)
+    {
+        SMS_mapROMBank (sound_segments [segment].bank);
+        PlaySampleSegment ((void *) &sound_segments [segment]);
+    }
     SMS_mapROMBank (3); /* By default, keep the VDP patterns mapped */
 }
@@ -5,32 +5,8 @@
  * Sound header
  */
 
-/* Play the card-slide sound. */
-void play_card_sound (void);
+/* Sound IDs, one for each sound listed in build.sh */
+#include "../sound_data/sound_index.h"
 
-/* Play the increase-power sound. */
-void play_increase_power_sound (void);
-
-/* Play the build-castle sound. */
-void play_build_castle_sound (void);
-
-/* Play the build-fence sound. */
-void play_build_fence_sound (void);
-
-/* Play the ruin-castle sound. */
-void play_ruin_castle_sound (void);
-
-/* Play the ruin-fence sound. */
-void play_ruin_fence_sound (void);
-
-/* Play the increase-stocks sound. */
-void play_increase_stocks_sound (void);
-
-/* Play the decrease-stocks sound. */
-void play_decrease_stocks_sound (void);
-
-/* Play the decrease-stocks sound. */
-void play_curse_sound (void);
-
-/* Play the fanfare sound. */
-void play_fanfare_sound (void);
+/* Play a sound. */
+void play_sound (uint8_t sound);
@@ -10,9 +10,10 @@
 #include "SMSlib.h"
 
 #define TARGET_SMS
-#include "bank_2.h"
+#include "../title_tile_data/bank_2.h"
 #include "../title_tile_data/palette.h"
 #include "../title_tile_data/pattern_index.h"
+#include "../libraries/sms-unpack/unpack.h"
 
 #include "vram.h"
 #include "title.h"
@@ -163,16 +164,13 @@ void title_screen (void)
     uint16_t vdp_title_indices [768];
     cursor_position_t cursor_pos = CURSOR_POS_START;
 
-    SMS_mapROMBank (2); /* Title patterns are stored in bank 2 */
+    SMS_mapROMBank (TITLE_PATTERNS_COMPRESSED_BANK);
 
     SMS_loadTiles (cursor_patterns, PATTERN_CURSOR, sizeof (cursor_patterns));
-    SMS_loadTiles (title_patterns, PATTERN_TITLE_IMAGE, sizeof (title_patterns));
+    unpack_patterns (title_patterns_compressed, PATTERN_TITLE_IMAGE);
     SMS_loadTiles (widgets_patterns, PATTERN_WIDGETS, sizeof (widgets_patterns));
 
-    for (uint16_t i = 0; i < 768; i++)
-    {
-        vdp_title_indices [i] = title_indices [i] + PATTERN_TITLE_IMAGE;
-    }
+    unpack_indices (title_indices_compressed, vdp_title_indices, PATTERN_TITLE_IMAGE);
     SMS_loadTileMapArea (0, 0, vdp_title_indices, 32, 24);
 
     SMS_useFirstHalfTilesforSprites (true);
@@ -17,7 +17,7 @@
  * Gameplay VRAM Layout:
  *
  *   [       0] - Blank pattern
- *   [  1..240] - ten-card dynamic buffer
+ *   [  1..240] - Card pattern pool, shared by the ten buffered cards
  *   [241..244] - Hand cursor
  *   [245..276] - Panel digit area
  *   [277..306] - Castle dynamic buffer (left)
@@ -47,3 +47,7 @@
 #define PATTERN_FENCE_1_BUFFER    496
 #define PATTERN_FENCE_2_BUFFER    500
 
+/* Sprite attribute table: Y values, then pairs of X value and tile */
+#define VRAM_SAT_Y             0x3f00
+#define VRAM_SAT_XN            0x3f80
+
@@ -0,0 +1,444 @@
+/*
+ * Ants for Master System
+ * An Ants clone for the Sega Master System
+ *
+ * VBlank-deferred VRAM write queue
+ *
+ * During gameplay, VRAM is written through a ring of commands which is
+ * flushed from the frame interrupt, so that updates land during VBlank
+ * instead of part-way down the screen. Game logic only waits if the ring
+ * is full, or when it needs an update to have been made, such as before
+ * changing the sprite table again.
+ *
+ * Patterns and name-table entries from RAM are copied into a data ring
+ * when queued, as they often come from buffers on the stack. Patterns
+ * from ROM are read in place, with their bank mapped during the flush.
+ *
+ * Commands queued between vram_queue_group_begin and vram_queue_group_end
+ * are written within the same VBlank, so that patterns and the name-table
+ * entries that use them change together.
+ *
+ * While the queue is running, nothing else may write to VRAM, as the
+ * flush would move the VDP address from under it. Setup code that runs
+ * with the display off writes directly, with the queue stopped.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "SMSlib.h"
+
+#include "vram.h"
+#include "vram_queue.h"
+
+/* VBlank lasts 70 lines of 228 cycles on NTSC consoles, and 121 lines on PAL.
+ * The interrupt handler and controller reads use some of it. Writes through
+ * SMSlib take 26 cycles per byte, and setting the VDP address for each copy
+ * costs about the same as another 16 bytes. The budget is counted in bytes. */
+#define VBLANK_CYCLES_NTSC      (70 * 228)
+#define VBLANK_CYCLES_PAL       (121 * 228)
+#define VBLANK_CYCLES_RESERVED  2000
+#define VRAM_CYCLES_PER_BYTE    26
+#define VRAM_QUEUE_BUDGET_NTSC  ((VBLANK_CYCLES_NTSC - VBLANK_CYCLES_RESERVED) / VRAM_CYCLES_PER_BYTE)
+#define VRAM_QUEUE_BUDGET_PAL   ((VBLANK_CYCLES_PAL - VBLANK_CYCLES_RESERVED) / VRAM_CYCLES_PER_BYTE)
+#define VRAM_QUEUE_COPY_COST    16
+#define VRAM_QUEUE_SAT_COST     (64 + 128 + 2 * VRAM_QUEUE_COPY_COST)
+
+/* Y value that ends the sprite list */
+#define SPRITE_LIST_END         0xd0
+
+/* Enough commands to load a card and draw it */
+#define VRAM_QUEUE_COMMANDS     32
+#define VRAM_QUEUE_DATA_SIZE    1024
+
+/* A copy of rows to VRAM. Rows that are contiguous in VRAM are copied together.
+ * A command with no rows copies the sprite table instead, or with row_bytes set,
+ * the positions of that many sprites from the data ring. */
+typedef struct vram_command_s {
+    const uint8_t *source;
+    uint16_t destination;   /* VRAM address */
+    uint16_t cost;          /* Budget needed to write the whole command */
+    uint16_t group_cost;    /* Budget needed for the group it starts, or 0 within a group */
+    uint16_t data_start;    /* Position in the data ring */
+    uint8_t row_bytes;
+    uint8_t stride;         /* Distance between rows in VRAM */
+    uint8_t rows;
+    uint8_t bank;           /* ROM bank to map for the source, or 0 for none */
+} vram_command_t;
+
+static vram_command_t commands [VRAM_QUEUE_COMMANDS];
+static volatile uint8_t command_head = 0;   /* Only advanced by the flush */
+static volatile uint8_t command_tail = 0;   /* Only advanced by the game */
+static uint8_t command_reserved = 0;        /* Commands reserved, but perhaps not yet visible */
+static volatile bool queue_running = false;
+static uint16_t queue_budget = VRAM_QUEUE_BUDGET_NTSC;
+
+/* The first command of the group being queued, if any */
+static vram_command_t *group_command = NULL;
+static bool group_open = false;
+
+static uint8_t data [VRAM_QUEUE_DATA_SIZE];
+static uint16_t data_tail = 0;
+
+/* Progress through a command that is too large for a single VBlank */
+static uint8_t flush_row = 0;
+static const uint8_t *flush_source;
+static uint16_t flush_destination;
+
+
+/*
+ * Write VRAM through the queue, flushing from the frame interrupt.
+ */
+void vram_queue_start (void)
+{
+    queue_budget = (SMS_VDPType () & VDP_PAL) ? VRAM_QUEUE_BUDGET_PAL : VRAM_QUEUE_BUDGET_NTSC;
+    queue_running = true;
+}
+
+
+/*
+ * Wait for the queue to empty, then go back to writing VRAM immediately.
+ */
+void vram_queue_stop (void)
+{
+    vram_queue_wait ();
+    queue_running = false;
+}
+
+
+/*
+ * Wait until everything in the queue has been written.
+ */
+void vram_queue_wait (void)
+{
+    while (command_head != command_tail)
+    {
+        SMS_waitForVBlank ();
+    }
+}
+
+
+/*
+ * Write the commands queued until vram_queue_group_end within the same VBlank.
+ * The group must fit within the rings, and should fit within a single VBlank.
+ */
+void vram_queue_group_begin (void)
+{
+    group_open = true;
+    group_command = NULL;
+}
+
+
+/*
+ * Let the flush see the commands queued since vram_queue_group_begin.
+ */
+void vram_queue_group_end (void)
+{
+    group_open = false;
+    command_tail = command_reserved;
+}
+
+
+/*
+ * Reserve the next command, along with size bytes of the data ring.
+ * Waits for the flush to make room if needed. The command is not
+ * seen by the flush until vram_queue_commit is called.
+ */
+static vram_command_t *vram_queue_reserve (uint16_t size)
+{
+    while (true)
+    {
+        uint8_t head = command_head;
+
+        if (((command_reserved + 1) & (VRAM_QUEUE_COMMANDS - 1)) != head)
+        {
+            uint16_t start = commands [head].data_start;
+
+            if (head == command_reserved)
+            {
+                /* Empty, so the whole ring is free */
+                data_tail = 0;
+                break;
+            }
+            else if (data_tail >= start)
+            {
+                /* Free space after the tail, and before the start */
+                if (data_tail + size <= VRAM_QUEUE_DATA_SIZE)
+                {
+                    break;
+                }
+                if (size < start)
+                {
+                    data_tail = 0;
+                    break;
+                }
+            }
+            else if (data_tail + size < start)
+            {
+                /* Free space between the wrapped tail and the start */
+                break;
+            }
+        }
+
+        SMS_waitForVBlank ();
+    }
+
+    vram_command_t *command = &commands [command_reserved];
+    command->source = &data [data_tail];
+    command->data_start = data_tail;
+    command->bank = 0;
+    data_tail += size;
+
+    return command;
+}
+
+
+/*
+ * Make a reserved command visible to the flush, or
+ * add it to the group being queued.
+ */
+static void vram_queue_commit (vram_command_t *command)
+{
+    if (command->rows == 0 && command->row_bytes == 0)
+    {
+        command->cost = VRAM_QUEUE_SAT_COST;
+    }
+    else if (command->rows == 0)
+    {
+        command->cost = 3 * command->row_bytes + 1 + 2 * VRAM_QUEUE_COPY_COST;
+    }
+    else if (command->stride == command->row_bytes)
+    {
+        command->cost = command->rows * command->row_bytes + VRAM_QUEUE_COPY_COST;
+    }
+    else
+    {
+        command->cost = command->rows * (command->row_bytes + VRAM_QUEUE_COPY_COST);
+    }
+
+    command_reserved = (command_reserved + 1) & (VRAM_QUEUE_COMMANDS - 1);
+
+    if (group_open)
+    {
+        /* The first command of the group waits for a VBlank with room for all of it */
+        command->group_cost = 0;
+        if (group_command == NULL)
+        {
+            group_command = command;
+        }
+        group_command->group_cost += command->cost;
+    }
+    else
+    {
+        command->group_cost = command->cost;
+        command_tail = command_reserved;
+    }
+}
+
+
+/*
+ * Queue patterns from RAM. The data is copied, so the buffer can be re-used straight away.
+ * The size must be a multiple of 32 bytes, and no larger than the data ring.
+ */
+void vram_queue_tiles (const void *src, uint16_t tile, uint16_t size)
+{
+    if (!queue_running)
+    {
+        SMS_loadTiles (src, tile, size);
+        return;
+    }
+
+    vram_command_t *command = vram_queue_reserve (size);
+    memcpy ((void *) command->source, src, size);
+    command->destination = tile << 5;
+    command->row_bytes = 32;
+    command->stride = 32;
+    command->rows = size >> 5;
+    vram_queue_commit (command);
+}
+
+
+/*
+ * Queue patterns from a ROM bank. The data is read from ROM when the queue is flushed.
+ * The size must be a multiple of 32 bytes.
+ */
+void vram_queue_tiles_rom (uint8_t bank, const void *src, uint16_t tile, uint16_t size)
+{
+    if (!queue_running)
+    {
+        uint8_t previous_bank = ROM_bank_to_be_mapped_on_slot2;
+        SMS_mapROMBank (bank);
+        SMS_loadTiles (src, tile, size);
+        SMS_mapROMBank (previous_bank);
+        return;
+    }
+
+    vram_command_t *command = vram_queue_reserve (0);
+    command->source = src;
+    command->bank = bank;
+    command->destination = tile << 5;
+    command->row_bytes = 32;
+    command->stride = 32;
+    command->rows = size >> 5;
+    vram_queue_commit (command);
+}
+
+
+/*
+ * Queue a rectangle of name-table entries. The entries are copied.
+ */
+void vram_queue_tilemap (uint8_t x, uint8_t y, const uint16_t *src, uint8_t width, uint8_t height)
+{
+    if (!queue_running)
+    {
+        SMS_loadTileMapArea (x, y, src, width, height);
+        return;
+    }
+
+    uint16_t size = (width * height) << 1;
+
+    vram_command_t *command = vram_queue_reserve (size);
+    memcpy ((void *) command->source, src, size);
+    command->destination = XYtoADDR (x, y);
+    command->row_bytes = width << 1;
+    command->stride = 64;
+    command->rows = height;
+    vram_queue_commit (command);
+}
+
+
+/*
+ * Queue a copy of the sprite table to the SAT.
+ * The sprite table is read when the queue is flushed, so it should
+ * not be changed again until vram_queue_wait has returned.
+ */
+void vram_queue_sprites (void)
+{
+    if (!queue_running)
+    {
+        SMS_copySpritestoSAT ();
+        return;
+    }
+
+    vram_command_t *command = vram_queue_reserve (0);
+    command->rows = 0;
+    command->row_bytes = 0;
+    command->stride = 0;
+    vram_queue_commit (command);
+}
+
+
+/*
+ * Queue new positions for the first count sprites, ending the sprite list after them.
+ * y holds a Y value for each sprite, and xn an X value and tile for each sprite, as
+ * they are laid out in the SAT. Both are copied, and written within the same VBlank.
+ */
+void vram_queue_sprite_positions (const uint8_t *y, const uint8_t *xn, uint8_t count)
+{
+    const uint8_t end = SPRITE_LIST_END;
+
+    if (!queue_running)
+    {
+        SMS_VRAMmemcpy (VRAM_SAT_Y, y, count);
+        SMS_VRAMmemcpy (VRAM_SAT_Y + count, &end, 1);
+        SMS_VRAMmemcpy (VRAM_SAT_XN, xn, count << 1);
+        return;
+    }
+
+    vram_command_t *command = vram_queue_reserve (3 * count + 1);
+    uint8_t *buffer = (uint8_t *) command->source;
+    memcpy (buffer, y, count);
+    buffer [count] = end;
+    memcpy (&buffer [count + 1], xn, count << 1);
+    command->rows = 0;
+    command->row_bytes = count;
+    command->stride = 0;
+    vram_queue_commit (command);
+}
+
+
+/*
+ * Write as much of the queue as fits within VBlank. Called from the frame interrupt.
+ *
+ * Commands and groups that fit within a single VBlank are written whole, so that
+ * they are never seen half-written. Larger commands are written a row at a time,
+ * over as many frames as they need.
+ */
+void vram_queue_flush (void)
+{
+    if (!queue_running)
+    {
+        return;
+    }
+
+    uint16_t budget = queue_budget;
+    uint8_t previous_bank = ROM_bank_to_be_mapped_on_slot2;
+
+    while (command_head != command_tail)
+    {
+        vram_command_t *command = &commands [command_head];
+
+        if (flush_row == 0)
+        {
+            /* Leave a command or group that would fit in the next VBlank until then */
+            if (command->group_cost > budget && command->group_cost <= queue_budget)
+            {
+                break;
+            }
+            flush_source = command->source;
+            flush_destination = command->destination;
+        }
+
+        if (command->rows == 0 && command->row_bytes == 0)
+        {
+            SMS_copySpritestoSAT ();
+            budget -= VRAM_QUEUE_SAT_COST;
+        }
+        else if (command->rows == 0)
+        {
+            SMS_VRAMmemcpy (VRAM_SAT_Y, flush_source, command->row_bytes + 1);
+            SMS_VRAMmemcpy (VRAM_SAT_XN, flush_source + command->row_bytes + 1, command->row_bytes << 1);
+            budget -= command->cost;
+        }
+        else
+        {
+            if (command->bank)
+            {
+                SMS_mapROMBank (command->bank);
+            }
+
+            while (flush_row < command->rows && budget >= command->row_bytes + VRAM_QUEUE_COPY_COST)
+            {
+                uint16_t size = command->row_bytes;
+                budget -= command->row_bytes + VRAM_QUEUE_COPY_COST;
+                flush_row++;
+
+                /* Contiguous rows are copied together */
+                if (command->stride == command->row_bytes)
+                {
+                    while (flush_row < command->rows && budget >= command->row_bytes)
+                    {
+                        size += command->row_bytes;
+                        budget -= command->row_bytes;
+                        flush_row++;
+                    }
+                }
+
+                SMS_VRAMmemcpy (flush_destination, flush_source, size);
+                flush_source += size;
+                flush_destination += (command->stride == command->row_bytes) ? size : command->stride;
+            }
+
+            if (flush_row < command->rows)
+            {
+                break;
+            }
+            flush_row = 0;
+        }
+
+        command_head = (command_head + 1) & (VRAM_QUEUE_COMMANDS - 1);
+    }
+
+    SMS_mapROMBank (previous_bank);
+}
@@ -0,0 +1,39 @@
+/*
+ * Ants for Master System
+ * An Ants clone for the Sega Master System
+ *
+ * VBlank-deferred VRAM write queue header
+ */
+
+/* Write VRAM through the queue, flushing from the frame interrupt. */
+void vram_queue_start (void);
+
+/* Wait for the queue to empty, then go back to writing VRAM immediately. */
+void vram_queue_stop (void);
+
+/* Write the commands queued until vram_queue_group_end within the same VBlank. */
+void vram_queue_group_begin (void);
+
+/* Let the flush see the commands queued since vram_queue_group_begin. */
+void vram_queue_group_end (void);
+
+/* Queue patterns from RAM. The data is copied, so the buffer can be re-used straight away. */
+void vram_queue_tiles (const void *src, uint16_t tile, uint16_t size);
+
+/* Queue patterns from a ROM bank. The data is read from ROM when the queue is flushed. */
+void vram_queue_tiles_rom (uint8_t bank, const void *src, uint16_t tile, uint16_t size);
+
+/* Queue a rectangle of name-table entries. The entries are copied. */
+void vram_queue_tilemap (uint8_t x, uint8_t y, const uint16_t *src, uint8_t width, uint8_t height);
+
+/* Queue a copy of the sprite table to the SAT. */
+void vram_queue_sprites (void);
+
+/* Queue new positions for the first count sprites, ending the sprite list after them. */
+void vram_queue_sprite_positions (const uint8_t *y, const uint8_t *xn, uint8_t count);
+
+/* Wait until everything in the queue has been written. */
+void vram_queue_wait (void);
+
+/* Write as much of the queue as fits within VBlank. Called from the frame interrupt. */
+void vram_queue_flush (void);
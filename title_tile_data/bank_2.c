@@ -0,0 +1,370 @@
+/*
+ * VDP Pattern data, bank 2
+ */
+
+#include <stdint.h>
+
+const uint32_t cursor_patterns [] = {
+    0x0000c000, 0x0000a040, 0x00009060, 0x00008870, 0x00008478, 0x0000827c, 0x0000817e, 0x0000807f,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+    0x0000807f, 0x0000837c, 0x0000926c, 0x0000a946, 0x0000c906, 0x00008403, 0x00000403, 0x00000300,
+    0x00004080, 0x0000e000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000,
+    0x00000000, 0x00000300, 0x00000502, 0x00000502, 0x00001502, 0x00002d12, 0x0000251a, 0x0000100f,
+    0x0000a000, 0x000050a0, 0x000058a0, 0x000054a8, 0x000054a8, 0x000054a8, 0x000054a8, 0x000004f8,
+    0x00000807, 0x00000807, 0x00000403, 0x00000403, 0x00000201, 0x00000700, 0x00000403, 0x00000403,
+    0x000004f8, 0x000004f8, 0x000004f8, 0x000008f0, 0x000008f0, 0x0000fc00, 0x00005ca0, 0x0000ac50,
+    0x00000000, 0x00002320, 0x00003532, 0x00001d1a, 0x00001d0e, 0x00002f16, 0x0000271b, 0x0000110f,
+    0x0000a000, 0x000052a2, 0x00005ea6, 0x00005cac, 0x00005cb8, 0x000074b8, 0x000074e8, 0x0000c4f8,
+    0x00000907, 0x00000b07, 0x00000607, 0x00000c0f, 0x00001a19, 0x00003730, 0x00002423, 0x00000403,
+    0x0000c4f8, 0x000064f8, 0x000034f8, 0x000018f8, 0x00000cfc, 0x0000fe06, 0x00005ea2, 0x0000ac50,
+};
+
+const uint8_t title_patterns_compressed [5362] = {
+    0x94, 0x01, 0x3f, 0xf0, 0xff, 0x80, 0xbf, 0xa0, 0xf4, 0x00, 0x7f, 0x60, 0xf6, 0x00, 0x1f, 0x3f,
+    0xf0, 0xff, 0x00, 0xff, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xff, 0x3f, 0x40, 0xff, 0x00,
+    0xff, 0x00, 0x80, 0x00, 0x46, 0xf4, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xff, 0x3f, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x12, 0x40, 0x00, 0x98, 0xf4, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xff, 0x3f, 0x70, 0xff,
+    0x00, 0xff, 0x00, 0x11, 0xf4, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xff, 0x3f, 0x90, 0xff, 0x00, 0xff,
+    0x00, 0x20, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xff, 0x3f, 0x50, 0xff, 0x00, 0xff, 0x00,
+    0x20, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xff, 0x3f, 0xf0, 0xff, 0x00, 0xff, 0x00, 0x34,
+    0x00, 0xff, 0x00, 0x07, 0x0f, 0xf6, 0x00, 0xff, 0x3f, 0xf0, 0xff, 0x00, 0xff, 0x00, 0xb4, 0x00,
+    0xff, 0x00, 0x80, 0xf6, 0x00, 0xff, 0x3f, 0x10, 0xff, 0x00, 0xff, 0x00, 0x06, 0x01, 0x07, 0x14,
+    0x00, 0xff, 0x00, 0x06, 0x01, 0x07, 0x16, 0x00, 0xff, 0xf9, 0xfe, 0xf8, 0x3f, 0x10, 0xff, 0x00,
+    0xff, 0x00, 0x70, 0x41, 0x71, 0x14, 0x00, 0xff, 0x00, 0x70, 0x41, 0x71, 0x16, 0x00, 0xff, 0x8f,
+    0xbe, 0x8e, 0x3f, 0x10, 0xff, 0x00, 0xff, 0x00, 0x98, 0x44, 0x48, 0x14, 0x00, 0xff, 0x00, 0x98,
+    0x44, 0x48, 0x16, 0x00, 0xff, 0x67, 0xbb, 0xb7, 0x0f, 0xf8, 0xff, 0x00, 0x80, 0xf8, 0x00, 0xff,
+    0x7f, 0x0f, 0xfc, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x0f, 0xfc, 0xff, 0x01, 0xfc, 0x01, 0xff, 0x3f,
+    0xfe, 0xa0, 0xfe, 0x60, 0xfe, 0x1f, 0x13, 0x1e, 0x00, 0x42, 0x00, 0x81, 0x13, 0x00, 0x00, 0x10,
+    0x25, 0x26, 0x0c, 0x89, 0x02, 0x69, 0x13, 0x00, 0x85, 0x82, 0x01, 0x35, 0x9e, 0x6a, 0x3f, 0x37,
+    0x13, 0x00, 0x38, 0x00, 0x8a, 0x30, 0x37, 0x53, 0x7f, 0xe7, 0x13, 0x00, 0x04, 0x00, 0x81, 0xe1,
+    0x44, 0x69, 0x14, 0x79, 0x13, 0x00, 0x00, 0x20, 0x00, 0x04, 0x88, 0x20, 0x58, 0x60, 0x13, 0xf0,
+    0x04, 0x00, 0x10, 0x00, 0x10, 0x1c, 0x10, 0x0f, 0x1f, 0x1b, 0x33, 0x63, 0xe3, 0xff, 0x1c, 0xa6,
+    0x80, 0x81, 0x80, 0xc1, 0x1c, 0x82, 0x00, 0x0f, 0xff, 0xe7, 0xc3, 0xc7, 0x1c, 0x80, 0x03, 0x06,
+    0x0f, 0xbf, 0x8e, 0x9e, 0x1c, 0x1c, 0x62, 0x00, 0x07, 0xdf, 0x38, 0x3f, 0x1c, 0xba, 0x00, 0xc0,
+    0x00, 0x3b, 0xf8, 0x04, 0x07, 0x00, 0xf8, 0xfb, 0xf8, 0xff, 0x3b, 0xf8, 0x11, 0x64, 0x00, 0xf8,
+    0xee, 0x9b, 0xff, 0x3b, 0xf8, 0x44, 0x98, 0x00, 0xf8, 0xbb, 0x67, 0xff, 0x0f, 0xfe, 0x80, 0xfe,
+    0x7f, 0x04, 0x07, 0xfe, 0x01, 0x3f, 0xcc, 0xa2, 0xa0, 0xa4, 0xa0, 0xfe, 0x60, 0xfe, 0x1f, 0x13,
+    0x00, 0x00, 0x01, 0x40, 0x08, 0x40, 0x04, 0x50, 0x00, 0x13, 0x00, 0x81, 0x96, 0xd7, 0x7a, 0xab,
+    0x3f, 0x2b, 0xaf, 0x13, 0x00, 0xbf, 0xff, 0xef, 0xbf, 0x7f, 0xff, 0xbf, 0xf0, 0x13, 0x32, 0x87,
+    0x8e, 0xbe, 0x06, 0x00, 0x13, 0x80, 0xfc, 0x1f, 0x14, 0x1a, 0xf3, 0xdf, 0xff, 0x13, 0x00, 0x81,
+    0x38, 0x40, 0xa2, 0xe9, 0x9c, 0xb2, 0xfc, 0x13, 0x00, 0xc0, 0x10, 0x81, 0x44, 0x10, 0x88, 0xa0,
+    0xc4, 0x13, 0xe2, 0x00, 0x20, 0x80, 0x00, 0x1c, 0x42, 0x01, 0x03, 0x07, 0x06, 0x3f, 0x00, 0x1c,
+    0x18, 0xff, 0x83, 0x03, 0x87, 0x07, 0x00, 0x1c, 0x5c, 0xc1, 0xc3, 0xff, 0x00, 0x1c, 0x52, 0xc7,
+    0x86, 0x8e, 0xff, 0x00, 0x1c, 0x5c, 0x1c, 0x38, 0x3e, 0x00, 0x1c, 0x10, 0x3f, 0x0f, 0x03, 0xc3,
+    0xff, 0xfe, 0x00, 0x1c, 0xde, 0x80, 0x00, 0x3f, 0x3e, 0xa0, 0xa4, 0xa0, 0xfe, 0x60, 0xfe, 0x1f,
+    0x13, 0x00, 0x00, 0x87, 0x01, 0x21, 0x2b, 0x09, 0x4f, 0x0b, 0x13, 0x00, 0xe7, 0xdf, 0x7f, 0xff,
+    0x5c, 0xfc, 0x78, 0xf8, 0x33, 0xa0, 0xe0, 0x80, 0x03, 0x07, 0x0f, 0x0e, 0xa2, 0xff, 0xfc, 0xf8,
+    0xf0, 0xf1, 0x33, 0x82, 0x00, 0xc3, 0xe7, 0xef, 0x3f, 0x1e, 0x82, 0xff, 0x3c, 0x18, 0x10, 0xc0,
+    0xe1, 0x33, 0x00, 0x3f, 0x1e, 0xcf, 0xe7, 0xe3, 0x31, 0x11, 0x10, 0x92, 0xff, 0x3f, 0x1f, 0xcf,
+    0xef, 0x13, 0x00, 0xfc, 0xf8, 0xcc, 0xec, 0xf5, 0xb9, 0xb0, 0xf7, 0x13, 0x00, 0x10, 0x00, 0x01,
+    0xfa, 0x50, 0x52, 0x80, 0x02, 0x13, 0xe6, 0x00, 0x08, 0x00, 0x07, 0x7e, 0x00, 0x03, 0x07, 0x7e,
+    0x00, 0xc0, 0x3f, 0x3e, 0xa0, 0xa1, 0xa0, 0xfe, 0x60, 0xfe, 0x1f, 0x13, 0x00, 0x4b, 0xbd, 0x15,
+    0xfa, 0x41, 0x07, 0x3f, 0x03, 0x13, 0xe8, 0x78, 0xf8, 0x70, 0xf0, 0x33, 0x0e, 0x0e, 0x0f, 0x07,
+    0x03, 0x00, 0x0e, 0xf1, 0xf0, 0xf8, 0xfc, 0xff, 0x33, 0x0e, 0x1e, 0x2f, 0xc7, 0x83, 0x00, 0x0e,
+    0xe1, 0xd0, 0x38, 0x7c, 0xff, 0x33, 0x0e, 0x10, 0x20, 0xc0, 0x80, 0x00, 0x0e, 0xef, 0xdf, 0x3f,
+    0x7f, 0xff, 0x13, 0x00, 0xb6, 0xd8, 0x3e, 0xff, 0x74, 0xef, 0x78, 0xf9, 0x13, 0x00, 0x12, 0xa0,
+    0x30, 0xd4, 0x20, 0x00, 0x18, 0x80, 0x13, 0x80, 0x80, 0x50, 0x20, 0x00, 0x40, 0x10, 0x00, 0x33,
+    0x42, 0x00, 0x90, 0xd2, 0xb5, 0x95, 0x92, 0x42, 0xff, 0x6f, 0x2d, 0x4a, 0x6a, 0x6d, 0x33, 0x66,
+    0x00, 0x09, 0x15, 0x09, 0x66, 0xff, 0xf6, 0xea, 0xf6, 0x33, 0x06, 0x00, 0x88, 0x54, 0x5c, 0x50,
+    0x4c, 0x06, 0xff, 0x77, 0xab, 0xa3, 0xaf, 0xb3, 0x33, 0x02, 0x00, 0x02, 0x25, 0x54, 0x56, 0x54,
+    0x24, 0x02, 0xff, 0xfd, 0xda, 0xab, 0xa9, 0xab, 0xdb, 0x33, 0x42, 0x00, 0x12, 0x1a, 0x13, 0x12,
+    0x0a, 0x42, 0xff, 0xed, 0xe5, 0xec, 0xed, 0xf5, 0x33, 0x06, 0x00, 0x10, 0x28, 0xb8, 0xa0, 0x98,
+    0x06, 0xff, 0xef, 0xd7, 0x47, 0x5f, 0x67, 0x33, 0x42, 0x00, 0x88, 0x89, 0xca, 0xaa, 0xc9, 0x42,
+    0xff, 0x77, 0x76, 0x35, 0x55, 0x36, 0x33, 0x02, 0x00, 0x02, 0x92, 0xaa, 0xa3, 0xaa, 0x92, 0x02,
+    0xff, 0xfd, 0x6d, 0x55, 0x5c, 0x55, 0x6d, 0x33, 0x06, 0x00, 0x04, 0x8a, 0x0a, 0x8a, 0x84, 0x06,
+    0xff, 0xfb, 0x75, 0xf5, 0x75, 0x7b, 0x33, 0xe6, 0x00, 0x42, 0x84, 0xe6, 0xff, 0xbd, 0x7b, 0x33,
+    0x02, 0x00, 0x02, 0x42, 0xa6, 0xea, 0x8a, 0x66, 0x02, 0xff, 0xfd, 0xbd, 0x59, 0x15, 0x75, 0x99,
+    0x33, 0x66, 0x00, 0x1b, 0x2a, 0x1a, 0x66, 0xff, 0xe4, 0xd5, 0xe5, 0x33, 0x02, 0x00, 0x20, 0x32,
+    0xa4, 0xa6, 0xa2, 0x94, 0x02, 0xff, 0xdf, 0xcd, 0x5b, 0x59, 0x5d, 0x6b, 0x3f, 0x10, 0x04, 0x0b,
+    0x16, 0x14, 0x16, 0x0b, 0x04, 0x38, 0xfc, 0xf8, 0xf0, 0xfc, 0xfb, 0x90, 0x03, 0x04, 0x09, 0x0b,
+    0x09, 0x00, 0x3f, 0x10, 0x20, 0xd0, 0x68, 0x28, 0x68, 0xd0, 0x20, 0x38, 0x3f, 0x0f, 0x17, 0x2f,
+    0xdf, 0x90, 0xc0, 0x20, 0x80, 0xc0, 0x80, 0x00, 0x3c, 0x20, 0xff, 0x37, 0x56, 0x35, 0x55, 0x36,
+    0xff, 0x20, 0x00, 0xc8, 0xa9, 0xca, 0xaa, 0xc9, 0x00, 0x3c, 0x00, 0xff, 0xfd, 0x6d, 0x55, 0x5c,
+    0x55, 0x6d, 0xff, 0x00, 0x00, 0x02, 0x92, 0xaa, 0xa3, 0xaa, 0x92, 0x00, 0x3c, 0x02, 0xff, 0xef,
+    0x5f, 0xcf, 0x6f, 0x5f, 0xff, 0x02, 0x00, 0x10, 0xa0, 0x30, 0x90, 0xa0, 0x00, 0x3f, 0xf0, 0xa8,
+    0xa0, 0xa1, 0xa0, 0xfe, 0x60, 0xfe, 0x1f, 0x13, 0x00, 0x26, 0x1d, 0x13, 0x5b, 0x23, 0x0e, 0x0f,
+    0x5e, 0x13, 0x06, 0xf8, 0xfc, 0x9c, 0xfc, 0xff, 0xbf, 0x33, 0x60, 0x00, 0x01, 0x02, 0x05, 0x00,
+    0x80, 0xe0, 0xff, 0xfe, 0xfd, 0xfa, 0xff, 0x3f, 0x16, 0x00, 0xff, 0x7e, 0x38, 0x00, 0x8e, 0x00,
+    0x7e, 0x38, 0x00, 0x06, 0xff, 0x00, 0x7e, 0xb9, 0xc7, 0xff, 0x33, 0x00, 0x00, 0x40, 0x21, 0xd1,
+    0x01, 0x03, 0x0e, 0x1d, 0xe0, 0xff, 0xbf, 0xdf, 0x2f, 0xff, 0x13, 0x00, 0xee, 0xff, 0x7a, 0x9f,
+    0x3f, 0xfa, 0xb4, 0xd6, 0x13, 0x04, 0x92, 0x00, 0x80, 0x00, 0x08, 0x18, 0x20, 0x13, 0xe6, 0x00,
+    0x50, 0x00, 0x33, 0x06, 0x00, 0x46, 0xaa, 0x8a, 0xaa, 0x46, 0x06, 0xff, 0xb9, 0x55, 0x75, 0x55,
+    0xb9, 0x33, 0xe6, 0x00, 0xc1, 0xa2, 0xe6, 0xff, 0x3e, 0x5d, 0x33, 0x06, 0x00, 0x27, 0x55, 0x75,
+    0x45, 0x35, 0x06, 0xff, 0xd8, 0xaa, 0x8a, 0xba, 0xca, 0x33, 0x06, 0x00, 0x89, 0x55, 0x5d, 0x51,
+    0x4d, 0x06, 0xff, 0x76, 0xaa, 0xa2, 0xae, 0xb2, 0x33, 0x42, 0x00, 0x04, 0xe4, 0x56, 0x55, 0x56,
+    0x42, 0xff, 0xfb, 0x1b, 0xa9, 0xaa, 0xa9, 0x33, 0x06, 0x00, 0x22, 0x54, 0x74, 0x44, 0x34, 0x06,
+    0xff, 0xdd, 0xab, 0x8b, 0xbb, 0xcb, 0x33, 0x56, 0x00, 0x22, 0x2a, 0x14, 0x56, 0xff, 0xdd, 0xd5,
+    0xeb, 0x33, 0x42, 0x00, 0x80, 0x84, 0xca, 0xaa, 0xa4, 0x42, 0xff, 0x7f, 0x7b, 0x35, 0x55, 0x5b,
+    0x33, 0x66, 0x00, 0x11, 0x2a, 0x12, 0x66, 0xff, 0xee, 0xd5, 0xed, 0x33, 0x56, 0x00, 0x11, 0x15,
+    0x0a, 0x56, 0xff, 0xee, 0xea, 0xf5, 0x33, 0x02, 0x00, 0x40, 0x42, 0x65, 0x57, 0x54, 0x53, 0x02,
+    0xff, 0xbf, 0xbd, 0x9a, 0xa8, 0xab, 0xac, 0x33, 0xe6, 0x00, 0x60, 0x50, 0xe6, 0xff, 0x9f, 0xaf,
+    0x0f, 0x7c, 0x03, 0x00, 0x03, 0xfc, 0xfc, 0xff, 0x0f, 0x7c, 0xc0, 0x00, 0xc0, 0xfc, 0x3f, 0xff,
+    0x3f, 0x7e, 0xa0, 0xa1, 0xfe, 0x60, 0xfe, 0x1f, 0x13, 0x00, 0x51, 0x19, 0x16, 0x20, 0x7c, 0x21,
+    0x0c, 0x25, 0x13, 0x04, 0x97, 0xff, 0x5f, 0xb7, 0x7f, 0xbf, 0x3f, 0x13, 0x38, 0xe0, 0xf8, 0xff,
+    0x7f, 0x3f, 0x13, 0x72, 0x00, 0x07, 0xff, 0xf7, 0x13, 0x04, 0x3e, 0xff, 0xdf, 0xf4, 0x9e, 0xfc,
+    0xb8, 0x13, 0x00, 0xad, 0x78, 0x62, 0xca, 0x82, 0x62, 0x40, 0xc0, 0x13, 0x80, 0x04, 0x08, 0x04,
+    0x10, 0x00, 0x80, 0x00, 0x33, 0x02, 0x00, 0x10, 0x59, 0x92, 0xd2, 0x52, 0x89, 0x02, 0xff, 0xef,
+    0xa6, 0x6d, 0x2d, 0xad, 0x76, 0x33, 0x62, 0x00, 0x04, 0x96, 0xa4, 0xa2, 0x62, 0xff, 0xfb, 0x69,
+    0x5b, 0x5d, 0x33, 0x42, 0x00, 0x24, 0x34, 0x26, 0x25, 0x15, 0x42, 0xff, 0xdb, 0xcb, 0xd9, 0xda,
+    0xea, 0x33, 0x02, 0x00, 0x04, 0x20, 0x55, 0x75, 0x45, 0x35, 0x02, 0xff, 0xfb, 0xdf, 0xaa, 0x8a,
+    0xba, 0xca, 0x33, 0x66, 0x00, 0x86, 0x0a, 0x06, 0x66, 0xff, 0x79, 0xf5, 0xf9, 0x33, 0x06, 0x00,
+    0x64, 0xaa, 0xae, 0xa8, 0x66, 0x06, 0xff, 0x9b, 0x55, 0x51, 0x57, 0x99, 0x33, 0x02, 0x00, 0x01,
+    0x09, 0x15, 0xd5, 0x15, 0x09, 0x02, 0xff, 0xfe, 0xf6, 0xea, 0x2a, 0xea, 0xf6, 0x33, 0x42, 0x00,
+    0x10, 0x11, 0x31, 0x51, 0x30, 0x42, 0xff, 0xef, 0xee, 0xce, 0xae, 0xcf, 0x33, 0x46, 0x00, 0x13,
+    0x15, 0x55, 0xa3, 0x46, 0xff, 0xec, 0xea, 0xaa, 0x5c, 0x33, 0x82, 0x00, 0x01, 0x22, 0x42, 0x43,
+    0x42, 0x82, 0xff, 0xfe, 0xdd, 0xbd, 0xbc, 0xbd, 0x33, 0x66, 0x00, 0x91, 0x2a, 0x12, 0x66, 0xff,
+    0x6e, 0xd5, 0xed, 0x3f, 0x38, 0x04, 0x0b, 0x17, 0x0b, 0x04, 0x38, 0xfc, 0xf8, 0xf0, 0xfc, 0xfb,
+    0xb8, 0x03, 0x04, 0x08, 0x00, 0x3f, 0x38, 0x20, 0xd0, 0xe8, 0xd0, 0x20, 0x38, 0x3f, 0x0f, 0x17,
+    0x2f, 0xdf, 0xf8, 0xc0, 0x20, 0x00, 0x3c, 0x00, 0xff, 0x3f, 0x5b, 0x55, 0x31, 0x57, 0x59, 0xff,
+    0x00, 0x00, 0xc0, 0xa4, 0xaa, 0xce, 0xa8, 0xa6, 0x00, 0x3c, 0x00, 0xff, 0xdf, 0xdb, 0x97, 0x53,
+    0x5b, 0x97, 0xff, 0x00, 0x00, 0x20, 0x24, 0x68, 0xac, 0xa4, 0x68, 0x00, 0x13, 0x9e, 0x00, 0x01,
+    0x00, 0x13, 0x80, 0x5f, 0x13, 0x07, 0x36, 0x04, 0x80, 0x00, 0x13, 0x00, 0xfd, 0xff, 0x37, 0x15,
+    0x3b, 0x33, 0x8a, 0x14, 0x13, 0x02, 0xf3, 0xe8, 0xe4, 0x0a, 0xaa, 0x01, 0xe8, 0x13, 0x00, 0xff,
+    0xf5, 0x50, 0x04, 0x4a, 0x81, 0x48, 0x22, 0x13, 0x00, 0x80, 0x00, 0xa0, 0x40, 0x90, 0x82, 0x20,
+    0x21, 0x13, 0xa0, 0x44, 0x00, 0x40, 0x04, 0x80, 0x00, 0x33, 0x42, 0x00, 0x90, 0xd0, 0x99, 0x95,
+    0x54, 0x42, 0xff, 0x6f, 0x2f, 0x66, 0x6a, 0xab, 0x33, 0x02, 0x00, 0x05, 0x85, 0x40, 0xc0, 0x00,
+    0xc0, 0x02, 0xff, 0xfa, 0x7a, 0xbf, 0x3f, 0xff, 0x3f, 0x33, 0x02, 0x00, 0x48, 0x69, 0x5a, 0x4b,
+    0x4a, 0x49, 0x02, 0xff, 0xb7, 0x96, 0xa5, 0xb4, 0xb5, 0xb6, 0x33, 0x26, 0x00, 0x19, 0xaa, 0x2a,
+    0x9a, 0x26, 0xff, 0xe6, 0x55, 0xd5, 0x65, 0x33, 0x72, 0x00, 0x1c, 0x09, 0x08, 0x72, 0xff, 0xe3,
+    0xf6, 0xf7, 0x33, 0x46, 0x00, 0x12, 0x15, 0x55, 0xa2, 0x46, 0xff, 0xed, 0xea, 0xaa, 0x5d, 0x33,
+    0x40, 0x20, 0x40, 0x0c, 0x11, 0x1d, 0x05, 0x19, 0x40, 0xdf, 0xbf, 0xf3, 0xee, 0xe2, 0xfa, 0xe6,
+    0x33, 0x66, 0x00, 0x8a, 0x52, 0x91, 0x66, 0xff, 0x75, 0xad, 0x6e, 0x33, 0x06, 0x00, 0x91, 0xaa,
+    0xa3, 0xaa, 0x91, 0x06, 0xff, 0x6e, 0x55, 0x5c, 0x55, 0x6e, 0x33, 0x02, 0x00, 0x05, 0x15, 0xa0,
+    0xb0, 0x10, 0xa0, 0x02, 0xff, 0xfa, 0xea, 0x5f, 0x4f, 0xef, 0x5f, 0x33, 0x66, 0x00, 0x0d, 0x15,
+    0x0d, 0x66, 0xff, 0xf2, 0xea, 0xf2, 0x33, 0x42, 0x00, 0x12, 0x9a, 0x53, 0x52, 0x4a, 0x42, 0xff,
+    0xed, 0x65, 0xac, 0xad, 0xb5, 0x33, 0xc2, 0x00, 0x2a, 0x0a, 0x2a, 0xaa, 0xc2, 0xff, 0xd5, 0xf5,
+    0xd5, 0x55, 0x33, 0x7e, 0x00, 0x80, 0x7e, 0xff, 0x7f, 0x13, 0x92, 0x00, 0x20, 0x00, 0x10, 0x00,
+    0x13, 0xc0, 0x10, 0x01, 0x02, 0x00, 0x02, 0x00, 0x13, 0xc0, 0x12, 0x48, 0xc8, 0x01, 0x05, 0x00,
+    0x13, 0x20, 0x20, 0x81, 0x00, 0x20, 0x00, 0x02, 0x04, 0x33, 0xfa, 0x01, 0x00, 0xfa, 0xfe, 0xff,
+    0x3c, 0x08, 0xff, 0x3c, 0xdd, 0xbc, 0x7d, 0x1d, 0xff, 0x08, 0x00, 0xc3, 0x22, 0x43, 0x82, 0xe2,
+    0x00, 0x3c, 0x20, 0xff, 0xdf, 0x59, 0x55, 0xd5, 0xd9, 0xff, 0x20, 0x00, 0x20, 0xa6, 0xaa, 0x2a,
+    0x26, 0x00, 0x3c, 0x02, 0xff, 0x5b, 0x55, 0x51, 0x57, 0x99, 0xdf, 0x02, 0x00, 0xa4, 0xaa, 0xae,
+    0xa8, 0x66, 0x20, 0x3c, 0x72, 0xff, 0xbf, 0x7f, 0xff, 0x72, 0x00, 0x40, 0x80, 0x00, 0x33, 0x62,
+    0x00, 0xe0, 0x44, 0x4a, 0x44, 0x62, 0xff, 0x1f, 0xbb, 0xb5, 0xbb, 0x33, 0x06, 0x00, 0x13, 0x2a,
+    0x3a, 0x22, 0x1a, 0x06, 0xff, 0xec, 0xd5, 0xc5, 0xdd, 0xe5, 0x33, 0x4a, 0x00, 0x08, 0x98, 0xa8,
+    0x98, 0x4a, 0xff, 0xf7, 0x67, 0x57, 0x67, 0x33, 0x02, 0x00, 0x10, 0x82, 0x54, 0xd4, 0x14, 0xd4,
+    0x02, 0xff, 0xef, 0x7d, 0xab, 0x2b, 0xeb, 0x2b, 0x33, 0x62, 0x00, 0x24, 0x31, 0x25, 0x15, 0x62,
+    0xff, 0xdb, 0xce, 0xda, 0xea, 0x33, 0x06, 0x00, 0xe2, 0x55, 0x57, 0x54, 0x53, 0x06, 0xff, 0x1d,
+    0xaa, 0xa8, 0xab, 0xac, 0x33, 0x02, 0x00, 0x40, 0x48, 0x55, 0x5d, 0x50, 0x4d, 0x02, 0xff, 0xbf,
+    0xb7, 0xaa, 0xa2, 0xaf, 0xb2, 0x33, 0x06, 0x00, 0x90, 0x20, 0xb1, 0x91, 0x20, 0x06, 0xff, 0x6f,
+    0xdf, 0x4e, 0x6e, 0xdf, 0x33, 0x42, 0x00, 0x40, 0x54, 0xd5, 0x55, 0xcc, 0x42, 0xff, 0xbf, 0xab,
+    0x2a, 0xaa, 0x33, 0x33, 0x02, 0x00, 0x10, 0x92, 0x54, 0xd6, 0x12, 0xd4, 0x02, 0xff, 0xef, 0x6d,
+    0xab, 0x29, 0xed, 0x2b, 0x33, 0x06, 0x00, 0x25, 0x55, 0x75, 0x45, 0x33, 0x06, 0xff, 0xda, 0xaa,
+    0x8a, 0xba, 0xcc, 0x33, 0x4a, 0x00, 0x04, 0x0d, 0x15, 0x0c, 0x4a, 0xff, 0xfb, 0xf2, 0xea, 0xf3,
+    0x33, 0x02, 0x00, 0x01, 0x88, 0x55, 0xd1, 0x15, 0xc9, 0x02, 0xff, 0xfe, 0x77, 0xaa, 0x2e, 0xea,
+    0x36, 0x33, 0x02, 0x00, 0x10, 0x12, 0x35, 0x57, 0x54, 0x33, 0x02, 0xff, 0xef, 0xed, 0xca, 0xa8,
+    0xab, 0xcc, 0x33, 0x4a, 0x00, 0x11, 0x31, 0x51, 0x30, 0x4a, 0xff, 0xee, 0xce, 0xae, 0xcf, 0x33,
+    0x66, 0x00, 0x90, 0x28, 0x90, 0x66, 0xff, 0x6f, 0xd7, 0x6f, 0x33, 0x42, 0x00, 0x80, 0x8a, 0xca,
+    0xaa, 0xc6, 0x42, 0xff, 0x7f, 0x75, 0x35, 0x55, 0x39, 0x33, 0x42, 0x00, 0xa2, 0x22, 0xa6, 0xaa,
+    0xa6, 0x42, 0xff, 0x5d, 0xdd, 0x59, 0x55, 0x59, 0x3c, 0xfc, 0xbf, 0xff, 0xfc, 0x40, 0x00, 0x33,
+    0x02, 0x00, 0x12, 0x5a, 0x92, 0xd2, 0x52, 0x8a, 0x02, 0xff, 0xed, 0xa5, 0x6d, 0x2d, 0xad, 0x75,
+    0x33, 0x06, 0x00, 0x44, 0xa8, 0xec, 0x84, 0x68, 0x06, 0xff, 0xbb, 0x57, 0x13, 0x7b, 0x97, 0x33,
+    0x42, 0x00, 0x01, 0x44, 0x45, 0x55, 0x29, 0x42, 0xff, 0xfe, 0xbb, 0xba, 0xaa, 0xd6, 0x33, 0x42,
+    0x00, 0x48, 0x68, 0x4c, 0x4a, 0x2a, 0x42, 0xff, 0xb7, 0x97, 0xb3, 0xb5, 0xd5, 0x33, 0x42, 0x00,
+    0x88, 0x81, 0xca, 0xaa, 0xa9, 0x42, 0xff, 0x77, 0x7e, 0x35, 0x55, 0x56, 0x33, 0x0a, 0x00, 0x20,
+    0xb0, 0x28, 0xa8, 0x28, 0x0a, 0xff, 0xdf, 0x4f, 0xd7, 0x57, 0xd7, 0x33, 0x06, 0x00, 0x94, 0x54,
+    0xd4, 0x14, 0xcc, 0x06, 0xff, 0x6b, 0xab, 0x2b, 0xeb, 0x33, 0x33, 0x06, 0x00, 0x22, 0x55, 0x45,
+    0x55, 0x22, 0x06, 0xff, 0xdd, 0xaa, 0xba, 0xaa, 0xdd, 0x33, 0x52, 0x00, 0x04, 0x54, 0x55, 0x34,
+    0x52, 0xff, 0xfb, 0xab, 0xaa, 0xcb, 0x33, 0x42, 0x00, 0x40, 0x43, 0xc5, 0x45, 0xc3, 0x42, 0xff,
+    0xbf, 0xbc, 0x3a, 0xba, 0x3c, 0x33, 0x00, 0x01, 0x02, 0x00, 0x23, 0x55, 0x45, 0x55, 0x23, 0x00,
+    0xfe, 0xfd, 0xff, 0xdc, 0xaa, 0xba, 0xaa, 0xdc, 0x33, 0x62, 0x00, 0x04, 0x50, 0x55, 0x35, 0x62,
+    0xff, 0xfb, 0xaf, 0xaa, 0xca, 0x33, 0x06, 0x00, 0x90, 0x28, 0x38, 0x20, 0x18, 0x06, 0xff, 0x6f,
+    0xd7, 0xc7, 0xdf, 0xe7, 0x33, 0x42, 0x00, 0x20, 0x24, 0x6a, 0xaa, 0x64, 0x42, 0xff, 0xdf, 0xdb,
+    0x95, 0x55, 0x9b, 0x33, 0xe2, 0x00, 0x02, 0xf0, 0xaa, 0xe2, 0xff, 0xfd, 0x0f, 0x55, 0x33, 0x62,
+    0x00, 0x08, 0xc1, 0xaa, 0xa9, 0x62, 0xff, 0xf7, 0x3e, 0x55, 0x56, 0x33, 0x66, 0x00, 0x30, 0xa8,
+    0x28, 0x66, 0xff, 0xcf, 0x57, 0xd7, 0x33, 0x66, 0x00, 0x4a, 0xaa, 0x44, 0x66, 0xff, 0xb5, 0x55,
+    0xbb, 0x33, 0x06, 0x00, 0x44, 0xa8, 0xe8, 0x88, 0x68, 0x06, 0xff, 0xbb, 0x57, 0x17, 0x77, 0x97,
+    0x3c, 0x20, 0xff, 0x31, 0x57, 0x53, 0x57, 0x31, 0xff, 0x20, 0x00, 0xce, 0xa8, 0xac, 0xa8, 0xce,
+    0x00, 0x3c, 0x20, 0xff, 0x76, 0x25, 0x55, 0x75, 0x76, 0xff, 0x20, 0x00, 0x89, 0xda, 0xaa, 0x8a,
+    0x89, 0x00, 0x3c, 0xba, 0xff, 0x7f, 0xff, 0xba, 0x00, 0x80, 0x00, 0x33, 0x06, 0x00, 0x84, 0x44,
+    0xc5, 0x05, 0xc2, 0x06, 0xff, 0x7b, 0xbb, 0x3a, 0xfa, 0x3d, 0x33, 0x42, 0x00, 0x10, 0x50, 0x59,
+    0x55, 0x94, 0x42, 0xff, 0xef, 0xaf, 0xa6, 0xaa, 0x6b, 0x33, 0x02, 0x00, 0x10, 0x92, 0x55, 0x57,
+    0x54, 0x93, 0x02, 0xff, 0xef, 0x6d, 0xaa, 0xa8, 0xab, 0x6c, 0x33, 0x02, 0x00, 0x10, 0x19, 0x12,
+    0x13, 0x12, 0x09, 0x02, 0xff, 0xef, 0xe6, 0xed, 0xec, 0xed, 0xf6, 0x33, 0x26, 0x00, 0x12, 0xa4,
+    0x24, 0xa4, 0x26, 0xff, 0xed, 0x5b, 0xdb, 0x5b, 0x33, 0x62, 0x00, 0xa0, 0x32, 0xa5, 0x92, 0x62,
+    0xff, 0x5f, 0xcd, 0x5a, 0x6d, 0x33, 0x66, 0x00, 0x2a, 0x4a, 0x46, 0x66, 0xff, 0xd5, 0xb5, 0xb9,
+    0x33, 0xf8, 0x04, 0x08, 0x00, 0xf8, 0xfb, 0xf7, 0xff, 0x33, 0xfc, 0x01, 0x00, 0xfc, 0xfe, 0xff,
+    0x33, 0xf8, 0x00, 0x80, 0x00, 0xf8, 0xff, 0x7f, 0xff, 0x0f, 0xfc, 0x03, 0x00, 0xfc, 0xfc, 0xff,
+    0x0f, 0xfc, 0xc0, 0x00, 0xfc, 0x3f, 0xff, 0x33, 0xf8, 0x02, 0x04, 0x00, 0xf8, 0xfd, 0xfb, 0xff,
+    0x33, 0xc2, 0x00, 0xe8, 0x48, 0x4c, 0x4a, 0xc2, 0xff, 0x17, 0xb7, 0xb3, 0xb5, 0x33, 0x06, 0x00,
+    0x41, 0xa2, 0xe2, 0x82, 0x61, 0x06, 0xff, 0xbe, 0x5d, 0x1d, 0x7d, 0x9e, 0x33, 0x66, 0x00, 0x91,
+    0xaa, 0x91, 0x66, 0xff, 0x6e, 0x55, 0x6e, 0x33, 0x62, 0x00, 0x20, 0xa1, 0xa2, 0xa1, 0x62, 0xff,
+    0xdf, 0x5e, 0x5d, 0x5e, 0x33, 0x02, 0x00, 0x10, 0x28, 0xa0, 0xb0, 0xa0, 0x20, 0x02, 0xff, 0xef,
+    0xd7, 0x5f, 0x4f, 0x5f, 0xdf, 0x33, 0x06, 0x00, 0x83, 0x45, 0xc5, 0x05, 0xc3, 0x06, 0xff, 0x7c,
+    0xba, 0x3a, 0xfa, 0x3c, 0x33, 0x66, 0x00, 0x37, 0x55, 0x35, 0x66, 0xff, 0xc8, 0xaa, 0xca, 0x33,
+    0x02, 0x00, 0x40, 0x08, 0x50, 0x58, 0x48, 0x50, 0x02, 0xff, 0xbf, 0xf7, 0xaf, 0xa7, 0xb7, 0xaf,
+    0x33, 0x62, 0x00, 0x80, 0xc8, 0x94, 0x48, 0x62, 0xff, 0x7f, 0x37, 0x6b, 0xb7, 0x33, 0x42, 0x00,
+    0x40, 0x45, 0x65, 0x55, 0x63, 0x42, 0xff, 0xbf, 0xba, 0x9a, 0xaa, 0x9c, 0x33, 0x42, 0x00, 0x51,
+    0x11, 0x53, 0x55, 0x53, 0x42, 0xff, 0xae, 0xee, 0xac, 0xaa, 0xac, 0x33, 0x66, 0x00, 0x0c, 0x14,
+    0x0c, 0x66, 0xff, 0xf3, 0xeb, 0xf3, 0x33, 0x62, 0x00, 0x22, 0x65, 0x25, 0x72, 0x62, 0xff, 0xdd,
+    0x9a, 0xda, 0x8d, 0x33, 0x12, 0x00, 0x20, 0x50, 0x56, 0x50, 0x20, 0x12, 0xff, 0xdf, 0xaf, 0xa9,
+    0xaf, 0xdf, 0x33, 0xc2, 0x00, 0x20, 0xa0, 0xb0, 0xa8, 0xc2, 0xff, 0xdf, 0x5f, 0x4f, 0x57, 0x33,
+    0x06, 0x00, 0x40, 0xa0, 0xe0, 0x80, 0x60, 0x06, 0xff, 0xbf, 0x5f, 0x1f, 0x7f, 0x9f, 0x33, 0x66,
+    0x00, 0x44, 0xa8, 0x48, 0x66, 0xff, 0xbb, 0x57, 0xb7, 0x33, 0x62, 0x00, 0x40, 0x64, 0x4a, 0x24,
+    0x62, 0xff, 0xbf, 0x9b, 0xb5, 0xdb, 0x33, 0x00, 0x00, 0x01, 0x08, 0x09, 0x1a, 0x2b, 0x2a, 0x19,
+    0x00, 0xff, 0xfe, 0xf7, 0xf6, 0xe5, 0xd4, 0xd5, 0xe6, 0x33, 0x00, 0x80, 0x00, 0x04, 0x16, 0xa4,
+    0xb4, 0x14, 0xa2, 0x00, 0x7f, 0xff, 0xfb, 0xe9, 0x5b, 0x4b, 0xeb, 0x5d, 0x33, 0x66, 0x00, 0x49,
+    0x95, 0x88, 0x66, 0xff, 0xb6, 0x6a, 0x77, 0x33, 0x62, 0x00, 0x04, 0x46, 0x44, 0xc2, 0x62, 0xff,
+    0xfb, 0xb9, 0xbb, 0x3d, 0x33, 0x02, 0x00, 0x80, 0x84, 0xca, 0xae, 0xa8, 0xa6, 0x02, 0xff, 0x7f,
+    0x7b, 0x35, 0x51, 0x57, 0x59, 0x33, 0x00, 0x01, 0x02, 0x00, 0x13, 0x2a, 0x3a, 0x22, 0x1a, 0x00,
+    0xfe, 0xfd, 0xff, 0xec, 0xd5, 0xc5, 0xdd, 0xe5, 0x33, 0x06, 0x00, 0x13, 0xaa, 0xba, 0xa2, 0x9a,
+    0x06, 0xff, 0xec, 0x55, 0x45, 0x5d, 0x65, 0x33, 0x66, 0x00, 0xca, 0xaa, 0xa6, 0x66, 0xff, 0x35,
+    0x55, 0x59, 0x33, 0x06, 0x00, 0x11, 0x2a, 0x22, 0x2a, 0x11, 0x06, 0xff, 0xee, 0xd5, 0xdd, 0xd5,
+    0xee, 0x33, 0x02, 0x00, 0x04, 0x96, 0xa4, 0xb4, 0x94, 0xa2, 0x02, 0xff, 0xfb, 0x69, 0x5b, 0x4b,
+    0x6b, 0x5d, 0x33, 0x02, 0x00, 0x80, 0x90, 0xa8, 0xb8, 0xa0, 0x9a, 0x02, 0xff, 0x7f, 0x6f, 0x57,
+    0x47, 0x5f, 0x65, 0x33, 0x42, 0x00, 0x30, 0x2a, 0x32, 0x2a, 0x31, 0x42, 0xff, 0xcf, 0xd5, 0xcd,
+    0xd5, 0xce, 0x33, 0x62, 0x00, 0x24, 0xb6, 0xa4, 0x92, 0x62, 0xff, 0xdb, 0x49, 0x5b, 0x6d, 0x33,
+    0x66, 0x00, 0x4c, 0xaa, 0x4a, 0x66, 0xff, 0xb3, 0x55, 0xb5, 0x33, 0x62, 0x00, 0x10, 0x30, 0x10,
+    0x38, 0x62, 0xff, 0xef, 0xcf, 0xef, 0xc7, 0x33, 0x00, 0x00, 0x01, 0x00, 0x46, 0xaa, 0x8a, 0xaa,
+    0x46, 0x00, 0xff, 0xfe, 0xff, 0xb9, 0x55, 0x75, 0x55, 0xb9, 0x33, 0x04, 0x80, 0x00, 0xc1, 0xa2,
+    0xa3, 0xa1, 0xa2, 0x04, 0x7f, 0xff, 0x3e, 0x5d, 0x5c, 0x5e, 0x5d, 0x33, 0x02, 0x00, 0x04, 0x24,
+    0x55, 0x75, 0x45, 0x34, 0x02, 0xff, 0xfb, 0xdb, 0xaa, 0x8a, 0xba, 0xcb, 0x33, 0x02, 0x00, 0x01,
+    0x89, 0x55, 0xd1, 0x15, 0xc8, 0x02, 0xff, 0xfe, 0x76, 0xaa, 0x2e, 0xea, 0x37, 0x33, 0x66, 0x00,
+    0x86, 0x0a, 0x86, 0x66, 0xff, 0x79, 0xf5, 0x79, 0x33, 0x42, 0x00, 0x04, 0x44, 0x8c, 0x94, 0x8d,
+    0x42, 0xff, 0xfb, 0xbb, 0x73, 0x6b, 0x72, 0x33, 0x42, 0x00, 0x10, 0x11, 0x19, 0x15, 0x18, 0x42,
+    0xff, 0xef, 0xee, 0xe6, 0xea, 0xe7, 0x33, 0x62, 0x00, 0x12, 0x5b, 0x52, 0xc9, 0x62, 0xff, 0xed,
+    0xa4, 0xad, 0x36, 0x33, 0x66, 0x00, 0x26, 0x55, 0x25, 0x66, 0xff, 0xd9, 0xaa, 0xda, 0x33, 0x10,
+    0x40, 0x80, 0x0c, 0x02, 0x04, 0x08, 0x0e, 0x10, 0xbf, 0x7f, 0xf3, 0xfd, 0xfb, 0xf7, 0xf1, 0x33,
+    0xe2, 0x00, 0xa8, 0x28, 0xa8, 0xe2, 0xff, 0x57, 0xd7, 0x57, 0x33, 0x02, 0x00, 0x28, 0x21, 0x6a,
+    0xab, 0xa9, 0x6a, 0x02, 0xff, 0xd7, 0xde, 0x95, 0x54, 0x56, 0x95, 0x33, 0x00, 0x02, 0x04, 0x00,
+    0x23, 0x55, 0x45, 0x55, 0x23, 0x00, 0xfd, 0xfb, 0xff, 0xdc, 0xaa, 0xba, 0xaa, 0xdc, 0x33, 0x42,
+    0x00, 0x02, 0x22, 0x46, 0x4a, 0x46, 0x42, 0xff, 0xfd, 0xdd, 0xb9, 0xb5, 0xb9, 0x33, 0x06, 0x00,
+    0x20, 0x51, 0x71, 0x41, 0x30, 0x06, 0xff, 0xdf, 0xae, 0x8e, 0xbe, 0xcf, 0x33, 0x06, 0x00, 0x8c,
+    0x55, 0x15, 0x55, 0x8d, 0x06, 0xff, 0x73, 0xaa, 0xea, 0xaa, 0x72, 0x33, 0x42, 0x00, 0x08, 0x88,
+    0x18, 0x28, 0x1a, 0x42, 0xff, 0xf7, 0x77, 0xe7, 0xd7, 0xe5, 0xf0, 0x0e, 0xff, 0xfb, 0xff, 0xfb,
+    0xff, 0x0e, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf0, 0x82, 0xff, 0xfd, 0xff, 0xfb, 0xee, 0xff, 0x82,
+    0x00, 0x02, 0x00, 0x04, 0x11, 0x00, 0xf0, 0x32, 0xff, 0xf7, 0xff, 0xd6, 0x9f, 0x32, 0x00, 0x08,
+    0x00, 0x29, 0x60, 0xf0, 0x1e, 0xff, 0xfd, 0xe7, 0x0f, 0x1e, 0x00, 0x02, 0x18, 0xf0, 0xf0, 0xe6,
+    0xff, 0xbe, 0xff, 0xe6, 0x00, 0x41, 0x00, 0x33, 0xf8, 0x01, 0x02, 0x00, 0xf8, 0xfe, 0xfd, 0xff,
+    0xf0, 0x7e, 0xff, 0xfd, 0x7e, 0x00, 0x02, 0xf0, 0x18, 0xff, 0xef, 0xff, 0xf7, 0xfd, 0xfe, 0x18,
+    0x00, 0x10, 0x00, 0x08, 0x02, 0x01, 0xf0, 0x00, 0xf9, 0xff, 0xdb, 0xfb, 0xff, 0xbf, 0xb6, 0x56,
+    0x00, 0x06, 0x00, 0x24, 0x04, 0x00, 0x40, 0x49, 0xa9, 0xf3, 0x7e, 0x00, 0x03, 0x00, 0xef, 0x7a,
+    0xff, 0xb5, 0x26, 0x9d, 0xe0, 0x88, 0x00, 0x10, 0x85, 0x00, 0x4a, 0xd9, 0x62, 0x1f, 0x77, 0xf3,
+    0x3e, 0x00, 0x04, 0x1e, 0x80, 0xb8, 0xae, 0xb9, 0x23, 0x3c, 0x21, 0x00, 0x80, 0x47, 0x51, 0x46,
+    0xdc, 0xc3, 0xde, 0xff, 0xf0, 0x00, 0xff, 0x5f, 0x15, 0xa6, 0x8e, 0x03, 0x50, 0x51, 0x00, 0x00,
+    0xa0, 0xea, 0x59, 0x71, 0xfc, 0xaf, 0xae, 0xf0, 0x00, 0xef, 0x7f, 0xf3, 0xef, 0x7e, 0xab, 0x5b,
+    0x75, 0x00, 0x10, 0x80, 0x0c, 0x10, 0x81, 0x54, 0xa4, 0x8a, 0xf0, 0x7e, 0xff, 0xdf, 0x7e, 0x00,
+    0x20, 0xf0, 0x7e, 0xff, 0xbf, 0x7e, 0x00, 0x40, 0x3f, 0x3e, 0x00, 0x3f, 0x20, 0x7e, 0xff, 0xe0,
+    0x7e, 0x00, 0x1f, 0x3f, 0x3e, 0x00, 0xfc, 0x04, 0x3e, 0xff, 0xfb, 0x0b, 0x7e, 0x00, 0xf0, 0x3c,
+    0x1e, 0xff, 0x8f, 0xd9, 0xda, 0x1e, 0x00, 0x70, 0x26, 0x25, 0x3c, 0x1e, 0xff, 0xdb, 0xae, 0xba,
+    0x1e, 0x00, 0x24, 0x51, 0x45, 0x3c, 0x1e, 0xff, 0xeb, 0x79, 0xab, 0x1e, 0x00, 0x14, 0x86, 0x54,
+    0x3c, 0x3e, 0xff, 0xbf, 0x5f, 0x3e, 0x00, 0x40, 0xa0, 0xf0, 0xf8, 0xff, 0xbf, 0xff, 0xf8, 0x00,
+    0x40, 0x00, 0xf0, 0x08, 0xe7, 0xfe, 0xff, 0xe5, 0xf2, 0xdc, 0xef, 0x08, 0x18, 0x01, 0x00, 0x1a,
+    0x0d, 0x23, 0x10, 0xf0, 0x00, 0xe7, 0xf5, 0xfa, 0x6a, 0x95, 0xf2, 0x24, 0xc4, 0x00, 0x18, 0x0a,
+    0x05, 0x95, 0x6a, 0x0d, 0xdb, 0x3b, 0xf3, 0x70, 0x07, 0x0f, 0x06, 0x00, 0x03, 0xe0, 0xc0, 0x00,
+    0x80, 0x20, 0x00, 0xe0, 0x3f, 0xff, 0x7f, 0xdf, 0xff, 0x43, 0x98, 0xbe, 0x9a, 0x82, 0xdf, 0xff,
+    0x43, 0x3e, 0x00, 0xf0, 0xfc, 0xf0, 0x00, 0x90, 0x12, 0xa7, 0x60, 0x0b, 0x29, 0x00, 0x10, 0x00,
+    0x6f, 0xed, 0x58, 0x9f, 0xf4, 0xd6, 0xff, 0xef, 0xf0, 0x00, 0xde, 0xdf, 0x76, 0x7d, 0x2f, 0x34,
+    0xdf, 0x5b, 0x00, 0x21, 0x20, 0x89, 0x82, 0xd0, 0xcb, 0x20, 0xa4, 0xf0, 0x4c, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0x4c, 0x20, 0x00, 0x20, 0x00, 0x20, 0x3f, 0xfe, 0x2f, 0xfe, 0xe0, 0xfe, 0x10, 0x0f,
+    0xfe, 0xf4, 0xfe, 0x0b, 0x3c, 0x12, 0xda, 0x8a, 0xff, 0xcf, 0xbc, 0xba, 0x12, 0x25, 0x75, 0x00,
+    0x30, 0x43, 0x45, 0x3c, 0x34, 0x9a, 0xba, 0xff, 0x87, 0xaa, 0x34, 0x65, 0x45, 0x00, 0x78, 0x55,
+    0x3c, 0x32, 0xab, 0xad, 0xff, 0x7f, 0xbf, 0x32, 0x54, 0x52, 0x00, 0x80, 0x40, 0x3c, 0xf0, 0x1f,
+    0x7f, 0x9f, 0xff, 0xf0, 0xe0, 0x80, 0x60, 0x00, 0x33, 0x62, 0x00, 0x41, 0xa4, 0xa9, 0x49, 0x62,
+    0xff, 0xbe, 0x5b, 0x56, 0xb6, 0x33, 0x62, 0x00, 0x04, 0x31, 0x55, 0x35, 0x62, 0xff, 0xfb, 0xce,
+    0xaa, 0xca, 0x33, 0x62, 0x00, 0x01, 0x8d, 0x55, 0x4d, 0x62, 0xff, 0xfe, 0x72, 0xaa, 0xb2, 0x33,
+    0x66, 0x00, 0x0c, 0x15, 0x0c, 0x66, 0xff, 0xf3, 0xea, 0xf3, 0x33, 0x66, 0x00, 0xde, 0x55, 0xd5,
+    0x66, 0xff, 0x21, 0xaa, 0x2a, 0x33, 0x02, 0x00, 0x01, 0x21, 0x51, 0x71, 0x41, 0x31, 0x02, 0xff,
+    0xfe, 0xde, 0xae, 0x8e, 0xbe, 0xce, 0x33, 0x46, 0x00, 0x14, 0x94, 0x54, 0x8c, 0x46, 0xff, 0xeb,
+    0x6b, 0xab, 0x73, 0xf0, 0x00, 0xf7, 0xff, 0xef, 0xf7, 0xf6, 0xff, 0xef, 0xff, 0x00, 0x08, 0x00,
+    0x10, 0x08, 0x09, 0x00, 0x10, 0x00, 0xf0, 0x00, 0xfc, 0x3f, 0xeb, 0xf7, 0xa7, 0xf6, 0xa8, 0xf5,
+    0x00, 0x03, 0xc0, 0x14, 0x08, 0x58, 0x09, 0x57, 0x0a, 0xf0, 0x80, 0x20, 0xe4, 0x80, 0xc0, 0xc8,
+    0x30, 0x80, 0x80, 0xdf, 0x1b, 0x7f, 0x3f, 0x37, 0xcf, 0x7f, 0xf3, 0x40, 0x07, 0x0f, 0x11, 0x3c,
+    0x38, 0x78, 0xf8, 0x82, 0x00, 0x8e, 0x03, 0x07, 0x87, 0x07, 0x82, 0xff, 0x71, 0xf8, 0xf0, 0x70,
+    0xf0, 0xf3, 0xc2, 0xff, 0xeb, 0x1c, 0xfc, 0x78, 0xc2, 0x00, 0x14, 0xe3, 0x03, 0x87, 0xd2, 0xff,
+    0xeb, 0x08, 0x00, 0xf3, 0xc0, 0xfe, 0xff, 0xc7, 0x1f, 0xff, 0x7f, 0xc2, 0x00, 0x38, 0xe0, 0x00,
+    0x80, 0xd2, 0xff, 0xc7, 0x0f, 0x07, 0xf3, 0x52, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0x00, 0x04, 0x01,
+    0x00, 0x07, 0x09, 0x00, 0x04, 0x01, 0x00, 0xfb, 0xfe, 0xff, 0xf8, 0xf6, 0xff, 0xfb, 0xfe, 0xf0,
+    0x02, 0x3f, 0x4f, 0x3f, 0x5f, 0x0d, 0x0b, 0x0c, 0x02, 0xc0, 0xb0, 0xc0, 0xa0, 0xf2, 0xf4, 0xf3,
+    0xf0, 0x3c, 0xdf, 0xff, 0xbf, 0xff, 0x3c, 0x20, 0x00, 0x40, 0x00, 0x0f, 0xf8, 0x20, 0x3f, 0x00,
+    0xf8, 0xff, 0xc0, 0xff, 0x0f, 0xf8, 0x04, 0xfc, 0x00, 0xf8, 0xfb, 0x03, 0xff, 0x3c, 0xf2, 0xaa,
+    0xcc, 0xff, 0xf2, 0x55, 0x33, 0x00, 0x3c, 0xf2, 0xaa, 0xab, 0xff, 0xf2, 0x55, 0x54, 0x00, 0x3c,
+    0xf0, 0x3f, 0xff, 0x3f, 0xff, 0xf0, 0xc0, 0x00, 0xc0, 0x00, 0xfc, 0xc2, 0x00, 0x8a, 0xd8, 0xaa,
+    0x8a, 0xc2, 0xff, 0x75, 0x27, 0x55, 0x75, 0xc2, 0x00, 0x8a, 0xd8, 0xaa, 0x8a, 0xff, 0xf8, 0x10,
+    0x20, 0x00, 0x26, 0x00, 0x48, 0x95, 0x94, 0x89, 0x20, 0xef, 0xdf, 0xff, 0xb7, 0x6a, 0x6b, 0x76,
+    0x26, 0x00, 0x48, 0x95, 0x94, 0x89, 0xfc, 0x42, 0x00, 0x20, 0xa6, 0x2a, 0xaa, 0x26, 0x42, 0xff,
+    0xdf, 0x59, 0xd5, 0x55, 0xd9, 0x42, 0x00, 0x20, 0xa6, 0x2a, 0xaa, 0x26, 0xff, 0xf8, 0x04, 0x08,
+    0x00, 0x62, 0x00, 0x02, 0xa3, 0xa2, 0x42, 0x60, 0xfb, 0xf7, 0xfd, 0x5c, 0x5d, 0xbd, 0x62, 0x00,
+    0x02, 0xa3, 0xa2, 0x42, 0xfc, 0x02, 0x00, 0x40, 0x49, 0xd5, 0x5d, 0x51, 0x4d, 0x02, 0xff, 0xbf,
+    0xb6, 0x2a, 0xa2, 0xae, 0xb2, 0x02, 0x00, 0x40, 0x49, 0xd5, 0x5d, 0x51, 0x4d, 0xfc, 0x06, 0x00,
+    0xe2, 0x55, 0x57, 0x54, 0x53, 0x06, 0xff, 0x1d, 0xaa, 0xa8, 0xab, 0xac, 0x06, 0x00, 0xe2, 0x55,
+    0x57, 0x54, 0x53, 0xff, 0xf8, 0x04, 0x08, 0x00, 0x06, 0x00, 0x22, 0x55, 0x47, 0x54, 0x23, 0x00,
+    0xfb, 0xf7, 0xff, 0xdd, 0xaa, 0xb8, 0xab, 0xdc, 0x06, 0x00, 0x22, 0x55, 0x47, 0x54, 0x23, 0xfc,
+    0x8a, 0x00, 0x40, 0x50, 0x60, 0x50, 0x8a, 0xff, 0xbf, 0xaf, 0x9f, 0xaf, 0x8a, 0x00, 0x40, 0x50,
+    0x60, 0x50, 0xf0, 0x20, 0xfd, 0xfb, 0xff, 0xbe, 0xff, 0xfd, 0xff, 0x20, 0x02, 0x04, 0x00, 0x41,
+    0x00, 0x02, 0x00, 0xf0, 0x00, 0xe8, 0xf7, 0xdd, 0xfd, 0xfe, 0xf6, 0xd4, 0xfa, 0x00, 0x17, 0x08,
+    0x22, 0x02, 0x01, 0x09, 0x2b, 0x05, 0xf0, 0x00, 0xa4, 0x20, 0x00, 0x80, 0x68, 0xd0, 0x68, 0x20,
+    0x00, 0x5b, 0xdf, 0xff, 0x7f, 0x97, 0x2f, 0x97, 0xdf, 0xf3, 0xfa, 0xfc, 0xff, 0xfa, 0x03, 0x00,
+    0x8c, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xf3, 0xf8, 0x7c, 0xfc, 0xff, 0xf8, 0x83, 0x03, 0x00, 0x8c,
+    0x00, 0x08, 0x1c, 0x3e, 0xff, 0xf3, 0xfc, 0x7f, 0xff, 0xfc, 0x80, 0x00, 0x8c, 0x07, 0x0f, 0x1f,
+    0x3f, 0xff, 0xf3, 0xfe, 0xf0, 0x72, 0x00, 0x01, 0x00, 0x02, 0x72, 0xff, 0xfe, 0xff, 0xfd, 0xf0,
+    0x00, 0x9b, 0xd3, 0x0a, 0x3d, 0x8b, 0x03, 0x37, 0x9b, 0x00, 0x64, 0x2c, 0xf5, 0xc2, 0x74, 0xfc,
+    0xc8, 0x64, 0xf0, 0x7c, 0xf7, 0xff, 0xef, 0x7c, 0x08, 0x00, 0x10, 0xf0, 0x00, 0xf6, 0xf7, 0xfe,
+    0xff, 0xec, 0xff, 0xfa, 0xde, 0x00, 0x09, 0x08, 0x01, 0x00, 0x13, 0x00, 0x05, 0x21, 0xf0, 0x00,
+    0x82, 0xa1, 0x06, 0x91, 0xa7, 0xd0, 0x92, 0x4a, 0x00, 0x7d, 0x5e, 0xf9, 0x6e, 0x58, 0x2f, 0x6d,
+    0xb5, 0xf3, 0x0a, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x9e, 0x00, 0x80, 0x00, 0x90, 0xff, 0xfe,
+    0xfd, 0xff, 0x7f, 0xff, 0xcd, 0xc6, 0x00, 0x7e, 0x3c, 0x00, 0x80, 0x7e, 0xff, 0x00, 0x7e, 0xbd,
+    0xc3, 0xff, 0xc3, 0x3e, 0xff, 0xfe, 0xfc, 0xe4, 0xff, 0x7f, 0xbf, 0xff, 0xf3, 0xca, 0xe0, 0xc0,
+    0x80, 0x00, 0x44, 0x01, 0x00, 0x0a, 0x40, 0x00, 0x14, 0x44, 0xfe, 0xff, 0xf5, 0xbf, 0xff, 0xeb,
+    0xf0, 0x20, 0x07, 0x36, 0x2d, 0x7f, 0x0f, 0x15, 0x77, 0x20, 0xf8, 0xc9, 0xd2, 0x80, 0xf0, 0xea,
+    0x88, 0xf0, 0xf8, 0xff, 0x7f, 0xff, 0xf8, 0x00, 0x80, 0x00, 0x33, 0x02, 0x00, 0x60, 0x84, 0xea,
+    0x2e, 0x28, 0xc6, 0x02, 0xff, 0x9f, 0x7b, 0x15, 0xd1, 0xd7, 0x39, 0x33, 0x66, 0x00, 0x66, 0xaa,
+    0x66, 0x66, 0xff, 0x99, 0x55, 0x99, 0x33, 0xc2, 0x00, 0x22, 0x36, 0x2a, 0x22, 0xc2, 0xff, 0xdd,
+    0xc9, 0xd5, 0xdd, 0x33, 0x02, 0x00, 0x01, 0x65, 0xa9, 0xad, 0xa5, 0x68, 0x02, 0xff, 0xfe, 0x9a,
+    0x56, 0x52, 0x5a, 0x97, 0x33, 0x06, 0x00, 0x91, 0x2a, 0x3a, 0x22, 0x9a, 0x06, 0xff, 0x6e, 0xd5,
+    0xc5, 0xdd, 0x65, 0x33, 0x42, 0x00, 0x0c, 0x11, 0x1d, 0x05, 0x18, 0x42, 0xff, 0xf3, 0xee, 0xe2,
+    0xfa, 0xe7, 0x33, 0x02, 0x00, 0x02, 0x4b, 0x52, 0x5a, 0x4a, 0xd1, 0x02, 0xff, 0xfd, 0xb4, 0xad,
+    0xa5, 0xb5, 0x2e, 0x33, 0x66, 0x00, 0x85, 0x45, 0x42, 0x66, 0xff, 0x7a, 0xba, 0xbd, 0x33, 0x02,
+    0x00, 0x10, 0x42, 0x95, 0xd5, 0x55, 0x92, 0x02, 0xff, 0xef, 0xbd, 0x6a, 0x2a, 0xaa, 0x6d, 0x33,
+    0xe2, 0x00, 0x01, 0x61, 0x51, 0xe2, 0xff, 0xfe, 0x9e, 0xae, 0xf0, 0x3c, 0xfd, 0xff, 0xfe, 0xff,
+    0x3c, 0x02, 0x00, 0x01, 0x00, 0xf0, 0xe0, 0xff, 0xde, 0xef, 0xbf, 0xff, 0xe0, 0x00, 0x21, 0x10,
+    0x40, 0x00, 0xf0, 0x10, 0xe4, 0xf3, 0xdc, 0xbc, 0xb9, 0xb4, 0xff, 0x10, 0x1b, 0x0c, 0x23, 0x43,
+    0x46, 0x4b, 0x00, 0xf0, 0x00, 0x00, 0x80, 0x84, 0x11, 0x8e, 0xc2, 0x13, 0x40, 0x00, 0xff, 0x7f,
+    0x7b, 0xee, 0x71, 0x3d, 0xec, 0xbf, 0xf3, 0xf8, 0xff, 0x1f, 0x00, 0x46, 0x00, 0x01, 0x00, 0x10,
+    0x70, 0x46, 0xff, 0xfe, 0xff, 0xef, 0x8f, 0xf3, 0xfc, 0xf0, 0x00, 0x26, 0x00, 0x20, 0x00, 0x10,
+    0x0a, 0x26, 0xff, 0xdf, 0xff, 0xef, 0xf5, 0xf0, 0x00, 0x00, 0x02, 0x03, 0x12, 0x83, 0x06, 0x09,
+    0x8b, 0x00, 0xff, 0xfd, 0xfc, 0xed, 0x7c, 0xf9, 0xf6, 0x74, 0xf0, 0x80, 0xc7, 0x56, 0x7b, 0xbd,
+    0x5f, 0xdf, 0x7f, 0x80, 0x38, 0xa9, 0x84, 0x42, 0xa0, 0x20, 0x80, 0xf0, 0xe4, 0xdf, 0xff, 0xbf,
+    0xff, 0xe4, 0x20, 0x00, 0x40, 0x00, 0x0f, 0xfc, 0xff, 0x80, 0xfc, 0x00, 0x7f, 0x3f, 0xfc, 0xff,
+    0x00, 0x1c, 0x00, 0xff, 0x97, 0x73, 0x16, 0x1e, 0x00, 0x68, 0x8c, 0xe9, 0x3f, 0xfc, 0xff, 0x00,
+    0x1c, 0x00, 0xff, 0xfd, 0x34, 0xad, 0x1e, 0x00, 0x02, 0xcb, 0x52, 0x3f, 0xfc, 0xfe, 0x02, 0xfc,
+    0x00, 0xfe, 0xfe, 0x01, 0xfc, 0x22, 0x00, 0xe0, 0x24, 0x2a, 0xaa, 0x44, 0x22, 0xff, 0x1f, 0xdb,
+    0xd5, 0x55, 0xbb, 0x22, 0x00, 0xe0, 0x24, 0x2a, 0xaa, 0x44, 0xff, 0xf8, 0x20, 0x40, 0x00, 0x66,
+    0x00, 0xcc, 0xaa, 0xcc, 0x60, 0xdf, 0xbf, 0xff, 0x33, 0x55, 0x33, 0x66, 0x00, 0xcc, 0xaa, 0xcc,
+    0xfc, 0x42, 0x00, 0x0e, 0xa8, 0xac, 0xa8, 0x68, 0x42, 0xff, 0xf1, 0x57, 0x53, 0x57, 0x97, 0x42,
+    0x00, 0x0e, 0xa8, 0xac, 0xa8, 0x68, 0xfc, 0x66, 0x00, 0xa4, 0xa9, 0x69, 0x66, 0xff, 0x5b, 0x56,
+    0x96, 0x66, 0x00, 0xa4, 0xa9, 0x69, 0xfc, 0xe6, 0x00, 0x80, 0x00, 0xe6, 0xff, 0x7f, 0xff, 0xe6,
+    0x00, 0x80, 0x00, 0x33, 0xf8, 0x40, 0x80, 0x00, 0xf8, 0xbf, 0x7f, 0xff, 0xf0, 0xce, 0xff, 0xfe,
+    0xff, 0xce, 0x00, 0x01, 0x00, 0xf0, 0x00, 0xf7, 0xfb, 0xf7, 0xfe, 0xf9, 0xfb, 0xff, 0xef, 0x00,
+    0x08, 0x04, 0x08, 0x01, 0x06, 0x04, 0x00, 0x10, 0xf0, 0x00, 0xf6, 0xfd, 0x8f, 0xf7, 0x7b, 0xcf,
+    0xbf, 0xfd, 0x00, 0x09, 0x02, 0x70, 0x08, 0x84, 0x30, 0x40, 0x02, 0xf0, 0x40, 0xa1, 0x83, 0x59,
+    0x3e, 0xa3, 0xff, 0xbf, 0x40, 0x5e, 0x7c, 0xa6, 0xc1, 0x5c, 0x00, 0x40, 0xf0, 0x00, 0x00, 0x07,
+    0x75, 0x2f, 0x33, 0xae, 0xbf, 0x3f, 0x00, 0xff, 0xf8, 0x8a, 0xd0, 0xcc, 0x51, 0x40, 0xc0, 0xf0,
+    0x00, 0x35, 0x3b, 0xf9, 0xd7, 0xfe, 0xbf, 0xff, 0xf7, 0x00, 0xca, 0xc4, 0x06, 0x28, 0x01, 0x40,
+    0x00, 0x08, 0xf0, 0x9c, 0x3f, 0xff, 0xf7, 0xff, 0x9c, 0xc0, 0x00, 0x08, 0x00, 0xf0, 0xf2, 0xff,
+    0xbf, 0xff, 0xf2, 0x00, 0x40, 0x00, 0x3f, 0x3e, 0x80, 0xff, 0x00, 0x7e, 0x7f, 0x00, 0x7e, 0x00,
+    0xff, 0x3f, 0x3e, 0x00, 0xff, 0x00, 0x7e, 0xff, 0x00, 0x7e, 0x00, 0xff, 0x3f, 0x3e, 0x00, 0xff,
+    0x00, 0x72, 0xd6, 0x3b, 0xff, 0x00, 0x72, 0x29, 0xc4, 0x00, 0xff, 0x3f, 0x3e, 0x00, 0xff, 0x00,
+    0x72, 0xad, 0x2e, 0xff, 0x00, 0x72, 0x52, 0xd1, 0x00, 0xff, 0x3f, 0x3e, 0x02, 0xfe, 0x00, 0x7e,
+    0xfe, 0x00, 0x7e, 0x01, 0xff, 0x3f, 0x1e, 0xa0, 0xbf, 0x80, 0xff, 0x1e, 0x60, 0x40, 0x7f, 0xff,
+    0xde, 0x1f, 0x00, 0x3f, 0x1e, 0x00, 0xff, 0x00, 0xff, 0xbe, 0x00, 0xff, 0xde, 0xff, 0x00, 0xff,
+    0x1e, 0x00, 0xff, 0x00, 0xff, 0xba, 0x88, 0x00, 0xff, 0xda, 0x77, 0xff, 0x00, 0xfa, 0x88, 0x00,
+    0xff, 0x1e, 0x00, 0xff, 0x00, 0xff, 0xb8, 0x20, 0x40, 0x00, 0xff, 0xd8, 0xdf, 0xbf, 0xff, 0x00,
+    0xf8, 0x20, 0x40, 0x00, 0xff, 0x1e, 0x00, 0xff, 0x00, 0xff, 0xbe, 0x00, 0xff, 0xd0, 0xde, 0xff,
+    0x7f, 0xff, 0x00, 0xf0, 0x21, 0x00, 0x80, 0x00, 0xff, 0x1e, 0x00, 0xff, 0x00, 0xff, 0xbe, 0x00,
+    0xff, 0xd0, 0xed, 0xfe, 0xef, 0xff, 0x00, 0xf0, 0x12, 0x01, 0x10, 0x00, 0xff, 0x1e, 0x00, 0xff,
+    0x00, 0xff, 0xbe, 0x00, 0xff, 0xc0, 0x7f, 0xf7, 0xff, 0xf5, 0xff, 0x00, 0xe0, 0x80, 0x08, 0x00,
+    0x0a, 0x00, 0x0f, 0x3e, 0x80, 0x00, 0xff, 0xbe, 0x7f, 0xff, 0x07, 0x7e, 0x00, 0xff, 0x07, 0x7e,
+    0x01, 0xff,
+};
+
+const uint32_t widgets_patterns [] = {
+    0x0003fc04, 0x0004f80b, 0x0008f017, 0x0008f017, 0x0008f017, 0x0008f017, 0x0000fc0b, 0x0000fb04,
+    0x00c03f20, 0x00200fd0, 0x000017e8, 0x000017e8, 0x000017e8, 0x000017e8, 0x00002fd0, 0x0000df20,
+    0x0003fc04, 0x0004f80b, 0x0009f016, 0x000bf014, 0x000bf014, 0x0009f016, 0x0000fc0b, 0x0000fb04,
+    0x00c03f20, 0x00200fd0, 0x00801768, 0x00c01728, 0x00c01728, 0x00801768, 0x00002fd0, 0x0000df20,
+    0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0010e02f,
+    0x00000bf4, 0x00000bf4, 0x00000bf4, 0x00000bf4, 0x00000bf4, 0x00000bf4, 0x00000bf4, 0x00000bf4,
+    0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0010e02f, 0x0015e02a, 0x0017e028, 0x0012e02d, 0x0010e02f,
+    0x00000bf4, 0x00200bd4, 0x00600b94, 0x00c00b34, 0x00800b74, 0x00000bf4, 0x00000bf4, 0x00000bf4,
+};
@@ -0,0 +1,14 @@
+/*
+ * VDP Pattern data, bank 2
+ */
+
+#define CURSOR_PATTERNS_BANK 2
+extern const uint32_t cursor_patterns [96];
+
+#define TITLE_PATTERNS_COMPRESSED_BANK 2
+extern const uint8_t title_patterns_compressed [5362];
+
+#define WIDGETS_PATTERNS_BANK 2
+extern const uint32_t widgets_patterns [64];
+
+#define BANK_2_BYTES 6002
@@ -0,0 +1,11 @@
+/*
+ * VDP Palette data
+ */
+
+#ifdef TARGET_SMS
+static const uint8_t background_palette [16] = { 0x00, 0x3f, 0x2a, 0x15, 0x00, 0x38, 0x0b, 0x03, 0x08, 0x06, 0x3a, 0x02 };
+static const uint8_t sprite_palette [16] = { 0x00, 0x3f, 0x00, 0x02 };
+#elif defined (TARGET_GG)
+static const uint16_t background_palette [16] = { 0x0000, 0x0fff, 0x0aaa, 0x0555, 0x0000, 0x0fa0, 0x00af, 0x000f, 0x00a0, 0x005a, 0x0faa, 0x000a };
+static const uint16_t sprite_palette [16] = { 0x0000, 0x0fff, 0x0000, 0x000a };
+#endif
@@ -0,0 +1,58 @@
+/*
+ * VDP Pattern index data
+ */
+
+const uint16_t cursor_panels [3] [4] = {
+    { 0x0000, 0x0001, 0x0002, 0x0003 },
+    { 0x0004, 0x0005, 0x0006, 0x0007 },
+    { 0x0008, 0x0009, 0x000a, 0x000b }
+};
+
+const uint8_t title_indices_compressed [609] = {
+    0x87, 0x00, 0x00, 0x47, 0x01, 0x00, 0x82, 0x07, 0x00, 0x45, 0x01, 0x00, 0x85, 0x09, 0x00, 0x45,
+    0x0d, 0x00, 0x8a, 0x0e, 0x00, 0x45, 0x17, 0x00, 0x86, 0x18, 0x00, 0x01, 0x17, 0x00, 0x85, 0x1e,
+    0x00, 0x45, 0x22, 0x00, 0x8a, 0x23, 0x00, 0x44, 0x17, 0x00, 0x87, 0x2d, 0x00, 0x44, 0x17, 0x00,
+    0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x01, 0x23, 0x00, 0x89, 0x34, 0x00, 0x4f, 0x17, 0x00, 0x01,
+    0x21, 0x00, 0x82, 0x3d, 0x00, 0x44, 0x22, 0x00, 0x01, 0x23, 0x00, 0x89, 0x3f, 0x00, 0x01, 0x17,
+    0x00, 0x8d, 0x48, 0x00, 0x02, 0x17, 0x00, 0x21, 0x00, 0x85, 0x55, 0x00, 0x82, 0x22, 0x00, 0x95,
+    0x5a, 0x00, 0x43, 0x17, 0x00, 0x01, 0x21, 0x00, 0x82, 0x6f, 0x00, 0x44, 0x22, 0x00, 0x01, 0x23,
+    0x00, 0x88, 0x71, 0x00, 0x01, 0x17, 0x00, 0x82, 0x79, 0x00, 0x01, 0x52, 0x00, 0x89, 0x7b, 0x00,
+    0x43, 0x17, 0x00, 0x01, 0x21, 0x00, 0x84, 0x84, 0x00, 0x42, 0x22, 0x00, 0x02, 0x23, 0x00, 0x0f,
+    0x00, 0x87, 0x88, 0x00, 0x01, 0x17, 0x00, 0x8e, 0x8f, 0x00, 0x02, 0x17, 0x00, 0x21, 0x00, 0x82,
+    0x6f, 0x00, 0x44, 0x22, 0x00, 0x03, 0x23, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x84, 0x9d, 0x00, 0x49,
+    0x17, 0x00, 0x01, 0xa1, 0x00, 0x48, 0x17, 0x00, 0x01, 0x21, 0x00, 0x82, 0x84, 0x00, 0x84, 0xa2,
+    0x00, 0x03, 0x23, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x83, 0xa6, 0x00, 0x01, 0x8f, 0x00, 0x87, 0xa9,
+    0x00, 0x01, 0x7b, 0x00, 0x88, 0xb0, 0x00, 0x42, 0x17, 0x00, 0x01, 0x21, 0x00, 0x82, 0x6f, 0x00,
+    0x42, 0x22, 0x00, 0x01, 0xb8, 0x00, 0x82, 0x22, 0x00, 0x02, 0x0f, 0x00, 0x63, 0x00, 0x84, 0xb9,
+    0x00, 0x01, 0x69, 0x00, 0x82, 0xbd, 0x00, 0x01, 0x8f, 0x00, 0x8d, 0xbf, 0x00, 0x02, 0x17, 0x00,
+    0x21, 0x00, 0x82, 0x84, 0x00, 0x83, 0xcc, 0x00, 0x82, 0x22, 0x00, 0x02, 0x0f, 0x00, 0x8f, 0x00,
+    0x87, 0xcf, 0x00, 0x02, 0x9c, 0x00, 0xd6, 0x00, 0x43, 0x17, 0x00, 0x82, 0xd7, 0x00, 0x48, 0x17,
+    0x00, 0x01, 0x21, 0x00, 0x82, 0xd9, 0x00, 0x44, 0x22, 0x00, 0x02, 0x23, 0x00, 0x0f, 0x00, 0x47,
+    0x17, 0x00, 0x01, 0xdb, 0x00, 0x4f, 0x17, 0x00, 0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x03, 0x23,
+    0x00, 0x0f, 0x00, 0x17, 0x00, 0x85, 0xdc, 0x00, 0x01, 0x8f, 0x00, 0x82, 0xe1, 0x00, 0x01, 0x4a,
+    0x00, 0x87, 0xe3, 0x00, 0x06, 0xbd, 0x00, 0xea, 0x00, 0x63, 0x00, 0xb9, 0x00, 0xeb, 0x00, 0x17,
+    0x00, 0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x02, 0x23, 0x00, 0x0f, 0x00, 0x96, 0xec, 0x00, 0x01,
+    0x17, 0x00, 0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x03, 0x23, 0x00, 0x0f, 0x00, 0x63, 0x00, 0x85,
+    0x02, 0x01, 0x01, 0x69, 0x00, 0x84, 0x07, 0x01, 0x01, 0x7b, 0x00, 0x83, 0x0b, 0x01, 0x01, 0x17,
+    0x00, 0x85, 0x0e, 0x01, 0x42, 0x17, 0x00, 0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x04, 0x23, 0x00,
+    0x0f, 0x00, 0x17, 0x00, 0x13, 0x01, 0x4c, 0x17, 0x00, 0x89, 0x14, 0x01, 0x01, 0x21, 0x00, 0x86,
+    0x1d, 0x01, 0x02, 0x23, 0x00, 0x0f, 0x00, 0x4e, 0x17, 0x00, 0x89, 0x23, 0x01, 0x01, 0x21, 0x00,
+    0x86, 0x2c, 0x01, 0x02, 0x23, 0x00, 0x0f, 0x00, 0x87, 0x32, 0x01, 0x47, 0x17, 0x00, 0x89, 0x39,
+    0x01, 0x01, 0x21, 0x00, 0x85, 0x42, 0x01, 0x82, 0x22, 0x00, 0x01, 0x0f, 0x00, 0x88, 0x47, 0x01,
+    0x46, 0x17, 0x00, 0x89, 0x4f, 0x01, 0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x02, 0x23, 0x00, 0x0f,
+    0x00, 0x4f, 0x17, 0x00, 0x88, 0x58, 0x01, 0x82, 0x21, 0x00, 0x45, 0x22, 0x00, 0x02, 0x23, 0x00,
+    0x0f, 0x00, 0x87, 0x60, 0x01, 0x03, 0x65, 0x00, 0x67, 0x01, 0x68, 0x00, 0x82, 0x68, 0x01, 0x02,
+    0x38, 0x01, 0x17, 0x00, 0x89, 0x6a, 0x01, 0x03, 0x21, 0x00, 0x73, 0x01, 0x0d, 0x00, 0x82, 0x74,
+    0x01, 0x04, 0x0d, 0x00, 0x76, 0x01, 0x23, 0x00, 0x0f, 0x00, 0x85, 0x77, 0x01, 0x02, 0x17, 0x00,
+    0x7c, 0x01, 0x45, 0x17, 0x00, 0x01, 0xd6, 0x00, 0x42, 0x17, 0x00, 0x88, 0x7d, 0x01, 0x01, 0x21,
+    0x00, 0x84, 0x85, 0x01, 0x03, 0x86, 0x01, 0x89, 0x01, 0x23, 0x00, 0x84, 0x8a, 0x01, 0x4e, 0x8b,
+    0x01, 0x83, 0x8e, 0x01, 0x43, 0x8b, 0x01, 0x82, 0x91, 0x01, 0x45, 0x92, 0x01, 0x01, 0x93, 0x01,
+    0x00,
+};
+
+const uint16_t widgets_panels [4] [2] = {
+    { 0x0000, 0x0001 },
+    { 0x0002, 0x0003 },
+    { 0x0004, 0x0005 },
+    { 0x0006, 0x0007 }
+};
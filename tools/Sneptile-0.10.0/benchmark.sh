@@ -0,0 +1,15 @@
+#!/bin/sh
+#
+# Report the --compress ratio for each sheet in a directory of .png files.
+# Usage: ./benchmark.sh [tiles directory]
+#
+
+tiles="${1:-../../tiles}"
+output_dir=$(mktemp -d)
+
+for sheet in "${tiles}"/*.png
+do
+    ./Sneptile --output-dir "${output_dir}" --compress --background "${sheet}" || echo "$(basename ${sheet}): failed"
+done
+
+rm -rf "${output_dir}"
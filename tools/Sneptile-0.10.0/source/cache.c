@@ -0,0 +1,268 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ *
+ * Cache of converted sheets (--cache-dir).
+ *
+ * A sheet's key is a hash of its .png file contents, its name, and the
+ * settings that affect its conversion. Each entry records the palettes
+ * that the sheet was converted with and the palettes it left behind, along
+ * with everything it wrote to the output files. An entry is only used if
+ * the palettes match when the sheet is reached, so that colours added by
+ * earlier sheets still give the same palette indices.
+ *
+ * Entries are stored as <key>.cache, in the host's byte order:
+ *   "SNEPTILE-CACHE-1", key (8 bytes), palettes in, palettes out,
+ *   section count (4 bytes), then for each section:
+ *     kind (1 byte), name length (4 bytes), name, data size (4 bytes), data
+ */
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sneptile.h"
+#include "sms_vdp.h"
+#include "output.h"
+#include "cache.h"
+
+#define CACHE_MAGIC "SNEPTILE-CACHE-1"
+
+/* Entries from a different build of Sneptile may not match its output */
+static const char cache_build [] = __DATE__ " " __TIME__;
+
+
+/*
+ * Continue a 64-bit hash (FNV-1a).
+ */
+static uint64_t cache_hash (uint64_t hash, const void *data, uint32_t size)
+{
+    const uint8_t *bytes = data;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        hash ^= bytes [i];
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
+
+/*
+ * Hash everything in a sheet's key that comes before the .png file contents.
+ */
+static uint64_t cache_key_start (uint32_t png_size, const char *name, const uint32_t *settings, uint32_t settings_count)
+{
+    uint64_t key = 0xcbf29ce484222325;
+
+    key = cache_hash (key, CACHE_MAGIC, sizeof (CACHE_MAGIC));
+    key = cache_hash (key, cache_build, sizeof (cache_build));
+    key = cache_hash (key, name, strlen (name) + 1);
+    key = cache_hash (key, settings, settings_count * sizeof (uint32_t));
+    key = cache_hash (key, &png_size, sizeof (png_size));
+
+    return key;
+}
+
+
+/*
+ * Calculate the cache key for a sheet.
+ */
+uint64_t cache_key (const uint8_t *png, uint32_t png_size, const char *name, const uint32_t *settings, uint32_t settings_count)
+{
+    uint64_t key = cache_key_start (png_size, name, settings, settings_count);
+
+    return cache_hash (key, png, png_size);
+}
+
+
+/*
+ * Calculate the cache key for a sheet, reading the .png file a piece at a time.
+ * Gives the same key as cache_key for the same file contents.
+ */
+int cache_key_file (const char *path, const char *name, const uint32_t *settings, uint32_t settings_count, uint64_t *key)
+{
+    FILE *png_file = fopen (path, "rb");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    fseek (png_file, 0, SEEK_END);
+    uint32_t png_size = ftell (png_file);
+    rewind (png_file);
+
+    *key = cache_key_start (png_size, name, settings, settings_count);
+
+    uint8_t data [4096];
+    uint32_t bytes_read = 0;
+    while (bytes_read < png_size)
+    {
+        uint32_t remaining = png_size - bytes_read;
+        size_t bytes = fread (data, 1, (remaining < sizeof (data)) ? remaining : sizeof (data), png_file);
+        if (bytes == 0)
+        {
+            fprintf (stderr, "Error: Failed to read %s.\n", name);
+            fclose (png_file);
+            return RC_ERROR;
+        }
+        *key = cache_hash (*key, data, bytes);
+        bytes_read += bytes;
+    }
+    fclose (png_file);
+
+    return RC_OK;
+}
+
+
+/*
+ * Get the path of a cache entry.
+ */
+static char *cache_path (const char *cache_dir, uint64_t key)
+{
+    char *path = NULL;
+    asprintf (&path, "%s/%016llx.cache", cache_dir, (unsigned long long) key);
+    return path;
+}
+
+
+/*
+ * Load a cached sheet.
+ * Returns RC_ERROR if there is no usable entry.
+ */
+int cache_load (const char *cache_dir, uint64_t key, cache_entry_t *entry)
+{
+    char *path = cache_path (cache_dir, key);
+    FILE *file = fopen (path, "rb");
+    free (path);
+
+    memset (entry, 0, sizeof (cache_entry_t));
+    if (file == NULL)
+    {
+        return RC_ERROR;
+    }
+
+    char magic [sizeof (CACHE_MAGIC)] = { };
+    uint64_t stored_key = 0;
+    uint32_t count = 0;
+    bool valid = fread (magic, 1, sizeof (magic), file) == sizeof (magic) &&
+                 memcmp (magic, CACHE_MAGIC, sizeof (magic)) == 0 &&
+                 fread (&stored_key, sizeof (stored_key), 1, file) == 1 && stored_key == key &&
+                 fread (&entry->palettes_in, sizeof (mode4_palettes_t), 1, file) == 1 &&
+                 fread (&entry->palettes_out, sizeof (mode4_palettes_t), 1, file) == 1 &&
+                 fread (&count, sizeof (count), 1, file) == 1;
+
+    if (valid)
+    {
+        entry->output.sections = calloc (count, sizeof (output_section_t));
+        valid = (entry->output.sections != NULL || count == 0);
+    }
+
+    for (uint32_t i = 0; valid && i < count; i++)
+    {
+        output_section_t *section = &entry->output.sections [i];
+        uint8_t kind = 0;
+        uint32_t name_length = 0;
+
+        entry->output.count++;
+        valid = fread (&kind, 1, 1, file) == 1 && kind <= OUTPUT_REPORT &&
+                fread (&name_length, sizeof (name_length), 1, file) == 1;
+        section->kind = kind;
+
+        if (valid && name_length > 0)
+        {
+            section->name = calloc (name_length + 1, 1);
+            valid = section->name != NULL && fread (section->name, 1, name_length, file) == name_length;
+        }
+
+        valid = valid && fread (&section->size, sizeof (section->size), 1, file) == 1;
+        if (valid)
+        {
+            section->data = malloc (section->size ? section->size : 1);
+            valid = section->data != NULL && fread (section->data, 1, section->size, file) == section->size;
+        }
+    }
+
+    fclose (file);
+
+    if (!valid)
+    {
+        cache_entry_free (entry);
+        return RC_ERROR;
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Store a converted sheet in the cache.
+ * The entry is written under a temporary name first, so that
+ * an interrupted run never leaves a partial entry behind.
+ */
+int cache_save (const char *cache_dir, uint64_t key, const cache_entry_t *entry)
+{
+    char *path = cache_path (cache_dir, key);
+    char *temp_path = NULL;
+    asprintf (&temp_path, "%s.tmp", path);
+
+    FILE *file = fopen (temp_path, "wb");
+    if (file == NULL)
+    {
+        fprintf (stderr, "Warning: Unable to write cache entry %s\n", path);
+        free (path);
+        free (temp_path);
+        return RC_ERROR;
+    }
+
+    uint32_t count = entry->output.count;
+    fwrite (CACHE_MAGIC, 1, sizeof (CACHE_MAGIC), file);
+    fwrite (&key, sizeof (key), 1, file);
+    fwrite (&entry->palettes_in, sizeof (mode4_palettes_t), 1, file);
+    fwrite (&entry->palettes_out, sizeof (mode4_palettes_t), 1, file);
+    fwrite (&count, sizeof (count), 1, file);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const output_section_t *section = &entry->output.sections [i];
+        uint8_t kind = section->kind;
+        uint32_t name_length = (section->name != NULL) ? strlen (section->name) : 0;
+
+        fwrite (&kind, 1, 1, file);
+        fwrite (&name_length, sizeof (name_length), 1, file);
+        if (name_length > 0)
+        {
+            fwrite (section->name, 1, name_length, file);
+        }
+        fwrite (&section->size, sizeof (section->size), 1, file);
+        fwrite (section->data, 1, section->size, file);
+    }
+
+    int rc = RC_OK;
+    bool written = !ferror (file);
+    written = (fclose (file) == 0) && written;
+    if (!written || rename (temp_path, path) != 0)
+    {
+        fprintf (stderr, "Warning: Unable to write cache entry %s\n", path);
+        remove (temp_path);
+        rc = RC_ERROR;
+    }
+
+    free (path);
+    free (temp_path);
+    return rc;
+}
+
+
+/*
+ * Free a loaded cache entry.
+ */
+void cache_entry_free (cache_entry_t *entry)
+{
+    output_capture_free (&entry->output);
+}
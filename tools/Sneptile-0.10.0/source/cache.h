@@ -0,0 +1,26 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ */
+
+/* A converted sheet */
+typedef struct cache_entry_s {
+    mode4_palettes_t palettes_in;
+    mode4_palettes_t palettes_out;
+    output_capture_t output;
+} cache_entry_t;
+
+/* Calculate the cache key for a sheet. */
+uint64_t cache_key (const uint8_t *png, uint32_t png_size, const char *name, const uint32_t *settings, uint32_t settings_count);
+
+/* Calculate the cache key for a sheet, reading the .png file a piece at a time. */
+int cache_key_file (const char *path, const char *name, const uint32_t *settings, uint32_t settings_count, uint64_t *key);
+
+/* Load a cached sheet. */
+int cache_load (const char *cache_dir, uint64_t key, cache_entry_t *entry);
+
+/* Store a converted sheet in the cache. */
+int cache_save (const char *cache_dir, uint64_t key, const cache_entry_t *entry);
+
+/* Free a loaded cache entry. */
+void cache_entry_free (cache_entry_t *entry);
@@ -0,0 +1,175 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ *
+ * Compressed output formats, decoded on the Master System by sms-unpack.
+ *
+ * Patterns:
+ *   A 16-bit little-endian pattern count, then for each pattern a mode byte
+ *   holding two bits per bitplane (plane 0 in the low bits):
+ *     0: All eight rows are 0x00
+ *     1: All eight rows are 0xff
+ *     2: The same as the previous plane of this pattern
+ *     3: A byte with bit n set if row n repeats row n-1, then the other rows
+ *   Mode-4 artwork tends to use few colours per tile, so many planes are
+ *   empty, full, or copies of their neighbour.
+ *
+ * Indices:
+ *   A sequence of runs, ending with a zero byte. Each run starts with a
+ *   control byte, with the run length (1-63) in the low six bits:
+ *     0x00 + n: n literal entries follow, 16-bit little-endian
+ *     0x40 + n: one entry follows, repeated n times
+ *     0x80 + n: one entry follows, incrementing n times (v, v+1, ...)
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "compress.h"
+
+#define RUN_LITERAL     0x00
+#define RUN_REPEAT      0x40
+#define RUN_INCREMENT   0x80
+#define RUN_MAX         63
+
+
+/*
+ * Compress mode-4 patterns, given as 32 bytes each in VRAM order.
+ * Returns the number of bytes written.
+ */
+uint32_t compress_patterns (const uint8_t *patterns, uint32_t pattern_count, uint8_t *output)
+{
+    uint32_t size = 0;
+
+    output [size++] = pattern_count & 0xff;
+    output [size++] = pattern_count >> 8;
+
+    for (uint32_t i = 0; i < pattern_count; i++)
+    {
+        const uint8_t *pattern = &patterns [i * 32];
+        uint8_t planes [4] [8];
+        uint32_t mode_offset = size++;
+        uint8_t modes = 0;
+
+        /* VRAM stores the four planes of each row together */
+        for (uint32_t row = 0; row < 8; row++)
+        {
+            for (uint32_t plane = 0; plane < 4; plane++)
+            {
+                planes [plane] [row] = pattern [row * 4 + plane];
+            }
+        }
+
+        for (uint32_t plane = 0; plane < 4; plane++)
+        {
+            static const uint8_t zero [8] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+            static const uint8_t full [8] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+            uint8_t mode;
+
+            if (memcmp (planes [plane], zero, 8) == 0)
+            {
+                mode = 0;
+            }
+            else if (memcmp (planes [plane], full, 8) == 0)
+            {
+                mode = 1;
+            }
+            else if (plane > 0 && memcmp (planes [plane], planes [plane - 1], 8) == 0)
+            {
+                mode = 2;
+            }
+            else
+            {
+                uint32_t repeat_offset = size++;
+                uint8_t repeats = 0;
+
+                mode = 3;
+                for (uint32_t row = 0; row < 8; row++)
+                {
+                    if (row > 0 && planes [plane] [row] == planes [plane] [row - 1])
+                    {
+                        repeats |= 1 << row;
+                    }
+                    else
+                    {
+                        output [size++] = planes [plane] [row];
+                    }
+                }
+                output [repeat_offset] = repeats;
+            }
+
+            modes |= mode << (plane * 2);
+        }
+        output [mode_offset] = modes;
+    }
+
+    return size;
+}
+
+
+/*
+ * Count how many entries, starting at indices [i], are a repeat or increment of the first.
+ */
+static uint32_t compress_run_length (const uint16_t *indices, uint32_t count, uint32_t i, uint16_t step)
+{
+    uint32_t length = 1;
+
+    while (i + length < count && length < RUN_MAX &&
+           indices [i + length] == (uint16_t) (indices [i] + step * length))
+    {
+        length++;
+    }
+
+    return length;
+}
+
+
+/*
+ * Compress a table of name-table entries.
+ * Returns the number of bytes written.
+ */
+uint32_t compress_indices (const uint16_t *indices, uint32_t count, uint8_t *output)
+{
+    uint32_t size = 0;
+    uint32_t i = 0;
+
+    while (i < count)
+    {
+        uint32_t repeat = compress_run_length (indices, count, i, 0);
+        uint32_t increment = compress_run_length (indices, count, i, 1);
+
+        if (repeat > 1 || increment > 1)
+        {
+            uint32_t length = (repeat >= increment) ? repeat : increment;
+
+            output [size++] = ((repeat >= increment) ? RUN_REPEAT : RUN_INCREMENT) | length;
+            output [size++] = indices [i] & 0xff;
+            output [size++] = indices [i] >> 8;
+            i += length;
+        }
+        else
+        {
+            /* Gather literals until the next repeat or increment */
+            uint32_t length = 1;
+            while (i + length < count && length < RUN_MAX &&
+                   compress_run_length (indices, count, i + length, 0) == 1 &&
+                   compress_run_length (indices, count, i + length, 1) == 1)
+            {
+                length++;
+            }
+
+            output [size++] = RUN_LITERAL | length;
+            for (uint32_t j = 0; j < length; j++)
+            {
+                output [size++] = indices [i + j] & 0xff;
+                output [size++] = indices [i + j] >> 8;
+            }
+            i += length;
+        }
+    }
+
+    output [size++] = 0x00;
+
+    return size;
+}
@@ -0,0 +1,14 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ */
+
+/* Worst-case compressed sizes */
+#define COMPRESS_PATTERNS_BOUND(count)  (2 + (count) * 37)
+#define COMPRESS_INDICES_BOUND(count)   (1 + (count) * 3)
+
+/* Compress mode-4 patterns, given as 32 bytes each in VRAM order. */
+uint32_t compress_patterns (const uint8_t *patterns, uint32_t pattern_count, uint8_t *output);
+
+/* Compress a table of name-table entries. */
+uint32_t compress_indices (const uint16_t *indices, uint32_t count, uint8_t *output);
@@ -6,8 +6,6 @@
  * Sega Master System VDP, from a set of .png images.
  *
  * To Do list:
- *  - De-duplicate for tms99xx modes
- *  - Split patterns across multiple output files to work with mappers.
  *  - Make "--sprites" per-sheet. Background patterns should be able to use the extra index-0 colour.
  *
  * Consider:
@@ -15,52 +13,154 @@
  *  - 'tall sprite mode' vertical tile ordering
  *  - De-duplicate after converting to VDP representation instead of in image-space
  *  - For mode-0, consider pre-processing the tiles into colour-groups before de-duplication / VDP representation
- *  - Configuration files to describe what to do with each image rather than parameters
  *  - Dithering support for handling full-colour images
- *  - Lossy de-duplication to force an image to use at most <n> patterns
  */
 
+#define _GNU_SOURCE
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 #include <spng.h>
 
 #include "sneptile.h"
 #include "sms_vdp.h"
 #include "tms9928a.h"
+#include "output.h"
+#include "cache.h"
+#include "manifest.h"
+#include "reduce.h"
 
 /* Global State */
 target_t target = VDP_MODE_4;
 char *output_dir = NULL;
+bool global_dedupe = false;
+bool flip_dedupe = false;
+bool tms_dedupe = false;
+bool binary_output = false;
+uint32_t bank_size = 0;
+uint32_t first_bank = 2;
 image_t current_image;
 
-/* De-duplication */
-void* unique_tiles [512];
-uint32_t unique_tiles_count = 0;
+/* Per-image settings */
+bool use_background_palette = false;
+bool compress_sheet = false;
+bool bank_split_sheet = false;
+bool metasprite_sheet = false;
+
+/* Name-table flip bits */
+#define FLIP_H 0x0200
+#define FLIP_V 0x0400
+
+/* De-duplication.
+ * Unique tiles are kept in the order they were found, with an open-addressed
+ * hash table of indices into the store to find them by digest.
+ * The store keeps its own copy of each tile, as with --global-dedupe
+ * the tiles outlive the image they came from.
+ * With --flip-dedupe, background tiles that are a flip of an existing pattern
+ * are also stored, with a name-table entry referring to that pattern. */
+typedef struct unique_tile_s {
+    pixel_t pixels [64];
+    bool background;
+    uint64_t digest;
+    uint16_t entry; /* Pattern index and flip bits */
+} unique_tile_t;
+
+static unique_tile_t *unique_tiles = NULL;
+static uint32_t unique_tiles_count = 0;
+static uint32_t unique_tiles_capacity = 0;
+static int32_t *unique_tiles_table = NULL;
+static uint32_t unique_tiles_table_size = 0;
+static uint32_t unique_patterns_count = 0;
+static uint32_t flip_saved_count = 0;
+
+/* Name-table entry of each tile in the current image, in row order.
+ * Indices and panels are generated from these, so that the image
+ * itself is not needed once its tiles have been processed. */
+static uint16_t *tile_entries = NULL;
 
 /* Panels */
 uint32_t panel_width = 0;
 uint32_t panel_height = 0;
 uint32_t panel_count = 0;
 
-/* Per-image settings */
-bool use_background_palette = false;
+/* How the rows of a .png file are decoded */
+typedef struct png_decode_s {
+    int format;             /* SPNG_FMT_PNG for 8-bit indexed images, otherwise SPNG_FMT_RGBA8 */
+    int flags;
+    pixel_t lookup [256];   /* Pixel for each index of an indexed image */
+    bool valid [256];
+} png_decode_t;
+
+/* Input sheets, with their per-sheet settings */
+typedef struct sheet_s {
+    char *path;
+    bool background;
+    bool compress;
+    bool bank_split;
+    uint32_t max_patterns;
+    bool stream;
+    uint32_t panel_width;
+    uint32_t panel_height;
+    uint32_t panel_count;
+    bool metasprite;
+
+    /* Filled in by a worker thread */
+    uint8_t *png;
+    uint32_t png_size;
+    uint64_t key;
+    bool cached;
+    cache_entry_t cache;
+    pixel_t *image;
+    uint32_t width;
+    uint32_t height;
+    bool invalid_colours;
+    reduce_result_t reduce;
+    int rc;
+    bool decoded;
+} sheet_t;
+
+static sheet_t *sheets = NULL;
+static uint32_t sheet_count = 0;
+
+/* Worker threads for decoding. The mutex protects
+ * the decode state of the sheets and the counters. */
+static uint32_t worker_count = 0;
+static pthread_mutex_t sheets_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sheets_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t next_sheet = 0;
+static uint32_t merged_sheets = 0;
+static bool decode_stop = false;
+
+/* Cache of converted sheets (--cache-dir) */
+static char *cache_dir = NULL;
+static bool cache_enabled = false;
+
+/* Decode sheets a band at a time while merging, instead of in the workers (--stream) */
+static bool stream_sheets = false;
+
 
 
 /*
- * Check if two 8x8 tiles are identical.
- * Note: Currently the two tiles must be within the same image file.
+ * Check if an 8x8 tile is identical to a unique tile.
+ * The stride is the distance between rows of the tile, in pixels.
  */
-static bool sneptile_check_match (pixel_t *tile_a, pixel_t *tile_b)
+static bool sneptile_check_match (pixel_t *tile, uint32_t stride, unique_tile_t *unique)
 {
+    /* The same pixels give a different pattern in the other palette */
+    if (unique->background != use_background_palette)
+    {
+        return false;
+    }
+
     for (uint32_t row = 0; row < 8; row++)
     {
-        if (memcmp (&tile_a [row * current_image.width],
-                    &tile_b [row * current_image.width], sizeof (pixel_t) * 8) != 0)
+        if (memcmp (&tile [row * stride], &unique->pixels [row * 8], sizeof (pixel_t) * 8) != 0)
         {
             return false;
         }
@@ -71,231 +171,1045 @@ static bool sneptile_check_match (pixel_t *tile_a, pixel_t *tile_b)
 
 
 /*
- * Find the matching 8x8 tile, or -1 if it is unique.
+ * Calculate a 64-bit digest of an 8x8 tile's pixels (FNV-1a).
  */
-int32_t sneptile_get_match (pixel_t *tile)
+static uint64_t sneptile_tile_digest (pixel_t *tile, uint32_t stride)
 {
+    uint64_t digest = 0xcbf29ce484222325 ^ use_background_palette;
+
+    for (uint32_t row = 0; row < 8; row++)
+    {
+        const uint8_t *bytes = (const uint8_t *) &tile [row * stride];
+
+        for (uint32_t i = 0; i < sizeof (pixel_t) * 8; i++)
+        {
+            digest ^= bytes [i];
+            digest *= 0x100000001b3;
+        }
+    }
+
+    return digest;
+}
+
+
+/*
+ * Find the hash table slot for a tile. This is either the slot
+ * holding the matching tile, or the empty slot to insert it into.
+ */
+static uint32_t sneptile_find_slot (pixel_t *tile, uint32_t stride, uint64_t digest)
+{
+    uint32_t mask = unique_tiles_table_size - 1;
+
+    for (uint32_t slot = digest & mask; ; slot = (slot + 1) & mask)
+    {
+        int32_t index = unique_tiles_table [slot];
+
+        if (index == -1 ||
+            (unique_tiles [index].digest == digest && sneptile_check_match (tile, stride, &unique_tiles [index])))
+        {
+            return slot;
+        }
+    }
+}
+
+
+/*
+ * Find the name-table entry for a tile, or -1 if it is not in the store.
+ */
+static int32_t sneptile_lookup (pixel_t *tile, uint32_t stride)
+{
+    int32_t index = unique_tiles_table [sneptile_find_slot (tile, stride, sneptile_tile_digest (tile, stride))];
+
+    return (index == -1) ? -1 : unique_tiles [index].entry;
+}
+
+
+/*
+ * Copy an 8x8 tile from the current image, flipped horizontally and/or vertically.
+ */
+static void sneptile_flip_tile (pixel_t *tile, pixel_t *flipped, bool flip_h, bool flip_v)
+{
+    for (uint32_t y = 0; y < 8; y++)
+    {
+        for (uint32_t x = 0; x < 8; x++)
+        {
+            flipped [y * 8 + x] = tile [(flip_v ? 7 - y : y) * current_image.width + (flip_h ? 7 - x : x)];
+        }
+    }
+}
+
+
+/*
+ * Rebuild the hash table at a new size.
+ */
+static int sneptile_resize_table (uint32_t size)
+{
+    int32_t *table = realloc (unique_tiles_table, size * sizeof (int32_t));
+    if (table == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for de-duplication.\n");
+        return RC_ERROR;
+    }
+
+    unique_tiles_table = table;
+    unique_tiles_table_size = size;
+    memset (unique_tiles_table, 0xff, size * sizeof (int32_t));
+
+    /* The stored tiles are all unique, so only need an empty slot */
+    uint32_t mask = size - 1;
     for (uint32_t i = 0; i < unique_tiles_count; i++)
     {
-        if (sneptile_check_match (tile, unique_tiles [i]))
-            return i;
+        uint32_t slot = unique_tiles [i].digest & mask;
+        while (unique_tiles_table [slot] != -1)
+        {
+            slot = (slot + 1) & mask;
+        }
+        unique_tiles_table [slot] = i;
     }
-    return -1;
+
+    return RC_OK;
 }
 
 
 /*
- * Process an image made up of 8×8 tiles.
+ * Add a tile to the store of unique tiles, if it is not already there.
+ * Sets *is_new to indicate whether the tile needs a new pattern,
+ * and *entry to the name-table entry for the tile.
  */
-static int sneptile_process_image (pixel_t *buffer, char *name)
+static int sneptile_add_unique (pixel_t *tile, bool *is_new, uint16_t *entry)
+{
+    uint64_t digest = sneptile_tile_digest (tile, current_image.width);
+
+    /* Keep the hash table no more than half full */
+    if ((unique_tiles_count + 1) * 2 > unique_tiles_table_size)
+    {
+        if (sneptile_resize_table ((unique_tiles_table_size == 0) ? 256 : unique_tiles_table_size * 2) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+    }
+
+    uint32_t slot = sneptile_find_slot (tile, current_image.width, digest);
+    if (unique_tiles_table [slot] != -1)
+    {
+        *is_new = false;
+        *entry = unique_tiles [unique_tiles_table [slot]].entry;
+        return RC_OK;
+    }
+
+    *entry = unique_patterns_count;
+    *is_new = true;
+
+    /* If a flip of this tile is already stored, this tile is the same flip
+     * of the stored tile's pattern. Only background tiles can be flipped,
+     * as the flip bits are in the name-table, which sprites don't use. */
+    if (flip_dedupe && use_background_palette && !metasprite_sheet)
+    {
+        static const uint16_t flips [3] = { FLIP_H, FLIP_V, FLIP_H | FLIP_V };
+        pixel_t flipped [64];
+
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            sneptile_flip_tile (tile, flipped, flips [i] & FLIP_H, flips [i] & FLIP_V);
+            int32_t match = sneptile_lookup (flipped, 8);
+            if (match != -1)
+            {
+                *entry = match ^ flips [i];
+                *is_new = false;
+                flip_saved_count++;
+                break;
+            }
+        }
+    }
+
+    /* Grow the store as needed */
+    if (unique_tiles_count == unique_tiles_capacity)
+    {
+        uint32_t capacity = (unique_tiles_capacity == 0) ? 128 : unique_tiles_capacity * 2;
+        unique_tile_t *store = realloc (unique_tiles, capacity * sizeof (unique_tile_t));
+        if (store == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for de-duplication.\n");
+            return RC_ERROR;
+        }
+        unique_tiles = store;
+        unique_tiles_capacity = capacity;
+    }
+
+    for (uint32_t row = 0; row < 8; row++)
+    {
+        memcpy (&unique_tiles [unique_tiles_count].pixels [row * 8],
+                &tile [row * current_image.width], sizeof (pixel_t) * 8);
+    }
+    unique_tiles [unique_tiles_count].background = use_background_palette;
+    unique_tiles [unique_tiles_count].digest = digest;
+    unique_tiles [unique_tiles_count].entry = *entry;
+    unique_tiles_table [slot] = unique_tiles_count++;
+
+    if (*is_new)
+    {
+        unique_patterns_count++;
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Get the height of the bands that an image is processed in.
+ * This is the height of one tile: 16 rows for large sprites, otherwise 8.
+ */
+static uint32_t sneptile_band_height (void)
+{
+    return (target == VDP_MODE_TMS_LARGE_SPRITES) ? 16 : 8;
+}
+
+
+/*
+ * Start processing an image, once its size is known.
+ */
+static int sneptile_begin_image (char *name)
 {
     uint32_t tile_width = 8;
-    uint32_t tile_height = 8;
+    uint32_t tile_height = sneptile_band_height ();
 
     switch (target)
     {
         case VDP_MODE_0:
         case VDP_MODE_2:
         case VDP_MODE_TMS_SMALL_SPRITES:
-            tms9928a_new_input_file (name);
+            if (tms9928a_new_input_file (name) != RC_OK)
+            {
+                return -1;
+            }
             break;
         case VDP_MODE_TMS_LARGE_SPRITES:
             tile_width = 16;
-            tile_height = 16;
-            tms9928a_new_input_file (name);
+            if (tms9928a_new_input_file (name) != RC_OK)
+            {
+                return -1;
+            }
             break;
         case VDP_MODE_4:
         case VDP_MODE_4_SPRITES:
-            mode4_new_input_file (name);
+            if (mode4_new_input_file (name, compress_sheet, bank_split_sheet) != RC_OK)
+            {
+                return -1;
+            }
             break;
         default:
             break;
     }
 
-    /* Sanity check */
-    if ((current_image.width % tile_width != 0) || (current_image.height % tile_height != 0))
+    /* Sanity check */
+    if ((current_image.width % tile_width != 0) || (current_image.height % tile_height != 0))
+    {
+        fprintf (stderr, "Error: Invalid resolution %ux%u\n", current_image.width, current_image.height);
+        return -1;
+    }
+
+    /* Reset the unique tiles counter.
+     * Note that unless --global-dedupe is used, de-duplication
+     * is only performed within a file, not across files. */
+    if (!global_dedupe)
+    {
+        unique_tiles_count = 0;
+        unique_patterns_count = 0;
+        if (unique_tiles_table != NULL)
+        {
+            memset (unique_tiles_table, 0xff, unique_tiles_table_size * sizeof (int32_t));
+        }
+    }
+    flip_saved_count = 0;
+
+    if (target == VDP_MODE_4 || target == VDP_MODE_4_SPRITES)
+    {
+        free (tile_entries);
+        tile_entries = malloc ((current_image.width / 8) * (current_image.height / 8) * sizeof (uint16_t));
+        if (tile_entries == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for %s indices.\n", name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+ * Process one band of an image, starting at the given row.
+ * The band holds one row of tiles, with the same stride as the image.
+ */
+static int sneptile_process_band (pixel_t *band, uint32_t row)
+{
+    uint32_t tile_width = (target == VDP_MODE_TMS_LARGE_SPRITES) ? 16 : 8;
+
+    for (uint32_t col = 0; col < current_image.width; col += tile_width)
+    {
+
+        if (target == VDP_MODE_4 || target == VDP_MODE_4_SPRITES)
+        {
+            bool is_new;
+            if (sneptile_add_unique (&band [col], &is_new,
+                                     &tile_entries [(row / 8) * (current_image.width / 8) + col / 8]) != RC_OK)
+            {
+                return -1;
+            }
+            if (!is_new)
+            {
+                continue;
+            }
+        }
+
+        switch (target)
+        {
+            case VDP_MODE_0:
+            case VDP_MODE_2:
+            case VDP_MODE_TMS_SMALL_SPRITES:
+            case VDP_MODE_TMS_LARGE_SPRITES:
+                tms9928a_process_tile (&band [col]);
+                break;
+            case VDP_MODE_4:
+            case VDP_MODE_4_SPRITES:
+                mode4_process_tile ((use_background_palette) ? PALETTE_BACKGROUND : PALETTE_SPRITE, &band [col]);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+ * Complete an image, once all of its bands have been processed.
+ */
+static int sneptile_end_image (char *name)
+{
+    int rc = 0;
+
+    if (flip_dedupe && use_background_palette && !metasprite_sheet)
+    {
+        output_report ("%s: %u patterns saved by flip de-duplication\n", name, flip_saved_count);
+    }
+
+    if (panel_count)
+    {
+        switch (target)
+        {
+            case VDP_MODE_4:
+            case VDP_MODE_4_SPRITES:
+                if (mode4_process_panels (name, panel_count, panel_width, panel_height, tile_entries) != RC_OK)
+                {
+                    rc = -1;
+                }
+                else if (metasprite_sheet && mode4_process_metasprite (name, panel_width, panel_height) != RC_OK)
+                {
+                    rc = -1;
+                }
+            default:
+                break;
+        }
+    }
+    else
+    {
+        switch (target)
+        {
+            case VDP_MODE_4:
+            case VDP_MODE_4_SPRITES:
+                if (mode4_process_indices (name, tile_entries) != RC_OK)
+                {
+                    rc = -1;
+                }
+            default:
+                break;
+        }
+    }
+
+    free (tile_entries);
+    tile_entries = NULL;
+
+    if (rc != 0)
+    {
+        return rc;
+    }
+
+    if (target == VDP_MODE_4 || target == VDP_MODE_4_SPRITES)
+    {
+        if (mode4_end_input_file () != RC_OK)
+        {
+            return -1;
+        }
+    }
+    else if (tms9928a_end_input_file () != RC_OK)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/*
+ * Process an image made up of 8×8 tiles, that has been decoded whole.
+ */
+static int sneptile_process_image (pixel_t *buffer, char *name)
+{
+    uint32_t band_height = sneptile_band_height ();
+
+    if (sneptile_begin_image (name) != 0)
+    {
+        return -1;
+    }
+
+    for (uint32_t row = 0; row < current_image.height; row += band_height)
+    {
+        if (sneptile_process_band (&buffer [row * current_image.width], row) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return sneptile_end_image (name);
+}
+
+
+/*
+ * Get the file name of a sheet, without its path.
+ */
+static char *sneptile_sheet_name (sheet_t *sheet)
+{
+    return (strrchr (sheet->path, '/') != NULL) ? strrchr (sheet->path, '/') + 1 : sheet->path;
+}
+
+
+/*
+ * Read a single .png file.
+ * Called from the worker threads, so only touches the sheet it is given.
+ */
+static int sneptile_read_file (sheet_t *sheet)
+{
+    /* Try to open the file */
+    FILE *png_file = fopen (sheet->path, "r");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", sheet->path);
+        return RC_ERROR;
+    }
+
+    /* Once the file has been opened, drop the path and use only the file name */
+    char *name = sneptile_sheet_name (sheet);
+
+    /* Get the file size */
+    fseek (png_file, 0, SEEK_END);
+    sheet->png_size = ftell (png_file);
+    rewind (png_file);
+
+    /* Allocate memory for the .png file */
+    sheet->png = calloc (sheet->png_size, 1);
+    if (sheet->png == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for %s.\n", name);
+        fclose (png_file);
+        return RC_ERROR;
+    }
+
+    /* Read and close the file */
+    uint32_t bytes_read = 0;
+    while (bytes_read < sheet->png_size)
+    {
+        size_t bytes = fread (sheet->png + bytes_read, 1, sheet->png_size - bytes_read, png_file);
+        if (bytes == 0)
+        {
+            fprintf (stderr, "Error: Failed to read %s.\n", name);
+            fclose (png_file);
+            return RC_ERROR;
+        }
+        bytes_read += bytes;
+    }
+    fclose (png_file);
+
+    return RC_OK;
+}
+
+
+/*
+ * Convert an RGBA colour to a pixel for the current target.
+ * Returns false if the colour cannot be used.
+ */
+static bool sneptile_convert_colour (uint8_t r, uint8_t g, uint8_t b, uint8_t a, pixel_t *pixel)
+{
+    if (target == VDP_MODE_4 || target == VDP_MODE_4_SPRITES)
+    {
+        *pixel = mode4_pixel (r, g, b, a);
+        return true;
+    }
+
+    return tms9928a_pixel (r, g, b, a, pixel);
+}
+
+
+/*
+ * Read the header of a .png file, and choose how it is decoded.
+ * Indexed images are decoded as their 8-bit palette indices, converting each
+ * entry of the .png palette once. Other images are decoded as RGBA.
+ */
+static int sneptile_decode_start (spng_ctx *spng_context, struct spng_ihdr *header, png_decode_t *decode)
+{
+    if (spng_get_ihdr (spng_context, header) != 0)
+    {
+        return RC_ERROR;
+    }
+
+    decode->format = SPNG_FMT_RGBA8;
+    decode->flags = SPNG_DECODE_TRNS;
+
+    if (header->color_type == SPNG_COLOR_TYPE_INDEXED && header->bit_depth == 8)
+    {
+        struct spng_plte plte = { };
+        struct spng_trns trns = { };
+
+        decode->format = SPNG_FMT_PNG;
+        decode->flags = 0;
+
+        spng_get_plte (spng_context, &plte);
+        if (spng_get_trns (spng_context, &trns) != 0)
+        {
+            trns.n_type3_entries = 0;
+        }
+
+        /* Indices beyond the palette are treated as opaque black */
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            struct spng_plte_entry entry = (i < plte.n_entries) ? plte.entries [i] : (struct spng_plte_entry) { };
+            uint8_t alpha = (i < trns.n_type3_entries) ? trns.type3_alpha [i] : 0xff;
+
+            decode->valid [i] = sneptile_convert_colour (entry.red, entry.green, entry.blue, alpha, &decode->lookup [i]);
+        }
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Convert decoded .png data to one byte per pixel.
+ * Each pixel is read before its bytes are overwritten, so this can be done in place.
+ */
+static void sneptile_convert_pixels (sheet_t *sheet, const png_decode_t *decode, const uint8_t *data,
+                                     pixel_t *pixels, uint32_t pixel_count)
+{
+    if (decode->format == SPNG_FMT_PNG)
+    {
+        for (uint32_t i = 0; i < pixel_count; i++)
+        {
+            if (!decode->valid [data [i]])
+            {
+                sheet->invalid_colours = true;
+            }
+            pixels [i] = decode->lookup [data [i]];
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < pixel_count; i++)
+        {
+            if (!sneptile_convert_colour (data [i * 4 + 0], data [i * 4 + 1], data [i * 4 + 2], data [i * 4 + 3], &pixels [i]))
+            {
+                sheet->invalid_colours = true;
+            }
+        }
+    }
+}
+
+
+/*
+ * Decode a .png file that has been read into memory.
+ * The image is converted in place to one byte per pixel.
+ */
+static int sneptile_decode_file (sheet_t *sheet)
+{
+    char *name = sneptile_sheet_name (sheet);
+
+    /* Get the decompressed image size */
+    spng_ctx *spng_context = spng_ctx_new (0);
+    struct spng_ihdr header = { };
+    png_decode_t decode = { };
+    size_t image_size = 0;
+    int rc = RC_ERROR;
+
+    if (spng_set_png_buffer (spng_context, sheet->png, sheet->png_size) != 0 ||
+        sneptile_decode_start (spng_context, &header, &decode) != RC_OK)
+    {
+        fprintf (stderr, "Error: Failed to read the header of %s.\n", name);
+    }
+    else if (spng_decoded_image_size (spng_context, decode.format, &image_size) != 0)
+    {
+        fprintf (stderr, "Error: Failed to determine decompression size for %s.\n", name);
+    }
+
+    /* Allocate memory for the decompressed image */
+    else if ((sheet->image = calloc (image_size, 1)) == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate decompression memory for %s.\n", name);
+    }
+
+    /* Decode the image */
+    else if (spng_decode_image (spng_context, sheet->image, image_size, decode.format, decode.flags) != 0)
+    {
+        fprintf (stderr, "Error: Failed to decode image %s.\n", name);
+    }
+    else
+    {
+        uint32_t pixel_count = header.width * header.height;
+        sneptile_convert_pixels (sheet, &decode, sheet->image, sheet->image, pixel_count);
+
+        /* Release the memory no longer needed for RGBA */
+        pixel_t *smaller = realloc (sheet->image, pixel_count);
+        if (smaller != NULL)
+        {
+            sheet->image = smaller;
+        }
+
+        sheet->width = header.width;
+        sheet->height = header.height;
+        rc = RC_OK;
+    }
+
+    /* Lossy reduction only depends on the image, so is done here rather than while merging.
+     * A resolution that isn't made of whole tiles is reported when the sheet is processed. */
+    if (rc == RC_OK && sheet->max_patterns != 0 && sheet->width % 8 == 0 && sheet->height % 8 == 0)
+    {
+        rc = reduce_tiles (sheet->image, sheet->width, sheet->height, sheet->max_patterns, &sheet->reduce);
+    }
+
+    /* Tidy up */
+    spng_ctx_free (spng_context);
+
+    return rc;
+}
+
+
+/*
+ * Decode and process a sheet one band of rows at a time, straight from its file (--stream).
+ * Only a single band of pixels is held, rather than the file and the whole image.
+ * Interlaced images can't be decoded in order of their rows, so are decoded whole.
+ */
+static int sneptile_stream_sheet (sheet_t *sheet)
+{
+    char *name = sneptile_sheet_name (sheet);
+
+    FILE *png_file = fopen (sheet->path, "rb");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", sheet->path);
+        return RC_ERROR;
+    }
+
+    spng_ctx *spng_context = spng_ctx_new (0);
+    struct spng_ihdr header = { };
+    png_decode_t decode = { };
+    uint32_t band_height = sneptile_band_height ();
+    size_t image_size = 0;
+    uint8_t *row = NULL;
+    pixel_t *band = NULL;
+    bool interlaced = false;
+    int rc = RC_ERROR;
+
+    if (spng_set_png_file (spng_context, png_file) != 0 ||
+        sneptile_decode_start (spng_context, &header, &decode) != RC_OK)
+    {
+        fprintf (stderr, "Error: Failed to read the header of %s.\n", name);
+    }
+    else if (header.interlace_method != SPNG_INTERLACE_NONE)
+    {
+        interlaced = true;
+    }
+    else if (spng_decoded_image_size (spng_context, decode.format, &image_size) != 0)
+    {
+        fprintf (stderr, "Error: Failed to determine decompression size for %s.\n", name);
+    }
+
+    /* Allocate memory for one decoded row, and one band of pixels */
+    else if ((row = malloc (image_size / header.height)) == NULL ||
+             (band = malloc (header.width * band_height)) == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate decompression memory for %s.\n", name);
+    }
+    else if (spng_decode_image (spng_context, NULL, 0, decode.format, decode.flags | SPNG_DECODE_PROGRESSIVE) != 0)
+    {
+        fprintf (stderr, "Error: Failed to decode image %s.\n", name);
+    }
+    else
+    {
+        current_image.width = header.width;
+        current_image.height = header.height;
+        rc = sneptile_begin_image (name);
+
+        for (uint32_t y = 0; y < header.height && rc == RC_OK; y++)
+        {
+            int decode_rc = spng_decode_row (spng_context, row, image_size / header.height);
+            if (decode_rc != 0 && decode_rc != SPNG_EOI)
+            {
+                fprintf (stderr, "Error: Failed to decode image %s.\n", name);
+                rc = RC_ERROR;
+                break;
+            }
+
+            sneptile_convert_pixels (sheet, &decode, row, &band [(y % band_height) * header.width], header.width);
+
+            if (y % band_height == band_height - 1)
+            {
+                rc = sneptile_process_band (band, y + 1 - band_height);
+            }
+        }
+
+        if (rc == RC_OK)
+        {
+            rc = sneptile_end_image (name);
+        }
+    }
+
+    /* Tidy up */
+    spng_ctx_free (spng_context);
+    fclose (png_file);
+    free (row);
+    free (band);
+
+    if (interlaced)
+    {
+        if (sneptile_read_file (sheet) != RC_OK || sneptile_decode_file (sheet) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+        current_image.width = sheet->width;
+        current_image.height = sheet->height;
+        rc = sneptile_process_image (sheet->image, name);
+    }
+
+    return rc;
+}
+
+
+/*
+ * Look up a sheet in the cache.
+ * The settings are everything, other than the palettes, that affects the output.
+ */
+static int sneptile_cache_lookup (sheet_t *sheet)
+{
+    uint32_t settings [] = {
+        target, flip_dedupe, binary_output,
+        sheet->background, sheet->compress,
+        bank_size != 0, sheet->bank_split, sheet->max_patterns,
+        sheet->panel_width, sheet->panel_height, sheet->panel_count,
+        sheet->metasprite
+    };
+
+    uint32_t settings_count = sizeof (settings) / sizeof (settings [0]);
+
+    /* Streamed sheets are not read into memory, so the file is hashed as it is read */
+    if (sheet->stream)
+    {
+        if (cache_key_file (sheet->path, sneptile_sheet_name (sheet), settings, settings_count, &sheet->key) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+    }
+    else
+    {
+        sheet->key = cache_key (sheet->png, sheet->png_size, sneptile_sheet_name (sheet), settings, settings_count);
+    }
+    sheet->cached = (cache_load (cache_dir, sheet->key, &sheet->cache) == RC_OK);
+
+    return RC_OK;
+}
+
+
+/*
+ * Read and decode a sheet, unless it can come from the cache.
+ * Streamed sheets are only looked up in the cache, and are decoded while merging.
+ */
+static int sneptile_prepare_sheet (sheet_t *sheet)
+{
+    if (!sheet->stream && sneptile_read_file (sheet) != RC_OK)
+    {
+        return RC_ERROR;
+    }
+
+    if (cache_enabled)
     {
-        fprintf (stderr, "Error: Invalid resolution %ux%u\n", current_image.width, current_image.height);
-        return -1;
+        if (sneptile_cache_lookup (sheet) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+        if (sheet->cached)
+        {
+            return RC_OK;
+        }
     }
 
-    /* Reset the unique tiles counter.
-     * Note that de-duplication is only performed within a file, not across files. */
-    unique_tiles_count = 0;
-
-    for (uint32_t row = 0; row < current_image.height; row += tile_height)
+    if (sheet->stream)
     {
-        for (uint32_t col = 0; col < current_image.width; col += tile_width)
-        {
+        return RC_OK;
+    }
 
-            if ((target == VDP_MODE_4 || target == VDP_MODE_4_SPRITES) && unique_tiles_count < 512)
-            {
-                if (sneptile_get_match (&buffer [row * current_image.width + col]) == -1)
-                {
-                    unique_tiles [unique_tiles_count++] = &buffer [row * current_image.width + col];
-                }
-                else
-                {
-                    continue;
-                }
-            }
+    return sneptile_decode_file (sheet);
+}
 
-            switch (target)
-            {
-                case VDP_MODE_0:
-                case VDP_MODE_2:
-                case VDP_MODE_TMS_SMALL_SPRITES:
-                case VDP_MODE_TMS_LARGE_SPRITES:
-                    tms9928a_process_tile (&buffer [row * current_image.width + col]);
-                    break;
-                case VDP_MODE_4:
-                case VDP_MODE_4_SPRITES:
-                    mode4_process_tile ((use_background_palette) ? PALETTE_BACKGROUND : PALETTE_SPRITE,
-                                        &buffer [row * current_image.width + col]);
-                    break;
-                default:
-                    break;
-            }
-        }
-    }
 
-    if (panel_count)
+/*
+ * Worker thread, decoding sheets in order.
+ */
+static void *sneptile_worker (void *arg)
+{
+    (void) arg;
+
+    pthread_mutex_lock (&sheets_mutex);
+
+    while (true)
     {
-        switch (target)
+        /* Don't decode too far ahead of the merge, to limit memory use */
+        while (!decode_stop && next_sheet < sheet_count && next_sheet >= merged_sheets + worker_count * 2)
         {
-            case VDP_MODE_4:
-            case VDP_MODE_4_SPRITES:
-                mode4_process_panels (name, panel_count, panel_width, panel_height, buffer);
-            default:
-                break;
+            pthread_cond_wait (&sheets_cond, &sheets_mutex);
         }
-    }
-    else
-    {
-        switch (target)
+
+        if (decode_stop || next_sheet >= sheet_count)
         {
-            case VDP_MODE_4:
-            case VDP_MODE_4_SPRITES:
-                mode4_process_indices (name, buffer);
-            default:
-                break;
+            break;
         }
+
+        sheet_t *sheet = &sheets [next_sheet++];
+        pthread_mutex_unlock (&sheets_mutex);
+
+        int rc = sneptile_prepare_sheet (sheet);
+
+        pthread_mutex_lock (&sheets_mutex);
+        sheet->rc = rc;
+        sheet->decoded = true;
+        pthread_cond_broadcast (&sheets_cond);
     }
 
-    return 0;
+    pthread_mutex_unlock (&sheets_mutex);
+
+    return NULL;
 }
 
 
 /*
- * Process a single .png file.
+ * Process the input sheets.
+ * Sheets are decoded in parallel, then merged one at a time in their original
+ * order, so that palette assignment and pattern indices match a serial run.
  */
-static int sneptile_process_file (char *name)
+static int sneptile_process_sheets (void)
 {
-    spng_ctx *spng_context = spng_ctx_new (0);
+    bool invalid_colours_warned = false;
+    uint32_t cache_hits = 0;
+    int rc = RC_OK;
 
-    /* Try to open the file */
-    FILE *png_file = fopen (name, "r");
-    if (png_file == NULL)
+    if (worker_count == 0)
     {
-        fprintf (stderr, "Error: Unable to open %s.\n", name);
-        return RC_ERROR;
+        long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+        worker_count = (cpus > 0) ? cpus : 1;
     }
-
-    /* Once the file has been opened, drop the path and use only the file name */
-    if (strrchr (name, '/') != NULL)
+    if (worker_count > sheet_count)
     {
-        name = strrchr (name, '/') + 1;
+        worker_count = sheet_count;
     }
 
-    /* Get the file size */
-    uint32_t png_size = 0;
-    fseek (png_file, 0, SEEK_END);
-    png_size = ftell (png_file);
-    rewind (png_file);
-
-    /* Allocate memory for the .png file */
-    uint8_t *png_buffer = calloc (png_size, 1);
-    if (png_buffer == NULL)
+    pthread_t *workers = calloc (worker_count, sizeof (pthread_t));
+    uint32_t workers_started = 0;
+    if (workers == NULL)
     {
-        fprintf (stderr, "Error: Failed to allocate memory for %s.\n", name);
+        fprintf (stderr, "Error: Failed to allocate memory for worker threads.\n");
         return RC_ERROR;
     }
-
-    /* Read and close the file */
-    uint32_t bytes_read = 0;
-    while (bytes_read < png_size)
+    while (workers_started < worker_count)
     {
-        bytes_read += fread (png_buffer + bytes_read, 1, png_size - bytes_read, png_file);
+        if (pthread_create (&workers [workers_started], NULL, sneptile_worker, NULL) != 0)
+        {
+            break;
+        }
+        workers_started++;
     }
-    fclose (png_file);
-    png_file = NULL;
-
-    /* Get the decompressed image size */
-    size_t image_size = 0;
-    if (spng_set_png_buffer (spng_context, png_buffer, png_size) != 0)
+    if (workers_started == 0 && sheet_count > 0)
     {
-        fprintf (stderr, "Error: Failed to set file buffer for %s.\n", name);
+        fprintf (stderr, "Error: Failed to start worker threads.\n");
+        free (workers);
         return RC_ERROR;
     }
 
-    if (spng_decoded_image_size (spng_context, SPNG_FMT_RGBA8, &image_size) != 0)
+    for (uint32_t i = 0; i < sheet_count; i++)
     {
-        fprintf (stderr, "Error: Failed to determine decompression size for %s.\n", name);
-        return RC_ERROR;
+        sheet_t *sheet = &sheets [i];
+
+        pthread_mutex_lock (&sheets_mutex);
+        while (!sheet->decoded)
+        {
+            pthread_cond_wait (&sheets_cond, &sheets_mutex);
+        }
+        pthread_mutex_unlock (&sheets_mutex);
+
+        rc = sheet->rc;
+
+        /* A cached sheet can only be used if it was converted with the same palettes */
+        if (rc == RC_OK && sheet->cached)
+        {
+            mode4_palettes_t palettes;
+            mode4_palettes_get (&palettes);
+
+            if (memcmp (&palettes, &sheet->cache.palettes_in, sizeof (mode4_palettes_t)) == 0)
+            {
+                rc = output_replay (&sheet->cache.output);
+                mode4_palettes_set (&sheet->cache.palettes_out);
+                cache_hits++;
+            }
+            else
+            {
+                sheet->cached = false;
+                if (!sheet->stream)
+                {
+                    rc = sneptile_decode_file (sheet);
+                }
+            }
+            cache_entry_free (&sheet->cache);
+        }
+
+        if (rc == RC_OK && !sheet->cached)
+        {
+            char *name = sneptile_sheet_name (sheet);
+            cache_entry_t entry;
+
+            if (cache_enabled)
+            {
+                mode4_palettes_get (&entry.palettes_in);
+                output_capture_start ();
+            }
+
+            use_background_palette = sheet->background;
+            compress_sheet = sheet->compress;
+            bank_split_sheet = sheet->bank_split;
+            metasprite_sheet = sheet->metasprite;
+            panel_width = sheet->panel_width;
+            panel_height = sheet->panel_height;
+            panel_count = sheet->panel_count;
+            current_image.width = sheet->width;
+            current_image.height = sheet->height;
+
+            if (sheet->reduce.tiles_before > sheet->max_patterns)
+            {
+                output_report ("%s: %u tiles reduced to %u patterns, %u of %u tiles changed (error: mean %.2f, worst %.2f)\n",
+                               name, sheet->reduce.tiles_before, sheet->reduce.tiles_after,
+                               sheet->reduce.tiles_changed, sheet->reduce.tiles_total,
+                               sheet->reduce.error_mean, sheet->reduce.error_worst);
+            }
+
+            if ((sheet->stream ? sneptile_stream_sheet (sheet) : sneptile_process_image (sheet->image, name)) != 0)
+            {
+                fprintf (stderr, "Error: Failed to process image %s.\n", name);
+                rc = RC_ERROR;
+            }
+
+            /* Only mentioned once, as it applies to every sheet in the palette */
+            if (sheet->invalid_colours && !invalid_colours_warned)
+            {
+                fprintf (stderr, "Warning: Image contains invalid colours for tms9928a.\n");
+                invalid_colours_warned = true;
+            }
+
+            /* Store the result for next time. Failing to do so is not an error. */
+            if (cache_enabled && output_capture_end (&entry.output) == RC_OK)
+            {
+                if (rc == RC_OK)
+                {
+                    mode4_palettes_get (&entry.palettes_out);
+                    cache_save (cache_dir, sheet->key, &entry);
+                }
+                cache_entry_free (&entry);
+            }
+        }
+
+        free (sheet->png);
+        sheet->png = NULL;
+        free (sheet->image);
+        sheet->image = NULL;
+
+        pthread_mutex_lock (&sheets_mutex);
+        merged_sheets = i + 1;
+        decode_stop = (rc != RC_OK);
+        pthread_cond_broadcast (&sheets_cond);
+        pthread_mutex_unlock (&sheets_mutex);
+
+        if (rc != RC_OK)
+        {
+            break;
+        }
     }
 
-    /* Allocate memory for the decompressed image */
-    uint8_t *image_buffer = calloc (image_size, 1);
-    if (image_buffer == NULL)
+    for (uint32_t i = 0; i < workers_started; i++)
     {
-        fprintf (stderr, "Error: Failed to allocate decompression memory for %s.\n", name);
-        return RC_ERROR;
+        pthread_join (workers [i], NULL);
     }
+    free (workers);
 
-    /* Decode the image */
-    if (spng_decode_image (spng_context, image_buffer, image_size, SPNG_FMT_RGBA8, SPNG_DECODE_TRNS) != 0)
+    /* Sheets decoded after an error are never merged */
+    for (uint32_t i = 0; i < sheet_count; i++)
     {
-        fprintf (stderr, "Error: Failed to decode image %s.\n", name);
-        return RC_ERROR;
+        free (sheets [i].png);
+        sheets [i].png = NULL;
+        free (sheets [i].image);
+        sheets [i].image = NULL;
+        if (sheets [i].cached)
+        {
+            cache_entry_free (&sheets [i].cache);
+        }
     }
 
-    /* Process the image */
-    struct spng_ihdr header = { };
-    spng_get_ihdr(spng_context, &header);
-    current_image.width = header.width;
-    current_image.height = header.height;
-    if (sneptile_process_image ((pixel_t *) image_buffer, name) != 0)
+    if (cache_enabled && rc == RC_OK)
     {
-        fprintf (stderr, "Error: Failed to process image %s.\n", name);
-        return RC_ERROR;
+        printf ("%u of %u sheets re-used from the cache\n", cache_hits, sheet_count);
     }
 
-    /* Tidy up */
-    free (png_buffer);
-    free (image_buffer);
-    spng_ctx_free (spng_context);
+    /* Restore per-image settings back to their defaults */
+    panel_count = 0;
+    use_background_palette = false;
+    compress_sheet = false;
+    bank_split_sheet = false;
+    metasprite_sheet = false;
 
-    return RC_OK;
+    return rc;
 }
 
 
 /*
- * Entry point.
+ * Convert a set of sheets, as described by the command line.
  */
-int main (int argc, char **argv)
+static int sneptile_run (int argc, char **argv)
 {
     int rc = 0;
 
     if (argc < 2)
     {
         fprintf (stderr, "Usage: %s [global options] [per-sheet options, tiles.png]\n", argv [0]);
+        fprintf (stderr, "       %s --manifest <file>\n", argv [0]);
         fprintf (stderr, "  Global options:\n");
         fprintf (stderr, "    --mode-0 : Generate TMS99xx mode-0 patterns\n");
         fprintf (stderr, "    --mode-2 : Generate TMS99xx mode-2 patterns\n");
         fprintf (stderr, "    --tms-small-sprites : Generate TMS99xx sprite patterns (8x8)\n");
         fprintf (stderr, "    --tms-large-sprites : Generate TMS99xx sprite patterns (16x16)\n");
+        fprintf (stderr, "    --tms-dedupe : De-duplicate TMS99xx mode-0 and mode-2 tiles, generating indices for each file\n");
         fprintf (stderr, "    --de-duplicate : Within an input file, don't generate the same pattern twice\n");
         fprintf (stderr, "    --output-dir <dir> : Specify output directory\n");
+        fprintf (stderr, "    --global-dedupe : De-duplicate across all input files, into a single pattern pool (mode-4)\n");
+        fprintf (stderr, "    --flip-dedupe : Also de-duplicate flipped background tiles, using the name-table flip bits (mode-4)\n");
+        fprintf (stderr, "    --binary : Write raw .bin files, with a header of their sizes (mode-4)\n");
+        fprintf (stderr, "    --jobs <n> : Decode up to <n> sheets in parallel (default: one per CPU)\n");
+        fprintf (stderr, "    --stream : Decode each sheet a row of tiles at a time while converting it, to limit memory use\n");
+        fprintf (stderr, "    --bank-size <bytes> : Place pattern arrays into bank_<n>.c files of up to <bytes> each (mode-4)\n");
+        fprintf (stderr, "    --first-bank <n> : Number of the first bank (default: 2)\n");
+        fprintf (stderr, "    --cache-dir <dir> : Re-use converted sheets that have not changed since the last run (mode-4)\n");
         fprintf (stderr, "  Mode-4 options:\n");
         fprintf (stderr, "    --sprite-palette <0x00 0x01..> : Pre-defined palette entries for the sprite palette.\n");
         fprintf (stderr, "    --background-palette <0x00 0x01..> : Pre-defined palette entries for the background palette.\n");
@@ -303,6 +1217,10 @@ int main (int argc, char **argv)
         fprintf (stderr, "  Per-sheet options:\n");
         fprintf (stderr, "    --background : The next sheet should use the background palette instead of the sprite palette (mode-4)\n");
         fprintf (stderr, "    --panels <wxh,n> : The following sheet contains <n> panels of size <w> x <h>. Depends on de-duplication.\n");
+        fprintf (stderr, "    --metasprite : Also generate a metasprite table for the next sheet's panels (mode-4)\n");
+        fprintf (stderr, "    --compress : Compress the next sheet's patterns and indices, for sms-unpack (mode-4)\n");
+        fprintf (stderr, "    --bank-split : Allow the next sheet's patterns to be split between banks (mode-4)\n");
+        fprintf (stderr, "    --max-patterns <n> : Merge the most similar tiles of the next sheet until it uses at most <n> patterns (mode-4)\n");
         return EXIT_FAILURE;
     }
     argv++;
@@ -318,6 +1236,54 @@ int main (int argc, char **argv)
             argv += 2;
             argc -= 2;
         }
+        else if (strcmp (argv [0], "--cache-dir") == 0 && argc > 2)
+        {
+            cache_dir = argv [1];
+            argv += 2;
+            argc -= 2;
+        }
+        else if (strcmp (argv [0], "--bank-size") == 0 && argc > 2)
+        {
+            bank_size = strtoul (argv [1], NULL, 0);
+            argv += 2;
+            argc -= 2;
+        }
+        else if (strcmp (argv [0], "--first-bank") == 0 && argc > 2)
+        {
+            first_bank = strtoul (argv [1], NULL, 0);
+            argv += 2;
+            argc -= 2;
+        }
+        else if (strcmp (argv [0], "--jobs") == 0 && argc > 2)
+        {
+            worker_count = strtoul (argv [1], NULL, 10);
+            argv += 2;
+            argc -= 2;
+        }
+        else if (strcmp (argv [0], "--global-dedupe") == 0)
+        {
+            global_dedupe = true;
+            argv += 1;
+            argc -= 1;
+        }
+        else if (strcmp (argv [0], "--flip-dedupe") == 0)
+        {
+            flip_dedupe = true;
+            argv += 1;
+            argc -= 1;
+        }
+        else if (strcmp (argv [0], "--binary") == 0)
+        {
+            binary_output = true;
+            argv += 1;
+            argc -= 1;
+        }
+        else if (strcmp (argv [0], "--stream") == 0)
+        {
+            stream_sheets = true;
+            argv += 1;
+            argc -= 1;
+        }
 
         /* TMS99xx Options */
         else if (strcmp (argv [0], "--mode-0") == 0)
@@ -344,6 +1310,12 @@ int main (int argc, char **argv)
             argv += 1;
             argc -= 1;
         }
+        else if (strcmp (argv [0], "--tms-dedupe") == 0)
+        {
+            tms_dedupe = true;
+            argv += 1;
+            argc -= 1;
+        }
 
         /* SMS-GG Mode4 Options */
         else if (strcmp (argv [0], "--sprites") == 0)
@@ -393,54 +1365,149 @@ int main (int argc, char **argv)
         mkdir (output_dir, S_IRWXU);
     }
 
+    /* Banks hold text pattern arrays, one or more per file */
+    if (bank_size != 0)
+    {
+        if ((target != VDP_MODE_4 && target != VDP_MODE_4_SPRITES) || binary_output || global_dedupe)
+        {
+            fprintf (stderr, "Error: --bank-size is only supported for mode-4, without --binary or --global-dedupe.\n");
+            rc = RC_ERROR;
+        }
+        else if (bank_size < 32)
+        {
+            fprintf (stderr, "Error: --bank-size must be at least one pattern (32 bytes).\n");
+            rc = RC_ERROR;
+        }
+    }
+
+    /* Sprites are placed by index rather than through the name table, so are not de-duplicated */
+    if (tms_dedupe && target != VDP_MODE_0 && target != VDP_MODE_2)
+    {
+        fprintf (stderr, "Error: --tms-dedupe is only supported for mode-0 and mode-2.\n");
+        rc = RC_ERROR;
+    }
+
+    /* The cache holds mode-4 sheets, which are converted independently of each other apart
+     * from the palettes. With --global-dedupe, each sheet depends on all of the earlier ones. */
+    if (cache_dir != NULL)
+    {
+        if ((target == VDP_MODE_4 || target == VDP_MODE_4_SPRITES) && !global_dedupe)
+        {
+            mkdir (cache_dir, S_IRWXU);
+            cache_enabled = true;
+        }
+        else
+        {
+            fprintf (stderr, "Warning: --cache-dir is only used for mode-4, without --global-dedupe.\n");
+        }
+    }
+
     /* Open the output files */
-    switch (target)
+    if (rc == RC_OK)
     {
-        case VDP_MODE_0:
-        case VDP_MODE_2:
-        case VDP_MODE_TMS_SMALL_SPRITES:
-        case VDP_MODE_TMS_LARGE_SPRITES:
-            rc = tms9928a_open_files ();
-            break;
-        case VDP_MODE_4:
-        case VDP_MODE_4_SPRITES:
-            rc = mode4_open_files ();
-            break;
-        default:
-            break;
+        switch (target)
+        {
+            case VDP_MODE_0:
+            case VDP_MODE_2:
+            case VDP_MODE_TMS_SMALL_SPRITES:
+            case VDP_MODE_TMS_LARGE_SPRITES:
+                rc = tms9928a_open_files ();
+                break;
+            case VDP_MODE_4:
+            case VDP_MODE_4_SPRITES:
+                rc = mode4_open_files ();
+                break;
+            default:
+                break;
+        }
+    }
+
+    /* Gather the sheets and their per-sheet settings */
+    sheets = calloc (argc, sizeof (sheet_t));
+    if (sheets == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for sheets.\n");
+        rc = RC_ERROR;
     }
 
     if (rc == RC_OK)
     {
+        sheet_t settings = { };
+
         for (uint32_t i = 0; i < argc; i++)
         {
             if (strcmp (argv [i], "--background") == 0)
             {
-                use_background_palette = true;
+                settings.background = true;
+            }
+            else if (strcmp (argv [i], "--compress") == 0)
+            {
+                if (global_dedupe)
+                {
+                    fprintf (stderr, "Error: --compress cannot be used with --global-dedupe.\n");
+                    rc = RC_ERROR;
+                    break;
+                }
+                settings.compress = true;
+            }
+            else if (strcmp (argv [i], "--bank-split") == 0)
+            {
+                settings.bank_split = true;
+            }
+            else if (strcmp (argv [i], "--max-patterns") == 0 && i + 1 < argc)
+            {
+                settings.max_patterns = strtoul (argv [++i], NULL, 0);
+                if (settings.max_patterns == 0 || (target != VDP_MODE_4 && target != VDP_MODE_4_SPRITES))
+                {
+                    fprintf (stderr, "Error: --max-patterns must be at least 1, and is only supported for mode-4.\n");
+                    rc = RC_ERROR;
+                    break;
+                }
             }
             else if (strcmp (argv [i], "--panels") == 0)
             {
                 unsigned int width, height, count;
                 sscanf (argv [++i], "%ux%u,%u", &width, &height, &count);
-                panel_width = width;
-                panel_height = height;
-                panel_count = count;
+                settings.panel_width = width;
+                settings.panel_height = height;
+                settings.panel_count = count;
+            }
+            else if (strcmp (argv [i], "--metasprite") == 0)
+            {
+                if (target != VDP_MODE_4 && target != VDP_MODE_4_SPRITES)
+                {
+                    fprintf (stderr, "Error: --metasprite is only supported for mode-4.\n");
+                    rc = RC_ERROR;
+                    break;
+                }
+                settings.metasprite = true;
             }
             else
             {
-                rc = sneptile_process_file (argv [i]);
-                if (rc != RC_OK)
+                settings.path = argv [i];
+
+                if (settings.metasprite && settings.panel_count == 0)
                 {
+                    fprintf (stderr, "Error: --metasprite requires --panels.\n");
+                    rc = RC_ERROR;
                     break;
                 }
 
+                /* Lossy reduction needs the whole image at once */
+                settings.stream = stream_sheets && settings.max_patterns == 0;
+                sheets [sheet_count++] = settings;
+
                 /* Restore per-image settings back to their defaults */
-                panel_count = 0;
-                use_background_palette = false;
+                memset (&settings, 0, sizeof (settings));
             }
         }
     }
 
+    if (rc == RC_OK)
+    {
+        rc = sneptile_process_sheets ();
+    }
+
     if (rc == RC_OK)
     {
         /* Finalize and close the output files */
@@ -461,5 +1528,22 @@ int main (int argc, char **argv)
         }
     }
 
+    /* On failure, leave the previous output files in place */
+    output_discard ();
+
     return rc == RC_OK ? EXIT_SUCCESS : EXIT_FAILURE;
 }
+
+
+/*
+ * Entry point.
+ */
+int main (int argc, char **argv)
+{
+    if (argc == 3 && strcmp (argv [1], "--manifest") == 0)
+    {
+        return manifest_run (argv [0], argv [2], sneptile_run);
+    }
+
+    return sneptile_run (argc, argv);
+}
@@ -0,0 +1,343 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ *
+ * A manifest describes groups of sheets, as an alternative to long command lines:
+ *
+ *   # Comment
+ *   set <NAME> <values...>          Define a variable, used as a value with $NAME
+ *   <option> [values...]            Before the first group, an option for every group
+ *   [<output-dir>]                  Start a group, written to <output-dir>
+ *   <option> [values...]            A global option for the group, such as sprite-palette
+ *   sheet <file.png> [options...]   A sheet, with per-sheet options such as background
+ *
+ * Options are written without their leading "--". Each group is converted as though
+ * it were its own command line, in a child process, as the conversion state is global.
+ */
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "sneptile.h"
+#include "manifest.h"
+
+/* A list of command-line arguments */
+typedef struct token_list_s {
+    char **tokens;
+    uint32_t count;
+    uint32_t capacity;
+} token_list_t;
+
+/* A variable, defined with "set" */
+typedef struct variable_s {
+    char *name;
+    token_list_t values;
+} variable_t;
+
+static variable_t *variables = NULL;
+static uint32_t variables_count = 0;
+
+
+/*
+ * Add a copy of a token to a list.
+ */
+static int manifest_add_token (token_list_t *list, const char *token)
+{
+    if (list->count == list->capacity)
+    {
+        uint32_t capacity = (list->capacity == 0) ? 32 : list->capacity * 2;
+        char **tokens = realloc (list->tokens, capacity * sizeof (char *));
+        if (tokens == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for manifest.\n");
+            return RC_ERROR;
+        }
+        list->tokens = tokens;
+        list->capacity = capacity;
+    }
+
+    list->tokens [list->count++] = strdup (token);
+
+    return RC_OK;
+}
+
+
+/*
+ * Add an option, adding the leading "--".
+ */
+static int manifest_add_option (token_list_t *list, const char *option)
+{
+    char *token = NULL;
+    asprintf (&token, "--%s", option);
+    int rc = manifest_add_token (list, token);
+    free (token);
+
+    return rc;
+}
+
+
+/*
+ * Add a value, expanding it if it refers to a variable.
+ */
+static int manifest_add_value (token_list_t *list, const char *value)
+{
+    if (value [0] != '$')
+    {
+        return manifest_add_token (list, value);
+    }
+
+    for (uint32_t i = 0; i < variables_count; i++)
+    {
+        if (strcmp (variables [i].name, value + 1) == 0)
+        {
+            for (uint32_t j = 0; j < variables [i].values.count; j++)
+            {
+                if (manifest_add_token (list, variables [i].values.tokens [j]) != RC_OK)
+                {
+                    return RC_ERROR;
+                }
+            }
+            return RC_OK;
+        }
+    }
+
+    fprintf (stderr, "Error: Undefined manifest variable %s.\n", value);
+    return RC_ERROR;
+}
+
+
+/*
+ * Free the tokens in a list.
+ */
+static void manifest_clear (token_list_t *list)
+{
+    for (uint32_t i = 0; i < list->count; i++)
+    {
+        free (list->tokens [i]);
+    }
+    list->count = 0;
+}
+
+
+/*
+ * Convert one group, in a child process.
+ */
+static int manifest_run_group (char *program, const char *output, token_list_t *common,
+                               token_list_t *options, token_list_t *sheets,
+                               int (*run) (int argc, char **argv))
+{
+    uint32_t argc = 3 + common->count + options->count + sheets->count;
+    char **argv = calloc (argc + 1, sizeof (char *));
+    if (argv == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for manifest.\n");
+        return RC_ERROR;
+    }
+
+    uint32_t arg = 0;
+    argv [arg++] = program;
+    argv [arg++] = "--output-dir";
+    argv [arg++] = (char *) output;
+    memcpy (&argv [arg], common->tokens, common->count * sizeof (char *));
+    arg += common->count;
+    memcpy (&argv [arg], options->tokens, options->count * sizeof (char *));
+    arg += options->count;
+    memcpy (&argv [arg], sheets->tokens, sheets->count * sizeof (char *));
+
+    /* Anything still buffered would otherwise be printed by both processes */
+    fflush (stdout);
+    fflush (stderr);
+
+    pid_t pid = fork ();
+    if (pid == 0)
+    {
+        /* Use _exit, as exit would also flush the parent's manifest
+         * file, moving the read position it shares with the parent */
+        int status = run (argc, argv);
+        fflush (stdout);
+        fflush (stderr);
+        _exit (status);
+    }
+    free (argv);
+
+    int status = 0;
+    if (pid < 0 || waitpid (pid, &status, 0) != pid)
+    {
+        fprintf (stderr, "Error: Failed to run group %s.\n", output);
+        return RC_ERROR;
+    }
+    if (!WIFEXITED (status) || WEXITSTATUS (status) != EXIT_SUCCESS)
+    {
+        fprintf (stderr, "Error: Failed to convert group %s.\n", output);
+        return RC_ERROR;
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Convert each group described by a manifest file, using the given command-line handler.
+ */
+int manifest_run (char *program, const char *path, int (*run) (int argc, char **argv))
+{
+    FILE *manifest_file = fopen (path, "r");
+    if (manifest_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return EXIT_FAILURE;
+    }
+
+    token_list_t common = { };
+    token_list_t options = { };
+    token_list_t sheets = { };
+    char *output = NULL;
+    char *line = NULL;
+    size_t line_size = 0;
+    uint32_t line_number = 0;
+    int rc = RC_OK;
+
+    while (rc == RC_OK)
+    {
+        bool end_of_file = (getline (&line, &line_size, manifest_file) < 0);
+        line_number++;
+
+        /* Split the line into words, dropping any comment */
+        char *comment = end_of_file ? NULL : strchr (line, '#');
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+
+        token_list_t words = { };
+        for (char *word = end_of_file ? NULL : strtok (line, " \t\r\n"); word != NULL; word = strtok (NULL, " \t\r\n"))
+        {
+            manifest_add_token (&words, word);
+        }
+
+        /* A new group, or the end of the file, completes the current group */
+        if ((end_of_file || (words.count > 0 && words.tokens [0] [0] == '[')) && output != NULL)
+        {
+            if (sheets.count == 0)
+            {
+                fprintf (stderr, "Error: No sheets in group %s.\n", output);
+                rc = RC_ERROR;
+            }
+            else
+            {
+                rc = manifest_run_group (program, output, &common, &options, &sheets, run);
+            }
+            manifest_clear (&options);
+            manifest_clear (&sheets);
+            free (output);
+            output = NULL;
+        }
+
+        if (rc != RC_OK || end_of_file)
+        {
+            manifest_clear (&words);
+            free (words.tokens);
+            break;
+        }
+
+        if (words.count == 0)
+        {
+            /* Blank line */
+        }
+        else if (words.tokens [0] [0] == '[')
+        {
+            char *end = strchr (words.tokens [0], ']');
+            if (words.count > 1 || end == NULL || end [1] != '\0' || end == words.tokens [0] + 1)
+            {
+                fprintf (stderr, "Error: %s:%u: Expected [<output-dir>].\n", path, line_number);
+                rc = RC_ERROR;
+            }
+            else
+            {
+                *end = '\0';
+                output = strdup (words.tokens [0] + 1);
+            }
+        }
+        else if (strcmp (words.tokens [0], "set") == 0)
+        {
+            variable_t *list = (words.count < 2) ? NULL : realloc (variables, (variables_count + 1) * sizeof (variable_t));
+            if (words.count < 2 || list == NULL)
+            {
+                fprintf (stderr, "Error: %s:%u: Expected set <NAME> <values...>.\n", path, line_number);
+                rc = RC_ERROR;
+            }
+            else
+            {
+                variables = list;
+                variables [variables_count].name = strdup (words.tokens [1]);
+                variables [variables_count].values = (token_list_t) { };
+                for (uint32_t i = 2; i < words.count && rc == RC_OK; i++)
+                {
+                    rc = manifest_add_value (&variables [variables_count].values, words.tokens [i]);
+                }
+                variables_count++;
+            }
+        }
+        else if (strcmp (words.tokens [0], "sheet") == 0)
+        {
+            /* Per-sheet options come before the sheet on the command line */
+            if (output == NULL || words.count < 2)
+            {
+                fprintf (stderr, "Error: %s:%u: Expected sheet <file.png> [options...] within a group.\n", path, line_number);
+                rc = RC_ERROR;
+            }
+            for (uint32_t i = 2; i < words.count && rc == RC_OK; i++)
+            {
+                rc = manifest_add_option (&sheets, words.tokens [i]);
+                if (rc == RC_OK && i + 1 < words.count &&
+                    (strcmp (words.tokens [i], "panels") == 0 || strcmp (words.tokens [i], "max-patterns") == 0))
+                {
+                    rc = manifest_add_value (&sheets, words.tokens [++i]);
+                }
+            }
+            if (rc == RC_OK)
+            {
+                rc = manifest_add_value (&sheets, words.tokens [1]);
+            }
+        }
+        else
+        {
+            /* Global options must come before the first sheet on the command line */
+            token_list_t *list = (output == NULL) ? &common : &options;
+            if (sheets.count > 0)
+            {
+                fprintf (stderr, "Error: %s:%u: Group options must come before the sheets.\n", path, line_number);
+                rc = RC_ERROR;
+            }
+            else
+            {
+                rc = manifest_add_option (list, words.tokens [0]);
+            }
+            for (uint32_t i = 1; i < words.count && rc == RC_OK; i++)
+            {
+                rc = manifest_add_value (list, words.tokens [i]);
+            }
+        }
+
+        manifest_clear (&words);
+        free (words.tokens);
+    }
+
+    fclose (manifest_file);
+    free (line);
+    free (output);
+    manifest_clear (&common);
+    manifest_clear (&options);
+    manifest_clear (&sheets);
+    free (common.tokens);
+    free (options.tokens);
+    free (sheets.tokens);
+
+    return (rc == RC_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
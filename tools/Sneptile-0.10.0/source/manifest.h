@@ -0,0 +1,7 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ */
+
+/* Convert each group described by a manifest file, using the given command-line handler. */
+int manifest_run (char *program, const char *path, int (*run) (int argc, char **argv));
@@ -0,0 +1,466 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ *
+ * Output files are written to a temporary file next to their final path.
+ * When closed, the temporary file only replaces the final path if the
+ * contents differ, so that unchanged outputs keep their timestamps.
+ *
+ * The output of a sheet can also be captured, to be stored in the cache
+ * and written again later without converting the sheet.
+ */
+
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sneptile.h"
+#include "output.h"
+
+/* Open output files */
+typedef struct output_file_s {
+    FILE *file;
+    char *name;
+    char *path;         /* NULL for temporary outputs */
+    char *temp_path;
+    long capture_start; /* Offset when the capture started, or -1 if opened during the capture */
+} output_file_t;
+
+static output_file_t *outputs = NULL;
+static uint32_t outputs_count = 0;
+static uint32_t outputs_capacity = 0;
+
+/* Capture */
+static bool capturing = false;
+static output_capture_t capture_state = { };
+
+
+/*
+ * Add a section to the capture, taking ownership of the data.
+ */
+static int output_capture_add (output_kind_t kind, const char *name, uint8_t *data, uint32_t size)
+{
+    output_section_t *sections = realloc (capture_state.sections, (capture_state.count + 1) * sizeof (output_section_t));
+    if (sections == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for output capture.\n");
+        free (data);
+        return RC_ERROR;
+    }
+
+    capture_state.sections = sections;
+    capture_state.sections [capture_state.count].kind = kind;
+    capture_state.sections [capture_state.count].name = (name != NULL) ? strdup (name) : NULL;
+    capture_state.sections [capture_state.count].data = data;
+    capture_state.sections [capture_state.count].size = size;
+    capture_state.count++;
+
+    return RC_OK;
+}
+
+
+/*
+ * Read part of an open output file, leaving the position at the end.
+ */
+static uint8_t *output_read (FILE *file, long start, uint32_t *size)
+{
+    fflush (file);
+    long end = ftell (file);
+    uint8_t *data = malloc ((end > start) ? end - start : 1);
+
+    *size = 0;
+    if (data != NULL)
+    {
+        fseek (file, start, SEEK_SET);
+        *size = fread (data, 1, end - start, file);
+    }
+    fseek (file, 0, SEEK_END);
+
+    return data;
+}
+
+
+/*
+ * Check if a file on disk has the same contents as the open output file.
+ */
+static bool output_unchanged (FILE *file, const char *path)
+{
+    FILE *previous = fopen (path, "rb");
+    bool unchanged = true;
+
+    if (previous == NULL)
+    {
+        return false;
+    }
+
+    fflush (file);
+    rewind (file);
+
+    while (unchanged)
+    {
+        uint8_t new_data [4096];
+        uint8_t old_data [4096];
+        size_t new_size = fread (new_data, 1, sizeof (new_data), file);
+        size_t old_size = fread (old_data, 1, sizeof (old_data), previous);
+
+        if (new_size != old_size || memcmp (new_data, old_data, new_size) != 0)
+        {
+            unchanged = false;
+        }
+        else if (new_size == 0)
+        {
+            break;
+        }
+    }
+
+    fclose (previous);
+    return unchanged;
+}
+
+
+/*
+ * Find an open output file, by its FILE or by name.
+ */
+static output_file_t *output_find (FILE *file, const char *name)
+{
+    for (uint32_t i = 0; i < outputs_count; i++)
+    {
+        if ((file != NULL && outputs [i].file == file) ||
+            (name != NULL && strcmp (outputs [i].name, name) == 0))
+        {
+            return &outputs [i];
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+ * Remove an output file from the list of open files.
+ */
+static void output_remove (output_file_t *output)
+{
+    free (output->name);
+    free (output->path);
+    free (output->temp_path);
+    *output = outputs [--outputs_count];
+}
+
+
+/*
+ * Add an entry to the list of open output files.
+ */
+static output_file_t *output_add (void)
+{
+    if (outputs_count == outputs_capacity)
+    {
+        uint32_t capacity = (outputs_capacity == 0) ? 8 : outputs_capacity * 2;
+        output_file_t *list = realloc (outputs, capacity * sizeof (output_file_t));
+        if (list == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for output files.\n");
+            return NULL;
+        }
+        outputs = list;
+        outputs_capacity = capacity;
+    }
+
+    return &outputs [outputs_count];
+}
+
+
+/*
+ * Open an output file within the output directory.
+ */
+FILE *output_open (const char *name)
+{
+    output_file_t *output = output_add ();
+    if (output == NULL)
+    {
+        return NULL;
+    }
+
+    if (output_dir != NULL)
+    {
+        asprintf (&output->path, "%s/%s", output_dir, name);
+    }
+    else
+    {
+        output->path = strdup (name);
+    }
+    asprintf (&output->temp_path, "%s.tmp", output->path);
+
+    output->file = fopen (output->temp_path, "w+b");
+    if (output->file == NULL)
+    {
+        fprintf (stderr, "Unable to open output file %s\n", output->path);
+        free (output->path);
+        free (output->temp_path);
+        return NULL;
+    }
+    output->name = strdup (name);
+    output->capture_start = capturing ? -1 : 0;
+    outputs_count++;
+
+    return output->file;
+}
+
+
+/*
+ * Open a temporary output, which is captured but never written to disk.
+ * This allows data to be gathered across sheets, and read back once all
+ * of the sheets have been converted.
+ */
+FILE *output_open_temporary (const char *name)
+{
+    output_file_t *output = output_add ();
+    if (output == NULL)
+    {
+        return NULL;
+    }
+
+    output->file = tmpfile ();
+    if (output->file == NULL)
+    {
+        fprintf (stderr, "Unable to open temporary file for %s\n", name);
+        return NULL;
+    }
+    output->path = NULL;
+    output->temp_path = NULL;
+    output->name = strdup (name);
+    output->capture_start = capturing ? -1 : 0;
+    outputs_count++;
+
+    return output->file;
+}
+
+
+/*
+ * Close an output file, replacing the previous file only if the contents have changed.
+ */
+int output_close (FILE *file)
+{
+    output_file_t *output = output_find (file, NULL);
+    int rc = RC_OK;
+
+    if (output == NULL)
+    {
+        return RC_ERROR;
+    }
+
+    /* Files opened during the capture are captured whole */
+    if (capturing)
+    {
+        bool whole = (output->capture_start == -1);
+        uint32_t size;
+        uint8_t *data = output_read (file, whole ? 0 : output->capture_start, &size);
+        if (data == NULL ||
+            output_capture_add (whole ? OUTPUT_FILE : OUTPUT_APPEND, output->name, data, size) != RC_OK)
+        {
+            rc = RC_ERROR;
+        }
+    }
+
+    if (output->path == NULL)
+    {
+        fclose (file);
+    }
+    else if (output_unchanged (file, output->path))
+    {
+        fclose (file);
+        remove (output->temp_path);
+    }
+    else
+    {
+        fclose (file);
+        if (rename (output->temp_path, output->path) != 0)
+        {
+            fprintf (stderr, "Error: Unable to replace output file %s\n", output->path);
+            rc = RC_ERROR;
+        }
+    }
+
+    output_remove (output);
+    return rc;
+}
+
+
+/*
+ * Discard any output files that are still open, leaving the previous files in place.
+ */
+void output_discard (void)
+{
+    while (outputs_count > 0)
+    {
+        fclose (outputs [0].file);
+        if (outputs [0].temp_path != NULL)
+        {
+            remove (outputs [0].temp_path);
+        }
+        output_remove (&outputs [0]);
+    }
+}
+
+
+/*
+ * Print a report to stdout, including it in the capture.
+ */
+void output_report (const char *format, ...)
+{
+    char *report = NULL;
+    va_list args;
+
+    va_start (args, format);
+    int length = vasprintf (&report, format, args);
+    va_end (args);
+
+    if (length < 0)
+    {
+        return;
+    }
+
+    fputs (report, stdout);
+
+    if (capturing)
+    {
+        output_capture_add (OUTPUT_REPORT, NULL, (uint8_t *) report, length);
+    }
+    else
+    {
+        free (report);
+    }
+}
+
+
+/*
+ * Start capturing everything written to the output files.
+ */
+void output_capture_start (void)
+{
+    for (uint32_t i = 0; i < outputs_count; i++)
+    {
+        fflush (outputs [i].file);
+        outputs [i].capture_start = ftell (outputs [i].file);
+    }
+
+    capture_state.sections = NULL;
+    capture_state.count = 0;
+    capturing = true;
+}
+
+
+/*
+ * Stop capturing, and return what was written.
+ * Fails if a file opened during the capture is still open,
+ * as it could not be written again on its own.
+ */
+int output_capture_end (output_capture_t *capture)
+{
+    int rc = RC_OK;
+
+    for (uint32_t i = 0; i < outputs_count && rc == RC_OK; i++)
+    {
+        if (outputs [i].capture_start == -1)
+        {
+            rc = RC_ERROR;
+            break;
+        }
+
+        uint32_t size;
+        uint8_t *data = output_read (outputs [i].file, outputs [i].capture_start, &size);
+        if (data == NULL)
+        {
+            rc = RC_ERROR;
+        }
+        else if (size == 0)
+        {
+            free (data);
+        }
+        else
+        {
+            rc = output_capture_add (OUTPUT_APPEND, outputs [i].name, data, size);
+        }
+    }
+
+    capturing = false;
+    *capture = capture_state;
+    capture_state.sections = NULL;
+    capture_state.count = 0;
+
+    if (rc != RC_OK)
+    {
+        output_capture_free (capture);
+    }
+
+    return rc;
+}
+
+
+/*
+ * Write captured output again.
+ */
+int output_replay (const output_capture_t *capture)
+{
+    for (uint32_t i = 0; i < capture->count; i++)
+    {
+        const output_section_t *section = &capture->sections [i];
+        output_file_t *output;
+        FILE *file;
+
+        switch (section->kind)
+        {
+            case OUTPUT_APPEND:
+                output = output_find (NULL, section->name);
+                if (output == NULL)
+                {
+                    fprintf (stderr, "Error: Cached output for %s, which is not open.\n", section->name);
+                    return RC_ERROR;
+                }
+                fwrite (section->data, 1, section->size, output->file);
+                break;
+
+            case OUTPUT_FILE:
+                file = output_open (section->name);
+                if (file == NULL)
+                {
+                    return RC_ERROR;
+                }
+                fwrite (section->data, 1, section->size, file);
+                if (output_close (file) != RC_OK)
+                {
+                    return RC_ERROR;
+                }
+                break;
+
+            case OUTPUT_REPORT:
+                fwrite (section->data, 1, section->size, stdout);
+                break;
+
+            default:
+                return RC_ERROR;
+        }
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Free captured output.
+ */
+void output_capture_free (output_capture_t *capture)
+{
+    for (uint32_t i = 0; i < capture->count; i++)
+    {
+        free (capture->sections [i].name);
+        free (capture->sections [i].data);
+    }
+    free (capture->sections);
+    capture->sections = NULL;
+    capture->count = 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ */
+
+/* Kinds of captured output */
+typedef enum output_kind_e {
+    OUTPUT_APPEND = 0,  /* Data appended to a file that was already open */
+    OUTPUT_FILE,        /* The whole of a file opened and closed during the capture */
+    OUTPUT_REPORT       /* A line printed to stdout */
+} output_kind_t;
+
+typedef struct output_section_s {
+    output_kind_t kind;
+    char *name;
+    uint8_t *data;
+    uint32_t size;
+} output_section_t;
+
+typedef struct output_capture_s {
+    output_section_t *sections;
+    uint32_t count;
+} output_capture_t;
+
+/* Open an output file within the output directory. */
+FILE *output_open (const char *name);
+
+/* Open a temporary output, which is captured but never written to disk. */
+FILE *output_open_temporary (const char *name);
+
+/* Close an output file, replacing the previous file only if the contents have changed. */
+int output_close (FILE *file);
+
+/* Discard any output files that are still open, leaving the previous files in place. */
+void output_discard (void);
+
+/* Print a report to stdout, including it in the capture. */
+void output_report (const char *format, ...);
+
+/* Start capturing everything written to the output files. */
+void output_capture_start (void);
+
+/* Stop capturing, and return what was written. */
+int output_capture_end (output_capture_t *capture);
+
+/* Write captured output again. */
+int output_replay (const output_capture_t *capture);
+
+/* Free captured output. */
+void output_capture_free (output_capture_t *capture);
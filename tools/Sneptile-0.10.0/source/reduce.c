@@ -0,0 +1,483 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ *
+ * Lossy reduction, to fit a sheet into a fixed number of patterns.
+ *
+ * Tiles are compared after conversion to Master System colour, with each pixel
+ * as four levels of red, green, and blue. The distance between two tiles is the
+ * sum over their pixels of 2·Δr² + 4·Δg² + 3·Δb², as the eye is most sensitive
+ * to green and least to red. A transparent pixel differs from any visible pixel
+ * by at least as much as black differs from white.
+ *
+ * Each distinct tile starts as its own cluster. In each round, the nearest
+ * neighbour of every cluster is found, and the cheapest merges are made, where
+ * the cost is the distance multiplied by the number of tiles that would change.
+ * A merged cluster keeps the tile of whichever side is used more often, so the
+ * result only uses colours that were already in the sheet.
+ *
+ * Rather than comparing all pairs, clusters are sorted by a weighted sum of their
+ * pixel levels. The difference in this sum gives a lower bound on the distance,
+ * so the search for a nearest neighbour can stop once the bound exceeds the
+ * nearest found so far.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sneptile.h"
+#include "reduce.h"
+
+/* Channel weights, and the level used for visible pixels in the alpha channel */
+#define WEIGHT_R        2
+#define WEIGHT_G        4
+#define WEIGHT_B        3
+#define ALPHA_LEVEL     9
+
+/* The distance for a pixel moving one level in each of red, green, and blue.
+ * Errors are reported in these units, so black to white is an error of 3. */
+#define LEVEL_STEP      (WEIGHT_R + WEIGHT_G + WEIGHT_B)
+
+/* A tile within the sheet, for finding the distinct tiles */
+typedef struct reduce_position_s {
+    uint64_t digest;
+    const pixel_t *pixels;
+    uint32_t position;
+} reduce_position_t;
+
+/* A distinct tile */
+typedef struct reduce_tile_s {
+    const pixel_t *pixels;
+    int8_t levels [64] [4];     /* Red, green, blue, and alpha levels */
+    double key;                 /* Weighted sum of the levels, for sorting */
+    uint32_t first;             /* Position of the first use in the sheet */
+    uint32_t weight;            /* Number of tiles in the sheet using this cluster */
+    int32_t merged_into;        /* Cluster this tile was merged into, or -1 */
+    uint32_t round;             /* Last round this cluster took part in a merge */
+} reduce_tile_t;
+
+/* A possible merge of two clusters */
+typedef struct reduce_merge_s {
+    uint64_t cost;
+    uint32_t a;
+    uint32_t b;
+} reduce_merge_t;
+
+/* Working state for reducing a sheet */
+typedef struct reduce_state_s {
+    pixel_t *image;
+    uint32_t width;
+    uint32_t columns;
+    uint32_t tiles_total;
+    uint32_t tiles_count;
+    pixel_t (*copies) [64];         /* Contiguous copy of each tile in the sheet */
+    reduce_position_t *positions;
+    uint32_t *position_tile;        /* Distinct tile used at each position */
+    reduce_tile_t *tiles;
+    reduce_tile_t **sorted;
+    reduce_merge_t *merges;
+} reduce_state_t;
+
+
+/*
+ * Calculate a 64-bit digest of a tile's pixels (FNV-1a).
+ */
+static uint64_t reduce_digest (const pixel_t *pixels)
+{
+    const uint8_t *bytes = (const uint8_t *) pixels;
+    uint64_t digest = 0xcbf29ce484222325;
+
+    for (uint32_t i = 0; i < sizeof (pixel_t) * 64; i++)
+    {
+        digest ^= bytes [i];
+        digest *= 0x100000001b3;
+    }
+
+    return digest;
+}
+
+
+/*
+ * Order tiles by their pixels, then by position.
+ */
+static int reduce_position_compare (const void *p1, const void *p2)
+{
+    const reduce_position_t *a = p1;
+    const reduce_position_t *b = p2;
+
+    if (a->digest != b->digest)
+    {
+        return (a->digest < b->digest) ? -1 : 1;
+    }
+
+    int pixels = memcmp (a->pixels, b->pixels, sizeof (pixel_t) * 64);
+    if (pixels != 0)
+    {
+        return pixels;
+    }
+
+    return (a->position < b->position) ? -1 : (a->position > b->position);
+}
+
+
+/*
+ * Order merges by cost, cheapest first.
+ */
+static int reduce_merge_compare (const void *p1, const void *p2)
+{
+    const reduce_merge_t *a = p1;
+    const reduce_merge_t *b = p2;
+
+    if (a->cost != b->cost)
+    {
+        return (a->cost < b->cost) ? -1 : 1;
+    }
+
+    return (a->a < b->a) ? -1 : (a->a > b->a);
+}
+
+
+/*
+ * Order clusters by key.
+ */
+static int reduce_key_compare (const void *p1, const void *p2)
+{
+    const reduce_tile_t *a = *(reduce_tile_t * const *) p1;
+    const reduce_tile_t *b = *(reduce_tile_t * const *) p2;
+
+    if (a->key != b->key)
+    {
+        return (a->key < b->key) ? -1 : 1;
+    }
+
+    return (a->first < b->first) ? -1 : (a->first > b->first);
+}
+
+
+/*
+ * Convert a tile's pixels to Master System colour levels.
+ */
+static void reduce_tile_levels (reduce_tile_t *tile)
+{
+    tile->key = 0.0;
+
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        pixel_t p = tile->pixels [i];
+
+        if (!(p & PIXEL_OPAQUE))
+        {
+            memset (tile->levels [i], 0, 4);
+            continue;
+        }
+
+        tile->levels [i] [0] = p & 0x03;
+        tile->levels [i] [1] = (p >> 2) & 0x03;
+        tile->levels [i] [2] = (p >> 4) & 0x03;
+        tile->levels [i] [3] = ALPHA_LEVEL;
+
+        tile->key += sqrt (WEIGHT_R) * tile->levels [i] [0]
+                   + sqrt (WEIGHT_G) * tile->levels [i] [1]
+                   + sqrt (WEIGHT_B) * tile->levels [i] [2]
+                   + ALPHA_LEVEL;
+    }
+}
+
+
+/*
+ * Calculate the distance between two tiles.
+ * Stops early once the distance reaches the limit.
+ */
+static uint32_t reduce_distance (const reduce_tile_t *a, const reduce_tile_t *b, uint32_t limit)
+{
+    uint32_t distance = 0;
+
+    for (uint32_t row = 0; row < 8 && distance < limit; row++)
+    {
+        for (uint32_t i = row * 8; i < row * 8 + 8; i++)
+        {
+            int32_t r = a->levels [i] [0] - b->levels [i] [0];
+            int32_t g = a->levels [i] [1] - b->levels [i] [1];
+            int32_t b_ = a->levels [i] [2] - b->levels [i] [2];
+            int32_t alpha = a->levels [i] [3] - b->levels [i] [3];
+
+            distance += WEIGHT_R * r * r + WEIGHT_G * g * g + WEIGHT_B * b_ * b_ + alpha * alpha;
+        }
+    }
+
+    return distance;
+}
+
+
+/*
+ * Find the nearest neighbour of the cluster at position index of the sorted list.
+ * By Cauchy-Schwarz, over the 64 pixels and four channels, the squared difference
+ * in keys is at most 256 times the distance.
+ */
+static uint32_t reduce_nearest (reduce_tile_t **sorted, uint32_t count, uint32_t index, uint32_t *distance)
+{
+    const reduce_tile_t *tile = sorted [index];
+    uint32_t best = UINT32_MAX;
+    uint32_t best_index = index;
+    bool left_done = (index == 0);
+    bool right_done = (index + 1 >= count);
+
+    for (uint32_t step = 1; !left_done || !right_done; step++)
+    {
+        for (uint32_t side = 0; side < 2; side++)
+        {
+            bool *done = (side == 0) ? &left_done : &right_done;
+            if (*done)
+            {
+                continue;
+            }
+
+            uint32_t other = (side == 0) ? index - step : index + step;
+            double delta = sorted [other]->key - tile->key;
+
+            if (delta * delta >= 256.0 * best)
+            {
+                *done = true;
+                continue;
+            }
+
+            uint32_t d = reduce_distance (tile, sorted [other], best);
+            if (d < best)
+            {
+                best = d;
+                best_index = other;
+            }
+
+            if ((side == 0 && other == 0) || (side == 1 && other + 1 == count))
+            {
+                *done = true;
+            }
+        }
+    }
+
+    *distance = best;
+    return best_index;
+}
+
+
+/*
+ * Find the cluster a tile ended up in.
+ */
+static uint32_t reduce_find (reduce_tile_t *tiles, uint32_t tile)
+{
+    while (tiles [tile].merged_into != -1)
+    {
+        tile = tiles [tile].merged_into;
+    }
+
+    return tile;
+}
+
+
+/*
+ * Find the distinct tiles in the sheet.
+ */
+static void reduce_find_tiles (reduce_state_t *state)
+{
+    for (uint32_t position = 0; position < state->tiles_total; position++)
+    {
+        const pixel_t *tile = &state->image [(position / state->columns) * 8 * state->width + (position % state->columns) * 8];
+
+        for (uint32_t row = 0; row < 8; row++)
+        {
+            memcpy (&state->copies [position] [row * 8], &tile [row * state->width], sizeof (pixel_t) * 8);
+        }
+        state->positions [position].digest = reduce_digest (state->copies [position]);
+        state->positions [position].pixels = state->copies [position];
+        state->positions [position].position = position;
+    }
+    qsort (state->positions, state->tiles_total, sizeof (reduce_position_t), reduce_position_compare);
+
+    /* Equal tiles are now together, with the first use leading */
+    state->tiles_count = 0;
+    for (uint32_t i = 0; i < state->tiles_total; i++)
+    {
+        const reduce_position_t *position = &state->positions [i];
+
+        if (i == 0 || position [-1].digest != position->digest ||
+            memcmp (position [-1].pixels, position->pixels, sizeof (pixel_t) * 64) != 0)
+        {
+            reduce_tile_t *tile = &state->tiles [state->tiles_count++];
+            tile->pixels = position->pixels;
+            tile->first = position->position;
+            tile->merged_into = -1;
+            reduce_tile_levels (tile);
+        }
+        state->tiles [state->tiles_count - 1].weight++;
+        state->position_tile [position->position] = state->tiles_count - 1;
+    }
+}
+
+
+/*
+ * Make one round of merges, returning the new number of clusters.
+ */
+static uint32_t reduce_merge_round (reduce_state_t *state, uint32_t active, uint32_t max_patterns, uint32_t round)
+{
+    reduce_tile_t *tiles = state->tiles;
+    reduce_merge_t *merges = state->merges;
+    uint32_t sorted_count = 0;
+
+    for (uint32_t i = 0; i < state->tiles_count; i++)
+    {
+        if (tiles [i].merged_into == -1)
+        {
+            state->sorted [sorted_count++] = &tiles [i];
+        }
+    }
+    qsort (state->sorted, sorted_count, sizeof (reduce_tile_t *), reduce_key_compare);
+
+    for (uint32_t i = 0; i < sorted_count; i++)
+    {
+        uint32_t distance;
+        uint32_t nearest = reduce_nearest (state->sorted, sorted_count, i, &distance);
+        uint32_t weight_a = state->sorted [i]->weight;
+        uint32_t weight_b = state->sorted [nearest]->weight;
+
+        merges [i].cost = (uint64_t) distance * ((weight_a < weight_b) ? weight_a : weight_b);
+        merges [i].a = state->sorted [i] - tiles;
+        merges [i].b = state->sorted [nearest] - tiles;
+    }
+    qsort (merges, sorted_count, sizeof (reduce_merge_t), reduce_merge_compare);
+
+    /* Take the cheapest merges that don't share a cluster, up to half of the
+     * remaining excess, so that costs are re-evaluated as clusters grow */
+    uint32_t limit = (active - max_patterns + 1) / 2;
+    for (uint32_t i = 0; i < sorted_count && limit > 0; i++)
+    {
+        reduce_tile_t *a = &tiles [merges [i].a];
+        reduce_tile_t *b = &tiles [merges [i].b];
+
+        if (a == b || a->round == round || b->round == round)
+        {
+            continue;
+        }
+
+        /* The more widely used tile is kept */
+        if (b->weight < a->weight || (b->weight == a->weight && b->first > a->first))
+        {
+            reduce_tile_t *swap = a;
+            a = b;
+            b = swap;
+        }
+        a->merged_into = b - tiles;
+        b->weight += a->weight;
+        a->round = round;
+        b->round = round;
+        active--;
+        limit--;
+    }
+
+    return active;
+}
+
+
+/*
+ * Replace the merged tiles in the image, measuring the error.
+ */
+static void reduce_replace_tiles (reduce_state_t *state, reduce_result_t *result)
+{
+    double error_total = 0.0;
+
+    for (uint32_t position = 0; position < state->tiles_total; position++)
+    {
+        uint32_t tile = state->position_tile [position];
+        uint32_t cluster = reduce_find (state->tiles, tile);
+
+        if (cluster == tile)
+        {
+            continue;
+        }
+
+        pixel_t *destination = &state->image [(position / state->columns) * 8 * state->width + (position % state->columns) * 8];
+        for (uint32_t row = 0; row < 8; row++)
+        {
+            memcpy (&destination [row * state->width], &state->tiles [cluster].pixels [row * 8], sizeof (pixel_t) * 8);
+        }
+
+        /* Root-mean-square over the pixels of the tile */
+        uint32_t distance = reduce_distance (&state->tiles [tile], &state->tiles [cluster], UINT32_MAX);
+        double error = sqrt ((double) distance / (64 * LEVEL_STEP));
+        error_total += error;
+        if (error > result->error_worst)
+        {
+            result->error_worst = error;
+        }
+        result->tiles_changed++;
+    }
+
+    if (result->tiles_changed > 0)
+    {
+        result->error_mean = error_total / result->tiles_changed;
+    }
+}
+
+
+/*
+ * Merge similar tiles in an image until it has at most max_patterns distinct tiles.
+ * Replaced tiles are overwritten in the image with the tile they were merged into.
+ */
+int reduce_tiles (pixel_t *image, uint32_t width, uint32_t height, uint32_t max_patterns, reduce_result_t *result)
+{
+    reduce_state_t state = { };
+    int rc = RC_OK;
+
+    state.image = image;
+    state.width = width;
+    state.columns = width / 8;
+    state.tiles_total = state.columns * (height / 8);
+
+    memset (result, 0, sizeof (reduce_result_t));
+    result->tiles_total = state.tiles_total;
+
+    if (state.tiles_total == 0)
+    {
+        return RC_OK;
+    }
+
+    state.copies = calloc (state.tiles_total, sizeof (pixel_t) * 64);
+    state.positions = calloc (state.tiles_total, sizeof (reduce_position_t));
+    state.position_tile = calloc (state.tiles_total, sizeof (uint32_t));
+    state.tiles = calloc (state.tiles_total, sizeof (reduce_tile_t));
+    state.sorted = calloc (state.tiles_total, sizeof (reduce_tile_t *));
+    state.merges = calloc (state.tiles_total, sizeof (reduce_merge_t));
+
+    if (state.copies == NULL || state.positions == NULL || state.position_tile == NULL ||
+        state.tiles == NULL || state.sorted == NULL || state.merges == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for tile reduction.\n");
+        rc = RC_ERROR;
+    }
+    else
+    {
+        reduce_find_tiles (&state);
+
+        uint32_t active = state.tiles_count;
+        for (uint32_t round = 1; active > max_patterns; round++)
+        {
+            active = reduce_merge_round (&state, active, max_patterns, round);
+        }
+
+        result->tiles_before = state.tiles_count;
+        result->tiles_after = active;
+        reduce_replace_tiles (&state, result);
+    }
+
+    free (state.copies);
+    free (state.positions);
+    free (state.position_tile);
+    free (state.tiles);
+    free (state.sorted);
+    free (state.merges);
+
+    return rc;
+}
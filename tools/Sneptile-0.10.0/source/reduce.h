@@ -0,0 +1,17 @@
+/*
+ * Sneptile
+ * Joppy Furr 2024
+ */
+
+/* Results of reducing a sheet */
+typedef struct reduce_result_s {
+    uint32_t tiles_before;      /* Distinct tiles in the sheet */
+    uint32_t tiles_after;       /* Distinct tiles after merging */
+    uint32_t tiles_changed;     /* Tiles in the sheet replaced by a similar tile */
+    uint32_t tiles_total;       /* Tiles in the sheet */
+    double error_mean;          /* Mean error of the replaced tiles */
+    double error_worst;         /* Worst error of a replaced tile */
+} reduce_result_t;
+
+/* Merge similar tiles in an image until it has at most max_patterns distinct tiles. */
+int reduce_tiles (pixel_t *image, uint32_t width, uint32_t height, uint32_t max_patterns, reduce_result_t *result);
@@ -13,9 +13,35 @@
 
 #include "sneptile.h"
 #include "sms_vdp.h"
+#include "compress.h"
+#include "output.h"
 
 /* State */
 static uint32_t pattern_index = 0;
+static bool first_input_file = true;
+static char *pattern_array_name = NULL;
+
+/* Compression (--compress) and banks (--bank-size). Patterns for the current file
+ * are gathered, and compressed or placed into a bank at the end of the file. */
+static bool compress_current = false;
+static bool bank_split_current = false;
+static uint8_t *pattern_buffer = NULL;
+
+/* Banks (--bank-size). Each file's finished pattern array is recorded in the
+ * staging file, and the arrays are placed into banks after the last file. */
+#define BANK_ARRAY_BYTES    0x01    /* A uint8_t array, rather than uint32_t */
+#define BANK_ARRAY_SPLIT    0x02    /* May be split between banks */
+
+typedef struct mode4_bank_s {
+    uint32_t number;
+    uint32_t used;
+    FILE *data_file;
+    FILE *header_file;
+} mode4_bank_t;
+
+static FILE *bank_staging_file = NULL;
+static mode4_bank_t *banks = NULL;
+static uint32_t bank_count = 0;
 
 /* Palettes */
 static uint8_t background_palette [16] = { };
@@ -23,46 +49,477 @@ static uint32_t background_palette_size = 0;
 static uint8_t sprite_palette [16] = { };
 static uint32_t sprite_palette_size = 0;
 
+/* Reverse lookup from 6-bit colour to the lowest palette index
+ * above zero holding it, plus one. Zero if the colour is absent.
+ * Index zero is checked separately, as sprites don't use it. */
+static uint8_t background_lookup [64] = { };
+static uint8_t sprite_lookup [64] = { };
+
+/* Each 4-bit colour index spread across the four bitplanes, as the
+ * leftmost pixel of a row. Plane n is held in byte n of the word. */
+static const uint32_t bitplane_spread [16] = {
+    0x00000000, 0x00000080, 0x00008000, 0x00008080,
+    0x00800000, 0x00800080, 0x00808000, 0x00808080,
+    0x80000000, 0x80000080, 0x80008000, 0x80008080,
+    0x80800000, 0x80800080, 0x80808000, 0x80808080
+};
+
 /* Mode-4 Output Files */
 static FILE *pattern_file = NULL;
 static FILE *pattern_index_file = NULL;
 static FILE *palette_file = NULL;
 
+/* Mode-4 Binary Output Files (--binary) */
+static FILE *binary_header_file = NULL;
+
 
 /*
- * Open the three output files.
+ * Open a binary output file, <name>.bin.
  */
-int mode4_open_files (void)
+static FILE *mode4_binary_open (const char *name)
 {
-    char *patterns_path = "patterns.h";
-    char *pattern_index_path = "pattern_index.h";
-    char *palette_path = "palette.h";
+    char *file_name = NULL;
+
+    asprintf (&file_name, "%s.bin", name);
+    FILE *file = output_open (file_name);
+    free (file_name);
+
+    return file;
+}
 
-    /* If the user has specified an output
-     * directory, create and change into it */
-    if (output_dir != NULL)
+
+/*
+ * Write an array name in upper case, for use in a #define.
+ */
+static void mode4_write_define_name (FILE *file, const char *name)
+{
+    for (const char *c = name; *c != '\0'; c++)
     {
-        asprintf (&patterns_path, "%s/%s", output_dir, patterns_path);
-        asprintf (&pattern_index_path, "%s/%s", output_dir, pattern_index_path);
-        asprintf (&palette_path, "%s/%s", output_dir, palette_path);
+        fprintf (file, "%c", isalnum (*c) ? toupper (*c) : '_');
     }
+}
 
-    /* Pattern file */
-    pattern_file = fopen (patterns_path, "w");
-    if (pattern_file == NULL)
+
+/*
+ * Record the size of a binary output file in the header.
+ */
+static void mode4_binary_size (const char *name, uint32_t bytes)
+{
+    fprintf (binary_header_file, "#define ");
+    mode4_write_define_name (binary_header_file, name);
+    fprintf (binary_header_file, "_BYTES %u\n", bytes);
+}
+
+
+/*
+ * Close the current binary pattern file, and record its size.
+ */
+static int mode4_binary_pattern_file_close (void)
+{
+    int rc = RC_OK;
+
+    if (pattern_file != NULL)
+    {
+        mode4_binary_size (pattern_array_name, pattern_index * 32);
+        rc = output_close (pattern_file);
+        pattern_file = NULL;
+    }
+
+    return rc;
+}
+
+
+/*
+ * Write an array of bytes, either to a C file or as a binary file.
+ */
+static int mode4_write_bytes (FILE *text_file, const char *array_name, const uint8_t *data, uint32_t size)
+{
+    if (binary_output)
+    {
+        FILE *file = mode4_binary_open (array_name);
+        if (file == NULL)
+        {
+            return RC_ERROR;
+        }
+        fwrite (data, 1, size, file);
+        mode4_binary_size (array_name, size);
+        return output_close (file);
+    }
+
+    fprintf (text_file, "\nconst uint8_t %s [%u] = {\n", array_name, size);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        fprintf (text_file, "%s0x%02x,%s", (i % 16 == 0) ? "    " : " ", data [i],
+                 (i % 16 == 15 || i == size - 1) ? "\n" : "");
+    }
+    fprintf (text_file, "};\n");
+
+    return RC_OK;
+}
+
+
+/*
+ * Write a single pattern as a line of uint32_t words.
+ */
+static void mode4_write_pattern_text (FILE *file, const uint8_t *pattern)
+{
+    fprintf (file, "    ");
+    for (uint32_t y = 0; y < 8; y++)
+    {
+        fprintf (file, "0x%02x%02x%02x%02x%s",
+                 pattern [y * 4 + 3], pattern [y * 4 + 2], pattern [y * 4 + 1], pattern [y * 4 + 0],
+                 (y < 7) ? ", " : ",\n");
+    }
+}
+
+
+/*
+ * Record a finished pattern array in the staging file, to be placed into a bank later.
+ */
+static int mode4_bank_stage (const char *array_name, bool bytes, const uint8_t *data, uint32_t size)
+{
+    uint8_t flags = (bytes ? BANK_ARRAY_BYTES : 0) | (bank_split_current ? BANK_ARRAY_SPLIT : 0);
+    uint32_t name_length = strlen (array_name);
+
+    fwrite (&flags, 1, 1, bank_staging_file);
+    fwrite (&name_length, sizeof (name_length), 1, bank_staging_file);
+    fwrite (array_name, 1, name_length, bank_staging_file);
+    fwrite (&size, sizeof (size), 1, bank_staging_file);
+    fwrite (data, 1, size, bank_staging_file);
+
+    return ferror (bank_staging_file) ? RC_ERROR : RC_OK;
+}
+
+
+/*
+ * Start a new bank, with its data and header files.
+ */
+static mode4_bank_t *mode4_bank_open (void)
+{
+    mode4_bank_t *list = realloc (banks, (bank_count + 1) * sizeof (mode4_bank_t));
+    char *name = NULL;
+
+    if (list == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for banks.\n");
+        return NULL;
+    }
+    banks = list;
+
+    mode4_bank_t *bank = &banks [bank_count];
+    bank->number = first_bank + bank_count;
+    bank->used = 0;
+
+    asprintf (&name, "bank_%u.c", bank->number);
+    bank->data_file = output_open (name);
+    free (name);
+
+    asprintf (&name, "bank_%u.h", bank->number);
+    bank->header_file = output_open (name);
+    free (name);
+
+    if (bank->data_file == NULL || bank->header_file == NULL)
+    {
+        return NULL;
+    }
+    bank_count++;
+
+    fprintf (bank->data_file, "/*\n");
+    fprintf (bank->data_file, " * VDP Pattern data, bank %u\n", bank->number);
+    fprintf (bank->data_file, " */\n\n");
+    fprintf (bank->data_file, "#include <stdint.h>\n");
+
+    fprintf (bank->header_file, "/*\n");
+    fprintf (bank->header_file, " * VDP Pattern data, bank %u\n", bank->number);
+    fprintf (bank->header_file, " */\n");
+
+    return bank;
+}
+
+
+/*
+ * Write a pattern array into a bank, and declare it in the bank's header.
+ */
+static int mode4_bank_write_array (mode4_bank_t *bank, const char *array_name, bool bytes, const uint8_t *data, uint32_t size)
+{
+    if (bytes)
+    {
+        if (mode4_write_bytes (bank->data_file, array_name, data, size) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+    }
+    else
     {
-        fprintf (stderr, "Unable to open output file patterns.h\n");
+        fprintf (bank->data_file, "\nconst uint32_t %s [] = {\n", array_name);
+        for (uint32_t i = 0; i < size; i += 32)
+        {
+            mode4_write_pattern_text (bank->data_file, &data [i]);
+        }
+        fprintf (bank->data_file, "};\n");
+    }
+
+    fprintf (bank->header_file, "\n#define ");
+    mode4_write_define_name (bank->header_file, array_name);
+    fprintf (bank->header_file, "_BANK %u\n", bank->number);
+    fprintf (bank->header_file, "extern const %s %s [%u];\n",
+             bytes ? "uint8_t" : "uint32_t", array_name, bytes ? size : size / 4);
+
+    bank->used += size;
+
+    return RC_OK;
+}
+
+
+/*
+ * Place a pattern array into the banks.
+ * Arrays are kept whole, in the first bank with room for them. Only an
+ * uncompressed array marked with --bank-split may be divided, at pattern
+ * boundaries, to fill the space left in the last bank. Parts after the
+ * first have the part number added to their name.
+ */
+static int mode4_bank_place (const char *array_name, uint8_t flags, const uint8_t *data, uint32_t size)
+{
+    bool bytes = flags & BANK_ARRAY_BYTES;
+    bool split = (flags & BANK_ARRAY_SPLIT) && !bytes;
+
+    if (size <= bank_size)
+    {
+        for (uint32_t i = 0; i < bank_count; i++)
+        {
+            if (banks [i].used + size <= bank_size)
+            {
+                return mode4_bank_write_array (&banks [i], array_name, bytes, data, size);
+            }
+        }
+
+        if (!split)
+        {
+            mode4_bank_t *bank = mode4_bank_open ();
+            return (bank == NULL) ? RC_ERROR : mode4_bank_write_array (bank, array_name, bytes, data, size);
+        }
+    }
+    else if (!split)
+    {
+        fprintf (stderr, "Error: %s is %u bytes, which does not fit in a %u byte bank.\n", array_name, size, bank_size);
+        if (!bytes)
+        {
+            fprintf (stderr, "       Use --bank-split to allow it to be split between banks.\n");
+        }
         return RC_ERROR;
     }
-    fprintf (pattern_file, "/*\n");
-    fprintf (pattern_file, " * VDP Pattern data\n");
-    fprintf (pattern_file, " */\n");
+
+    for (uint32_t part = 0; size > 0; part++)
+    {
+        mode4_bank_t *bank = (bank_count > 0) ? &banks [bank_count - 1] : NULL;
+        uint32_t room = (bank != NULL) ? (bank_size - bank->used) & ~31 : 0;
+        char *part_name = NULL;
+
+        if (room == 0)
+        {
+            if ((bank = mode4_bank_open ()) == NULL)
+            {
+                return RC_ERROR;
+            }
+            room = bank_size & ~31;
+        }
+
+        uint32_t part_size = (size < room) ? size : room;
+        if (part == 0)
+        {
+            part_name = strdup (array_name);
+        }
+        else
+        {
+            asprintf (&part_name, "%s_%u", array_name, part);
+        }
+
+        int rc = mode4_bank_write_array (bank, part_name, false, data, part_size);
+        free (part_name);
+        if (rc != RC_OK)
+        {
+            return RC_ERROR;
+        }
+
+        data += part_size;
+        size -= part_size;
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Place the staged pattern arrays into banks, and report how full each bank is.
+ */
+static int mode4_banks_write (void)
+{
+    int rc = RC_OK;
+
+    fflush (bank_staging_file);
+    rewind (bank_staging_file);
+
+    while (rc == RC_OK)
+    {
+        uint8_t flags;
+        uint32_t name_length;
+        uint32_t size;
+
+        if (fread (&flags, 1, 1, bank_staging_file) != 1)
+        {
+            break;
+        }
+
+        char *array_name = NULL;
+        uint8_t *data = NULL;
+        if (fread (&name_length, sizeof (name_length), 1, bank_staging_file) != 1 ||
+            (array_name = calloc (name_length + 1, 1)) == NULL ||
+            fread (array_name, 1, name_length, bank_staging_file) != name_length ||
+            fread (&size, sizeof (size), 1, bank_staging_file) != 1 ||
+            (data = malloc (size ? size : 1)) == NULL ||
+            fread (data, 1, size, bank_staging_file) != size)
+        {
+            fprintf (stderr, "Error: Failed to read back pattern data for banks.\n");
+            rc = RC_ERROR;
+        }
+        else
+        {
+            rc = mode4_bank_place (array_name, flags, data, size);
+        }
+
+        free (array_name);
+        free (data);
+    }
+
+    if (output_close (bank_staging_file) != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
+    bank_staging_file = NULL;
+
+    for (uint32_t i = 0; i < bank_count; i++)
+    {
+        if (rc == RC_OK)
+        {
+            printf ("Bank %u: %u of %u bytes used (%.1f%%)\n",
+                    banks [i].number, banks [i].used, bank_size, 100.0 * banks [i].used / bank_size);
+        }
+
+        fprintf (banks [i].header_file, "\n#define BANK_%u_BYTES %u\n", banks [i].number, banks [i].used);
+        if (output_close (banks [i].data_file) != RC_OK || output_close (banks [i].header_file) != RC_OK)
+        {
+            rc = RC_ERROR;
+        }
+    }
+    free (banks);
+    banks = NULL;
+    bank_count = 0;
+
+    return rc;
+}
+
+
+/*
+ * Finish the pattern data for the current input file.
+ */
+static int mode4_end_patterns (void)
+{
+    int rc = RC_OK;
+
+    if (compress_current)
+    {
+        uint8_t *compressed = malloc (COMPRESS_PATTERNS_BOUND (pattern_index));
+        char *array_name = NULL;
+        if (compressed == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for compression.\n");
+            return RC_ERROR;
+        }
+
+        uint32_t size = compress_patterns (pattern_buffer, pattern_index, compressed);
+        output_report ("%s: %u bytes compressed to %u bytes (%.1f%%)\n",
+                       pattern_array_name, pattern_index * 32, size, 100.0 * size / (pattern_index * 32));
+
+        asprintf (&array_name, "%s_compressed", pattern_array_name);
+        if (bank_size != 0)
+        {
+            rc = mode4_bank_stage (array_name, true, compressed, size);
+        }
+        else
+        {
+            rc = mode4_write_bytes (pattern_file, array_name, compressed, size);
+        }
+
+        free (array_name);
+        free (compressed);
+    }
+    else if (bank_size != 0)
+    {
+        rc = mode4_bank_stage (pattern_array_name, false, pattern_buffer, pattern_index * 32);
+    }
+    else if (binary_output)
+    {
+        rc = mode4_binary_pattern_file_close ();
+    }
+    else
+    {
+        fprintf (pattern_file, "};\n");
+    }
+
+    free (pattern_buffer);
+    pattern_buffer = NULL;
+
+    return rc;
+}
+
+
+/*
+ * Open the three output files.
+ */
+int mode4_open_files (void)
+{
+    /* In binary mode, the data files are opened per input file,
+     * and the only file to open now is the header of sizes. */
+    if (binary_output)
+    {
+        binary_header_file = output_open ("binary_sizes.h");
+        if (binary_header_file == NULL)
+        {
+            return RC_ERROR;
+        }
+        fprintf (binary_header_file, "/*\n");
+        fprintf (binary_header_file, " * VDP binary data sizes\n");
+        fprintf (binary_header_file, " */\n\n");
+
+        return RC_OK;
+    }
+
+    /* Pattern file. With banks, the pattern data
+     * is written to a file for each bank instead. */
+    if (bank_size != 0)
+    {
+        bank_staging_file = output_open_temporary ("bank_staging");
+        if (bank_staging_file == NULL)
+        {
+            return RC_ERROR;
+        }
+    }
+    else
+    {
+        pattern_file = output_open ("patterns.h");
+        if (pattern_file == NULL)
+        {
+            return RC_ERROR;
+        }
+        fprintf (pattern_file, "/*\n");
+        fprintf (pattern_file, " * VDP Pattern data\n");
+        fprintf (pattern_file, " */\n");
+    }
 
     /* Pattern index file */
-    pattern_index_file = fopen (pattern_index_path, "w");
+    pattern_index_file = output_open ("pattern_index.h");
     if (pattern_index_file == NULL)
     {
-        fprintf (stderr, "Unable to open output file pattern_index.h\n");
         return RC_ERROR;
     }
     fprintf (pattern_index_file, "/*\n");
@@ -70,23 +527,15 @@ int mode4_open_files (void)
     fprintf (pattern_index_file, " */\n");
 
     /* Palette file */
-    palette_file = fopen (palette_path, "w");
+    palette_file = output_open ("palette.h");
     if (palette_file == NULL)
     {
-        fprintf (stderr, "Unable to open output file palette.h\n");
         return RC_ERROR;
     }
     fprintf (palette_file, "/*\n");
     fprintf (palette_file, " * VDP Palette data\n");
     fprintf (palette_file, " */\n");
 
-    if (output_dir != NULL)
-    {
-        free (patterns_path);
-        free (pattern_index_path);
-        free (palette_path);
-    }
-
     return RC_OK;
 }
 
@@ -94,16 +543,29 @@ int mode4_open_files (void)
 /*
  * Mark the start of a new source file.
  */
-void mode4_new_input_file (const char *name)
+int mode4_new_input_file (const char *name, bool compress, bool bank_split)
 {
-    static bool first = true;
-    if (first)
-    {
-        first = false;
-    }
-    else
+    /* With a global pattern pool, there is one array for all files */
+    if (global_dedupe)
     {
-        fprintf (pattern_file, "};\n");
+        if (first_input_file)
+        {
+            first_input_file = false;
+            pattern_array_name = strdup ("pattern_pool");
+
+            if (binary_output)
+            {
+                pattern_file = mode4_binary_open (pattern_array_name);
+                return (pattern_file == NULL) ? RC_ERROR : RC_OK;
+            }
+            fprintf (pattern_file, "\nconst uint32_t pattern_pool [] = {\n");
+        }
+
+        if (!binary_output)
+        {
+            fprintf (pattern_file, "    /* %s */\n", name);
+        }
+        return RC_OK;
     }
 
     /* Strip the extension for the array name */
@@ -114,19 +576,60 @@ void mode4_new_input_file (const char *name)
         extension [0] = '\0';
     }
 
-    /* Start new data array in patterns file */
-    fprintf (pattern_file, "\nconst uint32_t %s_patterns [] = {\n", base_name);
+    free (pattern_array_name);
+    asprintf (&pattern_array_name, "%s_patterns", base_name);
     free (base_name);
 
     /* Pattern indices are within the current output array */
     pattern_index = 0;
+
+    compress_current = compress;
+    bank_split_current = bank_split;
+    if (compress || bank_size != 0)
+    {
+        /* Room for every tile in the image, in case none are duplicates */
+        pattern_buffer = malloc ((current_image.width / 8) * (current_image.height / 8) * 32);
+        if (pattern_buffer == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for patterns.\n");
+            return RC_ERROR;
+        }
+        return RC_OK;
+    }
+
+    if (binary_output)
+    {
+        pattern_file = mode4_binary_open (pattern_array_name);
+        return (pattern_file == NULL) ? RC_ERROR : RC_OK;
+    }
+
+    /* Start new data array in patterns file */
+    fprintf (pattern_file, "\nconst uint32_t %s [] = {\n", pattern_array_name);
+
+    return RC_OK;
+}
+
+
+/*
+ * Mark the end of the current source file.
+ * Each file's output is complete once this returns, apart
+ * from the global pattern pool which spans all of the files.
+ */
+int mode4_end_input_file (void)
+{
+    if (global_dedupe)
+    {
+        return RC_OK;
+    }
+
+    return mode4_end_patterns ();
 }
 
 
 /*
  * Generate indices for the file.
  */
-void mode4_process_indices (const char *name, pixel_t *buffer)
+int mode4_process_indices (const char *name, const uint16_t *entries)
 {
     /* Strip the extension for the array name */
     char *base_name = strdup (name);
@@ -136,6 +639,69 @@ void mode4_process_indices (const char *name, pixel_t *buffer)
         extension [0] = '\0';
     }
 
+    if (compress_current)
+    {
+        uint32_t count = (current_image.width / 8) * (current_image.height / 8);
+        uint16_t *indices = malloc (count * sizeof (uint16_t));
+        uint8_t *compressed = malloc (COMPRESS_INDICES_BOUND (count));
+        char *array_name = NULL;
+        int rc;
+
+        if (indices == NULL || compressed == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for compression.\n");
+            free (base_name);
+            free (indices);
+            free (compressed);
+            return RC_ERROR;
+        }
+
+        uint32_t i = 0;
+        for (uint32_t row = 0; row < current_image.height; row += 8)
+        for (uint32_t col = 0; col < current_image.width; col += 8)
+        {
+            indices [i++] = entries [(row / 8) * (current_image.width / 8) + col / 8];
+        }
+
+        uint32_t size = compress_indices (indices, count, compressed);
+        output_report ("%s_indices: %u bytes compressed to %u bytes (%.1f%%)\n", base_name, count * 2, size, 100.0 * size / (count * 2));
+
+        asprintf (&array_name, "%s_indices_compressed", base_name);
+        free (base_name);
+        rc = mode4_write_bytes (pattern_index_file, array_name, compressed, size);
+
+        free (array_name);
+        free (indices);
+        free (compressed);
+        return rc;
+    }
+
+    if (binary_output)
+    {
+        char *array_name = NULL;
+        asprintf (&array_name, "%s_indices", base_name);
+        free (base_name);
+
+        FILE *indices_file = mode4_binary_open (array_name);
+        if (indices_file == NULL)
+        {
+            free (array_name);
+            return RC_ERROR;
+        }
+
+        for (uint32_t row = 0; row < current_image.height; row += 8)
+        for (uint32_t col = 0; col < current_image.width; col += 8)
+        {
+            uint16_t index = entries [(row / 8) * (current_image.width / 8) + col / 8];
+            fputc (index & 0xff, indices_file);
+            fputc (index >> 8, indices_file);
+        }
+
+        mode4_binary_size (array_name, (current_image.width / 8) * (current_image.height / 8) * 2);
+        free (array_name);
+        return output_close (indices_file);
+    }
+
     fprintf (pattern_index_file, "\nconst uint16_t %s_indices [%d] = {\n   ", base_name, (current_image.width / 8) * (current_image.height / 8));
     free (base_name);
 
@@ -143,7 +709,7 @@ void mode4_process_indices (const char *name, pixel_t *buffer)
     for (uint32_t row = 0; row < current_image.height; row += 8)
     for (uint32_t col = 0; col < current_image.width; col += 8)
     {
-        fprintf (pattern_index_file, " 0x%04x", sneptile_get_match (&buffer [row * current_image.width + col]));
+        fprintf (pattern_index_file, " 0x%04x", entries [(row / 8) * (current_image.width / 8) + col / 8]);
 
         fprintf (pattern_index_file, "%s", (tile_count == 11) ? ",\n   " : ",");
         tile_count = (tile_count + 1) % 12;
@@ -154,13 +720,15 @@ void mode4_process_indices (const char *name, pixel_t *buffer)
     }
 
     fprintf (pattern_index_file, "};\n");
+
+    return RC_OK;
 }
 
 
 /*
  * Generate panel indices for the file.
  */
-void mode4_process_panels (const char *name, uint32_t panel_count, uint32_t panel_width, uint32_t panel_height, pixel_t *buffer)
+int mode4_process_panels (const char *name, uint32_t panel_count, uint32_t panel_width, uint32_t panel_height, const uint16_t *entries)
 {
     /* Strip the extension for the array name */
     char *base_name = strdup (name);
@@ -170,6 +738,38 @@ void mode4_process_panels (const char *name, uint32_t panel_count, uint32_t pane
         extension [0] = '\0';
     }
 
+    if (binary_output)
+    {
+        char *array_name = NULL;
+        asprintf (&array_name, "%s_panels", base_name);
+        free (base_name);
+
+        FILE *panels_file = mode4_binary_open (array_name);
+        if (panels_file == NULL)
+        {
+            free (array_name);
+            return RC_ERROR;
+        }
+
+        uint32_t panels_remaining = panel_count;
+        for (uint32_t panel_row = 0; panel_row < current_image.height && panels_remaining > 0; panel_row += 8 * panel_height)
+        for (uint32_t panel_col = 0; panel_col < current_image.width && panels_remaining > 0; panel_col += 8 * panel_width)
+        {
+            for (uint32_t row = panel_row; row < panel_row + panel_height * 8; row += 8)
+            for (uint32_t col = panel_col; col < panel_col + panel_width * 8; col += 8)
+            {
+                uint16_t index = entries [(row / 8) * (current_image.width / 8) + col / 8];
+                fputc (index & 0xff, panels_file);
+                fputc (index >> 8, panels_file);
+            }
+            panels_remaining--;
+        }
+
+        mode4_binary_size (array_name, panel_count * panel_width * panel_height * 2);
+        free (array_name);
+        return output_close (panels_file);
+    }
+
     fprintf (pattern_index_file, "\nconst uint16_t %s_panels [%d] [%d] = {\n", base_name, panel_count, panel_width * panel_height);
     free (base_name);
 
@@ -181,7 +781,7 @@ void mode4_process_panels (const char *name, uint32_t panel_count, uint32_t pane
         for (uint32_t row = panel_row; row < panel_row + panel_height * 8; row += 8)
         for (uint32_t col = panel_col; col < panel_col + panel_width * 8; col += 8)
         {
-            fprintf (pattern_index_file, "0x%04x", sneptile_get_match (&buffer [row * current_image.width + col]));
+            fprintf (pattern_index_file, "0x%04x", entries [(row / 8) * (current_image.width / 8) + col / 8]);
 
             if (!(row == panel_row + (panel_height - 1) * 8 &&
                   col == panel_col + (panel_width - 1) * 8))
@@ -199,8 +799,63 @@ void mode4_process_panels (const char *name, uint32_t panel_count, uint32_t pane
         }
     }
     fprintf (pattern_index_file, "};\n");
+
+    return RC_OK;
+}
+
+/*
+ * Generate a metasprite table for the file's panels.
+ * Each sprite of a panel is three bytes, in the order they are added to the SAT:
+ * x offset, y offset, and the tile's position within the panel.
+ * Every panel has the same layout, so a single table is shared between them.
+ */
+int mode4_process_metasprite (const char *name, uint32_t panel_width, uint32_t panel_height)
+{
+    uint32_t sprite_count = panel_width * panel_height;
+
+    if (panel_width * 8 > 256 || panel_height * 8 > 256 || sprite_count > 256)
+    {
+        fprintf (stderr, "Error: %s: Panels of %ux%u are too large for a metasprite.\n", name, panel_width, panel_height);
+        return RC_ERROR;
+    }
+
+    uint8_t *metasprite = malloc (sprite_count * 3);
+    if (metasprite == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for metasprite.\n");
+        return RC_ERROR;
+    }
+
+    uint8_t *sprite = metasprite;
+    for (uint32_t row = 0; row < panel_height; row++)
+    for (uint32_t col = 0; col < panel_width; col++)
+    {
+        sprite [0] = col * 8;
+        sprite [1] = row * 8;
+        sprite [2] = row * panel_width + col;
+        sprite += 3;
+    }
+
+    /* Strip the extension for the array name */
+    char *base_name = strdup (name);
+    char *extension = strchr (base_name, '.');
+    if (extension)
+    {
+        extension [0] = '\0';
+    }
+
+    char *array_name = NULL;
+    asprintf (&array_name, "%s_metasprite", base_name);
+    free (base_name);
+
+    int rc = mode4_write_bytes (pattern_index_file, array_name, metasprite, sprite_count * 3);
+
+    free (array_name);
+    free (metasprite);
+    return rc;
 }
 
+
 /*
  * Convert from 6-bit SMS colour to the equivalent 12-bit GG colour.
  */
@@ -216,6 +871,56 @@ static uint16_t mode4_sms_colour_to_gg (uint8_t sms_colour)
 }
 
 
+/*
+ * Output the palettes as binary files, padded to 16 entries.
+ */
+static int mode4_palette_write_binary (void)
+{
+    const char *names [2] = { "background_palette", "sprite_palette" };
+    const uint8_t *palettes [2] = { background_palette, sprite_palette };
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        /* SMS Palette */
+        FILE *sms_file = mode4_binary_open (names [i]);
+        if (sms_file == NULL)
+        {
+            return RC_ERROR;
+        }
+        fwrite (palettes [i], 1, 16, sms_file);
+        mode4_binary_size (names [i], 16);
+        if (output_close (sms_file) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+
+        /* GG Palette */
+        char *gg_name = NULL;
+        asprintf (&gg_name, "%s_gg", names [i]);
+        FILE *gg_file = mode4_binary_open (gg_name);
+        if (gg_file == NULL)
+        {
+            free (gg_name);
+            return RC_ERROR;
+        }
+        for (uint32_t j = 0; j < 16; j++)
+        {
+            uint16_t gg_colour = mode4_sms_colour_to_gg (palettes [i] [j]);
+            fputc (gg_colour & 0xff, gg_file);
+            fputc (gg_colour >> 8, gg_file);
+        }
+        mode4_binary_size (gg_name, 32);
+        free (gg_name);
+        if (output_close (gg_file) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+    }
+
+    return RC_OK;
+}
+
+
 /*
  * Output the palette file.
  */
@@ -229,6 +934,11 @@ static int mode4_palette_write (void)
         return RC_ERROR;
     }
 
+    if (binary_output)
+    {
+        return mode4_palette_write_binary ();
+    }
+
     /* SMS Palette */
     fprintf (palette_file, "\n#ifdef TARGET_SMS\n");
 
@@ -276,16 +986,56 @@ int mode4_close_files (void)
     rc = mode4_palette_write ();
 
     /* Pattern file */
-    fprintf (pattern_file, "};\n");
-    fclose (pattern_file);
+    if (global_dedupe && !binary_output)
+    {
+        fprintf (pattern_file, "};\n");
+    }
+    else if (global_dedupe && mode4_binary_pattern_file_close () != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
+    free (pattern_array_name);
+    pattern_array_name = NULL;
+
+    if (binary_output)
+    {
+        if (output_close (binary_header_file) != RC_OK)
+        {
+            rc = RC_ERROR;
+        }
+        binary_header_file = NULL;
+        return rc;
+    }
+
+    if (bank_size != 0)
+    {
+        if (rc == RC_OK)
+        {
+            rc = mode4_banks_write ();
+        }
+    }
+    else if (output_close (pattern_file) != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
     pattern_file = NULL;
 
     /* Pattern index file */
-    fclose (pattern_index_file);
+    if (global_dedupe)
+    {
+        fprintf (pattern_index_file, "\n#define PATTERN_POOL_SIZE %u\n", pattern_index);
+    }
+    if (output_close (pattern_index_file) != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
     pattern_index_file = NULL;
 
     /* Palette file */
-    fclose (palette_file);
+    if (output_close (palette_file) != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
     palette_file = NULL;
 
     return rc;
@@ -298,55 +1048,110 @@ int mode4_close_files (void)
  */
 uint8_t mode4_palette_add_colour (palette_t palette, uint8_t colour)
 {
-    if (palette == PALETTE_BACKGROUND)
+    uint8_t *entries = (palette == PALETTE_BACKGROUND) ? background_palette : sprite_palette;
+    uint8_t *lookup = (palette == PALETTE_BACKGROUND) ? background_lookup : sprite_lookup;
+    uint32_t *size = (palette == PALETTE_BACKGROUND) ? &background_palette_size : &sprite_palette_size;
+    uint32_t index = *size;
+
+    colour &= 0x3f;
+
+    /* Palettes beyond 16 colours are counted, and reported when writing the palette.
+     * Colours past the limit still go into the lookup, so that each is only counted
+     * once. There are only 64 colours, so the lookup value always fits. */
+    if (index < 16)
     {
-        background_palette [background_palette_size] = colour;
-        return background_palette_size++;
+        entries [index] = colour;
     }
-    else
+    if (index > 0 && lookup [colour] == 0)
     {
-        sprite_palette [sprite_palette_size] = colour;
-        return sprite_palette_size++;
+        lookup [colour] = index + 1;
     }
+
+    return (*size)++;
 }
 
 
 /*
- * Convert from pixel colour to palette index.
- * New colours are added to the palette as needed.
+ * Get the current palette contents.
  */
-static uint8_t mode4_rgb_to_index (palette_t palette, pixel_t p)
+void mode4_palettes_get (mode4_palettes_t *palettes)
 {
-    /* First, convert the pixel to a 6-bit Master System colour. */
-    uint8_t colour = ((p.r & 0xc0) >> 6)
-                   | ((p.g & 0xc0) >> 4)
-                   | ((p.b & 0xc0) >> 2);
+    memcpy (palettes->background, background_palette, 16);
+    palettes->background_size = background_palette_size;
+    memcpy (palettes->sprite, sprite_palette, 16);
+    palettes->sprite_size = sprite_palette_size;
+}
 
-    /* Next, check if the colour is already in the palette */
-    uint32_t start = (target == VDP_MODE_4_SPRITES) ? 1 : 0;
 
-    if (palette == PALETTE_BACKGROUND)
+/*
+ * Replace the palette contents, rebuilding the reverse lookups.
+ */
+void mode4_palettes_set (const mode4_palettes_t *palettes)
+{
+    memcpy (background_palette, palettes->background, 16);
+    background_palette_size = palettes->background_size;
+    memcpy (sprite_palette, palettes->sprite, 16);
+    sprite_palette_size = palettes->sprite_size;
+
+    memset (background_lookup, 0, sizeof (background_lookup));
+    memset (sprite_lookup, 0, sizeof (sprite_lookup));
+    for (uint32_t i = 1; i < 16; i++)
     {
-        for (uint32_t i = start; i < background_palette_size; i++)
+        if (i < background_palette_size && background_lookup [background_palette [i]] == 0)
         {
-            if (background_palette [i] == colour)
-            {
-                return i;
-            }
+            background_lookup [background_palette [i]] = i + 1;
         }
-    }
-    else
-    {
-        for (uint32_t i = start; i < sprite_palette_size; i++)
+        if (i < sprite_palette_size && sprite_lookup [sprite_palette [i]] == 0)
         {
-            if (sprite_palette [i] == colour)
-            {
-                return i;
-            }
+            sprite_lookup [sprite_palette [i]] = i + 1;
         }
     }
+}
+
 
-    /* If not, add it */
+/*
+ * Convert an RGBA colour to a mode-4 pixel.
+ */
+pixel_t mode4_pixel (uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    if (a == 0)
+    {
+        return 0;
+    }
+
+    return PIXEL_OPAQUE | ((r & 0xc0) >> 6) | ((g & 0xc0) >> 4) | ((b & 0xc0) >> 2);
+}
+
+
+/*
+ * Convert from pixel colour to palette index.
+ * New colours are added to the palette as needed.
+ */
+static uint8_t mode4_pixel_to_index (palette_t palette, pixel_t p)
+{
+    /* The pixel already holds the 6-bit Master System colour. */
+    uint8_t colour = p & 0x3f;
+
+    /* Next, check if the colour is already in the palette.
+     * Index zero is only used for visible colours outside of sprite mode. */
+    const uint8_t *entries = (palette == PALETTE_BACKGROUND) ? background_palette : sprite_palette;
+    const uint8_t *lookup = (palette == PALETTE_BACKGROUND) ? background_lookup : sprite_lookup;
+    uint32_t size = (palette == PALETTE_BACKGROUND) ? background_palette_size : sprite_palette_size;
+
+    if (target != VDP_MODE_4_SPRITES && size > 0 && entries [0] == colour)
+    {
+        return 0;
+    }
+    if (lookup [colour] != 0)
+    {
+        return lookup [colour] - 1;
+    }
+
+    /* If not, add it. In sprite mode, an empty palette first gets its transparent entry. */
+    if (target == VDP_MODE_4_SPRITES && size == 0)
+    {
+        mode4_palette_add_colour (palette, 0x00);
+    }
     return mode4_palette_add_colour (palette, colour);
 }
 
@@ -356,35 +1161,39 @@ static uint8_t mode4_rgb_to_index (palette_t palette, pixel_t p)
  */
 void mode4_process_tile (palette_t palette, pixel_t *buffer)
 {
-    fprintf (pattern_file, "    ");
+    uint8_t pattern [32];
+
     for (uint32_t y = 0; y < 8; y++)
     {
-        uint8_t line_data[4] = { };
+        const pixel_t *row = &buffer [y * current_image.width];
+        uint32_t planes = 0;
 
         for (uint32_t x = 0; x < 8; x++)
         {
-            uint8_t index = 0;
-            pixel_t p = buffer [x + y * current_image.width];
-
-            /* If the pixel is non-transparent, calculate its colour index */
-            if (p.a != 0)
-            {
-                index = mode4_rgb_to_index (palette, p);
-            }
-
-            /* Convert index to bitplane representation */
-            for (uint32_t i = 0; i < 4; i++)
+            /* Transparent pixels use index 0 */
+            if (row [x] & PIXEL_OPAQUE)
             {
-                if (index & (1 << i))
-                {
-                    line_data [i] |= (1 << (7 - x));
-                }
+                planes |= bitplane_spread [mode4_pixel_to_index (palette, row [x]) & 0x0f] >> x;
             }
         }
 
-        fprintf (pattern_file, "0x%02x%02x%02x%02x%s",
-                 line_data [3], line_data [2], line_data [1], line_data [0],
-                 (y < 7) ? ", " : ",\n");
+        pattern [y * 4 + 0] = planes;
+        pattern [y * 4 + 1] = planes >> 8;
+        pattern [y * 4 + 2] = planes >> 16;
+        pattern [y * 4 + 3] = planes >> 24;
+    }
+
+    if (pattern_buffer != NULL)
+    {
+        memcpy (&pattern_buffer [pattern_index * 32], pattern, 32);
+    }
+    else if (binary_output)
+    {
+        fwrite (pattern, 1, 32, pattern_file);
+    }
+    else
+    {
+        mode4_write_pattern_text (pattern_file, pattern);
     }
 
     pattern_index++;
@@ -8,6 +8,14 @@ typedef enum palette_e {
     PALETTE_SPRITE
 } palette_t;
 
+/* Palette contents, as saved in the cache */
+typedef struct mode4_palettes_s {
+    uint8_t background [16];
+    uint32_t background_size;
+    uint8_t sprite [16];
+    uint32_t sprite_size;
+} mode4_palettes_t;
+
 /* Open the three output files. */
 int mode4_open_files (void);
 
@@ -17,14 +25,29 @@ int mode4_close_files (void);
 /* Add a colour to the palette. */
 uint8_t mode4_palette_add_colour (palette_t palette, uint8_t colour);
 
+/* Get the current palette contents. */
+void mode4_palettes_get (mode4_palettes_t *palettes);
+
+/* Replace the palette contents. */
+void mode4_palettes_set (const mode4_palettes_t *palettes);
+
 /* Mark the start of a new source file. */
-void mode4_new_input_file (const char *name);
+int mode4_new_input_file (const char *name, bool compress, bool bank_split);
+
+/* Mark the end of the current source file. */
+int mode4_end_input_file (void);
+
+/* Convert an RGBA colour to a mode-4 pixel. */
+pixel_t mode4_pixel (uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 
 /* Process a single 8×8 tile. */
 void mode4_process_tile (palette_t palette, pixel_t *buffer);
 
-/* Generate indices for the file. */
-void mode4_process_indices (const char *name, pixel_t *buffer);
+/* Generate indices for the file, from the name-table entry of each tile. */
+int mode4_process_indices (const char *name, const uint16_t *entries);
+
+/* Generate panel indexes for the file, from the name-table entry of each tile. */
+int mode4_process_panels (const char *name, uint32_t panel_count, uint32_t panel_width, uint32_t panel_height, const uint16_t *entries);
 
-/* Generate panel indexes for the file. */
-void mode4_process_panels (const char *name, uint32_t panel_count, uint32_t panel_width, uint32_t panel_height, pixel_t *buffer);
+/* Generate a metasprite table for the file's panels. */
+int mode4_process_metasprite (const char *name, uint32_t panel_width, uint32_t panel_height);
@@ -7,12 +7,11 @@
 #define RC_OK       0
 #define RC_ERROR   -1
 
-typedef struct pixel_s {
-    uint8_t r;
-    uint8_t g;
-    uint8_t b;
-    uint8_t a;
-} pixel_t;
+/* Pixels are converted to a single byte as the image is decoded:
+ *  - Mode-4: PIXEL_OPAQUE with the 6-bit Master System colour, or zero for transparency.
+ *  - TMS99xx: The TMS99xx colour index, with zero for transparency. */
+typedef uint8_t pixel_t;
+#define PIXEL_OPAQUE 0x80
 
 typedef enum target_e {
     VDP_MODE_0 = 0,
@@ -26,6 +25,12 @@ typedef enum target_e {
 /* Global State */
 extern target_t target;
 extern char *output_dir;
+extern bool global_dedupe;
+extern bool flip_dedupe;
+extern bool tms_dedupe;
+extern bool binary_output;
+extern uint32_t bank_size;
+extern uint32_t first_bank;
 
 /* Current image file */
 typedef struct image_s {
@@ -33,6 +38,3 @@ typedef struct image_s {
     uint32_t height;
 } image_t;
 extern image_t current_image;
-
-/* Find the matching 8x8 tile, or -1 if it is unique. */
-int32_t sneptile_get_match (pixel_t *tile);
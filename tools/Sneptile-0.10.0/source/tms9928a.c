@@ -9,8 +9,10 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "sneptile.h"
+#include "output.h"
 
 /* State */
 static uint32_t pattern_index = 0;
@@ -28,13 +30,44 @@ static uint32_t ct_entry_size = 0;
 static uint8_t test_ct_entry [2] = { };
 static uint32_t test_ct_entry_size = 0;
 
+/* De-duplication (--tms-dedupe).
+ * The tiles of a file are gathered, and only the distinct tiles are converted
+ * once the whole file has been seen. Each distinct tile keeps its own colours,
+ * as the image may have been decoded a band at a time. Two tiles are the same if
+ * their pixels map to the same TMS99xx colours, so both the pattern and its
+ * colour-table entry must match. In mode-0, the order of the distinct tiles is
+ * chosen to keep tiles with the same pair of colours together, so that fewer
+ * blocks of eight patterns need padding. */
+typedef struct tms9928a_tile_s {
+    uint8_t colours [32];       /* Colour index of each pixel, two per byte */
+    uint64_t digest;
+    uint8_t ct_colours [2];     /* Mode-0 colours used by the tile */
+    uint32_t ct_colours_size;
+    uint32_t pattern;           /* Index in the pattern table, once emitted */
+} tms9928a_tile_t;
+
+static tms9928a_tile_t *file_tiles = NULL;
+static uint32_t file_tiles_count = 0;
+static uint32_t *file_positions = NULL;  /* Distinct tile used at each position in the file */
+static uint32_t file_positions_count = 0;
+static int32_t *file_table = NULL;
+static uint32_t file_table_size = 0;
+
+/* Simulated mode-0 colour-table state, for choosing the order of tiles */
+typedef struct tms9928a_block_s {
+    uint8_t colours [2];
+    uint32_t size;
+    uint32_t pattern_index;
+    uint32_t padding;
+} tms9928a_block_t;
+
 /* Mode-4 Output Files */
 static FILE *pattern_file = NULL;
 static FILE *pattern_index_file = NULL;
 static FILE *colour_table_file = NULL;
 
 /* TMS9928a palette (gamma corrected) */
-static const pixel_t tms9928a_palette [16] = {
+static const struct { uint8_t r, g, b; } tms9928a_palette [16] = {
     { .r = 0x00, .g = 0x00, .b = 0x00 },    /* Transparent */
     { .r = 0x00, .g = 0x00, .b = 0x00 },    /* Black */
     { .r = 0x0a, .g = 0xad, .b = 0x1e },    /* Medium Green */
@@ -59,9 +92,9 @@ static const pixel_t tms9928a_palette [16] = {
  */
 int tms9928a_open_files (void)
 {
-    char *patterns_path = "patterns.h";
-    char *pattern_index_path = "pattern_index.h";
-    char *colour_table_path = "colour_table.h";
+    const char *patterns_path = "patterns.h";
+    const char *pattern_index_path = "pattern_index.h";
+    const char *colour_table_path = "colour_table.h";
 
     /* Give sprite modes a different name, so that
      * they can be used in the same project alongside
@@ -77,20 +110,10 @@ int tms9928a_open_files (void)
         pattern_index_path = "sprite_index_l.h";
     }
 
-    /* If the user has specified an output
-     * directory, create and change into it */
-    if (output_dir != NULL)
-    {
-        asprintf (&patterns_path, "%s/%s", output_dir, patterns_path);
-        asprintf (&pattern_index_path, "%s/%s", output_dir, pattern_index_path);
-        asprintf (&colour_table_path, "%s/%s", output_dir, colour_table_path);
-    }
-
     /* Pattern file */
-    pattern_file = fopen (patterns_path, "w");
+    pattern_file = output_open (patterns_path);
     if (pattern_file == NULL)
     {
-        fprintf (stderr, "Unable to open output file patterns.h\n");
         return RC_ERROR;
     }
 
@@ -108,10 +131,9 @@ int tms9928a_open_files (void)
     }
 
     /* Pattern index file */
-    pattern_index_file = fopen (pattern_index_path, "w");
+    pattern_index_file = output_open (pattern_index_path);
     if (pattern_index_file == NULL)
     {
-        fprintf (stderr, "Unable to open output file pattern_index.h\n");
         return RC_ERROR;
     }
 
@@ -119,22 +141,14 @@ int tms9928a_open_files (void)
     if (target == VDP_MODE_0 || target == VDP_MODE_2)
     {
         /* Colour table file */
-        colour_table_file = fopen (colour_table_path, "w");
+        colour_table_file = output_open (colour_table_path);
         if (colour_table_file == NULL)
         {
-            fprintf (stderr, "Unable to open output file colour_table.h\n");
             return RC_ERROR;
         }
         fprintf (colour_table_file, "static const %s colour_table [] = {\n", (target == VDP_MODE_0) ? "uint8_t" : "uint32_t");
     }
 
-    if (output_dir != NULL)
-    {
-        free (patterns_path);
-        free (pattern_index_path);
-        free (colour_table_path);
-    }
-
     return RC_OK;
 }
 
@@ -208,12 +222,20 @@ static void tms9928a_mode2_emit_ct_entry (uint8_t *ct_lines)
 int tms9928a_close_files (void)
 {
     /* Pattern file */
+    int rc = RC_OK;
+
     fprintf (pattern_file, "%s};\n", line_pattern_index != 0 ? "\n" : "");
-    fclose (pattern_file);
+    if (output_close (pattern_file) != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
     pattern_file = NULL;
 
     /* Pattern index file */
-    fclose (pattern_index_file);
+    if (output_close (pattern_index_file) != RC_OK)
+    {
+        rc = RC_ERROR;
+    }
     pattern_index_file = NULL;
 
     if (colour_table_file != NULL)
@@ -225,11 +247,21 @@ int tms9928a_close_files (void)
         }
 
         fprintf (colour_table_file, "%s};\n", line_ct_index != 0 ? "\n" : "");
-        fclose (colour_table_file);
+        if (output_close (colour_table_file) != RC_OK)
+        {
+            rc = RC_ERROR;
+        }
         colour_table_file = NULL;
     }
 
-    return RC_OK;
+    free (file_tiles);
+    free (file_positions);
+    free (file_table);
+    file_tiles = NULL;
+    file_positions = NULL;
+    file_table = NULL;
+
+    return rc;
 }
 
 
@@ -281,44 +313,72 @@ void tms9928a_new_input_first_tile (void)
  * Note that the actual marking occurs later, as we may need
  * to generate padding tiles before the first tile from this file.
  */
-void tms9928a_new_input_file (const char *name)
+int tms9928a_new_input_file (const char *name)
 {
     input_filename = name;
     first_pattern_in_file = true;
+
+    if (tms_dedupe)
+    {
+        uint32_t positions = (current_image.width / 8) * (current_image.height / 8);
+        uint32_t table_size = 256;
+
+        /* Keep the hash table no more than half full */
+        while (table_size < positions * 2)
+        {
+            table_size *= 2;
+        }
+
+        free (file_tiles);
+        free (file_positions);
+        free (file_table);
+        file_tiles = calloc (positions, sizeof (tms9928a_tile_t));
+        file_positions = calloc (positions, sizeof (uint32_t));
+        file_table = malloc (table_size * sizeof (int32_t));
+        file_tiles_count = 0;
+        file_positions_count = 0;
+        file_table_size = table_size;
+
+        if (file_tiles == NULL || file_positions == NULL || file_table == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for de-duplication.\n");
+            return RC_ERROR;
+        }
+        memset (file_table, 0xff, table_size * sizeof (int32_t));
+    }
+
+    return RC_OK;
 }
 
 
 /*
- * Convert from pixel colour to the indexed tms9928a colour.
+ * Convert an RGBA colour to the indexed tms9928a colour.
  * Assumes that the input is using the gamma-corrected values.
+ * Returns false if the colour is not in the tms9928a palette.
  */
-static uint8_t tms9928a_rgb_to_colour_index (pixel_t p)
+bool tms9928a_pixel (uint8_t r, uint8_t g, uint8_t b, uint8_t a, pixel_t *pixel)
 {
-    static bool warn_once = true;
+    /* Zero for transparency */
+    *pixel = 0;
 
-    if (p.a != 0)
+    if (a == 0)
     {
-        /* Map from RGB to tms9928a colour */
-        for (int tms_colour = 1; tms_colour < 16; tms_colour++)
-        {
-            if (p.r == tms9928a_palette [tms_colour].r &&
-                p.g == tms9928a_palette [tms_colour].g &&
-                p.b == tms9928a_palette [tms_colour].b)
-            {
-                return tms_colour;
-            }
-        }
+        return true;
+    }
 
-        /* Warn if a non-compatible colour is used. */
-        if (warn_once)
+    /* Map from RGB to tms9928a colour */
+    for (int tms_colour = 1; tms_colour < 16; tms_colour++)
+    {
+        if (r == tms9928a_palette [tms_colour].r &&
+            g == tms9928a_palette [tms_colour].g &&
+            b == tms9928a_palette [tms_colour].b)
         {
-            fprintf (stderr, "Warning: Image contains invalid colours for tms9928a.\n");
-            warn_once = false;
+            *pixel = tms_colour;
+            return true;
         }
     }
 
-    /* Zero for transparency */
-    return 0;
+    return false;
 }
 
 
@@ -327,10 +387,8 @@ static uint8_t tms9928a_rgb_to_colour_index (pixel_t p)
  * Returns 0 for background colour.
  * Returns 1 for foreground colour.
  */
-static uint8_t tms9928a_rgb_to_ct_bit (pixel_t p)
+static uint8_t tms9928a_pixel_to_ct_bit (pixel_t colour)
 {
-    uint8_t colour = tms9928a_rgb_to_colour_index (p);
-
     /* For sprites, all we care about is whether the pixel is transparent or not */
     if (target == VDP_MODE_TMS_SMALL_SPRITES || target == VDP_MODE_TMS_LARGE_SPRITES)
     {
@@ -365,10 +423,7 @@ static void tms9928a_generate_ct_test_entry (pixel_t *buffer, uint32_t stride, u
     {
         for (uint32_t x = 0; x < 8; x++)
         {
-            uint8_t colour = 0;
-            pixel_t p = buffer [x + y * stride];
-
-            colour = tms9928a_rgb_to_colour_index (p);
+            uint8_t colour = buffer [x + y * stride];
 
             /* Check if the colour is already in the colour-table byte */
             if ((test_ct_entry_size >= 1 && colour == test_ct_entry [0]) ||
@@ -394,34 +449,34 @@ static void tms9928a_generate_ct_test_entry (pixel_t *buffer, uint32_t stride, u
 
 
 /*
- * Compare the current colour-table entry against the
+ * Compare a colour-table entry against a tile's
  * test-entry to see if they are compatible.
  *
- * Expects that when called, each ct_entry contains no more than two colours.
+ * Expects that when called, each entry contains no more than two colours.
  */
-static bool tms9928a_check_ct_compatible (void)
+static bool tms9928a_ct_compatible (const uint8_t *entry, uint32_t entry_size, const uint8_t *test, uint32_t test_size)
 {
     /* A fresh palette is always safe */
-    if (ct_entry_size == 0)
+    if (entry_size == 0)
     {
         return true;
     }
 
     /* If the palette already contains one colour, then
      * the new tile may add up to one additional colour. */
-    else if (ct_entry_size == 1)
+    else if (entry_size == 1)
     {
-        return (test_ct_entry_size == 1 ||
-                test_ct_entry [0] == ct_entry [0] || test_ct_entry [1] == ct_entry [0]);
+        return (test_size == 1 ||
+                test [0] == entry [0] || test [1] == entry [0]);
     }
 
     /* If the palette already contains two colours, then
      * the new tile may not add any additional colours. */
-    else if (ct_entry_size == 2)
+    else if (entry_size == 2)
     {
-        return (test_ct_entry_size == 1 && (test_ct_entry [0] == ct_entry [0] || test_ct_entry [0] == ct_entry [1])) ||
-               (test_ct_entry [0] == ct_entry [0] && test_ct_entry [1] == ct_entry [1]) ||
-               (test_ct_entry [0] == ct_entry [1] && test_ct_entry [1] == ct_entry [0]);
+        return (test_size == 1 && (test [0] == entry [0] || test [0] == entry [1])) ||
+               (test [0] == entry [0] && test [1] == entry [1]) ||
+               (test [0] == entry [1] && test [1] == entry [0]);
 
     }
 
@@ -430,10 +485,20 @@ static bool tms9928a_check_ct_compatible (void)
 }
 
 
+/*
+ * Compare the current colour-table entry against the
+ * test-entry to see if they are compatible.
+ */
+static bool tms9928a_check_ct_compatible (void)
+{
+    return tms9928a_ct_compatible (ct_entry, ct_entry_size, test_ct_entry, test_ct_entry_size);
+}
+
+
 /*
  * Process a single 8×8 tile.
  */
-static void tms9928a_process_tile_8 (pixel_t *buffer, uint32_t stride)
+static int tms9928a_process_tile_8 (pixel_t *buffer, uint32_t stride)
 {
     uint8_t pattern_lines [8] = { };
     uint8_t pattern_colours [8] = { }; /* For mode-2 */
@@ -448,7 +513,7 @@ static void tms9928a_process_tile_8 (pixel_t *buffer, uint32_t stride)
         if (test_ct_entry_size > 2)
         {
             fprintf (stderr, "Error: Tile contains too many colours for mode-0.\n");
-            return;
+            return RC_ERROR;
         }
 
         /* If the colours are not compatible, we need to emit dummy
@@ -479,7 +544,7 @@ static void tms9928a_process_tile_8 (pixel_t *buffer, uint32_t stride)
             if (test_ct_entry_size > 2)
             {
                 fprintf (stderr, "Error: Line contains too many colours for mode-0.\n");
-                return;
+                return RC_ERROR;
             }
             ct_entry_size = 0;
         }
@@ -487,7 +552,7 @@ static void tms9928a_process_tile_8 (pixel_t *buffer, uint32_t stride)
         for (uint32_t x = 0; x < 8; x++)
         {
             pixel_t p = buffer [x + y * stride];
-            uint8_t bit = tms9928a_rgb_to_ct_bit (p);
+            uint8_t bit = tms9928a_pixel_to_ct_bit (p);
 
             /* Convert to 1-bit-per-pixel representation */
             if (bit)
@@ -525,6 +590,306 @@ static void tms9928a_process_tile_8 (pixel_t *buffer, uint32_t stride)
     }
 
     pattern_index++;
+
+    return RC_OK;
+}
+
+
+/*
+ * Gather a tile for de-duplication, adding it to the
+ * distinct tiles of the file if it has not been seen before.
+ */
+static void tms9928a_gather_tile (pixel_t *buffer)
+{
+    uint32_t stride = current_image.width;
+    tms9928a_tile_t tile = { };
+
+    /* Key on the colour of each pixel (FNV-1a) */
+    tile.digest = 0xcbf29ce484222325;
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        uint8_t colour = buffer [(i / 8) * stride + (i % 8)];
+        tile.colours [i / 2] |= (i & 1) ? (colour << 4) : colour;
+        if (i & 1)
+        {
+            tile.digest ^= tile.colours [i / 2];
+            tile.digest *= 0x100000001b3;
+        }
+    }
+
+    uint32_t mask = file_table_size - 1;
+    uint32_t slot = tile.digest & mask;
+    while (file_table [slot] != -1)
+    {
+        tms9928a_tile_t *existing = &file_tiles [file_table [slot]];
+        if (existing->digest == tile.digest && memcmp (existing->colours, tile.colours, sizeof (tile.colours)) == 0)
+        {
+            file_positions [file_positions_count++] = file_table [slot];
+            return;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    /* The colours needed in mode-0 */
+    tms9928a_generate_ct_test_entry (buffer, stride, 8);
+    memcpy (tile.ct_colours, test_ct_entry, sizeof (tile.ct_colours));
+    tile.ct_colours_size = test_ct_entry_size;
+
+    file_tiles [file_tiles_count] = tile;
+    file_table [slot] = file_tiles_count;
+    file_positions [file_positions_count++] = file_tiles_count++;
+}
+
+
+/*
+ * Add a tile to a simulated mode-0 colour-table state,
+ * counting any padding needed before the tile.
+ */
+static void tms9928a_block_add (tms9928a_block_t *block, const tms9928a_tile_t *tile)
+{
+    if (!tms9928a_ct_compatible (block->colours, block->size, tile->ct_colours, tile->ct_colours_size))
+    {
+        if (block->pattern_index % 8 != 0)
+        {
+            block->padding += 8 - block->pattern_index % 8;
+            block->pattern_index += 8 - block->pattern_index % 8;
+        }
+        block->size = 0;
+    }
+
+    for (uint32_t i = 0; i < tile->ct_colours_size && i < 2; i++)
+    {
+        uint8_t colour = tile->ct_colours [i];
+        bool present = (block->size >= 1 && block->colours [0] == colour) ||
+                       (block->size >= 2 && block->colours [1] == colour);
+
+        if (!present && block->size < 2)
+        {
+            block->colours [block->size++] = colour;
+        }
+    }
+
+    block->pattern_index++;
+}
+
+
+/*
+ * Choose an order for the distinct tiles of a mode-0 file. Tiles that fit the
+ * current colour-table entry are taken first, those sharing its exact pair of
+ * colours before single-colour tiles, which can fill the gaps of any block with
+ * their colour. When nothing fits, a new block is started with the pair of
+ * colours that has the most tiles left.
+ * Returns the padding needed, as simulated from the given state.
+ */
+static uint32_t tms9928a_mode0_order (tms9928a_block_t block, uint32_t *order)
+{
+    uint16_t pair_count [16] [16] = { };
+    uint16_t single_count [16] = { };
+    bool *taken = calloc (file_tiles_count, sizeof (bool));
+
+    if (taken == NULL)
+    {
+        return UINT32_MAX;
+    }
+
+    for (uint32_t i = 0; i < file_tiles_count; i++)
+    {
+        const tms9928a_tile_t *tile = &file_tiles [i];
+        if (tile->ct_colours_size == 2)
+        {
+            pair_count [tile->ct_colours [0]] [tile->ct_colours [1]]++;
+            pair_count [tile->ct_colours [1]] [tile->ct_colours [0]]++;
+        }
+        else if (tile->ct_colours_size == 1)
+        {
+            single_count [tile->ct_colours [0]]++;
+        }
+    }
+
+    for (uint32_t n = 0; n < file_tiles_count; n++)
+    {
+        uint32_t best = 0;
+        uint32_t best_rank = UINT32_MAX;
+        uint32_t best_group = 0;
+
+        for (uint32_t i = 0; i < file_tiles_count; i++)
+        {
+            const tms9928a_tile_t *tile = &file_tiles [i];
+            bool compatible = tms9928a_ct_compatible (block.colours, block.size, tile->ct_colours, tile->ct_colours_size);
+            bool pair = (tile->ct_colours_size == 2);
+            uint32_t group = pair ? pair_count [tile->ct_colours [0]] [tile->ct_colours [1]]
+                                  : single_count [tile->ct_colours [0]];
+            uint32_t rank;
+
+            if (taken [i])
+            {
+                continue;
+            }
+
+            if (tile->ct_colours_size > 2)
+            {
+                rank = 8;
+            }
+            else if (compatible && block.size == 2)
+            {
+                rank = pair ? 0 : 1;
+            }
+            else if (compatible && block.size == 1)
+            {
+                rank = pair ? 2 : (tile->ct_colours [0] == block.colours [0]) ? 3 : 5;
+            }
+            else if (compatible || block.pattern_index % 8 == 0)
+            {
+                /* A new block, without padding */
+                rank = pair ? 4 : 5;
+            }
+            else
+            {
+                rank = pair ? 6 : 7;
+            }
+
+            if (rank < best_rank || (rank == best_rank && group > best_group))
+            {
+                best = i;
+                best_rank = rank;
+                best_group = group;
+            }
+        }
+
+        const tms9928a_tile_t *tile = &file_tiles [best];
+        if (tile->ct_colours_size == 2)
+        {
+            pair_count [tile->ct_colours [0]] [tile->ct_colours [1]]--;
+            pair_count [tile->ct_colours [1]] [tile->ct_colours [0]]--;
+        }
+        else if (tile->ct_colours_size == 1)
+        {
+            single_count [tile->ct_colours [0]]--;
+        }
+
+        taken [best] = true;
+        order [n] = best;
+        tms9928a_block_add (&block, tile);
+    }
+
+    free (taken);
+    return block.padding;
+}
+
+
+/*
+ * Write the name-table indices of a de-duplicated file.
+ */
+static void tms9928a_write_indices (void)
+{
+    /* Strip the extension for the array name */
+    char *base_name = strdup (input_filename);
+    char *extension = strchr (base_name, '.');
+    if (extension)
+    {
+        extension [0] = '\0';
+    }
+
+    fprintf (pattern_index_file, "\nconst uint16_t %s_indices [%d] = {\n   ", base_name, file_positions_count);
+    free (base_name);
+
+    uint32_t tile_count = 0;
+    for (uint32_t i = 0; i < file_positions_count; i++)
+    {
+        fprintf (pattern_index_file, " 0x%04x", file_tiles [file_positions [i]].pattern);
+
+        fprintf (pattern_index_file, "%s", (tile_count == 11) ? ",\n   " : ",");
+        tile_count = (tile_count + 1) % 12;
+    }
+    if (tile_count != 0)
+    {
+        fprintf (pattern_index_file, "\n");
+    }
+
+    fprintf (pattern_index_file, "};\n");
+}
+
+
+/*
+ * Complete a source file.
+ * With de-duplication, the distinct tiles are converted, followed by the indices.
+ */
+int tms9928a_end_input_file (void)
+{
+    if (!tms_dedupe)
+    {
+        return RC_OK;
+    }
+
+    uint32_t *order = calloc (file_tiles_count + 1, sizeof (uint32_t));
+    if (order == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for de-duplication.\n");
+        return RC_ERROR;
+    }
+
+    /* Distinct tiles are in the order they were found. In mode-0, they are
+     * re-ordered by colour if that needs less padding. */
+    for (uint32_t i = 0; i < file_tiles_count; i++)
+    {
+        order [i] = i;
+    }
+
+    if (target == VDP_MODE_0)
+    {
+        tms9928a_block_t block = { .size = ct_entry_size, .pattern_index = pattern_index };
+        memcpy (block.colours, ct_entry, sizeof (block.colours));
+
+        tms9928a_block_t in_order = block;
+        for (uint32_t i = 0; i < file_tiles_count; i++)
+        {
+            tms9928a_block_add (&in_order, &file_tiles [i]);
+        }
+
+        uint32_t *grouped = calloc (file_tiles_count + 1, sizeof (uint32_t));
+        uint32_t padding = (grouped == NULL) ? UINT32_MAX : tms9928a_mode0_order (block, grouped);
+        if (padding < in_order.padding)
+        {
+            free (order);
+            order = grouped;
+        }
+        else
+        {
+            free (grouped);
+            padding = in_order.padding;
+        }
+
+        output_report ("%s: %u tiles, %u patterns after de-duplication, %u padding patterns (%u saved by grouping colours)\n",
+                       input_filename, file_positions_count, file_tiles_count, padding, in_order.padding - padding);
+    }
+    else
+    {
+        output_report ("%s: %u tiles, %u patterns after de-duplication\n",
+                       input_filename, file_positions_count, file_tiles_count);
+    }
+
+    for (uint32_t i = 0; i < file_tiles_count; i++)
+    {
+        tms9928a_tile_t *tile = &file_tiles [order [i]];
+        pixel_t pixels [64];
+
+        for (uint32_t p = 0; p < 64; p++)
+        {
+            pixels [p] = (p & 1) ? (tile->colours [p / 2] >> 4) : (tile->colours [p / 2] & 0x0f);
+        }
+
+        if (tms9928a_process_tile_8 (pixels, 8) != RC_OK)
+        {
+            free (order);
+            return RC_ERROR;
+        }
+        tile->pattern = pattern_index - 1;
+    }
+    free (order);
+
+    tms9928a_write_indices ();
+
+    return RC_OK;
 }
 
 
@@ -537,6 +902,13 @@ void tms9928a_process_tile (pixel_t *buffer)
 {
     uint32_t stride = current_image.width;
 
+    /* With de-duplication, tiles are converted at the end of the file */
+    if (tms_dedupe)
+    {
+        tms9928a_gather_tile (buffer);
+        return;
+    }
+
     if (target == VDP_MODE_TMS_LARGE_SPRITES)
     {
         /* Sprite layout: 0 2
@@ -10,7 +10,13 @@ int tms9928a_open_files (void);
 int tms9928a_close_files (void);
 
 /* Mark the start of a new source file. */
-void tms9928a_new_input_file (const char *name);
+int tms9928a_new_input_file (const char *name);
+
+/* Complete a source file. */
+int tms9928a_end_input_file (void);
+
+/* Convert an RGBA colour to the indexed tms9928a colour. */
+bool tms9928a_pixel (uint8_t r, uint8_t g, uint8_t b, uint8_t a, pixel_t *pixel);
 
 /* Process a single tile. */
 void tms9928a_process_tile (pixel_t *buffer);
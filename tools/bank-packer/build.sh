@@ -0,0 +1,7 @@
+#!/bin/sh
+
+CC=gcc
+CFLAGS="-std=c11 -O1 -Wall -Werror"
+
+
+$CC $CFLAGS source/*.c -o bank-packer
@@ -0,0 +1,1103 @@
+/*
+ * Bank Packer
+ * Ants for Master System
+ *
+ * This is a tool to place pcmenc sound data into 16 KiB ROM
+ * banks, and to generate the C sources that describe where
+ * each sound ended up.
+ *
+ * Sounds larger than a bank must be encoded with pcmenc's
+ * -r option, so that each bank-sized part is a complete
+ * RLE stream that can be played on its own.
+ *
+ * Each part is played as a list of segments. Runs of data that
+ * already exist in an earlier part are found using a rolling-hash
+ * index, and are played from there instead of being stored again.
+ *
+ * The stored data is placed using first-fit-decreasing, followed
+ * by an exhaustive search for a placement that uses fewer banks.
+ * Space left over in banks that already hold other data can be
+ * offered to the packer with --reserve. New banks are numbered
+ * from --first-bank, skipping the numbers of reserved banks.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define RC_OK       0
+#define RC_ERROR   -1
+
+#define MAX_SOUNDS      64
+#define MAX_PARTS      128
+#define MAX_BANKS       64
+#define MAX_SEGMENTS  4096
+#define SEARCH_LIMIT    10000000
+
+#define HASH_WINDOW       16
+#define HASH_BITS         16
+#define HASH_BASE        257
+#define MATCH_CANDIDATES 256
+
+/* Bytes used by each entry in the generated segment table */
+#define SEGMENT_RECORD_SIZE 6
+
+typedef struct sound_s {
+    char name [64];         /* C-friendly name, eg. build_castle */
+    uint8_t *data;
+    uint32_t size;
+    uint32_t part_count;
+} sound_t;
+
+typedef struct part_s {
+    uint32_t sound;
+    uint32_t index;         /* Part number within the sound, starting at 1 */
+    const uint8_t *data;    /* RLE stream, as generated by pcmenc */
+    uint32_t size;
+    uint8_t *store;         /* Data that is stored in ROM for this part */
+    uint32_t store_size;
+    uint32_t first_segment;
+    uint32_t bank;          /* Index into banks [] */
+} part_t;
+
+typedef struct segment_s {
+    uint32_t part;          /* Part whose stored data is played */
+    uint32_t offset;        /* Offset into the stored data */
+    uint32_t triplets;
+    bool continued;         /* Continue from the replayer state left by the previous segment */
+} segment_t;
+
+typedef struct hash_entry_s {
+    uint32_t part;
+    uint32_t offset;
+    int32_t next;
+} hash_entry_t;
+
+typedef struct bank_s {
+    uint32_t number;
+    uint32_t reserved;      /* Bytes already used by other data */
+    uint32_t used;          /* Bytes used, including the reserved bytes */
+} bank_t;
+
+static uint32_t bank_size = 16384;
+static uint32_t first_bank = 5;
+static uint32_t min_segment = 32;
+static char *output_dir = ".";
+
+static sound_t sounds [MAX_SOUNDS];
+static uint32_t sound_count = 0;
+
+static part_t parts [MAX_PARTS];
+static uint32_t part_count = 0;
+
+/* Parts, in the order they are placed into banks */
+static uint32_t order [MAX_PARTS];
+
+static segment_t segments [MAX_SEGMENTS];
+static uint32_t segment_count = 0;
+
+/* Rolling-hash index of every window of stored data */
+static int32_t hash_head [1 << HASH_BITS];
+static hash_entry_t *hash_entries = NULL;
+static uint32_t hash_entry_count = 0;
+
+static bank_t banks [MAX_BANKS];
+static uint32_t reserved_bank_count = 0;
+static uint32_t bank_count = 0;
+
+
+/*
+ * Find the length of a 4-bit RLE stream, as generated by pcmenc.
+ *
+ * The stream starts with a 16-bit triplet count. Each byte holds
+ * a volume in the low nibble and a hold-count in the high nibble.
+ * This steps through the stream in the same way as the replayer.
+ *
+ * If cut is not NULL, the offset of the first byte read for each
+ * triplet is stored, followed by the end of the stream.
+ *
+ * Returns 0 if the stream would run past the end of the data.
+ */
+static uint32_t rle_stream_length (const uint8_t *data, uint32_t size, uint32_t *cut)
+{
+    uint8_t counter [3] = { 0, 0, 0 };
+    uint32_t triplets;
+    uint32_t offset = 2;
+
+    if (size < 2)
+    {
+        return 0;
+    }
+
+    triplets = data [0] | (data [1] << 8);
+
+    for (uint32_t triplet = 0; triplet < triplets; triplet++)
+    {
+        if (cut != NULL)
+        {
+            cut [triplet] = offset;
+        }
+
+        for (uint32_t channel = 0; channel < 3; channel++)
+        {
+            if (counter [channel] >= 0x10)
+            {
+                counter [channel] -= 0x10;
+            }
+            else if (offset < size)
+            {
+                counter [channel] = data [offset++];
+            }
+            else
+            {
+                return 0;
+            }
+        }
+    }
+
+    if (cut != NULL)
+    {
+        cut [triplets] = offset;
+    }
+
+    return offset;
+}
+
+
+/*
+ * Read a pcmenc output file and split it into bank-sized parts.
+ */
+static int sound_load (const char *path)
+{
+    sound_t *sound = &sounds [sound_count];
+    const char *base;
+    FILE *file;
+    size_t i;
+
+    if (sound_count == MAX_SOUNDS)
+    {
+        fprintf (stderr, "Error: Too many sounds.\n");
+        return RC_ERROR;
+    }
+
+    /* Name the sound after the file, up to the first '.' */
+    base = strrchr (path, '/');
+    base = (base == NULL) ? path : base + 1;
+    for (i = 0; base [i] != '\0' && base [i] != '.' && i < sizeof (sound->name) - 1; i++)
+    {
+        sound->name [i] = (base [i] == '-') ? '_' : base [i];
+    }
+    sound->name [i] = '\0';
+
+    file = fopen (path, "rb");
+    if (file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    fseek (file, 0, SEEK_END);
+    sound->size = ftell (file);
+    fseek (file, 0, SEEK_SET);
+
+    sound->data = malloc (sound->size);
+    if (sound->data == NULL || fread (sound->data, 1, sound->size, file) != sound->size)
+    {
+        fprintf (stderr, "Error: Unable to read %s.\n", path);
+        fclose (file);
+        return RC_ERROR;
+    }
+    fclose (file);
+
+    /* pcmenc pads each part of a split sound out to the bank size,
+     * so trim each part down to the length of its RLE stream. */
+    for (uint32_t offset = 0; offset < sound->size; offset += bank_size)
+    {
+        uint32_t available = sound->size - offset;
+        uint32_t length;
+
+        if (part_count == MAX_PARTS)
+        {
+            fprintf (stderr, "Error: Too many sound parts.\n");
+            return RC_ERROR;
+        }
+
+        if (available > bank_size)
+        {
+            available = bank_size;
+        }
+
+        length = rle_stream_length (&sound->data [offset], available, NULL);
+        if (length == 0)
+        {
+            fprintf (stderr, "Error: %s is not a valid RLE stream. Sounds larger than a bank must be encoded with -r %u.\n",
+                     path, bank_size / 1024);
+            return RC_ERROR;
+        }
+
+        parts [part_count].sound = sound_count;
+        parts [part_count].index = ++sound->part_count;
+        parts [part_count].data = &sound->data [offset];
+        parts [part_count].size = length;
+        part_count++;
+    }
+
+    sound_count++;
+
+    return RC_OK;
+}
+
+
+/*
+ * Hash a window of data.
+ */
+static uint32_t hash_window (const uint8_t *data)
+{
+    uint32_t hash = 0;
+
+    for (uint32_t i = 0; i < HASH_WINDOW; i++)
+    {
+        hash = hash * HASH_BASE + data [i];
+    }
+
+    return hash;
+}
+
+
+/*
+ * Get the index bucket for a window hash.
+ */
+static uint32_t hash_bucket (uint32_t hash)
+{
+    return (hash * 2654435761u) >> (32 - HASH_BITS);
+}
+
+
+/*
+ * Append a byte to a part's stored data, indexing the window that it completes.
+ * The hash of the previous window is rolled forward to cover the new byte.
+ */
+static void store_append (uint32_t p, uint8_t value, uint32_t *hash)
+{
+    static uint32_t base_power = 0;
+    part_t *part = &parts [p];
+
+    if (base_power == 0)
+    {
+        base_power = 1;
+        for (uint32_t i = 1; i < HASH_WINDOW; i++)
+        {
+            base_power *= HASH_BASE;
+        }
+    }
+
+    if (part->store_size >= HASH_WINDOW)
+    {
+        *hash -= part->store [part->store_size - HASH_WINDOW] * base_power;
+    }
+    *hash = *hash * HASH_BASE + value;
+
+    part->store [part->store_size++] = value;
+
+    if (part->store_size >= HASH_WINDOW)
+    {
+        uint32_t bucket = hash_bucket (*hash);
+
+        hash_entries [hash_entry_count].part = p;
+        hash_entries [hash_entry_count].offset = part->store_size - HASH_WINDOW;
+        hash_entries [hash_entry_count].next = hash_head [bucket];
+        hash_head [bucket] = hash_entry_count++;
+    }
+}
+
+
+/*
+ * Find the longest run of stored data that matches the start of the given data.
+ */
+static uint32_t match_find (const uint8_t *data, uint32_t size, uint32_t *match_part, uint32_t *match_offset)
+{
+    uint32_t best = 0;
+    uint32_t candidates = 0;
+
+    if (size < HASH_WINDOW)
+    {
+        return 0;
+    }
+
+    for (int32_t entry = hash_head [hash_bucket (hash_window (data))];
+         entry >= 0 && candidates < MATCH_CANDIDATES;
+         entry = hash_entries [entry].next, candidates++)
+    {
+        const part_t *part = &parts [hash_entries [entry].part];
+        uint32_t offset = hash_entries [entry].offset;
+        uint32_t available = part->store_size - offset;
+        uint32_t length = 0;
+
+        if (available > size)
+        {
+            available = size;
+        }
+
+        while (length < available && part->store [offset + length] == data [length])
+        {
+            length++;
+        }
+
+        if (length > best)
+        {
+            best = length;
+            *match_part = hash_entries [entry].part;
+            *match_offset = offset;
+        }
+    }
+
+    return best;
+}
+
+
+/*
+ * Add a segment to the list.
+ */
+static int segment_add (uint32_t part, uint32_t offset, uint32_t triplets, bool continued)
+{
+    if (segment_count == MAX_SEGMENTS)
+    {
+        fprintf (stderr, "Error: Too many segments.\n");
+        return RC_ERROR;
+    }
+
+    segments [segment_count].part = part;
+    segments [segment_count].offset = offset;
+    segments [segment_count].triplets = triplets;
+    segments [segment_count].continued = continued;
+    segment_count++;
+
+    return RC_OK;
+}
+
+
+/*
+ * Split a part into segments. Runs of at least min_segment bytes that are already
+ * stored are played from their existing location, everything else is stored.
+ *
+ * The replayer can only move between segments at a triplet boundary, so a
+ * match is shortened to end at the last boundary that it covers.
+ */
+static int part_segment (uint32_t p)
+{
+    part_t *part = &parts [p];
+    const uint8_t *stream = part->data + 2;
+    uint32_t stream_size = part->size - 2;
+    uint32_t triplets = part->data [0] | (part->data [1] << 8);
+    uint32_t *cut = malloc ((triplets + 1) * sizeof (uint32_t));
+    bool literal = false;
+    uint32_t hash = 0;
+
+    part->store = malloc (stream_size > 0 ? stream_size : 1);
+    part->store_size = 0;
+    part->first_segment = segment_count;
+
+    if (cut == NULL || part->store == NULL)
+    {
+        fprintf (stderr, "Error: Unable to allocate memory.\n");
+        return RC_ERROR;
+    }
+
+    rle_stream_length (part->data, part->size, cut);
+
+    /* Make the offsets relative to the start of the data */
+    for (uint32_t t = 0; t <= triplets; t++)
+    {
+        cut [t] -= 2;
+    }
+
+    for (uint32_t t = 0; t < triplets;)
+    {
+        uint32_t match_part = 0;
+        uint32_t match_offset = 0;
+        uint32_t match_length = 0;
+        uint32_t end = t;
+
+        if (min_segment > 0)
+        {
+            match_length = match_find (&stream [cut [t]], stream_size - cut [t], &match_part, &match_offset);
+        }
+
+        while (end < triplets && cut [end + 1] - cut [t] <= match_length)
+        {
+            end++;
+        }
+
+        if (min_segment > 0 && end > t && cut [end] - cut [t] >= min_segment)
+        {
+            /* Play from the existing copy */
+            if (segment_add (match_part, match_offset, end - t, t > 0) != RC_OK)
+            {
+                return RC_ERROR;
+            }
+            literal = false;
+            t = end;
+        }
+        else
+        {
+            /* Store the data for this triplet */
+            if (!literal)
+            {
+                if (segment_add (p, part->store_size, 0, t > 0) != RC_OK)
+                {
+                    return RC_ERROR;
+                }
+                literal = true;
+            }
+
+            for (uint32_t i = cut [t]; i < cut [t + 1]; i++)
+            {
+                store_append (p, stream [i], &hash);
+            }
+            segments [segment_count - 1].triplets++;
+            t++;
+        }
+    }
+
+    free (cut);
+
+    return RC_OK;
+}
+
+
+/*
+ * Split every part into segments, sharing data between them where possible.
+ */
+static int segment_all (void)
+{
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        total += parts [i].size;
+    }
+
+    hash_entries = malloc ((total + 1) * sizeof (hash_entry_t));
+    if (hash_entries == NULL)
+    {
+        fprintf (stderr, "Error: Unable to allocate memory.\n");
+        return RC_ERROR;
+    }
+    memset (hash_head, -1, sizeof (hash_head));
+
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        if (part_segment (i) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Sort parts from largest to smallest.
+ */
+static int part_compare (const void *a, const void *b)
+{
+    const part_t *part_a = &parts [*(const uint32_t *) a];
+    const part_t *part_b = &parts [*(const uint32_t *) b];
+
+    if (part_a->store_size != part_b->store_size)
+    {
+        return (part_a->store_size < part_b->store_size) ? 1 : -1;
+    }
+
+    /* Keep the output stable for parts of equal size */
+    return (*(const uint32_t *) a > *(const uint32_t *) b) ? 1 : -1;
+}
+
+
+/*
+ * Number a new bank. New banks are numbered from first_bank,
+ * skipping any numbers already used by reserved banks.
+ */
+static uint32_t bank_number_new (uint32_t new_bank)
+{
+    uint32_t number = first_bank;
+
+    while (true)
+    {
+        bool reserved = false;
+
+        for (uint32_t i = 0; i < reserved_bank_count; i++)
+        {
+            if (banks [i].number == number)
+            {
+                reserved = true;
+                break;
+            }
+        }
+
+        if (!reserved)
+        {
+            if (new_bank == 0)
+            {
+                return number;
+            }
+            new_bank--;
+        }
+        number++;
+    }
+}
+
+
+/*
+ * Reset the banks to hold only their reserved data, with
+ * the given number of new banks available after them.
+ */
+static void banks_reset (uint32_t new_banks)
+{
+    bank_count = reserved_bank_count + new_banks;
+
+    for (uint32_t i = 0; i < bank_count; i++)
+    {
+        if (i >= reserved_bank_count)
+        {
+            banks [i].number = bank_number_new (i - reserved_bank_count);
+            banks [i].reserved = 0;
+        }
+        banks [i].used = banks [i].reserved;
+    }
+}
+
+
+/*
+ * First-fit-decreasing placement. Parts must already be sorted.
+ * Returns the number of new banks needed.
+ */
+static int pack_first_fit_decreasing (void)
+{
+    banks_reset (0);
+
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        part_t *part = &parts [order [i]];
+        uint32_t bank;
+
+        for (bank = 0; bank < bank_count; bank++)
+        {
+            if (banks [bank].used + part->store_size <= bank_size)
+            {
+                break;
+            }
+        }
+
+        if (bank == bank_count)
+        {
+            if (bank_count == MAX_BANKS)
+            {
+                return RC_ERROR;
+            }
+            banks [bank_count].number = bank_number_new (bank_count - reserved_bank_count);
+            banks [bank_count].reserved = 0;
+            banks [bank_count].used = 0;
+            bank_count++;
+        }
+
+        banks [bank].used += part->store_size;
+        part->bank = bank;
+    }
+
+    return bank_count - reserved_bank_count;
+}
+
+
+/*
+ * Depth-first search for a placement of the remaining parts into the current banks.
+ * Empty banks are interchangeable, so only the first empty bank is tried for each part.
+ */
+static bool pack_search (uint32_t i, uint32_t *nodes)
+{
+    bool tried_empty = false;
+    part_t *part;
+
+    if (i == part_count)
+    {
+        return true;
+    }
+    part = &parts [order [i]];
+
+    if (++*nodes > SEARCH_LIMIT)
+    {
+        return false;
+    }
+
+    for (uint32_t bank = 0; bank < bank_count; bank++)
+    {
+        if (banks [bank].used + part->store_size > bank_size)
+        {
+            continue;
+        }
+
+        if (banks [bank].used == 0)
+        {
+            if (tried_empty)
+            {
+                continue;
+            }
+            tried_empty = true;
+        }
+
+        banks [bank].used += part->store_size;
+        part->bank = bank;
+
+        if (pack_search (i + 1, nodes))
+        {
+            return true;
+        }
+
+        banks [bank].used -= part->store_size;
+    }
+
+    return false;
+}
+
+
+/*
+ * Place the parts into banks, using as few new banks as we can find.
+ */
+static int pack (void)
+{
+    uint32_t part_bank [MAX_PARTS];
+    uint32_t total = 0;
+    uint32_t available = 0;
+    uint32_t lower_bound = 0;
+    int ffd_banks;
+
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        order [i] = i;
+    }
+    qsort (order, part_count, sizeof (uint32_t), part_compare);
+
+    ffd_banks = pack_first_fit_decreasing ();
+    if (ffd_banks < 0)
+    {
+        fprintf (stderr, "Error: Too many banks.\n");
+        return RC_ERROR;
+    }
+
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        part_bank [i] = parts [i].bank;
+        total += parts [i].store_size;
+    }
+    for (uint32_t i = 0; i < reserved_bank_count; i++)
+    {
+        available += bank_size - banks [i].reserved;
+    }
+    if (total > available)
+    {
+        lower_bound = (total - available + bank_size - 1) / bank_size;
+    }
+
+    /* Look for a placement that needs fewer new banks than first-fit-decreasing */
+    for (uint32_t new_banks = lower_bound; new_banks < (uint32_t) ffd_banks; new_banks++)
+    {
+        uint32_t nodes = 0;
+
+        banks_reset (new_banks);
+        if (pack_search (0, &nodes))
+        {
+            printf ("  Search found a placement using %u new banks, first-fit-decreasing used %d.\n", new_banks, ffd_banks);
+            return RC_OK;
+        }
+        if (nodes > SEARCH_LIMIT)
+        {
+            printf ("  Search limit reached, using first-fit-decreasing.\n");
+            break;
+        }
+    }
+
+    /* Restore the first-fit-decreasing placement */
+    banks_reset (ffd_banks);
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        parts [i].bank = part_bank [i];
+        banks [part_bank [i]].used += parts [i].store_size;
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Get the C name of a part's data.
+ */
+static void part_name (const part_t *part, char *name, size_t size)
+{
+    const sound_t *sound = &sounds [part->sound];
+
+    if (sound->part_count == 1)
+    {
+        snprintf (name, size, "%s_sound", sound->name);
+    }
+    else
+    {
+        snprintf (name, size, "%s_sound_%u", sound->name, part->index);
+    }
+}
+
+
+/*
+ * Write a part's data as a C header file.
+ */
+static int part_write (const part_t *part)
+{
+    char path [320];
+    char name [80];
+    FILE *file;
+
+    part_name (part, name, sizeof (name));
+    snprintf (path, sizeof (path), "%s/%s.h", output_dir, name);
+
+    file = fopen (path, "w");
+    if (file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    fprintf (file, "const uint8_t %s [] = {", name);
+    for (uint32_t i = 0; i < part->store_size; i++)
+    {
+        fprintf (file, "%s0x%02x%s", (i % 12) ? " " : "\n    ", part->store [i],
+                                     (i == part->store_size - 1) ? "" : ",");
+    }
+    fprintf (file, "\n};\n");
+
+    fclose (file);
+
+    return RC_OK;
+}
+
+
+/*
+ * Write the bank sources, along with the sound index and table headers.
+ */
+static int sources_write (void)
+{
+    char path [320];
+    char name [80];
+    FILE *file;
+
+    /* Each bank is written to its own file, so the numbers must not repeat */
+    for (uint32_t bank = 0; bank < bank_count; bank++)
+    {
+        for (uint32_t other = bank + 1; other < bank_count; other++)
+        {
+            if (banks [bank].number == banks [other].number)
+            {
+                fprintf (stderr, "Error: Bank %u is used more than once.\n", banks [bank].number);
+                return RC_ERROR;
+            }
+        }
+    }
+
+    /* Part data. Parts that are played entirely from other parts don't store anything. */
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        if (parts [i].store_size > 0 && part_write (&parts [i]) != RC_OK)
+        {
+            return RC_ERROR;
+        }
+    }
+
+    /* One source file per bank */
+    for (uint32_t bank = 0; bank < bank_count; bank++)
+    {
+        if (banks [bank].used == banks [bank].reserved)
+        {
+            continue;
+        }
+
+        snprintf (path, sizeof (path), "%s/sound_bank_%u.c", output_dir, banks [bank].number);
+        file = fopen (path, "w");
+        if (file == NULL)
+        {
+            fprintf (stderr, "Error: Unable to open %s.\n", path);
+            return RC_ERROR;
+        }
+
+        fprintf (file, "/*\n");
+        fprintf (file, " * Bank %u - Sound data, generated by bank-packer.\n", banks [bank].number);
+        fprintf (file, " */\n\n");
+        fprintf (file, "#include <stdint.h>\n");
+        for (uint32_t i = 0; i < part_count; i++)
+        {
+            if (parts [i].bank == bank && parts [i].store_size > 0)
+            {
+                part_name (&parts [i], name, sizeof (name));
+                fprintf (file, "#include \"%s.h\"\n", name);
+            }
+        }
+
+        fclose (file);
+    }
+
+    /* Sound index, one define per sound */
+    snprintf (path, sizeof (path), "%s/sound_index.h", output_dir);
+    file = fopen (path, "w");
+    if (file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    fprintf (file, "/*\n");
+    fprintf (file, " * Sound index, generated by bank-packer.\n");
+    fprintf (file, " */\n\n");
+    for (uint32_t sound = 0; sound < sound_count; sound++)
+    {
+        char define [80] = "SOUND_";
+
+        for (uint32_t i = 0; sounds [sound].name [i] != '\0'; i++)
+        {
+            char c = sounds [sound].name [i];
+            define [6 + i] = (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+            define [7 + i] = '\0';
+        }
+        fprintf (file, "#define %-30s %u\n", define, sound);
+    }
+    fprintf (file, "#define %-30s %u\n", "SOUND_COUNT", sound_count);
+    fclose (file);
+
+    /* Sound table, listing the segments that make up each sound */
+    snprintf (path, sizeof (path), "%s/sound_table.h", output_dir);
+    file = fopen (path, "w");
+    if (file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    fprintf (file, "/*\n");
+    fprintf (file, " * Sound table, generated by bank-packer.\n");
+    fprintf (file, " */\n\n");
+    fprintf (file, "/* The first three fields are read by PlaySampleSegment */\n");
+    fprintf (file, "typedef struct sound_segment_s {\n");
+    fprintf (file, "    uint16_t triplets;\n");
+    fprintf (file, "    const uint8_t *data;\n");
+    fprintf (file, "    uint8_t continued;\n");
+    fprintf (file, "    uint8_t bank;\n");
+    fprintf (file, "} sound_segment_t;\n\n");
+
+    for (uint32_t i = 0; i < part_count; i++)
+    {
+        if (parts [i].store_size > 0)
+        {
+            part_name (&parts [i], name, sizeof (name));
+            fprintf (file, "extern const uint8_t %s [];\n", name);
+        }
+    }
+
+    /* Parts are loaded in sound order, so the segments are already in playback order */
+    fprintf (file, "\n/* Segments, in playback order */\n");
+    fprintf (file, "static const sound_segment_t sound_segments [] = {\n");
+    for (uint32_t i = 0; i < segment_count; i++)
+    {
+        const part_t *part = &parts [segments [i].part];
+
+        part_name (part, name, sizeof (name));
+        fprintf (file, "    { .triplets = %5u, .data = %s + %u, .continued = %u, .bank = %2u },\n",
+                 segments [i].triplets, name, segments [i].offset, segments [i].continued, banks [part->bank].number);
+    }
+    fprintf (file, "};\n\n");
+
+    fprintf (file, "/* Index of the first segment of each sound, followed by the total number of segments */\n");
+    fprintf (file, "static const uint16_t sound_first_segment [SOUND_COUNT + 1] = {");
+    for (uint32_t sound = 0; sound <= sound_count; sound++)
+    {
+        uint32_t first = segment_count;
+
+        for (uint32_t i = 0; i < part_count; i++)
+        {
+            if (parts [i].sound == sound && parts [i].index == 1)
+            {
+                first = parts [i].first_segment;
+            }
+        }
+        fprintf (file, "%s %u", (sound == 0) ? "" : ",", first);
+    }
+    fprintf (file, " };\n");
+
+    fclose (file);
+
+    return RC_OK;
+}
+
+
+/*
+ * Print how full each bank is.
+ */
+static void report (void)
+{
+    uint32_t total = 0;
+    uint32_t new_banks = 0;
+
+    for (uint32_t bank = 0; bank < bank_count; bank++)
+    {
+        uint32_t sound_bytes = banks [bank].used - banks [bank].reserved;
+        if (sound_bytes == 0)
+        {
+            continue;
+        }
+
+        total += sound_bytes;
+        if (bank >= reserved_bank_count)
+        {
+            new_banks++;
+        }
+
+        printf ("  Bank %2u: %5u / %u bytes (%5.1f%%):", banks [bank].number, banks [bank].used, bank_size,
+                100.0 * banks [bank].used / bank_size);
+        for (uint32_t i = 0; i < part_count; i++)
+        {
+            if (parts [i].bank == bank)
+            {
+                char name [80];
+                part_name (&parts [i], name, sizeof (name));
+                printf (" %s", name);
+            }
+        }
+        printf ("\n");
+    }
+
+    printf ("  %u bytes of sound data, using %u new banks.\n", total, new_banks);
+}
+
+
+/*
+ * Print the bytes saved by sharing data between sounds.
+ * Each segment beyond the first in a part costs a table entry.
+ * The 2-byte triplet count of each part is not stored, as it moves into the
+ * part's first table entry, so it is left out of the sizes compared here.
+ */
+static void report_segments (void)
+{
+    int32_t total_saved = 0;
+
+    printf ("  Shared segments:\n");
+    for (uint32_t sound = 0; sound < sound_count; sound++)
+    {
+        uint32_t size = 0;
+        uint32_t store_size = 0;
+        uint32_t sound_segments = 0;
+        int32_t saved;
+
+        for (uint32_t i = 0; i < part_count; i++)
+        {
+            if (parts [i].sound == sound)
+            {
+                size += parts [i].size - 2;
+                store_size += parts [i].store_size;
+                sound_segments += ((i + 1 < part_count) ? parts [i + 1].first_segment : segment_count) - parts [i].first_segment;
+            }
+        }
+
+        saved = (int32_t) (size - store_size) - (int32_t) (sound_segments - sounds [sound].part_count) * SEGMENT_RECORD_SIZE;
+        total_saved += saved;
+
+        printf ("    %-24s %5u -> %5u bytes, %3u segments, %5d bytes saved\n",
+                sounds [sound].name, size, store_size, sound_segments, saved);
+    }
+    printf ("    %d bytes saved in total by sharing.\n", total_saved);
+    printf ("    %u bytes of triplet counts moved into the segment table.\n", part_count * 2);
+}
+
+
+/*
+ * Entry point.
+ */
+int main (int argc, char **argv)
+{
+    /* Parse options */
+    for (argc--, argv++; argc > 0 && argv [0][0] == '-'; argc--, argv++)
+    {
+        if (strcmp (argv [0], "--output-dir") == 0 && argc > 1)
+        {
+            output_dir = argv [1];
+            argc--, argv++;
+        }
+        else if (strcmp (argv [0], "--bank-size") == 0 && argc > 1)
+        {
+            bank_size = strtoul (argv [1], NULL, 0);
+            argc--, argv++;
+        }
+        else if (strcmp (argv [0], "--first-bank") == 0 && argc > 1)
+        {
+            first_bank = strtoul (argv [1], NULL, 0);
+            argc--, argv++;
+        }
+        else if (strcmp (argv [0], "--min-segment") == 0 && argc > 1)
+        {
+            /* Shortest run of data to share between sounds, 0 to disable sharing */
+            min_segment = strtoul (argv [1], NULL, 0);
+            argc--, argv++;
+        }
+        else if (strcmp (argv [0], "--reserve") == 0 && argc > 1)
+        {
+            /* --reserve <bank>:<bytes> offers the rest of an existing bank to the packer */
+            char *bytes = strchr (argv [1], ':');
+            if (bytes == NULL || reserved_bank_count == MAX_BANKS)
+            {
+                fprintf (stderr, "Error: Invalid reserve \"%s\".\n", argv [1]);
+                return EXIT_FAILURE;
+            }
+            banks [reserved_bank_count].number = strtoul (argv [1], NULL, 0);
+            banks [reserved_bank_count].reserved = strtoul (bytes + 1, NULL, 0);
+            reserved_bank_count++;
+            argc--, argv++;
+        }
+        else
+        {
+            fprintf (stderr, "Error: Unknown option \"%s\".\n", argv [0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (argc == 0)
+    {
+        fprintf (stderr, "Usage: bank-packer [--output-dir <dir>] [--bank-size <bytes>] [--first-bank <n>]\n");
+        fprintf (stderr, "                   [--min-segment <bytes>] [--reserve <bank>:<bytes>]... <sound.pcmenc>...\n");
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t i = 0; i < reserved_bank_count; i++)
+    {
+        if (banks [i].reserved > bank_size)
+        {
+            fprintf (stderr, "Error: Bank %u is already over-full.\n", banks [i].number);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (; argc > 0; argc--, argv++)
+    {
+        if (sound_load (argv [0]) != RC_OK)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (segment_all () != RC_OK || pack () != RC_OK || sources_write () != RC_OK)
+    {
+        return EXIT_FAILURE;
+    }
+
+    report ();
+    report_segments ();
+
+    return EXIT_SUCCESS;
+}
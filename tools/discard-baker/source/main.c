@@ -0,0 +1,218 @@
+/*
+ * Discard Baker
+ * Ants for Master System
+ *
+ * This is a tool to pre-composite the discarded version of each card.
+ *
+ * A discarded card keeps the top four rows of its artwork. The fifth row
+ * keeps its top three lines, with the rest taken from the discard overlay,
+ * and the sixth row is taken from the overlay as-is. The overlay panel
+ * holds three versions, each two rows tall, for bricks, weapons, and
+ * crystal cards.
+ *
+ * The bottom two rows of each discarded card are written to a second
+ * sheet, as 4x2 panels, a row of ten for each version of the overlay.
+ * Once converted, a discarded card is loaded by copying the top of the
+ * card and then its panel from this sheet, without any compositing.
+ *
+ * The overlay panel is cleared in the copy of the card sheet, as its
+ * patterns are only needed where the discarded cards use them.
+ */
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <spng.h>
+
+/* Return Codes */
+#define RC_OK       0
+#define RC_ERROR   -1
+
+/* Card sheet layout, in pixels */
+#define PANEL_WIDTH         32
+#define PANEL_HEIGHT        48
+#define CARD_COUNT          30
+#define PANEL_OVERLAY       31
+
+/* Discarded sheet layout. Only the bottom two rows of each card are changed. */
+#define DISCARDED_HEIGHT    16
+#define DISCARDED_START     (PANEL_HEIGHT - DISCARDED_HEIGHT)
+#define CARDS_PER_OVERLAY   10
+
+/* Lines of the fifth row that are kept from the card */
+#define CARD_LINES_KEPT     3
+
+
+/*
+ * Decode a .png file as RGBA.
+ */
+static uint8_t *baker_load_png (const char *path, uint32_t *width, uint32_t *height)
+{
+    FILE *png_file = fopen (path, "rb");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return NULL;
+    }
+
+    spng_ctx *spng_context = spng_ctx_new (0);
+    struct spng_ihdr header = { };
+    size_t image_size = 0;
+    uint8_t *image = NULL;
+
+    if (spng_set_png_file (spng_context, png_file) != 0 ||
+        spng_get_ihdr (spng_context, &header) != 0 ||
+        spng_decoded_image_size (spng_context, SPNG_FMT_RGBA8, &image_size) != 0 ||
+        (image = malloc (image_size)) == NULL ||
+        spng_decode_image (spng_context, image, image_size, SPNG_FMT_RGBA8, SPNG_DECODE_TRNS) != 0)
+    {
+        fprintf (stderr, "Error: Failed to decode image %s.\n", path);
+        free (image);
+        image = NULL;
+    }
+
+    *width = header.width;
+    *height = header.height;
+
+    spng_ctx_free (spng_context);
+    fclose (png_file);
+
+    return image;
+}
+
+
+/*
+ * Encode RGBA as a .png file.
+ */
+static int baker_write_png (const char *path, const uint8_t *rgba, uint32_t width, uint32_t height)
+{
+    FILE *png_file = fopen (path, "wb");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    spng_ctx *spng_context = spng_ctx_new (SPNG_CTX_ENCODER);
+    struct spng_ihdr header = {
+        .width = width,
+        .height = height,
+        .bit_depth = 8,
+        .color_type = SPNG_COLOR_TYPE_TRUECOLOR_ALPHA
+    };
+    int rc = RC_OK;
+
+    if (spng_set_png_file (spng_context, png_file) != 0 ||
+        spng_set_ihdr (spng_context, &header) != 0 ||
+        spng_encode_image (spng_context, rgba, width * height * 4, SPNG_FMT_PNG, SPNG_ENCODE_FINALIZE) != 0)
+    {
+        fprintf (stderr, "Error: Failed to encode image %s.\n", path);
+        rc = RC_ERROR;
+    }
+
+    spng_ctx_free (spng_context);
+    fclose (png_file);
+
+    return rc;
+}
+
+
+/*
+ * Get a line of a card panel, with panels numbered across then down the sheet.
+ */
+static uint8_t *baker_panel_line (uint8_t *sheet, uint32_t width, uint32_t panel, uint32_t line)
+{
+    uint32_t panels_across = width / PANEL_WIDTH;
+    uint32_t x = (panel % panels_across) * PANEL_WIDTH;
+    uint32_t y = (panel / panels_across) * PANEL_HEIGHT + line;
+
+    return &sheet [(y * width + x) * 4];
+}
+
+
+/*
+ * Composite the bottom two rows of each card with its version of the overlay.
+ */
+static void baker_bake (uint8_t *cards, uint32_t width, uint8_t *discarded)
+{
+    uint32_t discarded_width = CARDS_PER_OVERLAY * PANEL_WIDTH;
+
+    for (uint32_t card = 0; card < CARD_COUNT; card++)
+    {
+        uint32_t version = card / CARDS_PER_OVERLAY;
+        uint32_t x = (card % CARDS_PER_OVERLAY) * PANEL_WIDTH;
+
+        for (uint32_t line = 0; line < DISCARDED_HEIGHT; line++)
+        {
+            uint32_t y = version * DISCARDED_HEIGHT + line;
+            const uint8_t *source = (line < CARD_LINES_KEPT) ? baker_panel_line (cards, width, card, DISCARDED_START + line)
+                                                             : baker_panel_line (cards, width, PANEL_OVERLAY, y);
+
+            memcpy (&discarded [(y * discarded_width + x) * 4], source, PANEL_WIDTH * 4);
+        }
+    }
+
+    /* The overlay is no longer needed */
+    for (uint32_t line = 0; line < PANEL_HEIGHT; line++)
+    {
+        memset (baker_panel_line (cards, width, PANEL_OVERLAY, line), 0, PANEL_WIDTH * 4);
+    }
+}
+
+
+/*
+ * Entry point.
+ */
+int main (int argc, char **argv)
+{
+    if (argc != 4)
+    {
+        fprintf (stderr, "Usage: %s <cards.png> <cards output.png> <discarded output.png>\n", argv [0]);
+        fprintf (stderr, "  Writes the bottom two rows of each discarded card as a sheet of %u 4x2 panels,\n", CARD_COUNT);
+        fprintf (stderr, "  and a copy of the card sheet without the discard overlay.\n");
+        return EXIT_FAILURE;
+    }
+
+    uint32_t width;
+    uint32_t height;
+    uint8_t *cards = baker_load_png (argv [1], &width, &height);
+    if (cards == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (width % PANEL_WIDTH != 0 || height % PANEL_HEIGHT != 0 ||
+        (width / PANEL_WIDTH) * (height / PANEL_HEIGHT) <= PANEL_OVERLAY)
+    {
+        fprintf (stderr, "Error: %s does not contain %u panels of %ux%u.\n", argv [1], PANEL_OVERLAY + 1, PANEL_WIDTH, PANEL_HEIGHT);
+        free (cards);
+        return EXIT_FAILURE;
+    }
+
+    uint32_t discarded_width = CARDS_PER_OVERLAY * PANEL_WIDTH;
+    uint32_t discarded_height = (CARD_COUNT / CARDS_PER_OVERLAY) * DISCARDED_HEIGHT;
+    uint8_t *discarded = calloc (discarded_width * discarded_height, 4);
+    if (discarded == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for discarded sheet.\n");
+        free (cards);
+        return EXIT_FAILURE;
+    }
+
+    baker_bake (cards, width, discarded);
+
+    int rc = baker_write_png (argv [2], cards, width, height);
+    if (rc == RC_OK)
+    {
+        rc = baker_write_png (argv [3], discarded, discarded_width, discarded_height);
+    }
+
+    free (discarded);
+    free (cards);
+
+    return rc == RC_OK ? EXIT_SUCCESS : EXIT_FAILURE;
+}
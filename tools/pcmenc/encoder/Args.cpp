@@ -11,6 +11,13 @@ Args::Args(int argc, char** argv)
         {
         case '/':
         case '-':
+            if (argv[i][1] == '\0')
+            {
+                // A lone "-" is a filename meaning stdin
+                _args.insert(std::make_pair("filename", argv[i]));
+                haveLastKey = false;
+                break;
+            }
             // Store as a valueless key
             lastKey = _args.insert(make_pair(std::string(argv[i] + 1), "")).first;
             haveLastKey = true;
@@ -55,6 +62,16 @@ int Args::getInt(const std::string& name, uint32_t defaultValue)
     return std::strtol(it->second.c_str(), nullptr, 10);
 }
 
+double Args::getDouble(const std::string& name, double defaultValue)
+{
+    const auto it = _args.find(name);
+    if (it == _args.end())
+    {
+        return defaultValue;
+    }
+    return std::strtod(it->second.c_str(), nullptr);
+}
+
 bool Args::exists(const std::string& name) const
 {
     return _args.find(name) != _args.end();
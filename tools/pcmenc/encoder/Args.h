@@ -14,5 +14,7 @@ public:
 
     int getInt(const std::string& name, uint32_t defaultValue);
 
+    double getDouble(const std::string& name, double defaultValue);
+
     bool exists(const std::string& name) const;
 };
@@ -0,0 +1,162 @@
+﻿#include "WavStream.h"
+#include "FourCC.h"
+#include <stdexcept>
+
+WavStream::WavStream(const std::string& filename)
+{
+    if (filename == "-")
+    {
+        _f = stdin;
+    }
+    else
+    {
+        _f = fopen(filename.c_str(), "rb");
+        if (_f == nullptr)
+        {
+            throw std::runtime_error("Failed to open " + filename);
+        }
+    }
+
+    // The RIFF size is not checked, as it is often left unset when streaming
+    if (read32() != StringToMarker("RIFF"))
+    {
+        throw std::runtime_error("Marker RIFF not found in file");
+    }
+    read32();
+    if (read32() != StringToMarker("WAVE"))
+    {
+        throw std::runtime_error("Marker WAVE not found in file");
+    }
+
+    // Skip chunks until we find the format
+    uint32_t chunkSize;
+    while (true)
+    {
+        const uint32_t marker = read32();
+        chunkSize = read32();
+        if (marker == StringToMarker("fmt "))
+        {
+            break;
+        }
+        skip(chunkSize);
+    }
+
+    const uint16_t formatType = read16();
+    if (formatType != 0 && formatType != 1)
+    {
+        throw std::runtime_error("Unsupported format type");
+    }
+
+    _channels = read16();
+    if (_channels != 1 && _channels != 2)
+    {
+        throw std::runtime_error("Unsupported channel count");
+    }
+
+    _samplesPerSec = read32();
+
+    skip(6); // discard avgBytesPerSec (4), blockAlign (2)
+
+    const uint16_t bitsPerSample = read16();
+    if (bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32)
+    {
+        throw std::runtime_error("Only supports 8, 16, 24, and 32 bits per sample");
+    }
+    _bytesPerSample = bitsPerSample / 8;
+
+    skip(chunkSize - 16);
+
+    // Then skip chunks until we find the data
+    while (read32() != StringToMarker("data"))
+    {
+        skip(read32());
+    }
+
+    // Streaming writers tend to leave the size as 0 or 0xffffffff, so we read until the end of the stream
+    _bytesRemaining = read32();
+    if (_bytesRemaining == 0 || _bytesRemaining == 0xffffffff)
+    {
+        _bytesRemaining = UINT64_MAX;
+    }
+}
+
+WavStream::~WavStream()
+{
+    if (_f != stdin)
+    {
+        fclose(_f);
+    }
+}
+
+uint32_t WavStream::read32()
+{
+    uint8_t b[4];
+    if (fread(b, 1, 4, _f) != 4)
+    {
+        throw std::runtime_error("Unexpected end of file");
+    }
+    return (uint32_t)b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24;
+}
+
+uint16_t WavStream::read16()
+{
+    uint8_t b[2];
+    if (fread(b, 1, 2, _f) != 2)
+    {
+        throw std::runtime_error("Unexpected end of file");
+    }
+    return (uint16_t)(b[0] | b[1] << 8);
+}
+
+void WavStream::skip(uint32_t count)
+{
+    // We can't seek on a pipe, so we read past the data instead
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (fgetc(_f) == EOF)
+        {
+            throw std::runtime_error("Unexpected end of file");
+        }
+    }
+}
+
+uint32_t WavStream::samplesPerSec() const
+{
+    return _samplesPerSec;
+}
+
+size_t WavStream::read(double* samples, size_t count)
+{
+    size_t samplesRead = 0;
+    for (; samplesRead < count; ++samplesRead)
+    {
+        double value = 0;
+        for (int c = 0; c < _channels; ++c)
+        {
+            uint8_t b[4];
+            if (_bytesRemaining < _bytesPerSample || fread(b, 1, _bytesPerSample, _f) != _bytesPerSample)
+            {
+                _bytesRemaining = 0;
+                return samplesRead;
+            }
+            _bytesRemaining -= _bytesPerSample;
+
+            // This matches the conversion in loadSamples()
+            if (_bytesPerSample == 1)
+            {
+                value += ((int)b[0] - 0x80) / 128.0 / _channels;
+            }
+            else
+            {
+                uint32_t val = 0;
+                for (uint32_t j = 0; j < _bytesPerSample; j++)
+                {
+                    val = (val >> 8) | ((uint32_t)b[j] << 24);
+                }
+                value += (int)val / 2147483649.0 / _channels;
+            }
+        }
+        samples[samplesRead] = value;
+    }
+    return samplesRead;
+}
@@ -0,0 +1,35 @@
+﻿#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+
+// Reads wav sample data a block at a time, from a file or from stdin ("-"),
+// without needing to know the length of the stream up front
+class WavStream
+{
+private:
+    FILE* _f;
+    uint16_t _channels;
+    uint32_t _bytesPerSample;
+    uint32_t _samplesPerSec;
+    uint64_t _bytesRemaining;
+
+    uint32_t read32();
+    uint16_t read16();
+    void skip(uint32_t count);
+
+public:
+    explicit WavStream(const std::string& filename);
+
+    ~WavStream();
+    WavStream(const WavStream& other) = delete;
+    WavStream& operator=(const WavStream& other) = delete;
+
+    [[nodiscard]]
+    uint32_t samplesPerSec() const;
+
+    // Reads up to count samples, mixed down to mono in the range -1..1.
+    // Returns the number of samples read, which is 0 at the end of the stream.
+    size_t read(double* samples, size_t count);
+};
@@ -33,12 +33,16 @@
 #include <cstdint>
 #include <map>
 #include <ctime>
+#include <deque>
+#include <cstdarg>
 #include <execution>
+#include <vector>
 
 #include "st.h"
 #include "dkm.hpp"
 #include "Endian.h"
 #include "FileReader.h"
+#include "WavStream.h"
 #include "FourCC.h"
 #include "Args.h"
 
@@ -77,6 +81,22 @@ enum class DataPrecision
     Double = 8
 };
 
+// Progress output is suppressed while the tuner runs many encodes in parallel
+static bool quiet = false;
+
+// printf() for progress messages, which honours quiet
+static void info(const char* format, ...)
+{
+    if (quiet)
+    {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
 // Resamples a sample from inRate to outRate and returns a new buffer with
 // the resampled data and the length of the new buffer.
 double* resample(const double* in, const size_t inLen, const unsigned int inRate, const unsigned int outRate, size_t& outLen)
@@ -334,13 +354,70 @@ T computeCost(T value)
     return CostImpl<T, CostFunction>::calculate(value);
 }
 
+// One step of the search: for each yz pair, find the cheapest xy to come from,
+// and the z update that goes with it
+template <typename T, int CostFunction>
+void viterbiStep(
+    T sample, T duration,
+    const T* effectiveVolumesCube,
+    const T lastCosts[256],
+    T sampleCosts[256],
+    unsigned int samplePreceding[256],
+    unsigned int sampleUpdate[256])
+{
+    // Initialise our best values to the maximum
+    std::fill_n(sampleCosts, 256, std::numeric_limits<T>::max());
+
+    // We iterate over the whole "volume cube"...
+    for (unsigned int i = 0; i < 16 * 16 * 16; ++i)
+    {
+        // We can treat i as three indices x, y, z into the volume cube.
+        // (It's not stored as a 3D array, maybe for performance?)
+        // For each sample, we wan to pick the "best" update to make to our channel
+        // for a given pair of values of the other two.
+        // This is determined as the cumulative error so far for a given route to the current sample,
+        // plus the cost function applied to the deviation in output for a given new value, multiplied by its duration.
+
+        // We transform i to some x, y, z values...
+        unsigned int xy = i >> 4;
+        unsigned int yz = i & 0xff;
+
+        // We get the value that will be obtained...
+        T effectiveVolume = effectiveVolumesCube[i];
+
+        // ...compute the difference between it and what's wanted...
+        T deviation = sample - effectiveVolume;
+
+        // ...convert to a cost...
+        T cost = duration * computeCost<T, CostFunction>(deviation);
+
+        // ...and add it on to the cumulative cost
+        T cumulativeCost = lastCosts[xy] + cost;
+
+        // If it is better than what was computed so far, for a given yz pair, remember it
+        // TODO: the result is monotonic (?), we could binary search for it?
+        if (cumulativeCost < sampleCosts[yz])
+        {
+            sampleCosts[yz] = cumulativeCost;
+            // And we store the xy and z that go with it
+            samplePreceding[yz] = xy;
+            sampleUpdate[yz] = i & 0x0f;
+        }
+    }
+}
+
+// While the target is constant, we re-check the cached transitions with a full
+// search of the volume cube this often (in outputs)
+constexpr auto flat_revalidate_interval = 48;
+
 template <typename T, int CostFunction>
 int viterbiInner(
     T* targetOutput, size_t numOutputs,
     T* effectiveVolumesCube,
     uint8_t* precedingValues[256],
     uint8_t* updateValues[256],
-    T* dt)
+    T* dt,
+    T flatEpsilon)
 {
     // Costs of previous sample
     T lastCosts[256];
@@ -351,6 +428,15 @@ int viterbiInner(
     unsigned int samplePreceding[256] = {0};
     unsigned int sampleUpdate[256] = {0};
 
+    // For a constant target, the best transition into each state tends to repeat every
+    // triplet. We remember the cost of the chosen transition per channel so that once
+    // the choices have settled, we can propagate the costs without searching the cube.
+    T transitionCosts[3][256];
+    T flatTargets[3] = {0};
+    unsigned int repeatedOutputs = 0; // Consecutive outputs whose choices matched one triplet ago
+    unsigned int fastSinceCheck = 0; // Outputs since the last full search
+    size_t fastPathCount = 0;
+
     // For each sample...
     for (size_t t = 0; t < numOutputs; t++)
     {
@@ -358,55 +444,60 @@ int viterbiInner(
         T sample = targetOutput[t];
         unsigned int channel = t % 3;
 
-        // Initialise our best values to the maximum
-        std::fill_n(sampleCosts, 256, std::numeric_limits<T>::max());
-
         // We print progress every 4K samples
         if (t % 4096 == 0)
         {
-            printf("Processing %3.2f%%\r", 100.0 * t / numOutputs);
+            info("Processing %3.2f%%\r", 100.0 * t / numOutputs);
         }
 
-        T duration = dt[channel];
-
-        // We iterate over the whole "volume cube"...
-        for (unsigned int i = 0; i < 16 * 16 * 16; ++i)
+        // A target within flatEpsilon of the value held for this channel is treated
+        // as exactly that value, so that the search can settle
+        const bool flat = t >= 3 && std::fabs(sample - flatTargets[channel]) <= flatEpsilon;
+        if (flat)
         {
-            // We can treat i as three indices x, y, z into the volume cube.
-            // (It's not stored as a 3D array, maybe for performance?)
-            // For each sample, we wan to pick the "best" update to make to our channel
-            // for a given pair of values of the other two.
-            // This is determined as the cumulative error so far for a given route to the current sample,
-            // plus the cost function applied to the deviation in output for a given new value, multiplied by its duration.
-
-            // We transform i to some x, y, z values...
-            unsigned int xy = i >> 4;
-            unsigned int yz = i & 0xff;
-
-            // We get the value that will be obtained...
-            T effectiveVolume = effectiveVolumesCube[i];
+            sample = flatTargets[channel];
+        }
+        else
+        {
+            flatTargets[channel] = sample;
+            repeatedOutputs = 0;
+        }
 
-            // ...compute the difference between it and what's wanted...
-            T deviation = sample - effectiveVolume;
+        // Fast path: the choices for a whole triplet have matched the triplet before,
+        // so we re-use the choices from one triplet ago and their cached costs.
+        if (repeatedOutputs >= 3 && fastSinceCheck < flat_revalidate_interval)
+        {
+            for (int i = 0; i < 256; i++)
+            {
+                const uint8_t xy = precedingValues[i][t - 3];
+                sampleCosts[i] = lastCosts[xy] + transitionCosts[channel][i];
+                precedingValues[i][t] = xy;
+                updateValues[i][t] = updateValues[i][t - 3];
+            }
+            std::copy(sampleCosts, sampleCosts + 256, lastCosts);
+            ++fastSinceCheck;
+            ++fastPathCount;
+            continue;
+        }
+        fastSinceCheck = 0;
 
-            // ...convert to a cost...
-            T cost = duration * computeCost<T, CostFunction>(deviation);
+        viterbiStep<T, CostFunction>(sample, dt[channel], effectiveVolumesCube, lastCosts, sampleCosts, samplePreceding, sampleUpdate);
 
-            // ...and add it on to the cumulative cost
-            T cumulativeCost = lastCosts[xy] + cost;
+        // We now have the lowest-total-cost values for each yz pair.
 
-            // If it is better than what was computed so far, for a given yz pair, remember it
-            // TODO: the result is monotonic (?), we could binary search for it?
-            if (cumulativeCost < sampleCosts[yz])
+        // Remember the cost of each chosen transition, and check whether the
+        // choices are the same as one triplet ago
+        bool repeated = flat;
+        for (int i = 0; i < 256; i++)
+        {
+            transitionCosts[channel][i] = sampleCosts[i] - lastCosts[samplePreceding[i]];
+            if (repeated &&
+                (precedingValues[i][t - 3] != samplePreceding[i] || updateValues[i][t - 3] != sampleUpdate[i]))
             {
-                sampleCosts[yz] = cumulativeCost;
-                // And we store the xy and z that go with it
-                samplePreceding[yz] = xy;
-                sampleUpdate[yz] = i & 0x0f;
+                repeated = false;
             }
         }
-
-        // We now have the lowest-total-cost values for each yz pair.
+        repeatedOutputs = repeated ? repeatedOutputs + 1 : 0;
 
         // We copy the yz costs as the xy for the next sample
         std::copy(sampleCosts, sampleCosts + 256, lastCosts);
@@ -419,18 +510,23 @@ int viterbiInner(
         }
     }
 
-    printf("Processing %3.2f%%\n", 100.0);
+    info("Processing %3.2f%%\n", 100.0);
+
+    info("Constant-signal fast path used for %zu of %zu outputs (%.2f%%)\n",
+        fastPathCount,
+        numOutputs,
+        100.0 * fastPathCount / numOutputs);
 
     // Now our state arrays contain the final total costs, so we can select the lowest
     auto minIndex = (int)std::distance(lastCosts, std::min_element(lastCosts, lastCosts + 256));
 
-    printf("The cost metric in Viterbi is about %3.3f\n", lastCosts[minIndex]);
+    info("The cost metric in Viterbi is about %3.3f\n", lastCosts[minIndex]);
 
     return minIndex;
 }
 
 template<typename T>
-uint8_t* encode(size_t numOutputs, unsigned int costFunction, T* targetOutput, T* effectiveVolumesCube, T dt[3], bool saveInternal)
+uint8_t* encode(size_t numOutputs, unsigned int costFunction, T* targetOutput, T* effectiveVolumesCube, T dt[3], T flatEpsilon, bool saveInternal, double& snr)
 {
     // For each of 256 "preceding values" we hold a value per sample
     uint8_t* precedingValues[256];
@@ -444,19 +540,19 @@ uint8_t* encode(size_t numOutputs, unsigned int costFunction, T* targetOutput, T
         updateValues[i] = new uint8_t[numOutputs];
     }
 
-    printf("   Using cost function: L%d\n", costFunction);
+    info("   Using cost function: L%d\n", costFunction);
 
     int minIndex;
     switch (costFunction)
     {
     case 1:
-        minIndex = viterbiInner<T, 1>(targetOutput, numOutputs, effectiveVolumesCube, precedingValues, updateValues, dt);
+        minIndex = viterbiInner<T, 1>(targetOutput, numOutputs, effectiveVolumesCube, precedingValues, updateValues, dt, flatEpsilon);
         break;
     case 2:
-        minIndex = viterbiInner<T, 2>(targetOutput, numOutputs, effectiveVolumesCube, precedingValues, updateValues, dt);
+        minIndex = viterbiInner<T, 2>(targetOutput, numOutputs, effectiveVolumesCube, precedingValues, updateValues, dt, flatEpsilon);
         break;
     case 3:
-        minIndex = viterbiInner<T, 3>(targetOutput, numOutputs, effectiveVolumesCube, precedingValues, updateValues, dt);
+        minIndex = viterbiInner<T, 3>(targetOutput, numOutputs, effectiveVolumesCube, precedingValues, updateValues, dt, flatEpsilon);
         break;
     default:
         throw std::runtime_error("Unhandled cost function >3");
@@ -522,7 +618,8 @@ uint8_t* encode(size_t numOutputs, unsigned int costFunction, T* targetOutput, T
     }
 
     const double  var = en - mi*mi * 3 / numOutputs;
-    printf("SNR is about %3.2f\n", 10 * log10(var / er));
+    snr = 10 * log10(var / er);
+    info("SNR is about %3.2f\n", snr);
 
     // We can now delete the data used to compute everything except the final result
     delete[] precedingValuesPath;
@@ -542,8 +639,10 @@ uint8_t* encode(
     unsigned int idt1, unsigned int idt2, unsigned int idt3,
     InterpolationType interpolation,
     unsigned int costFunction,
+    double flatEpsilon,
     bool saveInternal,
     size_t& resultLength,
+    double& snr,
     const double volumes[16])
 {
     const auto start = clock();
@@ -580,12 +679,12 @@ uint8_t* encode(
         samplesPerTriplet = 1;
     }
 
-    printf("Viterbi SNR optimization:\n");
-    printf("   %d input samples per PSG triplet output\n", samplesPerTriplet);
-    printf("   dt1 = %d  (Normalized: %1.3f)\n", idt1, dt[0]);
-    printf("   dt2 = %d  (Normalized: %1.3f)\n", idt2, dt[1]);
-    printf("   dt3 = %d  (Normalized: %1.3f)\n", idt3, dt[2]);
-    printf("   Using %zu bytes data precision\n", sizeof(T));;
+    info("Viterbi SNR optimization:\n");
+    info("   %d input samples per PSG triplet output\n", samplesPerTriplet);
+    info("   dt1 = %d  (Normalized: %1.3f)\n", idt1, dt[0]);
+    info("   dt2 = %d  (Normalized: %1.3f)\n", idt2, dt[1]);
+    info("   dt3 = %d  (Normalized: %1.3f)\n", idt3, dt[2]);
+    info("   Using %zu bytes data precision\n", sizeof(T));;
 
     // Generate a modified version of the inputs to account for any
     // jitter in the output timings, by sampling at the relative offsets
@@ -598,17 +697,17 @@ uint8_t* encode(
     switch (interpolation)
     {
     case InterpolationType::Linear:
-        printf("   Resampling using Linear interpolation...");
+        info("   Resampling using Linear interpolation...");
         numLeft = 0;
         numRight = 1;
         break;
     case InterpolationType::Quadratic:
-        printf("   Resampling using Quadratic interpolation...");
+        info("   Resampling using Quadratic interpolation...");
         numLeft = 0;
         numRight = 2;
         break;
     case InterpolationType::Lagrange11:
-        printf("   Resampling using Lagrange interpolation on 11 points...");
+        info("   Resampling using Lagrange interpolation on 11 points...");
         numLeft = 5;
         numRight = 5;
         break;
@@ -629,7 +728,7 @@ uint8_t* encode(
         targetOutput[3 * i + 2] = interpolate(normalisedInputs, (int)t2, dt2, numLeft, numRight);
     }
 
-    printf(" done (%zu output points)\n", numOutputs);
+    info(" done (%zu output points)\n", numOutputs);
 
     if (saveInternal)
     {
@@ -649,14 +748,14 @@ uint8_t* encode(
             volumes[(i >> 8) & 0xf]) / 3.0);
     }
 
-    uint8_t* result = encode(numOutputs, costFunction, targetOutput, effectiveVolumesCube, dt, saveInternal);
+    uint8_t* result = encode(numOutputs, costFunction, targetOutput, effectiveVolumesCube, dt, (T)flatEpsilon, saveInternal, snr);
 
     delete[] effectiveVolumesCube;
     delete[] targetOutput;
 
     const clock_t end = clock();
     const double secondsElapsed = (1.0 * end - start) / CLOCKS_PER_SEC;
-    printf(
+    info(
         "Converted %zu samples to %zu outputs in %.2fs = %.0f samples per second\n",
         length,
         numOutputs,
@@ -748,7 +847,7 @@ size_t chVolPackChunk(uint8_t*& pDest, uint8_t*& pSource, size_t maxTripletCount
 
     if (tripletCount > 0xffff)
     {
-        printf("Warning: chunk size %zu truncated\n", tripletCount);
+        info("Warning: chunk size %zu truncated\n", tripletCount);
     }
 
     *pDest++ = (uint8_t)((tripletCount >> 0) & 0xff);
@@ -797,28 +896,28 @@ uint8_t* chVolPack(PackingType packingType, uint8_t* pSource, const size_t sourc
     size_t totalPadding = 0;
     unsigned int bankCount = 0;
 
-    printf("Packing data with ");
+    info("Packing data with ");
     if (romSplit == 0)
     {
-        printf("no split");
+        info("no split");
     }
     else
     {
-        printf("splits at %zuKB boundaries", romSplit / 1024);
+        info("splits at %zuKB boundaries", romSplit / 1024);
     }
     switch (packingType)
     {
     case PackingType::VolByte:
         // ReSharper disable once StringLiteralTypo
-        printf(", as raw PSG attenuations %%----aaaa\n");
+        info(", as raw PSG attenuations %%----aaaa\n");
         break;
     case PackingType::ChannelVolByte:
         // ReSharper disable once StringLiteralTypo
-        printf(", as channel/attenuation packed bytes %%cc00aaaa\n");
+        info(", as channel/attenuation packed bytes %%cc00aaaa\n");
         break;
     case PackingType::PackedVol:
         // ReSharper disable once StringLiteralTypo
-        printf(", as packed volume pairs %%aaaabbbb\n");
+        info(", as packed volume pairs %%aaaabbbb\n");
         break;
     default:
         throw std::invalid_argument("Invalid packing type");
@@ -828,7 +927,7 @@ uint8_t* chVolPack(PackingType packingType, uint8_t* pSource, const size_t sourc
     {
         chVolPackChunk(pDest, pSource, sourceLength / 3, std::numeric_limits<int>::max(), packingType);
         destLength = pDest - result;
-        printf("Packed as %zu bytes of data\n", destLength);
+        info("Packed as %zu bytes of data\n", destLength);
         return result;
     }
 
@@ -854,7 +953,7 @@ uint8_t* chVolPack(PackingType packingType, uint8_t* pSource, const size_t sourc
         }
     };
     destLength = pDest - result;
-    printf("Packed as %zu bytes of data (%d banks with %zu bytes padding)\n",
+    info("Packed as %zu bytes of data (%d banks with %zu bytes padding)\n",
         destLength,
         bankCount,
         totalPadding);
@@ -867,9 +966,9 @@ uint8_t* rlePack(uint8_t* binBuffer, size_t length, size_t romSplit, int rleIncr
 {
     if (romSplit == 0)
     {
-        printf("RLE encoding with no split\n");
+        info("RLE encoding with no split\n");
         const auto result = rleEncode(binBuffer, length, rleIncrement, resultLen);
-        printf(
+        info(
             "- Encoded %zu volume commands (%zu bytes) to %zu bytes of data,\n"
             "  effective compression ratio %.2f%%\n",
             length,
@@ -879,7 +978,7 @@ uint8_t* rlePack(uint8_t* binBuffer, size_t length, size_t romSplit, int rleIncr
         return result;
     }
 
-    printf("RLE encoding with splits at %zuKB boundaries", romSplit / 1024);
+    info("RLE encoding with splits at %zuKB boundaries", romSplit / 1024);
 
     auto* destBuffer = new uint8_t[2 * (size_t)length];
     uint8_t* pDest = destBuffer;
@@ -975,12 +1074,12 @@ uint8_t* rlePack(uint8_t* binBuffer, size_t length, size_t romSplit, int rleIncr
         }
 
         // Show some progress
-        printf(".");
+        info(".");
 
         tripletsRemaining -= tripletCount;
     }
     resultLen = (uint32_t)(pDest - destBuffer);
-    printf(
+    info(
         "done\n"
         "- Encoded %zu volume commands (%zu bytes) to %zu bytes of data\n"
         "  (with %zu bytes padding), effective compression ratio %.2f%%\n",
@@ -1237,51 +1336,9 @@ static void skewDown(double* pData, size_t sampleCount, int highPassShift)
     }
 }
 
-// Converts a wav file to PSG binary format, including encoding
-void convertWav(const std::string& filename, bool saveInternal, int costFunction, InterpolationType interpolation,
-    int cpuFrequency, int dt1, int dt2, int dt3,
-    int ratio, double amplitude, int romSplit, PackingType packingType, Chip chip, DataPrecision precision, int smooth)
+// Builds the table of output levels for each volume setting of the chip
+static void buildVolumeTable(Chip chip, double vol[16])
 {
-    // Load samples from wav file
-    if (ratio < 1)
-    {
-        throw std::invalid_argument("Invalid number of inputs per output");
-    }
-    const int frequency = cpuFrequency * ratio / (dt1 + dt2 + dt3);
-    if (frequency == 0)
-    {
-        throw std::invalid_argument("Invalid frequency");
-    }
-
-    printf("Encoding PSG samples at %dHz\n", (int)frequency);
-
-    printf("Loading %s...", filename.c_str());
-    size_t samplesLen;
-    double* samples = loadSamples(filename, frequency, samplesLen);
-    if (samples == NULL)
-    {
-        throw std::runtime_error("Failed to load wav file");
-    }
-    printf("done; %zu samples\n", samplesLen);
-
-    if (saveInternal)
-    {
-        dump("samples.bin", (const uint8_t*)samples, samplesLen * sizeof(double));
-    }
-
-    if (smooth > 0)
-    {
-        printf("Skewing samples for better quality...");
-        skewDown(samples, samplesLen, smooth);
-        printf("done\n");
-    }
-    if (saveInternal)
-    {
-        dump("made_positive.bin", (const uint8_t*)samples, samplesLen * sizeof(double));
-    }
-
-    // Build the volume table
-    double vol[16];
     switch (chip)
     {
     case Chip::AY38910:
@@ -1303,6 +1360,32 @@ void convertWav(const std::string& filename, bool saveInternal, int costFunction
     default:
         throw std::invalid_argument("Invalid chip");
     }
+}
+
+// Encodes and packs samples which have already been loaded at the target frequency.
+// Returns the packed buffer. If updates is given, the unpacked channel updates are
+// also copied into it.
+uint8_t* encodeAndPack(const double* samples, size_t samplesLen, bool saveInternal, int costFunction, InterpolationType interpolation,
+    int dt1, int dt2, int dt3,
+    int ratio, double amplitude, int romSplit, PackingType packingType, Chip chip, DataPrecision precision, int smooth,
+    double flatEpsilon, double& snr, size_t& destLength, std::vector<uint8_t>* updates = nullptr)
+{
+    // Skewing works in-place, so we work on a copy of the samples
+    std::vector<double> skewed(samples, samples + samplesLen);
+    if (smooth > 0)
+    {
+        info("Skewing samples for better quality...");
+        skewDown(skewed.data(), samplesLen, smooth);
+        info("done\n");
+    }
+    if (saveInternal)
+    {
+        dump("made_positive.bin", (const uint8_t*)skewed.data(), samplesLen * sizeof(double));
+    }
+
+    // Build the volume table
+    double vol[16];
+    buildVolumeTable(chip, vol);
 
     // Encode
     size_t binSize;
@@ -1310,18 +1393,21 @@ void convertWav(const std::string& filename, bool saveInternal, int costFunction
     switch (precision)
     {
     case DataPrecision::Float:
-        binBuffer = encode<float>(ratio, amplitude, samples, samplesLen, dt1, dt2, dt3, interpolation, costFunction, saveInternal, binSize, vol);
+        binBuffer = encode<float>(ratio, amplitude, skewed.data(), samplesLen, dt1, dt2, dt3, interpolation, costFunction, flatEpsilon, saveInternal, binSize, snr, vol);
         break;
     case DataPrecision::Double:
-        binBuffer = encode<double>(ratio, amplitude, samples, samplesLen, dt1, dt2, dt3, interpolation, costFunction, saveInternal, binSize, vol);
+        binBuffer = encode<double>(ratio, amplitude, skewed.data(), samplesLen, dt1, dt2, dt3, interpolation, costFunction, flatEpsilon, saveInternal, binSize, snr, vol);
         break;
     default:
         throw std::invalid_argument("Invalid data precision");
     }
+    if (updates != nullptr)
+    {
+        updates->assign(binBuffer, binBuffer + binSize);
+    }
 
     // Pack
     uint8_t* destBuffer;
-    size_t destLength;
     switch (packingType)
     {
     case PackingType::FourBitRle:
@@ -1344,11 +1430,924 @@ void convertWav(const std::string& filename, bool saveInternal, int costFunction
     }
     delete[] binBuffer;
 
+    return destBuffer;
+}
+
+// Loads a wav file at the sample rate implied by the replayer timings
+double* loadWav(const std::string& filename, int cpuFrequency, int dt1, int dt2, int dt3, int ratio, size_t& samplesLen)
+{
+    if (ratio < 1)
+    {
+        throw std::invalid_argument("Invalid number of inputs per output");
+    }
+    const int frequency = cpuFrequency * ratio / (dt1 + dt2 + dt3);
+    if (frequency == 0)
+    {
+        throw std::invalid_argument("Invalid frequency");
+    }
+
+    printf("Encoding PSG samples at %dHz\n", (int)frequency);
+
+    printf("Loading %s...", filename.c_str());
+    double* samples = loadSamples(filename, frequency, samplesLen);
+    if (samples == NULL)
+    {
+        throw std::runtime_error("Failed to load wav file");
+    }
+    printf("done; %zu samples\n", samplesLen);
+
+    return samples;
+}
+
+// Converts a wav file to PSG binary format, including encoding
+void convertWav(const std::string& filename, bool saveInternal, int costFunction, InterpolationType interpolation,
+    int cpuFrequency, int dt1, int dt2, int dt3,
+    int ratio, double amplitude, int romSplit, PackingType packingType, Chip chip, DataPrecision precision, int smooth,
+    double flatEpsilon)
+{
+    // Load samples from wav file
+    size_t samplesLen;
+    double* samples = loadWav(filename, cpuFrequency, dt1, dt2, dt3, ratio, samplesLen);
+
+    if (saveInternal)
+    {
+        dump("samples.bin", (const uint8_t*)samples, samplesLen * sizeof(double));
+    }
+
+    // Encode and pack
+    double snr;
+    size_t destLength;
+    uint8_t* destBuffer = encodeAndPack(samples, samplesLen, saveInternal, costFunction, interpolation, dt1, dt2, dt3,
+        ratio, amplitude, romSplit, packingType, chip, precision, smooth, flatEpsilon, snr, destLength);
+    delete[] samples;
+
     // Save the encoded and packed buffer
     saveEncodedBuffer(filename + ".pcmenc", destBuffer, destLength);
     delete[] destBuffer;
 }
 
+// Fixed-lag streaming encoder.
+//
+// The full encoder holds the decisions for every output so that it can trace back
+// from the best final state, which takes 512 bytes per output. When streaming, we
+// only hold a window of decisions. Every stream_merge_interval outputs we trace all
+// 256 surviving paths back until they meet: everything up to that point is on the
+// optimal path whatever comes next, so it can be written out. If the paths have not
+// met within the lag, the oldest outputs are instead committed along the path of
+// the currently-best state, which may differ from the global optimum.
+
+// How often (in outputs) we look for a common ancestor of the surviving paths
+constexpr auto stream_merge_interval = 32;
+
+// Default lag (in outputs) before decisions are forced
+constexpr auto stream_default_lag = 3 * 1024;
+
+// RLE-packs volume commands as they arrive, matching rleEncode(). Each byte is written
+// out as soon as every byte before it is known. A chunk is closed when the next triplet
+// might not fit in romSplit bytes (if set), or when its triplet count would overflow.
+// The triplet count of each chunk is patched in when it is closed, so the output must
+// be seekable.
+class RleStreamWriter
+{
+    FILE* _f;
+    const unsigned int _rleIncrement;
+    const size_t _romSplit;
+
+    long _chunkStart = 0; // File position of the current chunk
+    size_t _tripletCount = 0;
+    size_t _nextUnusedOffset = 0;
+    unsigned int _currentState[3] = {};
+    unsigned int _rleCounts[3] = {};
+    size_t _offsets[3] = {};
+    std::deque<int> _pending; // Bytes from _flushedOffset on, -1 where not yet known
+    size_t _flushedOffset = 0;
+
+    uint8_t _triplet[3] = {}; // Triplet being received
+    unsigned int _tripletFill = 0;
+    uint8_t _held[3] = {}; // Last complete triplet, held until we know whether it ends a chunk
+    bool _haveHeld = false;
+
+    size_t reserve()
+    {
+        _pending.push_back(-1);
+        return _nextUnusedOffset++;
+    }
+
+    void set(size_t offset, uint8_t value)
+    {
+        _pending[offset - _flushedOffset] = value;
+        // Write out everything that is now known
+        while (!_pending.empty() && _pending.front() >= 0)
+        {
+            fputc(_pending.front(), _f);
+            _pending.pop_front();
+            ++_flushedOffset;
+            ++bytesWritten;
+        }
+    }
+
+    void startChunk()
+    {
+        _chunkStart = ftell(_f);
+        _pending.clear();
+        _flushedOffset = 0;
+        _nextUnusedOffset = 0;
+
+        // Placeholder for the triplet count
+        set(reserve(), 0);
+        set(reserve(), 0);
+
+        for (unsigned int channel = 0; channel < 3; ++channel)
+        {
+            _currentState[channel] = _held[channel];
+            _rleCounts[channel] = 0;
+            _offsets[channel] = reserve();
+        }
+        _tripletCount = 1;
+        ++chunkCount;
+    }
+
+    void addTriplet(bool isLastTriplet)
+    {
+        for (unsigned int channel = 0; channel < 3; ++channel)
+        {
+            if (_currentState[channel] == _held[channel] && _rleCounts[channel] < 15u - (_rleIncrement - 1) && !isLastTriplet)
+            {
+                _rleCounts[channel] += _rleIncrement;
+            }
+            else
+            {
+                set(_offsets[channel], (uint8_t)(_rleCounts[channel] << 4 | _currentState[channel]));
+                _rleCounts[channel] = 0;
+                _offsets[channel] = reserve();
+                _currentState[channel] = _held[channel];
+                if (isLastTriplet)
+                {
+                    set(_offsets[channel], (uint8_t)(_rleCounts[channel] << 4 | _currentState[channel]));
+                }
+            }
+        }
+        ++_tripletCount;
+    }
+
+    void closeChunk(bool pad)
+    {
+        // A single-triplet chunk still has its runs open
+        if (_tripletCount == 1)
+        {
+            for (unsigned int channel = 0; channel < 3; ++channel)
+            {
+                set(_offsets[channel], (uint8_t)_currentState[channel]);
+            }
+        }
+
+        const long end = ftell(_f);
+        fseek(_f, _chunkStart, SEEK_SET);
+        fputc((int)(_tripletCount >> 0) & 0xff, _f);
+        fputc((int)(_tripletCount >> 8) & 0xff, _f);
+        fseek(_f, end, SEEK_SET);
+
+        if (pad)
+        {
+            for (size_t i = _nextUnusedOffset; i < _romSplit; ++i)
+            {
+                fputc(0, _f);
+                ++bytesWritten;
+                ++padding;
+            }
+        }
+        _tripletCount = 0;
+    }
+
+    // Pack the held triplet, now that we know whether another follows it
+    void packHeld(bool endOfStream)
+    {
+        if (_tripletCount == 0)
+        {
+            startChunk();
+            if (endOfStream)
+            {
+                closeChunk(false);
+            }
+            return;
+        }
+
+        // After this triplet, there must be room for a closing triplet of three bytes
+        const bool chunkFull = _tripletCount + 2 > 0xffff ||
+            (_romSplit > 0 && _nextUnusedOffset + 6 > _romSplit);
+        addTriplet(endOfStream || chunkFull);
+        if (endOfStream || chunkFull)
+        {
+            closeChunk(!endOfStream);
+        }
+    }
+
+public:
+    size_t bytesWritten = 0;
+    size_t chunkCount = 0;
+    size_t padding = 0;
+
+    RleStreamWriter(FILE* f, unsigned int rleIncrement, size_t romSplit)
+        : _f(f), _rleIncrement(rleIncrement), _romSplit(romSplit)
+    {
+    }
+
+    // Adds the next single-channel volume command
+    void add(uint8_t volume)
+    {
+        _triplet[_tripletFill++] = volume;
+        if (_tripletFill < 3)
+        {
+            return;
+        }
+        _tripletFill = 0;
+
+        if (_haveHeld)
+        {
+            packHeld(false);
+        }
+        std::copy(_triplet, _triplet + 3, _held);
+        _haveHeld = true;
+    }
+
+    void finish()
+    {
+        if (_haveHeld)
+        {
+            packHeld(true);
+            _haveHeld = false;
+        }
+    }
+};
+
+// Viterbi search over a window of outputs, committing decisions to a writer
+template <typename T, int CostFunction>
+class StreamingViterbi
+{
+    const T* _effectiveVolumesCube;
+    const T* _dt;
+    const size_t _lag;
+    const size_t _window;
+    RleStreamWriter& _writer;
+
+    T _lastCosts[256];
+    std::vector<uint8_t> _precedingValues; // 256 per output in the window, indexed by output % _window
+    std::vector<uint8_t> _updateValues;
+    std::vector<T> _targets;
+    std::vector<uint8_t> _path;
+    size_t _searched = 0; // Outputs searched so far
+    size_t _committed = 0; // Outputs written so far
+
+    // Last two committed updates, and the sums for the SNR
+    unsigned int _x = 0;
+    unsigned int _y = 0;
+    double _en = 0;
+    double _er = 0;
+    double _mi = 0;
+
+    uint8_t preceding(size_t t, unsigned int state) const
+    {
+        return _precedingValues[(t % _window) * 256 + state];
+    }
+
+    uint8_t update(size_t t, unsigned int state) const
+    {
+        return _updateValues[(t % _window) * 256 + state];
+    }
+
+    // Write out the outputs up to and including last, along the path ending in the given state
+    void commitPath(unsigned int state, size_t last)
+    {
+        const size_t count = last + 1 - _committed;
+        for (size_t i = count; i-- > 0;)
+        {
+            const size_t t = _committed + i;
+            _path[i] = update(t, state);
+            state = preceding(t, state);
+        }
+
+        // For the first output, the preceding state is whatever the search chose
+        if (_committed == 0)
+        {
+            _x = state >> 4;
+            _y = state & 0x0f;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t t = _committed + i;
+            const unsigned int z = _path[i];
+            const T target = _targets[t % _window];
+            const T achieved = _effectiveVolumesCube[_x << 8 | _y << 4 | z];
+            _en += target * target * _dt[t % 3];
+            _er += (target - achieved) * (target - achieved) * _dt[t % 3];
+            _mi += target * _dt[t % 3];
+            _x = _y;
+            _y = z;
+
+            _writer.add((uint8_t)z);
+            if (committedUpdates != nullptr)
+            {
+                committedUpdates->push_back((uint8_t)z);
+            }
+        }
+        _committed = last + 1;
+    }
+
+    // Trace all the surviving paths back until they meet, and commit everything up to there
+    void commitMerged()
+    {
+        bool live[256];
+        std::fill_n(live, 256, true);
+        unsigned int liveCount = 256;
+        unsigned int state = 0;
+
+        for (size_t t = _searched - 1; ; --t)
+        {
+            if (liveCount == 1)
+            {
+                if (t >= _committed)
+                {
+                    commitPath(state, t);
+                }
+                return;
+            }
+            if (t == _committed)
+            {
+                return;
+            }
+
+            bool previous[256] = {};
+            liveCount = 0;
+            for (unsigned int i = 0; i < 256; ++i)
+            {
+                if (live[i])
+                {
+                    const unsigned int xy = preceding(t, i);
+                    if (!previous[xy])
+                    {
+                        previous[xy] = true;
+                        state = xy;
+                        ++liveCount;
+                    }
+                }
+            }
+            std::copy(previous, previous + 256, live);
+        }
+    }
+
+    // Commit the oldest outputs along the path of the currently-best state
+    void commitForced(size_t count)
+    {
+        unsigned int state = (unsigned int)std::distance(_lastCosts, std::min_element(_lastCosts, _lastCosts + 256));
+        const size_t last = _committed + count - 1;
+        for (size_t t = _searched - 1; t > last; --t)
+        {
+            state = preceding(t, state);
+        }
+        commitPath(state, last);
+        forcedCount += count;
+    }
+
+public:
+    size_t forcedCount = 0;
+    std::vector<uint8_t>* committedUpdates = nullptr;
+
+    StreamingViterbi(const T* effectiveVolumesCube, const T* dt, size_t lag, RleStreamWriter& writer)
+        : _effectiveVolumesCube(effectiveVolumesCube),
+          _dt(dt),
+          _lag(lag),
+          _window(lag + stream_merge_interval),
+          _writer(writer),
+          _precedingValues(_window * 256),
+          _updateValues(_window * 256),
+          _targets(_window),
+          _path(_window)
+    {
+        std::fill_n(_lastCosts, 256, (T)0.0);
+    }
+
+    void push(T sample)
+    {
+        T sampleCosts[256];
+        unsigned int samplePreceding[256] = {0};
+        unsigned int sampleUpdate[256] = {0};
+
+        viterbiStep<T, CostFunction>(sample, _dt[_searched % 3], _effectiveVolumesCube, _lastCosts, sampleCosts, samplePreceding, sampleUpdate);
+
+        // Only the differences between costs matter, so keep them near zero. Otherwise
+        // they grow with the length of the stream, and lose precision.
+        const T minCost = *std::min_element(sampleCosts, sampleCosts + 256);
+        for (int i = 0; i < 256; i++)
+        {
+            _lastCosts[i] = sampleCosts[i] - minCost;
+        }
+
+        const size_t slot = _searched % _window;
+        for (int i = 0; i < 256; i++)
+        {
+            _precedingValues[slot * 256 + i] = (uint8_t)samplePreceding[i];
+            _updateValues[slot * 256 + i] = (uint8_t)sampleUpdate[i];
+        }
+        _targets[slot] = sample;
+        ++_searched;
+
+        if (_searched % stream_merge_interval == 0)
+        {
+            commitMerged();
+
+            // Keep no more than the lag undecided, so that the window cannot
+            // wrap onto outputs that have not been committed by the next merge
+            if (_searched - _committed > _lag)
+            {
+                commitForced(_searched - _lag - _committed);
+            }
+        }
+    }
+
+    // Commit everything that remains, from the best final state
+    void finish()
+    {
+        if (_searched > _committed)
+        {
+            const auto minIndex = (unsigned int)std::distance(_lastCosts, std::min_element(_lastCosts, _lastCosts + 256));
+            commitPath(minIndex, _searched - 1);
+        }
+    }
+
+    [[nodiscard]]
+    size_t outputCount() const
+    {
+        return _searched;
+    }
+
+    [[nodiscard]]
+    double snr() const
+    {
+        const double var = _en - _mi * _mi * 3 / _committed;
+        return 10 * log10(var / _er);
+    }
+};
+
+// Reads samples from the stream as they are needed, and feeds the Viterbi search
+template <typename T, int CostFunction>
+void streamEncode(WavStream& wav, unsigned int samplesPerTriplet, double amplitude, InterpolationType interpolation,
+    T dt[3], const T* effectiveVolumesCube, size_t lag, bool check, RleStreamWriter& writer)
+{
+    int numLeft;
+    int numRight;
+    switch (interpolation)
+    {
+    case InterpolationType::Linear:
+        numLeft = 0;
+        numRight = 1;
+        break;
+    case InterpolationType::Quadratic:
+        numLeft = 0;
+        numRight = 2;
+        break;
+    case InterpolationType::Lagrange11:
+        numLeft = 5;
+        numRight = 5;
+        break;
+    default:
+        throw std::invalid_argument("Invalid interpolation type");
+    }
+
+    StreamingViterbi<T, CostFunction> viterbi(effectiveVolumesCube, dt, lag, writer);
+
+    // The check needs the whole signal, so it does not run in constant memory
+    std::vector<T> allTargets;
+    std::vector<uint8_t> committedUpdates;
+    if (check)
+    {
+        viterbi.committedUpdates = &committedUpdates;
+    }
+
+    // We can't find the peak of a stream before encoding it, so samples are
+    // normalised from the full -1..1 range instead
+    std::deque<T> inputs; // Normalised inputs, from index inputBase on
+    size_t inputBase = 0;
+    size_t inputCount = 0;
+    bool ended = false;
+    std::vector<double> block(4096);
+
+    const auto input = [&](long index) -> T
+    {
+        // Clamp to the ends, as the padding does in the full encoder
+        index = std::max(index, 0L);
+        index = std::min(index, (long)inputCount - 1);
+        return inputs[index - inputBase];
+    };
+
+    const auto interpolated = [&](T position) -> T
+    {
+        const int index = (int)position;
+        T points[16];
+        for (int k = 0; k <= numLeft + numRight; ++k)
+        {
+            points[k] = input(index - numLeft + k);
+        }
+        return interpolate(points, numLeft, position - index, numLeft, numRight);
+    };
+
+    for (size_t triplet = 0; !ended;)
+    {
+        const size_t count = wav.read(block.data(), block.size());
+        ended = count == 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            inputs.push_back((T)(amplitude * (block[i] + 1.0) / 2.0));
+        }
+        inputCount += count;
+
+        if (ended && inputCount == 0)
+        {
+            throw std::runtime_error("No samples in input");
+        }
+
+        // Encode every triplet whose inputs we have
+        while (true)
+        {
+            const size_t t0 = samplesPerTriplet * triplet;
+            if (ended ? t0 >= inputCount : t0 + samplesPerTriplet + numRight > inputCount)
+            {
+                break;
+            }
+
+            T targets[3];
+            targets[0] = input((long)t0);
+            targets[1] = interpolated((T)(samplesPerTriplet * (triplet + dt[0])));
+            targets[2] = interpolated((T)(samplesPerTriplet * (triplet + dt[0] + dt[1])));
+
+            for (const T target : targets)
+            {
+                viterbi.push(target);
+                if (check)
+                {
+                    allTargets.push_back(target);
+                }
+            }
+
+            ++triplet;
+            if (triplet % 4096 == 0)
+            {
+                info("Processed %zu outputs\r", triplet * 3);
+            }
+        }
+
+        // Drop the inputs that are behind the interpolation window
+        while (inputBase + numLeft + 1 < samplesPerTriplet * triplet)
+        {
+            inputs.pop_front();
+            ++inputBase;
+        }
+    }
+
+    viterbi.finish();
+
+    const size_t numOutputs = viterbi.outputCount();
+    info("Processed %zu outputs\n", numOutputs);
+    info("%zu of %zu outputs (%.2f%%) were committed at the lag limit, the rest when all paths agreed\n",
+        viterbi.forcedCount,
+        numOutputs,
+        100.0 * viterbi.forcedCount / numOutputs);
+    info("SNR is about %3.2f\n", viterbi.snr());
+
+    if (check)
+    {
+        // Compare against the full search over the same targets
+        double globalSnr;
+        const bool wasQuiet = quiet;
+        quiet = true;
+        const uint8_t* globalUpdates = encode(numOutputs, CostFunction, allTargets.data(), (T*)effectiveVolumesCube, dt, (T)0.0, false, globalSnr);
+        quiet = wasQuiet;
+
+        size_t differences = 0;
+        for (size_t i = 0; i < numOutputs; ++i)
+        {
+            if (globalUpdates[i] != committedUpdates[i])
+            {
+                ++differences;
+            }
+        }
+        delete[] globalUpdates;
+
+        info("%zu of %zu decisions (%.2f%%) differ from the global optimum, which has an SNR of about %3.2f\n",
+            differences,
+            numOutputs,
+            100.0 * differences / numOutputs,
+            globalSnr);
+    }
+}
+
+template <typename T>
+void streamEncode(WavStream& wav, unsigned int samplesPerTriplet, double amplitude, InterpolationType interpolation,
+    int dt1, int dt2, int dt3, unsigned int costFunction, const double volumes[16], size_t lag, bool check, RleStreamWriter& writer)
+{
+    // Normalise the relative cycle times to fractions of a triplet time
+    T dt[3];
+    const uint32_t cyclesPerTriplet = dt1 + dt2 + dt3;
+    dt[0] = (T)dt1 / cyclesPerTriplet;
+    dt[1] = (T)dt2 / cyclesPerTriplet;
+    dt[2] = (T)dt3 / cyclesPerTriplet;
+
+    // Build the set of effective volumes for all possible channel settings
+    std::vector<T> effectiveVolumesCube(16 * 16 * 16);
+    for (int i = 0; i < 16 * 16 * 16; ++i)
+    {
+        effectiveVolumesCube[i] = (T)(
+            (volumes[(i >> 0) & 0xf] +
+            volumes[(i >> 4) & 0xf] +
+            volumes[(i >> 8) & 0xf]) / 3.0);
+    }
+
+    info("   Using cost function: L%d\n", costFunction);
+
+    switch (costFunction)
+    {
+    case 1:
+        streamEncode<T, 1>(wav, samplesPerTriplet, amplitude, interpolation, dt, effectiveVolumesCube.data(), lag, check, writer);
+        break;
+    case 2:
+        streamEncode<T, 2>(wav, samplesPerTriplet, amplitude, interpolation, dt, effectiveVolumesCube.data(), lag, check, writer);
+        break;
+    case 3:
+        streamEncode<T, 3>(wav, samplesPerTriplet, amplitude, interpolation, dt, effectiveVolumesCube.data(), lag, check, writer);
+        break;
+    default:
+        throw std::runtime_error("Unhandled cost function >3");
+    }
+}
+
+// Converts a wav file, or a wav stream on stdin ("-"), to PSG binary format in constant memory
+void streamWav(const std::string& filename, int costFunction, InterpolationType interpolation,
+    int cpuFrequency, int dt1, int dt2, int dt3,
+    int ratio, double amplitude, int romSplit, PackingType packingType, Chip chip, DataPrecision precision,
+    size_t lag, bool check)
+{
+    unsigned int rleIncrement;
+    switch (packingType)
+    {
+    case PackingType::FourBitRle:
+        rleIncrement = 1;
+        break;
+    case PackingType::ThreeBitRle:
+        rleIncrement = 2;
+        break;
+    default:
+        throw std::invalid_argument("Streaming only supports RLE packing");
+    }
+
+    if (ratio < 1)
+    {
+        throw std::invalid_argument("Invalid number of inputs per output");
+    }
+    const int frequency = cpuFrequency * ratio / (dt1 + dt2 + dt3);
+    if (frequency == 0)
+    {
+        throw std::invalid_argument("Invalid frequency");
+    }
+
+    printf("Encoding PSG samples at %dHz\n", (int)frequency);
+
+    WavStream wav(filename);
+    if (fabs(1.0 * frequency / wav.samplesPerSec() - 1) >= minimum_allowed_frequency_difference)
+    {
+        throw std::runtime_error("Streamed input must already be at the target frequency");
+    }
+
+    const std::string outputFilename = (filename == "-" ? "stdin" : filename) + ".pcmenc";
+    FILE* f = fopen(outputFilename.c_str(), "wb");
+    if (f == nullptr)
+    {
+        throw std::runtime_error("Failed to open " + outputFilename);
+    }
+
+    printf("Streaming %s to %s with a lag of %zu outputs\n", filename.c_str(), outputFilename.c_str(), lag);
+
+    double volumes[16];
+    buildVolumeTable(chip, volumes);
+
+    RleStreamWriter writer(f, rleIncrement, romSplit);
+    switch (precision)
+    {
+    case DataPrecision::Float:
+        streamEncode<float>(wav, ratio, amplitude, interpolation, dt1, dt2, dt3, costFunction, volumes, lag, check, writer);
+        break;
+    case DataPrecision::Double:
+        streamEncode<double>(wav, ratio, amplitude, interpolation, dt1, dt2, dt3, costFunction, volumes, lag, check, writer);
+        break;
+    default:
+        throw std::invalid_argument("Invalid data precision");
+    }
+    writer.finish();
+    fclose(f);
+
+    printf("Saved %zu bytes in %zu chunks (%zu bytes padding)\n", writer.bytesWritten, writer.chunkCount, writer.padding);
+}
+
+// Values searched over by the tuner
+constexpr int tune_amplitudes[] = { 80, 90, 100, 110, 120, 130, 140, 150 };
+constexpr int tune_smooth_values[] = { 0, 6, 8, 10 };
+constexpr int tune_cost_functions[] = { 1, 2, 3 };
+constexpr InterpolationType tune_interpolations[] = {
+    InterpolationType::Linear,
+    InterpolationType::Quadratic,
+    InterpolationType::Lagrange11
+};
+
+// One set of settings tried by the tuner, and the results of encoding with them
+struct TuneCandidate
+{
+    int amplitude; // As given to -a
+    int smooth;
+    int costFunction;
+    InterpolationType interpolation;
+    double snr;
+    std::vector<uint8_t> packed;
+};
+
+// Builds the reference that tuner candidates are measured against: the input normalised
+// to 0..1, without amplitude or skewing, resampled to the output times using the most
+// accurate interpolation. Each candidate's own target depends on its settings, so SNRs
+// measured against them could not be compared.
+std::vector<double> tuneReference(const double* samples, size_t samplesLen, int ratio, int dt1, int dt2, int dt3)
+{
+    const auto minmax = std::minmax_element(samples, samples + samplesLen);
+    const double range = *minmax.second - *minmax.first;
+    if (range <= 0.0)
+    {
+        throw std::runtime_error("Sample data is silent");
+    }
+
+    // Padded as for encoding, to avoid range checks at the end
+    std::vector<double> normalised(samplesLen + 256);
+    for (size_t i = 0; i < samplesLen; ++i)
+    {
+        normalised[i] = (samples[i] - *minmax.first) / range;
+    }
+    std::fill(normalised.begin() + (long)samplesLen, normalised.end(), normalised[samplesLen - 1]);
+
+    const double cyclesPerTriplet = dt1 + dt2 + dt3;
+    const double offset1 = dt1 / cyclesPerTriplet;
+    const double offset2 = (dt1 + dt2) / cyclesPerTriplet;
+    const size_t triplets = (samplesLen + ratio - 1) / ratio;
+
+    std::vector<double> reference(triplets * 3);
+    for (size_t i = 0; i < triplets; ++i)
+    {
+        const double t1 = ratio * (i + offset1);
+        const double t2 = ratio * (i + offset2);
+        reference[3 * i + 0] = normalised[ratio * i];
+        reference[3 * i + 1] = interpolate(normalised.data(), (int)t1, t1 - (int)t1, 5, 5);
+        reference[3 * i + 2] = interpolate(normalised.data(), (int)t2, t2 - (int)t2, 5, 5);
+    }
+    return reference;
+}
+
+// Measures the SNR of a series of channel updates against the tuner's reference.
+// A constant offset is not audible, so the mean of the error is not counted.
+double tuneSnr(const std::vector<double>& reference, const std::vector<uint8_t>& updates, const double volumes[16], int dt1, int dt2, int dt3)
+{
+    const double cyclesPerTriplet = dt1 + dt2 + dt3;
+    const double dt[3] = { dt1 / cyclesPerTriplet, dt2 / cyclesPerTriplet, dt3 / cyclesPerTriplet };
+    const size_t numOutputs = std::min(reference.size(), updates.size());
+
+    double en = 0;
+    double mi = 0;
+    double er = 0;
+    double me = 0;
+    unsigned int x = 0;
+    unsigned int y = 0;
+    for (size_t t = 0; t < numOutputs; ++t)
+    {
+        const unsigned int z = updates[t];
+        const double achieved = (volumes[x] + volumes[y] + volumes[z]) / 3.0;
+        const double error = reference[t] - achieved;
+        en += reference[t] * reference[t] * dt[t % 3];
+        mi += reference[t] * dt[t % 3];
+        er += error * error * dt[t % 3];
+        me += error * dt[t % 3];
+        x = y;
+        y = z;
+    }
+
+    const double var = en - mi * mi * 3 / numOutputs;
+    const double errorVar = er - me * me * 3 / numOutputs;
+    return 10 * log10(var / errorVar);
+}
+
+// Searches for the encoder settings giving the best SNR within a size budget,
+// and saves the result of encoding with them
+void tuneWav(const std::string& filename, int cpuFrequency, int dt1, int dt2, int dt3,
+    int ratio, int romSplit, PackingType packingType, Chip chip, DataPrecision precision,
+    double flatEpsilon, size_t budget, double minSnr)
+{
+    if (packingType == PackingType::Vector4 || packingType == PackingType::Vector6)
+    {
+        throw std::invalid_argument("Vector packing is not supported by the tuner");
+    }
+
+    size_t samplesLen;
+    double* samples = loadWav(filename, cpuFrequency, dt1, dt2, dt3, ratio, samplesLen);
+    const std::vector<double> reference = tuneReference(samples, samplesLen, ratio, dt1, dt2, dt3);
+
+    double volumes[16];
+    buildVolumeTable(chip, volumes);
+
+    std::vector<TuneCandidate> candidates;
+    for (const auto amplitude : tune_amplitudes)
+    {
+        for (const auto smooth : tune_smooth_values)
+        {
+            for (const auto costFunction : tune_cost_functions)
+            {
+                for (const auto interpolation : tune_interpolations)
+                {
+                    candidates.push_back({ amplitude, smooth, costFunction, interpolation, 0.0, {} });
+                }
+            }
+        }
+    }
+
+    printf("Tuning %zu candidate settings for at most %zu bytes with SNR of at least %.2f...",
+        candidates.size(),
+        budget,
+        minSnr);
+    fflush(stdout);
+
+    // Each candidate is independent, so we encode them in parallel
+    quiet = true;
+    std::for_each(
+        std::execution::par,
+        candidates.begin(), candidates.end(),
+        [&](auto&& candidate)
+        {
+            size_t destLength;
+            double targetSnr;
+            std::vector<uint8_t> updates;
+            uint8_t* destBuffer = encodeAndPack(samples, samplesLen, false, candidate.costFunction, candidate.interpolation,
+                dt1, dt2, dt3, ratio, (double)candidate.amplitude / 100, romSplit, packingType, chip, precision,
+                candidate.smooth, flatEpsilon, targetSnr, destLength, &updates);
+            candidate.packed.assign(destBuffer, destBuffer + destLength);
+            delete[] destBuffer;
+            candidate.snr = tuneSnr(reference, updates, volumes, dt1, dt2, dt3);
+        });
+    quiet = false;
+    printf("done\n");
+    delete[] samples;
+
+    // Report the Pareto frontier: the candidates for which no other candidate
+    // is both smaller and of higher quality
+    std::sort(
+        candidates.begin(), candidates.end(),
+        [](const TuneCandidate& a, const TuneCandidate& b)
+        {
+            return a.packed.size() != b.packed.size() ? a.packed.size() < b.packed.size() : a.snr > b.snr;
+        });
+    printf("Pareto frontier:\n");
+    printf("     Bytes    SNR  Settings\n");
+    double bestSnrSoFar = -std::numeric_limits<double>::infinity();
+    const TuneCandidate* best = nullptr;
+    for (const auto& candidate : candidates)
+    {
+        const bool fits = candidate.packed.size() <= budget && candidate.snr >= minSnr;
+        if (fits && (best == nullptr || candidate.snr > best->snr))
+        {
+            best = &candidate;
+        }
+        if (candidate.snr <= bestSnrSoFar)
+        {
+            continue;
+        }
+        bestSnrSoFar = candidate.snr;
+        printf("  %8zu  %5.2f  -a %d -smooth %d -c %d -i %d%s\n",
+            candidate.packed.size(),
+            candidate.snr,
+            candidate.amplitude,
+            candidate.smooth,
+            candidate.costFunction,
+            (int)candidate.interpolation,
+            fits ? "" : " (does not fit)");
+    }
+
+    if (best == nullptr)
+    {
+        throw std::runtime_error("No settings fit within the budget at the minimum SNR");
+    }
+
+    printf("Best settings: -a %d -smooth %d -c %d -i %d (%zu bytes, SNR %.2f)\n",
+        best->amplitude,
+        best->smooth,
+        best->costFunction,
+        (int)best->interpolation,
+        best->packed.size(),
+        best->snr);
+
+    saveEncodedBuffer(filename + ".pcmenc", best->packed.data(), best->packed.size());
+}
+
 int main(int argc, char** argv)
 {
     try
@@ -1371,6 +2370,13 @@ int main(int argc, char** argv)
         const auto chip = (Chip)args.getInt("chip", (int)Chip::SN76489);
         const auto precision = (DataPrecision)args.getInt("precision", (int)DataPrecision::Float);
         const auto smooth = args.getInt("smooth", 0);
+        const auto flatEpsilon = args.getDouble("flat", 0.0);
+        const auto tuneBudget = args.getInt("tune", 0);
+        const auto tuneBanks = args.getInt("tunebanks", 0);
+        const auto minSnr = args.getDouble("minsnr", 0.0);
+        const auto stream = args.exists("stream");
+        const auto streamLag = args.getInt("stream", 0);
+        const auto streamCheck = args.exists("streamcheck");
         // ReSharper restore StringLiteralTypo
 
         if (filename.empty())
@@ -1430,6 +2436,37 @@ int main(int argc, char** argv)
                 "                        1 = Quadratic interpolation\n"
                 "                        2 = Lagrange interpolation (default)\n"
                 "\n"
+                "    -flat <epsilon> Constant-signal tolerance for the Viterbi fast path.\n"
+                "                    Targets within <epsilon> of the value held for their\n"
+                "                    channel are treated as constant.\n"
+                "                        Default 0 = exact matches only\n"
+                "\n"
+                "    -tune <bytes>   Search for the -a, -smooth, -c and -i settings giving the\n"
+                "                    best SNR with at most <bytes> of output, and save the\n"
+                "                    result of encoding with them. The Pareto frontier of\n"
+                "                    size against SNR is reported. SNR is measured\n"
+                "                    against the input before amplitude and skewing, so\n"
+                "                    that all settings are compared alike.\n"
+                "\n"
+                "    -tunebanks <n>  As -tune, with a budget of <n> ROM banks. The bank size\n"
+                "                    is taken from -r, or is 16KB by default.\n"
+                "\n"
+                "    -minsnr <dB>    Minimum acceptable SNR when tuning.\n"
+                "                        Default 0\n"
+                "\n"
+                "    -stream <lag>   Encode in constant memory, committing the search's\n"
+                "                    decisions once all paths agree or after <lag> outputs,\n"
+                "                    and writing the packed output as it is produced.\n"
+                "                    <wavfile> may be - to read from stdin, in which case\n"
+                "                    the output is saved as stdin.pcmenc. Samples are\n"
+                "                    normalised from full scale rather than their peak.\n"
+                "                    Only RLE packing is supported, without -smooth\n"
+                "                    or -flat.\n"
+                "                        Default lag 3072\n"
+                "\n"
+                "    -streamcheck    With -stream, also run the full search and report how\n"
+                "                    many decisions differ from the global optimum.\n"
+                "\n"
                 "    -precision <n>  Main search data precision:\n"
                 "                        4 = single precision (default)\n"
                 "                        8 = double precision\n"
@@ -1445,7 +2482,25 @@ int main(int argc, char** argv)
             return 0;
         }
 
-        convertWav(filename, saveInternal, costFunction, interpolation, cpuFrequency, dt1, dt2, dt3, ratio, (double)amplitude / 100, romSplit, packingType, chip, precision, smooth);
+        if (tuneBudget > 0 || tuneBanks > 0)
+        {
+            const size_t budget = tuneBudget > 0 ? tuneBudget : (size_t)tuneBanks * (romSplit > 0 ? romSplit : 16 * 1024);
+            tuneWav(filename, cpuFrequency, dt1, dt2, dt3, ratio, romSplit, packingType, chip, precision, flatEpsilon, budget, minSnr);
+            return 1;
+        }
+
+        if (stream)
+        {
+            if (smooth != 0 || flatEpsilon != 0.0)
+            {
+                throw std::invalid_argument("Streaming does not support -smooth or -flat");
+            }
+            streamWav(filename, costFunction, interpolation, cpuFrequency, dt1, dt2, dt3, ratio, (double)amplitude / 100, romSplit, packingType, chip, precision,
+                streamLag > 0 ? streamLag : stream_default_lag, streamCheck);
+            return 1;
+        }
+
+        convertWav(filename, saveInternal, costFunction, interpolation, cpuFrequency, dt1, dt2, dt3, ratio, (double)amplitude / 100, romSplit, packingType, chip, precision, smooth, flatEpsilon);
         return 1;
     }
     catch (std::exception& e)
@@ -0,0 +1,7 @@
+#!/bin/sh
+
+CC=gcc
+CFLAGS="-std=c11 -O1 -Wall -Werror -I ../Sneptile-0.10.0/libraries/libspng-0.7.4 -I ../Sneptile-0.10.0/source"
+
+# Shares the .png library and the manifest reader with Sneptile
+$CC $CFLAGS source/*.c ../Sneptile-0.10.0/source/manifest.c ../Sneptile-0.10.0/libraries/libspng-0.7.4/spng.c -lm -lz -o vdp-render
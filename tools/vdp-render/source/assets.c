@@ -0,0 +1,336 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ *
+ * Reads the arrays that Sneptile has written to an output directory.
+ *
+ * Text output is read from any array definition of the form:
+ *   const uint<n>_t <name> [...] = { <values> };
+ * with nested braces flattened, as for panels. Declarations without a
+ * definition are skipped. Where a name is defined more than once, such as
+ * the SMS and GG palettes, the first definition is used.
+ *
+ * Binary output is read from <name>.bin.
+ *
+ * Either way, values are stored as little-endian bytes, as they are in ROM.
+ */
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "render.h"
+#include "assets.h"
+
+static array_t *arrays = NULL;
+static uint32_t arrays_count = 0;
+static uint32_t arrays_capacity = 0;
+
+
+/*
+ * Read a whole file into memory, with a terminating zero byte.
+ */
+static uint8_t *assets_read_file (const char *path, uint32_t *size)
+{
+    FILE *file = fopen (path, "rb");
+    if (file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return NULL;
+    }
+
+    fseek (file, 0, SEEK_END);
+    *size = ftell (file);
+    rewind (file);
+
+    uint8_t *data = malloc (*size + 1);
+    if (data == NULL || fread (data, 1, *size, file) != *size)
+    {
+        fprintf (stderr, "Error: Failed to read %s.\n", path);
+        free (data);
+        fclose (file);
+        return NULL;
+    }
+    data [*size] = '\0';
+    fclose (file);
+
+    return data;
+}
+
+
+/*
+ * Add an array, taking ownership of the name and data.
+ * An array with the same name as an earlier one is dropped.
+ */
+static int assets_add (char *name, uint8_t *data, uint32_t size)
+{
+    if (assets_find (name) != NULL)
+    {
+        free (name);
+        free (data);
+        return RC_OK;
+    }
+
+    if (arrays_count == arrays_capacity)
+    {
+        uint32_t capacity = (arrays_capacity == 0) ? 32 : arrays_capacity * 2;
+        array_t *list = realloc (arrays, capacity * sizeof (array_t));
+        if (list == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for arrays.\n");
+            free (name);
+            free (data);
+            return RC_ERROR;
+        }
+        arrays = list;
+        arrays_capacity = capacity;
+    }
+
+    arrays [arrays_count].name = name;
+    arrays [arrays_count].data = data;
+    arrays [arrays_count].size = size;
+    arrays_count++;
+
+    return RC_OK;
+}
+
+
+/*
+ * Skip whitespace, commas, and comments.
+ */
+static const char *assets_skip (const char *c)
+{
+    while (true)
+    {
+        if (isspace (*c) || *c == ',')
+        {
+            c++;
+        }
+        else if (strncmp (c, "/*", 2) == 0)
+        {
+            const char *end = strstr (c + 2, "*/");
+            c = (end != NULL) ? end + 2 : c + strlen (c);
+        }
+        else
+        {
+            return c;
+        }
+    }
+}
+
+
+/*
+ * Read the values of an array definition, starting after its '='.
+ * Stops early at anything other than a number, such as an unterminated array.
+ */
+static uint8_t *assets_parse_values (const char *c, uint32_t value_size, uint32_t *size)
+{
+    uint32_t capacity = 1024;
+    uint8_t *data = malloc (capacity);
+    uint32_t depth = 0;
+
+    *size = 0;
+
+    for (c = assets_skip (c); data != NULL; c = assets_skip (c))
+    {
+        if (*c == '{')
+        {
+            depth++;
+            c++;
+        }
+        else if (*c == '}' && depth > 0)
+        {
+            c++;
+            if (--depth == 0)
+            {
+                break;
+            }
+        }
+        else if (isdigit (*c) && depth > 0)
+        {
+            char *end;
+            uint32_t value = strtoul (c, &end, 0);
+            c = end;
+
+            if (*size + value_size > capacity)
+            {
+                uint8_t *larger = realloc (data, capacity * 2);
+                if (larger == NULL)
+                {
+                    free (data);
+                    return NULL;
+                }
+                data = larger;
+                capacity *= 2;
+            }
+
+            for (uint32_t i = 0; i < value_size; i++)
+            {
+                data [(*size)++] = value >> (i * 8);
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return data;
+}
+
+
+/*
+ * Load the array definitions from a text file.
+ */
+static int assets_load_text (const char *path)
+{
+    static const struct { const char *type; uint32_t size; } types [] = {
+        { "uint8_t", 1 }, { "uint16_t", 2 }, { "uint32_t", 4 }
+    };
+    uint32_t file_size;
+    char *text = (char *) assets_read_file (path, &file_size);
+    int rc = RC_OK;
+
+    if (text == NULL)
+    {
+        return RC_ERROR;
+    }
+
+    for (const char *c = strstr (text, "const "); c != NULL && rc == RC_OK; c = strstr (c, "const "))
+    {
+        uint32_t value_size = 0;
+
+        c += strlen ("const ");
+        for (uint32_t i = 0; i < sizeof (types) / sizeof (types [0]); i++)
+        {
+            if (strncmp (c, types [i].type, strlen (types [i].type)) == 0 && isspace (c [strlen (types [i].type)]))
+            {
+                value_size = types [i].size;
+                c += strlen (types [i].type);
+                break;
+            }
+        }
+        if (value_size == 0)
+        {
+            continue;
+        }
+
+        /* The name, followed by its dimensions */
+        c = assets_skip (c);
+        const char *name = c;
+        while (isalnum (*c) || *c == '_')
+        {
+            c++;
+        }
+        uint32_t name_length = c - name;
+
+        /* Declarations end before their definition would start */
+        const char *equals = strchr (c, '=');
+        const char *semicolon = strchr (c, ';');
+        if (name_length == 0 || equals == NULL || (semicolon != NULL && semicolon < equals))
+        {
+            continue;
+        }
+
+        uint32_t size;
+        uint8_t *data = assets_parse_values (equals + 1, value_size, &size);
+        if (data == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for arrays.\n");
+            rc = RC_ERROR;
+        }
+        else
+        {
+            rc = assets_add (strndup (name, name_length), data, size);
+        }
+        c = equals + 1;
+    }
+
+    free (text);
+    return rc;
+}
+
+
+/*
+ * Load the arrays from every .h, .c, and .bin file in a directory.
+ */
+int assets_load (const char *dir)
+{
+    DIR *directory = opendir (dir);
+    struct dirent *entry;
+    int rc = RC_OK;
+
+    if (directory == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open directory %s.\n", dir);
+        return RC_ERROR;
+    }
+
+    while (rc == RC_OK && (entry = readdir (directory)) != NULL)
+    {
+        char *extension = strrchr (entry->d_name, '.');
+        char *path = NULL;
+
+        if (extension == NULL)
+        {
+            continue;
+        }
+
+        asprintf (&path, "%s/%s", dir, entry->d_name);
+
+        if (strcmp (extension, ".h") == 0 || strcmp (extension, ".c") == 0)
+        {
+            rc = assets_load_text (path);
+        }
+        else if (strcmp (extension, ".bin") == 0)
+        {
+            uint32_t size;
+            uint8_t *data = assets_read_file (path, &size);
+            rc = (data == NULL) ? RC_ERROR : assets_add (strndup (entry->d_name, extension - entry->d_name), data, size);
+        }
+
+        free (path);
+    }
+
+    closedir (directory);
+    return rc;
+}
+
+
+/*
+ * Find a loaded array by name.
+ */
+const array_t *assets_find (const char *name)
+{
+    for (uint32_t i = 0; i < arrays_count; i++)
+    {
+        if (strcmp (arrays [i].name, name) == 0)
+        {
+            return &arrays [i];
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+ * Free the loaded arrays.
+ */
+void assets_free (void)
+{
+    for (uint32_t i = 0; i < arrays_count; i++)
+    {
+        free (arrays [i].name);
+        free (arrays [i].data);
+    }
+    free (arrays);
+    arrays = NULL;
+    arrays_count = 0;
+    arrays_capacity = 0;
+}
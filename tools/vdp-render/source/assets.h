@@ -0,0 +1,20 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ */
+
+/* An array from Sneptile's output, as the bytes it would occupy in ROM */
+typedef struct array_s {
+    char *name;
+    uint8_t *data;
+    uint32_t size;
+} array_t;
+
+/* Load the arrays from every .h, .c, and .bin file in a directory. */
+int assets_load (const char *dir);
+
+/* Find a loaded array by name. */
+const array_t *assets_find (const char *name);
+
+/* Free the loaded arrays. */
+void assets_free (void);
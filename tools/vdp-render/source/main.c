@@ -0,0 +1,573 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ *
+ * This is a tool to check Sneptile's mode-4 output. Each sheet is
+ * rendered from the generated patterns, name table or panel table,
+ * and palettes, and compared against the source .png image.
+ *
+ * It takes the same arguments as Sneptile, including --manifest,
+ * so it can be run over every sheet after each conversion. Options
+ * that do not affect how the output is read are ignored.
+ *
+ * Sheets that use the sprite palette are rendered with the sprite
+ * palette bit set in each name-table entry, as a game would do to
+ * show them on the background layer.
+ */
+
+#define _GNU_SOURCE
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <spng.h>
+
+#include "render.h"
+#include "unpack.h"
+#include "assets.h"
+#include "manifest.h"
+
+/* Global settings */
+static char *output_dir = ".";
+static char *render_dir = NULL;
+static bool sprites = false;
+static bool global_dedupe = false;
+
+/* Per-sheet settings */
+typedef struct sheet_s {
+    const char *path;
+    bool background;
+    bool compress;
+    bool lossy;
+    uint32_t panel_width;
+    uint32_t panel_height;
+    uint32_t panel_count;
+} sheet_t;
+
+/* Totals, for the summary */
+static uint32_t sheets_checked = 0;
+static uint32_t sheets_failed = 0;
+
+
+/*
+ * Decode a .png file as RGBA.
+ */
+static uint8_t *sheet_load_png (const char *path, uint32_t *width, uint32_t *height)
+{
+    FILE *png_file = fopen (path, "rb");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return NULL;
+    }
+
+    spng_ctx *spng_context = spng_ctx_new (0);
+    struct spng_ihdr header = { };
+    size_t image_size = 0;
+    uint8_t *image = NULL;
+
+    if (spng_set_png_file (spng_context, png_file) != 0 ||
+        spng_get_ihdr (spng_context, &header) != 0 ||
+        spng_decoded_image_size (spng_context, SPNG_FMT_RGBA8, &image_size) != 0 ||
+        (image = malloc (image_size)) == NULL ||
+        spng_decode_image (spng_context, image, image_size, SPNG_FMT_RGBA8, SPNG_DECODE_TRNS) != 0)
+    {
+        fprintf (stderr, "Error: Failed to decode image %s.\n", path);
+        free (image);
+        image = NULL;
+    }
+
+    *width = header.width;
+    *height = header.height;
+
+    spng_ctx_free (spng_context);
+    fclose (png_file);
+
+    return image;
+}
+
+
+/*
+ * Encode RGBA as a .png file.
+ */
+static int sheet_write_png (const char *path, const uint8_t *rgba, uint32_t width, uint32_t height)
+{
+    FILE *png_file = fopen (path, "wb");
+    if (png_file == NULL)
+    {
+        fprintf (stderr, "Error: Unable to open %s.\n", path);
+        return RC_ERROR;
+    }
+
+    spng_ctx *spng_context = spng_ctx_new (SPNG_CTX_ENCODER);
+    struct spng_ihdr header = {
+        .width = width,
+        .height = height,
+        .bit_depth = 8,
+        .color_type = SPNG_COLOR_TYPE_TRUECOLOR_ALPHA
+    };
+    int rc = RC_OK;
+
+    if (spng_set_png_file (spng_context, png_file) != 0 ||
+        spng_set_ihdr (spng_context, &header) != 0 ||
+        spng_encode_image (spng_context, rgba, width * height * 4, SPNG_FMT_PNG, SPNG_ENCODE_FINALIZE) != 0)
+    {
+        fprintf (stderr, "Error: Failed to encode image %s.\n", path);
+        rc = RC_ERROR;
+    }
+
+    spng_ctx_free (spng_context);
+    fclose (png_file);
+
+    return rc;
+}
+
+
+/*
+ * Gather the patterns of a sheet into a single buffer, to be freed by the caller.
+ * Patterns split between banks continue as <name>_patterns_1, <name>_patterns_2, etc.
+ */
+static int32_t sheet_patterns (const char *base_name, const sheet_t *sheet, uint8_t **patterns)
+{
+    char *array_name = NULL;
+    const array_t *array;
+
+    if (global_dedupe)
+    {
+        array_name = strdup ("pattern_pool");
+    }
+    else
+    {
+        asprintf (&array_name, sheet->compress ? "%s_patterns_compressed" : "%s_patterns", base_name);
+    }
+
+    array = assets_find (array_name);
+    if (array == NULL)
+    {
+        fprintf (stderr, "Error: No %s array in %s.\n", array_name, output_dir);
+        free (array_name);
+        return -1;
+    }
+
+    if (sheet->compress)
+    {
+        int32_t count = unpack_patterns (array->data, array->size, patterns);
+        if (count < 0)
+        {
+            fprintf (stderr, "Error: Invalid compressed patterns in %s.\n", array_name);
+        }
+        free (array_name);
+        return count;
+    }
+
+    uint32_t size = 0;
+    *patterns = NULL;
+
+    for (uint32_t part = 1; array != NULL; part++)
+    {
+        uint8_t *larger = realloc (*patterns, size + array->size + 1);
+        if (larger == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for patterns.\n");
+            free (*patterns);
+            free (array_name);
+            return -1;
+        }
+        *patterns = larger;
+        memcpy (&larger [size], array->data, array->size);
+        size += array->size;
+
+        free (array_name);
+        array_name = NULL;
+        if (!global_dedupe)
+        {
+            asprintf (&array_name, "%s_patterns_%u", base_name, part);
+        }
+        array = (array_name != NULL) ? assets_find (array_name) : NULL;
+    }
+    free (array_name);
+
+    return size / 32;
+}
+
+
+/*
+ * Build the name table for a sheet of width × height tiles, to be freed by the caller.
+ * Panels are placed where Sneptile found them, leaving the rest of the sheet without entries.
+ */
+static uint16_t *sheet_entries (const char *base_name, const sheet_t *sheet, uint32_t width, uint32_t height)
+{
+    uint32_t tile_count = width * height;
+    uint16_t *entries = malloc (tile_count * sizeof (uint16_t));
+    uint16_t *table = NULL;
+    uint32_t table_count = 0;
+    char *array_name = NULL;
+
+    if (entries == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for name table.\n");
+        return NULL;
+    }
+
+    if (sheet->panel_count)
+    {
+        asprintf (&array_name, "%s_panels", base_name);
+    }
+    else
+    {
+        asprintf (&array_name, sheet->compress ? "%s_indices_compressed" : "%s_indices", base_name);
+    }
+
+    const array_t *array = assets_find (array_name);
+    if (array == NULL)
+    {
+        fprintf (stderr, "Error: No %s array in %s.\n", array_name, output_dir);
+    }
+    else if (sheet->compress && !sheet->panel_count)
+    {
+        int32_t count = unpack_indices (array->data, array->size, &table);
+        if (count < 0)
+        {
+            fprintf (stderr, "Error: Invalid compressed indices in %s.\n", array_name);
+        }
+        table_count = (count < 0) ? 0 : count;
+    }
+    else if ((table = malloc (array->size + 1)) == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for name table.\n");
+    }
+    else
+    {
+        table_count = array->size / 2;
+        for (uint32_t i = 0; i < table_count; i++)
+        {
+            table [i] = array->data [i * 2] | (array->data [i * 2 + 1] << 8);
+        }
+    }
+
+    uint32_t expected = sheet->panel_count ? sheet->panel_count * sheet->panel_width * sheet->panel_height : tile_count;
+    if (table != NULL && table_count != expected)
+    {
+        fprintf (stderr, "Error: %s has %u entries, expected %u.\n", array_name, table_count, expected);
+        free (table);
+        table = NULL;
+    }
+    free (array_name);
+
+    if (table == NULL)
+    {
+        free (entries);
+        return NULL;
+    }
+
+    if (sheet->panel_count)
+    {
+        uint32_t panels_remaining = sheet->panel_count;
+        uint32_t table_index = 0;
+
+        for (uint32_t i = 0; i < tile_count; i++)
+        {
+            entries [i] = ENTRY_NONE;
+        }
+
+        for (uint32_t panel_row = 0; panel_row < height && panels_remaining > 0; panel_row += sheet->panel_height)
+        for (uint32_t panel_col = 0; panel_col < width && panels_remaining > 0; panel_col += sheet->panel_width)
+        {
+            for (uint32_t row = panel_row; row < panel_row + sheet->panel_height; row++)
+            for (uint32_t col = panel_col; col < panel_col + sheet->panel_width; col++)
+            {
+                if (row < height && col < width)
+                {
+                    entries [row * width + col] = table [table_index];
+                }
+                table_index++;
+            }
+            panels_remaining--;
+        }
+    }
+    else
+    {
+        memcpy (entries, table, tile_count * sizeof (uint16_t));
+    }
+    free (table);
+
+    /* Show sprite-palette sheets on the background layer */
+    if (!sheet->background)
+    {
+        for (uint32_t i = 0; i < tile_count; i++)
+        {
+            if (entries [i] != ENTRY_NONE)
+            {
+                entries [i] |= ENTRY_SPRITE_PALETTE;
+            }
+        }
+    }
+
+    return entries;
+}
+
+
+/*
+ * Render a sheet from the generated output, and compare it against its source image.
+ */
+static int sheet_check (const sheet_t *sheet)
+{
+    const char *name = (strrchr (sheet->path, '/') != NULL) ? strrchr (sheet->path, '/') + 1 : sheet->path;
+    char *base_name = strndup (name, strcspn (name, "."));
+    uint8_t *source = NULL;
+    uint8_t *patterns = NULL;
+    uint16_t *entries = NULL;
+    uint8_t *pixels = NULL;
+    uint32_t width;
+    uint32_t height;
+    int rc = RC_ERROR;
+
+    vdp_t vdp = { };
+    const array_t *background_palette = assets_find ("background_palette");
+    const array_t *sprite_palette = assets_find ("sprite_palette");
+    if (background_palette != NULL && sprite_palette != NULL)
+    {
+        memcpy (&vdp.palette [0], background_palette->data, (background_palette->size < 16) ? background_palette->size : 16);
+        memcpy (&vdp.palette [16], sprite_palette->data, (sprite_palette->size < 16) ? sprite_palette->size : 16);
+    }
+    else
+    {
+        fprintf (stderr, "Error: No palettes in %s.\n", output_dir);
+    }
+
+    int32_t pattern_count = -1;
+    if (background_palette == NULL || sprite_palette == NULL)
+    {
+        /* Already reported */
+    }
+    else if ((source = sheet_load_png (sheet->path, &width, &height)) == NULL)
+    {
+        /* Already reported */
+    }
+    else if (width % 8 != 0 || height % 8 != 0)
+    {
+        fprintf (stderr, "Error: Invalid resolution %ux%u\n", width, height);
+    }
+    else if ((pattern_count = sheet_patterns (base_name, sheet, &patterns)) < 0 ||
+             (entries = sheet_entries (base_name, sheet, width / 8, height / 8)) == NULL)
+    {
+        /* Already reported */
+    }
+    else if ((pixels = malloc (width * height)) == NULL)
+    {
+        fprintf (stderr, "Error: Failed to allocate memory for %s.\n", name);
+    }
+    else
+    {
+        vdp.patterns = patterns;
+        vdp.pattern_count = pattern_count;
+        rc = render_name_table (&vdp, entries, width / 8, height / 8, pixels);
+        if (rc != RC_OK)
+        {
+            fprintf (stderr, "Error: %s refers to a pattern beyond the %u patterns generated.\n", name, pattern_count);
+        }
+    }
+
+    if (rc == RC_OK)
+    {
+        render_diff_t diff;
+        render_diff (&vdp, pixels, source, width, height, sprites, &diff);
+
+        if (diff.tiles == 0)
+        {
+            printf ("%s: %u tiles match\n", name, diff.tiles_checked);
+        }
+        else
+        {
+            /* With --max-patterns, tiles are expected to change */
+            fprintf (sheet->lossy ? stdout : stderr, "%s%s: %u of %u tiles differ (%u pixels), first at tile %u, %u%s\n",
+                     sheet->lossy ? "" : "Error: ", name, diff.tiles, diff.tiles_checked, diff.pixels,
+                     diff.first_x, diff.first_y, sheet->lossy ? ", from --max-patterns" : "");
+            if (!sheet->lossy)
+            {
+                rc = RC_ERROR;
+            }
+        }
+    }
+
+    if (pixels != NULL && render_dir != NULL)
+    {
+        uint8_t *rgba = malloc (width * height * 4);
+        char *path = NULL;
+
+        asprintf (&path, "%s/%s.png", render_dir, base_name);
+        if (rgba == NULL)
+        {
+            fprintf (stderr, "Error: Failed to allocate memory for %s.\n", name);
+            rc = RC_ERROR;
+        }
+        else
+        {
+            render_rgba (&vdp, pixels, width * height, sprites, rgba);
+            if (sheet_write_png (path, rgba, width, height) != RC_OK)
+            {
+                rc = RC_ERROR;
+            }
+        }
+        free (path);
+        free (rgba);
+    }
+
+    sheets_checked++;
+    if (rc != RC_OK)
+    {
+        sheets_failed++;
+    }
+
+    free (base_name);
+    free (source);
+    free (patterns);
+    free (entries);
+    free (pixels);
+
+    return rc;
+}
+
+
+/*
+ * Check a set of sheets, as described by a Sneptile command line.
+ */
+static int vdp_render_run (int argc, char **argv)
+{
+    int rc = RC_OK;
+
+    if (argc < 2)
+    {
+        fprintf (stderr, "Usage: %s [Sneptile options, tiles.png]\n", argv [0]);
+        fprintf (stderr, "       %s --manifest <file>\n", argv [0]);
+        fprintf (stderr, "  Renders each sheet from the mode-4 output of Sneptile, and compares it against the sheet.\n");
+        fprintf (stderr, "  Takes the same options as Sneptile, with one more:\n");
+        fprintf (stderr, "    --render-dir <dir> : Also write each rendered sheet as <dir>/<name>.png\n");
+        return EXIT_FAILURE;
+    }
+    argv++;
+    argc--;
+
+    sheet_t sheet = { };
+    bool assets_loaded = false;
+
+    for (uint32_t i = 0; i < argc && rc == RC_OK; i++)
+    {
+        /* Global options */
+        if (strcmp (argv [i], "--output-dir") == 0 && i + 1 < argc)
+        {
+            output_dir = argv [++i];
+        }
+        else if (strcmp (argv [i], "--render-dir") == 0 && i + 1 < argc)
+        {
+            render_dir = argv [++i];
+            mkdir (render_dir, S_IRWXU);
+        }
+        else if (strcmp (argv [i], "--sprites") == 0)
+        {
+            sprites = true;
+        }
+        else if (strcmp (argv [i], "--global-dedupe") == 0)
+        {
+            global_dedupe = true;
+        }
+        else if (strcmp (argv [i], "--mode-0") == 0 || strcmp (argv [i], "--mode-2") == 0 ||
+                 strcmp (argv [i], "--tms-small-sprites") == 0 || strcmp (argv [i], "--tms-large-sprites") == 0)
+        {
+            fprintf (stderr, "Error: Only mode-4 output can be rendered.\n");
+            rc = RC_ERROR;
+        }
+
+        /* Options that take a value, but don't affect how the output is read */
+        else if ((strcmp (argv [i], "--cache-dir") == 0 || strcmp (argv [i], "--bank-size") == 0 ||
+                  strcmp (argv [i], "--first-bank") == 0 || strcmp (argv [i], "--jobs") == 0) && i + 1 < argc)
+        {
+            i++;
+        }
+        else if (strcmp (argv [i], "--sprite-palette") == 0 || strcmp (argv [i], "--background-palette") == 0)
+        {
+            while (i + 1 < argc && strncmp (argv [i + 1], "0x", 2) == 0 && strlen (argv [i + 1]) == 4)
+            {
+                i++;
+            }
+        }
+
+        /* Per-sheet options */
+        else if (strcmp (argv [i], "--background") == 0)
+        {
+            sheet.background = true;
+        }
+        else if (strcmp (argv [i], "--compress") == 0)
+        {
+            sheet.compress = true;
+        }
+        else if (strcmp (argv [i], "--max-patterns") == 0 && i + 1 < argc)
+        {
+            sheet.lossy = true;
+            i++;
+        }
+        else if (strcmp (argv [i], "--panels") == 0 && i + 1 < argc)
+        {
+            unsigned int width, height, count;
+            if (sscanf (argv [++i], "%ux%u,%u", &width, &height, &count) != 3 || width == 0 || height == 0)
+            {
+                fprintf (stderr, "Error: Invalid panels %s.\n", argv [i]);
+                rc = RC_ERROR;
+            }
+            sheet.panel_width = width;
+            sheet.panel_height = height;
+            sheet.panel_count = count;
+        }
+        else if (strncmp (argv [i], "--", 2) == 0)
+        {
+            /* Other Sneptile options, such as --flip-dedupe or --binary */
+        }
+
+        /* Sheets, once the output has been loaded */
+        else
+        {
+            if (!assets_loaded)
+            {
+                if (assets_load (output_dir) != RC_OK)
+                {
+                    rc = RC_ERROR;
+                    break;
+                }
+                assets_loaded = true;
+            }
+
+            sheet.path = argv [i];
+            sheet_check (&sheet);
+
+            /* Restore per-sheet settings back to their defaults */
+            memset (&sheet, 0, sizeof (sheet));
+        }
+    }
+
+    assets_free ();
+
+    if (rc == RC_OK && sheets_failed > 0)
+    {
+        fprintf (stderr, "Error: %u of %u sheets in %s do not match their output.\n", sheets_failed, sheets_checked, output_dir);
+        rc = RC_ERROR;
+    }
+
+    return rc == RC_OK ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+/*
+ * Entry point.
+ */
+int main (int argc, char **argv)
+{
+    if (argc == 3 && strcmp (argv [1], "--manifest") == 0)
+    {
+        return manifest_run (argv [0], argv [2], vdp_render_run);
+    }
+
+    return vdp_render_run (argc, argv);
+}
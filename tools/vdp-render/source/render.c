@@ -0,0 +1,180 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ *
+ * Renders mode-4 patterns through a name table, as the VDP would.
+ *
+ * Pixels are first rendered as palette indices, rather than colours, as the
+ * same colour may appear at more than one index. Index 0 is also used for
+ * transparent pixels, so a source pixel is matched by checking its index as
+ * well as its colour.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "render.h"
+
+
+/*
+ * Render a single pattern into palette indices.
+ * The stride is the distance between rows of the output, in pixels.
+ */
+static void render_pattern (const uint8_t *pattern, uint16_t entry, uint8_t *pixels, uint32_t stride)
+{
+    uint8_t palette = (entry & ENTRY_SPRITE_PALETTE) ? PIXEL_SPRITE_PALETTE : 0;
+
+    for (uint32_t y = 0; y < 8; y++)
+    {
+        /* VRAM stores the four bitplanes of each row together */
+        const uint8_t *planes = &pattern [((entry & ENTRY_FLIP_V) ? 7 - y : y) * 4];
+
+        for (uint32_t x = 0; x < 8; x++)
+        {
+            uint32_t bit = (entry & ENTRY_FLIP_H) ? x : 7 - x;
+            uint8_t index = ((planes [0] >> bit) & 1) |
+                            ((planes [1] >> bit) & 1) << 1 |
+                            ((planes [2] >> bit) & 1) << 2 |
+                            ((planes [3] >> bit) & 1) << 3;
+
+            pixels [y * stride + x] = palette | index;
+        }
+    }
+}
+
+
+/*
+ * Render a name table of width × height entries into palette indices, 8 × 8 per entry.
+ * Positions without an entry are rendered as PIXEL_NONE.
+ * Fails if an entry refers to a pattern that has not been loaded.
+ */
+int render_name_table (const vdp_t *vdp, const uint16_t *entries, uint32_t width, uint32_t height, uint8_t *pixels)
+{
+    uint32_t stride = width * 8;
+
+    for (uint32_t row = 0; row < height; row++)
+    {
+        for (uint32_t col = 0; col < width; col++)
+        {
+            uint16_t entry = entries [row * width + col];
+            uint8_t *tile = &pixels [row * 8 * stride + col * 8];
+
+            if (entry == ENTRY_NONE)
+            {
+                for (uint32_t y = 0; y < 8; y++)
+                {
+                    memset (&tile [y * stride], PIXEL_NONE, 8);
+                }
+                continue;
+            }
+
+            if ((entry & ENTRY_PATTERN) >= vdp->pattern_count)
+            {
+                return RC_ERROR;
+            }
+
+            render_pattern (&vdp->patterns [(entry & ENTRY_PATTERN) * 32], entry, tile, stride);
+        }
+    }
+
+    return RC_OK;
+}
+
+
+/*
+ * Convert a 6-bit colour to RGBA.
+ */
+static void render_colour (uint8_t colour, uint8_t *rgba)
+{
+    rgba [0] = ((colour >> 0) & 0x03) * 0x55;
+    rgba [1] = ((colour >> 2) & 0x03) * 0x55;
+    rgba [2] = ((colour >> 4) & 0x03) * 0x55;
+    rgba [3] = 0xff;
+}
+
+
+/*
+ * Convert rendered palette indices to RGBA.
+ * In sprite mode, index 0 of either palette is transparent.
+ */
+void render_rgba (const vdp_t *vdp, const uint8_t *pixels, uint32_t pixel_count, bool sprites, uint8_t *rgba)
+{
+    for (uint32_t i = 0; i < pixel_count; i++)
+    {
+        if (pixels [i] == PIXEL_NONE || (sprites && (pixels [i] & 0x0f) == 0))
+        {
+            memset (&rgba [i * 4], 0, 4);
+        }
+        else
+        {
+            render_colour (vdp->palette [pixels [i]], &rgba [i * 4]);
+        }
+    }
+}
+
+
+/*
+ * Check if a rendered pixel matches its source pixel.
+ * Transparent pixels must use index 0. Visible pixels must have the same colour
+ * once reduced to 6 bits, and in sprite mode must not use the transparent index.
+ */
+static bool render_match (const vdp_t *vdp, uint8_t pixel, const uint8_t *source, bool sprites)
+{
+    if (source [3] == 0)
+    {
+        return (pixel & 0x0f) == 0;
+    }
+
+    if (sprites && (pixel & 0x0f) == 0)
+    {
+        return false;
+    }
+
+    uint8_t colour = (source [0] >> 6) | ((source [1] >> 6) << 2) | ((source [2] >> 6) << 4);
+
+    return vdp->palette [pixel] == colour;
+}
+
+
+/*
+ * Compare rendered palette indices against the source RGBA image.
+ * Both images are width × height pixels. Tiles without an entry are not compared.
+ */
+void render_diff (const vdp_t *vdp, const uint8_t *pixels, const uint8_t *source, uint32_t width, uint32_t height,
+                  bool sprites, render_diff_t *diff)
+{
+    memset (diff, 0, sizeof (render_diff_t));
+
+    for (uint32_t row = 0; row < height; row += 8)
+    {
+        for (uint32_t col = 0; col < width; col += 8)
+        {
+            uint32_t tile_pixels = 0;
+
+            if (pixels [row * width + col] == PIXEL_NONE)
+            {
+                continue;
+            }
+
+            for (uint32_t y = row; y < row + 8; y++)
+            {
+                for (uint32_t x = col; x < col + 8; x++)
+                {
+                    if (!render_match (vdp, pixels [y * width + x], &source [(y * width + x) * 4], sprites))
+                    {
+                        tile_pixels++;
+                    }
+                }
+            }
+
+            if (tile_pixels > 0 && diff->tiles++ == 0)
+            {
+                diff->first_x = col / 8;
+                diff->first_y = row / 8;
+            }
+            diff->pixels += tile_pixels;
+            diff->tiles_checked++;
+        }
+    }
+}
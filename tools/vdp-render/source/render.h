@@ -0,0 +1,47 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ */
+
+/* Return Codes */
+#define RC_OK       0
+#define RC_ERROR   -1
+
+/* Name-table entry bits */
+#define ENTRY_PATTERN           0x01ff
+#define ENTRY_FLIP_H            0x0200
+#define ENTRY_FLIP_V            0x0400
+#define ENTRY_SPRITE_PALETTE    0x0800
+
+/* A position that is not covered by the name table, eg. beyond the last panel */
+#define ENTRY_NONE              0xffff
+
+/* Rendered pixels hold a palette index, with the sprite palette as 16-31 */
+#define PIXEL_SPRITE_PALETTE    0x10
+#define PIXEL_NONE              0xff
+
+/* Patterns and palettes, as they would be loaded into the VDP */
+typedef struct vdp_s {
+    const uint8_t *patterns;    /* 32 bytes per pattern, in VRAM order */
+    uint32_t pattern_count;
+    uint8_t palette [32];       /* Background palette, then sprite palette, as 6-bit colours */
+} vdp_t;
+
+/* Differences between a rendered name table and its source image */
+typedef struct render_diff_s {
+    uint32_t pixels;            /* Pixels that differ */
+    uint32_t tiles;             /* Tiles with at least one differing pixel */
+    uint32_t tiles_checked;     /* Tiles covered by the name table */
+    uint32_t first_x;           /* Position of the first differing tile, in tiles */
+    uint32_t first_y;
+} render_diff_t;
+
+/* Render a name table of width × height entries into palette indices, 8 × 8 per entry. */
+int render_name_table (const vdp_t *vdp, const uint16_t *entries, uint32_t width, uint32_t height, uint8_t *pixels);
+
+/* Convert rendered palette indices to RGBA. */
+void render_rgba (const vdp_t *vdp, const uint8_t *pixels, uint32_t pixel_count, bool sprites, uint8_t *rgba);
+
+/* Compare rendered palette indices against the source RGBA image. */
+void render_diff (const vdp_t *vdp, const uint8_t *pixels, const uint8_t *source, uint32_t width, uint32_t height,
+                  bool sprites, render_diff_t *diff);
@@ -0,0 +1,181 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ *
+ * Decoders for the compressed formats written by Sneptile's --compress,
+ * following the same steps as sms-unpack. See Sneptile's compress.c for
+ * a description of the formats.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unpack.h"
+
+#define RUN_LITERAL     0x00
+#define RUN_REPEAT      0x40
+#define RUN_INCREMENT   0x80
+#define RUN_TYPE_MASK   0xc0
+#define RUN_LENGTH_MASK 0x3f
+
+
+/*
+ * Decompress Sneptile's compressed patterns.
+ * The patterns are returned as 32 bytes each in VRAM order, to be freed by the caller.
+ * Returns the number of patterns, or -1 if the data is invalid.
+ */
+int32_t unpack_patterns (const uint8_t *data, uint32_t size, uint8_t **patterns)
+{
+    uint32_t offset = 2;
+
+    if (size < 2)
+    {
+        return -1;
+    }
+
+    uint32_t pattern_count = data [0] | (data [1] << 8);
+    uint8_t *output = calloc (pattern_count + 1, 32);
+    if (output == NULL)
+    {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < pattern_count; i++)
+    {
+        uint8_t *pattern = &output [i * 32];
+
+        if (offset >= size)
+        {
+            free (output);
+            return -1;
+        }
+        uint8_t modes = data [offset++];
+
+        for (uint32_t plane = 0; plane < 4; plane++)
+        {
+            uint8_t mode = (modes >> (plane * 2)) & 0x03;
+            uint8_t repeats = 0;
+
+            if (mode == 3)
+            {
+                if (offset >= size)
+                {
+                    free (output);
+                    return -1;
+                }
+                repeats = data [offset++];
+            }
+
+            for (uint32_t row = 0; row < 8; row++)
+            {
+                uint8_t *byte = &pattern [row * 4 + plane];
+
+                switch (mode)
+                {
+                    case 0:
+                        *byte = 0x00;
+                        break;
+                    case 1:
+                        *byte = 0xff;
+                        break;
+                    case 2:
+                        if (plane == 0)
+                        {
+                            free (output);
+                            return -1;
+                        }
+                        *byte = pattern [row * 4 + plane - 1];
+                        break;
+                    default:
+                        if (row > 0 && (repeats & (1 << row)))
+                        {
+                            *byte = pattern [(row - 1) * 4 + plane];
+                        }
+                        else if (offset < size)
+                        {
+                            *byte = data [offset++];
+                        }
+                        else
+                        {
+                            free (output);
+                            return -1;
+                        }
+                        break;
+                }
+            }
+        }
+    }
+
+    *patterns = output;
+    return pattern_count;
+}
+
+
+/*
+ * Decompress Sneptile's compressed indices.
+ * The entries are returned to be freed by the caller.
+ * Returns the number of entries, or -1 if the data is invalid.
+ */
+int32_t unpack_indices (const uint8_t *data, uint32_t size, uint16_t **entries)
+{
+    uint32_t capacity = 256;
+    uint32_t count = 0;
+    uint32_t offset = 0;
+    uint16_t *output = malloc (capacity * sizeof (uint16_t));
+
+    while (output != NULL && offset < size && data [offset] != 0x00)
+    {
+        uint8_t type = data [offset] & RUN_TYPE_MASK;
+        uint32_t length = data [offset++] & RUN_LENGTH_MASK;
+
+        if (type != RUN_LITERAL && type != RUN_REPEAT && type != RUN_INCREMENT)
+        {
+            free (output);
+            return -1;
+        }
+
+        /* Each run holds at most 63 entries */
+        if (count + RUN_LENGTH_MASK > capacity)
+        {
+            uint16_t *larger = realloc (output, capacity * 2 * sizeof (uint16_t));
+            if (larger == NULL)
+            {
+                free (output);
+                return -1;
+            }
+            output = larger;
+            capacity *= 2;
+        }
+
+        for (uint32_t i = 0; i < length; i++)
+        {
+            if (type == RUN_LITERAL || i == 0)
+            {
+                if (offset + 2 > size)
+                {
+                    free (output);
+                    return -1;
+                }
+                output [count] = data [offset] | (data [offset + 1] << 8);
+                offset += 2;
+            }
+            else
+            {
+                output [count] = output [count - 1] + ((type == RUN_INCREMENT) ? 1 : 0);
+            }
+            count++;
+        }
+    }
+
+    /* The data ends with a zero byte */
+    if (output == NULL || offset >= size)
+    {
+        free (output);
+        return -1;
+    }
+
+    *entries = output;
+    return count;
+}
@@ -0,0 +1,10 @@
+/*
+ * VDP Render
+ * Ants for Master System
+ */
+
+/* Decompress Sneptile's compressed patterns. Returns the number of patterns, or -1 if the data is invalid. */
+int32_t unpack_patterns (const uint8_t *data, uint32_t size, uint8_t **patterns);
+
+/* Decompress Sneptile's compressed indices. Returns the number of entries, or -1 if the data is invalid. */
+int32_t unpack_indices (const uint8_t *data, uint32_t size, uint16_t **entries);